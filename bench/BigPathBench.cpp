@@ -8,9 +8,15 @@
 #include "bench/Benchmark.h"
 #include "bench/BigPath.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkPathBuilder.h"
+#include "include/private/base/SkFloatingPoint.h"
+#include "src/core/SkScan.h"
 #include "tools/ToolUtils.h"
 
+#include <memory>
+
 enum Align {
     kLeft_Align,
     kMiddle_Align,
@@ -83,3 +89,78 @@ DEF_BENCH( return new BigPathBench(kRight_Align,    false); )
 DEF_BENCH( return new BigPathBench(kLeft_Align,     true); )
 DEF_BENCH( return new BigPathBench(kMiddle_Align,   true); )
 DEF_BENCH( return new BigPathBench(kRight_Align,    true); )
+
+// A huge, self-intersecting antialiased fill, scan converted by AAA in parallel strips on
+// `threads` threads (or by the usual single-threaded edge walk when threads is 0).
+class AAAStripsBench : public Benchmark {
+    SkPath                      fPath;
+    SkString                    fName;
+    int                         fThreads;
+    std::unique_ptr<SkExecutor> fExecutor;
+
+public:
+    explicit AAAStripsBench(int threads) : fThreads(threads) {
+        fName.printf("bigpath_aaa_strips_%d", threads);
+    }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    bool isSuitableFor(Backend backend) override { return backend == kRaster_Backend; }
+
+    SkISize onGetSize() override { return SkISize::Make(1024, 1024); }
+
+    void onDelayedSetup() override {
+        // A wobbly star with a few thousand points, wound around the center several times.
+        constexpr int kPoints = 5000;
+        SkPathBuilder builder;
+        for (int i = 0; i < kPoints; ++i) {
+            const float t = i * (7 * SK_FloatPI / kPoints),
+                        r = 300 + 200 * sk_float_sin(i * 0.37f) + 8 * sk_float_cos(i * 3.1f);
+            const SkPoint p = {512 + r * sk_float_cos(t), 512 + r * sk_float_sin(t)};
+            if (i == 0) {
+                builder.moveTo(p);
+            } else {
+                builder.lineTo(p);
+            }
+        }
+        builder.close();
+        fPath = builder.detach();
+
+        if (fThreads > 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        }
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        this->setupPaint(&paint);
+
+        // This path has far too many points for AAA to pick it on its own.
+        const bool wasForced = gSkForceAnalyticAA,
+                   wasParallel = gSkParallelAnalyticAA;
+        SkExecutor* previous = &SkExecutor::GetDefault();
+        gSkForceAnalyticAA = true;
+        gSkParallelAnalyticAA = fExecutor != nullptr;
+        if (fExecutor) {
+            SkExecutor::SetDefault(fExecutor.get());
+        }
+
+        for (int i = 0; i < loops; i++) {
+            canvas->drawPath(fPath, paint);
+        }
+
+        SkExecutor::SetDefault(previous);
+        gSkForceAnalyticAA = wasForced;
+        gSkParallelAnalyticAA = wasParallel;
+    }
+
+private:
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH( return new AAAStripsBench(0); )
+DEF_BENCH( return new AAAStripsBench(2); )
+DEF_BENCH( return new AAAStripsBench(4); )
+DEF_BENCH( return new AAAStripsBench(8); )
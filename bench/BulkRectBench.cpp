@@ -13,11 +13,6 @@
 #include "include/gpu/GrDirectContext.h"
 #include "include/gpu/ganesh/SkImageGanesh.h"
 #include "src/base/SkRandom.h"
-#include "src/core/SkCanvasPriv.h"
-#include "src/gpu/ganesh/GrCanvas.h"
-#include "src/gpu/ganesh/GrOpsTypes.h"
-#include "src/gpu/ganesh/SkGr.h"
-#include "src/gpu/ganesh/SurfaceDrawContext.h"
 
 // Benchmarks that exercise the bulk image and solid color quad APIs, under a variety of patterns:
 enum class ImageMode {
@@ -51,16 +46,6 @@ public:
     inline static constexpr int kImageCount = kImageMode == ImageMode::kShared ?
             1 : (kImageMode == ImageMode::kNone ? 0 : kRectCount);
 
-    bool isSuitableFor(Backend backend) override {
-        if (kDrawMode == DrawMode::kBatch && kImageMode == ImageMode::kNone) {
-            // Currently the bulk color quad API is only available on
-            // skgpu::ganesh::SurfaceDrawContext
-            return backend == kGPU_Backend;
-        } else {
-            return this->INHERITED::isSuitableFor(backend);
-        }
-    }
-
 protected:
     SkRect         fRects[kRectCount];
     sk_sp<SkImage> fImages[kImageCount];
@@ -134,27 +119,8 @@ protected:
         SkASSERT(kImageMode == ImageMode::kNone);
         SkASSERT(kDrawMode == DrawMode::kBatch);
 
-        auto context = canvas->recordingContext();
-        SkASSERT(context);
-
-        GrQuadSetEntry batch[kRectCount];
-        for (int i = 0; i < kRectCount; ++i) {
-            batch[i].fRect = fRects[i];
-            batch[i].fColor = fColors[i].premul();
-            batch[i].fLocalMatrix = SkMatrix::I();
-            batch[i].fAAFlags = GrQuadAAFlags::kAll;
-        }
-
-        SkPaint paint;
-        paint.setColor(SK_ColorWHITE);
-        paint.setAntiAlias(true);
-
-        auto sdc = skgpu::ganesh::TopDeviceSurfaceDrawContext(canvas);
-        SkMatrix view = canvas->getLocalToDeviceAs3x3();
-        SkSurfaceProps props;
-        GrPaint grPaint;
-        SkPaintToGrPaint(context, sdc->colorInfo(), paint, view, props, &grPaint);
-        sdc->drawQuadSet(nullptr, std::move(grPaint), view, batch, kRectCount);
+        canvas->experimental_DrawEdgeAARectSet(fRects, fColors, kRectCount, nullptr, nullptr,
+                                               SkCanvas::kAll_QuadAAFlags, SkBlendMode::kSrcOver);
     }
 
     void drawSolidColorsRef(SkCanvas* canvas) const {
@@ -41,8 +41,8 @@ private:
     using INHERITED = Benchmark;
 };
 
-// Performance remains roughly constant up to 32 (the number of preallocated save records).
-// After that, the cost of additional malloc/free calls starts to be measurable.
+// The first 32 save records are preallocated. Deeper stacks grow the record storage on the first
+// loop and reuse it afterwards, so the per-save cost should stay roughly constant at every depth.
 DEF_BENCH( return new CanvasSaveRestoreBench(8);)
 DEF_BENCH( return new CanvasSaveRestoreBench(32);)
 DEF_BENCH( return new CanvasSaveRestoreBench(128);)
@@ -6,14 +6,20 @@
  */
 
 #include "bench/Benchmark.h"
+#include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkColorPriv.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkString.h"
 #include "include/core/SkTileMode.h"
 #include "tools/DecodeUtils.h"
 #include "tools/Resources.h"
 
+#include <memory>
+
 class FilteringBench : public Benchmark {
 public:
     FilteringBench(SkFilterMode fm, SkMipmapMode mm) : fSampling(fm, mm) {
@@ -63,3 +69,73 @@ DEF_BENCH( return new FilteringBench(SkFilterMode::kLinear,  SkMipmapMode::kNone
 DEF_BENCH( return new FilteringBench(SkFilterMode::kNearest, SkMipmapMode::kLinear); )
 DEF_BENCH( return new FilteringBench(SkFilterMode::kNearest, SkMipmapMode::kNearest); )
 DEF_BENCH( return new FilteringBench(SkFilterMode::kNearest, SkMipmapMode::kNone); )
+
+// Downscales a large image on the CPU, either with SkPixmap::scalePixels() (as a baseline) or with
+// SkPixmap::resamplePixels().
+class ResampleBench : public Benchmark {
+public:
+    enum class Mode { kScalePixels, kMitchell, kLanczos3, kLanczos3Linear };
+
+    ResampleBench(Mode mode, int threads = 0) : fMode(mode), fThreads(threads) {
+        static const char* kNames[] = {"scalepixels", "mitchell", "lanczos3", "lanczos3_linear"};
+        fName.printf("resample_%s_3000x2000_to_500x333", kNames[(int)mode]);
+        if (threads > 0) {
+            fName.appendf("_%dthreads", threads);
+        }
+    }
+
+protected:
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDelayedSetup() override {
+        fSrc.allocN32Pixels(3000, 2000);
+        for (int y = 0; y < fSrc.height(); ++y) {
+            for (int x = 0; x < fSrc.width(); ++x) {
+                *fSrc.getAddr32(x, y) = SkPackARGB32(0xFF, x & 0xFF, y & 0xFF, (x ^ y) & 0xFF);
+            }
+        }
+        fDst.allocN32Pixels(500, 333);
+        if (fThreads > 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        }
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; ++i) {
+            switch (fMode) {
+                case Mode::kScalePixels:
+                    fSrc.pixmap().scalePixels(fDst.pixmap(),
+                                              SkSamplingOptions(SkCubicResampler::Mitchell()));
+                    break;
+                case Mode::kMitchell:
+                    fSrc.pixmap().resamplePixels(fDst.pixmap(),
+                                                 SkPixmap::ResampleFilter::kMitchell,
+                                                 /*linear=*/false,
+                                                 fExecutor.get());
+                    break;
+                case Mode::kLanczos3:
+                case Mode::kLanczos3Linear:
+                    fSrc.pixmap().resamplePixels(fDst.pixmap(),
+                                                 SkPixmap::ResampleFilter::kLanczos3,
+                                                 fMode == Mode::kLanczos3Linear,
+                                                 fExecutor.get());
+                    break;
+            }
+        }
+    }
+
+private:
+    const Mode fMode;
+    const int fThreads;
+    SkString fName;
+    SkBitmap fSrc, fDst;
+    std::unique_ptr<SkExecutor> fExecutor;
+};
+
+DEF_BENCH( return new ResampleBench(ResampleBench::Mode::kScalePixels); )
+DEF_BENCH( return new ResampleBench(ResampleBench::Mode::kMitchell); )
+DEF_BENCH( return new ResampleBench(ResampleBench::Mode::kLanczos3); )
+DEF_BENCH( return new ResampleBench(ResampleBench::Mode::kLanczos3Linear); )
+DEF_BENCH( return new ResampleBench(ResampleBench::Mode::kLanczos3, 4); )
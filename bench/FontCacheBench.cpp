@@ -10,13 +10,31 @@
 #include "include/core/SkFont.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkStream.h"
 #include "include/core/SkString.h"
+#include "include/core/SkTypeface.h"
 #include "include/private/base/SkTemplates.h"
+#include "src/base/SkArenaAlloc.h"
 #include "src/core/SkChecksum.h"
+#include "src/core/SkGlyph.h"
+#include "src/core/SkScalerContext.h"
+#include "src/core/SkStrikeSpec.h"
+#include "src/core/SkTHash.h"
+#include "src/core/SkTSwissTable.h"
+#include "tools/Resources.h"
 #include "tools/fonts/FontToolUtils.h"
 
+#if defined(SK_TYPEFACE_FACTORY_FONTATIONS)
+#include "include/ports/SkTypeface_fontations.h"
+#endif
+#if defined(SK_TYPEFACE_FACTORY_FREETYPE)
+#include "src/ports/SkFontHost_FreeType_common.h"
+#endif
+
 #include "bench/gUniqueGlyphIDs.h"
 
+#include <vector>
+
 #define gUniqueGlyphIDs_Sentinel    0xFFFF
 
 static int count_glyphs(const uint16_t start[]) {
@@ -148,6 +166,59 @@ DEF_BENCH( return new FontCacheBench(); )
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Looks up the glyphs of the traced text, at a few subpixel positions, in a table like SkStrike's
+// map from SkPackedGlyphID to SkGlyphDigest.
+template <typename Table>
+class GlyphDigestLookupBench : public Benchmark {
+public:
+    explicit GlyphDigestLookupBench(const char* name) : fName(name) {}
+
+protected:
+    const char* onGetName() override { return fName; }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        for (const uint16_t* id = gUniqueGlyphIDs; *id != gUniqueGlyphIDs_Sentinel; id++) {
+            int count = count_glyphs(id);
+            for (int i = 0; i < count; i++) {
+                fTrace.push_back(SkPackedGlyphID(id[i], (uint32_t)(i & 3), 0u));
+            }
+            id += count;
+        }
+        for (const SkPackedGlyphID& packedID : fTrace) {
+            fTable.set(SkGlyphDigest(fTable.count(), SkGlyph(packedID)));
+        }
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        int found = 0;
+        for (int i = 0; i < loops; i++) {
+            for (const SkPackedGlyphID& packedID : fTrace) {
+                found += fTable.find(packedID) != nullptr;
+            }
+        }
+        fFound += found;
+    }
+
+private:
+    const char* fName;
+    std::vector<SkPackedGlyphID> fTrace;
+    Table fTable;
+    int fFound = 0;
+};
+
+using DigestHashTable =
+        skia_private::THashTable<SkGlyphDigest, SkPackedGlyphID, SkGlyphDigest>;
+using DigestSwissTable =
+        skia_private::TSwissTable<SkGlyphDigest, SkPackedGlyphID, SkGlyphDigest>;
+DEF_BENCH( return new GlyphDigestLookupBench<DigestHashTable>("glyph_digest_lookup_thash"); )
+DEF_BENCH( return new GlyphDigestLookupBench<DigestSwissTable>("glyph_digest_lookup_swiss"); )
+
+///////////////////////////////////////////////////////////////////////////////
+
 class FontPathBench : public Benchmark {
     SkFont fFont;
     uint16_t fGlyphs[100];
@@ -198,3 +269,64 @@ private:
 };
 DEF_BENCH( return new FontPathBench(true); )
 DEF_BENCH( return new FontPathBench(false); )
+
+///////////////////////////////////////////////////////////////////////////////
+
+// Asks a font backend's scaler context directly for the metrics and outline of each glyph, so no
+// strike cache is in the way. The same font is loaded through FreeType and through Fontations, to
+// compare the two.
+class ScalerContextOutlineBench : public Benchmark {
+public:
+    using MakeTypeface = sk_sp<SkTypeface> (*)(std::unique_ptr<SkStreamAsset>);
+
+    ScalerContextOutlineBench(const char* backend, MakeTypeface make) : fMake(make) {
+        fName.printf("scaler-context-outlines-%s", backend);
+    }
+
+protected:
+    const char* onGetName() override {
+        return fName.c_str();
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        fFont = SkFont(fMake(GetResourceAsStream("fonts/Roboto-Regular.ttf")), 32);
+        fFont.setHinting(SkFontHinting::kNone);
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        if (!fFont.getTypeface()) {
+            return;
+        }
+        const SkStrikeSpec strikeSpec = SkStrikeSpec::MakeWithNoDevice(fFont);
+        for (int loop = 0; loop < loops; ++loop) {
+            std::unique_ptr<SkScalerContext> context = strikeSpec.createScalerContext();
+            SkArenaAlloc alloc(4096);
+            for (SkGlyphID id = 0; id < 100; ++id) {
+                SkGlyph glyph = context->makeGlyph(SkPackedGlyphID(id), &alloc);
+                context->getPath(glyph, &alloc);
+            }
+        }
+    }
+
+private:
+    const MakeTypeface fMake;
+    SkFont fFont;
+    SkString fName;
+
+    using INHERITED = Benchmark;
+};
+
+#if defined(SK_TYPEFACE_FACTORY_FREETYPE)
+DEF_BENCH( return new ScalerContextOutlineBench("freetype", [](std::unique_ptr<SkStreamAsset> s) {
+    return SkTypeface_FreeType::MakeFromStream(std::move(s), SkFontArguments());
+}); )
+#endif
+#if defined(SK_TYPEFACE_FACTORY_FONTATIONS)
+DEF_BENCH( return new ScalerContextOutlineBench("fontations", [](std::unique_ptr<SkStreamAsset> s) {
+    return SkTypeface_Make_Fontations(std::move(s), SkFontArguments());
+}); )
+#endif
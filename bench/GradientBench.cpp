@@ -38,6 +38,21 @@ static const SkColor gColors[] = {
 static const SkColor gShallowColors[] = { 0xFF555555, 0xFF444444 };
 static const SkScalar gPos[] = {0.25f, 0.75f};
 
+// Unevenly spaced stops, bunched up towards 0: (i / (count - 1))^2.
+static const SkScalar gPos16[] = {
+    0, 0.0044f, 0.0178f, 0.0400f, 0.0711f, 0.1111f, 0.1600f, 0.2178f,
+    0.2844f, 0.3600f, 0.4444f, 0.5378f, 0.6400f, 0.7511f, 0.8711f, 1,
+};
+static const SkScalar gPos50[] = {
+    0, 0.0004f, 0.0017f, 0.0037f, 0.0067f, 0.0104f, 0.0150f, 0.0204f,
+    0.0267f, 0.0337f, 0.0416f, 0.0504f, 0.0600f, 0.0704f, 0.0816f, 0.0937f,
+    0.1066f, 0.1204f, 0.1349f, 0.1504f, 0.1666f, 0.1837f, 0.2016f, 0.2203f,
+    0.2399f, 0.2603f, 0.2815f, 0.3036f, 0.3265f, 0.3503f, 0.3748f, 0.4002f,
+    0.4265f, 0.4536f, 0.4815f, 0.5102f, 0.5398f, 0.5702f, 0.6014f, 0.6335f,
+    0.6664f, 0.7001f, 0.7347f, 0.7701f, 0.8063f, 0.8434f, 0.8813f, 0.9200f,
+    0.9596f, 1,
+};
+
 // We have several special-cases depending on the number (and spacing) of colors, so
 // try to exercise those here.
 static const GradData gGradData[] = {
@@ -46,6 +61,8 @@ static const GradData gGradData[] = {
     { 3, gColors, nullptr, "_3color" },
     { 2, gShallowColors, nullptr, "_shallow" },
     { 2, gColors, gPos, "_pos" },
+    { 16, gColors, gPos16, "_16color_pos" },
+    { 50, gColors, gPos50, "_hicolor_pos" },
 };
 
 /// Ignores scale
@@ -266,10 +283,16 @@ DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[2], SkTileMode::
 DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[0], SkTileMode::kMirror); )
 DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[1], SkTileMode::kMirror); )
 DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[2], SkTileMode::kMirror); )
+DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[5]); )
+DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[6]); )
+DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[5], SkTileMode::kRepeat); )
+DEF_BENCH( return new GradientBench(kLinear_GradType, gGradData[6], SkTileMode::kMirror); )
 
 DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[0]); )
 DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[1]); )
 DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[2]); )
+DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[5]); )
+DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[6]); )
 // Draw a radial gradient of radius 1/2 on a rectangle; half the lines should
 // be completely pinned, the other half should pe partially pinned
 DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[0], SkTileMode::kClamp, kRect_GeomType, 0.5f); )
@@ -283,6 +306,8 @@ DEF_BENCH( return new GradientBench(kRadial_GradType, gGradData[0], SkTileMode::
 DEF_BENCH( return new GradientBench(kSweep_GradType); )
 DEF_BENCH( return new GradientBench(kSweep_GradType, gGradData[1]); )
 DEF_BENCH( return new GradientBench(kSweep_GradType, gGradData[2]); )
+DEF_BENCH( return new GradientBench(kSweep_GradType, gGradData[5]); )
+DEF_BENCH( return new GradientBench(kSweep_GradType, gGradData[6]); )
 DEF_BENCH( return new GradientBench(kConical_GradType); )
 DEF_BENCH( return new GradientBench(kConical_GradType, gGradData[1]); )
 DEF_BENCH( return new GradientBench(kConical_GradType, gGradData[2]); )
@@ -8,6 +8,8 @@
 #include "bench/Benchmark.h"
 #include "include/core/SkData.h"
 #include "include/core/SkStream.h"
+#include "include/core/SkString.h"
+#include "src/base/SkRandom.h"
 #include "src/utils/SkJSON.h"
 
 #if defined(SK_BUILD_FOR_ANDROID)
@@ -55,6 +57,54 @@ private:
 
 DEF_BENCH( return new JsonBench; )
 
+// Doesn't need a bench file: parses a made up payload shaped like Lottie animations, which are
+// mostly arrays of keyframe numbers (some of them with exponents), short keys, and the odd long
+// string (names, embedded image data).
+class JsonKeyframesBench : public Benchmark {
+public:
+
+protected:
+    const char* onGetName() override { return "json_skjson_keyframes"; }
+
+    bool isSuitableFor(Backend backend) override { return backend == kNonRendering_Backend; }
+
+    void onDelayedSetup() override {
+        SkRandom rand;
+        SkString json("{\"layers\":[");
+        for (int i = 0; i < 1000; ++i) {
+            json.appendf("%s{\"nm\":\"Shape Layer %d - a longer, descriptive layer name\","
+                         "\"ty\":4,\"ks\":{\"a\":1,\"k\":[", i ? "," : "", i);
+            for (int k = 0; k < 32; ++k) {
+                json.appendf("%s{\"t\":%d,\"s\":[%.3f,%.3f],\"i\":{\"x\":%g,\"y\":%g}}",
+                             k ? "," : "", k * 4,
+                             rand.nextRangeF(-1000, 1000), rand.nextRangeF(-1000, 1000),
+                             rand.nextF() * 1e-4f, rand.nextF());
+            }
+            json.append("]},\"p\":\"data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAAAEAAAAB"
+                        "CAYAAAAfFcSJAAAADUlEQVR42mNkYPhfDwAChwGA60e6kgAAAABJRU5ErkJggg==\"}");
+        }
+        json.append("]}");
+        fData = SkData::MakeWithCopy(json.c_str(), json.size());
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; i++) {
+            skjson::DOM dom(static_cast<const char*>(fData->data()), fData->size());
+            if (dom.root().is<skjson::NullValue>()) {
+                SkDebugf("!! Parsing failed.\n");
+                return;
+            }
+        }
+    }
+
+private:
+    sk_sp<SkData> fData;
+
+    using INHERITED = Benchmark;
+};
+
+DEF_BENCH( return new JsonKeyframesBench; )
+
 #if (0)
 
 #include "rapidjson/document.h"
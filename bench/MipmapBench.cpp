@@ -8,22 +8,30 @@
 #include "bench/Benchmark.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkExecutor.h"
 #include "src/core/SkMipmap.h"
 
+#include <memory>
+
 class MipmapBench: public Benchmark {
     SkBitmap fBitmap;
     SkString fName;
     const int fW, fH;
     bool fHalfFoat;
+    const int fThreads;
+    std::unique_ptr<SkExecutor> fExecutor;
 
 public:
-    MipmapBench(int w, int h, bool halfFloat = false)
-        : fW(w), fH(h), fHalfFoat(halfFloat)
+    MipmapBench(int w, int h, bool halfFloat = false, int threads = 0)
+        : fW(w), fH(h), fHalfFoat(halfFloat), fThreads(threads)
     {
         fName.printf("mipmap_build_%dx%d", w, h);
         if (halfFloat) {
             fName.append("_f16");
         }
+        if (threads > 0) {
+            fName.appendf("_%dthreads", threads);
+        }
     }
 
 protected:
@@ -39,12 +47,24 @@ protected:
                                              SkColorSpace::MakeSRGB());
         fBitmap.allocPixels(info);
         fBitmap.eraseColor(SK_ColorWHITE);  // so we don't read uninitialized memory
+
+        if (fThreads > 0) {
+            fExecutor = SkExecutor::MakeFIFOThreadPool(fThreads);
+        }
     }
 
     void onDraw(int loops, SkCanvas*) override {
+        // Large levels are filtered in bands on the default executor.
+        SkExecutor* previous = &SkExecutor::GetDefault();
+        if (fExecutor) {
+            SkExecutor::SetDefault(fExecutor.get());
+        }
+
         for (int i = 0; i < loops * 4; i++) {
             SkMipmap::Build(fBitmap, nullptr)->unref();
         }
+
+        SkExecutor::SetDefault(previous);
     }
 
 private:
@@ -66,3 +86,8 @@ DEF_BENCH( return new MipmapBench(2048, 2048); )
 DEF_BENCH( return new MipmapBench(2047, 2047); )
 DEF_BENCH( return new MipmapBench(2048, 2047); )
 DEF_BENCH( return new MipmapBench(2047, 2048); )
+
+DEF_BENCH( return new MipmapBench(4096, 4096); )
+DEF_BENCH( return new MipmapBench(4096, 4096, false, 4); )
+DEF_BENCH( return new MipmapBench(4096, 4096, true); )
+DEF_BENCH( return new MipmapBench(4096, 4096, true, 4); )
@@ -17,6 +17,7 @@
 #include "include/core/SkString.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTDArray.h"
+#include "include/utils/SkParsePath.h"
 #include "src/base/SkRandom.h"
 
 #include "src/core/SkDraw.h"
@@ -470,6 +471,42 @@ private:
     using INHERITED = RandomPathBench;
 };
 
+class PathParseSVGBench : public RandomPathBench {
+public:
+    PathParseSVGBench()  {
+    }
+
+protected:
+    const char* onGetName() override {
+        return "path_parse_svg";
+    }
+    void onDelayedSetup() override {
+        this->createData(10, 100);
+        fStrings.reset(kPathCnt);
+        for (int i = 0; i < kPathCnt; ++i) {
+            SkPath path;
+            this->makePath(&path);
+            fStrings[i] = SkParsePath::ToSVGString(path);
+        }
+        this->finishedMakingPaths();
+    }
+    void onDraw(int loops, SkCanvas*) override {
+        for (int i = 0; i < loops; ++i) {
+            SkPath path;
+            SkParsePath::FromSVGString(fStrings[i & (kPathCnt - 1)].c_str(), &path);
+        }
+    }
+
+private:
+    enum {
+        // must be a pow 2
+        kPathCnt = 1 << 5,
+    };
+    AutoTArray<SkString> fStrings;
+
+    using INHERITED = RandomPathBench;
+};
+
 class PathTransformBench : public RandomPathBench {
 public:
     PathTransformBench(bool inPlace) : fInPlace(inPlace) {}
@@ -1201,6 +1238,7 @@ DEF_BENCH( return new LongLinePathBench(FLAGS01); )
 
 DEF_BENCH( return new PathCreateBench(); )
 DEF_BENCH( return new PathCopyBench(); )
+DEF_BENCH( return new PathParseSVGBench(); )
 DEF_BENCH( return new PathTransformBench(true); )
 DEF_BENCH( return new PathTransformBench(false); )
 DEF_BENCH( return new PathEqualityBench(); )
@@ -11,16 +11,19 @@
 #include "include/core/SkString.h"
 #include "include/pathops/SkPathOps.h"
 #include "include/private/base/SkTArray.h"
+#include "modules/bentleyottmann/include/PolygonOps.h"
 #include "src/base/SkRandom.h"
 
 class PathOpsBench : public Benchmark {
     SkString    fName;
     SkPath      fPath1, fPath2;
     SkPathOp    fOp;
+    bool        fPolygon;
 
 public:
-    PathOpsBench(const char suffix[], SkPathOp op) : fOp(op) {
-        fName.printf("pathops_%s", suffix);
+    PathOpsBench(const char suffix[], SkPathOp op, bool polygon = false)
+            : fOp(op), fPolygon(polygon) {
+        fName.printf("%s_%s", polygon ? "polygonops" : "pathops", suffix);
 
         fPath1.addOval({-10, -20, 10, 20});
         fPath2.addOval({-20, -10, 20, 10});
@@ -38,8 +41,12 @@ protected:
     void onDraw(int loops, SkCanvas* canvas) override {
         for (int i = 0; i < loops; i++) {
             for (int j = 0; j < 1000; ++j) {
-                SkPath result;
-                Op(fPath1, fPath2, fOp, &result);
+                if (fPolygon) {
+                    bentleyottmann::polygon_op(fPath1, fPath2, fOp);
+                } else {
+                    SkPath result;
+                    Op(fPath1, fPath2, fOp, &result);
+                }
             }
         }
     }
@@ -51,10 +58,12 @@ private:
 class PathOpsSimplifyBench : public Benchmark {
     SkString    fName;
     SkPath      fPath;
+    bool        fPolygon;
 
 public:
-    PathOpsSimplifyBench(const char suffix[], const SkPath& path) : fPath(path) {
-        fName.printf("pathops_simplify_%s", suffix);
+    PathOpsSimplifyBench(const char suffix[], const SkPath& path, bool polygon = false)
+            : fPath(path), fPolygon(polygon) {
+        fName.printf("%s_simplify_%s", polygon ? "polygonops" : "pathops", suffix);
     }
 
     bool isSuitableFor(Backend backend) override {
@@ -69,8 +78,12 @@ protected:
     void onDraw(int loops, SkCanvas* canvas) override {
         for (int i = 0; i < loops; i++) {
             for (int j = 0; j < 100; ++j) {
-                SkPath result;
-                Simplify(fPath, &result);
+                if (fPolygon) {
+                    bentleyottmann::polygon_simplify(fPath);
+                } else {
+                    SkPath result;
+                    Simplify(fPath, &result);
+                }
             }
         }
     }
@@ -80,6 +93,8 @@ private:
 };
 DEF_BENCH( return new PathOpsBench("sect", kIntersect_SkPathOp); )
 DEF_BENCH( return new PathOpsBench("join", kUnion_SkPathOp); )
+DEF_BENCH( return new PathOpsBench("sect", kIntersect_SkPathOp, true); )
+DEF_BENCH( return new PathOpsBench("join", kUnion_SkPathOp, true); )
 
 static SkPath makerects() {
     SkRandom rand;
@@ -93,6 +108,7 @@ static SkPath makerects() {
     return path;
 }
 DEF_BENCH( return new PathOpsSimplifyBench("rects", makerects()); )
+DEF_BENCH( return new PathOpsSimplifyBench("rects", makerects(), true); )
 
 #include "include/core/SkPathBuilder.h"
 
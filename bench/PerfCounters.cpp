@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/PerfCounters.h"
+
+#include "include/core/SkTypes.h"
+
+#if defined(SK_BUILD_FOR_UNIX) || defined(SK_BUILD_FOR_ANDROID)
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <initializer_list>
+
+namespace {
+
+class LinuxPerfCounters final : public PerfCounters {
+public:
+    LinuxPerfCounters(int instructions, int cacheMisses, int branchMisses)
+            : fFds{instructions, cacheMisses, branchMisses} {}
+
+    ~LinuxPerfCounters() override {
+        for (int fd : fFds) {
+            close(fd);
+        }
+    }
+
+    // The counters are opened as one group, led by the instruction counter, so they count over
+    // exactly the same spans.
+    void reset() override { ioctl(fFds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP); }
+    void start() override { ioctl(fFds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP); }
+    void stop() override { ioctl(fFds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP); }
+
+    Counts read() override {
+        // With PERF_FORMAT_GROUP, reading the leader reads {count, values...} for the group.
+        uint64_t values[1 + kCounterCount];
+        if (::read(fFds[0], values, sizeof(values)) != (ssize_t)sizeof(values) ||
+            values[0] != kCounterCount) {
+            return {};
+        }
+        return {values[1], values[2], values[3]};
+    }
+
+    static int Open(uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = config;
+        attr.disabled = groupFd == -1;  // The leader starts disabled, and so the whole group.
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return (int)syscall(SYS_perf_event_open, &attr, /*pid=*/0, /*cpu=*/-1, groupFd, 0);
+    }
+
+    static constexpr int kCounterCount = 3;
+
+private:
+    const int fFds[kCounterCount];
+};
+
+}  // namespace
+
+std::unique_ptr<PerfCounters> PerfCounters::Make() {
+    int instructions = LinuxPerfCounters::Open(PERF_COUNT_HW_INSTRUCTIONS, -1);
+    if (instructions < 0) {
+        return nullptr;
+    }
+    int cacheMisses  = LinuxPerfCounters::Open(PERF_COUNT_HW_CACHE_MISSES, instructions),
+        branchMisses = LinuxPerfCounters::Open(PERF_COUNT_HW_BRANCH_MISSES, instructions);
+    if (cacheMisses < 0 || branchMisses < 0) {
+        for (int fd : {instructions, cacheMisses, branchMisses}) {
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+        return nullptr;
+    }
+    auto counters = std::make_unique<LinuxPerfCounters>(instructions, cacheMisses, branchMisses);
+    counters->reset();
+    return counters;
+}
+
+#else
+
+std::unique_ptr<PerfCounters> PerfCounters::Make() { return nullptr; }
+
+#endif
@@ -0,0 +1,39 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef PerfCounters_DEFINED
+#define PerfCounters_DEFINED
+
+#include <cstdint>
+#include <memory>
+
+/**
+ *  Hardware performance counters for this thread, read with Linux's perf_event_open().
+ *  The counters only count between start() and stop(), and accumulate across those spans
+ *  until reset().
+ */
+class PerfCounters {
+public:
+    struct Counts {
+        uint64_t fInstructions = 0;
+        uint64_t fCacheMisses = 0;
+        uint64_t fBranchMisses = 0;
+    };
+
+    // Returns null if the counters aren't available, e.g. off Linux, or with
+    // /proc/sys/kernel/perf_event_paranoid set too high.
+    static std::unique_ptr<PerfCounters> Make();
+
+    virtual ~PerfCounters() = default;
+
+    virtual void reset() = 0;
+    virtual void start() = 0;
+    virtual void stop() = 0;
+    virtual Counts read() = 0;
+};
+
+#endif  // PerfCounters_DEFINED
@@ -12,6 +12,9 @@
 #include "src/base/SkRandom.h"
 #include "src/core/SkRTree.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace skia_private;
 
 // confine rectangles to a smallish area, so queries generally hit something, and overlap occurs:
@@ -55,11 +58,16 @@ private:
     using INHERITED = Benchmark;
 };
 
-// Time how long it takes to perform queries on an R-Tree.
+// Time how long it takes to perform queries on an R-Tree. With a batch size, the queries are
+// issued that many at a time through the batch search.
 class RTreeQueryBench : public Benchmark {
 public:
-    RTreeQueryBench(const char* name, MakeRectProc proc) : fProc(proc) {
+    RTreeQueryBench(const char* name, MakeRectProc proc, int batch = 0)
+            : fProc(proc), fBatch(batch) {
         fName.printf("rtree_%s_query", name);
+        if (fBatch) {
+            fName.appendf("_batch%d", fBatch);
+        }
     }
 
     bool isSuitableFor(Backend backend) override {
@@ -80,19 +88,37 @@ protected:
 
     void onDraw(int loops, SkCanvas* canvas) override {
         SkRandom rand;
+        if (fBatch) {
+            std::vector<SkRect> queries(fBatch);
+            std::vector<std::vector<int>> hits(fBatch);
+            for (int i = 0; i < loops; i += fBatch) {
+                const int count = std::min(fBatch, loops - i);
+                for (int j = 0; j < count; ++j) {
+                    queries[j] = make_query(rand);
+                    hits[j].clear();
+                }
+                fTree.search(SkSpan(queries.data(), count), hits.data());
+            }
+            return;
+        }
         for (int i = 0; i < loops; ++i) {
             std::vector<int> hits;
-            SkRect query;
-            query.fLeft   = rand.nextRangeF(0, GENERATE_EXTENTS);
-            query.fTop    = rand.nextRangeF(0, GENERATE_EXTENTS);
-            query.fRight  = query.fLeft + 1 + rand.nextRangeF(0, GENERATE_EXTENTS/2);
-            query.fBottom = query.fTop  + 1 + rand.nextRangeF(0, GENERATE_EXTENTS/2);
-            fTree.search(query, &hits);
+            fTree.search(make_query(rand), &hits);
         }
     }
 private:
+    static SkRect make_query(SkRandom& rand) {
+        SkRect query;
+        query.fLeft   = rand.nextRangeF(0, GENERATE_EXTENTS);
+        query.fTop    = rand.nextRangeF(0, GENERATE_EXTENTS);
+        query.fRight  = query.fLeft + 1 + rand.nextRangeF(0, GENERATE_EXTENTS/2);
+        query.fBottom = query.fTop  + 1 + rand.nextRangeF(0, GENERATE_EXTENTS/2);
+        return query;
+    }
+
     SkRTree fTree;
     MakeRectProc fProc;
+    const int fBatch;
     SkString fName;
     using INHERITED = Benchmark;
 };
@@ -138,3 +164,6 @@ DEF_BENCH(return new RTreeQueryBench("XY", &make_XYordered_rects));
 DEF_BENCH(return new RTreeQueryBench("YX", &make_YXordered_rects));
 DEF_BENCH(return new RTreeQueryBench("random", &make_random_rects));
 DEF_BENCH(return new RTreeQueryBench("concentric", &make_concentric_rects));
+
+DEF_BENCH(return new RTreeQueryBench("XY", &make_XYordered_rects, 16));
+DEF_BENCH(return new RTreeQueryBench("random", &make_random_rects, 16));
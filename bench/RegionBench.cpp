@@ -9,6 +9,8 @@
 #include "include/core/SkString.h"
 #include "src/base/SkRandom.h"
 
+#include <vector>
+
 static bool union_proc(SkRegion& a, SkRegion& b) {
     SkRegion result;
     return result.op(a, b, SkRegion::kUnion_Op);
@@ -129,3 +131,38 @@ DEF_BENCH(return new RegionBench(SMALL, containsrect_proc, "containsrect");)
 DEF_BENCH(return new RegionBench(SMALL, sectsrgn_proc, "intersectsrgn");)
 DEF_BENCH(return new RegionBench(SMALL, sectsrect_proc, "intersectsrect");)
 DEF_BENCH(return new RegionBench(SMALL, containsxy_proc, "containsxy");)
+
+class RegionSetRectsBench : public Benchmark {
+public:
+    RegionSetRectsBench(int count) {
+        fName.printf("region_setrects_%d", count);
+
+        SkRandom rand;
+        for (int i = 0; i < count; i++) {
+            int x = rand.nextU() % 1024;
+            int y = rand.nextU() % 768;
+            fRects.push_back(SkIRect::MakeXYWH(x, y, 1 + rand.nextU() % 64, 1 + rand.nextU() % 64));
+        }
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        for (int i = 0; i < loops; ++i) {
+            SkRegion rgn;
+            rgn.setRects(fRects.data(), (int)fRects.size());
+        }
+    }
+
+private:
+    std::vector<SkIRect> fRects;
+    SkString             fName;
+};
+
+DEF_BENCH(return new RegionSetRectsBench(SMALL);)
+DEF_BENCH(return new RegionSetRectsBench(256);)
@@ -156,6 +156,17 @@ DEF_PATH_TESS_BENCH(GrPathWedgeTessellator, make_cubic_path(8), SkMatrix::I()) {
                   fPath.countVerbs());
 }
 
+DEF_PATH_TESS_BENCH(GrPathWedgeTessellator_byResolveLevel, make_cubic_path(8), SkMatrix::I()) {
+    SkArenaAlloc arena(1024);
+    auto tess = PathWedgeTessellator::Make(&arena,
+                                           fTarget->caps().shaderCaps()->fInfinitySupport);
+    tess->setDrawByResolveLevel(true);
+    tess->prepare(fTarget.get(),
+                  fMatrix,
+                  {gAlmostIdentity, fPath, SK_PMColor4fTRANSPARENT},
+                  fPath.countVerbs());
+}
+
 static void benchmark_wangs_formula_cubic_log2(const SkMatrix& matrix, const SkPath& path) {
     int sum = 0;
     wangs_formula::VectorXform xform(matrix);
@@ -184,6 +195,60 @@ DEF_PATH_TESS_BENCH(wangs_formula_cubic_log2_affine, make_cubic_path(18),
     benchmark_wangs_formula_cubic_log2(fMatrix, fPath);
 }
 
+// Packs the path's cubics the way PatchWriter::writeCubics() expects them, 4 points per cubic. The
+// benchmarks below each only run on one path, so they pack it once, outside of the timed loop.
+static std::vector<SkPoint> pack_cubics(const SkPath& path) {
+    std::vector<SkPoint> cubics;
+    for (auto [verb, pts, w] : SkPathPriv::Iterate(path)) {
+        if (verb == SkPathVerb::kCubic) {
+            cubics.insert(cubics.end(), pts, pts + 4);
+        }
+    }
+    return cubics;
+}
+
+static void benchmark_wangs_formula_cubic_p4(const SkMatrix& matrix, const SkPath& path) {
+    static const std::vector<SkPoint> kCubics = pack_cubics(path);
+    float sum = 0;
+    wangs_formula::VectorXform xform(matrix);
+    for (size_t i = 0; i < kCubics.size(); i += 4) {
+        sum += wangs_formula::cubic_p4(4, kCubics.data() + i, xform);
+    }
+    // Don't let the compiler optimize away wangs_formula::cubic_p4.
+    if (sum <= 0) {
+        SK_ABORT("sum should be > 0.");
+    }
+}
+
+static void benchmark_wangs_formula_cubic_p4_batched(const SkMatrix& matrix, const SkPath& path) {
+    static const std::vector<SkPoint> kCubics = pack_cubics(path);
+    static constexpr int N = 4;
+    skvx::Vec<N,float> sum = 0;
+    wangs_formula::VectorXform xform(matrix);
+    size_t i = 0;
+    for (; i + 4*N <= kCubics.size(); i += 4*N) {
+        sum += wangs_formula::cubic_p4<N>(4, kCubics.data() + i, xform);
+    }
+    float total = sum[0] + sum[1] + sum[2] + sum[3];
+    for (; i < kCubics.size(); i += 4) {
+        total += wangs_formula::cubic_p4(4, kCubics.data() + i, xform);
+    }
+    // Don't let the compiler optimize away wangs_formula::cubic_p4.
+    if (total <= 0) {
+        SK_ABORT("sum should be > 0.");
+    }
+}
+
+DEF_PATH_TESS_BENCH(wangs_formula_cubic_p4, make_cubic_path(18),
+                    SkMatrix::MakeAll(.9f,0.9f,0,  1.1f,1.1f,0, 0,0,1)) {
+    benchmark_wangs_formula_cubic_p4(fMatrix, fPath);
+}
+
+DEF_PATH_TESS_BENCH(wangs_formula_cubic_p4_batched, make_cubic_path(18),
+                    SkMatrix::MakeAll(.9f,0.9f,0,  1.1f,1.1f,0, 0,0,1)) {
+    benchmark_wangs_formula_cubic_p4_batched(fMatrix, fPath);
+}
+
 static void benchmark_wangs_formula_conic(const SkMatrix& matrix, const SkPath& path) {
     int sum = 0;
     wangs_formula::VectorXform xform(matrix);
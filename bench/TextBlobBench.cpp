@@ -11,6 +11,8 @@
 #include "include/core/SkPaint.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
+#include "include/core/SkSurface.h"
+#include "include/core/SkSurfaceProps.h"
 #include "include/core/SkTextBlob.h"
 #include "include/core/SkTypeface.h"
 #include "include/private/base/SkTemplates.h"
@@ -48,9 +50,11 @@ public:
         return fBuilder.make();
     }
 
+protected:
+    SkFont              fFont;
+
 private:
     SkTextBlobBuilder   fBuilder;
-    SkFont              fFont;
     SkTDArray<uint16_t> fGlyphs;
     SkTDArray<SkScalar> fXPos;
 
@@ -109,3 +113,62 @@ class TextBlobMakeBench : public SkTextBlobBench {
     }
 };
 DEF_BENCH( return new TextBlobMakeBench(); )
+
+// Draws into its own raster surface, so that LCD text is blitted regardless of the config's
+// surface props.
+class TextBlobRasterBench : public SkTextBlobBench {
+public:
+    TextBlobRasterBench(SkFont::Edging edging, SkColor color, const char* colorName)
+            : fEdging(edging), fColor(color) {
+        fName.printf("TextBlobRaster_%s_%s",
+                     edging == SkFont::Edging::kSubpixelAntiAlias ? "LCD" : "A8", colorName);
+    }
+
+private:
+    const char* onGetName() override {
+        return fName.c_str();
+    }
+
+    bool isSuitableFor(Backend backend) override {
+        return backend == kNonRendering_Backend;
+    }
+
+    void onDelayedSetup() override {
+        this->INHERITED::onDelayedSetup();
+        fFont.setEdging(fEdging);
+
+        SkSurfaceProps props(0, kRGB_H_SkPixelGeometry);
+        fSurface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(512, 512), &props);
+        fSurface->getCanvas()->clear(SK_ColorWHITE);
+        fBlob = this->makeBlob();
+    }
+
+    void onDraw(int loops, SkCanvas*) override {
+        SkCanvas* canvas = fSurface->getCanvas();
+        SkPaint paint;
+        paint.setColor(fColor);
+
+        // A page of text; the glyphs are all cached after the first line.
+        for (int i = 0; i < loops; i++) {
+            for (int y = 20; y < 500; y += 16) {
+                canvas->drawTextBlob(fBlob, 0, y, paint);
+            }
+        }
+    }
+
+    SkString          fName;
+    SkFont::Edging    fEdging;
+    SkColor           fColor;
+    sk_sp<SkSurface>  fSurface;
+    sk_sp<SkTextBlob> fBlob;
+
+    using INHERITED = SkTextBlobBench;
+};
+DEF_BENCH( return new TextBlobRasterBench(SkFont::Edging::kAntiAlias, SK_ColorBLACK, "black"); )
+DEF_BENCH( return new TextBlobRasterBench(SkFont::Edging::kAntiAlias, 0x80336699, "translucent"); )
+DEF_BENCH( return new TextBlobRasterBench(SkFont::Edging::kSubpixelAntiAlias, SK_ColorBLACK,
+                                          "black"); )
+DEF_BENCH( return new TextBlobRasterBench(SkFont::Edging::kSubpixelAntiAlias, 0xFF336699,
+                                          "opaque"); )
+DEF_BENCH( return new TextBlobRasterBench(SkFont::Edging::kSubpixelAntiAlias, 0x80336699,
+                                          "translucent"); )
@@ -28,6 +28,7 @@ enum VertFlags {
     kTexture_VertFlag = 1 << 1,
     kPersp_VertFlag   = 1 << 2,
     kBilerp_VertFlag  = 1 << 3,
+    kZoom_VertFlag    = 1 << 4,
 };
 
 class VertBench : public Benchmark {
@@ -149,6 +150,102 @@ DEF_BENCH(return new VertBench(kColors_VertFlag);)
 DEF_BENCH(return new VertBench(kColors_VertFlag | kTexture_VertFlag);)
 DEF_BENCH(return new VertBench(kColors_VertFlag | kTexture_VertFlag | kBilerp_VertFlag);)
 
+// A 100k triangle mesh, like a terrain. With kZoom_VertFlag, the mesh is scaled up so that only a
+// quarter of it is on the canvas.
+class BigMeshBench : public Benchmark {
+    enum {
+        W = 640,
+        H = 480,
+        ROW = 200,
+        COL = 250,
+    };
+
+    unsigned fFlags;
+    SkString fName;
+    sk_sp<SkShader> fShader;
+    sk_sp<SkVertices> fVertices;
+
+public:
+    BigMeshBench(unsigned flags) : fFlags(flags) {
+        fName.set("verts_big_mesh");
+        if (fFlags & kTexture_VertFlag) {
+            fName.append("_textures");
+        }
+        if (fFlags & kColors_VertFlag) {
+            fName.append("_colors");
+        }
+        if (fFlags & kZoom_VertFlag) {
+            fName.append("_zoom");
+        }
+    }
+
+protected:
+    const char* onGetName() override { return fName.c_str(); }
+    SkISize onGetSize() override { return {W, H}; }
+
+    void onDelayedSetup() override {
+        if (fFlags & kTexture_VertFlag) {
+            if (auto img = ToolUtils::GetResourceAsImage("images/mandrill_256.png")) {
+                fShader = img->makeShader(SkSamplingOptions(SkFilterMode::kLinear));
+            }
+        }
+
+        uint32_t builderFlags = 0;
+        if (fFlags & kTexture_VertFlag) {
+            builderFlags |= SkVertices::kHasTexCoords_BuilderFlag;
+        }
+        if (fFlags & kColors_VertFlag) {
+            builderFlags |= SkVertices::kHasColors_BuilderFlag;
+        }
+        SkVertices::Builder builder(SkVertices::kTriangles_VertexMode,
+                                    (ROW + 1) * (COL + 1),
+                                    ROW * COL * 6,
+                                    builderFlags);
+        SkRandom rand;
+        for (int y = 0, i = 0; y <= ROW; ++y) {
+            for (int x = 0; x <= COL; ++x, ++i) {
+                // Jitter the inner vertices, so the triangles aren't all alike.
+                SkPoint p = {x * (SkScalar)W / COL, y * (SkScalar)H / ROW};
+                if (x > 0 && x < COL && y > 0 && y < ROW) {
+                    p += {rand.nextRangeF(-0.5f, 0.5f), rand.nextRangeF(-0.5f, 0.5f)};
+                }
+                builder.positions()[i] = p;
+                if (builder.texCoords()) {
+                    builder.texCoords()[i] = {x * 256.f / COL, y * 256.f / ROW};
+                }
+                if (builder.colors()) {
+                    builder.colors()[i] = rand.nextU() | 0xFF000000;
+                }
+            }
+        }
+        uint16_t* idx = builder.indices();
+        for (int y = 0; y < ROW; ++y) {
+            for (int x = 0; x < COL; ++x) {
+                uint16_t n = y * (COL + 1) + x;
+                *idx++ = n; *idx++ = n + 1; *idx++ = n + COL + 2;
+                *idx++ = n; *idx++ = n + COL + 2; *idx++ = n + COL + 1;
+            }
+        }
+        fVertices = builder.detach();
+    }
+
+    void onDraw(int loops, SkCanvas* canvas) override {
+        SkPaint paint;
+        paint.setShader(fShader);
+        if (fFlags & kZoom_VertFlag) {
+            canvas->scale(2, 2);
+        }
+        for (int i = 0; i < loops; i++) {
+            canvas->drawVertices(fVertices, SkBlendMode::kModulate, paint);
+        }
+    }
+};
+DEF_BENCH(return new BigMeshBench(kColors_VertFlag);)
+DEF_BENCH(return new BigMeshBench(kColors_VertFlag | kZoom_VertFlag);)
+DEF_BENCH(return new BigMeshBench(kTexture_VertFlag);)
+DEF_BENCH(return new BigMeshBench(kTexture_VertFlag | kZoom_VertFlag);)
+DEF_BENCH(return new BigMeshBench(kColors_VertFlag | kTexture_VertFlag | kZoom_VertFlag);)
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "include/core/SkRSXform.h"
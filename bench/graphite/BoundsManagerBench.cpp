@@ -111,6 +111,46 @@ private:
     int fNumRandomRects;
 };
 
+// Approximates a text-heavy page: lines of small glyph-sized boxes, with the occasional larger
+// background or image draw underneath, so the draws are heavily skewed towards small bounds.
+class TextBoundsManagerBench : public BoundsManagerBench {
+public:
+    TextBoundsManagerBench(std::unique_ptr<BoundsManager> manager,
+                           const char* managerName,
+                           int numRects)
+            : BoundsManagerBench(std::move(manager))
+            , fNumRects(numRects) {
+        fName.printf("BoundsManager_text_%i_%s", numRects, managerName);
+    }
+
+private:
+    void gatherRects(TArray<SkRect>* rects) override {
+        SkRandom rand;
+        float x = 0.f, y = 0.f;
+        for (int i = 0; i < fNumRects; ++i) {
+            if (i % 500 == 0) {
+                rects->push_back(SkRect::MakeXYWH(rand.nextRangeF(0, 1200),
+                                                  rand.nextRangeF(0, 1200),
+                                                  rand.nextRangeF(100, 600),
+                                                  rand.nextRangeF(100, 600)));
+                continue;
+            }
+            const float advance = rand.nextRangeF(5, 10);
+            rects->push_back(SkRect::MakeXYWH(x, y, advance, 14));
+            x += advance;
+            if (x > 1750) {
+                x = 0.f;
+                y += 16.f;
+                if (y > 1780) {
+                    y = 0.f;
+                }
+            }
+        }
+    }
+
+    int fNumRects;
+};
+
 class FileBoundsManagerBench : public BoundsManagerBench {
 public:
     FileBoundsManagerBench(std::unique_ptr<BoundsManager> manager,
@@ -185,6 +225,15 @@ private:
     DEF_BENCH( return new skgpu::graphite::RandomBoundsManagerBench(manager, name, 10000); ) \
     DEF_BENCH( return new skgpu::graphite::FileBoundsManagerBench(manager, name); )
 
+// Draw counts past what a single DrawPass sees today, to compare how the managers scale. The
+// brute force and naive managers are left out since they're quadratic or trivial.
+#define DEF_LARGE_BOUNDS_MANAGER_BENCH_SET(manager, name) \
+    DEF_BENCH( return new skgpu::graphite::RandomBoundsManagerBench(manager, name, 100000); ) \
+    DEF_BENCH( return new skgpu::graphite::RandomBoundsManagerBench(manager, name, 1000000); ) \
+    DEF_BENCH( return new skgpu::graphite::TextBoundsManagerBench(manager, name, 10000); ) \
+    DEF_BENCH( return new skgpu::graphite::TextBoundsManagerBench(manager, name, 100000); ) \
+    DEF_BENCH( return new skgpu::graphite::TextBoundsManagerBench(manager, name, 1000000); )
+
 
 DEF_BOUNDS_MANAGER_BENCH_SET(std::make_unique<skgpu::graphite::NaiveBoundsManager>(),      "naive")
 DEF_BOUNDS_MANAGER_BENCH_SET(std::make_unique<skgpu::graphite::BruteForceBoundsManager>(), "brute")
@@ -192,7 +241,15 @@ DEF_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::Make({1800, 180
 DEF_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::Make({1800, 1800}, 512), "grid512")
 DEF_BOUNDS_MANAGER_BENCH_SET(std::make_unique<skgpu::graphite::HybridBoundsManager>(SkISize{1800, 1800}, 16, 64), "hybrid16x16n128")
 DEF_BOUNDS_MANAGER_BENCH_SET(std::make_unique<skgpu::graphite::HybridBoundsManager>(SkISize{1800, 1800}, 16, 128), "hybrid16x16n256")
+DEF_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::MakeRes({1800, 1800}, 4), "grid4px")
+DEF_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::TwoLevelGridBoundsManager::Make({1800, 1800}, 4), "twolevel4px")
+
+DEF_LARGE_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::Make({1800, 1800}, 128), "grid128")
+DEF_LARGE_BOUNDS_MANAGER_BENCH_SET(std::make_unique<skgpu::graphite::HybridBoundsManager>(SkISize{1800, 1800}, 16, 128), "hybrid16x16n256")
+DEF_LARGE_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::MakeRes({1800, 1800}, 4), "grid4px")
+DEF_LARGE_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::TwoLevelGridBoundsManager::Make({1800, 1800}, 4), "twolevel4px")
 // Uncomment and adjust device size to match reported bounds from --boundsManagerFile
 // DEF_BOUNDS_MANAGER_BENCH_SET(skgpu::graphite::GridBoundsManager::MakeRes({w, h}, 8), "gridRes8")
 
 #undef DEF_BOUNDS_MANAGER_BENCH_SET
+#undef DEF_LARGE_BOUNDS_MANAGER_BENCH_SET
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "bench/graphite/GraphiteFrameBench.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkCounters.h"
+#include "include/gpu/graphite/Context.h"
+#include "include/gpu/graphite/GraphiteTypes.h"
+#include "include/gpu/graphite/Recorder.h"
+#include "include/gpu/graphite/Recording.h"
+#include "src/base/SkTime.h"
+#include "src/gpu/graphite/RecorderPriv.h"
+#include "tools/MSKPPlayer.h"
+
+using namespace skia_private;
+
+namespace skgpu::graphite {
+
+GraphiteFrameBench::GraphiteFrameBench(const char* name, sk_sp<SkPicture> picture)
+        : fName(name), fPicture(std::move(picture)) {}
+
+GraphiteFrameBench::GraphiteFrameBench(const char* name, std::unique_ptr<MSKPPlayer> player)
+        : fName(name), fPlayer(std::move(player)) {}
+
+GraphiteFrameBench::~GraphiteFrameBench() = default;
+
+const char* GraphiteFrameBench::onGetName() { return fName.c_str(); }
+
+SkISize GraphiteFrameBench::onGetSize() {
+    if (fPlayer) {
+        return fPlayer->maxDimensions();
+    }
+    return fPicture->cullRect().roundOut().size();
+}
+
+void GraphiteFrameBench::onPerCanvasPreDraw(SkCanvas* canvas) {
+    if (fPlayer) {
+        // As in MSKPBench, creating the layers' backing stores isn't part of what we time.
+        fPlayer->allocateLayers(canvas);
+    }
+}
+
+void GraphiteFrameBench::onPerCanvasPostDraw(SkCanvas*) {
+    if (fPlayer) {
+        fPlayer->resetLayers();
+    }
+}
+
+void GraphiteFrameBench::record(SkCanvas* canvas) {
+    if (!fPlayer) {
+        canvas->drawPicture(fPicture);
+        return;
+    }
+    for (int f = 0; f < fPlayer->numFrames(); ++f) {
+        canvas->save();
+        canvas->clipIRect(SkIRect::MakeSize(fPlayer->frameDimensions(f)));
+        fPlayer->playFrame(canvas, f);
+        canvas->restore();
+    }
+    // Each frame replays all offscreen layer draws from scratch.
+    fPlayer->rewindLayers();
+}
+
+void GraphiteFrameBench::onDraw(int loops, SkCanvas* canvas) {
+    Recorder* recorder = canvas->recorder();
+    Context* context = recorder ? recorder->priv().context() : nullptr;
+    for (int i = 0; i < loops; ++i) {
+        this->record(canvas);
+        if (!context) {
+            continue;
+        }
+        std::unique_ptr<Recording> recording = recorder->snap();
+        if (recording) {
+            InsertRecordingInfo info;
+            info.fRecording = recording.get();
+            context->insertRecording(info);
+        }
+        context->submit();
+    }
+}
+
+void GraphiteFrameBench::getGpuStats(SkCanvas* canvas,
+                                     TArray<SkString>* keys,
+                                     TArray<double>* values) {
+    Recorder* recorder = canvas->recorder();
+    Context* context = recorder ? recorder->priv().context() : nullptr;
+    if (!context) {
+        return;
+    }
+    auto add = [&](const char* key, double value) {
+        keys->push_back(SkStringPrintf("graphite_%s", key));
+        values->push_back(value);
+    };
+
+    // Start from an idle context, so the frame we measure pays only for itself.
+    if (std::unique_ptr<Recording> pending = recorder->snap()) {
+        InsertRecordingInfo info;
+        info.fRecording = pending.get();
+        context->insertRecording(info);
+    }
+    context->submit(SyncToCpu::kYes);
+    recorder->resetResourceCacheStats();
+    const SkCounters::Snapshot before = SkCounters::Read();
+
+    double start = SkTime::GetNSecs();
+    this->record(canvas);
+    const double recorded = SkTime::GetNSecs();
+    std::unique_ptr<Recording> recording = recorder->snap();  // Where DrawPass::Make() happens.
+    const double snapped = SkTime::GetNSecs();
+    if (recording) {
+        InsertRecordingInfo info;
+        info.fRecording = recording.get();
+        context->insertRecording(info);
+    }
+    const double inserted = SkTime::GetNSecs();
+    context->submit(SyncToCpu::kYes);
+    const double submitted = SkTime::GetNSecs();
+
+    add("record_ms",  (recorded  - start)    * 1e-6);
+    add("snap_ms",    (snapped   - recorded) * 1e-6);
+    add("insert_ms",  (inserted  - snapped)  * 1e-6);
+    add("submit_ms",  (submitted - inserted) * 1e-6);
+
+    const SkCounters::Snapshot delta = SkCounters::Read() - before;
+    using Counter = SkCounters::Counter;
+    add("draws",              delta[Counter::kOpsBuilt]);
+    add("pipelines_compiled", delta[Counter::kPipelinesCompiled]);
+    add("glyph_cache_misses", delta[Counter::kGlyphCacheMisses]);
+    add("bytes_uploaded",     delta[Counter::kBytesUploaded]);
+
+    const ResourceCacheStats stats = recorder->resourceCacheStats();
+    add("scratch_hits",      stats.fScratchHits);
+    add("scratch_misses",    stats.fScratchMisses);
+    add("shareable_hits",    stats.fShareableHits);
+    add("shareable_misses",  stats.fShareableMisses);
+    add("allocated_bytes",   stats.fAllocatedBytes);
+    add("purged_bytes",      stats.fPurgedBytes);
+}
+
+}  // namespace skgpu::graphite
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef GraphiteFrameBench_DEFINED
+#define GraphiteFrameBench_DEFINED
+
+#include "bench/Benchmark.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkString.h"
+
+#include <memory>
+
+class MSKPPlayer;
+
+namespace skgpu::graphite {
+
+/**
+ * Plays an SKP, or every frame of an MSKP, as one Graphite frame per loop: records it into the
+ * canvas' Recorder, snaps a Recording, inserts it into the Context, and submits. This is the
+ * Graphite counterpart to SKPBench and MSKPBench, timing all the CPU work a frame costs.
+ *
+ * With --gpuStatsDump, getGpuStats() times each phase of one more frame separately, and counts
+ * what that frame compiled, uploaded, and asked of the resource cache.
+ */
+class GraphiteFrameBench : public Benchmark {
+public:
+    GraphiteFrameBench(const char* name, sk_sp<SkPicture>);
+    GraphiteFrameBench(const char* name, std::unique_ptr<MSKPPlayer>);
+    ~GraphiteFrameBench() override;
+
+    void getGpuStats(SkCanvas*,
+                     skia_private::TArray<SkString>* keys,
+                     skia_private::TArray<double>* values) override;
+
+protected:
+    bool isSuitableFor(Backend backend) override { return backend == kGraphite_Backend; }
+    const char* onGetName() override;
+    SkISize onGetSize() override;
+    void onPerCanvasPreDraw(SkCanvas*) override;
+    void onPerCanvasPostDraw(SkCanvas*) override;
+    void onDraw(int loops, SkCanvas*) override;
+
+private:
+    void record(SkCanvas*);
+
+    SkString fName;
+    sk_sp<SkPicture> fPicture;            // either this,
+    std::unique_ptr<MSKPPlayer> fPlayer;  // or this
+};
+
+}  // namespace skgpu::graphite
+
+#endif  // GraphiteFrameBench_DEFINED
@@ -15,6 +15,7 @@
 #include "bench/CodecBenchPriv.h"
 #include "bench/GMBench.h"
 #include "bench/MSKPBench.h"
+#include "bench/PerfCounters.h"
 #include "bench/RecordingBench.h"
 #include "bench/ResultsWriter.h"
 #include "bench/SKPAnimationBench.h"
@@ -35,6 +36,7 @@
 #include "include/encode/SkPngEncoder.h"
 #include "include/private/base/SkMacros.h"
 #include "src/base/SkAutoMalloc.h"
+#include "src/base/SkRandom.h"
 #include "src/base/SkLeanWindows.h"
 #include "src/base/SkTime.h"
 #include "src/core/SkColorSpacePriv.h"
@@ -68,6 +70,7 @@
 #endif
 
 #if defined(SK_GRAPHITE)
+#include "bench/graphite/GraphiteFrameBench.h"
 #include "include/gpu/graphite/Context.h"
 #include "include/gpu/graphite/Recorder.h"
 #include "include/gpu/graphite/Recording.h"
@@ -77,11 +80,14 @@
 #include "tools/graphite/GraphiteTestContext.h"
 #endif
 
+#include <algorithm>
 #include <cinttypes>
+#include <cmath>
 #include <memory>
 #include <optional>
 #include <stdlib.h>
 #include <thread>
+#include <utility>
 
 extern bool gSkForceRasterPipelineBlitter;
 extern bool gForceHighPrecisionRasterPipeline;
@@ -91,6 +97,10 @@ extern bool gForceHighPrecisionRasterPipeline;
 
 #endif
 
+#if defined(SK_BUILD_FOR_UNIX) || defined(SK_BUILD_FOR_ANDROID)
+    #include <sched.h>
+#endif
+
 #include "include/gpu/GrDirectContext.h"
 #include "include/gpu/ganesh/SkSurfaceGanesh.h"
 #include "src/gpu/ganesh/GrCaps.h"
@@ -188,6 +198,9 @@ static DEFINE_bool2(verbose, v, false, "enable verbose output from the test driv
 
 static DEFINE_string(skps, "skps", "Directory to read skps from.");
 static DEFINE_string(mskps, "mskps", "Directory to read mskps from.");
+static DEFINE_bool(graphiteFrames, false,
+                   "Also bench each skp and mskp as whole Graphite frames: record, snap, "
+                   "insert, and submit.");
 static DEFINE_string(svgs, "", "Directory to read SVGs from, or a single SVG file.");
 static DEFINE_string(texttraces, "", "Directory to read TextBlobTrace files from.");
 
@@ -209,6 +222,17 @@ static DEFINE_bool(splitPerfettoTracesByBenchmark, true,
                   "Create separate perfetto trace files for each benchmark?\n"
                   "Will only take effect if perfetto tracing is enabled. See --trace.");
 
+static DEFINE_bool(ab, false,
+                   "Compare exactly two --config: time each bench in both, in interleaved pairs "
+                   "of samples, and report the ratio of the second to the first with a bootstrap "
+                   "confidence interval. Use plenty of --samples, e.g. 100.");
+static DEFINE_int(abResamples, 2000, "Number of bootstrap resamples for --ab.");
+static DEFINE_double(abConfidence, 0.95, "Confidence level of the --ab intervals.");
+static DEFINE_int(pinCpu, -1, "If >= 0, run on only this CPU. Linux and Android only.");
+static DEFINE_bool(perfCounters, false,
+                   "Count instructions, cache misses, and branch misses per bench unit with "
+                   "perf_event_open(). Linux and Android only.");
+
 static double now_ms() { return SkTime::GetNSecs() * 1e-6; }
 
 static SkString humanize(double ms) {
@@ -384,7 +408,8 @@ struct GraphiteTarget : public Target {
 };
 #endif // SK_GRAPHITE
 
-static double time(int loops, Benchmark* bench, Target* target) {
+static double time(int loops, Benchmark* bench, Target* target,
+                   PerfCounters* perfCounters = nullptr) {
     SkCanvas* canvas = target->getCanvas();
     if (canvas) {
         canvas->clear(SK_ColorWHITE);
@@ -393,7 +418,13 @@ static double time(int loops, Benchmark* bench, Target* target) {
     double start = now_ms();
     canvas = target->beginTiming(canvas);
 
+    if (perfCounters) {
+        perfCounters->start();
+    }
     bench->draw(loops, canvas);
+    if (perfCounters) {
+        perfCounters->stop();
+    }
 
     target->endTiming();
     double elapsed = now_ms() - start;
@@ -1043,6 +1074,33 @@ public:
             return new MSKPBench(std::move(name), std::move(player));
         }
 
+#if defined(SK_GRAPHITE)
+        if (FLAGS_graphiteFrames) {
+            while (fCurrentGraphiteSKP < fSKPs.size()) {
+                const SkString& path = fSKPs[fCurrentGraphiteSKP++];
+                sk_sp<SkPicture> pic = ReadPicture(path.c_str());
+                if (!pic) {
+                    continue;
+                }
+                SkString name = SkOSPath::Basename(path.c_str());
+                fSourceType = "skp";
+                fBenchType = "graphite_frame";
+                return new skgpu::graphite::GraphiteFrameBench(name.c_str(), std::move(pic));
+            }
+            while (fCurrentGraphiteMSKP < fMSKPs.size()) {
+                const SkString& path = fMSKPs[fCurrentGraphiteMSKP++];
+                std::unique_ptr<MSKPPlayer> player = ReadMSKP(path.c_str());
+                if (!player) {
+                    continue;
+                }
+                SkString name = SkOSPath::Basename(path.c_str());
+                fSourceType = "mskp";
+                fBenchType = "graphite_frame";
+                return new skgpu::graphite::GraphiteFrameBench(name.c_str(), std::move(player));
+            }
+        }
+#endif
+
         for (; fCurrentCodec < fImages.size(); fCurrentCodec++) {
             fSourceType = "image";
             fBenchType = "skcodec";
@@ -1161,11 +1219,12 @@ public:
         // test on power of two sample sizes.  The output tile is always 512x512, so, when a
         // sampleSize is used, the size of the subset that is decoded is always
         // (sampleSize*512)x(sampleSize*512).
-        // There are a few good reasons to only test on power of two sample sizes at this time:
-        //     All use cases we are aware of only scale by powers of two.
+        // Most of these are power of two sample sizes:
+        //     Most use cases we are aware of only scale by powers of two.
         //     PNG decodes use the indicated sampling strategy regardless of the sample size, so
         //         these tests are sufficient to provide good coverage of our scaling options.
-        const uint32_t brdSampleSizes[] = { 1, 2, 4, 8, 16 };
+        // 3 and 6 cover JPEG decodes that libjpeg-turbo scales by 3/8 and 2/8 before resizing.
+        const uint32_t brdSampleSizes[] = { 1, 2, 3, 4, 6, 8, 16 };
         const uint32_t minOutputSize = 512;
         for (; fCurrentBRDImage < fImages.size(); fCurrentBRDImage++) {
             fSourceType = "image";
@@ -1294,6 +1353,8 @@ private:
     int fCurrentRecording = 0;
     int fCurrentDeserialPicture = 0;
     int fCurrentMSKP = 0;
+    int fCurrentGraphiteSKP = 0;
+    int fCurrentGraphiteMSKP = 0;
     int fCurrentScale = 0;
     int fCurrentSKP = 0;
     int fCurrentSVG = 0;
@@ -1337,9 +1398,134 @@ class NanobenchShaderErrorHandler : public GrContextOptions::ShaderErrorHandler
     }
 };
 
+static void pin_to_cpu(int cpu) {
+#if defined(SK_BUILD_FOR_UNIX) || defined(SK_BUILD_FOR_ANDROID)
+    // Threads we start later inherit this, so they'll share the CPU.
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        SkDebugf("Could not pin to CPU %d.\n", cpu);
+    }
+#else
+    SkDebugf("--pinCpu is not supported on this platform.\n");
+#endif
+}
+
+// Resamples the ratios with replacement, FLAGS_abResamples times, and returns the central
+// FLAGS_abConfidence interval of the resamples' medians.
+static std::pair<double, double> bootstrap_median_interval(const TArray<double>& ratios) {
+    SkRandom rand(0x5eed);  // Fixed, so that the same samples always give the same interval.
+    TArray<double> medians, resample;
+    for (int i = 0; i < FLAGS_abResamples; ++i) {
+        resample.clear();
+        for (int j = 0; j < ratios.size(); ++j) {
+            resample.push_back(ratios[rand.nextULessThan(ratios.size())]);
+        }
+        medians.push_back(Stats(resample, false).median);
+    }
+    std::sort(medians.begin(), medians.end());
+    const double tail = (1 - FLAGS_abConfidence) / 2 * (medians.size() - 1);
+    return {medians[(int)std::floor(tail)],
+            medians[(int)std::ceil(medians.size() - 1 - tail)]};
+}
+
+// Times bench in configs a and b in pairs of samples, alternating which of the two goes first,
+// so that drift in clocks and temperature lands on both alike, and logs how b compares to a.
+// Returns false if bench can't be timed in both.
+static bool run_ab(Benchmark* bench,
+                   const Config& a,
+                   const Config& b,
+                   double overhead,
+                   const BenchmarkStream& benchStream,
+                   NanoJSONResultsWriter& log,
+                   AutoreleasePool& pool) {
+    std::unique_ptr<Target> targets[2] = {std::unique_ptr<Target>(is_enabled(bench, a)),
+                                          std::unique_ptr<Target>(is_enabled(bench, b))};
+    if (!targets[0] || !targets[1]) {
+        return false;
+    }
+
+    int loops[2];
+    for (int t = 0; t < 2; ++t) {
+        targets[t]->setup();
+        bench->perCanvasPreDraw(targets[t]->getCanvas());
+        int maxFrameLag;
+        loops[t] = targets[t]->needsFrameTiming(&maxFrameLag)
+                ? setup_gpu_bench(targets[t].get(), bench, maxFrameLag)
+                : setup_cpu_bench(overhead, targets[t].get(), bench);
+    }
+    auto postDraw = [&] {
+        for (auto& target : targets) {
+            bench->perCanvasPostDraw(target->getCanvas());
+        }
+    };
+    if (loops[0] == kFailedLoops || loops[1] == kFailedLoops) {
+        postDraw();
+        return false;
+    }
+
+    for (int t = 0; t < 2; ++t) {
+        time(loops[t], bench, targets[t].get());  // Warm up.
+    }
+    TArray<double> samples[2], ratios;
+    for (int s = 0; s < std::max(FLAGS_samples, 2); ++s) {
+        for (int i = 0; i < 2; ++i) {
+            const int t = (s + i) % 2;
+            samples[t].push_back(time(loops[t], bench, targets[t].get()) / loops[t] /
+                                 bench->getUnits());
+            pool.drain();
+        }
+        ratios.push_back(samples[1].back() / samples[0].back());
+    }
+    postDraw();
+
+    const Stats statsA(samples[0], false),
+                statsB(samples[1], false),
+                statsRatio(ratios, false);
+    const auto [low, high] = bootstrap_median_interval(ratios);
+
+    log.beginObject(SkStringPrintf("%s_vs_%s", b.name.c_str(), a.name.c_str()).c_str());
+    log.beginObject("options");
+    log.appendCString("name", bench->getName());
+    log.appendCString("a", a.name.c_str());
+    log.appendCString("b", b.name.c_str());
+    benchStream.fillCurrentOptions(log);
+    log.endObject();  // options
+    log.appendMetric("a_median_ms", statsA.median);
+    log.appendMetric("b_median_ms", statsB.median);
+    log.appendMetric("ratio", statsRatio.median);
+    log.appendMetric("ratio_low", low);
+    log.appendMetric("ratio_high", high);
+    for (int t = 0; t < 2; ++t) {
+        log.beginArray(t == 0 ? "a_samples" : "b_samples");
+        for (double sample : samples[t]) {
+            log.appendDoubleDigits(sample, 16);
+        }
+        log.endArray();
+    }
+    log.endObject();
+
+    // Only an interval that excludes 1 is a difference we can trust.
+    const char* verdict = low > 1 ? "slower" : high < 1 ? "faster" : "same";
+    SkDebugf("%s\t%s\t%.4f\t[%.4f, %.4f]\t%s\t%s\n",
+             HUMANIZE(statsA.median),
+             HUMANIZE(statsB.median),
+             statsRatio.median,
+             low,
+             high,
+             verdict,
+             bench->getUniqueName());
+    return true;
+}
+
 int main(int argc, char** argv) {
     CommandLineFlags::Parse(argc, argv);
 
+    if (FLAGS_pinCpu >= 0) {
+        pin_to_cpu(FLAGS_pinCpu);
+    }
+
     initializeEventTracingForTools();
 
 #if defined(SK_BUILD_FOR_IOS)
@@ -1409,10 +1595,20 @@ int main(int argc, char** argv) {
         SkDebugf("Timer overhead: %s\n", HUMANIZE(overhead));
     }
 
+    std::unique_ptr<PerfCounters> perfCounters;
+    if (FLAGS_perfCounters) {
+        perfCounters = PerfCounters::Make();
+        if (!perfCounters) {
+            SkDebugf("Hardware performance counters are not available.\n");
+        }
+    }
+
     TArray<double> samples;
 
     if (kAutoTuneLoops != FLAGS_loops) {
         SkDebugf("Fixed number of loops; times would only be misleading so we won't print them.\n");
+    } else if (FLAGS_ab) {
+        SkDebugf("a\tb\tb/a\t%g%% interval\t\tb vs a\tbench\n", 100 * FLAGS_abConfidence);
     } else if (FLAGS_quiet) {
         SkDebugf("! -> high variance, ? -> moderate variance\n");
         SkDebugf("    micros   \tbench\n");
@@ -1429,6 +1625,10 @@ int main(int argc, char** argv) {
 
     TArray<Config> configs;
     create_configs(&configs);
+    if (FLAGS_ab && (configs.size() != 2 || FLAGS_abResamples < 1)) {
+        SkDebugf("ERROR: --ab needs exactly two --config, and --abResamples >= 1.\n");
+        return 1;
+    }
 
     if (FLAGS_keepAlive) {
         start_keepalive();
@@ -1460,6 +1660,14 @@ int main(int argc, char** argv) {
                     bench->getUniqueName(), bench->getSize().width(), bench->getSize().height());
             bench->delayedSetup();
         }
+        if (FLAGS_ab) {
+            if (run_ab(bench.get(), configs[0], configs[1], overhead, benchStream, log, pool) &&
+                runs++ % FLAGS_flushEvery == 0) {
+                log.flush();
+            }
+            log.endBench();
+            continue;
+        }
         for (int i = 0; i < configs.size(); ++i) {
             Target* target = is_enabled(b, configs[i]);
             if (!target) {
@@ -1513,21 +1721,31 @@ int main(int argc, char** argv) {
                 } while (now_ms() < stop);
             }
 
+            if (perfCounters) {
+                perfCounters->reset();
+            }
             if (FLAGS_ms) {
                 samples.clear();
                 auto stop = now_ms() + FLAGS_ms;
                 do {
-                    samples.push_back(time(loops, bench.get(), target) / loops);
+                    samples.push_back(time(loops, bench.get(), target, perfCounters.get()) / loops);
                     pool.drain();
                 } while (now_ms() < stop);
             } else {
                 samples.reset(FLAGS_samples);
                 for (int s = 0; s < FLAGS_samples; s++) {
-                    samples[s] = time(loops, bench.get(), target) / loops;
+                    samples[s] = time(loops, bench.get(), target, perfCounters.get()) / loops;
                     pool.drain();
                 }
             }
 
+            // Hardware counts per unit, like the samples below.
+            PerfCounters::Counts counts;
+            const double perUnit = 1.0 / ((double)loops * samples.size() * bench->getUnits());
+            if (perfCounters) {
+                counts = perfCounters->read();
+            }
+
             // Scale each result to the benchmark's own units, time/unit.
             for (double& sample : samples) {
                 sample *= (1.0 / bench->getUnits());
@@ -1546,6 +1764,8 @@ int main(int argc, char** argv) {
                     dmsaaStats.dump();
                     combinedDMSAAStats.merge(dmsaaStats);
                 }
+            } else if (configs[i].backend == Benchmark::kGraphite_Backend && FLAGS_gpuStatsDump) {
+                bench->getGpuStats(canvas, &keys, &values);
             }
 
             bench->perCanvasPostDraw(canvas);
@@ -1578,9 +1798,14 @@ int main(int argc, char** argv) {
                 log.appendDoubleDigits(sample, 16);
             }
             log.endArray(); // samples
+            if (perfCounters) {
+                log.appendMetric("instructions", counts.fInstructions * perUnit);
+                log.appendMetric("cache_misses", counts.fCacheMisses * perUnit);
+                log.appendMetric("branch_misses", counts.fBranchMisses * perUnit);
+            }
             benchStream.fillCurrentMetrics(log);
             if (!keys.empty()) {
-                // dump to json, only SKPBench currently returns valid keys / values
+                // dump to json, only SKPBench and GraphiteFrameBench return keys / values
                 SkASSERT(keys.size() == values.size());
                 for (int j = 0; j < keys.size(); j++) {
                     log.appendMetric(keys[j].c_str(), values[j]);
@@ -1642,6 +1867,14 @@ int main(int argc, char** argv) {
                         );
             }
 
+            if (perfCounters && !FLAGS_quiet && !FLAGS_csv) {
+                SkDebugf("\t\tper unit: %.1f instructions, %.2f cache misses, "
+                         "%.2f branch misses\n",
+                         counts.fInstructions * perUnit,
+                         counts.fCacheMisses * perUnit,
+                         counts.fBranchMisses * perUnit);
+            }
+
             if (FLAGS_gpuStats && Benchmark::kGPU_Backend == configs[i].backend) {
                 target->dumpStats();
             }
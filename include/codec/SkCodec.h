@@ -29,6 +29,7 @@
 #include <vector>
 
 class SkData;
+class SkExecutor;
 class SkFrameHolder;
 class SkImage;
 class SkPngChunkReader;
@@ -927,6 +928,8 @@ private:
     XformFormat                        fDstXformFormat; // Based on fDstInfo.
     skcms_ICCProfile                   fDstProfile;
     skcms_AlphaFormat                  fDstXformAlphaFormat;
+    // Prepared once per decode, from fEncodedInfo's profile to fDstProfile, rather than per row.
+    skcms_PreparedTransform            fXform;
 
     // Only meaningful during scanline decodes.
     int fCurrScanline = -1;
@@ -1053,6 +1056,37 @@ struct SK_API Decoder {
 // will replace the existing one (in the same position). This is not thread-safe, so make sure all
 // initialization is done before the first call.
 void SK_API Register(Decoder d);
+
+// Like Register(), but the decoder is put at the front of the list, ahead of every decoder that is
+// already there, including the built-in ones. This is meant for decoders that use platform
+// hardware (e.g. the JPEG and HEIF decoders on Android and Apple devices), which can be given
+// their own id and claim the same formats as the software decoders.
+//
+// When more than one decoder claims the data, and the stream can be duplicated, a decoder that
+// fails to make a codec falls back to the next one that claims it. That lets a hardware decoder
+// turn down images it doesn't support (e.g. progressive JPEGs or unusual sizes) by returning
+// nullptr. This is not thread-safe either.
+void SK_API RegisterPreferred(Decoder d);
+
+// One image for DecodeBatch() to decode.
+struct SK_API BatchDecodeRequest {
+    sk_sp<SkData> data;
+    // The size to decode to, or empty to decode at the encoded size. The image is decoded at the
+    // smallest scale its codec supports natively that's at least this big (e.g. 1/8 steps for
+    // JPEG), then resampled to exactly this size.
+    SkISize       dimensions = {0, 0};
+    SkColorType   colorType  = kN32_SkColorType;
+};
+
+// Decodes a batch of images, as getImage() would, spreading the work across the executor: first
+// every header is parsed, then the images are decoded and resampled. At most memoryBudget bytes
+// of pixels are decoded at once, though an image is never held back while nothing else is in
+// flight, however big it is. Blocks until every image is done.
+//
+// Returns one image per request, in order, with nullptr for any that couldn't be decoded.
+std::vector<sk_sp<SkImage>> SK_API DecodeBatch(SkSpan<const BatchDecodeRequest>,
+                                               SkExecutor&,
+                                               size_t memoryBudget = 64 * 1024 * 1024);
 }
 
 #endif // SkCodec_DEFINED
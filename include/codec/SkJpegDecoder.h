@@ -12,6 +12,8 @@
 #include "include/private/base/SkAPI.h"
 
 class SkData;
+class SkExecutor;
+class SkPixmap;
 class SkStream;
 
 #include <memory>
@@ -35,6 +37,21 @@ SK_API std::unique_ptr<SkCodec> Decode(sk_sp<SkData>,
                                        SkCodec::Result*,
                                        SkCodecs::DecodeContext = nullptr);
 
+/**
+ *  Decodes the whole JPEG in |data| to |dst|, which must have the image's dimensions, like
+ *  SkCodec::getPixels() would.
+ *
+ *  If the image is a single sequential scan with restart markers at the ends of MCU rows, it is
+ *  split at those markers into bands of rows. Each band is decoded as a separate task on
+ *  |executor|, straight into its rows of |dst|. Otherwise, or if |executor| is nullptr, the image
+ *  is decoded on the calling thread.
+ *
+ *  Experimental.
+ */
+SK_API SkCodec::Result DecodeInParallel(sk_sp<SkData> data,
+                                        const SkPixmap& dst,
+                                        SkExecutor* executor);
+
 inline constexpr SkCodecs::Decoder Decoder() {
     return { "jpeg", IsJpeg, Decode };
 }
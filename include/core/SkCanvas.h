@@ -29,7 +29,6 @@
 #include "include/core/SkSurfaceProps.h"
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkCPUTypes.h"
-#include "include/private/base/SkDeque.h"
 #include "include/private/base/SkTArray.h"
 
 #include <cstdint>
@@ -1692,6 +1691,23 @@ public:
                                          const SkSamplingOptions&, const SkPaint* paint = nullptr,
                                          SrcRectConstraint constraint = kStrict_SrcRectConstraint);
 
+    /**
+     * This is a bulk variant of experimental_DrawEdgeAAQuad(), without clips, that fills 'cnt'
+     * rectangles with solid colors. It renders the same as a call to experimental_DrawEdgeAAQuad()
+     * per entry, in order, with 'rects[i]' and 'colors[i]', but the canvas work is done once for
+     * the whole set, and devices may draw the set in bulk.
+     *
+     * If 'matrixIndices' is not null, it has 'cnt' entries, and an entry with an index >= 0 is
+     * drawn as if the canvas's CTM was canvas->getTotalMatrix() * preViewMatrices[index], just
+     * like the 'fMatrixIndex' of an ImageSetEntry.
+     *
+     * The 'aaFlags' and 'mode' apply to every rectangle.
+     */
+    void experimental_DrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int cnt,
+                                        const int matrixIndices[],
+                                        const SkMatrix preViewMatrices[], QuadAAFlags aaFlags,
+                                        SkBlendMode mode);
+
     /** Draws text, with origin at (x, y), using clip, SkMatrix, SkFont font,
         and SkPaint paint.
 
@@ -2277,6 +2293,16 @@ protected:
 
     virtual void onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4], QuadAAFlags aaFlags,
                                   const SkColor4f& color, SkBlendMode mode);
+    // The default draws the set to the device in one call. Canvases that record or forward draws
+    // instead of rendering them can use drawEdgeAARectSetAsQuads().
+    virtual void onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int count,
+                                     const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                     QuadAAFlags aaFlags, SkBlendMode mode);
+
+    // Draws each entry of a rect set with experimental_DrawEdgeAAQuad().
+    void drawEdgeAARectSetAsQuads(const SkRect rects[], const SkColor4f colors[], int count,
+                                  const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                  QuadAAFlags aaFlags, SkBlendMode mode);
 
     enum ClipEdgeStyle {
         kHard_ClipEdgeStyle,
@@ -2385,6 +2411,10 @@ private:
         SkM44 fMatrix;
         int fDeferredSaveCount = 0;
 
+        // Nothing points into an MCRec except SkCanvas::fMCRec, so fMCStack may memcpy recs
+        // when it grows.
+        using sk_is_trivially_relocatable = std::true_type;
+
         MCRec(SkDevice* device);
         MCRec(const MCRec* prev);
         ~MCRec();
@@ -2397,14 +2427,13 @@ private:
         void reset(SkDevice* device);
     };
 
-    // the first N recs that can fit here mean we won't call malloc
-    static constexpr int kMCRecSize      = 96; // most recent measurement
+    // The first N recs are stored inline, so common save/restore depths won't call malloc. Deeper
+    // stacks grow the array once and keep its capacity, so restore() never frees a rec's storage
+    // and later saves to the same depth reuse it.
     static constexpr int kMCRecCount     = 32; // common depth for save/restores
 
-    intptr_t fMCRecStorage[kMCRecSize * kMCRecCount / sizeof(intptr_t)];
-
-    SkDeque     fMCStack;
-    // points to top of stack
+    skia_private::STArray<kMCRecCount, MCRec> fMCStack;
+    // points to top of stack, refreshed whenever fMCStack is pushed or popped
     MCRec*      fMCRec;
 
     // Installed via init()
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkCounters_DEFINED
+#define SkCounters_DEFINED
+
+#include "include/private/base/SkAPI.h"
+
+#include <cstdint>
+
+/**
+ *  Counters of the work Skia does, cheap enough to leave on in production: counting is a plain
+ *  add to memory owned by the counting thread, and the counters are only summed across threads
+ *  when they are read.
+ *
+ *  Counters only go up. To measure a frame, Read() before and after it, and subtract.
+ */
+namespace SkCounters {
+
+enum class Counter {
+    kDraws,              //!< SkCanvas draws that reached a device
+    kOpsBuilt,           //!< draws recorded by the GPU backends: Ganesh ops, or Graphite draws
+    kPipelinesCompiled,  //!< GPU programs or pipelines compiled because they weren't cached
+    kGlyphCacheMisses,   //!< glyphs that strikes had to ask their scaler contexts for
+    kBytesUploaded,      //!< bytes of pixels uploaded to GPU textures
+    kFlushes,            //!< Ganesh flushes, or Graphite recordings inserted into a context
+    kFlushNanoseconds,   //!< time spent in those flushes
+
+    kLast = kFlushNanoseconds,
+};
+static constexpr int kCounterCount = static_cast<int>(Counter::kLast) + 1;
+
+struct Snapshot {
+    uint64_t fValues[kCounterCount] = {};
+
+    uint64_t operator[](Counter counter) const { return fValues[static_cast<int>(counter)]; }
+
+    Snapshot operator-(const Snapshot& earlier) const {
+        Snapshot delta;
+        for (int i = 0; i < kCounterCount; ++i) {
+            delta.fValues[i] = fValues[i] - earlier.fValues[i];
+        }
+        return delta;
+    }
+};
+
+/** Returns the total of each counter over all threads, including threads that have exited. */
+SK_API Snapshot Read();
+
+}  // namespace SkCounters
+
+#endif  // SkCounters_DEFINED
@@ -10,6 +10,7 @@
 
 #include <functional>
 #include <memory>
+#include <utility>
 #include "include/core/SkTypes.h"
 
 class SK_API SkExecutor {
@@ -22,13 +23,29 @@ public:
     static std::unique_ptr<SkExecutor> MakeLIFOThreadPool(int threads = 0,
                                                           bool allowBorrowing = true);
 
+    // Create a thread pool SkExecutor where each thread keeps its own queue of work, and idle
+    // threads steal work from the others.  Work added from one of the pool's own threads stays
+    // on that thread's queue, so tasks that spawn many small tasks don't contend on one lock.
+    static std::unique_ptr<SkExecutor> MakeWorkStealingThreadPool(int threads = 0,
+                                                                  bool allowBorrowing = true);
+
     // There is always a default SkExecutor available by calling SkExecutor::GetDefault().
     static SkExecutor& GetDefault();
     static void SetDefault(SkExecutor*);  // Does not take ownership.  Not thread safe.
 
+    enum class Priority {
+        kNormal,
+        kHigh,  // Runs before any pending kNormal work, e.g. for latency-sensitive rendering.
+    };
+
     // Add work to execute.
     virtual void add(std::function<void(void)>) = 0;
 
+    // Add work to execute with the given priority.  By default priority is ignored.
+    virtual void addWithPriority(std::function<void(void)> work, Priority) {
+        this->add(std::move(work));
+    }
+
     // If it makes sense for this executor, use this thread to execute work for a little while.
     virtual void borrow() {}
 
@@ -9,6 +9,8 @@
 #define SkGraphics_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSpan.h"
+#include "include/core/SkTypes.h"
 #include "include/private/base/SkAPI.h"
 
 #include <cstddef>
@@ -16,8 +18,12 @@
 #include <memory>
 
 class SkData;
+class SkExecutor;
+class SkFont;
 class SkImageGenerator;
+class SkMatrix;
 class SkOpenTypeSVGDecoder;
+class SkSurfaceProps;
 class SkTraceMemoryDump;
 
 class SK_API SkGraphics {
@@ -83,6 +89,26 @@ public:
      */
     static void PurgePinnedFontCache();
 
+    /**
+     *  Generates glyphs in the font cache before they are first drawn, so that drawing them
+     *  doesn't have to wait for the font's scaler, e.g. for the Latin characters of the UI fonts
+     *  at startup. Use SkFont::textToGlyphs() to find the glyphs of a set of characters.
+     *
+     *  The glyphs are generated the way they are drawn with a default paint, the given matrix,
+     *  and a surface with these props that isn't in a linear color space: as masks, including
+     *  each subpixel position when the font uses subpixel positioning, or as paths when the font
+     *  is too large for masks. Drawing them any other way generates them again as usual.
+     *
+     *  If executor is not null, the glyphs are generated on it and this returns immediately.
+     *  Otherwise they are generated before this returns. Either way the glyphs are subject to the
+     *  font cache limits, so prepopulating more than fits just replaces earlier entries.
+     */
+    static void PrepopulateFontCache(const SkFont& font,
+                                     SkSpan<const SkGlyphID> glyphs,
+                                     const SkMatrix& matrix,
+                                     const SkSurfaceProps& surfaceProps,
+                                     SkExecutor* executor = nullptr);
+
     /**
      *  This function returns the memory used for temporary images and other resources.
      */
@@ -113,6 +139,30 @@ public:
     static size_t GetResourceCacheSingleAllocationByteLimit();
     static size_t SetResourceCacheSingleAllocationByteLimit(size_t newLimit);
 
+    /**
+     *  SkRuntimeEffect::MakeForShader, MakeForColorFilter and MakeForBlender keep the most
+     *  recently made effects, so that making one from the same SkSL and options again returns the
+     *  effect that was already compiled, rather than compiling the SkSL again. These get/set how
+     *  many effects are kept; setting the limit to zero turns the cache off. Set returns the
+     *  previous limit.
+     */
+    static int GetRuntimeEffectCacheCountLimit();
+    static int SetRuntimeEffectCacheCountLimit(int count);
+
+    /**
+     *  Drops every effect held by the runtime effect cache. It does not change the limit.
+     */
+    static void PurgeRuntimeEffectCache();
+
+    /**
+     *  The SkSL modules built into Skia are otherwise compiled the first time an SkRuntimeEffect
+     *  or GPU shader needs them, which makes the first one noticeably slow. This compiles the
+     *  modules used by runtime effects and, in builds with a GPU backend, by its shaders, so that
+     *  it can be called on a background thread during startup instead. Modules are only compiled
+     *  once per process, so calling this again, or after they have been used, does nothing.
+     */
+    static void PreloadSkSLModules();
+
     /**
      *  Dumps memory usage of caches using the SkTraceMemoryDump interface. See SkTraceMemoryDump
      *  for usage of this method.
@@ -17,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 
@@ -25,6 +26,7 @@ class GrRecordingContext;
 class SkBitmap;
 class SkColorSpace;
 class SkData;
+class SkExecutor;
 class SkImage;
 class SkImageFilter;
 class SkImageGenerator;
@@ -120,6 +122,34 @@ SK_API sk_sp<SkImage> DeferredFromEncodedData(sk_sp<SkData> encoded,
 */
 SK_API sk_sp<SkImage> DeferredFromGenerator(std::unique_ptr<SkImageGenerator> imageGenerator);
 
+/** How raster draws of an image treat a PredecodeAsync() of it that has not finished yet. */
+enum class PredecodeDraws {
+    kWait,  //!< draws wait for the decode in flight, then draw its pixels
+    kSkip,  //!< draws of the image draw nothing until the decode finishes
+};
+
+/** If image is lazy (see DeferredFromEncodedData() and DeferredFromGenerator()), decodes it on
+    executor into the cache of decoded images, so that the first raster draw of it does not
+    have to decode it on the drawing thread. Decoded pixels are purgeable like any other cached
+    decode; see SkGraphics::SetResourceCacheTotalByteLimit().
+
+    Only one decode of an image is in flight at a time: calling PredecodeAsync() again, or
+    drawing the image with PredecodeDraws::kWait, while it is being decoded waits for that
+    decode rather than starting another.
+
+    done, if set, is called with whether the image's pixels are ready, on the thread that
+    decoded them, or before PredecodeAsync() returns if there was nothing to decode.
+
+    @param image     the image to decode
+    @param executor  where to decode it
+    @param draws     how draws of image behave until it is decoded
+    @param done      called once image is decoded, or failed to decode
+*/
+SK_API void PredecodeAsync(sk_sp<SkImage> image,
+                           SkExecutor* executor,
+                           PredecodeDraws draws = PredecodeDraws::kWait,
+                           std::function<void(bool)> done = nullptr);
+
 enum class BitDepth {
     kU8,   //!< uses 8-bit unsigned int per color component
     kF16,  //!< uses 16-bit float per color component
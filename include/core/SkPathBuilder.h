@@ -214,6 +214,8 @@ public:
     SkPathBuilder& addPath(const SkPath&);
 
     // Performance hint, to reserve extra storage for subsequent calls to lineTo, quadTo, etc.
+    // The counts may be estimates: detach() gives back a large enough excess, and the storage
+    // moves into the path without being copied.
 
     void incReserve(int extraPtCount, int extraVerbCount);
     void incReserve(int extraPtCount) {
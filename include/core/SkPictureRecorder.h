@@ -90,6 +90,19 @@ public:
      */
     sk_sp<SkDrawable> finishRecordingAsDrawable();
 
+    /**
+     *  Signal that the caller is done recording into child, and append everything it recorded to
+     *  this recording, as if it had been drawn into this recorder's canvas at its current matrix
+     *  and clip. Any saves child left open are restored first, and its matrix and clip do not
+     *  carry over to later drawing here.
+     *
+     *  The commands are moved rather than copied or nested, so the cost does not depend on their
+     *  size. Each SkPictureRecorder is independent, so child may have been recorded on another
+     *  thread, but neither recorder may be in use elsewhere during this call. Afterwards child
+     *  is no longer recording, and may begin a new recording.
+     */
+    void appendChildRecording(SkPictureRecorder* child);
+
 private:
     void reset();
 
@@ -22,6 +22,7 @@
 #include <cstdint>
 
 class SkColorSpace;
+class SkExecutor;
 enum SkAlphaType : int;
 struct SkMask;
 
@@ -690,6 +691,37 @@ public:
     */
     bool scalePixels(const SkPixmap& dst, const SkSamplingOptions&) const;
 
+    /** Filters for resamplePixels(). */
+    enum class ResampleFilter {
+        kMitchell, //!< Mitchell-Netravali cubic (B = C = 1/3), like SkCubicResampler::Mitchell()
+        kLanczos3, //!< windowed sinc with three lobes; sharper, with a little ringing
+    };
+
+    /** Copies SkPixmap to dst, scaling pixels to fit dst.width() and dst.height(), and
+        converting pixels to match dst.colorType(), dst.alphaType() and dst.colorSpace().
+
+        Unlike scalePixels(), this filters rows and then columns with the given filter, widened
+        as it downscales so that every source pixel contributes. That makes large downscales
+        faster and better than sampling through mipmaps. Pixels are filtered premultiplied, in
+        dst.colorSpace(), or in its linear-gamma counterpart if linear is true.
+
+        If executor is not nullptr, the rows of dst are split across it, and this blocks until
+        they are all done.
+
+        Returns false if either SkPixmap is empty, dst address is nullptr, or pixel conversion is
+        not possible, as for readPixels().
+
+        @param dst       SkImageInfo and pixel address to write to
+        @param filter    filter to resample with
+        @param linear    whether to filter linear-gamma pixels
+        @param executor  optional executor to spread the work across
+        @return          true if pixels are scaled to fit dst
+    */
+    bool resamplePixels(const SkPixmap& dst,
+                        ResampleFilter filter,
+                        bool linear = false,
+                        SkExecutor* executor = nullptr) const;
+
     /** Writes color to pixels bounded by subset; returns true on success.
         Returns false if colorType() is kUnknown_SkColorType, or if subset does
         not intersect bounds().
@@ -210,7 +210,7 @@ public:
     /** Constructs SkRegion as the union of SkIRect in rects array. If count is
         zero, constructs empty SkRegion. Returns false if constructed SkRegion is empty.
 
-        May be faster than repeated calls to op().
+        Builds the result in one pass over the rects, which is faster than repeated calls to op().
 
         @param rects  array of SkIRect
         @param count  array size
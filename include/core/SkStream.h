@@ -355,6 +355,12 @@ private:
     size_t fStart;
     size_t fCurrent;
 
+    // Small reads are served from this read-ahead buffer, which holds [fBufferStart, fBufferEnd)
+    // of the FILE, to save a system call for each one.
+    std::unique_ptr<uint8_t[]> fBuffer;
+    size_t fBufferStart = 0;
+    size_t fBufferEnd = 0;
+
     using INHERITED = SkStreamAsset;
 };
 
@@ -449,6 +455,8 @@ public:
 
 private:
     FILE* fFILE;
+    // A larger buffer than stdio's default, so small writes cost fewer system calls.
+    std::unique_ptr<char[]> fBuffer;
 
     using INHERITED = SkWStream;
 };
@@ -58,6 +58,9 @@ public:
         // If set, all rendering will have dithering enabled
         // Currently this only impacts GPU backends
         kAlwaysDither_Flag              = 1 << 2,
+        // If set, large image filter blurs may use a faster approximation of the Gaussian, which
+        // suits backdrop-style blurs. Currently this only impacts the Graphite backend.
+        kApproximateBlurs_Flag          = 1 << 3,
     };
 
     /** No flags, unknown pixel geometry. */
@@ -82,6 +85,10 @@ public:
         return SkToBool(fFlags & kAlwaysDither_Flag);
     }
 
+    bool isApproximateBlurs() const {
+        return SkToBool(fFlags & kApproximateBlurs_Flag);
+    }
+
     bool operator==(const SkSurfaceProps& that) const {
         return fFlags == that.fFlags && fPixelGeometry == that.fPixelGeometry;
     }
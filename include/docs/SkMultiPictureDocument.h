@@ -16,6 +16,7 @@
 #include <functional>
 
 class SkDocument;
+class SkExecutor;
 class SkStreamSeekable;
 class SkWStream;
 struct SkDeserialProcs;
@@ -30,9 +31,14 @@ namespace SkMultiPictureDocument {
 /**
  *  Writes into a file format that is similar to SkPicture::serialize()
  *  Accepts a callback for endPage behavior
+ *
+ *  Each page is stored as its own SkPicture, after an index of where each one starts, so pages
+ *  can be read back individually with ReadPage(). If executor is set, the pages are serialized
+ *  on it in parallel, which means the SkSerialProcs may be called concurrently and in any order.
  */
 SK_API sk_sp<SkDocument> Make(SkWStream* dst, const SkSerialProcs* = nullptr,
-                              std::function<void(const SkPicture*)> onEndPage = nullptr);
+                              std::function<void(const SkPicture*)> onEndPage = nullptr,
+                              SkExecutor* executor = nullptr);
 
 /**
  *  Returns the number of pages in the SkMultiPictureDocument.
@@ -43,11 +49,26 @@ SK_API int ReadPageCount(SkStreamSeekable* src);
  *  Read the SkMultiPictureDocument into the provided array of pages.
  *  dstArrayCount must equal SkMultiPictureDocumentReadPageCount().
  *  Return false on error.
+ *
+ *  If executor is set, pages are deserialized on it in parallel, which means the SkDeserialProcs
+ *  may be called concurrently and in any order. Documents written before pages were indexed are
+ *  always read serially.
  */
 SK_API bool Read(SkStreamSeekable* src,
                  SkDocumentPage* dstArray,
                  int dstArrayCount,
-                 const SkDeserialProcs* = nullptr);
+                 const SkDeserialProcs* = nullptr,
+                 SkExecutor* executor = nullptr);
+
+/**
+ *  Reads just page pageIndex of the SkMultiPictureDocument into dst, seeking past the others.
+ *  SkDeserialProcs that depend on having seen earlier pages, like ones that share images between
+ *  pages, may not be able to decode it. Return false on error.
+ */
+SK_API bool ReadPage(SkStreamSeekable* src,
+                     int pageIndex,
+                     SkDocumentPage* dst,
+                     const SkDeserialProcs* = nullptr);
 }  // namespace SkMultiPictureDocument
 
 #endif  // SkMultiPictureDocument_DEFINED
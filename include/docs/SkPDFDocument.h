@@ -9,6 +9,7 @@
 
 #include "include/core/SkColor.h"
 #include "include/core/SkMilestone.h"
+#include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkString.h"
 #include "include/private/base/SkNoncopyable.h"
@@ -77,6 +78,26 @@ struct DateTime {
     void toISO8601(SkString* dst) const;
 };
 
+/** A cache that documents can share, so that a batch of documents using the
+    same images and fonts encode each image and subset each font once, rather
+    than once per document. It holds encoded image streams, keyed by SkImage
+    uniqueID, and font subsets, keyed by typeface and by the set of glyphs kept.
+
+    Thread-safe. Set it as Metadata::fSharedCache.
+
+    Experimental.
+*/
+class SK_API SharedCache : public SkRefCnt {
+public:
+    /** Holds at most byteLimit bytes of encoded data, dropping the least
+        recently used first.
+    */
+    static sk_sp<SharedCache> Make(size_t byteLimit);
+
+protected:
+    SharedCache() = default;
+};
+
 /** Optional metadata to be passed into the PDF factory function.
 */
 struct Metadata {
@@ -153,7 +174,8 @@ struct Metadata {
     /** Executor to handle threaded work within PDF Backend. If this is nullptr,
         then all work will be done serially on the main thread. To have worker
         threads assist with various tasks, set this to a valid SkExecutor
-        instance. Currently used for executing Deflate algorithm in parallel.
+        instance. Currently used for executing Deflate algorithm, encoding
+        images and subsetting fonts in parallel.
 
         If set, the PDF output will be non-reproducible in the order and
         internal numbering of objects, but should render the same.
@@ -162,6 +184,19 @@ struct Metadata {
     */
     SkExecutor* fExecutor = nullptr;
 
+    /** If true, each page object is written to the stream as soon as the page
+        ends, rather than when the document is closed, and any work queued on
+        fExecutor for the page is finished first. The memory held by the
+        document then stays roughly flat as the page count grows, which matters
+        for documents with thousands of pages. Only fonts, which are subset
+        over the whole document, and the tables used to deduplicate images,
+        shaders and graphic states are kept until close().
+
+        The page tree is shaped differently, so the output is not byte for byte
+        the same as without streaming, but should render the same.
+    */
+    bool fStreamPages = false;
+
     /** PDF streams may be compressed to save space.
         Use this to specify the desired compression vs time tradeoff.
     */
@@ -173,6 +208,19 @@ struct Metadata {
         HighButSlow = 9,
     } fCompressionLevel = CompressionLevel::Default;
 
+    /** Embedded fonts are written once per document, but are often the bulk of
+        it, so it can pay to compress them harder than page content, e.g. with
+        HighButSlow fonts and LowButFast everything else.
+        Default compresses fonts at fCompressionLevel, like everything else.
+        Ignored if fCompressionLevel is None.
+    */
+    CompressionLevel fFontCompressionLevel = CompressionLevel::Default;
+
+    /** If set, images and font subsets are looked up in, and added to, this
+        cache, which can be shared with other documents.
+    */
+    sk_sp<SharedCache> fSharedCache;
+
     /** Preferred Subsetter. Only respected if both are compiled in.
 
         The Sfntly subsetter is deprecated.
@@ -94,6 +94,12 @@ public:
             // This flag indicates that the SkSL uniform uses a medium-precision type
             // (i.e., `half` instead of `float`).
             kHalfPrecision_Flag = 0x10,
+
+            // Uniform is declared with layout(specialize). The GPU backends compile its value into
+            // the program as a constant, so that branches and loops which depend on it can be
+            // folded away. Each distinct value needs its own program, so this is intended for
+            // values that rarely change, like quality settings or kernel sizes.
+            kSpecialize_Flag = 0x20,
         };
 
         std::string_view name;
@@ -104,6 +110,7 @@ public:
 
         bool isArray() const { return SkToBool(this->flags & kArray_Flag); }
         bool isColor() const { return SkToBool(this->flags & kColor_Flag); }
+        bool isSpecialized() const { return SkToBool(this->flags & kSpecialize_Flag); }
         size_t sizeInBytes() const;
     };
 
@@ -276,6 +283,7 @@ private:
         kAlwaysOpaque_Flag        = 0x040,
         kAlphaUnchanged_Flag      = 0x080,
         kDisableOptimization_Flag = 0x100,
+        kAffineColorFilter_Flag   = 0x200,
     };
 
     SkRuntimeEffect(std::unique_ptr<SkSL::Program> baseProgram,
@@ -302,6 +310,7 @@ private:
     bool usesColorTransform() const { return (fFlags & kUsesColorTransform_Flag); }
     bool alwaysOpaque()       const { return (fFlags & kAlwaysOpaque_Flag);       }
     bool isAlphaUnchanged()   const { return (fFlags & kAlphaUnchanged_Flag);     }
+    bool isAffineColorFilter() const { return (fFlags & kAffineColorFilter_Flag);  }
 
     const SkSL::RP::Program* getRPProgram(SkSL::DebugTracePriv* debugTrace) const;
 
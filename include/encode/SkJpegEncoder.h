@@ -16,6 +16,7 @@
 class SkColorSpace;
 class SkData;
 class SkEncoder;
+class SkExecutor;
 class SkPixmap;
 class SkWStream;
 class SkImage;
@@ -86,6 +87,19 @@ struct Options {
      */
     const skcms_ICCProfile* fICCProfile = nullptr;
     const char* fICCProfileDescription = nullptr;
+
+    /**
+     *  Executor to encode the image on. If this is nullptr, Encode() does all the work on the
+     *  calling thread. Otherwise images with enough rows are split into horizontal strips that
+     *  are encoded as independent tasks, with a restart marker between each strip. The output
+     *  then uses the standard Huffman tables instead of ones computed for the image, so it is a
+     *  little larger, and depends on the image size but not on the thread count.
+     *
+     *  Only used by Encode(). Encoders created with Make() ignore it.
+     *
+     *  Experimental.
+     */
+    SkExecutor* fExecutor = nullptr;
 };
 
 /**
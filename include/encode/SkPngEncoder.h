@@ -19,6 +19,7 @@
 
 class GrDirectContext;
 class SkData;
+class SkExecutor;
 class SkImage;
 class SkPixmap;
 class SkWStream;
@@ -64,6 +65,30 @@ struct Options {
      */
     int fZLibLevel = 6;
 
+    /**
+     *  If true, and fFilterFlags allows more than one filter, the filter for each row is picked
+     *  by trying the allowed filters on every fourth pixel of the row rather than on all of it.
+     *  This makes the filter search several times cheaper, for files that are usually only
+     *  slightly larger.
+     *
+     *  Only used by Encode(). Encoders created with Make() ignore it.
+     */
+    bool fFastFilterSelection = false;
+
+    /**
+     *  Executor to filter and compress the image on. If this is nullptr, Encode() does all the
+     *  work on the calling thread. Otherwise the rows are split into groups that are filtered
+     *  and compressed as independent tasks, and the compressed groups are stitched into one
+     *  zlib stream. The output is then a little larger than it would be otherwise, and depends
+     *  on how the rows were grouped but not on the thread count. The whole filtered image is
+     *  held in memory while it is compressed.
+     *
+     *  Only used by Encode(). Encoders created with Make() ignore it.
+     *
+     *  Experimental.
+     */
+    SkExecutor* fExecutor = nullptr;
+
     /**
      *  Represents comments in the tEXt ancillary chunk of the png.
      *  The 2i-th entry is the keyword for the i-th comment,
@@ -43,6 +43,31 @@ struct SK_API Options {
     Compression fCompression = Compression::kLossy;
     float fQuality = 100.0f;
 
+    /**
+     *  |fMethod| must be in [0, 6], or negative to use the default.
+     *  It trades encoding speed for size: 0 is the fastest and 6 makes the smallest files.
+     *  The default is 3 for kLossy (4 if SK_WEBP_ENCODER_USE_DEFAULT_METHOD is defined) and
+     *  0 for kLossless.
+     *
+     *  For the most throughput, use fMethod = 0 with fUseThreads. With kLossless, also use a
+     *  low |fQuality|, which is the effort spent on top of |fMethod|.
+     */
+    int fMethod = -1;
+
+    /**
+     *  If true, libwebp may use another thread for parts of the encode (e.g. analyzing and
+     *  filtering lossy images, or trying several lossless transforms at once). The output is
+     *  the same either way.
+     */
+    bool fUseThreads = false;
+
+    /**
+     *  |fPartitions| must be in [0, 3]. kLossy images are written with 2^|fPartitions| token
+     *  partitions, which decoders can work on in parallel, at the cost of slightly larger
+     *  files. Ignored for kLossless.
+     */
+    int fPartitions = 0;
+
     /**
      * An optional ICC profile to override the default behavior.
      *
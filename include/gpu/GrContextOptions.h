@@ -142,6 +142,15 @@ struct SK_API GrContextOptions {
      */
     bool fDisableGpuYUVConversion = false;
 
+    /**
+     * If true, the transfer buffers that asyncRescaleAndReadPixels() and its YUV variants read
+     * into are kept in the resource cache once the client releases the AsyncReadResult, and
+     * later readbacks of a similar size reuse them instead of allocating. This suits clients
+     * that read back every frame, e.g. for screen capture. The buffers count against the
+     * resource cache budget and are purged like other scratch resources.
+     */
+    bool fRecycleReadbackTransferBuffers = false;
+
     /**
      * The maximum size of cache textures used for Skia's Glyph cache.
      */
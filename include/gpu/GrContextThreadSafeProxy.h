@@ -19,6 +19,7 @@
 class GrBackendFormat;
 class GrCaps;
 class GrContextThreadSafeProxyPriv;
+class GrProgramDescInterner;
 class GrSurfaceCharacterization;
 class GrThreadSafeCache;
 class GrThreadSafePipelineBuilder;
@@ -178,6 +179,7 @@ private:
     sk_sp<const GrCaps>                                     fCaps;
     std::unique_ptr<sktext::gpu::TextBlobRedrawCoordinator> fTextBlobRedrawCoordinator;
     std::unique_ptr<GrThreadSafeCache>                      fThreadSafeCache;
+    std::unique_ptr<GrProgramDescInterner>                  fProgramDescInterner;
     sk_sp<GrThreadSafePipelineBuilder>                      fPipelineBuilder;
     std::atomic<bool>                                       fAbandoned{false};
 };
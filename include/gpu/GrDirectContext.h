@@ -295,6 +295,18 @@ public:
      */
     void purgeUnlockedResources(GrPurgeResourceOptions opts);
 
+    /**
+     * Responds to memory pressure reported by the OS.
+     *
+     * With kModerate, unlocked resources are purged until budgeted usage is at most half of the
+     * resource cache limit. Victims are chosen in order of their estimated cost to recreate:
+     * scratch resources go first, then resources with persistent data in LRU order. Resources
+     * whose data had to be recreated soon after an earlier purge go last.
+     *
+     * With kCritical, this behaves like freeGpuResources().
+     */
+    void onMemoryPressure(GrMemoryPressureLevel);
+
     /**
      * Gets the maximum supported texture size.
      */
@@ -902,6 +914,24 @@ public:
     // Using cached shader blobs on a different device or driver are undefined.
     bool precompileShader(const SkData& key, const SkData& data);
 
+    // Bundles count key/data pairs saved in step #2 above into a single blob, so they can be
+    // shipped and precompiled with precompileShaders().
+    static sk_sp<SkData> MakeShaderManifest(const sk_sp<SkData> keys[],
+                                            const sk_sp<SkData> data[],
+                                            int count);
+
+    // Calls precompileShader for up to maxEntries of the key/data pairs in a manifest made by
+    // MakeShaderManifest, starting at firstEntry. Compiling every program at once can stall
+    // startup, so this lets the work be spread over several frames:
+    //
+    //     int next = 0;
+    //     while (int visited = context->precompileShaders(*manifest, next, 4)) { next += visited; }
+    //
+    // Returns the number of entries visited, which is zero once firstEntry is past the end or if
+    // the manifest is malformed. Entries that fail to compile (e.g. because they were recorded
+    // with a different driver) still count as visited.
+    int precompileShaders(const SkData& manifest, int firstEntry, int maxEntries);
+
 #ifdef SK_ENABLE_DUMP_GPU
     /** Returns a string with detailed information about the context & GPU, in JSON format. */
     SkString dump() const;
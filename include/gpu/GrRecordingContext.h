@@ -164,7 +164,7 @@ protected:
     const GrProxyProvider* proxyProvider() const { return fProxyProvider.get(); }
 
     struct ProgramData {
-        ProgramData(std::unique_ptr<const GrProgramDesc>, const GrProgramInfo*);
+        ProgramData(const GrProgramDesc*, const GrProgramInfo*);
         ProgramData(ProgramData&&);                     // for SkTArray
         ProgramData(const ProgramData&) = delete;
         ~ProgramData();
@@ -173,8 +173,9 @@ protected:
         const GrProgramInfo& info() const { return *fInfo; }
 
     private:
-        // TODO: store the GrProgramDescs in the 'fRecordTimeData' arena
-        std::unique_ptr<const GrProgramDesc> fDesc;
+        // The program descs are interned by the GrContextThreadSafeProxy, which the DDL keeps
+        // alive, so they are shared by every DDL that uses the same program.
+        const GrProgramDesc* fDesc = nullptr;
         // The program infos should be stored in 'fRecordTimeData' so do not need to be ref
         // counted or deleted in the destructor.
         const GrProgramInfo* fInfo = nullptr;
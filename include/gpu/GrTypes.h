@@ -236,6 +236,15 @@ enum class GrPurgeResourceOptions {
     kScratchResourcesOnly,
 };
 
+/**
+ * Memory pressure levels reported by the OS, e.g. Android's onTrimMemory() or iOS's memory
+ * warnings, that can be forwarded to GrDirectContext::onMemoryPressure().
+ */
+enum class GrMemoryPressureLevel {
+    kModerate,
+    kCritical,
+};
+
 enum class GrSyncCpu : bool {
     kNo = false,
     kYes = true,
@@ -22,6 +22,7 @@
 
 class SkColorSpace;
 class SkRuntimeEffect;
+class SkTaskGroup;
 class SkTraceMemoryDump;
 
 namespace skgpu::graphite {
@@ -157,6 +158,20 @@ public:
      */
     void dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const;
 
+    /**
+     * Returns the budgeted bytes of each ResourceCategory in the Context's cache, and how often
+     * resource lookups were served from the cache since the stats were last reset.
+     */
+    ResourceCacheStats resourceCacheStats() const;
+    void resetResourceCacheStats();
+
+    /**
+     * Limits the budgeted bytes of one ResourceCategory in the Context's cache, on top of the
+     * overall budget. Going over the limit purges the least recently used unlocked resources of
+     * that category. By default (SIZE_MAX) categories are only limited by the overall budget.
+     */
+    void setResourceCategoryBudget(ResourceCategory, size_t maxBytes);
+
     /*
      * Does this context support protected content?
      */
@@ -253,6 +268,8 @@ private:
     std::unique_ptr<ResourceProvider> fResourceProvider;
     std::unique_ptr<QueueManager> fQueueManager;
     std::unique_ptr<ClientMappedBufferManager> fMappedBufferManager;
+    // Runs Precompile()'s pipeline creation when ContextOptions::fExecutor is set.
+    std::unique_ptr<SkTaskGroup> fPrecompileTasks;
 
     // In debug builds we guard against improper thread handling. This guard is passed to the
     // ResourceCache for the Context.
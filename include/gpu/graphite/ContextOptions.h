@@ -8,9 +8,13 @@
 #ifndef skgpu_graphite_ContextOptions_DEFINED
 #define skgpu_graphite_ContextOptions_DEFINED
 
+#include "include/core/SkRefCnt.h"
 #include "include/private/base/SkAPI.h"
 #include "include/private/base/SkMath.h"
 
+class SkData;
+class SkExecutor;
+class SkString;
 namespace skgpu { class ShaderErrorHandler; }
 
 namespace skgpu::graphite {
@@ -33,6 +37,48 @@ struct SK_API ContextOptions {
      */
     skgpu::ShaderErrorHandler* fShaderErrorHandler = nullptr;
 
+    /**
+     * Abstract class which stores Skia data in a cache that persists between sessions. Graphite
+     * stores the backend shader code (MSL, WGSL or SPIR-V) it compiles for each pipeline, keyed
+     * by the SkSL it was compiled from, and on Vulkan the driver's pipeline cache data. With a
+     * warm cache, creating a pipeline skips the SkSL compiler, and on Vulkan most of the driver's
+     * compilation too.
+     *
+     * Cached data is only valid for the device and driver it was made with. Clients should use a
+     * separate cache per device, and clear it when the driver or Skia version changes.
+     */
+    class SK_API PersistentCache {
+    public:
+        virtual ~PersistentCache() = default;
+
+        /**
+         * Returns the data for the key if it exists in the cache, otherwise returns null.
+         */
+        virtual sk_sp<SkData> load(const SkData& key) = 0;
+
+        /**
+         * Stores data in the cache, indexed by key. description provides a human-readable
+         * version of the key.
+         */
+        virtual void store(const SkData& key, const SkData& data, const SkString& description) = 0;
+    };
+
+    /**
+     * If present, pipeline data is loaded from and stored to this cache. The client retains
+     * ownership, and it must outlive the Context. It may be called from any thread that creates
+     * pipelines, so it must be thread safe.
+     */
+    PersistentCache* fPersistentCache = nullptr;
+
+    /**
+     * If present, Precompile() creates the requested pipelines on this executor's threads and
+     * returns as soon as the combinations have been enumerated, instead of compiling them on the
+     * calling thread. Draws recorded before a pipeline lands compile it inline as usual. The
+     * client retains ownership, and it must outlive the Context, which waits for any pending
+     * compilation when it is destroyed.
+     */
+    SkExecutor* fExecutor = nullptr;
+
     /**
      * Specifies the number of samples Graphite should use when performing internal draws with MSAA
      * (hardware capabilities permitting).
@@ -41,6 +87,18 @@ struct SK_API ContextOptions {
      */
     int fInternalMultisampleCount = 4;
 
+    /**
+     * If true, and the Context supports rasterizing paths with compute shaders, then fills, strokes
+     * and hairlines that don't require MSAA are drawn from coverage masks rendered on the GPU into
+     * a path atlas, rather than tessellated or rasterized on the CPU, even when hardware MSAA is
+     * available. The masks for all of a Recorder's pending draws are rendered together. Paths that
+     * are larger than the atlas are still tessellated.
+     *
+     * When false, the compute atlas is only used for paths that are small enough to be cheaper to
+     * atlas, or when internal multisampling is disabled.
+     */
+    bool fPreferComputePathAtlas = false;
+
     /**
      * Will the client make sure to only ever be executing one thread that uses the Context and all
      * derived classes (e.g. Recorders, Recordings, etc.) at a time. If so we can possibly make some
@@ -103,6 +103,45 @@ enum class Volatile : bool {
     kYes = true               // fulfilled on every insertion call
 };
 
+/*
+ * The groups of GPU resources that Context and Recorder resource caches track, and can limit,
+ * separately.
+ */
+enum class ResourceCategory : int {
+    kRenderTarget,  // Textures that can be rendered to, including depth-stencil and MSAA
+                    // attachments.
+    kTexture,       // Textures that are only sampled or written by copies, including atlases.
+    kUploadBuffer,  // Buffers used to transfer data between the CPU and GPU.
+    kBuffer,        // All other buffers (vertex, index, uniform, storage, ...).
+    kOther,         // Everything else, e.g. samplers. These typically use no GPU memory.
+
+    kLast = kOther
+};
+static constexpr int kResourceCategoryCount = static_cast<int>(ResourceCategory::kLast) + 1;
+
+/*
+ * Statistics about the resources in a Context or Recorder's resource cache. The counters of scratch
+ * and shareable lookups, and of allocated and purged bytes, accumulate until they are reset, e.g.
+ * once per frame, to show how much the cache is churning.
+ */
+struct ResourceCacheStats {
+    // The budgeted bytes of the resources currently in the cache, by ResourceCategory.
+    size_t fBudgetedBytes[kResourceCategoryCount] = {};
+
+    // Lookups for resources that can only be used by one owner at a time (e.g. scratch textures),
+    // and whether a previously returned one was reused.
+    int fScratchHits = 0;
+    int fScratchMisses = 0;
+    // Lookups for resources that can be shared by all users (e.g. samplers, depth attachments).
+    int fShareableHits = 0;
+    int fShareableMisses = 0;
+
+    // The budgeted bytes of the resources that lookup misses had to create.
+    size_t fAllocatedBytes = 0;
+    // The bytes of the resources that were purged, to stay within a budget or by request.
+    size_t fPurgedBytes = 0;
+};
+
 /*
  * Graphite's different rendering methods each only apply to certain types of draws. This
  * enum supports decision-making regarding the different renderers and what is being drawn.
@@ -20,6 +20,7 @@
 
 struct AHardwareBuffer;
 class SkCanvas;
+class SkExecutor;
 struct SkImageInfo;
 class SkPixmap;
 class SkTraceMemoryDump;
@@ -70,6 +71,20 @@ struct SK_API RecorderOptions final {
     static constexpr size_t kDefaultRecorderBudget = 256 * (1 << 20);
     // What is the budget for GPU resources allocated and held by this Recorder.
     size_t fGpuBudgetInBytes = kDefaultRecorderBudget;
+
+    // If present, snap() uses this executor's threads to help sort the draws of large DrawPasses,
+    // and paths that fall back to CPU-rasterized coverage masks are drawn on them in batches. The
+    // Recorder still waits for that work to finish before it records the sorted draws or uploads
+    // the masks, so the Recording is the same as without it. The client retains ownership, and it
+    // must outlive the Recorder.
+    SkExecutor* fExecutor = nullptr;
+
+    // If true, a YUVA image drawn by this Recorder is converted to RGBA once, on its first draw,
+    // and later draws sample that single texture instead of converting every plane again (per
+    // filter tap, when drawn with cubic or mipmapped sampling). The RGBA texture, with mipmaps if a
+    // draw needed them, lives as long as the YUVA image and costs its size in extra GPU memory.
+    // This suits video frames that are drawn many times; frames drawn once are better off without.
+    bool fCacheYUVAConversions = false;
 };
 
 class SK_API Recorder final {
@@ -177,6 +192,20 @@ public:
      */
     void dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const;
 
+    /**
+     * Returns the budgeted bytes of each ResourceCategory in the Recorder's cache, and how often
+     * resource lookups were served from the cache since the stats were last reset.
+     */
+    ResourceCacheStats resourceCacheStats() const;
+    void resetResourceCacheStats();
+
+    /**
+     * Limits the budgeted bytes of one ResourceCategory in the Recorder's cache, on top of the
+     * overall budget. Going over the limit purges the least recently used unlocked resources of
+     * that category. By default (SIZE_MAX) categories are only limited by the overall budget.
+     */
+    void setResourceCategoryBudget(ResourceCategory, size_t maxBytes);
+
     // Provides access to functions that aren't part of the public API.
     RecorderPriv priv();
     const RecorderPriv priv() const;  // NOLINT(readability-const-return-type)
@@ -228,6 +257,8 @@ private:
     std::unique_ptr<sktext::gpu::StrikeCache> fStrikeCache;
     std::unique_ptr<sktext::gpu::TextBlobRedrawCoordinator> fTextBlobCache;
     sk_sp<ImageProvider> fClientImageProvider;
+    SkExecutor* fExecutor;
+    bool fCacheYUVAConversions;
 
     // In debug builds we guard against improper thread handling
     // This guard is passed to the ResourceCache.
@@ -88,6 +88,9 @@ private:
     std::unique_ptr<LazyProxyData> fTargetProxyData;
 
     skia_private::TArray<sk_sp<RefCntedCallback>> fFinishedProcs;
+
+    // Proxies this Recording uploads that other Recorders may share once it has been inserted.
+    skia_private::TArray<sk_sp<TextureProxy>> fSharedProxyUploads;
 };
 
 } // namespace skgpu::graphite
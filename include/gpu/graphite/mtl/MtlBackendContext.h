@@ -18,6 +18,10 @@ namespace skgpu::graphite {
 struct SK_API MtlBackendContext {
     sk_cfp<CFTypeRef> fDevice;
     sk_cfp<CFTypeRef> fQueue;
+    // Optional MTLBinaryArchive (macOS 11 / iOS 14 and later). Render pipelines are looked up in
+    // it before compiling, and every pipeline Graphite compiles, including through Precompile(),
+    // is added to it. The client can serialize the archive to skip those compiles on a later run.
+    sk_cfp<CFTypeRef> fBinaryArchive;
 };
 
 } // namespace skgpu::graphite
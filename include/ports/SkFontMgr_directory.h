@@ -18,4 +18,12 @@ class SkFontMgr;
  */
 SK_API sk_sp<SkFontMgr> SkFontMgr_New_Custom_Directory(const char* dir);
 
+/** Like SkFontMgr_New_Custom_Directory(dir), but keeps what it finds in each font file (family
+ *  names, styles, and face indices) in an index file at indexPath. When a font manager is created
+ *  with the same index, files whose size and modification time haven't changed aren't opened,
+ *  which makes directories with many fonts much faster to load. The index is rewritten whenever
+ *  a font file was added, changed, or removed. If indexPath is null, no index is used.
+ */
+SK_API sk_sp<SkFontMgr> SkFontMgr_New_Custom_Directory(const char* dir, const char* indexPath);
+
 #endif // SkFontMgr_directory_DEFINED
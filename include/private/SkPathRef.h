@@ -73,6 +73,7 @@ public:
         // The next two values don't matter unless fIsOval or fIsRRect are true.
         fRRectOrOvalIsCCW = false;
         fRRectOrOvalStartIdx = 0xAC;
+        this->resetAnalyses();
         SkDEBUGCODE(fEditorsAttached.store(0);)
 
         this->computeBounds();  // do this now, before we worry about multiple owners/threads
@@ -360,6 +361,7 @@ private:
         // The next two values don't matter unless fIsOval or fIsRRect are true.
         fRRectOrOvalIsCCW = false;
         fRRectOrOvalStartIdx = 0xAC;
+        this->resetAnalyses();
         if (numPoints > 0) {
             fPoints.reserve_exact(numPoints);
         }
@@ -420,6 +422,7 @@ private:
         fSegmentMask = 0;
         fIsOval = false;
         fIsRRect = false;
+        this->resetAnalyses();
     }
 
     /** Resets the path ref with verbCount verbs and pointCount points, all uninitialized. Also
@@ -498,6 +501,26 @@ private:
 
     void callGenIDChangeListeners();
 
+    // SkPath's convexity and first-direction analyses only depend on the points and verbs, so
+    // their results are cached here and shared by every SkPath that shares this ref. The values
+    // are SkPathConvexity and SkPathFirstDirection, which both use 2 for kUnknown.
+    static constexpr uint8_t kUnknownAnalysis = 2;
+
+    uint8_t getCachedConvexity() const { return fCachedConvexity.load(std::memory_order_relaxed); }
+    void setCachedConvexity(uint8_t c) const {
+        fCachedConvexity.store(c, std::memory_order_relaxed);
+    }
+    uint8_t getCachedFirstDirection() const {
+        return fCachedFirstDirection.load(std::memory_order_relaxed);
+    }
+    void setCachedFirstDirection(uint8_t d) const {
+        fCachedFirstDirection.store(d, std::memory_order_relaxed);
+    }
+    void resetAnalyses() {
+        this->setCachedConvexity(kUnknownAnalysis);
+        this->setCachedFirstDirection(kUnknownAnalysis);
+    }
+
     enum {
         kMinSize = 256,
     };
@@ -527,6 +550,9 @@ private:
     uint8_t  fRRectOrOvalStartIdx;
     uint8_t  fSegmentMask;
 
+    mutable std::atomic<uint8_t> fCachedConvexity;
+    mutable std::atomic<uint8_t> fCachedFirstDirection;
+
     friend class PathRefTest_Private;
     friend class ForceIsRRect_Private; // unit test isRRect
     friend class SkPath;
@@ -20,6 +20,10 @@ public:
     // The bytes allocated are freed using sk_free().
     SkSpan<std::byte> allocate(int capacity, double growthFactor = 1.0);
 
+    // reallocate resizes ptr, which is null or came from allocate() or reallocate(), keeping its
+    // contents like realloc(). It will abort on failure, and capacity must be greater than 0.
+    SkSpan<std::byte> reallocate(void* ptr, int capacity, double growthFactor = 1.0);
+
 private:
     friend struct SkContainerAllocatorTestingPeer;
     // All capacity counts will be rounded up to kCapacityMultiple.
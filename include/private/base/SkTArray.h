@@ -399,6 +399,8 @@ public:
             sk_free(fData);
             fData = nullptr;
             fCapacity = 0;
+        } else if constexpr (MEM_MOVE) {
+            this->setDataFromBytes(Reallocate(fData, fSize));
         } else {
             SkSpan<std::byte> allocation = Allocate(fSize);
             this->move(TCast(allocation.data()));
@@ -559,6 +561,11 @@ private:
         return SkContainerAllocator{sizeof(T), kMaxCapacity}.allocate(capacity, growthFactor);
     }
 
+    static SkSpan<std::byte> Reallocate(void* data, int capacity, double growthFactor = 1.0) {
+        return SkContainerAllocator{sizeof(T), kMaxCapacity}.reallocate(data, capacity,
+                                                                         growthFactor);
+    }
+
     void initData(int count) {
         this->setDataFromBytes(Allocate(count));
         fSize = count;
@@ -623,6 +630,17 @@ private:
 
     template <typename... Args>
     SK_ALWAYS_INLINE T* growAndConstructAtEnd(Args&&... args) {
+        if constexpr (MEM_MOVE) {
+            if (fOwnMemory) {
+                // The arguments may refer to elements of this array, so construct the new element
+                // before the storage moves, then relocate it into place.
+                alignas(T) std::byte element[sizeof(T)];
+                new (element) T(std::forward<Args>(args)...);
+                this->setDataFromBytes(Reallocate(fData, this->checkedCount(1), kGrowing));
+                memcpy(static_cast<void*>(fData + fSize), element, sizeof(T));
+                return fData + fSize;
+            }
+        }
         SkSpan<std::byte> buffer = this->preallocateNewData(/*delta=*/1, kGrowing);
         T* newT = new (TCast(buffer.data()) + fSize) T(std::forward<Args>(args)...);
         this->installDataAndUpdateCapacity(buffer);
@@ -637,12 +655,21 @@ private:
 
         // Check if there are enough remaining allocated elements to satisfy the request.
         if (this->capacity() - fSize < delta) {
-            // Looks like we need to reallocate.
+            // Looks like we need to reallocate. Elements that can be moved with memcpy let the
+            // allocator grow the block in place, or remap it, instead of holding two copies.
+            if constexpr (MEM_MOVE) {
+                if (fOwnMemory) {
+                    this->setDataFromBytes(
+                            Reallocate(fData, this->checkedCount(delta), growthFactor));
+                    return;
+                }
+            }
             this->installDataAndUpdateCapacity(this->preallocateNewData(delta, growthFactor));
         }
     }
 
-    SkSpan<std::byte> preallocateNewData(int delta, double growthFactor) {
+    // Returns fSize + delta, which must fit in the array.
+    int checkedCount(int delta) const {
         SkASSERT(delta >= 0);
         SkASSERT(fSize >= 0);
         SkASSERT(fCapacity >= 0);
@@ -654,9 +681,11 @@ private:
         if (delta > kMaxCapacity - fSize) {
             sk_report_container_overflow_and_die();
         }
-        const int newCount = fSize + delta;
+        return fSize + delta;
+    }
 
-        return Allocate(newCount, growthFactor);
+    SkSpan<std::byte> preallocateNewData(int delta, double growthFactor) {
+        return Allocate(this->checkedCount(delta), growthFactor);
     }
 
     void installDataAndUpdateCapacity(SkSpan<std::byte> allocation) {
@@ -10,6 +10,7 @@
 
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypes.h"
+#include "include/gpu/GrContextThreadSafeProxy.h"
 #include "include/gpu/GrRecordingContext.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/chromium/GrSurfaceCharacterization.h"
@@ -90,6 +91,8 @@ private:
     skia_private::TArray<sk_sp<GrRenderTask>>   fRenderTasks;
 
     skia_private::TArray<GrRecordingContext::ProgramData> fProgramData;
+    // Owns the program descs that fProgramData points to.
+    sk_sp<GrContextThreadSafeProxy> fThreadSafeProxy;
     sk_sp<GrRenderTargetProxy>      fTargetProxy;
     sk_sp<LazyProxyData>            fLazyProxyData;
 };
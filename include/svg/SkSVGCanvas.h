@@ -23,6 +23,10 @@ public:
         kConvertTextToPaths_Flag   = 0x01, // emit text as <path>s
         kNoPrettyXML_Flag          = 0x02, // suppress newlines and tabs in output
         kRelativePathEncoding_Flag = 0x04, // use relative commands for path encoding
+        kCompactPathEncoding_Flag  = 0x08, // leave out what path data doesn't need, like repeated
+                                           // commands and leading zeros
+        kDeduplicateResources_Flag = 0x10, // write repeated paths, gradients and clips once, and
+                                           // refer back to them
     };
 
     /**
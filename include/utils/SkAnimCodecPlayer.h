@@ -12,16 +12,31 @@
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSize.h"
+#include "include/private/base/SkMutex.h"
+#include "include/private/base/SkThreadAnnotations.h"
 
 #include <cstdint>
 #include <memory>
 #include <vector>
 
+class SkExecutor;
 class SkImage;
+class SkTaskGroup;
 
+/**
+ *  Decoded frames are kept in the global SkResourceCache, so the memory used by all the players
+ *  in a process is bounded by its budget. Frames that were purged are decoded again when needed,
+ *  starting from the closest frame they depend on that is still around. The most recently decoded
+ *  independent frame (one that doesn't depend on earlier frames) is kept by the player, so that
+ *  is never further back than the start of the current run of dependent frames.
+ */
 class SkAnimCodecPlayer {
 public:
-    SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec);
+    /**
+     *  If prefetchExecutor is not null, each call to getFrame() also decodes the following frame
+     *  into the cache on prefetchExecutor, which must outlive the player.
+     */
+    SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec, SkExecutor* prefetchExecutor = nullptr);
     ~SkAnimCodecPlayer();
 
     /**
@@ -53,14 +68,26 @@ public:
 
 
 private:
-    std::unique_ptr<SkCodec>        fCodec;
+    SkMutex                         fMutex;
+    std::unique_ptr<SkCodec>        fCodec SK_GUARDED_BY(fMutex);
     SkImageInfo                     fImageInfo;
+    SkEncodedOrigin                 fOrigin;
     std::vector<SkCodec::FrameInfo> fFrameInfos;
-    std::vector<sk_sp<SkImage> >    fImages;
+    // Keys this player's frames in the SkResourceCache.
+    const uint32_t                  fUniqueID;
+    sk_sp<SkImage>                  fStaticImage;
+    sk_sp<SkImage>                  fCurrImage;
     int                             fCurrIndex = 0;
+    sk_sp<SkImage>                  fKeyframe SK_GUARDED_BY(fMutex);
+    int                             fKeyframeIndex SK_GUARDED_BY(fMutex) = SkCodec::kNoFrame;
     uint32_t                        fTotalDuration;
+    std::unique_ptr<SkTaskGroup>    fPrefetchTasks;
+    int                             fPrefetchIndex = SkCodec::kNoFrame;
 
-    sk_sp<SkImage> getFrameAt(int index);
+    sk_sp<SkImage> findFrame(int index) const SK_REQUIRES(fMutex);
+    sk_sp<SkImage> getFrameAt(int index) SK_REQUIRES(fMutex);
+    sk_sp<SkImage> decodeFrame(int index, const sk_sp<SkImage>& requiredImage)
+            SK_REQUIRES(fMutex);
 };
 
 #endif
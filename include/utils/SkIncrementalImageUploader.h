@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkIncrementalImageUploader_DEFINED
+#define SkIncrementalImageUploader_DEFINED
+
+#include "include/codec/SkCodec.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypes.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class SkImage;
+class SkSurface;
+
+/**
+ *  Decodes an image whose encoded data arrives over time (e.g. from the network) straight into
+ *  a GPU surface, so that it can be drawn while it is still loading.
+ *
+ *  The codec decodes into a CPU copy of the image, which is split into bands of rows. After each
+ *  call to decode(), only the bands whose pixels changed are written to the surface. Rows that
+ *  are rewritten by later passes, as happens with interlaced PNGs and GIFs, are uploaded again;
+ *  rows that haven't been reached yet are never uploaded.
+ *
+ *  Works with any surface that supports writePixels(), which includes Ganesh and Graphite ones.
+ */
+class SK_API SkIncrementalImageUploader {
+public:
+    /**
+     *  The codec's stream is read as far as it goes on each call to decode(), so it should report
+     *  the data received so far and return more of it later on.
+     *
+     *  The surface must have the same dimensions as the codec. Its color type and alpha type are
+     *  the ones decoded to. It is transparent black wherever the image hasn't been decoded yet.
+     *
+     *  Returns null if either is null or their dimensions differ. A codec that can't decode to
+     *  the surface's SkImageInfo makes decode() return kInvalidConversion.
+     */
+    static std::unique_ptr<SkIncrementalImageUploader> Make(std::unique_ptr<SkCodec>,
+                                                            sk_sp<SkSurface>);
+
+    ~SkIncrementalImageUploader();
+
+    /**
+     *  Decodes as much of the image as the data received so far allows, and uploads what changed.
+     *
+     *  Returns kIncompleteInput if more data is needed, in which case decode() should be called
+     *  again once it has arrived, kSuccess once the whole image has been decoded, or the error
+     *  that stopped the decode.
+     */
+    SkCodec::Result decode();
+
+    /**
+     *  Returns a snapshot of the surface with everything decoded so far. The same image is
+     *  returned until decode() uploads something new.
+     *
+     *  If the previous image is still referenced when decode() uploads, the surface copies its
+     *  contents before writing to them, so callers should drop it once they have drawn it.
+     */
+    sk_sp<SkImage> image();
+
+    /**
+     *  The number of bands that have been written to the surface, for tests.
+     */
+    int uploadedBandCount() const { return fUploadedBandCount; }
+
+private:
+    SkIncrementalImageUploader(std::unique_ptr<SkCodec>, sk_sp<SkSurface>, const SkImageInfo&);
+
+    // Hashes each band of fPixels and writes those that changed to fSurface.
+    void uploadChangedBands();
+
+    std::unique_ptr<SkCodec> fCodec;
+    sk_sp<SkSurface>         fSurface;
+    SkBitmap                 fPixels;
+    std::vector<uint32_t>    fBandHashes;
+    sk_sp<SkImage>           fImage;
+    int                      fUploadedBandCount = 0;
+    bool                     fStarted = false;
+    // Set for codecs that don't support incremental decoding, which are decoded with getPixels()
+    // from the start on each call instead.
+    bool                     fDecodeWholeImage = false;
+    // What decode() returns once nothing more will be decoded.
+    SkCodec::Result          fResult = SkCodec::kIncompleteInput;
+};
+
+#endif  // SkIncrementalImageUploader_DEFINED
@@ -20,6 +20,12 @@ public:
 
     enum class PathEncoding { Absolute, Relative };
     static SkString ToSVGString(const SkPath&, PathEncoding = PathEncoding::Absolute);
+
+    /** Like ToSVGString(), but as short as the SVG path grammar allows at the same precision:
+        repeated commands are left implied, and numbers drop leading zeros, and the separators
+        that their signs or decimal points make redundant.
+     */
+    static SkString ToCompactSVGString(const SkPath&, PathEncoding = PathEncoding::Absolute);
 };
 
 #endif
@@ -0,0 +1,26 @@
+// Copyright 2023 Google LLC
+// Use of this source code is governed by a BSD-style license that can be found in the LICENSE file.
+
+#ifndef PolygonOps_DEFINED
+#define PolygonOps_DEFINED
+
+#include "include/core/SkPath.h"
+#include "include/pathops/SkPathOps.h"
+
+#include <optional>
+
+namespace bentleyottmann {
+
+// Boolean operations on polygons, mirroring Op() and Simplify() from SkPathOps. Curves are
+// flattened to lines, and all points are snapped to a grid of 1/256 of a unit before the
+// crossings are found, so the results are always polygonal and made of non-overlapping contours
+// wound clockwise around filled areas and counter-clockwise around holes.
+//
+// A return value of nullopt means that a path is not finite, or its coordinates are too large to
+// snap to the grid.
+std::optional<SkPath> polygon_op(const SkPath& one, const SkPath& two, SkPathOp op);
+
+std::optional<SkPath> polygon_simplify(const SkPath& path);
+}  // namespace bentleyottmann
+
+#endif  // PolygonOps_DEFINED
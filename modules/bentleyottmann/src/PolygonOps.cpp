@@ -0,0 +1,543 @@
+// Copyright 2023 Google LLC
+// Use of this source code is governed by a BSD-style license that can be found in the LICENSE file.
+
+#include "modules/bentleyottmann/include/PolygonOps.h"
+
+#include "include/core/SkPathTypes.h"
+#include "include/core/SkPoint.h"
+#include "include/private/base/SkAssert.h"
+#include "include/private/base/SkFloatingPoint.h"
+#include "include/private/base/SkTPin.h"
+#include "modules/bentleyottmann/include/Point.h"
+#include "modules/bentleyottmann/include/Segment.h"
+#include "src/core/SkGeometry.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <queue>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace bentleyottmann {
+namespace {
+// Points are snapped to a grid with this many cells per unit.
+constexpr float kGridScale = 256;
+
+// Keeps snapped coordinates small enough that the difference between any two of them fits in an
+// int32_t, as the event queue requires.
+constexpr float kMaxGridCoordinate = 1 << 29;
+
+// Curves are flattened until the lines are within this distance of the curve.
+constexpr float kFlattenTolerance = 1.f / 16;
+constexpr int kMaxLinesPerCurve = 1024;
+
+// Gives up on input where rounding the crossings keeps creating new ones.
+constexpr int kMaxRoundsPerBand = 1024;
+
+struct Edge {
+    // Always runs from the segment's upper point to its lower point.
+    Segment segment;
+    // +1 if the path runs downwards along the segment, -1 if it runs upwards.
+    int winding;
+    // 0 for the first operand and 1 for the second.
+    int operand;
+    // Identifies the edge's current geometry, which changes whenever the edge is bent to pass
+    // through a crossing.
+    size_t id = 0;
+};
+
+std::optional<Point> snap(SkPoint p) {
+    const float x = p.fX * kGridScale,
+                y = p.fY * kGridScale;
+    if (!(std::abs(x) <= kMaxGridCoordinate && std::abs(y) <= kMaxGridCoordinate)) {
+        return std::nullopt;
+    }
+    return Point{sk_float_round2int(x), sk_float_round2int(y)};
+}
+
+bool add_line(SkPoint p0, SkPoint p1, int operand, std::vector<Edge>* edges) {
+    std::optional<Point> s0 = snap(p0),
+                         s1 = snap(p1);
+    if (!s0 || !s1) {
+        return false;
+    }
+    if (*s0 != *s1) {
+        auto [upper, lower] = std::minmax(*s0, *s1);
+        edges->push_back({{upper, lower}, *s0 < *s1 ? 1 : -1, operand});
+    }
+    return true;
+}
+
+// Wang's formula for the number of lines needed to flatten a Bézier curve of the given degree.
+int lines_for_curve(const SkPoint pts[], int degree) {
+    float maxLength = 0;
+    for (int i = 0; i + 2 <= degree; ++i) {
+        maxLength = std::max(maxLength, (pts[i] - pts[i + 1] * 2 + pts[i + 2]).length());
+    }
+    float lines = std::sqrt(degree * (degree - 1) / 8.f * maxLength / kFlattenTolerance);
+    return SkTPin(sk_float_ceil2int(lines), 1, kMaxLinesPerCurve);
+}
+
+bool add_curve(const SkPoint pts[], int degree, int operand, std::vector<Edge>* edges) {
+    const int lines = lines_for_curve(pts, degree);
+    SkPoint prev = pts[0];
+    for (int i = 1; i <= lines; ++i) {
+        SkPoint next = pts[degree];
+        if (i < lines) {
+            const float t = static_cast<float>(i) / lines;
+            if (degree == 2) {
+                next = SkEvalQuadAt(pts, t);
+            } else {
+                SkEvalCubicAt(pts, t, &next, nullptr, nullptr);
+            }
+        }
+        if (!add_line(prev, next, operand, edges)) {
+            return false;
+        }
+        prev = next;
+    }
+    return true;
+}
+
+bool add_path(const SkPath& path, int operand, std::vector<Edge>* edges) {
+    if (!path.isFinite()) {
+        return false;
+    }
+
+    // Force closed contours, since the path is going to be filled.
+    SkPath::Iter iter(path, true);
+    SkPoint pts[4];
+    for (SkPath::Verb verb; (verb = iter.next(pts)) != SkPath::kDone_Verb;) {
+        switch (verb) {
+            case SkPath::kLine_Verb:
+                if (!add_line(pts[0], pts[1], operand, edges)) {
+                    return false;
+                }
+                break;
+            case SkPath::kQuad_Verb:
+                if (!add_curve(pts, 2, operand, edges)) {
+                    return false;
+                }
+                break;
+            case SkPath::kConic_Verb: {
+                SkAutoConicToQuads quadder;
+                const SkPoint* quads =
+                        quadder.computeQuads(pts, iter.conicWeight(), kFlattenTolerance);
+                for (int i = 0; i < quadder.countQuads(); ++i) {
+                    if (!add_curve(quads + 2 * i, 2, operand, edges)) {
+                        return false;
+                    }
+                }
+                break;
+            }
+            case SkPath::kCubic_Verb:
+                if (!add_curve(pts, 3, operand, edges)) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return true;
+}
+
+double x_at(const Edge& edge, int32_t y) {
+    const Point upper = edge.segment.upper(),
+                lower = edge.segment.lower();
+    // Return the end points exactly, so that edges meeting at a point agree on where it is.
+    if (y == upper.y) {
+        return upper.x;
+    }
+    if (y == lower.y) {
+        return lower.x;
+    }
+    return upper.x + static_cast<double>(lower.x - upper.x) *
+                     (static_cast<double>(y) - upper.y) / (static_cast<double>(lower.y) - upper.y);
+}
+
+class Operands {
+public:
+    Operands(const SkPath& one, const SkPath& two, SkPathOp op) : fOp{op} {
+        const SkPath* paths[] = {&one, &two};
+        for (int i = 0; i < 2; ++i) {
+            fEvenOdd[i] = paths[i]->getFillType() == SkPathFillType::kEvenOdd ||
+                          paths[i]->getFillType() == SkPathFillType::kInverseEvenOdd;
+            fInverse[i] = paths[i]->isInverseFillType();
+        }
+    }
+
+    bool contains(const int winding[2]) const {
+        bool in[2];
+        for (int i = 0; i < 2; ++i) {
+            in[i] = (fEvenOdd[i] ? (winding[i] & 1) != 0 : winding[i] != 0) != fInverse[i];
+        }
+        switch (fOp) {
+            case kDifference_SkPathOp:        return in[0] && !in[1];
+            case kIntersect_SkPathOp:         return in[0] && in[1];
+            case kUnion_SkPathOp:             return in[0] || in[1];
+            case kXOR_SkPathOp:               return in[0] != in[1];
+            case kReverseDifference_SkPathOp: return in[1] && !in[0];
+        }
+        SkUNREACHABLE;
+    }
+
+private:
+    const SkPathOp fOp;
+    bool fEvenOdd[2];
+    bool fInverse[2];
+};
+
+// A point on the boundary of the result. The x coordinates are exact where edges meet, and
+// otherwise are computed the same way by every band that shares them.
+using Vertex = std::pair<int32_t, double>;
+
+// Collects the directed boundary of the result as it is found band by band, then links it into
+// contours. The boundary runs with the filled area on its right.
+class Boundary {
+public:
+    // Marks the horizontal parts of the boundary, which don't come from any edge.
+    static constexpr size_t kNoSource = SIZE_MAX;
+
+    // The pieces of a boundary with the same source are parts of the same straight line, so the
+    // vertices between them are dropped.
+    void addEdge(Vertex from, Vertex to, size_t source = kNoSource) {
+        fOutgoing[from].push_back(fEdges.size());
+        fEdges.push_back({from, to, source, false});
+    }
+
+    // Adds the horizontal boundary at y between the filled spans of the band above and the band
+    // below.
+    void addHorizontals(int32_t y,
+                        const std::vector<std::pair<double, double>>& above,
+                        const std::vector<std::pair<double, double>>& below) {
+        // Each event toggles whether the band above (bit 0) or below (bit 1) is filled.
+        std::vector<std::pair<double, int>> events;
+        events.reserve(2 * (above.size() + below.size()));
+        for (auto [left, right] : above) {
+            events.push_back({left, 1});
+            events.push_back({right, 1});
+        }
+        for (auto [left, right] : below) {
+            events.push_back({left, 2});
+            events.push_back({right, 2});
+        }
+        std::sort(events.begin(), events.end());
+
+        int state = 0;
+        double runStart = 0;
+        int runState = 0;
+        for (size_t i = 0; i < events.size();) {
+            const double x = events[i].first;
+            for (; i < events.size() && events[i].first == x; ++i) {
+                state ^= events[i].second;
+            }
+            // Only the band above or below filled means there is a boundary.
+            const int boundaryState = state == 1 || state == 2 ? state : 0;
+            if (boundaryState != runState) {
+                this->addHorizontal(y, runStart, x, runState);
+                runStart = x;
+                runState = boundaryState;
+            }
+        }
+        SkASSERT(runState == 0);
+    }
+
+    SkPath makePath(bool inverse) {
+        SkPath path;
+        std::vector<Vertex> contour;
+        for (size_t first = 0; first < fEdges.size(); ++first) {
+            if (fEdges[first].used) {
+                continue;
+            }
+            contour.clear();
+            const Vertex start = fEdges[first].from;
+            contour.push_back(start);
+            for (size_t current = first;;) {
+                fEdges[current].used = true;
+                const Vertex to = fEdges[current].to;
+                if (to == start) {
+                    if (this->continues(current, first) && contour.size() > 1) {
+                        contour.erase(contour.begin());
+                    }
+                    break;
+                }
+                std::optional<size_t> next = this->nextUnused(to);
+                if (!next) {
+                    // The boundary is balanced at every vertex, so this should not happen.
+                    SkDEBUGFAIL("Unlinked boundary edge.");
+                    contour.push_back(to);
+                    break;
+                }
+                if (!this->continues(current, *next)) {
+                    contour.push_back(to);
+                }
+                current = *next;
+            }
+            add_contour(contour, &path);
+        }
+        path.setFillType(inverse ? SkPathFillType::kInverseWinding : SkPathFillType::kWinding);
+        return path;
+    }
+
+private:
+    struct DirectedEdge {
+        Vertex from;
+        Vertex to;
+        size_t source;
+        bool used;
+    };
+
+    bool continues(size_t edge, size_t next) const {
+        return fEdges[edge].source != kNoSource && fEdges[edge].source == fEdges[next].source;
+    }
+
+    void addHorizontal(int32_t y, double left, double right, int state) {
+        if (state == 2) {
+            // Only the band below is filled, so this is the top of a filled area.
+            this->addEdge({y, left}, {y, right});
+        } else if (state == 1) {
+            this->addEdge({y, right}, {y, left});
+        }
+    }
+
+    std::optional<size_t> nextUnused(const Vertex& v) {
+        std::vector<size_t>& outgoing = fOutgoing[v];
+        while (!outgoing.empty()) {
+            size_t edge = outgoing.back();
+            outgoing.pop_back();
+            if (!fEdges[edge].used) {
+                return edge;
+            }
+        }
+        return std::nullopt;
+    }
+
+    static void add_contour(const std::vector<Vertex>& contour, SkPath* path) {
+        const size_t n = contour.size();
+        auto vec = [&](size_t from, size_t to) {
+            return std::make_pair(contour[to].second - contour[from].second,
+                                  static_cast<double>(contour[to].first) - contour[from].first);
+        };
+
+        // Drop the vertices in the middle of straight runs, and skip contours with no area.
+        std::vector<SkPoint> points;
+        double area = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const size_t prev = (i + n - 1) % n,
+                         next = (i + 1) % n;
+            auto [x0, y0] = vec(prev, i);
+            auto [x1, y1] = vec(i, next);
+            area += contour[i].second * contour[next].first -
+                    contour[next].second * contour[i].first;
+            if (x0 * y1 - y0 * x1 == 0 && x0 * x1 + y0 * y1 > 0) {
+                continue;
+            }
+            points.push_back({static_cast<float>(contour[i].second / kGridScale),
+                              static_cast<float>(contour[i].first / kGridScale)});
+        }
+        if (area == 0 || points.size() < 3) {
+            return;
+        }
+        path->addPoly(points.data(), points.size(), true);
+    }
+
+    std::vector<DirectedEdge> fEdges;
+    std::map<Vertex, std::vector<size_t>> fOutgoing;
+};
+
+// Sweeps the edges from top to bottom, in bands between successive end point y values. Edges
+// that cross inside a band are split at the crossing, and the band is narrowed to end there. Once
+// no edges cross inside it, the filled spans of a band are found by ordering its edges from left
+// to right and accumulating their winding.
+std::optional<SkPath> sweep(std::vector<Edge> edges, const Operands& operands) {
+    const int noWinding[2] = {0, 0};
+    // Filling the result's outside, for inverse results, is done by tracing the boundary of the
+    // area that differs from the outside.
+    const bool outside = operands.contains(noWinding);
+
+    // Edges waiting to join the sweep, and the y values where the sweep has to stop, smallest
+    // first. Horizontal edges are dropped since they don't change the winding of any span.
+    using Pending = std::pair<int32_t, size_t>;
+    std::priority_queue<Pending, std::vector<Pending>, std::greater<Pending>> pending;
+    std::priority_queue<int32_t, std::vector<int32_t>, std::greater<int32_t>> stops;
+    size_t nextId = 0;
+    auto addEdge = [&](const Edge& edge) {
+        const Point upper = edge.segment.upper(),
+                    lower = edge.segment.lower();
+        if (upper.y != lower.y) {
+            pending.push({upper.y, edges.size()});
+            stops.push(upper.y);
+            stops.push(lower.y);
+            edges.push_back(edge);
+            edges.back().id = nextId++;
+        }
+    };
+    const size_t edgeCount = edges.size();
+    for (size_t i = 0; i < edgeCount; ++i) {
+        addEdge(edges[i]);
+    }
+
+    // Makes the active edge pass through p, which has been rounded to the grid from a crossing
+    // inside the current band. If p is on the edge's first or last row, that end point is moved
+    // along its row; the gap this leaves doesn't change the winding of any span. Otherwise the
+    // edge is split at p, and its lower part is queued.
+    auto passThrough = [&](size_t index, Point p) {
+        const Point upper = edges[index].segment.upper(),
+                    lower = edges[index].segment.lower();
+        SkASSERT(upper.y <= p.y && p.y <= lower.y);
+        // Pieces of the boundary found before this band followed the old line.
+        edges[index].id = nextId++;
+        if (p.y == upper.y) {
+            edges[index].segment = {p, lower};
+        } else if (p.y == lower.y) {
+            edges[index].segment = {upper, p};
+        } else {
+            Edge lowerPart = edges[index];
+            lowerPart.segment = {p, lower};
+            edges[index].segment = {upper, p};
+            addEdge(lowerPart);
+        }
+    };
+
+    Boundary boundary;
+    std::vector<size_t> active;
+    // The x of each active edge at the top and bottom of the band, and the edge's index.
+    std::vector<std::tuple<double, double, size_t>> ordered;
+    std::vector<std::pair<double, double>> spansAbove, spansBelow, nextSpansAbove;
+    while (!stops.empty()) {
+        const int32_t y = stops.top();
+        while (!stops.empty() && stops.top() <= y) {
+            stops.pop();
+        }
+
+        active.erase(std::remove_if(active.begin(), active.end(), [&](size_t edge) {
+                         return edges[edge].segment.lower().y <= y;
+                     }), active.end());
+        for (; !pending.empty() && pending.top().first <= y; pending.pop()) {
+            active.push_back(pending.top().second);
+        }
+
+        spansBelow.clear();
+        nextSpansAbove.clear();
+        if (!stops.empty() && !active.empty()) {
+            int32_t nextY;
+            for (int rounds = 0;; ) {
+                // Crossings that rounded onto or above this y don't limit the band.
+                while (stops.top() <= y) {
+                    stops.pop();
+                }
+                nextY = stops.top();
+                ordered.clear();
+                for (size_t edge : active) {
+                    ordered.push_back({x_at(edges[edge], y), x_at(edges[edge], nextY), edge});
+                }
+                // The active edges are kept in the order of the previous band, which only
+                // differs by the edges that crossed or joined, so an insertion sort is close to
+                // linear.
+                for (size_t i = 1; i < ordered.size(); ++i) {
+                    for (size_t j = i; j > 0 && ordered[j] < ordered[j - 1]; --j) {
+                        std::swap(ordered[j], ordered[j - 1]);
+                    }
+                }
+
+                // Neighbors at the top of the band that swap places by the bottom cross inside
+                // it. Both are bent to meet at the crossing, which ends the band there.
+                bool crossed = false;
+                for (size_t i = 0; i + 1 < ordered.size(); ++i) {
+                    auto [top0, bottom0, e0] = ordered[i];
+                    auto [top1, bottom1, e1] = ordered[i + 1];
+                    if (!(top0 < top1 && bottom0 > bottom1)) {
+                        continue;
+                    }
+                    std::optional<Point> p = intersect(edges[e0].segment, edges[e1].segment);
+                    if (!p) {
+                        // The exact test disagrees about the crossing being strictly inside both
+                        // segments, so estimate it from the band.
+                        const double t = (top1 - top0) / ((top1 - top0) + (bottom0 - bottom1));
+                        p = Point{sk_double_round2int(top0 + t * (bottom0 - top0)),
+                                  sk_double_round2int(y + t * (nextY - y))};
+                    }
+                    p->y = std::clamp(p->y, y, nextY);
+                    passThrough(e0, *p);
+                    passThrough(e1, *p);
+                    stops.push(p->y);
+                    crossed = true;
+                    // Skip the other neighbor of e1, since it will be checked again next round.
+                    ++i;
+                }
+                if (!crossed) {
+                    break;
+                }
+                if (++rounds > kMaxRoundsPerBand) {
+                    return std::nullopt;
+                }
+                // Crossings rounded onto (or above) this y start their lower parts right away.
+                for (; !pending.empty() && pending.top().first <= y; pending.pop()) {
+                    active.push_back(pending.top().second);
+                }
+                active.erase(std::remove_if(active.begin(), active.end(), [&](size_t edge) {
+                                 return edges[edge].segment.lower().y <= y;
+                             }), active.end());
+            }
+
+            int winding[2] = {0, 0};
+            bool inside = false;
+            double spanTop = 0,
+                   spanBottom = 0;
+            for (auto [top, bottom, edge] : ordered) {
+                winding[edges[edge].operand] += edges[edge].winding;
+                const bool nowInside = operands.contains(winding) != outside;
+                if (nowInside == inside) {
+                    continue;
+                }
+                if (nowInside) {
+                    // The left side of a filled span runs upwards.
+                    boundary.addEdge({nextY, bottom}, {y, top}, edges[edge].id);
+                    spanTop = top;
+                    spanBottom = bottom;
+                } else {
+                    boundary.addEdge({y, top}, {nextY, bottom}, edges[edge].id);
+                    spansBelow.push_back({spanTop, top});
+                    nextSpansAbove.push_back({spanBottom, bottom});
+                }
+                inside = nowInside;
+            }
+            // Every contour is closed, so the winding is back to zero on the right.
+            SkASSERT(!inside);
+
+            for (size_t i = 0; i < ordered.size(); ++i) {
+                active[i] = std::get<2>(ordered[i]);
+            }
+        }
+
+        boundary.addHorizontals(y, spansAbove, spansBelow);
+        std::swap(spansAbove, nextSpansAbove);
+    }
+
+    return boundary.makePath(outside);
+}
+
+std::optional<SkPath> boolean_op(const SkPath& one, const SkPath& two, SkPathOp op) {
+    std::vector<Edge> edges;
+    if (!add_path(one, 0, &edges) || !add_path(two, 1, &edges)) {
+        return std::nullopt;
+    }
+
+    return sweep(std::move(edges), Operands{one, two, op});
+}
+}  // namespace
+
+std::optional<SkPath> polygon_op(const SkPath& one, const SkPath& two, SkPathOp op) {
+    return boolean_op(one, two, op);
+}
+
+std::optional<SkPath> polygon_simplify(const SkPath& path) {
+    // The union with an empty path is the area the path fills.
+    return boolean_op(path, SkPath{}, kUnion_SkPathOp);
+}
+}  // namespace bentleyottmann
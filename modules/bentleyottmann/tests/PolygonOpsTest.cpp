@@ -0,0 +1,144 @@
+// Copyright 2023 Google LLC
+// Use of this source code is governed by a BSD-style license that can be found in the LICENSE file.
+
+#include "modules/bentleyottmann/include/PolygonOps.h"
+
+#include "include/core/SkPath.h"
+#include "include/core/SkPathTypes.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkScalar.h"
+#include "include/pathops/SkPathOps.h"
+#include "tests/Test.h"
+
+#include <optional>
+
+using namespace bentleyottmann;
+
+namespace {
+bool expected_contains(const SkPath& one, const SkPath& two, SkPathOp op, SkScalar x, SkScalar y) {
+    const bool in1 = one.contains(x, y),
+               in2 = two.contains(x, y);
+    switch (op) {
+        case kDifference_SkPathOp:        return in1 && !in2;
+        case kIntersect_SkPathOp:         return in1 && in2;
+        case kUnion_SkPathOp:             return in1 || in2;
+        case kXOR_SkPathOp:               return in1 != in2;
+        case kReverseDifference_SkPathOp: return in2 && !in1;
+    }
+    return false;
+}
+
+// Samples a grid that is offset from the integers, which keeps the samples off the edges of the
+// test shapes.
+void check_op(skiatest::Reporter* reporter,
+              const SkPath& one, const SkPath& two, SkPathOp op, const SkRect& area) {
+    std::optional<SkPath> result = polygon_op(one, two, op);
+    REPORTER_ASSERT(reporter, result.has_value());
+    if (!result) {
+        return;
+    }
+    for (SkScalar y = area.fTop + 0.4f; y < area.fBottom; y += 1) {
+        for (SkScalar x = area.fLeft + 0.5f; x < area.fRight; x += 1) {
+            REPORTER_ASSERT(reporter,
+                            result->contains(x, y) == expected_contains(one, two, op, x, y),
+                            "op %d at (%g, %g)", op, x, y);
+        }
+    }
+}
+}  // namespace
+
+DEF_TEST(BO_polygon_op_Rects, reporter) {
+    SkPath one = SkPath::Rect({0, 0, 10, 10}),
+           two = SkPath::Rect({5, 5, 15, 15});
+    const SkPathOp ops[] = {kDifference_SkPathOp, kIntersect_SkPathOp, kUnion_SkPathOp,
+                            kXOR_SkPathOp, kReverseDifference_SkPathOp};
+    for (SkPathOp op : ops) {
+        check_op(reporter, one, two, op, {-2, -2, 17, 17});
+    }
+
+    {
+        std::optional<SkPath> result = polygon_op(one, two, kIntersect_SkPathOp);
+        REPORTER_ASSERT(reporter, result && result->getBounds() == SkRect::MakeLTRB(5, 5, 10, 10));
+        REPORTER_ASSERT(reporter, result && result->countPoints() == 4);
+    }
+
+    {
+        // Touching rects merge into one.
+        std::optional<SkPath> result =
+                polygon_op(SkPath::Rect({0, 0, 10, 10}), SkPath::Rect({10, 0, 20, 10}),
+                           kUnion_SkPathOp);
+        REPORTER_ASSERT(reporter, result && result->countPoints() == 4);
+    }
+}
+
+DEF_TEST(BO_polygon_op_Crossings, reporter) {
+    // A diamond and a triangle whose edges cross between the grid points.
+    SkPath one, two;
+    one.moveTo(10, 0).lineTo(20, 10).lineTo(10, 20).lineTo(0, 10).close();
+    two.moveTo(3, 3).lineTo(23, 7).lineTo(7, 19).close();
+    const SkPathOp ops[] = {kDifference_SkPathOp, kIntersect_SkPathOp, kUnion_SkPathOp,
+                            kXOR_SkPathOp, kReverseDifference_SkPathOp};
+    for (SkPathOp op : ops) {
+        check_op(reporter, one, two, op, {-2, -2, 25, 22});
+    }
+
+    // Curves are flattened, so only sample away from them.
+    SkPath oval = SkPath::Oval({0, 0, 20, 20});
+    std::optional<SkPath> result = polygon_op(oval, SkPath::Rect({5, 5, 15, 15}), kXOR_SkPathOp);
+    REPORTER_ASSERT(reporter, result.has_value());
+    if (result) {
+        REPORTER_ASSERT(reporter, !result->contains(10, 10));
+        REPORTER_ASSERT(reporter, result->contains(10, 2));
+        REPORTER_ASSERT(reporter, !result->contains(1, 1));
+        REPORTER_ASSERT(reporter, result->getBounds().contains(SkRect::MakeLTRB(1, 1, 19, 19)));
+    }
+}
+
+DEF_TEST(BO_polygon_op_FillTypes, reporter) {
+    // Two overlapping squares drawn as one path.
+    SkPath path = SkPath::Rect({0, 0, 10, 10});
+    path.addRect({5, 5, 15, 15});
+
+    for (SkPathFillType fillType : {SkPathFillType::kWinding, SkPathFillType::kEvenOdd,
+                                    SkPathFillType::kInverseWinding,
+                                    SkPathFillType::kInverseEvenOdd}) {
+        path.setFillType(fillType);
+        check_op(reporter, path, SkPath{}, kUnion_SkPathOp, {-2, -2, 17, 17});
+        check_op(reporter, path, SkPath::Rect({2, 2, 12, 12}), kDifference_SkPathOp,
+                 {-2, -2, 17, 17});
+    }
+
+    std::optional<SkPath> result = polygon_simplify(path);
+    REPORTER_ASSERT(reporter, result && result->isInverseFillType());
+}
+
+DEF_TEST(BO_polygon_simplify_Bowtie, reporter) {
+    SkPath bowtie;
+    bowtie.moveTo(0, 0).lineTo(10, 10).lineTo(10, 0).lineTo(0, 10).close();
+    std::optional<SkPath> result = polygon_simplify(bowtie);
+    REPORTER_ASSERT(reporter, result.has_value());
+    if (result) {
+        REPORTER_ASSERT(reporter, result->countPoints() == 6);
+        REPORTER_ASSERT(reporter, result->contains(1, 5));
+        REPORTER_ASSERT(reporter, result->contains(9, 5));
+        REPORTER_ASSERT(reporter, !result->contains(5, 1));
+        REPORTER_ASSERT(reporter, !result->contains(5, 9));
+    }
+
+    // Collapsed paths have no area.
+    SkPath line;
+    line.moveTo(0, 0).lineTo(10, 10);
+    result = polygon_simplify(line);
+    REPORTER_ASSERT(reporter, result && result->isEmpty());
+}
+
+DEF_TEST(BO_polygon_op_Unrepresentable, reporter) {
+    SkPath rect = SkPath::Rect({0, 0, 10, 10});
+
+    SkPath infinite;
+    infinite.moveTo(0, 0).lineTo(SK_ScalarInfinity, 0).lineTo(0, 10).close();
+    REPORTER_ASSERT(reporter, !polygon_op(rect, infinite, kUnion_SkPathOp).has_value());
+
+    SkPath huge = SkPath::Rect({0, 0, 1e9f, 1e9f});
+    REPORTER_ASSERT(reporter, !polygon_simplify(huge).has_value());
+}
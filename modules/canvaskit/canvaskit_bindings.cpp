@@ -611,6 +611,88 @@ SkPathOrNull MakePathFromCmds(WASMPointerF32 cptr, int numCmds) {
     return emscripten::val(path);
 }
 
+// =================================================================================
+// Drawing with cmd arrays
+// =================================================================================
+
+static const int RECT_CMD = 0;
+static const int OVAL_CMD = 1;
+static const int CIRCLE_CMD = 2;
+static const int LINE_CMD = 3;
+static const int RRECT_CMD = 4;
+static const int COLOR_CMD = 5;
+static const int SAVE_CMD = 6;
+static const int RESTORE_CMD = 7;
+static const int TRANSLATE_CMD = 8;
+
+// Plays a flat array of draw commands, each a command and then its arguments, so that a batch of
+// simple draws costs one call across the JS/WASM boundary instead of one per draw. The draws share
+// one paint, whose color COLOR_CMD changes for the draws after it.
+void DrawCmds(SkCanvas& canvas, WASMPointerF32 cptr, int numCmds, const SkPaint& p) {
+    const auto* cmds = reinterpret_cast<const float*>(cptr);
+    SkPaint paint(p);
+    // Don't leave behind saves that the commands didn't restore.
+    SkAutoCanvasRestore acr(&canvas, false);
+
+    // if there are not enough arguments, stop with what we've drawn so far.
+    #define CHECK_NUM_ARGS(n) \
+        if ((i + n) > numCmds) { \
+            SkDebugf("Not enough args to match the commands. Saw %d commands\n", numCmds); \
+            return; \
+        }
+
+    for (int i = 0; i < numCmds;) {
+        switch (sk_float_floor2int(cmds[i++])) {
+            case RECT_CMD:
+                CHECK_NUM_ARGS(4)
+                canvas.drawRect(SkRect::MakeLTRB(cmds[i], cmds[i+1], cmds[i+2], cmds[i+3]), paint);
+                i += 4;
+                break;
+            case OVAL_CMD:
+                CHECK_NUM_ARGS(4)
+                canvas.drawOval(SkRect::MakeLTRB(cmds[i], cmds[i+1], cmds[i+2], cmds[i+3]), paint);
+                i += 4;
+                break;
+            case CIRCLE_CMD:
+                CHECK_NUM_ARGS(3)
+                canvas.drawCircle(cmds[i], cmds[i+1], cmds[i+2], paint);
+                i += 3;
+                break;
+            case LINE_CMD:
+                CHECK_NUM_ARGS(4)
+                canvas.drawLine(cmds[i], cmds[i+1], cmds[i+2], cmds[i+3], paint);
+                i += 4;
+                break;
+            case RRECT_CMD:
+                CHECK_NUM_ARGS(12)
+                canvas.drawRRect(ptrToSkRRect(reinterpret_cast<WASMPointerF32>(cmds + i)), paint);
+                i += 12;
+                break;
+            case COLOR_CMD:
+                CHECK_NUM_ARGS(4)
+                paint.setColor(SkColor4f{cmds[i], cmds[i+1], cmds[i+2], cmds[i+3]});
+                i += 4;
+                break;
+            case SAVE_CMD:
+                canvas.save();
+                break;
+            case RESTORE_CMD:
+                canvas.restore();
+                break;
+            case TRANSLATE_CMD:
+                CHECK_NUM_ARGS(2)
+                canvas.translate(cmds[i], cmds[i+1]);
+                i += 2;
+                break;
+            default:
+                SkDebugf("  draw: UNKNOWN command %f, aborting...\n", cmds[i-1]);
+                return;
+        }
+    }
+
+    #undef CHECK_NUM_ARGS
+}
+
 void PathAddVerbsPointsWeights(SkPath& path, WASMPointerU8 verbsPtr, int numVerbs,
                                              WASMPointerF32 ptsPtr, int numPts,
                                              WASMPointerF32 wtsPtr, int numWts) {
@@ -1160,6 +1242,7 @@ EMSCRIPTEN_BINDINGS(Skia) {
                            nullptr, paint);
         }), allow_raw_pointers())
         .function("_drawCircle", select_overload<void (SkScalar, SkScalar, SkScalar, const SkPaint& paint)>(&SkCanvas::drawCircle))
+        .function("_drawCmds", &DrawCmds)
         .function("_drawColor", optional_override([](SkCanvas& self, WASMPointerF32 cPtr) {
             self.drawColor(ptrToSkColor4f(cPtr));
         }))
@@ -2573,6 +2656,16 @@ EMSCRIPTEN_BINDINGS(Skia) {
     constant("CUBIC_VERB", CUBIC);
     constant("CLOSE_VERB", CLOSE);
 
+    constant("RECT_CMD",      RECT_CMD);
+    constant("OVAL_CMD",      OVAL_CMD);
+    constant("CIRCLE_CMD",    CIRCLE_CMD);
+    constant("LINE_CMD",      LINE_CMD);
+    constant("RRECT_CMD",     RRECT_CMD);
+    constant("COLOR_CMD",     COLOR_CMD);
+    constant("SAVE_CMD",      SAVE_CMD);
+    constant("RESTORE_CMD",   RESTORE_CMD);
+    constant("TRANSLATE_CMD", TRANSLATE_CMD);
+
     constant("SaveLayerInitWithPrevious", (int)SkCanvas::SaveLayerFlagsSet::kInitWithPrevious_SaveLayerFlag);
     constant("SaveLayerF16ColorType",     (int)SkCanvas::SaveLayerFlagsSet::kF16ColorType);
 
@@ -144,6 +144,14 @@ if [[ $@ == *legacy_draw_vertices* ]]; then
   LEGACY_DRAW_VERTICES="true"
 fi
 
+EXTRA_CFLAGS=""
+if [[ $@ == *simd* ]]; then
+  # Lets SkVx use 128-bit WebAssembly SIMD, and the compiler auto-vectorize. The resulting .wasm
+  # needs a browser with SIMD support (Chrome 91, Firefox 89, Safari 16.4).
+  echo "Building with WebAssembly SIMD"
+  EXTRA_CFLAGS="\"-msimd128\""
+fi
+
 DEBUGGER_ENABLED="false"
 if [[ $@ == *enable_debugger* ]]; then
   DEBUGGER_ENABLED="true"
@@ -208,6 +216,7 @@ echo "Compiling"
   is_trivial_abi=true \
   werror=true \
   target_cpu=\"wasm\" \
+  extra_cflags=[${EXTRA_CFLAGS}] \
   \
   skia_use_angle=false \
   skia_use_dng_sdk=false \
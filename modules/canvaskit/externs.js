@@ -294,6 +294,7 @@ var CanvasKit = {
       drawArc: function() {},
       drawAtlas: function() {},
       drawCircle: function() {},
+      drawCmds: function() {},
       drawColor: function() {},
       drawColorComponents: function() {},
       drawColorInt: function() {},
@@ -338,6 +339,7 @@ var CanvasKit = {
     _drawAtlasCubic: function() {},
     _drawAtlasOptions: function() {},
     _drawCircle: function() {},
+    _drawCmds: function() {},
     _drawColor: function() {},
     _drawColorInt: function() {},
     _drawDRRect:  function() {},
@@ -870,6 +872,16 @@ var CanvasKit = {
   CUBIC_VERB: {},
   CLOSE_VERB: {},
 
+  RECT_CMD: {},
+  OVAL_CMD: {},
+  CIRCLE_CMD: {},
+  LINE_CMD: {},
+  RRECT_CMD: {},
+  COLOR_CMD: {},
+  SAVE_CMD: {},
+  RESTORE_CMD: {},
+  TRANSLATE_CMD: {},
+
   NoDecoration: {},
   UnderlineDecoration: {},
   OverlineDecoration: {},
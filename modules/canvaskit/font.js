@@ -110,7 +110,9 @@ CanvasKit._extraInitializations.push(function() {
     return rv;
   };
 
-  // arguments should all be arrayBuffers or be an array of arrayBuffers.
+  // arguments should all be arrayBuffers or be an array of arrayBuffers. SharedArrayBuffers work
+  // too, which lets workers share one copy of the fonts in JS (each still copies them into its own
+  // WASM heap).
   CanvasKit.FontMgr.FromData = function() {
     if (!arguments.length) {
       Debug('Could not make FontMgr from no font sources');
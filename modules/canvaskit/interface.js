@@ -569,6 +569,16 @@ CanvasKit.onRuntimeInitialized = function() {
     this._drawCircle(cx, cy, r, paint);
   }
 
+  // cmds is a 1d array of draw commands, each a CanvasKit.*_CMD constant followed by its
+  // arguments. Like other APIs, this accepts a malloced type array or malloc obj, which lets a
+  // batch of draws be written straight into the WASM heap and drawn with one call.
+  CanvasKit.Canvas.prototype.drawCmds = function(cmds, paint) {
+    CanvasKit.setCurrentContext(this._context);
+    var ptr = copy1dArray(cmds, 'HEAPF32');
+    this._drawCmds(ptr, cmds.length, paint);
+    freeArraysThatAreNotMallocedByUsers(ptr, cmds);
+  };
+
   CanvasKit.Canvas.prototype.drawColor = function(color4f, mode) {
     CanvasKit.setCurrentContext(this._context);
     var cPtr = copyColorToWasm(color4f);
@@ -1276,7 +1286,9 @@ CanvasKit.MakeImageFromCanvasImageSource = function(canvasImageSource) {
   var height = canvasImageSource.height;
 
   if (!memoizedCanvas2dElement) {
-    memoizedCanvas2dElement = document.createElement('canvas');
+    // Workers have no document, but do have OffscreenCanvas.
+    memoizedCanvas2dElement = typeof document !== 'undefined' ?
+        document.createElement('canvas') : new OffscreenCanvas(width, height);
   }
   memoizedCanvas2dElement.width = width;
   memoizedCanvas2dElement.height = height;
@@ -104,6 +104,7 @@ function canvasTests(CK: CanvasKit, canvas?: Canvas, paint?: Paint, path?: Path,
     canvas.drawAtlas(img, [1, 2, 3, 4, 5, 6, 7, 8], [8, 7, 6, 5, 4, 3, 2, 1], paint,
                      null, null, {filter: CK.FilterMode.Linear, mipmap: CK.MipmapMode.Nearest});
        canvas.drawCircle(20, 20, 20, paint);
+    canvas.drawCmds([CK.COLOR_CMD, 1, 0, 0, 1, CK.RECT_CMD, 1, 2, 3, 4], paint);
     canvas.drawColor(someColor);
     canvas.drawColor(someColor, CK.BlendMode.ColorDodge);
     canvas.drawColorComponents(0.2, 1.0, -0.02, 0.5);
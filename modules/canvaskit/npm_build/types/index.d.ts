@@ -524,6 +524,16 @@ export interface CanvasKit {
     readonly CUBIC_VERB: number;
     readonly CLOSE_VERB: number;
 
+    readonly RECT_CMD: number;
+    readonly OVAL_CMD: number;
+    readonly CIRCLE_CMD: number;
+    readonly LINE_CMD: number;
+    readonly RRECT_CMD: number;
+    readonly COLOR_CMD: number;
+    readonly SAVE_CMD: number;
+    readonly RESTORE_CMD: number;
+    readonly TRANSLATE_CMD: number;
+
     readonly SaveLayerInitWithPrevious: SaveLayerFlag;
     readonly SaveLayerF16ColorType: SaveLayerFlag;
 
@@ -1434,6 +1444,16 @@ export interface Canvas extends EmbindObject<"Canvas"> {
      */
     drawCircle(cx: number, cy: number, radius: number, paint: Paint): void;
 
+    /**
+     * Draws a batch of simple shapes, described by draw commands, with one call into WASM. The
+     * draws all use the given paint, except that a COLOR_CMD changes its color for the draws after
+     * it. Saves left unrestored by the commands are restored once they have been drawn.
+     * Passing a MallocObj avoids copying the commands into the WASM heap.
+     * @param cmds
+     * @param paint
+     */
+    drawCmds(cmds: InputDrawCommands, paint: Paint): void;
+
     /**
      * Fills clip with the given color.
      * @param color
@@ -3257,7 +3277,7 @@ export interface TypefaceFontProvider extends FontMgr {
      * @param bytes - the raw bytes for a typeface.
      * @param family
      */
-    registerFont(bytes: ArrayBuffer | Uint8Array, family: string): void;
+    registerFont(bytes: ArrayBuffer | SharedArrayBuffer | Uint8Array, family: string): void;
 }
 
 /**
@@ -3666,9 +3686,12 @@ export interface FontConstructor extends DefaultConstructor<Font> {
 export interface FontMgrFactory {
     /**
      * Create an FontMgr with the created font data. Returns null if buffers was empty.
+     * Passing SharedArrayBuffers lets several workers make FontMgrs from one copy of the font
+     * data, instead of each being posted its own; each CanvasKit instance still copies the bytes
+     * into its WASM heap.
      * @param buffers
      */
-    FromData(...buffers: ArrayBuffer[]): FontMgr | null;
+    FromData(...buffers: (ArrayBuffer | SharedArrayBuffer)[]): FontMgr | null;
 }
 
 /**
@@ -4220,9 +4243,10 @@ export interface TypefaceFactory {
     /**
      * Create a typeface using Freetype from the specified bytes and return it. CanvasKit supports
      * .ttf, .woff and .woff2 fonts. It returns null if the bytes cannot be decoded.
+     * As with FontMgr.FromData, the bytes may be in a SharedArrayBuffer.
      * @param fontData
      */
-    MakeTypefaceFromData(fontData: ArrayBuffer): Typeface | null;
+    MakeTypefaceFromData(fontData: ArrayBuffer | SharedArrayBuffer): Typeface | null;
     // Legacy
     MakeFreeTypeFaceFromData(fontData: ArrayBuffer): Typeface | null;
 }
@@ -4389,6 +4413,22 @@ export type GlyphIDArray = Uint16Array;
  *    CanvasKit.LINE_VERB, 30, 40]
  */
 export type InputCommands = MallocObj | Float32Array | number[];
+/**
+ * A draw command is a command constant and then its arguments:
+ *   RECT_CMD, OVAL_CMD: left, top, right, bottom
+ *   CIRCLE_CMD: cx, cy, radius
+ *   LINE_CMD: x0, y0, x1, y1
+ *   RRECT_CMD: the 12 floats of an RRect
+ *   COLOR_CMD: r, g, b, a (sets the paint color for the commands that follow)
+ *   SAVE_CMD, RESTORE_CMD: no arguments
+ *   TRANSLATE_CMD: dx, dy
+ * InputDrawCommands is a flattened structure of one or more of these.
+ * Examples:
+ *   [CanvasKit.COLOR_CMD, 1, 0, 0, 1,
+ *    CanvasKit.RECT_CMD, 10, 10, 50, 50,
+ *    CanvasKit.CIRCLE_CMD, 80, 30, 20]
+ */
+export type InputDrawCommands = MallocObj | Float32Array | number[];
 /**
  * VerbList holds verb constants like CanvasKit.MOVE_VERB, CanvasKit.CUBIC_VERB.
  */
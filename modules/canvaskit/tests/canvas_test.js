@@ -613,6 +613,39 @@ describe('Canvas Behavior', () => {
         boxPaint.delete();
     });
 
+    gm('drawCmds_canvas', (canvas) => {
+        const paint = new CanvasKit.Paint();
+        paint.setAntiAlias(true);
+
+        const cmds = [
+            CanvasKit.COLOR_CMD, 0, 0, 1, 1,
+            CanvasKit.RECT_CMD, 10, 10, 60, 60,
+            CanvasKit.COLOR_CMD, 1, 0, 0, 1,
+            CanvasKit.OVAL_CMD, 70, 10, 150, 60,
+            CanvasKit.SAVE_CMD,
+            CanvasKit.TRANSLATE_CMD, 0, 70,
+            CanvasKit.CIRCLE_CMD, 35, 25, 25,
+            CanvasKit.LINE_CMD, 70, 0, 150, 50,
+            CanvasKit.RESTORE_CMD,
+            CanvasKit.COLOR_CMD, 0, 0.5, 0, 1,
+            CanvasKit.RRECT_CMD, 10, 140, 150, 190, 10, 10, 10, 10, 20, 20, 20, 20,
+            // This save is left for drawCmds to restore.
+            CanvasKit.SAVE_CMD,
+            CanvasKit.TRANSLATE_CMD, 1000, 1000,
+        ];
+        canvas.drawCmds(cmds, paint);
+
+        // The same commands, from memory that drawCmds doesn't have to copy, shifted over.
+        const mCmdsObj = CanvasKit.Malloc(Float32Array, cmds.length + 3);
+        const mCmds = mCmdsObj.toTypedArray();
+        mCmds.set([CanvasKit.TRANSLATE_CMD, 160, 0]);
+        mCmds.set(cmds, 3);
+        canvas.drawCmds(mCmdsObj, paint);
+        CanvasKit.Free(mCmdsObj);
+
+        paint.delete();
+    });
+
     gm('drawImageNine_canvas', (canvas, fetchedByteBuffers) => {
         const img = CanvasKit.MakeImageFromEncoded(fetchedByteBuffers[0]);
         expect(img).toBeTruthy();
@@ -212,6 +212,23 @@ describe('Font Behavior', () => {
         fontMgr.delete();
     });
 
+    it('can make a font mgr from fonts in SharedArrayBuffers', () => {
+        // Only available to cross-origin isolated pages.
+        if (typeof SharedArrayBuffer === 'undefined') {
+            return;
+        }
+        const toShared = (buffer) => {
+            const shared = new SharedArrayBuffer(buffer.byteLength);
+            new Uint8Array(shared).set(new Uint8Array(buffer));
+            return shared;
+        };
+        const fontMgr = CanvasKit.FontMgr.FromData(toShared(bungeeFontBuffer),
+                                                   toShared(notoSerifFontBuffer));
+        expect(fontMgr).toBeTruthy();
+        expect(fontMgr.countFamilies()).toBe(2);
+        fontMgr.delete();
+    });
+
     it('can make a font provider with passed in fonts and aliases', () => {
         const fontProvider = CanvasKit.TypefaceFontProvider.Make();
         fontProvider.registerFont(bungeeFontBuffer, "My Bungee Alias");
@@ -2496,14 +2496,19 @@ bool skcms_Transform(const void*             src,
                      skcms_AlphaFormat       dstAlpha,
                      const skcms_ICCProfile* dstProfile,
                      size_t                  nz) {
-    const size_t dst_bpp = bytes_per_pixel(dstFmt),
-                 src_bpp = bytes_per_pixel(srcFmt);
-    // Let's just refuse if the request is absurdly big.
-    if (nz * dst_bpp > INT_MAX || nz * src_bpp > INT_MAX) {
-        return false;
-    }
-    int n = (int)nz;
-
+    skcms_PreparedTransform transform;
+    return skcms_PrepareTransform(srcFmt, srcAlpha, srcProfile,
+                                  dstFmt, dstAlpha, dstProfile, &transform)
+        && skcms_RunPreparedTransform(&transform, src, dst, nz);
+}
+
+bool skcms_PrepareTransform(skcms_PixelFormat        srcFmt,
+                            skcms_AlphaFormat        srcAlpha,
+                            const skcms_ICCProfile*  srcProfile,
+                            skcms_PixelFormat        dstFmt,
+                            skcms_AlphaFormat        dstAlpha,
+                            const skcms_ICCProfile*  dstProfile,
+                            skcms_PreparedTransform* transform) {
     // Null profiles default to sRGB. Passing null for both is handy when doing format conversion.
     if (!srcProfile) {
         srcProfile = skcms_sRGB_profile();
@@ -2511,12 +2516,17 @@ bool skcms_Transform(const void*             src,
     if (!dstProfile) {
         dstProfile = skcms_sRGB_profile();
     }
+    // Decide this before copying, as it's the profile pointers, not their contents, we compare.
+    const bool sameProfile = (srcProfile == dstProfile);
 
-    // We can't transform in place unless the PixelFormats are the same size.
-    if (dst == src && dst_bpp != src_bpp) {
-        return false;
-    }
-    // TODO: more careful alias rejection (like, dst == src + 1)?
+    // The program refers to the transform's own copies of the profiles, so it can outlive them.
+    transform->src_profile = *srcProfile;
+    transform->dst_profile = *dstProfile;
+    srcProfile = &transform->src_profile;
+    dstProfile = &transform->dst_profile;
+
+    transform->src_bpp = bytes_per_pixel(srcFmt);
+    transform->dst_bpp = bytes_per_pixel(dstFmt);
 
     Op          program[32];
     const void* context[32];
@@ -2546,12 +2556,12 @@ bool skcms_Transform(const void*             src,
     };
 
     // These are always parametric curves of some sort.
-    skcms_Curve dst_curves[3];
+    skcms_Curve* dst_curves = transform->dst_curves;
     dst_curves[0].table_entries =
     dst_curves[1].table_entries =
     dst_curves[2].table_entries = 0;
 
-    skcms_Matrix3x3        from_xyz;
+    skcms_Matrix3x3& from_xyz = transform->from_xyz;
 
     switch (srcFmt >> 1) {
         default: return false;
@@ -2586,13 +2596,11 @@ bool skcms_Transform(const void*             src,
     if (srcFmt & 1) {
         add_op(Op::swap_rb);
     }
-    skcms_ICCProfile gray_dst_profile;
-    if ((dstFmt >> 1) == (skcms_PixelFormat_G_8 >> 1)) {
+    const bool grayDst = (dstFmt >> 1) == (skcms_PixelFormat_G_8 >> 1);
+    if (grayDst) {
         // When transforming to gray, stop at XYZ (by setting toXYZ to identity), then transform
         // luminance (Y) by the destination transfer function.
-        gray_dst_profile = *dstProfile;
-        skcms_SetXYZD50(&gray_dst_profile, &skcms_XYZD50_profile()->toXYZD50);
-        dstProfile = &gray_dst_profile;
+        skcms_SetXYZD50(&transform->dst_profile, &skcms_XYZD50_profile()->toXYZD50);
     }
 
     if (srcProfile->data_color_space == skcms_Signature_CMYK) {
@@ -2609,7 +2617,7 @@ bool skcms_Transform(const void*             src,
         add_op(Op::unpremul);
     }
 
-    if (dstProfile != srcProfile) {
+    if (!sameProfile || grayDst) {
 
         if (!prep_for_destination(dstProfile,
                                   &from_xyz,
@@ -2780,6 +2788,51 @@ bool skcms_Transform(const void*             src,
     assert(ops      <= program + ARRAY_COUNT(program));
     assert(contexts <= context + ARRAY_COUNT(context));
 
+    // Contexts that point into the transform are stored as offsets, so it can be copied.
+    const char* begin = (const char*)transform;
+    const char* end   = (const char*)(transform + 1);
+    transform->program_size = (int)(ops - program);
+    transform->internal_contexts = 0;
+    for (int i = 0; i < transform->program_size; ++i) {
+        const char* ctx = (const char*)context[i];
+        transform->program[i] = (int)program[i];
+        if (ctx >= begin && ctx < end) {
+            transform->internal_contexts |= 1u << i;
+            transform->contexts[i] = (const void*)(uintptr_t)(ctx - begin);
+        } else {
+            transform->contexts[i] = ctx;
+        }
+    }
+    return true;
+}
+
+bool skcms_RunPreparedTransform(const skcms_PreparedTransform* transform,
+                                const void*                    src,
+                                void*                          dst,
+                                size_t                         nz) {
+    const size_t dst_bpp = transform->dst_bpp,
+                 src_bpp = transform->src_bpp;
+    // Let's just refuse if the request is absurdly big.
+    if (nz * dst_bpp > INT_MAX || nz * src_bpp > INT_MAX) {
+        return false;
+    }
+    int n = (int)nz;
+
+    // We can't transform in place unless the PixelFormats are the same size.
+    if (dst == src && dst_bpp != src_bpp) {
+        return false;
+    }
+    // TODO: more careful alias rejection (like, dst == src + 1)?
+
+    Op          program[32];
+    const void* context[32];
+    for (int i = 0; i < transform->program_size; ++i) {
+        program[i] = (Op)transform->program[i];
+        context[i] = (transform->internal_contexts & (1u << i))
+                   ? (const char*)transform + (uintptr_t)transform->contexts[i]
+                   : transform->contexts[i];
+    }
+
     auto run = baseline::run_program;
     switch (cpu_type()) {
         case CpuType::SKX:
@@ -2798,7 +2851,8 @@ bool skcms_Transform(const void*             src,
             break;
     }
 
-    run(program, context, ops - program, (const char*)src, (char*)dst, n, src_bpp,dst_bpp);
+    run(program, context, transform->program_size, (const char*)src, (char*)dst, n,
+        src_bpp, dst_bpp);
     return true;
 }
 
@@ -352,6 +352,45 @@ SKCMS_API bool skcms_Transform(const void*             src,
                                const skcms_ICCProfile* dstProfile,
                                size_t                  npixels);
 
+// skcms_Transform() re-analyzes both profiles every time it's called.  To convert many buffers
+// (or the rows of one large image) between the same formats and profiles, prepare the transform
+// once with skcms_PrepareTransform(), then apply it with skcms_RunPreparedTransform().
+//
+// A prepared transform is never modified once prepared, so it is safe to run the same one on
+// different pixels from several threads at once, e.g. one band of rows per thread.  It may be
+// copied freely, but it still refers to the tables and CLUTs of the profiles it was prepared from,
+// so the ICC data backing those profiles must outlive it.
+typedef struct skcms_PreparedTransform {
+    // All of this is private to skcms.
+    skcms_ICCProfile       src_profile,
+                           dst_profile;
+    skcms_Matrix3x3        from_xyz;
+    skcms_Curve            dst_curves[3];
+    int                    program[32];
+    const void*            contexts[32];
+    uint32_t               internal_contexts;  // Bit i set: contexts[i] is an offset into this.
+    int                    program_size;
+    size_t                 src_bpp,
+                           dst_bpp;
+} skcms_PreparedTransform;
+
+// Prepare a transform from srcFmt/srcAlpha/srcProfile to dstFmt/dstAlpha/dstProfile, following
+// the same rules as skcms_Transform().  Returns false if skcms_Transform() would fail for them.
+SKCMS_API bool skcms_PrepareTransform(skcms_PixelFormat        srcFmt,
+                                      skcms_AlphaFormat        srcAlpha,
+                                      const skcms_ICCProfile*  srcProfile,
+                                      skcms_PixelFormat        dstFmt,
+                                      skcms_AlphaFormat        dstAlpha,
+                                      const skcms_ICCProfile*  dstProfile,
+                                      skcms_PreparedTransform* transform);
+
+// Convert npixels pixels with a prepared transform, and return true, otherwise return false.
+// It is safe to alias dst == src if the source and destination pixels are the same size.
+SKCMS_API bool skcms_RunPreparedTransform(const skcms_PreparedTransform* transform,
+                                          const void*                    src,
+                                          void*                          dst,
+                                          size_t                         npixels);
+
 // If profile can be used as a destination in skcms_Transform, return true. Otherwise, attempt to
 // rewrite it with approximations where reasonable. If successful, return true. If no reasonable
 // approximation exists, leave the profile unchanged and return false.
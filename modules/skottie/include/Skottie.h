@@ -22,6 +22,8 @@
 #include <vector>
 
 class SkCanvas;
+class SkData;
+class SkExecutor;
 struct SkRect;
 class SkStream;
 
@@ -96,6 +98,9 @@ public:
                                          // frames are only resolved when needed, at seek() time.
             kPreferEmbeddedFonts = 0x02, // Attempt to use the embedded fonts (glyph paths,
                                          // normally used as fallback) over native Skia typefaces.
+            kCacheStaticPrecomps = 0x04, // Rasterize precomp layers with static content once, and
+                                         // draw them from cached images (raster or GPU) on
+                                         // subsequent frames.
         };
 
         explicit Builder(uint32_t flags = 0);
@@ -156,13 +161,32 @@ public:
          */
         Builder& setExpressionManager(sk_sp<ExpressionManager>);
 
+        /**
+         * Registers an executor for seeking the animation: the keyframe animators of different
+         * layers are then evaluated concurrently, before the scene graph is updated on the
+         * seeking thread.  The executor must outlive the animation.
+         */
+        Builder& setExecutor(SkExecutor*);
+
         /**
          * Animation factories.
+         *
+         * In addition to Lottie JSON, these accept pre-baked animations (see Bake() below).
          */
         sk_sp<Animation> make(SkStream*);
         sk_sp<Animation> make(const char* data, size_t length);
         sk_sp<Animation> makeFromFile(const char path[]);
 
+        /**
+         * Converts Lottie JSON to a compact binary form, suitable for offline processing.
+         *
+         * Baked animations skip JSON parsing at load time: the data is relocated in bulk,
+         * and can be memory-mapped (makeFromFile).  The scene graph is still built on load.
+         *
+         * @return the baked animation, or nullptr if the JSON cannot be parsed.
+         */
+        static sk_sp<SkData> Bake(const char* data, size_t length);
+
         /**
          * Get handle for SlotManager after animation is built.
          */
@@ -178,6 +202,7 @@ public:
         sk_sp<MarkerObserver  >   fMarkerObserver;
         sk_sp<PrecompInterceptor> fPrecompInterceptor;
         sk_sp<ExpressionManager>  fExpressionManager;
+        SkExecutor*               fExecutor = nullptr;
         sk_sp<SlotManager>        fSlotManager;
         Stats                     fStats;
     };
@@ -218,6 +243,17 @@ public:
     void render(SkCanvas* canvas, const SkRect* dst = nullptr) const;
     void render(SkCanvas* canvas, const SkRect* dst, RenderFlags) const;
 
+    /**
+     * Partial repaint: only the areas damaged by the last seek (as collected in the
+     * InvalidationController passed to seek) are cleared and redrawn, while the rest of the
+     * canvas is left untouched.  The canvas is therefore expected to retain the previous frame,
+     * rendered with the same destination rect.
+     *
+     * @param damage   the InvalidationController passed to the last seek
+     */
+    void render(SkCanvas* canvas, const SkRect* dst, RenderFlags,
+                const sksg::InvalidationController& damage) const;
+
     /**
      * [Deprecated: use one of the other versions.]
      *
@@ -279,7 +315,11 @@ private:
     Animation(sk_sp<sksg::RenderNode>,
               std::vector<sk_sp<internal::Animator>>&&,
               SkString ver, const SkSize& size,
-              double inPoint, double outPoint, double duration, double fps, uint32_t flags);
+              double inPoint, double outPoint, double duration, double fps, uint32_t flags,
+              SkExecutor*);
+
+    void render(SkCanvas*, const SkRect* dst, RenderFlags,
+                const sksg::InvalidationController* damage) const;
 
     const sk_sp<sksg::RenderNode>                fSceneRoot;
     const std::vector<sk_sp<internal::Animator>> fAnimators;
@@ -290,6 +330,7 @@ private:
                                                  fDuration,
                                                  fFPS;
     const uint32_t                               fFlags;
+    SkExecutor*                                  fExecutor;
 
     using INHERITED = SkNVRefCnt<Animation>;
 };
@@ -257,9 +257,16 @@ public:
         , fOut(out) {}
 
 protected:
+    void onPrepare(float t) override {
+        const auto dispatch_count = this->isActive(t) ? fLayerAnimators.size()
+                                                      : fTransformAnimatorsCount;
+        for (size_t i = 0; i < dispatch_count; ++i) {
+            fLayerAnimators[i]->prepare(t);
+        }
+    }
+
     StateChanged onSeek(float t) override {
-        // in/out may be inverted for time-reversed layers
-        const auto active = (t >= fIn && t < fOut) || (t > fOut && t <= fIn);
+        const auto active = this->isActive(t);
 
         bool changed = false;
         if (fLayerNode) {
@@ -280,6 +287,11 @@ protected:
     }
 
 private:
+    bool isActive(float t) const {
+        // in/out may be inverted for time-reversed layers
+        return (t >= fIn && t < fOut) || (t > fOut && t <= fIn);
+    }
+
     const AnimatorScope           fLayerAnimators;
     const sk_sp<sksg::RenderNode> fLayerNode;
     const size_t                  fTransformAnimatorsCount;
@@ -32,6 +32,7 @@
 #include "modules/sksg/include/SkSGRenderEffect.h"
 #include "modules/sksg/include/SkSGRenderNode.h"
 #include "modules/sksg/include/SkSGTransform.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkTraceEvent.h"
 
 #include <chrono>
@@ -175,8 +176,17 @@ void AnimationBuilder::parseAssets(const skjson::ArrayValue* jassets) {
     }
 
     for (const skjson::ObjectValue* asset : *jassets) {
-        if (asset) {
-            fAssets.set(ParseDefault<SkString>((*asset)["id"], SkString()), { asset, false });
+        if (!asset) {
+            continue;
+        }
+        fAssets.set(ParseDefault<SkString>((*asset)["id"], SkString()), { asset, false });
+
+        // Give the resource provider a head start on image assets while we build the rest.
+        const skjson::StringValue* name = (*asset)["p"];
+        const skjson::StringValue* path = (*asset)["u"];
+        const skjson::StringValue* id   = (*asset)["id"];
+        if (name && path && id) {
+            fResourceProvider->prefetchImageAsset(path->begin(), name->begin(), id->begin());
         }
     }
 }
@@ -326,6 +336,11 @@ Animation::Builder& Animation::Builder::setExpressionManager(sk_sp<ExpressionMan
     return *this;
 }
 
+Animation::Builder& Animation::Builder::setExecutor(SkExecutor* executor) {
+    fExecutor = executor;
+    return *this;
+}
+
 sk_sp<Animation> Animation::Builder::make(SkStream* stream) {
     if (!stream->hasLength()) {
         // TODO: handle explicit buffering?
@@ -427,7 +442,16 @@ sk_sp<Animation> Animation::Builder::make(const char* data, size_t data_len) {
                                           outPoint,
                                           duration,
                                           fps,
-                                          flags));
+                                          flags,
+                                          fExecutor));
+}
+
+sk_sp<SkData> Animation::Builder::Bake(const char* data, size_t length) {
+    TRACE_EVENT0("skottie", TRACE_FUNC);
+
+    const skjson::DOM dom(data, length);
+
+    return dom.root().is<skjson::ObjectValue>() ? dom.bake() : nullptr;
 }
 
 sk_sp<Animation> Animation::Builder::makeFromFile(const char path[]) {
@@ -440,7 +464,8 @@ sk_sp<Animation> Animation::Builder::makeFromFile(const char path[]) {
 Animation::Animation(sk_sp<sksg::RenderNode> scene_root,
                      std::vector<sk_sp<internal::Animator>>&& animators,
                      SkString version, const SkSize& size,
-                     double inPoint, double outPoint, double duration, double fps, uint32_t flags)
+                     double inPoint, double outPoint, double duration, double fps, uint32_t flags,
+                     SkExecutor* executor)
     : fSceneRoot(std::move(scene_root))
     , fAnimators(std::move(animators))
     , fVersion(std::move(version))
@@ -449,7 +474,8 @@ Animation::Animation(sk_sp<sksg::RenderNode> scene_root,
     , fOutPoint(outPoint)
     , fDuration(duration)
     , fFPS(fps)
-    , fFlags(flags) {}
+    , fFlags(flags)
+    , fExecutor(executor) {}
 
 Animation::~Animation() = default;
 
@@ -458,6 +484,16 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR) const {
 }
 
 void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags) const {
+    this->render(canvas, dstR, renderFlags, nullptr);
+}
+
+void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags,
+                       const sksg::InvalidationController& damage) const {
+    this->render(canvas, dstR, renderFlags, &damage);
+}
+
+void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderFlags,
+                       const sksg::InvalidationController* damage) const {
     TRACE_EVENT0("skottie", TRACE_FUNC);
 
     if (!fSceneRoot)
@@ -474,6 +510,11 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderF
         canvas->clipRect(srcR);
     }
 
+    if (damage) {
+        damage->clipCanvas(canvas);
+        canvas->clear(SK_ColorTRANSPARENT);
+    }
+
     if ((fFlags & Flags::kRequiresTopLevelIsolation) &&
         !(renderFlags & RenderFlag::kSkipTopLevelIsolation)) {
         // The animation uses non-trivial blending, and needs
@@ -481,7 +522,11 @@ void Animation::render(SkCanvas* canvas, const SkRect* dstR, RenderFlags renderF
         canvas->saveLayer(srcR, nullptr);
     }
 
-    fSceneRoot->render(canvas);
+    if (damage) {
+        fSceneRoot->render(canvas, *damage);
+    } else {
+        fSceneRoot->render(canvas);
+    }
 }
 
 void Animation::seekFrame(double t, sksg::InvalidationController* ic) {
@@ -494,6 +539,15 @@ void Animation::seekFrame(double t, sksg::InvalidationController* ic) {
     const auto kLastValidFrame = std::nextafterf(fOutPoint, fInPoint),
                      comp_time = SkTPin<float>(fInPoint + t, fInPoint, kLastValidFrame);
 
+    if (fExecutor && fAnimators.size() > 1) {
+        // The top level animators (layers) are independent until they update the scene graph.
+        SkTaskGroup tg(*fExecutor);
+        tg.batch(SkToInt(fAnimators.size()), [&](int i) {
+            fAnimators[i]->prepare(comp_time);
+        });
+        tg.wait();
+    }
+
     for (const auto& anim : fAnimators) {
         anim->seek(comp_time);
     }
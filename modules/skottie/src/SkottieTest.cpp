@@ -5,6 +5,9 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkSurface.h"
 #include "modules/skottie/include/Skottie.h"
@@ -269,3 +272,149 @@ DEF_TEST(Skottie_Layer_NoType, r) {
     // passes if we don't crash
     REPORTER_ASSERT(r, anim);
 }
+
+DEF_TEST(Skottie_SeekOnExecutor, r) {
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 100,
+             "h": 100,
+             "fr": 10,
+             "ip": 0,
+             "op": 100,
+             "layers": [
+               {
+                 "ty": 1, "sw": 50, "sh": 100, "sc": "#ff0000", "ip": 0, "op": 100,
+                 "ks": { "o": { "a": 1, "k": [ { "t": 0, "s": [0] }, { "t": 100, "s": [100] } ] } }
+               },
+               {
+                 "ty": 1, "sw": 50, "sh": 100, "sc": "#0000ff", "ip": 0, "op": 50,
+                 "ks": { "p": { "a": 1, "k": [ { "t": 0, "s": [50, 0] }, { "t": 100, "s": [50, 100] } ] } }
+               }
+             ]
+           })";
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkMemoryStream stream(json, strlen(json)), parallelStream(json, strlen(json));
+    auto anim = Animation::Make(&stream);
+    auto parallelAnim = Animation::Builder().setExecutor(executor.get()).make(&parallelStream);
+    REPORTER_ASSERT(r, anim && parallelAnim);
+
+    SkBitmap expected, actual;
+    expected.allocN32Pixels(100, 100);
+    actual.allocN32Pixels(100, 100);
+    for (double frame : {0.0, 25.0, 49.0, 50.0, 75.0, 25.0}) {
+        anim->seekFrame(frame);
+        parallelAnim->seekFrame(frame);
+
+        expected.eraseColor(SK_ColorTRANSPARENT);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+        SkCanvas expectedCanvas(expected), actualCanvas(actual);
+        anim->render(&expectedCanvas);
+        parallelAnim->render(&actualCanvas);
+
+        REPORTER_ASSERT(r, 0 == memcmp(expected.getPixels(), actual.getPixels(),
+                                       expected.computeByteSize()), "frame %g", frame);
+    }
+}
+
+DEF_TEST(Skottie_CacheStaticPrecomps, r) {
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 100,
+             "h": 100,
+             "fr": 10,
+             "ip": 0,
+             "op": 10,
+             "assets": [
+               {
+                 "id": "static",
+                 "layers": [
+                   { "ty": 1, "sw": 20, "sh": 20, "sc": "#ff0000", "ip": 0, "op": 10 },
+                   {
+                     "ty": 1, "sw": 10, "sh": 10, "sc": "#00ff00", "ip": 0, "op": 10,
+                     "ks": { "p": { "a": 0, "k": [5, 5] }, "r": { "a": 0, "k": 45 } }
+                   }
+                 ]
+               }
+             ],
+             "layers": [
+               {
+                 "ty": 0, "refId": "static", "w": 20, "h": 20, "ip": 0, "op": 10,
+                 "ks": { "p": { "a": 1, "k": [ { "t": 0, "s": [10, 10] },
+                                               { "t": 5, "s": [60, 10] },
+                                               { "t": 10, "s": [60, 10] } ] } }
+               }
+             ]
+           })";
+
+    SkMemoryStream stream(json, strlen(json)), cachedStream(json, strlen(json));
+    auto anim = Animation::Make(&stream);
+    auto cachedAnim = Animation::Builder(Animation::Builder::kCacheStaticPrecomps)
+                          .make(&cachedStream);
+    REPORTER_ASSERT(r, anim && cachedAnim);
+
+    SkBitmap expected, actual;
+    expected.allocN32Pixels(100, 100);
+    actual.allocN32Pixels(100, 100);
+    for (double frame : {0.0, 0.0, 1.0, 2.0, 6.0, 7.0, 3.0}) {
+        anim->seekFrame(frame);
+        cachedAnim->seekFrame(frame);
+
+        expected.eraseColor(SK_ColorTRANSPARENT);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+        SkCanvas expectedCanvas(expected), actualCanvas(actual);
+        anim->render(&expectedCanvas);
+        cachedAnim->render(&actualCanvas);
+
+        REPORTER_ASSERT(r, 0 == memcmp(expected.getPixels(), actual.getPixels(),
+                                       expected.computeByteSize()), "frame %g", frame);
+    }
+}
+
+DEF_TEST(Skottie_Bake, r) {
+    static constexpr char json[] =
+        R"({
+             "v": "5.2.1",
+             "w": 100,
+             "h": 100,
+             "fr": 10,
+             "ip": 0,
+             "op": 10,
+             "layers": [
+               {
+                 "ty": 1, "sw": 50, "sh": 50, "sc": "#ff0000", "ip": 0, "op": 10,
+                 "ks": { "p": { "a": 1, "k": [ { "t": 0, "s": [25, 25] },
+                                               { "t": 10, "s": [75, 75] } ] } }
+               }
+             ]
+           })";
+
+    const auto baked = Animation::Builder::Bake(json, strlen(json));
+    REPORTER_ASSERT(r, baked);
+    REPORTER_ASSERT(r, !Animation::Builder::Bake("{", 1));
+
+    auto anim = Animation::Make(json, strlen(json));
+    auto bakedAnim = Animation::Builder().make(static_cast<const char*>(baked->data()),
+                                               baked->size());
+    REPORTER_ASSERT(r, anim && bakedAnim);
+    REPORTER_ASSERT(r, bakedAnim->duration() == anim->duration());
+
+    SkBitmap expected, actual;
+    expected.allocN32Pixels(100, 100);
+    actual.allocN32Pixels(100, 100);
+    for (double frame : {0.0, 5.0, 10.0}) {
+        anim->seekFrame(frame);
+        bakedAnim->seekFrame(frame);
+
+        expected.eraseColor(SK_ColorTRANSPARENT);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+        SkCanvas expectedCanvas(expected), actualCanvas(actual);
+        anim->render(&expectedCanvas);
+        bakedAnim->render(&actualCanvas);
+
+        REPORTER_ASSERT(r, 0 == memcmp(expected.getPixels(), actual.getPixels(),
+                                       expected.computeByteSize()), "frame %g", frame);
+    }
+}
@@ -29,6 +29,13 @@ Animator::StateChanged AnimatablePropertyContainer::onSeek(float t) {
     return changed;
 }
 
+void AnimatablePropertyContainer::onPrepare(float t) {
+    // onSync() updates the scene graph, so it waits for the actual seek.
+    for (const auto& animator : fAnimators) {
+        animator->prepare(t);
+    }
+}
+
 void AnimatablePropertyContainer::attachDiscardableAdapter(
         sk_sp<AnimatablePropertyContainer> child) {
     if (!child) {
@@ -33,16 +33,41 @@ class AnimatorBuilder;
 class Animator : public SkRefCnt {
 public:
     using StateChanged = bool;
-    StateChanged seek(float t) { return this->onSeek(t); }
+    StateChanged seek(float t) {
+        if (fPrepared) {
+            fPrepared = false;
+            // Seeking somewhere else must still report the change made by prepare().
+            return t == fPreparedT ? fPreparedChanged
+                                   : this->onSeek(t) || fPreparedChanged;
+        }
+        return this->onSeek(t);
+    }
+
+    // Does the part of seek(t) that doesn't touch the scene graph ahead of time, so that
+    // independent animators can be prepared concurrently. Only keyframe animators (and the
+    // containers and controllers dispatching to them) do anything here.
+    void prepare(float t) { this->onPrepare(t); }
 
 protected:
     Animator() = default;
 
     virtual StateChanged onSeek(float t) = 0;
+    virtual void onPrepare(float) {}
+
+    // For animators which only update their own target values: seeks now, reports at seek(t).
+    void seekAhead(float t) {
+        fPreparedChanged = this->onSeek(t) || (fPrepared && fPreparedChanged);
+        fPreparedT = t;
+        fPrepared = true;
+    }
 
 private:
     Animator(const Animator&) = delete;
     Animator& operator=(const Animator&) = delete;
+
+    float fPreparedT        = 0;
+    bool  fPrepared         = false,
+          fPreparedChanged  = false;
 };
 
 class AnimatablePropertyContainer : public Animator {
@@ -76,6 +101,7 @@ protected:
 
 private:
     StateChanged onSeek(float) final;
+    void onPrepare(float) final;
 
     bool bindImpl(const AnimationBuilder&, const skjson::ObjectValue*, AnimatorBuilder&);
 
@@ -84,6 +84,9 @@ protected:
     LERPInfo getLERPInfo(float t) const;
 
 private:
+    // Keyframe animators only write to their target value.
+    void onPrepare(float t) final { this->seekAhead(t); }
+
     // Two sequential KFRecs determine how the value varies within [kf0 .. kf1)
     struct KFSegment {
         const Keyframe* kf0;
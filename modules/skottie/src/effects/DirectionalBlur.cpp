@@ -13,6 +13,8 @@
 #include "modules/sksg/include/SkSGRenderEffect.h"
 #include "src/utils/SkJSON.h"
 
+#include <cmath>
+
 namespace skottie::internal {
 
 namespace {
@@ -36,11 +38,28 @@ class DirectionalBlurAdapter final : public DiscardableAdapterBase<DirectionalBl
         }
     private:
         void onSync() override {
+            const auto sigma = fBlurLength * kBlurSizeToSigma;
+            if (sigma <= 0) {
+                this->node()->setImageFilter(nullptr);
+                return;
+            }
+
+            // Blurs along either axis don't need the content rotated into place and back, which
+            // would resample it twice.
             const auto rot = fDirection - 90;
+            const auto quadrant = rot / 90;
+            if (quadrant == std::round(quadrant)) {
+                const bool horizontal = SkScalarMod(quadrant, 2) == 0;
+                this->node()->setImageFilter(SkImageFilters::Blur(horizontal ? sigma : 0,
+                                                                  horizontal ? 0 : sigma,
+                                                                  nullptr));
+                return;
+            }
+
             auto filter =
             SkImageFilters::MatrixTransform(SkMatrix::RotateDeg(rot),
             SkSamplingOptions(SkFilterMode::kLinear),
-                SkImageFilters::Blur(fBlurLength * kBlurSizeToSigma, 0,
+                SkImageFilters::Blur(sigma, 0,
                     SkImageFilters::MatrixTransform(SkMatrix::RotateDeg(-rot),
                     SkSamplingOptions(SkFilterMode::kLinear), nullptr)));
             this->node()->setImageFilter(std::move(filter));
@@ -9,11 +9,16 @@
 
 #include "include/core/SkCanvas.h"
 #include "include/core/SkPixmap.h"
+#include "include/private/base/SkFloatingPoint.h"
 #include "include/private/base/SkMath.h"
 #include "modules/skottie/src/animator/Animator.h"
+#include "modules/sksg/include/SkSGInvalidationController.h"
 #include "src/base/SkMathPriv.h"
 #include "src/base/SkVx.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace skottie {
 namespace internal {
 
@@ -45,41 +50,94 @@ sk_sp<MotionBlurEffect> MotionBlurEffect::Make(sk_sp<Animator> animator,
     // shutter_angle is [   0 .. 720], mapped to [ 0 .. 2] (frame space)
     // shutter_phase is [-360 .. 360], mapped to [-1 .. 1] (frame space)
     const auto samples_duration = shutter_angle / 360,
-                          phase = shutter_phase / 360,
-                             dt = samples_duration / (samples_per_frame - 1);
+                          phase = shutter_phase / 360;
 
     return sk_sp<MotionBlurEffect>(new MotionBlurEffect(std::move(animator),
                                                         std::move(child),
                                                         samples_per_frame,
-                                                        phase, dt));
+                                                        phase, samples_duration));
 }
 
 MotionBlurEffect::MotionBlurEffect(sk_sp<Animator> animator,
                                    sk_sp<sksg::RenderNode> child,
-                                   size_t samples, float phase, float dt)
+                                   size_t samples, float phase, float duration)
     : INHERITED({std::move(child)})
     , fAnimator(std::move(animator))
     , fSampleCount(samples)
     , fPhase(phase)
-    , fDT(dt) {}
+    , fDuration(duration) {}
 
 const sksg::RenderNode* MotionBlurEffect::onNodeAt(const SkPoint&) const {
     return nullptr;
 }
 
-SkRect MotionBlurEffect::seekToSample(size_t sample_idx, const SkMatrix& ctm) const {
-    SkASSERT(sample_idx < fSampleCount);
-    fAnimator->seek(fT + fPhase + fDT * sample_idx);
+SkRect MotionBlurEffect::seekToSample(size_t sample_idx, const SkMatrix& ctm,
+                                      sksg::InvalidationController* ic) const {
+    SkASSERT(sample_idx < fActiveSampleCount);
+    // Samples span the whole shutter interval; a lone sample sits in the middle of it.
+    const float t = fActiveSampleCount > 1 ? fDuration * sample_idx / (fActiveSampleCount - 1)
+                                           : fDuration * 0.5f;
+    fAnimator->seek(fT + fPhase + t);
 
     SkASSERT(this->children().size() == 1ul);
-    return this->children()[0]->revalidate(nullptr, ctm);
+    return this->children()[0]->revalidate(ic, ctm);
+}
+
+size_t MotionBlurEffect::adaptiveSampleCount(const SkMatrix& ctm) {
+    // Samples closer together than this, in device pixels, blur no better than fewer would.
+    static constexpr float kMaxSampleDistance = 1;
+
+    fActiveSampleCount = fSampleCount;
+    if (fSampleCount < 2) {
+        return fSampleCount;
+    }
+
+    // Look at the start, middle and end of the shutter interval, collecting any damage the
+    // subtree reports along the way.
+    const auto& child = this->children()[0];
+    sksg::InvalidationController ic;
+    const SkRect first = ctm.mapRect(this->seekToSample(0, ctm));
+    const bool first_visible = child->isVisible();
+    this->seekToSample((fSampleCount - 1) / 2, ctm, &ic);
+    const SkRect last = ctm.mapRect(this->seekToSample(fSampleCount - 1, ctm, &ic));
+    if (!first_visible || !child->isVisible()) {
+        // The content appears or disappears during the interval.
+        return fSampleCount;
+    }
+
+    // Nothing changed, so every sample would be the same.
+    if (ic.bounds().isEmpty()) {
+        return 1;
+    }
+
+    // When the content just moves, its bounds tell how far, and a sample for every pixel it
+    // travels is plenty. Anything else (e.g. rotation or changes within the bounds) can't be
+    // measured this way, so it gets every sample. Content that moves as a whole damages its
+    // whole bounds and nothing smaller, so that's what parts of it changing on their own show as.
+    const auto same_size = [&first](const SkRect& r) {
+        return std::abs(r.width()  - first.width())  < 0.5f &&
+               std::abs(r.height() - first.height()) < 0.5f;
+    };
+    const float motion = std::max(std::abs(last.fLeft - first.fLeft),
+                                  std::abs(last.fTop  - first.fTop));
+    if (!same_size(last) || !std::all_of(ic.begin(), ic.end(), same_size) ||
+        !(motion >= 0.5f) || !SkScalarIsFinite(motion)) {
+        return fSampleCount;
+    }
+    const size_t needed = std::min(SkToSizeT(sk_float_ceil2int(motion / kMaxSampleDistance)) + 1,
+                                   fSampleCount);
+
+    // Keep to powers of two where we can, which take the raster fast path.
+    return std::min(SkToSizeT(SkNextPow2(SkToInt(needed))), fSampleCount);
 }
 
 SkRect MotionBlurEffect::onRevalidate(sksg::InvalidationController*, const SkMatrix& ctm) {
     SkRect bounds       = SkRect::MakeEmpty();
+    // Each sample re-renders the whole subtree, so only take as many as the motion needs.
+    fActiveSampleCount  = this->adaptiveSampleCount(ctm);
     fVisibleSampleCount = 0;
 
-    for (size_t i = 0; i < fSampleCount; ++i) {
+    for (size_t i = 0; i < fActiveSampleCount; ++i) {
         bounds.join(this->seekToSample(i, ctm));
         fVisibleSampleCount += SkToSizeT(this->children()[0]->isVisible());
     }
@@ -114,7 +172,7 @@ void MotionBlurEffect::renderToRaster8888Pow2Samples(SkCanvas* canvas,
 
     SkDEBUGCODE(size_t frames_rendered = 0;)
     bool needs_clear = false;  // Cleared initially by saveLayer().
-    for (size_t i = 0; i < fSampleCount; ++i) {
+    for (size_t i = 0; i < fActiveSampleCount; ++i) {
         this->seekToSample(i, canvas->getTotalMatrix());
 
         if (!child->isVisible()) {
@@ -198,6 +256,12 @@ void MotionBlurEffect::onRender(SkCanvas* canvas, const RenderContext* ctx) cons
     SkASSERT(this->children().size() == 1ul);
     const auto& child = this->children()[0];
 
+    if (fActiveSampleCount == 1) {
+        // The subtree doesn't change over the shutter interval; onRevalidate() left it there.
+        child->render(canvas, ctx);
+        return;
+    }
+
     // We're about to mutate/revalidate the subtree for sampling.  Capture the invalidation
     // at this scope, to prevent dirtying ancestor SG nodes (no way to revalidate the global scene).
     AutoInvalBlocker aib(this, child);
@@ -232,7 +296,7 @@ void MotionBlurEffect::onRender(SkCanvas* canvas, const RenderContext* ctx) cons
     }
 
     SkDEBUGCODE(size_t frames_rendered = 0;)
-    for (size_t i = 0; i < fSampleCount; ++i) {
+    for (size_t i = 0; i < fActiveSampleCount; ++i) {
         this->seekToSample(i, canvas->getTotalMatrix());
 
         if (!child->isVisible()) {
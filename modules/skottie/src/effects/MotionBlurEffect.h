@@ -35,19 +35,23 @@ private:
 
     void renderToRaster8888Pow2Samples(SkCanvas* canvas, const RenderContext* ctx) const;
 
-    SkRect seekToSample(size_t sample_idx, const SkMatrix& ctm) const;
+    SkRect seekToSample(size_t sample_idx, const SkMatrix& ctm,
+                        sksg::InvalidationController* ic = nullptr) const;
+
+    size_t adaptiveSampleCount(const SkMatrix& ctm);
 
     MotionBlurEffect(sk_sp<Animator> animator,
                      sk_sp<sksg::RenderNode> child,
-                     size_t sample_count, float phase, float dt);
+                     size_t sample_count, float phase, float duration);
 
     const sk_sp<Animator> fAnimator;
-    const size_t          fSampleCount;
+    const size_t          fSampleCount;  // The most samples we take
     const float           fPhase,
-                          fDT;
+                          fDuration;
 
     float  fT                  = 0;
-    size_t fVisibleSampleCount = 0;
+    size_t fActiveSampleCount  = 0,  // The samples we take for the current frame
+           fVisibleSampleCount = 0;
 
     using INHERITED = sksg::CustomRenderNode;
 };
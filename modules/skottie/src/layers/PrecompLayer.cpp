@@ -8,6 +8,11 @@
 #include "modules/skottie/src/SkottiePriv.h"
 
 #include "include/core/SkCanvas.h"
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/core/SkSurface.h"
 #include "modules/skottie/include/ExternalLayer.h"
 #include "modules/skottie/src/Composition.h"
 #include "modules/skottie/src/SkottieJson.h"
@@ -53,6 +58,18 @@ public:
         , fTimeBias(time_bias)
         , fTimeScale(time_scale) {}
 
+    void onPrepare(float t) override {
+        // The remapped time is only known after seeking the remapper.
+        if (fRemapper) {
+            return;
+        }
+
+        t = (t + fTimeBias) * fTimeScale;
+        for (const auto& anim : fAnimators) {
+            anim->prepare(t);
+        }
+    }
+
     StateChanged onSeek(float t) override {
         if (fRemapper) {
             // When time remapping is active, |t| is fully driven externally.
@@ -78,6 +95,127 @@ private:
                               fTimeScale;
 };
 
+// Draws static precomp content (no animators) from a device-space image cache.
+//
+// The cache is dropped when the content is invalidated externally (e.g. via property
+// observers or slots), or when the device transform changes beyond a translation.
+// To avoid thrashing on animated scale/rotation, the content is only rasterized after
+// the same transform is observed on two consecutive renders.
+class CachedPrecompNode final : public sksg::CustomRenderNode {
+public:
+    explicit CachedPrecompNode(sk_sp<sksg::RenderNode> content)
+        : INHERITED({std::move(content)}) {}
+
+private:
+    // Larger content is not worth the memory - it is rendered directly.
+    static constexpr int kMaxCacheDimension = 2048;
+
+    static bool SameScaleSkew(const SkMatrix& a, const SkMatrix& b) {
+        return a.getScaleX() == b.getScaleX() && a.getSkewX()  == b.getSkewX() &&
+               a.getSkewY()  == b.getSkewY()  && a.getScaleY() == b.getScaleY();
+    }
+
+    SkRect onRevalidate(sksg::InvalidationController* ic, const SkMatrix& ctm) override {
+        SkASSERT(this->children().size() == 1ul);
+
+        if (this->hasChildrenInval()) {
+            fImage = nullptr;
+        }
+
+        return this->children()[0]->revalidate(ic, ctm);
+    }
+
+    void onRender(SkCanvas* canvas, const RenderContext* ctx) const override {
+        if (!this->renderCached(canvas, ctx)) {
+            this->children()[0]->render(canvas, ctx);
+        }
+    }
+
+    const RenderNode* onNodeAt(const SkPoint& p) const override {
+        return this->children()[0]->nodeAt(p);
+    }
+
+    bool renderCached(SkCanvas* canvas, const RenderContext* ctx) const {
+        // Shader overrides cannot be applied to image draws.
+        if (ctx && (ctx->fShader || ctx->fMaskShader)) {
+            return false;
+        }
+
+        const auto ctm = canvas->getTotalMatrix();
+        if (ctm.hasPerspective()) {
+            return false;
+        }
+
+        if (!fImage || !SameScaleSkew(ctm, fImageCTM)) {
+            fImage = nullptr;
+
+            if (!SameScaleSkew(ctm, fPendingCTM)) {
+                fPendingCTM = ctm;
+                return false;
+            }
+
+            if (!this->rasterize(canvas, ctm)) {
+                return false;
+            }
+        }
+
+        SkPaint paint;
+        if (ctx) {
+            // The image is drawn in device space.
+            ctx->modulatePaint(SkMatrix::I(), &paint);
+        }
+
+        const auto dx = ctm.getTranslateX() - fImageCTM.getTranslateX(),
+                   dy = ctm.getTranslateY() - fImageCTM.getTranslateY();
+
+        SkAutoCanvasRestore acr(canvas, true);
+        canvas->resetMatrix();
+        canvas->drawImage(fImage, fImageOrigin.fX + dx, fImageOrigin.fY + dy,
+                          SkSamplingOptions(SkFilterMode::kLinear), &paint);
+
+        return true;
+    }
+
+    bool rasterize(SkCanvas* canvas, const SkMatrix& ctm) const {
+        // Outset to account for AA fringes.
+        const auto dev_bounds = ctm.mapRect(this->bounds()).makeOutset(1, 1).roundOut();
+        if (dev_bounds.isEmpty() ||
+            dev_bounds.width()  > kMaxCacheDimension ||
+            dev_bounds.height() > kMaxCacheDimension) {
+            return false;
+        }
+
+        // Matches the destination backend (raster or GPU).  Recording canvases don't support
+        // this, which conveniently keeps pictures free of rasterized content.
+        auto surface = canvas->makeSurface(
+                SkImageInfo::MakeN32Premul(dev_bounds.size(),
+                                           canvas->imageInfo().refColorSpace()));
+        if (!surface) {
+            return false;
+        }
+
+        auto* cache_canvas = surface->getCanvas();
+        cache_canvas->clear(SK_ColorTRANSPARENT);
+        cache_canvas->translate(-dev_bounds.x(), -dev_bounds.y());
+        cache_canvas->concat(ctm);
+        this->children()[0]->render(cache_canvas);
+
+        fImage       = surface->makeImageSnapshot();
+        fImageCTM    = ctm;
+        fImageOrigin = SkPoint::Make(dev_bounds.x(), dev_bounds.y());
+
+        return fImage != nullptr;
+    }
+
+    // These are computed/cached at render time.
+    mutable sk_sp<SkImage> fImage;
+    mutable SkMatrix       fImageCTM,
+                           fPendingCTM;
+    mutable SkPoint        fImageOrigin = {0, 0};
+
+    using INHERITED = sksg::CustomRenderNode;
+};
+
 } // namespace
 
 sk_sp<sksg::RenderNode> AnimationBuilder::attachExternalPrecompLayer(
@@ -197,9 +335,17 @@ sk_sp<sksg::RenderNode> AnimationBuilder::attachPrecompLayer(const skjson::Objec
                 layer_info->fSize = parse_size(*precomp_asset);
             }
 
+            const auto animator_count = fCurrentAnimatorScope->size();
+
             AutoPropertyTracker apt(this, *precomp_asset, PropertyObserver::NodeType::COMPOSITION);
             precomp_layer =
                 CompositionBuilder(*this, layer_info->fSize, *precomp_asset).build(*this);
+
+            // Precomps which didn't add any animators have static content.
+            if (precomp_layer && (fFlags & Animation::Builder::kCacheStaticPrecomps) &&
+                fCurrentAnimatorScope->size() == animator_count) {
+                precomp_layer = sk_make_sp<CachedPrecompNode>(std::move(precomp_layer));
+            }
         }
     }
 
@@ -26,6 +26,8 @@
 #include "modules/sksg/include/SkSGTransform.h"
 #include "modules/sksg/src/SkSGTransformPriv.h"
 
+#include <algorithm>
+
 // Enable for text layout debugging.
 #define SHOW_LAYOUT_BOXES 0
 
@@ -77,6 +79,19 @@ static float align_factor(SkTextUtils::Align a) {
     SkUNREACHABLE;
 }
 
+// Paint colors and stroke width don't change how text is shaped, so values that differ only in
+// those share a shaping result.
+static TextValue shaping_key(const TextValue& txt) {
+    TextValue key = txt;
+    key.fFillColor   = SK_ColorTRANSPARENT;
+    key.fStrokeColor = SK_ColorTRANSPARENT;
+    key.fStrokeWidth = 0;
+    return key;
+}
+
+// Text documents are keyframed as discrete values, so only a handful of them are usually in play.
+static constexpr size_t kMaxCachedShapes = 8;
+
 } // namespace
 
 class TextAdapter::GlyphDecoratorNode final : public sksg::Group {
@@ -630,7 +645,18 @@ uint32_t TextAdapter::shaperFlags() const {
     return flags;
 }
 
-void TextAdapter::reshape() {
+Shaper::Result TextAdapter::shapeText() {
+    const uint32_t flags = this->shaperFlags();
+    TextValue key = shaping_key(fText.fCurrentValue);
+
+    for (auto entry = fShapeCache.begin(); entry != fShapeCache.end(); ++entry) {
+        if (entry->fFlags == flags && entry->fText == key) {
+            // Move it to the back, as the most recently used.
+            std::rotate(entry, entry + 1, fShapeCache.end());
+            return fShapeCache.back().fResult;
+        }
+    }
+
     // AE clamps the font size to a reasonable range.
     // We do the same, since HB is susceptible to int overflows for degenerate values.
     static constexpr float kMinSize =    0.1f,
@@ -650,7 +676,7 @@ void TextAdapter::reshape() {
         fText->fDirection,
         fText->fCapitalization,
         fText->fMaxLines,
-        this->shaperFlags(),
+        flags,
         fText->fLocale.isEmpty()     ? nullptr : fText->fLocale.c_str(),
         fText->fFontFamily.isEmpty() ? nullptr : fText->fFontFamily.c_str(),
     };
@@ -676,6 +702,18 @@ void TextAdapter::reshape() {
         }
     }
 
+    if (fShapeCache.size() == kMaxCachedShapes) {
+        fShapeCache.erase(fShapeCache.begin());
+    }
+    fShapeCache.push_back({std::move(key), flags, shape_result});
+
+    return shape_result;
+}
+
+void TextAdapter::reshape() {
+    // The fragments are ours to consume: addFragment() moves the glyphs out of them.
+    auto shape_result = this->shapeText();
+
     // Save the text shaping scale for later adjustments.
     fTextShapingScale = shape_result.fScale;
 
@@ -74,6 +74,7 @@ private:
                                      fAscent;  // ^
     };
 
+    Shaper::Result shapeText();
     void reshape();
     void addFragment(Shaper::Fragment&, sksg::Group* container);
     void buildDomainMaps(const Shaper::Result&);
@@ -118,6 +119,16 @@ private:
     };
 
     TextValueTracker          fText;
+
+    // Shaping results for the text values we've shaped most recently (the last one is the most
+    // recent), so text documents that animate back and forth don't get shaped again every time.
+    struct ShapeCacheEntry {
+        TextValue      fText;   // as keyed by shaping_key()
+        uint32_t       fFlags;
+        Shaper::Result fResult;
+    };
+    std::vector<ShapeCacheEntry> fShapeCache;
+
     Vec2Value                 fGroupingAlignment = {0,0};
     float                     fTextShapingScale  = 1;     // size adjustment from auto-scaling
 
@@ -34,6 +34,8 @@ public:
 
     const T& operator()(float t) { this->seek(t); return fValue; }
 
+    const T& value() const { return fValue; }
+
 private:
     void onSync() override {}
 
@@ -168,3 +170,26 @@ DEF_TEST(Skottie_Keyframe, reporter) {
         REPORTER_ASSERT(reporter, SkScalarNearlyEqual(prop(0).y, 2));
     }
 }
+
+DEF_TEST(Skottie_Keyframe_Prepare, reporter) {
+    MockProperty<ScalarValue> prop(R"({
+                                     "a": 1,
+                                     "k": [
+                                       { "t":  1, "s": 1 },
+                                       { "t":  2, "s": 2 }
+                                     ]
+                                   })");
+    REPORTER_ASSERT(reporter, prop);
+    REPORTER_ASSERT(reporter, prop.seek(0));
+
+    // prepare() computes the value, and the following seek() reports the change.
+    prop.prepare(1.5f);
+    REPORTER_ASSERT(reporter, SkScalarNearlyEqual(prop.value(), 1.5f));
+    REPORTER_ASSERT(reporter, prop.seek(1.5f));
+    REPORTER_ASSERT(reporter, !prop.seek(1.5f));
+
+    // Seeking to another time than the prepared one reports the prepared change too.
+    prop.prepare(2);
+    REPORTER_ASSERT(reporter, prop.seek(1.5f));
+    REPORTER_ASSERT(reporter, SkScalarNearlyEqual(prop.value(), 1.5f));
+}
@@ -10,6 +10,7 @@
 #include <unordered_set>
 
 class SkCanvas;
+class SkExecutor;
 
 namespace skia {
 namespace textlayout {
@@ -41,6 +42,13 @@ public:
 
     virtual void layout(SkScalar width) = 0;
 
+    // Lays out each paragraph at the width with the same index, running the layouts on the
+    // executor (or on the calling thread if it's null), and returns when all of them are done.
+    // The paragraphs can share a FontCollection, but each one has to be laid out only once here.
+    static void LayoutParagraphs(SkSpan<Paragraph* const> paragraphs,
+                                 SkSpan<const SkScalar> widths,
+                                 SkExecutor* executor);
+
     virtual void paint(SkCanvas* canvas, SkScalar x, SkScalar y) = 0;
 
     virtual void paint(ParagraphPainter* painter, SkScalar x, SkScalar y) = 0;
@@ -80,6 +88,12 @@ public:
     virtual void updateForegroundPaint(size_t from, size_t to, SkPaint paint) = 0;
     virtual void updateBackgroundPaint(size_t from, size_t to, SkPaint paint) = 0;
 
+    // Experimental API for text editing: the next layout reuses the shaped runs of the previous
+    // (laid out) version of this paragraph for the text that didn't change, so that only the
+    // chunks around an edit are shaped again. Both paragraphs need incremental shaping
+    // turned on in their ParagraphStyle; otherwise this does nothing.
+    virtual void reuseShapingFrom(const Paragraph& previous) = 0;
+
     enum VisitorFlags {
         kWhiteSpace_VisitorFlag = 1 << 0,
     };
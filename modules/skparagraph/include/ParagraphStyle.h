@@ -84,7 +84,8 @@ struct ParagraphStyle {
                this->fEllipsisUtf16 == rhs.fEllipsisUtf16 &&
                this->fTextDirection == rhs.fTextDirection && this->fTextAlign == rhs.fTextAlign &&
                this->fDefaultTextStyle == rhs.fDefaultTextStyle &&
-               this->fReplaceTabCharacters == rhs.fReplaceTabCharacters;
+               this->fReplaceTabCharacters == rhs.fReplaceTabCharacters &&
+               this->fIncrementalShaping == rhs.fIncrementalShaping;
     }
 
     const StrutStyle& getStrutStyle() const { return fStrutStyle; }
@@ -127,6 +128,12 @@ struct ParagraphStyle {
     bool getApplyRoundingHack() const { return fApplyRoundingHack; }
     void setApplyRoundingHack(bool value) { fApplyRoundingHack = value; }
 
+    // Shapes the text in chunks that end after a whitespace, so that a paragraph built after an
+    // edit can reuse the shaping of the chunks that didn't change (see
+    // Paragraph::reuseShapingFrom). Kerning across the chunk boundaries is lost.
+    bool getIncrementalShaping() const { return fIncrementalShaping; }
+    void setIncrementalShaping(bool value) { fIncrementalShaping = value; }
+
 private:
     StrutStyle fStrutStyle;
     TextStyle fDefaultTextStyle;
@@ -140,6 +147,7 @@ private:
     bool fHintingIsOn;
     bool fReplaceTabCharacters;
     bool fApplyRoundingHack = true;
+    bool fIncrementalShaping = false;
 };
 }  // namespace textlayout
 }  // namespace skia
@@ -2,6 +2,7 @@
 
 #include "modules/skparagraph/src/Iterators.h"
 #include "modules/skparagraph/src/OneLineShaper.h"
+#include "include/private/base/SkTo.h"
 #include "src/base/SkUTF.h"
 
 #include <algorithm>
@@ -553,7 +554,11 @@ bool OneLineShaper::iterateThroughShapingRegions(const ShapeVisitor& shape) {
                     SkSpan<Block> styleSpan(fParagraph->blocks(blockRange));
 
                     // Shape the text between placeholders
-                    if (!shape(textRange, styleSpan, advanceX, start, bidiRegion.level)) {
+                    if (fParagraph->paragraphStyle().getIncrementalShaping()) {
+                        if (!shapeInChunks(textRange, bidiRegion.level, advanceX, shape)) {
+                            return false;
+                        }
+                    } else if (!shape(textRange, styleSpan, advanceX, start, bidiRegion.level)) {
                         return false;
                     }
                 }
@@ -607,6 +612,49 @@ bool OneLineShaper::iterateThroughShapingRegions(const ShapeVisitor& shape) {
     return true;
 }
 
+// Shapes the text in chunks that end after a whitespace (on a soft line break),
+// taking the chunks that the paragraph can reuse from the previous version of it
+bool OneLineShaper::shapeInChunks(TextRange textRange,
+                                  uint8_t bidiLevel,
+                                  SkScalar& advanceX,
+                                  const ShapeVisitor& shape) {
+    auto chunkStart = textRange.start;
+    while (chunkStart < textRange.end) {
+        auto chunkEnd = chunkStart + 1;
+        while (chunkEnd < textRange.end &&
+               !(fParagraph->codeUnitHasProperty(chunkEnd,
+                                                 SkUnicode::CodeUnitFlags::kSoftLineBreakBefore) &&
+                 fParagraph->codeUnitHasProperty(chunkEnd - 1,
+                                                 SkUnicode::CodeUnitFlags::kPartOfWhiteSpaceBreak))) {
+            ++chunkEnd;
+        }
+
+        TextRange chunk(chunkStart, chunkEnd);
+        SkSpan<Block> styleSpan(fParagraph->blocks(fParagraph->findAllBlocks(chunk)));
+        if (!fParagraph->reuseShapedChunk(chunk, styleSpan, bidiLevel, advanceX)) {
+            auto firstRun = fParagraph->fRuns.size();
+            auto startX = advanceX;
+            auto unresolvedGlyphs = fUnresolvedGlyphs;
+            if (!shape(chunk, styleSpan, advanceX, chunkStart, bidiLevel)) {
+                return false;
+            }
+            // Chunks with unresolved glyphs or more than one style are not reused
+            auto block = styleSpan.size() == 1 && unresolvedGlyphs == fUnresolvedGlyphs
+                    ? SkToSizeT(styleSpan.data() - fParagraph->fTextStyles.data())
+                    : EMPTY_BLOCK;
+            fParagraph->fShapedChunks.push_back({chunk,
+                                                 bidiLevel,
+                                                 block,
+                                                 firstRun,
+                                                 fParagraph->fRuns.size() - firstRun,
+                                                 startX,
+                                                 advanceX - startX});
+        }
+        chunkStart = chunkEnd;
+    }
+    return true;
+}
+
 bool OneLineShaper::shape() {
 
     // The text can be broken into many shaping sequences
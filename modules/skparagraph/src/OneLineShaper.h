@@ -64,6 +64,10 @@ private:
     using ShapeVisitor =
             std::function<SkScalar(TextRange textRange, SkSpan<Block>, SkScalar&, TextIndex, uint8_t)>;
     bool iterateThroughShapingRegions(const ShapeVisitor& shape);
+    bool shapeInChunks(TextRange textRange,
+                       uint8_t bidiLevel,
+                       SkScalar& advanceX,
+                       const ShapeVisitor& shape);
 
     using ShapeSingleFontVisitor =
             std::function<void(Block, skia_private::TArray<SkShaper::Feature>)>;
@@ -70,6 +70,7 @@ public:
     ParagraphCacheValue(ParagraphCacheKey&& key, const ParagraphImpl* paragraph)
         : fKey(std::move(key))
         , fRuns(paragraph->fRuns)
+        , fShapedChunks(paragraph->fShapedChunks)
         , fClusters(paragraph->fClusters)
         , fClustersIndexFromCodeUnit(paragraph->fClustersIndexFromCodeUnit)
         , fCodeUnitProperties(paragraph->fCodeUnitProperties)
@@ -84,6 +85,7 @@ public:
 
     // Shaped results
     TArray<Run, false> fRuns;
+    TArray<ShapedChunk, true> fShapedChunks;
     TArray<Cluster, true> fClusters;
     TArray<size_t, true> fClustersIndexFromCodeUnit;
     // ICU results
@@ -143,6 +145,7 @@ uint32_t ParagraphCacheKey::computeHash() const {
     hash = mix(hash, SkGoodHash()(relax(fParagraphStyle.getHeight())));
     hash = mix(hash, SkGoodHash()(fParagraphStyle.getTextDirection()));
     hash = mix(hash, SkGoodHash()(fParagraphStyle.getReplaceTabCharacters() ? 1 : 0));
+    hash = mix(hash, SkGoodHash()(fParagraphStyle.getIncrementalShaping() ? 1 : 0));
 
     auto& strutStyle = fParagraphStyle.getStrutStyle();
     if (strutStyle.getStrutEnabled()) {
@@ -195,6 +198,10 @@ bool ParagraphCacheKey::operator==(const ParagraphCacheKey& other) const {
         return false;
     }
 
+    if (fParagraphStyle.getIncrementalShaping() != other.fParagraphStyle.getIncrementalShaping()) {
+        return false;
+    }
+
     for (int i = 0; i < fTextStyles.size(); ++i) {
         auto& tsa = fTextStyles[i];
         auto& tsb = other.fTextStyles[i];
@@ -255,6 +262,7 @@ void ParagraphCache::updateTo(ParagraphImpl* paragraph, const Entry* entry) {
 
     paragraph->fRuns.clear();
     paragraph->fRuns = entry->fValue->fRuns;
+    paragraph->fShapedChunks = entry->fValue->fShapedChunks;
     paragraph->fClusters = entry->fValue->fClusters;
     paragraph->fClustersIndexFromCodeUnit = entry->fValue->fClustersIndexFromCodeUnit;
     paragraph->fCodeUnitProperties = entry->fValue->fCodeUnitProperties;
@@ -300,11 +308,12 @@ bool ParagraphCache::findParagraph(ParagraphImpl* paragraph) {
     if (!fCacheIsOn) {
         return false;
     }
+    // Build (and hash) the key before taking the lock
+    ParagraphCacheKey key(paragraph);
+    SkAutoMutexExclusive lock(fParagraphMutex);
 #ifdef PARAGRAPH_CACHE_STATS
     ++fTotalRequests;
 #endif
-    SkAutoMutexExclusive lock(fParagraphMutex);
-    ParagraphCacheKey key(paragraph);
     std::unique_ptr<Entry>* entry = fLRUCacheMap.find(key);
 
     if (!entry) {
@@ -324,12 +333,12 @@ bool ParagraphCache::updateParagraph(ParagraphImpl* paragraph) {
     if (!fCacheIsOn) {
         return false;
     }
+    ParagraphCacheKey key(paragraph);
+    SkAutoMutexExclusive lock(fParagraphMutex);
 #ifdef PARAGRAPH_CACHE_STATS
     ++fTotalRequests;
 #endif
-    SkAutoMutexExclusive lock(fParagraphMutex);
 
-    ParagraphCacheKey key(paragraph);
     std::unique_ptr<Entry>* entry = fLRUCacheMap.find(key);
     if (!entry) {
         // isTooMuchMemoryWasted(paragraph) not needed for now
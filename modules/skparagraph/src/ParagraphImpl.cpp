@@ -20,6 +20,7 @@
 #include "modules/skparagraph/src/TextLine.h"
 #include "modules/skparagraph/src/TextWrapper.h"
 #include "src/base/SkUTF.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkTextBlobPriv.h"
 
 #include <algorithm>
@@ -69,6 +70,24 @@ Paragraph::Paragraph(ParagraphStyle style, sk_sp<FontCollection> fonts)
     SkASSERT(fFontCollection);
 }
 
+void Paragraph::LayoutParagraphs(SkSpan<Paragraph* const> paragraphs,
+                                 SkSpan<const SkScalar> widths,
+                                 SkExecutor* executor) {
+    SkASSERT(paragraphs.size() == widths.size());
+    if (!executor) {
+        for (size_t i = 0; i < paragraphs.size(); ++i) {
+            paragraphs[i]->layout(widths[i]);
+        }
+        return;
+    }
+
+    SkTaskGroup taskGroup(*executor);
+    taskGroup.batch(SkToInt(paragraphs.size()), [&](int i) {
+        paragraphs[i]->layout(widths[i]);
+    });
+    taskGroup.wait();
+}
+
 ParagraphImpl::ParagraphImpl(const SkString& text,
                              ParagraphStyle style,
                              TArray<Block, true> blocks,
@@ -165,6 +184,7 @@ void ParagraphImpl::layout(SkScalar rawWidth) {
                 }
             }
             this->fRuns.clear();
+            this->fShapedChunks.clear();
             this->fClusters.clear();
             this->fClustersIndexFromCodeUnit.clear();
             this->fClustersIndexFromCodeUnit.push_back_n(fText.size() + 1, EMPTY_INDEX);
@@ -553,6 +573,7 @@ bool ParagraphImpl::shapeTextIntoEndlessLine() {
     OneLineShaper oneLineShaper(this);
     auto result = oneLineShaper.shape();
     fUnresolvedGlyphs = oneLineShaper.unresolvedGlyphs();
+    fReusableChunks.reset();
 
     this->applySpacingAndBuildClusterTable();
 
@@ -1092,6 +1113,71 @@ void ParagraphImpl::updateBackgroundPaint(size_t from, size_t to, SkPaint paint)
     }
 }
 
+void ParagraphImpl::reuseShapingFrom(const Paragraph& previous) {
+    const auto& impl = static_cast<const ParagraphImpl&>(previous);
+    fReusableChunks.reset();
+    if (!fParagraphStyle.getIncrementalShaping() || impl.fState < kShaped || this == &impl) {
+        return;
+    }
+
+    for (const auto& chunk : impl.fShapedChunks) {
+        // Letter and word spacing are applied to the runs after shaping
+        if (chunk.fBlock == EMPTY_BLOCK ||
+            impl.fTextStyles[chunk.fBlock].fStyle.getLetterSpacing() != 0 ||
+            impl.fTextStyles[chunk.fBlock].fStyle.getWordSpacing() != 0) {
+            continue;
+        }
+        ReusableChunk reusable{impl.fTextStyles[chunk.fBlock].fStyle,
+                               chunk.fBidiLevel,
+                               chunk.fWidth,
+                               {}};
+        reusable.fRuns.reserve(chunk.fRunCount);
+        for (size_t i = 0; i < chunk.fRunCount; ++i) {
+            const Run& run = impl.fRuns[chunk.fFirstRun + i];
+            reusable.fRuns.emplace_back(run, nullptr, 0, run.fTextRange.start - chunk.fText.start,
+                                        run.fOffset.fX - chunk.fStartX);
+        }
+        fReusableChunks.set(SkString(impl.fText.c_str() + chunk.fText.start, chunk.fText.width()),
+                            std::move(reusable));
+    }
+}
+
+bool ParagraphImpl::reuseShapedChunk(TextRange textRange,
+                                     SkSpan<Block> styleSpan,
+                                     uint8_t bidiLevel,
+                                     SkScalar& advanceX) {
+    if (fReusableChunks.count() == 0 || styleSpan.size() != 1) {
+        return false;
+    }
+    const TextStyle& style = styleSpan.front().fStyle;
+    const ReusableChunk* chunk =
+            fReusableChunks.find(SkString(fText.c_str() + textRange.start, textRange.width()));
+    // The line height and the leading are the only things the runs remember from the style
+    // that equalsByFonts doesn't compare
+    if (!chunk || chunk->fBidiLevel != bidiLevel || !chunk->fStyle.equalsByFonts(style) ||
+        chunk->fStyle.getHeightOverride() != style.getHeightOverride() ||
+        chunk->fStyle.getHalfLeading() != style.getHalfLeading()) {
+        return false;
+    }
+
+    const RunIndex firstRun = fRuns.size();
+    for (const Run& run : chunk->fRuns) {
+        auto& copy = fRuns.emplace_back(run, this, fRuns.size(),
+                                        textRange.start + run.fTextRange.start,
+                                        advanceX + run.fOffset.fX);
+        fFontSwitches.emplace_back(copy.fTextRange.start, copy.fFont);
+    }
+    fShapedChunks.push_back({textRange,
+                             bidiLevel,
+                             SkToSizeT(styleSpan.data() - fTextStyles.data()),
+                             firstRun,
+                             SkToSizeT(chunk->fRuns.size()),
+                             advanceX,
+                             chunk->fWidth});
+    advanceX += chunk->fWidth;
+    return true;
+}
+
 TArray<TextIndex> ParagraphImpl::countSurroundingGraphemes(TextRange textRange) const {
     textRange = textRange.intersection({0, fText.size()});
     TArray<TextIndex> graphemes;
@@ -68,6 +68,17 @@ struct ResolvedFontDescriptor {
     TextIndex fTextStart;
 };
 
+// A piece of text that was shaped on its own with incremental shaping
+struct ShapedChunk {
+    TextRange fText;
+    uint8_t fBidiLevel;
+    BlockIndex fBlock;      // The only block the chunk is in, or EMPTY_BLOCK
+    RunIndex fFirstRun;
+    size_t fRunCount;
+    SkScalar fStartX;
+    SkScalar fWidth;
+};
+
 enum InternalState {
   kUnknown = 0,
   kIndexed = 1,     // Text is indexed
@@ -207,6 +218,7 @@ public:
     void updateFontSize(size_t from, size_t to, SkScalar fontSize) override;
     void updateForegroundPaint(size_t from, size_t to, SkPaint paint) override;
     void updateBackgroundPaint(size_t from, size_t to, SkPaint paint) override;
+    void reuseShapingFrom(const Paragraph& previous) override;
 
     void visit(const Visitor&) override;
     void extendedVisit(const ExtendedVisitor&) override;
@@ -257,6 +269,12 @@ private:
 
     void computeEmptyMetrics();
 
+    // Adds the runs of a chunk with the same text from reuseShapingFrom instead of shaping it
+    bool reuseShapedChunk(TextRange textRange,
+                          SkSpan<Block> styleSpan,
+                          uint8_t bidiLevel,
+                          SkScalar& advanceX);
+
     // Input
     skia_private::TArray<StyleBlock<SkScalar>> fLetterSpaceStyles;
     skia_private::TArray<StyleBlock<SkScalar>> fWordSpaceStyles;
@@ -271,6 +289,7 @@ private:
     // Internal structures
     InternalState fState;
     skia_private::TArray<Run, false> fRuns;         // kShaped
+    skia_private::TArray<ShapedChunk, true> fShapedChunks; // kShaped (incremental shaping only)
     skia_private::TArray<Cluster, true> fClusters;  // kClusterized (cached: text, word spacing, letter spacing, resolved fonts)
     skia_private::TArray<SkUnicode::CodeUnitFlags, true> fCodeUnitProperties;
     skia_private::TArray<size_t, true> fClustersIndexFromCodeUnit;
@@ -300,6 +319,15 @@ private:
     bool fHasLineBreaks;
     bool fHasWhitespacesInside;
     TextIndex fTrailingSpaces;
+
+    // The chunks of the previous paragraph by their text (until the next shaping)
+    struct ReusableChunk {
+        TextStyle fStyle;
+        uint8_t fBidiLevel;
+        SkScalar fWidth;
+        skia_private::TArray<Run, false> fRuns;
+    };
+    skia_private::THashMap<SkString, ReusableChunk> fReusableChunks;
 };
 }  // namespace textlayout
 }  // namespace skia
@@ -58,6 +58,43 @@ Run::Run(ParagraphImpl* owner,
     fPlaceholderIndex = std::numeric_limits<size_t>::max();
 }
 
+Run::Run(const Run& run,
+         ParagraphImpl* owner,
+         size_t index,
+         TextIndex textStart,
+         SkScalar offsetX)
+    : fOwner(owner)
+    , fTextRange(textStart, textStart + run.fTextRange.width())
+    , fClusterRange(EMPTY_CLUSTERS)
+    , fFont(run.fFont)
+    , fPlaceholderIndex(run.fPlaceholderIndex)
+    , fIndex(index)
+    , fAdvance(run.fAdvance)
+    , fOffset(SkVector::Make(offsetX, run.fOffset.fY))
+    , fClusterStart(textStart - (run.fTextRange.start - run.fClusterStart))
+    , fUtf8Range(run.fUtf8Range)
+    // The positions have to move with the run, so the glyph data can't be shared
+    , fGlyphData(std::make_shared<GlyphData>(*run.fGlyphData))
+    , fGlyphs(fGlyphData->glyphs)
+    , fPositions(fGlyphData->positions)
+    , fOffsets(fGlyphData->offsets)
+    , fClusterIndexes(fGlyphData->clusterIndexes)
+    , fFontMetrics(run.fFontMetrics)
+    , fHeightMultiplier(run.fHeightMultiplier)
+    , fUseHalfLeading(run.fUseHalfLeading)
+    , fBaselineShift(run.fBaselineShift)
+    , fCorrectAscent(run.fCorrectAscent)
+    , fCorrectDescent(run.fCorrectDescent)
+    , fCorrectLeading(run.fCorrectLeading)
+    , fEllipsis(run.fEllipsis)
+    , fBidiLevel(run.fBidiLevel)
+{
+    const SkScalar shiftX = offsetX - run.fOffset.fX;
+    for (auto& position : fPositions) {
+        position.fX += shiftX;
+    }
+}
+
 void Run::calculateMetrics() {
     fCorrectAscent = fFontMetrics.fAscent - fFontMetrics.fLeading * 0.5;
     fCorrectDescent = fFontMetrics.fDescent + fFontMetrics.fLeading * 0.5;
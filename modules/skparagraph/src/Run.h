@@ -62,6 +62,13 @@ public:
         SkScalar baselineShift,
         size_t index,
         SkScalar shiftX);
+    // Moves a copy of the run shaped for the same text to another place in the paragraph
+    // (the text starting at textStart, and the line at offsetX).
+    Run(const Run& run,
+        ParagraphImpl* owner,
+        size_t index,
+        TextIndex textStart,
+        SkScalar offsetX);
     Run(const Run&) = default;
     Run& operator=(const Run&) = delete;
     Run(Run&&) = default;
@@ -7,6 +7,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkFontStyle.h"
 #include "include/core/SkPaint.h"
@@ -8041,3 +8042,101 @@ UNIX_ONLY_TEST(SkParagraph_EmojiRuns, reporter) {
     test("👋🏼", 128075); // Modifier sequence
     test("👨‍👩‍👧‍👦", 128104); // ZWJ sequence
 }
+
+UNIX_ONLY_TEST(SkParagraph_IncrementalShaping, reporter) {
+    sk_sp<ResourceFontCollection> fontCollection = sk_make_sp<ResourceFontCollection>();
+    SKIP_IF_FONTS_NOT_FOUND(reporter, fontCollection)
+    fontCollection->getParagraphCache()->turnOn(false);
+
+    ParagraphStyle paragraph_style;
+    paragraph_style.turnHintingOff();
+    paragraph_style.setIncrementalShaping(true);
+
+    TextStyle text_style;
+    text_style.setFontFamilies({SkString("Roboto")});
+    text_style.setColor(SK_ColorBLACK);
+
+    auto build = [&](const char* text) {
+        ParagraphBuilderImpl builder(paragraph_style, fontCollection);
+        builder.pushStyle(text_style);
+        builder.addText(text, strlen(text));
+        builder.pop();
+        return builder.Build();
+    };
+
+    auto before = build("The quick brown fox jumps over the lazy dog");
+    before->layout(200);
+
+    // Shape the edited text reusing the words that didn't change...
+    const char* edited = "The quick red fox jumps over the lazy dog";
+    auto after = build(edited);
+    after->reuseShapingFrom(*before);
+    after->layout(200);
+
+    // ...and from scratch
+    auto expected = build(edited);
+    expected->layout(200);
+
+    auto afterImpl = static_cast<ParagraphImpl*>(after.get());
+    auto expectedImpl = static_cast<ParagraphImpl*>(expected.get());
+    REPORTER_ASSERT(reporter, afterImpl->runs().size() == expectedImpl->runs().size());
+    REPORTER_ASSERT(reporter, SkScalarNearlyEqual(after->getMaxIntrinsicWidth(),
+                                                  expected->getMaxIntrinsicWidth()));
+    REPORTER_ASSERT(reporter, after->getHeight() == expected->getHeight());
+    REPORTER_ASSERT(reporter, after->lineNumber() == expected->lineNumber());
+    for (size_t i = 0; i < afterImpl->runs().size(); ++i) {
+        auto& run = afterImpl->runs()[i];
+        auto& expectedRun = expectedImpl->runs()[i];
+        REPORTER_ASSERT(reporter, run.textRange() == expectedRun.textRange());
+        REPORTER_ASSERT(reporter, run.size() == expectedRun.size());
+        for (size_t g = 0; g < run.size(); ++g) {
+            REPORTER_ASSERT(reporter, run.glyphs()[g] == expectedRun.glyphs()[g]);
+            REPORTER_ASSERT(reporter, SkScalarNearlyEqual(run.positionX(g), expectedRun.positionX(g)));
+        }
+    }
+}
+
+UNIX_ONLY_TEST(SkParagraph_LayoutParagraphsOnExecutor, reporter) {
+    sk_sp<ResourceFontCollection> fontCollection = sk_make_sp<ResourceFontCollection>();
+    SKIP_IF_FONTS_NOT_FOUND(reporter, fontCollection)
+    fontCollection->getParagraphCache()->turnOn(true);
+
+    ParagraphStyle paragraph_style;
+    paragraph_style.turnHintingOff();
+
+    TextStyle text_style;
+    text_style.setFontFamilies({SkString("Roboto")});
+    text_style.setColor(SK_ColorBLACK);
+
+    // Half of the paragraphs repeat, so the threads hit the cache while others fill it
+    constexpr int kCount = 64;
+    std::vector<std::unique_ptr<Paragraph>> serial, parallel;
+    std::vector<SkScalar> widths;
+    for (int i = 0; i < kCount; ++i) {
+        SkString text = SkStringPrintf("Cell %d of a table with quite a few cells", i % (kCount / 2));
+        for (auto* paragraphs : {&serial, &parallel}) {
+            ParagraphBuilderImpl builder(paragraph_style, fontCollection);
+            builder.pushStyle(text_style);
+            builder.addText(text.c_str(), text.size());
+            builder.pop();
+            paragraphs->push_back(builder.Build());
+        }
+        widths.push_back(100 + i);
+    }
+
+    for (int i = 0; i < kCount; ++i) {
+        serial[i]->layout(widths[i]);
+    }
+    std::vector<Paragraph*> paragraphs;
+    for (auto& paragraph : parallel) {
+        paragraphs.push_back(paragraph.get());
+    }
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    Paragraph::LayoutParagraphs(paragraphs, widths, executor.get());
+
+    for (int i = 0; i < kCount; ++i) {
+        REPORTER_ASSERT(reporter, parallel[i]->lineNumber() == serial[i]->lineNumber());
+        REPORTER_ASSERT(reporter, parallel[i]->getHeight() == serial[i]->getHeight());
+        REPORTER_ASSERT(reporter, parallel[i]->getLongestLine() == serial[i]->getLongestLine());
+    }
+}
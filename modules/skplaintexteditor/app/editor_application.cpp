@@ -170,11 +170,7 @@ struct EditorLayer : public sk_app::Window::Layer {
             options.fSelectionEnd = fTextPos;
         }
         #ifdef SK_EDITOR_DEBUG_OUT
-        {
-            Timer timer("shaping");
-            fEditor.paint(nullptr, options);
-        }
-        Timer timer("painting");
+        Timer timer("shaping and painting");
         #endif  // SK_EDITOR_DEBUG_OUT
         fEditor.paint(canvas, options);
     }
@@ -427,7 +423,6 @@ struct EditorApplication : public sk_app::Application {
         fWindow->pushLayer(&fLayer);
         fWindow->setTitle(SkStringPrintf("Editor: \"%s\"", fLayer.fPath.c_str()).c_str());
         fLayer.onResize(fWindow->width(), fWindow->height());
-        fLayer.fEditor.paint(nullptr, Editor::PaintOpts());
 
         fWindow->show();
         return true;
@@ -15,6 +15,7 @@
 
 #include <climits>
 #include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -23,10 +24,17 @@ class SkShaper;
 
 namespace SkPlainTextEditor {
 
+// Lines are only shaped once they are needed, usually because they come into view, and stay
+// shaped until they are edited or the width or font changes. Lines never shaped are assumed to take
+// up a single row. So the cost of editing or painting doesn't grow with the size of the document.
 class Editor {
     struct TextLine;
 public:
+    Editor();
+    ~Editor();
+
     // total height in canvas display units.
+    // Lines that have never been shaped are counted as one row each.
     int getHeight() const { return fHeight; }
 
     // set display width in canvas display units
@@ -56,7 +64,7 @@ public:
     //     }
     Text text() const { return Text{fLines}; }
 
-    // get size of line in canvas display units.
+    // get size of line in canvas display units (one row if it has never been shaped).
     int lineHeight(size_t index) const { return fLines[index].fHeight; }
 
     struct TextPosition {
@@ -74,7 +82,8 @@ public:
         kWordLeft,
         kWordRight,
     };
-    TextPosition move(Editor::Movement move, Editor::TextPosition pos) const;
+    // May shape the lines it moves within or to.
+    TextPosition move(Editor::Movement move, Editor::TextPosition pos);
     TextPosition getPosition(SkIPoint);
     SkRect getLocation(TextPosition);
     // insert into current text.
@@ -100,6 +109,7 @@ public:
         TextPosition fSelectionEnd;
         TextPosition fCursor;
     };
+    // Shapes and draws only the lines that intersect the canvas's clip.
     void paint(SkCanvas* canvas, PaintOpts);
 
 private:
@@ -122,11 +132,20 @@ private:
     int fHeight = 0;
     SkFont fFont;
     sk_sp<SkFontMgr> fFontMgr;
-    bool fNeedsReshape = false;
+    std::unique_ptr<SkShaper> fShaper;  // made on first use
+    size_t fLayoutFrom = 0;  // index of the first line whose fOrigin may be stale
     const char* fLocale = "en";  // TODO: make this setable
 
     void markDirty(TextLine*);
-    void reshapeAll();
+    TextPosition clamp(TextPosition) const;
+    // Shapes a line if it isn't shaped already. Its height may change, so layout() afterwards.
+    void shapeLine(size_t index);
+    // Shapes the lines that intersect [top, bottom) and returns their range.
+    std::pair<size_t, size_t> shapeLines(int top, int bottom);
+    // Updates the lines' origins and fHeight after lines are added, removed or shaped.
+    void layout();
+    // Returns the line containing y; the first or last one if y is above or below them all.
+    size_t lineAt(int y) const;
 };
 }  // namespace SkPlainTextEditor
 
@@ -9,9 +9,11 @@
 #include "src/base/SkUTF.h"
 
 #include "modules/skplaintexteditor/src/shape.h"
+#include "modules/skshaper/include/SkShaper.h"
 
 #include <algorithm>
 #include <cfloat>
+#include <cmath>
 
 using namespace SkPlainTextEditor;
 
@@ -45,6 +47,9 @@ static StringSlice remove_newline(const char* str, size_t len) {
            StringSlice(str, (len > 0 && str[len - 1] == '\n') ? len - 1 : len);
 }
 
+Editor::Editor() { this->layout(); }
+Editor::~Editor() = default;
+
 void Editor::markDirty(TextLine* line) {
     line->fBlob = nullptr;
     line->fShaped = false;
@@ -54,53 +59,51 @@ void Editor::markDirty(TextLine* line) {
 void Editor::setFont(SkFont font) {
     if (font != fFont) {
         fFont = std::move(font);
-        fNeedsReshape = true;
         for (auto& l : fLines) { this->markDirty(&l); }
     }
 }
 
 void Editor::setFontMgr(sk_sp<SkFontMgr> fontMgr) {
     fFontMgr = fontMgr;
-    fNeedsReshape = true;
+    fShaper = nullptr;
     for (auto& l : fLines) { this->markDirty(&l); }
 }
 
 void Editor::setWidth(int w) {
     if (fWidth != w) {
         fWidth = w;
-        fNeedsReshape = true;
         for (auto& l : fLines) { this->markDirty(&l); }
     }
 }
 static SkPoint to_point(SkIPoint p) { return {(float)p.x(), (float)p.y()}; }
 
 Editor::TextPosition Editor::getPosition(SkIPoint xy) {
-    Editor::TextPosition approximatePosition;
-    this->reshapeAll();
-    for (size_t j = 0; j < fLines.size(); ++j) {
-        const TextLine& line = fLines[j];
-        SkIRect lineRect = {0,
-                            line.fOrigin.y(),
-                            fWidth,
-                            j + 1 < fLines.size() ? fLines[j + 1].fOrigin.y() : INT_MAX};
-        if (const SkTextBlob* b = line.fBlob.get()) {
-            SkIRect r = b->bounds().roundOut();
-            r.offset(line.fOrigin);
-            lineRect.join(r);
-        }
-        if (!lineRect.contains(xy.x(), xy.y())) {
-            continue;
-        }
-        SkPoint pt = to_point(xy - line.fOrigin);
-        const std::vector<SkRect>& pos = line.fCursorPos;
-        for (size_t i = 0; i < pos.size(); ++i) {
-            if (pos[i] != kUnsetRect && pos[i].contains(pt.x(), pt.y())) {
-                return Editor::TextPosition{i, j};
-            }
+    size_t j;
+    do {
+        // Shaping the line may change its height, and so which line xy is in.
+        j = this->shapeLines(xy.y(), xy.y() + 1).first;
+    } while (j != this->lineAt(xy.y()));
+    const TextLine& line = fLines[j];
+    SkIRect lineRect = {0,
+                        line.fOrigin.y(),
+                        fWidth,
+                        j + 1 < fLines.size() ? fLines[j + 1].fOrigin.y() : INT_MAX};
+    if (const SkTextBlob* b = line.fBlob.get()) {
+        SkIRect r = b->bounds().roundOut();
+        r.offset(line.fOrigin);
+        lineRect.join(r);
+    }
+    if (!lineRect.contains(xy.x(), xy.y())) {
+        return Editor::TextPosition();
+    }
+    SkPoint pt = to_point(xy - line.fOrigin);
+    const std::vector<SkRect>& pos = line.fCursorPos;
+    for (size_t i = 0; i < pos.size(); ++i) {
+        if (pos[i] != kUnsetRect && pos[i].contains(pt.x(), pt.y())) {
+            return Editor::TextPosition{i, j};
         }
-        approximatePosition = {xy.x() <= line.fOrigin.x() ? 0 : line.fText.size(), j};
     }
-    return approximatePosition;
+    return Editor::TextPosition{xy.x() <= line.fOrigin.x() ? 0 : line.fText.size(), j};
 }
 
 static inline bool is_utf8_continuation(char v) {
@@ -129,9 +132,10 @@ static const char* prev_utf8(const char* p, const char* begin) {
 }
 
 SkRect Editor::getLocation(Editor::TextPosition cursor) {
-    this->reshapeAll();
-    cursor = this->move(Editor::Movement::kNowhere, cursor);
+    cursor = this->clamp(cursor);
     if (fLines.size() > 0) {
+        this->shapeLine(cursor.fParagraphIndex);
+        this->layout();
         const TextLine& cLine = fLines[cursor.fParagraphIndex];
         SkRect pos = {0, 0, 0, 0};
         if (cursor.fTextByteIndex < cLine.fCursorPos.size()) {
@@ -154,8 +158,8 @@ Editor::TextPosition Editor::insert(TextPosition pos, const char* utf8Text, size
     if (!valid_utf8(utf8Text, byteLen) || 0 == byteLen) {
         return pos;
     }
-    pos = this->move(Editor::Movement::kNowhere, pos);
-    fNeedsReshape = true;
+    pos = this->clamp(pos);
+    fLayoutFrom = std::min(fLayoutFrom, pos.fParagraphIndex);
     if (pos.fParagraphIndex < fLines.size()) {
         fLines[pos.fParagraphIndex].fText.insert(pos.fTextByteIndex, utf8Text, byteLen);
         this->markDirty(&fLines[pos.fParagraphIndex]);
@@ -175,19 +179,20 @@ Editor::TextPosition Editor::insert(TextPosition pos, const char* utf8Text, size
             (line++)->fText = remove_newline(str, l);
         });
     }
+    this->layout();
     return pos;
 }
 
 Editor::TextPosition Editor::remove(TextPosition pos1, TextPosition pos2) {
-    pos1 = this->move(Editor::Movement::kNowhere, pos1);
-    pos2 = this->move(Editor::Movement::kNowhere, pos2);
+    pos1 = this->clamp(pos1);
+    pos2 = this->clamp(pos2);
     auto cmp = [](const Editor::TextPosition& u, const Editor::TextPosition& v) { return u < v; };
     Editor::TextPosition start = std::min(pos1, pos2, cmp);
     Editor::TextPosition end = std::max(pos1, pos2, cmp);
     if (start == end || start.fParagraphIndex == fLines.size()) {
         return start;
     }
-    fNeedsReshape = true;
+    fLayoutFrom = std::min(fLayoutFrom, start.fParagraphIndex + 1);
     if (start.fParagraphIndex == end.fParagraphIndex) {
         SkASSERT(end.fTextByteIndex > start.fTextByteIndex);
         fLines[start.fParagraphIndex].fText.remove(
@@ -205,6 +210,7 @@ Editor::TextPosition Editor::remove(TextPosition pos1, TextPosition pos2) {
         fLines.erase(fLines.begin() + start.fParagraphIndex + 1,
                      fLines.begin() + end.fParagraphIndex + 1);
     }
+    this->layout();
     return start;
 }
 
@@ -218,8 +224,8 @@ static void append(char** dst, size_t* count, const char* src, size_t n) {
 
 size_t Editor::copy(TextPosition pos1, TextPosition pos2, char* dst) const {
     size_t size = 0;
-    pos1 = this->move(Editor::Movement::kNowhere, pos1);
-    pos2 = this->move(Editor::Movement::kNowhere, pos2);
+    pos1 = this->clamp(pos1);
+    pos2 = this->clamp(pos2);
     auto cmp = [](const Editor::TextPosition& u, const Editor::TextPosition& v) { return u < v; };
     Editor::TextPosition start = std::min(pos1, pos2, cmp);
     Editor::TextPosition end = std::max(pos1, pos2, cmp);
@@ -284,11 +290,11 @@ static size_t find_closest_x(const std::vector<SkRect>& bounds, float x, size_t
     return best_index;
 }
 
-Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition pos) const {
+// Fixes possible bad input values.
+Editor::TextPosition Editor::clamp(Editor::TextPosition pos) const {
     if (fLines.empty()) {
         return {0, 0};
     }
-    // First thing: fix possible bad input values.
     if (pos.fParagraphIndex >= fLines.size()) {
         pos.fParagraphIndex = fLines.size() - 1;
         pos.fTextByteIndex = fLines[pos.fParagraphIndex].fText.size();
@@ -301,6 +307,21 @@ Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition po
 
     SkASSERT(pos.fTextByteIndex == fLines[pos.fParagraphIndex].fText.size() ||
              !is_utf8_continuation(fLines[pos.fParagraphIndex].fText.begin()[pos.fTextByteIndex]));
+    return pos;
+}
+
+Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition pos) {
+    if (fLines.empty()) {
+        return {0, 0};
+    }
+    pos = this->clamp(pos);
+
+    // Everything but moving by characters needs the line broken into rows and words.
+    if (move != Editor::Movement::kNowhere &&
+        move != Editor::Movement::kLeft &&
+        move != Editor::Movement::kRight) {
+        this->shapeLine(pos.fParagraphIndex);
+    }
 
     switch (move) {
         case Editor::Movement::kNowhere:
@@ -361,6 +382,7 @@ Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition po
                                                         list[f - 1]);
                 } else if (pos.fParagraphIndex > 0) {
                     --pos.fParagraphIndex;
+                    this->shapeLine(pos.fParagraphIndex);
                     const auto& newLine = fLines[pos.fParagraphIndex];
                     size_t r = newLine.fLineEndOffsets.size();
                     if (r > 0) {
@@ -389,6 +411,7 @@ Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition po
                                                                             : bounds.size());
                 } else if (pos.fParagraphIndex + 1 < fLines.size()) {
                     ++pos.fParagraphIndex;
+                    this->shapeLine(pos.fParagraphIndex);
                     const auto& bounds = fLines[pos.fParagraphIndex].fCursorPos;
                     const std::vector<size_t>& l2 = fLines[pos.fParagraphIndex].fLineEndOffsets;
                     pos.fTextByteIndex = find_closest_x(bounds, x, 0,
@@ -429,21 +452,31 @@ Editor::TextPosition Editor::move(Editor::Movement move, Editor::TextPosition po
             break;
 
     }
+    this->layout();
     return pos;
 }
 
 void Editor::paint(SkCanvas* c, PaintOpts options) {
-    this->reshapeAll();
     if (!c) {
         return;
     }
 
+    // Shape the cursor's line before working out which lines are in view, since that may move them.
+    (void)this->getLocation(options.fCursor);
+
+    const SkIRect clip = c->getLocalClipBounds().roundOut();
+    const auto [first, last] = this->shapeLines(clip.top(), clip.bottom());
+
     c->drawPaint(SkPaint(options.fBackgroundColor));
 
     SkPaint selection = SkPaint(options.fSelectionColor);
     auto cmp = [](const Editor::TextPosition& u, const Editor::TextPosition& v) { return u < v; };
-    for (TextPosition pos = std::min(options.fSelectionBegin, options.fSelectionEnd, cmp),
-                      end = std::max(options.fSelectionBegin, options.fSelectionEnd, cmp);
+    const Editor::TextPosition firstVisible{0, first},
+                               lastVisible{0, last};
+    for (TextPosition pos = std::max(std::min(options.fSelectionBegin, options.fSelectionEnd, cmp),
+                                     firstVisible, cmp),
+                      end = std::min(std::max(options.fSelectionBegin, options.fSelectionEnd, cmp),
+                                     lastVisible, cmp);
          pos < end;
          pos = this->move(Editor::Movement::kRight, pos))
     {
@@ -453,65 +486,80 @@ void Editor::paint(SkCanvas* c, PaintOpts options) {
     }
 
     if (fLines.size() > 0) {
-        c->drawRect(Editor::getLocation(options.fCursor), SkPaint(options.fCursorColor));
+        c->drawRect(this->getLocation(options.fCursor), SkPaint(options.fCursorColor));
     }
 
     SkPaint foreground = SkPaint(options.fForegroundColor);
-    for (const TextLine& line : fLines) {
+    for (size_t i = first; i < last; ++i) {
+        const TextLine& line = fLines[i];
         if (line.fBlob) {
             c->drawTextBlob(line.fBlob.get(), line.fOrigin.x(), line.fOrigin.y(), foreground);
         }
     }
 }
 
-void Editor::reshapeAll() {
-    if (fNeedsReshape) {
-        if (fLines.empty()) {
-            fLines.push_back(TextLine());
-        }
-        float shape_width = (float)(fWidth);
-        #ifdef SK_EDITOR_GO_FAST
-        SkSemaphore semaphore;
-        std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(100);
-        int jobCount = 0;
-        for (TextLine& line : fLines) {
-            if (!line.fShaped) {
-                executor->add([&]() {
-                    ShapeResult result = Shape(line.fText.begin(), line.fText.size(),
-                                               fFont, fLocale, shape_width);
-                    line.fBlob           = std::move(result.blob);
-                    line.fLineEndOffsets = std::move(result.lineBreakOffsets);
-                    line.fCursorPos      = std::move(result.glyphBounds);
-                    line.fWordBoundaries = std::move(result.wordBreaks);
-                    line.fHeight         = result.verticalAdvance;
-                    line.fShaped = true;
-                    semaphore.signal();
-                }
-                ++jobCount;
-            });
-        }
-        while (jobCount-- > 0) { semaphore.wait(); }
-        #else
-        for (TextLine& line : fLines) {
-            if (!line.fShaped) {
-                ShapeResult result = Shape(line.fText.begin(), line.fText.size(),
-                                           fFont, fFontMgr, fLocale, shape_width);
-                line.fBlob           = std::move(result.blob);
-                line.fLineEndOffsets = std::move(result.lineBreakOffsets);
-                line.fCursorPos      = std::move(result.glyphBounds);
-                line.fWordBoundaries = std::move(result.wordBreaks);
-                line.fHeight         = result.verticalAdvance;
-                line.fShaped = true;
-            }
-        }
-        #endif
-        int y = 0;
-        for (TextLine& line : fLines) {
-            line.fOrigin = {0, y};
-            y += line.fHeight;
+void Editor::shapeLine(size_t index) {
+    TextLine& line = fLines[index];
+    if (line.fShaped) {
+        return;
+    }
+    if (!fShaper) {
+        fShaper = SkShaper::Make(fFontMgr);
+    }
+    ShapeResult result = Shape(line.fText.begin(), line.fText.size(),
+                               fFont, *fShaper, fLocale, (float)fWidth);
+    if (line.fHeight != result.verticalAdvance) {
+        fLayoutFrom = std::min(fLayoutFrom, index + 1);
+    }
+    line.fBlob           = std::move(result.blob);
+    line.fLineEndOffsets = std::move(result.lineBreakOffsets);
+    line.fCursorPos      = std::move(result.glyphBounds);
+    line.fWordBoundaries = std::move(result.wordBreaks);
+    line.fHeight         = result.verticalAdvance;
+    line.fShaped = true;
+}
+
+std::pair<size_t, size_t> Editor::shapeLines(int top, int bottom) {
+    this->layout();
+    const size_t first = this->lineAt(top);
+    // Lines only move down as the ones above them are shaped, so lay them out as we go.
+    size_t last = first;
+    for (int y = fLines[first].fOrigin.y(); last < fLines.size() && (last == first || y < bottom);
+         ++last) {
+        fLines[last].fOrigin = {0, y};
+        this->shapeLine(last);
+        y += fLines[last].fHeight;
+    }
+    this->layout();
+    return {first, last};
+}
+
+void Editor::layout() {
+    if (fLines.empty()) {
+        fLines.push_back(TextLine());
+    }
+    // Lines that have never been shaped are given a single row until they are.
+    const int rowHeight = (int)ceilf(fFont.getSpacing());
+    fLayoutFrom = std::min(fLayoutFrom, fLines.size());
+    int y = 0;
+    if (fLayoutFrom > 0) {
+        const TextLine& prev = fLines[fLayoutFrom - 1];
+        y = prev.fOrigin.y() + prev.fHeight;
+    }
+    for (size_t i = fLayoutFrom; i < fLines.size(); ++i) {
+        TextLine& line = fLines[i];
+        if (!line.fShaped && line.fHeight == 0) {
+            line.fHeight = rowHeight;
         }
-        fHeight = y;
-        fNeedsReshape = false;
+        line.fOrigin = {0, y};
+        y += line.fHeight;
     }
+    fHeight = fLines.back().fOrigin.y() + fLines.back().fHeight;
+    fLayoutFrom = fLines.size();
 }
 
+size_t Editor::lineAt(int y) const {
+    auto next = std::upper_bound(fLines.begin(), fLines.end(), y,
+                                 [](int y, const TextLine& line) { return y < line.fOrigin.y(); });
+    return next == fLines.begin() ? 0 : next - fLines.begin() - 1;
+}
@@ -261,7 +261,7 @@ static void set_character_bounds(void* context,
 ShapeResult SkPlainTextEditor::Shape(const char* utf8Text,
                                      size_t textByteLen,
                                      const SkFont& font,
-                                     sk_sp<SkFontMgr> fontMgr,
+                                     const SkShaper& shaper,
                                      const char* locale,
                                      float width)
 {
@@ -270,7 +270,6 @@ ShapeResult SkPlainTextEditor::Shape(const char* utf8Text,
         utf8Text = nullptr;
         textByteLen = 0;
     }
-    std::unique_ptr<SkShaper> shaper = SkShaper::Make(fontMgr);
     float height = font.getSpacing();
     RunHandler runHandler(utf8Text, textByteLen);
     if (textByteLen) {
@@ -280,7 +279,7 @@ ShapeResult SkPlainTextEditor::Shape(const char* utf8Text,
         }
         runHandler.setRunCallback(set_character_bounds, result.glyphBounds.data());
         // TODO: make use of locale in shaping.
-        shaper->shape(utf8Text, textByteLen, font, true, width, &runHandler);
+        shaper.shape(utf8Text, textByteLen, font, true, width, &runHandler);
         if (runHandler.lineEndOffsets().size() > 1) {
             result.lineBreakOffsets = runHandler.lineEndOffsets();
             SkASSERT(result.lineBreakOffsets.size() > 0);
@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <vector>
 
+class SkShaper;
+
 namespace SkPlainTextEditor {
 
 struct ShapeResult {
@@ -17,10 +19,11 @@ struct ShapeResult {
     int verticalAdvance;
 };
 
+// shaper is reused from one call to the next, since making one is not cheap.
 ShapeResult Shape(const char* ut8text,
                   size_t textByteLen,
                   const SkFont& font,
-                  sk_sp<SkFontMgr> fontMgr,
+                  const SkShaper& shaper,
                   const char* locale,
                   float width);
 
@@ -19,8 +19,10 @@
 #include "src/core/SkTHash.h"
 
 #include <memory>
+#include <utility>
 
 class SkAnimCodecPlayer;
+class SkExecutor;
 class SkImage;
 
 namespace skresources {
@@ -160,6 +162,14 @@ public:
         return nullptr;
     }
 
+    /**
+     * Hint that loadImageAsset() is likely to be called for |path| + |name| soon, so providers
+     * which load asynchronously can get started.  The default implementation does nothing.
+     */
+    virtual void prefetchImageAsset(const char[] /* resource_path */,
+                                    const char[] /* resource_name */,
+                                    const char[] /* resource_id   */) const {}
+
     /**
      * Load an external audio track specified by |path|/|name|/|id|.
      */
@@ -225,6 +235,7 @@ protected:
 
     sk_sp<SkData> load(const char[], const char[]) const override;
     sk_sp<ImageAsset> loadImageAsset(const char[], const char[], const char[]) const override;
+    void prefetchImageAsset(const char[], const char[], const char[]) const override;
     sk_sp<SkTypeface> loadTypeface(const char[], const char[]) const override;
     sk_sp<SkData> loadFont(const char[], const char[]) const override;
     sk_sp<ExternalTrackAsset> loadAudioAsset(const char[], const char[], const char[]) override;
@@ -251,6 +262,47 @@ private:
     using INHERITED = ResourceProviderProxyBase;
 };
 
+/**
+ * Loads image assets on an SkExecutor.
+ *
+ * prefetchImageAsset() queues the load and returns right away; loadImageAsset() returns the
+ * asset, waiting for it if it's still in flight, or loading it on the calling thread if the
+ * executor hasn't got to it yet.  Requests are keyed by resource path and name, so identical
+ * requests share one load whether in flight or done, including requests from different
+ * animations built with the same provider.
+ *
+ * Static images are decoded to raster as part of the load, and handed out as immutable assets
+ * that are safe to share.  Animated assets are shared as-is, as CachingResourceProvider does.
+ *
+ * The wrapped provider's loadImageAsset() may be called from several threads at once.
+ */
+class SK_API AsyncResourceProvider final : public ResourceProviderProxyBase {
+public:
+    // Uses SkExecutor::GetDefault() if no executor is given.
+    static sk_sp<AsyncResourceProvider> Make(sk_sp<ResourceProvider>, SkExecutor* = nullptr);
+
+    ~AsyncResourceProvider() override;
+
+    sk_sp<ImageAsset> loadImageAsset(const char[], const char[], const char[]) const override;
+    void prefetchImageAsset(const char[], const char[], const char[]) const override;
+
+private:
+    struct Request;
+
+    AsyncResourceProvider(sk_sp<ResourceProvider>, SkExecutor*);
+
+    // Returns the request for this asset, and whether it was just created.
+    std::pair<sk_sp<Request>, bool> findOrAddRequest(const char[], const char[],
+                                                     const char[]) const;
+    sk_sp<ImageAsset> resolve(Request*) const;
+
+    SkExecutor&                                               fExecutor;
+    mutable SkMutex                                           fMutex;
+    mutable skia_private::THashMap<SkString, sk_sp<Request>> fRequests;
+
+    using INHERITED = ResourceProviderProxyBase;
+};
+
 class DataURIResourceProviderProxy final : public ResourceProviderProxyBase {
 public:
     // If font data is supplied via base64 encoding, this needs a provided SkFontMgr to process
@@ -10,6 +10,7 @@
 #include "include/codec/SkCodec.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkImage.h"
 #include "include/private/base/SkTPin.h"
@@ -91,6 +92,21 @@ private:
 
 #endif // defined(HAVE_VIDEO_DECODER)
 
+// A static image, decoded once up front and never changed after, so it can be shared freely.
+class DecodedImageAsset final : public ImageAsset {
+public:
+    explicit DecodedImageAsset(FrameData frame) : fFrame(std::move(frame)) {}
+
+private:
+    bool isMultiFrame() override { return false; }
+
+    sk_sp<SkImage> getFrame(float) override { return fFrame.image; }
+
+    FrameData getFrameData(float) override { return fFrame; }
+
+    const FrameData fFrame;
+};
+
 } // namespace
 
 sk_sp<SkImage> ImageAsset::getFrame(float t) {
@@ -237,6 +253,14 @@ sk_sp<SkData> ResourceProviderProxyBase::loadFont(const char name[], const char
                   : nullptr;
 }
 
+void ResourceProviderProxyBase::prefetchImageAsset(const char rpath[],
+                                                   const char rname[],
+                                                   const char rid[]) const {
+    if (fProxy) {
+        fProxy->prefetchImageAsset(rpath, rname, rid);
+    }
+}
+
 sk_sp<ExternalTrackAsset> ResourceProviderProxyBase::loadAudioAsset(const char path[],
                                                                     const char name[],
                                                                     const char id[]) {
@@ -263,6 +287,85 @@ sk_sp<ImageAsset> CachingResourceProvider::loadImageAsset(const char resource_pa
     return asset;
 }
 
+struct AsyncResourceProvider::Request final : public SkRefCnt {
+    Request(const char rpath[], const char rname[], const char rid[])
+            : fPath(rpath), fName(rname), fID(rid) {}
+
+    const SkString fPath,
+                   fName,
+                   fID;
+
+    // Held for the whole load, so anyone else asking for this asset waits for it.
+    SkMutex           fMutex;
+    bool              fDone  SK_GUARDED_BY(fMutex) = false;
+    sk_sp<ImageAsset> fAsset SK_GUARDED_BY(fMutex);
+};
+
+sk_sp<AsyncResourceProvider> AsyncResourceProvider::Make(sk_sp<ResourceProvider> rp,
+                                                         SkExecutor* executor) {
+    return rp ? sk_sp<AsyncResourceProvider>(new AsyncResourceProvider(
+                        std::move(rp), executor ? executor : &SkExecutor::GetDefault()))
+              : nullptr;
+}
+
+AsyncResourceProvider::AsyncResourceProvider(sk_sp<ResourceProvider> rp, SkExecutor* executor)
+    : INHERITED(std::move(rp)), fExecutor(*executor) {}
+
+AsyncResourceProvider::~AsyncResourceProvider() = default;
+
+std::pair<sk_sp<AsyncResourceProvider::Request>, bool> AsyncResourceProvider::findOrAddRequest(
+        const char rpath[], const char rname[], const char rid[]) const {
+    SkAutoMutexExclusive amx(fMutex);
+
+    const SkString key = SkOSPath::Join(rpath, rname);
+    if (const auto* request = fRequests.find(key)) {
+        return {*request, false};
+    }
+
+    return {*fRequests.set(key, sk_make_sp<Request>(rpath, rname, rid)), true};
+}
+
+sk_sp<ImageAsset> AsyncResourceProvider::resolve(Request* request) const {
+    SkAutoMutexExclusive amx(request->fMutex);
+
+    if (!request->fDone) {
+        auto asset = this->INHERITED::loadImageAsset(request->fPath.c_str(),
+                                                     request->fName.c_str(),
+                                                     request->fID.c_str());
+        if (asset && !asset->isMultiFrame()) {
+            // Decode now, while we're (most likely) on the executor.
+            auto frame = asset->getFrameData(0);
+            if (frame.image && frame.image->isLazyGenerated()) {
+                if (auto decoded = frame.image->makeRasterImage()) {
+                    frame.image = std::move(decoded);
+                }
+            }
+            asset = sk_make_sp<DecodedImageAsset>(std::move(frame));
+        }
+        request->fAsset = std::move(asset);
+        request->fDone  = true;
+    }
+
+    return request->fAsset;
+}
+
+void AsyncResourceProvider::prefetchImageAsset(const char rpath[],
+                                               const char rname[],
+                                               const char rid[]) const {
+    auto [request, added] = this->findOrAddRequest(rpath, rname, rid);
+    if (added) {
+        fExecutor.add([self = sk_ref_sp(this), request = std::move(request)] {
+            self->resolve(request.get());
+        });
+    }
+}
+
+sk_sp<ImageAsset> AsyncResourceProvider::loadImageAsset(const char rpath[],
+                                                        const char rname[],
+                                                        const char rid[]) const {
+    return this->resolve(this->findOrAddRequest(rpath, rname, rid).first.get());
+}
+
 sk_sp<DataURIResourceProviderProxy> DataURIResourceProviderProxy::Make(sk_sp<ResourceProvider> rp,
                                                                        ImageDecodeStrategy strat,
                                                                        sk_sp<const SkFontMgr> mgr) {
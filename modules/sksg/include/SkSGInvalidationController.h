@@ -13,6 +13,7 @@
 
 #include <vector>
 
+class SkCanvas;
 struct SkRect;
 
 namespace sksg {
@@ -35,6 +36,10 @@ public:
     auto begin() const { return fRects.cbegin(); }
     auto   end() const { return fRects.cend();   }
 
+    // Restricts the canvas clip to the accumulated damage, as mapped by the current canvas
+    // matrix.  The clip is pixel-aligned and covers antialiasing fringes.
+    void clipCanvas(SkCanvas*) const;
+
     void reset();
 
 private:
@@ -21,6 +21,8 @@ class SkPaint;
 
 namespace sksg {
 
+class InvalidationController;
+
 /**
  * Base class for nodes which can render to a canvas.
  */
@@ -32,6 +34,11 @@ public:
     // Render the node and its descendants to the canvas.
     void render(SkCanvas*, const RenderContext* = nullptr) const;
 
+    // Partial repaint: render only the areas damaged during the last revalidation, skipping
+    // subtrees which fall outside of them.  Damaged areas are drawn over the existing canvas
+    // content, which callers are expected to erase (e.g. via InvalidationController::clipCanvas).
+    void render(SkCanvas*, const InvalidationController& damage) const;
+
     // Perform a front-to-back hit-test, and return the RenderNode located at |point|.
     // Normally, hit-testing stops at leaf Draw nodes.
     const RenderNode* nodeAt(const SkPoint& point) const;
@@ -59,6 +66,9 @@ protected:
                              fMaskCTM   = SkMatrix::I();
         float                fOpacity   = 1;
 
+        // Skip subtrees which don't intersect the canvas clip.
+        bool                 fCullToClip = false;
+
         // Returns true if the paint overrides require a layer when applied to non-atomic draws.
         bool requiresIsolation() const;
 
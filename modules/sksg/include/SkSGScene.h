@@ -34,6 +34,8 @@ public:
     Scene& operator=(const Scene&) = delete;
 
     void render(SkCanvas*) const;
+    // Partial repaint, see RenderNode::render().
+    void render(SkCanvas*, const InvalidationController& damage) const;
     void revalidate(InvalidationController* = nullptr);
     const RenderNode* nodeAt(const SkPoint&) const;
 
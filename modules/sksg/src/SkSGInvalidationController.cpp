@@ -7,7 +7,9 @@
 
 #include "modules/sksg/include/SkSGInvalidationController.h"
 
+#include "include/core/SkCanvas.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkRegion.h"
 #include "src/base/SkTLazy.h"
 
 namespace sksg {
@@ -29,6 +31,17 @@ void InvalidationController::inval(const SkRect& r, const SkMatrix& ctm) {
     fBounds.join(*rect);
 }
 
+void InvalidationController::clipCanvas(SkCanvas* canvas) const {
+    const auto ctm = canvas->getTotalMatrix();
+
+    SkRegion damage;
+    for (const auto& r : fRects) {
+        damage.op(ctm.mapRect(r).makeOutset(1, 1).roundOut(), SkRegion::kUnion_Op);
+    }
+
+    canvas->clipRegion(damage);
+}
+
 void InvalidationController::reset() {
     fRects.clear();
     fBounds.setEmpty();
@@ -10,6 +10,7 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkPaint.h"
+#include "modules/sksg/include/SkSGInvalidationController.h"
 #include "modules/sksg/src/SkSGNodePriv.h"
 
 namespace sksg {
@@ -40,12 +41,23 @@ void RenderNode::setVisible(bool v) {
 
 void RenderNode::render(SkCanvas* canvas, const RenderContext* ctx) const {
     SkASSERT(!this->hasInval());
-    if (this->isVisible() && !this->bounds().isEmpty()) {
+    if (this->isVisible() && !this->bounds().isEmpty() &&
+        !(ctx && ctx->fCullToClip && canvas->quickReject(this->bounds()))) {
         this->onRender(canvas, ctx);
     }
     SkASSERT(!this->hasInval());
 }
 
+void RenderNode::render(SkCanvas* canvas, const InvalidationController& damage) const {
+    SkAutoCanvasRestore acr(canvas, true);
+    damage.clipCanvas(canvas);
+
+    RenderContext ctx;
+    ctx.fCullToClip = true;
+
+    this->render(canvas, &ctx);
+}
+
 const RenderNode* RenderNode::nodeAt(const SkPoint& p) const {
     return this->bounds().contains(p.x(), p.y()) ? this->onNodeAt(p) : nullptr;
 }
@@ -215,6 +227,7 @@ RenderNode::ScopedRenderContext::setFilterIsolation(const SkRect& bounds, const
         SkASSERT(!layer_paint.getImageFilter());
         layer_paint.setImageFilter(std::move(filter));
         fCanvas->saveLayer(bounds, &layer_paint);
+        // This also stops culling: filters can pull in content from outside the clip.
         fCtx = RenderContext();
     }
 
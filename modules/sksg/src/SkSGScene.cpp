@@ -27,6 +27,10 @@ void Scene::render(SkCanvas* canvas) const {
     fRoot->render(canvas);
 }
 
+void Scene::render(SkCanvas* canvas, const InvalidationController& damage) const {
+    fRoot->render(canvas, damage);
+}
+
 void Scene::revalidate(InvalidationController* ic) {
     fRoot->revalidate(ic, SkMatrix::I());
 }
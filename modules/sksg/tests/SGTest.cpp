@@ -9,6 +9,8 @@
 
 #if !defined(SK_BUILD_FOR_GOOGLE3)
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkRect.h"
 #include "include/private/base/SkTo.h"
 #include "modules/sksg/include/SkSGDraw.h"
@@ -348,6 +350,76 @@ static void inval_group_remove(skiatest::Reporter* reporter) {
     grp->addChild(draw);
 }
 
+namespace {
+
+// Flat-colored node, which counts its render calls.
+class CountingNode final : public sksg::CustomRenderNode {
+public:
+    explicit CountingNode(const SkRect& r) : INHERITED({}), fRect(r) {}
+
+    int renderCount() const { return fRenderCount; }
+
+private:
+    SkRect onRevalidate(sksg::InvalidationController*, const SkMatrix&) override { return fRect; }
+
+    void onRender(SkCanvas* canvas, const RenderContext*) const override {
+        fRenderCount++;
+
+        SkPaint paint;
+        paint.setColor(SK_ColorGREEN);
+        canvas->drawRect(fRect, paint);
+    }
+
+    const RenderNode* onNodeAt(const SkPoint&) const override { return nullptr; }
+
+    const SkRect fRect;
+    mutable int  fRenderCount = 0;
+
+    using INHERITED = sksg::CustomRenderNode;
+};
+
+} // namespace
+
+DEF_TEST(SGPartialRepaint, reporter) {
+    auto r1    = sksg::Rect::Make(SkRect::MakeLTRB( 0,  0, 10, 10));
+    auto r2    = sksg::Rect::Make(SkRect::MakeLTRB(50, 50, 60, 60));
+    auto other = sk_make_sp<CountingNode>(SkRect::MakeLTRB(80, 0, 100, 20));
+    auto root  = sksg::Group::Make({ sksg::Draw::Make(r1, sksg::Color::Make(SK_ColorRED)),
+                                     sksg::Draw::Make(r2, sksg::Color::Make(SK_ColorBLUE)),
+                                     other });
+
+    SkBitmap partial, full;
+    partial.allocN32Pixels(100, 100);
+    full.allocN32Pixels(100, 100);
+    partial.eraseColor(SK_ColorTRANSPARENT);
+
+    root->revalidate(nullptr, SkMatrix::I());
+    SkCanvas partial_canvas(partial);
+    root->render(&partial_canvas);
+    REPORTER_ASSERT(reporter, other->renderCount() == 1);
+
+    // Move r2: the damage covers its old and new locations only.
+    r2->setL(65); r2->setT(65); r2->setR(75); r2->setB(75);
+    sksg::InvalidationController ic;
+    root->revalidate(&ic, SkMatrix::I());
+
+    partial_canvas.save();
+    ic.clipCanvas(&partial_canvas);
+    partial_canvas.clear(SK_ColorTRANSPARENT);
+    partial_canvas.restore();
+    root->render(&partial_canvas, ic);
+
+    // The undamaged node was not rendered again.
+    REPORTER_ASSERT(reporter, other->renderCount() == 1);
+
+    full.eraseColor(SK_ColorTRANSPARENT);
+    SkCanvas full_canvas(full);
+    root->render(&full_canvas);
+
+    REPORTER_ASSERT(reporter, 0 == memcmp(partial.getPixels(), full.getPixels(),
+                                          full.computeByteSize()));
+}
+
 DEF_TEST(SGInvalidation, reporter) {
     inval_test1(reporter);
     inval_test2(reporter);
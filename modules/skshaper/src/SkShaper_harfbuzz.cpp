@@ -37,6 +37,7 @@
 #include <hb-ot.h>
 #include <hb.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -1285,6 +1286,89 @@ static HBLockedFaceCache get_hbFace_cache() {
     return HBLockedFaceCache(gHBFaceCache, gHBFaceCacheMutex);
 }
 
+// Runs are cached on everything that goes into hb_shape, so that text which is shaped over and
+// over, like labels and list items, is only shaped once. The clusters of cached glyphs are
+// relative to the start of the run.
+struct CachedRun {
+    std::unique_ptr<ShapedGlyph[]> fGlyphs;
+    size_t fNumGlyphs;
+    SkVector fAdvance;
+};
+struct ShapedRunCache {
+    SkMutex fMutex;
+    SkLRUCache<SkString, CachedRun> fRuns SK_GUARDED_BY(fMutex){512};
+};
+static ShapedRunCache& get_shaped_run_cache() {
+    static ShapedRunCache gShapedRunCache;
+    return gShapedRunCache;
+}
+
+// Long runs rarely repeat, and would take up a lot of the cache.
+constexpr size_t kMaxCachedRunBytes = 256;
+// HarfBuzz keeps up to five code points of context on either side of the run.
+constexpr size_t kMaxContextBytes = 5 * SkUTF::kMaxBytesInUTF8Sequence;
+
+template <typename T> void append_to_key(SkString* key, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+    key->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+void append_to_key(SkString* key, const char* bytes, size_t size) {
+    append_to_key(key, size);
+    key->append(bytes, size);
+}
+
+// Returns false if the run shouldn't be cached.
+bool make_shaped_run_key(SkString* key,
+                         const char* utf8, size_t utf8Bytes,
+                         const char* utf8Start, const char* utf8End,
+                         SkBidiIterator::Level level,
+                         const char* language,
+                         SkFourByteTag script,
+                         const SkFont& font,
+                         SkSpan<const SkShaper::Feature> features) {
+    const size_t runStart = utf8Start - utf8,
+                 runEnd   = utf8End   - utf8;
+    if (runEnd - runStart > kMaxCachedRunBytes) {
+        return false;
+    }
+
+    append_to_key(key, font.getTypeface()->uniqueID());
+    append_to_key(key, font.getSize());
+    append_to_key(key, font.getScaleX());
+    append_to_key(key, font.getSkewX());
+    append_to_key(key, font.getEdging());
+    append_to_key(key, font.getHinting());
+    const uint8_t fontFlags = (font.isForceAutoHinting() << 0) |
+                              (font.isEmbeddedBitmaps()  << 1) |
+                              (font.isSubpixel()         << 2) |
+                              (font.isLinearMetrics()    << 3) |
+                              (font.isEmbolden()         << 4) |
+                              (font.isBaselineSnap()     << 5);
+    append_to_key(key, fontFlags);
+    append_to_key(key, level);
+    append_to_key(key, script);
+    append_to_key(key, language, language ? strlen(language) : 0);
+
+    // Features that only apply to part of the run refer to positions in the whole text.
+    for (const SkShaper::Feature& feature : features) {
+        if (feature.end < runStart || runEnd <= feature.start) {
+            continue;
+        }
+        if (runStart < feature.start || feature.end < runEnd) {
+            return false;
+        }
+        append_to_key(key, feature.tag);
+        append_to_key(key, feature.value);
+    }
+
+    const size_t preContext  = std::min(runStart, kMaxContextBytes),
+                 postContext = std::min(utf8Bytes - runEnd, kMaxContextBytes);
+    append_to_key(key, utf8Start - preContext, preContext);
+    append_to_key(key, utf8Start, runEnd - runStart);
+    append_to_key(key, utf8End, postContext);
+    return true;
+}
+
 ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
                                   size_t const utf8Bytes,
                                   char const * const utf8Start,
@@ -1299,6 +1383,28 @@ ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
     ShapedRun run(RunHandler::Range(utf8Start - utf8, utf8runLength),
                   font.currentFont(), bidi.currentLevel(), nullptr, 0);
 
+    const size_t runStart = utf8Start - utf8;
+    ShapedRunCache& runCache = get_shaped_run_cache();
+    SkString runKey;
+    const bool cacheRun = make_shaped_run_key(&runKey, utf8, utf8Bytes, utf8Start, utf8End,
+                                              bidi.currentLevel(), language.currentLanguage(),
+                                              script.currentScript(), font.currentFont(),
+                                              SkSpan(features, featuresSize));
+    if (cacheRun) {
+        SkAutoMutexExclusive lock(runCache.fMutex);
+        if (const CachedRun* cached = runCache.fRuns.find(runKey)) {
+            run = ShapedRun(RunHandler::Range(runStart, utf8runLength),
+                            font.currentFont(), bidi.currentLevel(),
+                            std::unique_ptr<ShapedGlyph[]>(new ShapedGlyph[cached->fNumGlyphs]),
+                            cached->fNumGlyphs, cached->fAdvance);
+            for (size_t i = 0; i < cached->fNumGlyphs; ++i) {
+                run.fGlyphs[i] = cached->fGlyphs[i];
+                run.fGlyphs[i].fCluster += runStart;
+            }
+            return run;
+        }
+    }
+
     hb_buffer_t* buffer = fBuffer.get();
     SkAutoTCallVProc<hb_buffer_t, hb_buffer_clear_contents> autoClearBuffer(buffer);
     hb_buffer_set_content_type(buffer, HB_BUFFER_CONTENT_TYPE_UNICODE);
@@ -1420,11 +1526,24 @@ ShapedRun ShaperHarfBuzz::shape(char const * const utf8,
         glyph.fUnsafeToBreak = false;
 #endif
         glyph.fMustLineBreakBefore = false;
+        // Set by the line breaking, but cleared here so that cached runs are fully initialized.
+        glyph.fMayLineBreakBefore = false;
+        glyph.fGraphemeBreakBefore = false;
 
         runAdvance += glyph.fAdvance;
     }
     run.fAdvance = runAdvance;
 
+    if (cacheRun) {
+        CachedRun cached{std::unique_ptr<ShapedGlyph[]>(new ShapedGlyph[len]), len, runAdvance};
+        for (unsigned i = 0; i < len; ++i) {
+            cached.fGlyphs[i] = run.fGlyphs[i];
+            cached.fGlyphs[i].fCluster -= runStart;
+        }
+        SkAutoMutexExclusive lock(runCache.fMutex);
+        runCache.fRuns.insert_or_update(runKey, std::move(cached));
+    }
+
     return run;
 }
 
@@ -1469,6 +1588,11 @@ std::unique_ptr<SkShaper> SkShaper::MakeShapeDontWrapOrReorder(std::unique_ptr<S
 }
 
 void SkShaper::PurgeHarfBuzzCache() {
-    HBLockedFaceCache cache = get_hbFace_cache();
-    cache.reset();
+    {
+        HBLockedFaceCache cache = get_hbFace_cache();
+        cache.reset();
+    }
+    ShapedRunCache& runCache = get_shaped_run_cache();
+    SkAutoMutexExclusive lock(runCache.fMutex);
+    runCache.fRuns.reset();
 }
@@ -7,6 +7,7 @@
 
 #include "include/core/SkData.h"
 #include "include/core/SkFont.h"
+#include "include/core/SkFontMgr.h"
 #include "include/core/SkPoint.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSpan.h"
@@ -21,7 +22,9 @@
 
 #include <cinttypes>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
 namespace {
 struct RunHandler final : public SkShaper::RunHandler {
@@ -194,4 +197,69 @@ SHAPER_TEST(taitham)
 SHAPER_TEST(tamil)
 #undef SHAPER_TEST
 
+#if defined(SK_SHAPER_HARFBUZZ_AVAILABLE)
+namespace {
+// Records every glyph of every run.
+struct RecordingRunHandler final : public SkShaper::RunHandler {
+    std::vector<SkGlyphID> fGlyphs;
+    std::vector<SkPoint> fPositions;
+    std::vector<uint32_t> fClusters;
+    size_t fRunStart = 0;
+
+    void beginLine() override {}
+    void runInfo(const RunInfo&) override {}
+    void commitRunInfo() override {}
+    Buffer runBuffer(const RunInfo& info) override {
+        fRunStart = fGlyphs.size();
+        fGlyphs.resize(fRunStart + info.glyphCount);
+        fPositions.resize(fRunStart + info.glyphCount);
+        fClusters.resize(fRunStart + info.glyphCount);
+        return {fGlyphs.data() + fRunStart, fPositions.data() + fRunStart, nullptr,
+                fClusters.data() + fRunStart, {0, 0}};
+    }
+    void commitRunBuffer(const RunInfo&) override {}
+    void commitLine() override {}
+
+    bool operator==(const RecordingRunHandler& that) const {
+        return fGlyphs == that.fGlyphs && fPositions == that.fPositions &&
+               fClusters == that.fClusters;
+    }
+};
+}  // namespace
+
+DEF_TEST(Shaper_HarfBuzzRunCache, r) {
+    std::unique_ptr<SkShaper> shaper = SkShaper::MakeShaperDrivenWrapper(SkFontMgr::RefEmpty());
+    if (!shaper) {
+        ERRORF(r, "Could not create shaper.");
+        return;
+    }
+    SkFont font = ToolUtils::DefaultFont();
+    // Narrow enough to wrap, so that the shaper shapes runs that start part of the way in.
+    constexpr float kWidth = 60;
+    static constexpr char kText[] = "OK Cancel OK Cancel OK";
+    auto shape = [&](const SkFont& font) {
+        RecordingRunHandler handler;
+        shaper->shape(kText, strlen(kText), font, true, kWidth, &handler);
+        return handler;
+    };
+
+    SkShaper::PurgeHarfBuzzCache();
+    const RecordingRunHandler shaped = shape(font);
+    REPORTER_ASSERT(r, !shaped.fGlyphs.empty());
+
+    // Shaping the same text again reuses the runs, which must come out the same.
+    REPORTER_ASSERT(r, shape(font) == shaped);
+    SkShaper::PurgeHarfBuzzCache();
+    REPORTER_ASSERT(r, shape(font) == shaped);
+
+    // Runs shaped with another size aren't reused.
+    SkFont larger = font;
+    larger.setSize(font.getSize() * 2);
+    const RecordingRunHandler shapedLarger = shape(larger);
+    REPORTER_ASSERT(r, shapedLarger.fPositions != shaped.fPositions);
+    SkShaper::PurgeHarfBuzzCache();
+    REPORTER_ASSERT(r, shape(larger) == shapedLarger);
+}
+#endif
+
 #endif  // defined(SKSHAPER_IMPLEMENTATION) && !defined(SK_BUILD_FOR_GOOGLE3)
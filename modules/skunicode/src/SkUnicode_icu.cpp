@@ -196,6 +196,11 @@ class SkIcuBreakIteratorCache final {
     THashMap<Request, sk_sp<BreakIteratorRef>, Request::Hash> fRequestCache;
     SkMutex fCacheMutex;
 
+    // Iterators given back after use, by their type and the language tag they were asked for.
+    // Taking one of them saves cloning (and later closing) the cached iterator.
+    THashMap<Request, std::vector<ICUBreakIterator>, Request::Hash> fIdleIterators;
+    static constexpr size_t kMaxIdleIterators = 4;
+
     void purgeIfNeeded() {
         // If there are too many requests remove some (oldest first?)
         // This may free some break iterators
@@ -221,6 +226,34 @@ class SkIcuBreakIteratorCache final {
         return instance;
     }
 
+    // Returns an iterator that was given back with recycleBreakIterator, if there is one
+    ICUBreakIterator takeIdleBreakIterator(SkUnicode::BreakType type, const char* bcp47) {
+        SkAutoMutexExclusive lock(fCacheMutex);
+        std::vector<ICUBreakIterator>* idle = fIdleIterators.find(Request(type, bcp47 ? bcp47 : ""));
+        if (!idle || idle->empty()) {
+            return nullptr;
+        }
+        ICUBreakIterator iterator = std::move(idle->back());
+        idle->pop_back();
+        return iterator;
+    }
+
+    void recycleBreakIterator(SkUnicode::BreakType type, const char* bcp47,
+                              ICUBreakIterator iterator) {
+        SkAutoMutexExclusive lock(fCacheMutex);
+        if (fIdleIterators.count() > 100) {
+            fIdleIterators.reset();
+        }
+        Request request(type, bcp47 ? bcp47 : "");
+        std::vector<ICUBreakIterator>* idle = fIdleIterators.find(request);
+        if (!idle) {
+            idle = fIdleIterators.set(request, std::vector<ICUBreakIterator>());
+        }
+        if (idle->size() < kMaxIdleIterators) {
+            idle->push_back(std::move(iterator));
+        }
+    }
+
     ICUBreakIterator makeBreakIterator(SkUnicode::BreakType type, const char* bcp47) {
         SkAutoMutexExclusive lock(fCacheMutex);
         UErrorCode status = U_ZERO_ERROR;
@@ -325,6 +358,33 @@ class SkIcuBreakIteratorCache final {
 };
 /*static*/ int32_t SkIcuBreakIteratorCache::BreakIteratorRef::Instances{0};
 
+// A break iterator for one pass over a text, that goes back to the cache afterwards
+class SkPooledBreakIterator final {
+public:
+    SkPooledBreakIterator(SkUnicode::BreakType type, const char* bcp47)
+        : fType(type)
+        , fBcp47(bcp47) {
+        auto& cache = SkIcuBreakIteratorCache::get();
+        fIterator = cache.takeIdleBreakIterator(type, bcp47);
+        if (!fIterator) {
+            fIterator = cache.makeBreakIterator(type, bcp47);
+        }
+    }
+    ~SkPooledBreakIterator() {
+        if (fIterator) {
+            SkIcuBreakIteratorCache::get().recycleBreakIterator(fType, fBcp47, std::move(fIterator));
+        }
+    }
+
+    UBreakIterator* get() const { return fIterator.get(); }
+    explicit operator bool() const { return fIterator != nullptr; }
+
+private:
+    const SkUnicode::BreakType fType;
+    const char* fBcp47;
+    ICUBreakIterator fIterator;
+};
+
 class SkUnicode_icu : public SkUnicode {
 
     std::unique_ptr<SkUnicode> copy() override {
@@ -337,7 +397,7 @@ class SkUnicode_icu : public SkUnicode {
         UErrorCode status = U_ZERO_ERROR;
 
         const BreakType type = BreakType::kWords;
-        ICUBreakIterator iterator = SkIcuBreakIteratorCache::get().makeBreakIterator(type, locale);
+        SkPooledBreakIterator iterator(type, locale);
         if (!iterator) {
             SkDEBUGF("Break error: %s", sk_u_errorName(status));
             return false;
@@ -378,7 +438,7 @@ class SkUnicode_icu : public SkUnicode {
         }
         SkASSERT(text);
 
-        ICUBreakIterator iterator = SkIcuBreakIteratorCache::get().makeBreakIterator(type, locale);
+        SkPooledBreakIterator iterator(type, locale);
         if (!iterator) {
             return false;
         }
@@ -460,6 +520,15 @@ class SkUnicode_icu : public SkUnicode {
         return utf8 == '\t';
     }
 
+    static bool isAscii(const char utf8[], int utf8Units) {
+        for (int i = 0; i < utf8Units; ++i) {
+            if (static_cast<uint8_t>(utf8[i]) >= 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     static bool isHardLineBreak(SkUnichar utf8) {
         auto property = sk_u_getIntPropertyValue(utf8, UCHAR_LINE_BREAK);
         return property == U_LB_LINE_FEED || property == U_LB_MANDATORY_BREAK;
@@ -514,6 +583,14 @@ public:
                         int utf8Units,
                         TextDirection dir,
                         std::vector<BidiRegion>* results) override {
+        // ASCII has no strong right-to-left characters and no bidi controls, so the levels of
+        // left-to-right text don't need ICU (that is most of the short labels)
+        if (dir == TextDirection::kLTR && isAscii(utf8, utf8Units)) {
+            if (utf8Units > 0) {
+                results->emplace_back(0, utf8Units, 0);
+            }
+            return true;
+        }
         return SkUnicode_IcuBidi::ExtractBidi(utf8, utf8Units, dir, results);
     }
 
@@ -572,10 +649,19 @@ public:
                                        : CodeUnitFlags::kSoftLineBreakBefore;
         });
 
-        SkUnicode_icu::extractPositions(utf8, utf8Units, BreakType::kGraphemes, nullptr, //TODO
-                                        [&](int pos, int status) {
-            (*results)[pos] |= CodeUnitFlags::kGraphemeStart;
-        });
+        if (isAscii(utf8, utf8Units)) {
+            // Every ASCII character is a grapheme, except for a line feed after a carriage return
+            for (int i = 0; i <= utf8Units; ++i) {
+                if (i == 0 || i == utf8Units || utf8[i - 1] != '\r' || utf8[i] != '\n') {
+                    (*results)[i] |= CodeUnitFlags::kGraphemeStart;
+                }
+            }
+        } else {
+            SkUnicode_icu::extractPositions(utf8, utf8Units, BreakType::kGraphemes, nullptr, //TODO
+                                            [&](int pos, int status) {
+                (*results)[pos] |= CodeUnitFlags::kGraphemeStart;
+            });
+        }
 
         const char* current = utf8;
         const char* end = utf8 + utf8Units;
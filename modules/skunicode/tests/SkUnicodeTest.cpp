@@ -249,3 +249,44 @@ UNIX_ONLY_TEST(SkUnicode_Ideographic, reporter) {
         REPORTER_ASSERT(reporter, !icu->isIdeographic(n));
     }
 }
+
+#ifdef SK_UNICODE_ICU_IMPLEMENTATION
+UNIX_ONLY_TEST(SkUnicode_AsciiFastPaths, reporter) {
+    auto icu = SkUnicode::Make();
+
+    // The line feed after the carriage return is not a grapheme of its own
+    SkString text("ab\r\ncd 12");
+    skia_private::TArray<SkUnicode::CodeUnitFlags, true> flags;
+    REPORTER_ASSERT(reporter,
+                    icu->computeCodeUnitFlags(text.data(), text.size(), false, &flags));
+    for (size_t i = 0; i <= text.size(); ++i) {
+        REPORTER_ASSERT(reporter, SkUnicode::hasGraphemeStartFlag(flags[i]) == (i != 3), "%zu", i);
+    }
+
+    std::vector<SkUnicode::BidiRegion> regions;
+    REPORTER_ASSERT(reporter, icu->getBidiRegions(text.c_str(), text.size(),
+                                                  SkUnicode::TextDirection::kLTR, &regions));
+    REPORTER_ASSERT(reporter, regions.size() == 1);
+    REPORTER_ASSERT(reporter, regions[0].start == 0 && regions[0].end == text.size());
+    REPORTER_ASSERT(reporter, regions[0].level == 0);
+
+    // Right-to-left paragraphs still go through ICU
+    regions.clear();
+    REPORTER_ASSERT(reporter, icu->getBidiRegions(text.c_str(), text.size(),
+                                                  SkUnicode::TextDirection::kRTL, &regions));
+    REPORTER_ASSERT(reporter, !regions.empty() && regions[0].level == 2);
+}
+
+UNIX_ONLY_TEST(SkUnicode_ReusesBreakIterators, reporter) {
+    // The same pooled iterators are used for every call, on different texts
+    auto icu = SkUnicode::Make();
+    for (int i = 0; i < 10; ++i) {
+        SkString text = SkStringPrintf("Sentence %d. Another one!", i);
+        std::vector<SkUnicode::Position> results;
+        REPORTER_ASSERT(reporter,
+                        icu->getSentences(text.data(), text.size(), nullptr, &results));
+        REPORTER_ASSERT(reporter, results.size() == 3);
+        REPORTER_ASSERT(reporter, results.back() == text.size());
+    }
+}
+#endif
@@ -14,9 +14,11 @@
 #include "include/private/base/SkTemplates.h"
 #include "modules/skresources/include/SkResources.h"
 #include "modules/svg/include/SkSVGIDMapper.h"
+#include "modules/svg/include/SkSVGTypes.h"
 
 class SkCanvas;
 class SkDOM;
+class SkPicture;
 class SkStream;
 class SkSVGNode;
 struct SkSVGPresentationContext;
@@ -88,6 +90,42 @@ public:
     /** Render the node with the given id as if it were the only child of the root. */
     void renderNode(SkCanvas*, SkSVGPresentationContext&, const char* id) const;
 
+    /**
+     * A DOM snapshot lowered to a display list, for rendering many times at different sizes.
+     *
+     * Attribute resolution, inheritance, unit conversion and path construction are performed
+     * once, at compile time.  Rendering replays the display list, mapped to the viewport for the
+     * requested container size.  Compiled DOMs are immutable, and can be rendered concurrently.
+     */
+    class SK_API Compiled final : public SkRefCnt {
+    public:
+        ~Compiled() override;
+
+        /** Equivalent to SkSVGDOM::render() with the given container size. */
+        void render(SkCanvas*, const SkSize& containerSize) const;
+
+    private:
+        friend class SkSVGDOM;
+
+        Compiled(sk_sp<SkPicture>, const SkSVGSVG& root);
+
+        const sk_sp<SkPicture>         fContent;
+        const SkSVGLength              fWidth,
+                                       fHeight;
+        const SkSVGPreserveAspectRatio fPreserveAspectRatio;
+        const std::optional<SkRect>    fViewBox;
+    };
+
+    /**
+     * Compiles the current DOM state for repeated rendering (see Compiled above).  Later DOM
+     * changes are not reflected in the result.
+     *
+     * Returns nullptr when the content depends on the container size in ways which cannot be
+     * captured by a viewport mapping, i.e. when the root element has relative dimensions but no
+     * viewBox.
+     */
+    sk_sp<Compiled> compile() const;
+
 private:
     SkSVGDOM(sk_sp<SkSVGSVG>, sk_sp<SkFontMgr>, sk_sp<skresources::ResourceProvider>,
              SkSVGIDMapper&&);
@@ -105,6 +105,8 @@ public:
     SkPath asPath(const SkSVGRenderContext&) const;
     SkRect objectBoundingBox(const SkSVGRenderContext&) const;
 
+    static SkMatrix ComputeViewboxMatrix(const SkRect&, const SkRect&, SkSVGPreserveAspectRatio);
+
     void setAttribute(SkSVGAttribute, const SkSVGValue&);
     bool setAttribute(const char* attributeName, const char* attributeValue);
 
@@ -149,8 +151,6 @@ public:
 protected:
     SkSVGNode(SkSVGTag);
 
-    static SkMatrix ComputeViewboxMatrix(const SkRect&, const SkRect&, SkSVGPreserveAspectRatio);
-
     // Called before onRender(), to apply local attributes to the context.  Unlike onRender(),
     // onPrepareToRender() bubbles up the inheritance chain: overriders should always call
     // INHERITED::onPrepareToRender(), unless they intend to short-circuit rendering
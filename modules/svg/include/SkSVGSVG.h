@@ -34,6 +34,9 @@ public:
 
     void renderNode(const SkSVGRenderContext&, const SkSVGIRI& iri) const;
 
+    // Renders the element content in viewBox coordinates, without the viewport mapping.
+    void renderContent(const SkSVGRenderContext&) const;
+
 protected:
     bool onPrepareToRender(SkSVGRenderContext*) const override;
 
@@ -7,6 +7,8 @@
 
 #include "include/core/SkCanvas.h"
 #include "include/core/SkFontMgr.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPictureRecorder.h"
 #include "include/core/SkString.h"
 #include "include/private/base/SkTo.h"
 #include "modules/svg/include/SkSVGAttributeParser.h"
@@ -47,8 +49,9 @@
 #include "modules/svg/include/SkSVGUse.h"
 #include "modules/svg/include/SkSVGValue.h"
 #include "src/base/SkTSearch.h"
+#include "src/core/SkRectPriv.h"
 #include "src/core/SkTraceEvent.h"
-#include "src/xml/SkDOM.h"
+#include "src/xml/SkXMLParser.h"
 
 namespace {
 
@@ -275,15 +278,6 @@ SortedDictionaryEntry<sk_sp<SkSVGNode>(*)()> gTagFactories[] = {
     { "use"               , []() -> sk_sp<SkSVGNode> { return SkSVGUse::Make();                }},
 };
 
-struct ConstructionContext {
-    ConstructionContext(SkSVGIDMapper* mapper) : fParent(nullptr), fIDMapper(mapper) {}
-    ConstructionContext(const ConstructionContext& other, const sk_sp<SkSVGNode>& newParent)
-        : fParent(newParent.get()), fIDMapper(other.fIDMapper) {}
-
-    SkSVGNode*     fParent;
-    SkSVGIDMapper* fIDMapper;
-};
-
 bool set_string_attribute(const sk_sp<SkSVGNode>& node, const char* name, const char* value) {
     if (node->parseAndSetAttribute(name, value)) {
         // Handled by new code path
@@ -312,76 +306,93 @@ bool set_string_attribute(const sk_sp<SkSVGNode>& node, const char* name, const
     return true;
 }
 
-void parse_node_attributes(const SkDOM& xmlDom, const SkDOM::Node* xmlNode,
-                           const sk_sp<SkSVGNode>& svgNode, SkSVGIDMapper* mapper) {
-    const char* name, *value;
-    SkDOM::AttrIter attrIter(xmlDom, xmlNode);
-    while ((name = attrIter.next(&value))) {
-        // We're handling id attributes out of band for now.
-        if (!strcmp(name, "id")) {
-            mapper->set(SkString(value), svgNode);
-            continue;
-        }
-        set_string_attribute(svgNode, name, value);
+sk_sp<SkSVGNode> make_svg_node(const SkSVGNode* parent, const char* elem) {
+    if (strcmp(elem, "svg") == 0) {
+        // Outermost SVG element must be tagged as such.
+        return SkSVGSVG::Make(parent ? SkSVGSVG::Type::kInner
+                                     : SkSVGSVG::Type::kRoot);
     }
-}
-
-sk_sp<SkSVGNode> construct_svg_node(const SkDOM& dom, const ConstructionContext& ctx,
-                                    const SkDOM::Node* xmlNode) {
-    const char* elem = dom.getName(xmlNode);
-    const SkDOM::Type elemType = dom.getType(xmlNode);
-
-    if (elemType == SkDOM::kText_Type) {
-        // Text literals require special handling.
-        SkASSERT(dom.countChildren(xmlNode) == 0);
-        auto txt = SkSVGTextLiteral::Make();
-        txt->setText(SkString(dom.getName(xmlNode)));
-        ctx.fParent->appendChild(std::move(txt));
 
+    const int tagIndex = SkStrSearch(&gTagFactories[0].fKey,
+                                     SkTo<int>(std::size(gTagFactories)),
+                                     elem, sizeof(gTagFactories[0]));
+    if (tagIndex < 0) {
+#if defined(SK_VERBOSE_SVG_PARSING)
+        SkDebugf("unhandled element: <%s>\n", elem);
+#endif
         return nullptr;
     }
+    SkASSERT(SkTo<size_t>(tagIndex) < std::size(gTagFactories));
 
-    SkASSERT(elemType == SkDOM::kElement_Type);
+    return gTagFactories[tagIndex].fValue();
+}
 
-    auto make_node = [](const ConstructionContext& ctx, const char* elem) -> sk_sp<SkSVGNode> {
-        if (strcmp(elem, "svg") == 0) {
-            // Outermost SVG element must be tagged as such.
-            return SkSVGSVG::Make(ctx.fParent ? SkSVGSVG::Type::kInner
-                                              : SkSVGSVG::Type::kRoot);
-        }
+// Constructs the SVG node tree straight from the XML parser callbacks, without materializing
+// an intermediate SkDOM: each node is attached to its parent as soon as its element closes.
+class SVGNodeConstructor final : public SkXMLParser {
+public:
+    explicit SVGNodeConstructor(SkSVGIDMapper* mapper) : fIDMapper(mapper) {}
 
-        const int tagIndex = SkStrSearch(&gTagFactories[0].fKey,
-                                         SkTo<int>(std::size(gTagFactories)),
-                                         elem, sizeof(gTagFactories[0]));
-        if (tagIndex < 0) {
-#if defined(SK_VERBOSE_SVG_PARSING)
-            SkDebugf("unhandled element: <%s>\n", elem);
-#endif
-            return nullptr;
+    sk_sp<SkSVGNode> detachRoot() { return std::move(fRoot); }
+
+private:
+    // The open element stack holds null entries for unhandled elements, whose subtrees are
+    // skipped.
+    SkSVGNode* current() const { return fOpenNodes.empty() ? nullptr : fOpenNodes.back().get(); }
+
+    bool onStartElement(const char elem[]) override {
+        sk_sp<SkSVGNode> node;
+        if (fOpenNodes.empty() ? !fRoot : this->current() != nullptr) {
+            node = make_svg_node(this->current(), elem);
         }
-        SkASSERT(SkTo<size_t>(tagIndex) < std::size(gTagFactories));
+        fOpenNodes.push_back(std::move(node));
 
-        return gTagFactories[tagIndex].fValue();
-    };
+        return false;
+    }
 
-    auto node = make_node(ctx, elem);
-    if (!node) {
-        return nullptr;
+    bool onAddAttribute(const char name[], const char value[]) override {
+        if (const auto& node = fOpenNodes.back()) {
+            // We're handling id attributes out of band for now.
+            if (!strcmp(name, "id")) {
+                fIDMapper->set(SkString(value), node);
+            } else {
+                set_string_attribute(node, name, value);
+            }
+        }
+
+        return false;
     }
 
-    parse_node_attributes(dom, xmlNode, node, ctx.fIDMapper);
+    bool onEndElement(const char[]) override {
+        auto node = std::move(fOpenNodes.back());
+        fOpenNodes.pop_back();
 
-    ConstructionContext localCtx(ctx, node);
-    for (auto* child = dom.getFirstChild(xmlNode, nullptr); child;
-         child = dom.getNextSibling(child)) {
-        sk_sp<SkSVGNode> childNode = construct_svg_node(dom, localCtx, child);
-        if (childNode) {
-            node->appendChild(std::move(childNode));
+        if (node) {
+            if (auto* parent = this->current()) {
+                parent->appendChild(std::move(node));
+            } else {
+                fRoot = std::move(node);
+            }
         }
+
+        return false;
     }
 
-    return node;
-}
+    bool onText(const char text[], int len) override {
+        // Text literals require special handling.
+        if (auto* parent = this->current()) {
+            auto txt = SkSVGTextLiteral::Make();
+            txt->setText(SkString(text, SkToSizeT(len)));
+            parent->appendChild(std::move(txt));
+        }
+
+        return false;
+    }
+
+    SkSVGIDMapper*                fIDMapper;
+    std::vector<sk_sp<SkSVGNode>> fOpenNodes;
+    sk_sp<SkSVGNode>              fRoot;
+};
 
 } // anonymous namespace
 
@@ -397,15 +408,13 @@ SkSVGDOM::Builder& SkSVGDOM::Builder::setResourceProvider(sk_sp<skresources::Res
 
 sk_sp<SkSVGDOM> SkSVGDOM::Builder::make(SkStream& str) const {
     TRACE_EVENT0("skia", TRACE_FUNC);
-    SkDOM xmlDom;
-    if (!xmlDom.build(str)) {
+    SkSVGIDMapper mapper;
+    SVGNodeConstructor constructor(&mapper);
+    if (!constructor.parse(str)) {
         return nullptr;
     }
 
-    SkSVGIDMapper mapper;
-    ConstructionContext ctx(&mapper);
-
-    auto root = construct_svg_node(xmlDom, ctx, xmlDom.getRootNode());
+    auto root = constructor.detachRoot();
     if (!root || root->tag() != SkSVGTag::kSvg) {
         return nullptr;
     }
@@ -454,6 +463,75 @@ void SkSVGDOM::renderNode(SkCanvas* canvas, SkSVGPresentationContext& pctx, cons
     }
 }
 
+sk_sp<SkSVGDOM::Compiled> SkSVGDOM::compile() const {
+    TRACE_EVENT0("skia", TRACE_FUNC);
+
+    if (!fRoot) {
+        return nullptr;
+    }
+
+    const auto is_relative = [](const SkSVGLength& l) {
+        return l.unit() == SkSVGLength::Unit::kPercentage;
+    };
+    const auto& view_box = fRoot->getViewBox();
+    if (!view_box.isValid() && (is_relative(fRoot->getWidth()) ||
+                                is_relative(fRoot->getHeight()))) {
+        return nullptr;
+    }
+
+    // With a viewBox, the content is laid out in viewBox coordinates and only the viewport
+    // mapping depends on the container size.  Otherwise, the root has a fixed size and the
+    // content is independent of the container.
+    SkPictureRecorder recorder;
+    auto* canvas = recorder.beginRecording(SkRectPriv::MakeLargeS32());
+
+    SkSVGLengthContext       lctx(fContainerSize);
+    SkSVGPresentationContext pctx;
+    const SkSVGRenderContext ctx(canvas, fFontMgr, fResourceProvider, fIDMapper, lctx, pctx,
+                                 {nullptr, nullptr});
+    if (view_box.isValid()) {
+        fRoot->renderContent(ctx);
+    } else {
+        fRoot->render(ctx);
+    }
+
+    return sk_sp<Compiled>(new Compiled(recorder.finishRecordingAsPicture(), *fRoot));
+}
+
+SkSVGDOM::Compiled::Compiled(sk_sp<SkPicture> content, const SkSVGSVG& root)
+    : fContent(std::move(content))
+    , fWidth(root.getWidth())
+    , fHeight(root.getHeight())
+    , fPreserveAspectRatio(root.getPreserveAspectRatio())
+    , fViewBox(root.getViewBox().isValid() ? std::optional<SkRect>(*root.getViewBox())
+                                           : std::nullopt) {}
+
+SkSVGDOM::Compiled::~Compiled() = default;
+
+void SkSVGDOM::Compiled::render(SkCanvas* canvas, const SkSize& containerSize) const {
+    TRACE_EVENT0("skia", TRACE_FUNC);
+
+    if (!fViewBox) {
+        canvas->drawPicture(fContent);
+        return;
+    }
+
+    // An empty viewbox disables rendering.
+    if (fViewBox->isEmpty()) {
+        return;
+    }
+
+    // Same viewport mapping as SkSVGSVG::onPrepareToRender() for the outermost element.
+    const auto viewport = SkSVGLengthContext(containerSize).resolveRect(SkSVGLength(0),
+                                                                        SkSVGLength(0),
+                                                                        fWidth, fHeight);
+    auto content_matrix = SkMatrix::Translate(viewport.x(), viewport.y());
+    content_matrix.preConcat(SkSVGNode::ComputeViewboxMatrix(*fViewBox, viewport,
+                                                             fPreserveAspectRatio));
+
+    canvas->drawPicture(fContent, &content_matrix, nullptr);
+}
+
 const SkSize& SkSVGDOM::containerSize() const {
     return fContainerSize;
 }
@@ -26,6 +26,24 @@ void SkSVGSVG::renderNode(const SkSVGRenderContext& ctx, const SkSVGIRI& iri) co
     }
 }
 
+void SkSVGSVG::renderContent(const SkSVGRenderContext& ctx) const {
+    SkSVGRenderContext localContext(ctx, this);
+
+    if (fViewBox.isValid()) {
+        // An empty viewbox disables rendering.
+        if (fViewBox->isEmpty()) {
+            return;
+        }
+
+        localContext.writableLengthContext()->setViewPort(SkSize::Make(fViewBox->width(),
+                                                                       fViewBox->height()));
+    }
+
+    if (this->INHERITED::onPrepareToRender(&localContext)) {
+        this->onRender(localContext);
+    }
+}
+
 bool SkSVGSVG::onPrepareToRender(SkSVGRenderContext* ctx) const {
     // x/y are ignored for outermost svg elements
     const auto x = fType == Type::kInner ? fX : SkSVGLength(0);
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <cstring>
+#include <string>
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkStream.h"
+#include "modules/svg/include/SkSVGDOM.h"
+#include "tests/Test.h"
+
+static sk_sp<SkSVGDOM> make_dom(const std::string& svgText) {
+    auto str = SkMemoryStream::MakeDirect(svgText.c_str(), svgText.size());
+    return SkSVGDOM::Builder().make(*str);
+}
+
+DEF_TEST(Svg_Compile_MatchesRender, r) {
+    const std::string svgText = R"EOF(
+    <svg width="100%" height="100%" viewBox="10 10 40 20" xmlns="http://www.w3.org/2000/svg">
+        <g fill="green" opacity="0.5">
+            <rect x="10" y="10" width="50%" height="50%"/>
+            <circle cx="40" cy="20" r="8" stroke="blue" stroke-width="2"/>
+        </g>
+        <path d="M10 30 L50 10" stroke="red" stroke-width="1"/>
+    </svg>
+    )EOF";
+
+    auto dom = make_dom(svgText);
+    REPORTER_ASSERT(r, dom);
+    const auto compiled = dom->compile();
+    REPORTER_ASSERT(r, compiled);
+
+    for (const auto size : { SkISize{80, 40}, SkISize{100, 100}, SkISize{33, 70} }) {
+        SkBitmap expected, actual;
+        expected.allocN32Pixels(size.width(), size.height());
+        actual.allocN32Pixels(size.width(), size.height());
+        expected.eraseColor(SK_ColorTRANSPARENT);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+
+        dom->setContainerSize(SkSize::Make(size));
+        SkCanvas expectedCanvas(expected), actualCanvas(actual);
+        dom->render(&expectedCanvas);
+        compiled->render(&actualCanvas, SkSize::Make(size));
+
+        REPORTER_ASSERT(r, 0 == memcmp(expected.getPixels(), actual.getPixels(),
+                                       expected.computeByteSize()),
+                        "size: %dx%d", size.width(), size.height());
+    }
+}
+
+DEF_TEST(Svg_Compile_RequiresFixedLayout, r) {
+    // Relative root dimensions without a viewBox cannot be captured by a viewport mapping.
+    auto dom = make_dom(R"EOF(
+    <svg width="100%" height="50" xmlns="http://www.w3.org/2000/svg">
+        <rect width="50%" height="10"/>
+    </svg>
+    )EOF");
+    REPORTER_ASSERT(r, dom && !dom->compile());
+
+    dom = make_dom(R"EOF(
+    <svg width="100" height="50" xmlns="http://www.w3.org/2000/svg">
+        <rect width="50%" height="10"/>
+    </svg>
+    )EOF");
+    REPORTER_ASSERT(r, dom && dom->compile());
+}
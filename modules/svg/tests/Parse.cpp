@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include <string>
+
+#include "include/core/SkStream.h"
+#include "modules/svg/include/SkSVGDOM.h"
+#include "modules/svg/include/SkSVGNode.h"
+#include "modules/svg/include/SkSVGRect.h"
+#include "modules/svg/include/SkSVGSVG.h"
+#include "tests/Test.h"
+
+namespace {
+
+// Forces the XML parser down its incremental (chunked) path.
+class NonMemoryStream final : public SkMemoryStream {
+public:
+    using SkMemoryStream::SkMemoryStream;
+
+    const void* getMemoryBase() override { return nullptr; }
+};
+
+} // namespace
+
+DEF_TEST(Svg_Parse_Streaming, r) {
+    std::string svgText = R"EOF(
+    <svg id="root" width="100" height="50" xmlns="http://www.w3.org/2000/svg">
+        <unknown>
+            <rect id="skipped" width="1" height="1"/>
+        </unknown>
+        <g id="group">
+            <rect id="rect" width="10" height="5"/>
+            <svg id="inner"/>
+        </g>
+        <text id="text">Hello</text>
+    )EOF";
+    // Large enough to span multiple parser buffers.
+    for (int i = 0; i < 1000; ++i) {
+        svgText += "<rect width=\"1\" height=\"1\"/>\n";
+    }
+    svgText += "</svg>";
+
+    for (bool chunked : {false, true}) {
+        std::unique_ptr<SkStream> stream =
+                chunked ? std::make_unique<NonMemoryStream>(svgText.c_str(), svgText.size())
+                        : SkMemoryStream::MakeDirect(svgText.c_str(), svgText.size());
+        auto dom = SkSVGDOM::Builder().make(*stream);
+        REPORTER_ASSERT(r, dom);
+
+        auto* root = dom->findNodeById("root");
+        REPORTER_ASSERT(r, root && root->get() == dom->getRoot());
+
+        // Subtrees of unhandled elements are skipped.
+        REPORTER_ASSERT(r, !dom->findNodeById("skipped"));
+
+        auto* rect = dom->findNodeById("rect");
+        REPORTER_ASSERT(r, rect && (*rect)->tag() == SkSVGTag::kRect);
+        REPORTER_ASSERT(r, static_cast<const SkSVGRect*>(rect->get())->getWidth() ==
+                           SkSVGLength(10));
+
+        auto* inner = dom->findNodeById("inner");
+        REPORTER_ASSERT(r, inner && (*inner)->tag() == SkSVGTag::kSvg);
+        REPORTER_ASSERT(r, dom->findNodeById("text"));
+    }
+
+    // Malformed and non-SVG documents are rejected.
+    for (const char* doc : { "<svg><g></svg>", "<g/>" }) {
+        auto stream = SkMemoryStream::MakeDirect(doc, strlen(doc));
+        REPORTER_ASSERT(r, !SkSVGDOM::Builder().make(*stream), "%s", doc);
+    }
+}
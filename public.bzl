@@ -42,6 +42,7 @@ SKIA_PUBLIC_HDRS = [
     "include/core/SkColorTable.h",
     "include/core/SkColorType.h",
     "include/core/SkContourMeasure.h",
+    "include/core/SkCounters.h",
     "include/core/SkCoverageMode.h",
     "include/core/SkCubicMap.h",
     "include/core/SkData.h",
@@ -212,6 +213,7 @@ SKIA_PUBLIC_HDRS = [
     "include/utils/SkCanvasStateUtils.h",
     "include/utils/SkCustomTypeface.h",
     "include/utils/SkEventTracer.h",
+    "include/utils/SkIncrementalImageUploader.h",
     "include/utils/SkNoDrawCanvas.h",
     "include/utils/SkNullCanvas.h",
     "include/utils/SkNWayCanvas.h",
@@ -394,11 +396,13 @@ BASE_SRCS_ALL = [
     "src/core/SkBlitBWMaskTemplate.h",
     "src/core/SkBlitMask.h",
     "src/core/SkBlitMask_opts.cpp",
+    "src/core/SkBlitMask_opts_hsw.cpp",
     "src/core/SkBlitMask_opts_ssse3.cpp",
     "src/core/SkBlitRow.h",
     "src/core/SkBlitRow_D32.cpp",
     "src/core/SkBlitRow_opts.cpp",
     "src/core/SkBlitRow_opts_hsw.cpp",
+    "src/core/SkBlitRow_opts_skx.cpp",
     "src/core/SkBlitter.cpp",
     "src/core/SkBlitter.h",
     "src/core/SkBlitter_A8.cpp",
@@ -434,8 +438,12 @@ BASE_SRCS_ALL = [
     "src/core/SkCompressedDataUtils.cpp",
     "src/core/SkCompressedDataUtils.h",
     "src/core/SkContourMeasure.cpp",
+    "src/core/SkContourMeasureCache.cpp",
+    "src/core/SkContourMeasureCache.h",
     "src/core/SkConvertPixels.cpp",
     "src/core/SkConvertPixels.h",
+    "src/core/SkCounters.cpp",
+    "src/core/SkCountersPriv.h",
     "src/core/SkCoreBlitters.h",
     "src/core/SkCpu.cpp",
     "src/core/SkCpu.h",
@@ -586,6 +594,7 @@ BASE_SRCS_ALL = [
     "src/core/SkPixelRefPriv.h",
     "src/core/SkPixmap.cpp",
     "src/core/SkPixmapDraw.cpp",
+    "src/core/SkPixmapResample.cpp",
     "src/core/SkPoint.cpp",
     "src/core/SkPoint3.cpp",
     "src/core/SkPointPriv.h",
@@ -613,6 +622,8 @@ BASE_SRCS_ALL = [
     "src/core/SkReadPixelsRec.h",
     "src/core/SkRecord.cpp",
     "src/core/SkRecord.h",
+    "src/core/SkRecordDamage.cpp",
+    "src/core/SkRecordDamage.h",
     "src/core/SkRecordDraw.cpp",
     "src/core/SkRecordDraw.h",
     "src/core/SkRecordOpts.cpp",
@@ -648,6 +659,7 @@ BASE_SRCS_ALL = [
     "src/core/SkScanPriv.h",
     "src/core/SkScan_AAAPath.cpp",
     "src/core/SkScan_AntiPath.cpp",
+    "src/core/SkScan_AntiRRect.cpp",
     "src/core/SkScan_Antihair.cpp",
     "src/core/SkScan_Hairline.cpp",
     "src/core/SkScan_Path.cpp",
@@ -669,6 +681,8 @@ BASE_SRCS_ALL = [
     "src/core/SkStringUtils.h",
     "src/core/SkStroke.cpp",
     "src/core/SkStroke.h",
+    "src/core/SkStrokeCache.cpp",
+    "src/core/SkStrokeCache.h",
     "src/core/SkStrokeRec.cpp",
     "src/core/SkStrokerPriv.cpp",
     "src/core/SkStrokerPriv.h",
@@ -677,10 +691,12 @@ BASE_SRCS_ALL = [
     "src/core/SkSwizzlePriv.h",
     "src/core/SkSwizzler_opts.cpp",
     "src/core/SkSwizzler_opts_hsw.cpp",
+    "src/core/SkSwizzler_opts_skx.cpp",
     "src/core/SkSwizzler_opts_ssse3.cpp",
     "src/core/SkTDynamicHash.h",
     "src/core/SkTHash.h",
     "src/core/SkTMultiMap.h",
+    "src/core/SkTSwissTable.h",
     "src/core/SkTaskGroup.cpp",
     "src/core/SkTaskGroup.h",
     "src/core/SkTextBlob.cpp",
@@ -688,6 +704,10 @@ BASE_SRCS_ALL = [
     "src/core/SkTextBlobTrace.cpp",
     "src/core/SkTextBlobTrace.h",
     "src/core/SkTextFormatParams.h",
+    "src/core/SkThreadedBitmapDevice.cpp",
+    "src/core/SkThreadedBitmapDevice.h",
+    "src/core/SkTiledPictureDraw.cpp",
+    "src/core/SkTiledPictureDraw.h",
     "src/core/SkTraceEvent.h",
     "src/core/SkTraceEventCommon.h",
     "src/core/SkTypeface.cpp",
@@ -942,6 +962,8 @@ BASE_SRCS_ALL = [
     "src/gpu/ganesh/GrProcessorUnitTest.h",
     "src/gpu/ganesh/GrProgramDesc.cpp",
     "src/gpu/ganesh/GrProgramDesc.h",
+    "src/gpu/ganesh/GrProgramDescInterner.cpp",
+    "src/gpu/ganesh/GrProgramDescInterner.h",
     "src/gpu/ganesh/GrProgramInfo.cpp",
     "src/gpu/ganesh/GrProgramInfo.h",
     "src/gpu/ganesh/GrPromiseImageTexture.cpp",
@@ -1392,6 +1414,8 @@ BASE_SRCS_ALL = [
     "src/pdf/SkPDFResourceDict.h",
     "src/pdf/SkPDFShader.cpp",
     "src/pdf/SkPDFShader.h",
+    "src/pdf/SkPDFSharedCache.cpp",
+    "src/pdf/SkPDFSharedCache.h",
     "src/pdf/SkPDFSubsetFont.cpp",
     "src/pdf/SkPDFSubsetFont.h",
     "src/pdf/SkPDFTag.cpp",
@@ -1434,6 +1458,8 @@ BASE_SRCS_ALL = [
     "src/sfnt/SkPanose.h",
     "src/sfnt/SkSFNTHeader.h",
     "src/sfnt/SkTTCFHeader.h",
+    "src/shaders/SkAnalyticClipShader.cpp",
+    "src/shaders/SkAnalyticClipShader.h",
     "src/shaders/SkBlendShader.cpp",
     "src/shaders/SkBlendShader.h",
     "src/shaders/SkColorFilterShader.cpp",
@@ -1444,6 +1470,8 @@ BASE_SRCS_ALL = [
     "src/shaders/SkCoordClampShader.h",
     "src/shaders/SkEmptyShader.cpp",
     "src/shaders/SkEmptyShader.h",
+    "src/shaders/SkGainmapApplyShader.cpp",
+    "src/shaders/SkGainmapApplyShader.h",
     "src/shaders/SkGainmapShader.cpp",
     "src/shaders/SkImageShader.cpp",
     "src/shaders/SkImageShader.h",
@@ -1732,6 +1760,7 @@ BASE_SRCS_ALL = [
     "src/utils/SkFloatToDecimal.cpp",
     "src/utils/SkFloatToDecimal.h",
     "src/utils/SkFloatUtils.h",
+    "src/utils/SkIncrementalImageUploader.cpp",
     "src/utils/SkJSON.cpp",
     "src/utils/SkJSON.h",
     "src/utils/SkJSONWriter.cpp",
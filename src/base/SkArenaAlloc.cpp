@@ -8,6 +8,7 @@
 #include "src/base/SkArenaAlloc.h"
 
 #include "include/private/base/SkMalloc.h"
+#include "src/base/SkMathPriv.h"
 
 #include <algorithm>
 #include <cassert>
@@ -15,6 +16,93 @@
 
 static char* end_chain(char*) { return nullptr; }
 
+namespace {
+// Free heap blocks, by power-of-two size class.  Each thread keeps only a few blocks of each
+// class, and a bounded number of bytes in total.
+class BlockPool {
+public:
+    static constexpr int kMinClassShift = 10;  // 1K
+    static constexpr int kMaxClassShift = 16;  // 64K
+    static constexpr int kClassCount = kMaxClassShift - kMinClassShift + 1;
+    static constexpr int kMaxBlocksPerClass = 4;
+    static constexpr size_t kMaxCachedBytes = 256 * 1024;
+
+    // Returns the size class to use for a block of size bytes, or -1 if it shouldn't be pooled.
+    static int SizeClass(uint32_t size) {
+        if (size < (1u << kMinClassShift) || size > (1u << kMaxClassShift)) {
+            return -1;
+        }
+        return SkNextLog2(size) - kMinClassShift;
+    }
+    static uint32_t ClassSize(int sizeClass) { return 1u << (sizeClass + kMinClassShift); }
+
+    char* acquire(int sizeClass) {
+        if (fCount[sizeClass] > 0) {
+            fStats.fHits++;
+            fStats.fCachedBytes -= ClassSize(sizeClass);
+            return fBlocks[sizeClass][--fCount[sizeClass]];
+        }
+        fStats.fMisses++;
+        return static_cast<char*>(sk_malloc_throw(ClassSize(sizeClass)));
+    }
+
+    void release(char* block, int sizeClass);
+
+    void purge() {
+        for (int c = 0; c < kClassCount; c++) {
+            while (fCount[c] > 0) {
+                sk_free(fBlocks[c][--fCount[c]]);
+            }
+        }
+        fStats = {0, 0, 0};
+    }
+
+    SkArenaAlloc::BlockPoolStats stats() const { return fStats; }
+
+    bool fDisabled = false;
+
+private:
+    char* fBlocks[kClassCount][kMaxBlocksPerClass] = {};
+    int   fCount[kClassCount] = {};
+    SkArenaAlloc::BlockPoolStats fStats = {0, 0, 0};
+};
+
+// The pool itself is trivially destructible, so arenas destroyed late in thread shutdown can
+// still safely find it.  This purges it when the thread exits, and stops it caching more.
+struct BlockPoolPurger {
+    ~BlockPoolPurger();
+};
+
+thread_local BlockPool       tBlockPool;
+thread_local BlockPoolPurger tBlockPoolPurger;
+
+BlockPoolPurger::~BlockPoolPurger() {
+    tBlockPool.purge();
+    tBlockPool.fDisabled = true;
+}
+
+void BlockPool::release(char* block, int sizeClass) {
+    if (!fDisabled &&
+        fCount[sizeClass] < kMaxBlocksPerClass &&
+        fStats.fCachedBytes + ClassSize(sizeClass) <= kMaxCachedBytes) {
+        (void)&tBlockPoolPurger;  // Make sure we purge the pool when this thread exits.
+        sk_asan_poison_memory_region(block, ClassSize(sizeClass));
+        fBlocks[sizeClass][fCount[sizeClass]++] = block;
+        fStats.fCachedBytes += ClassSize(sizeClass);
+        return;
+    }
+    sk_free(block);
+}
+}  // namespace
+
+SkArenaAlloc::BlockPoolStats SkArenaAlloc::ThreadBlockPoolStats() {
+    return tBlockPool.stats();
+}
+
+void SkArenaAlloc::PurgeThreadBlockPool() {
+    tBlockPool.purge();
+}
+
 SkArenaAlloc::SkArenaAlloc(char* block, size_t size, size_t firstHeapAllocation)
     : fDtorCursor {block}
     , fCursor     {block}
@@ -62,16 +150,22 @@ void SkArenaAlloc::RunDtorsOnBlock(char* footerEnd) {
 }
 
 char* SkArenaAlloc::NextBlock(char* footerEnd) {
-    char* objEnd = footerEnd - (sizeof(char*) + sizeof(Footer));
+    char* objEnd = footerEnd - (sizeof(char*) + sizeof(int8_t) + sizeof(Footer));
     char* next;
+    int8_t sizeClass;
     memmove(&next, objEnd, sizeof(char*));
+    memmove(&sizeClass, objEnd + sizeof(char*), sizeof(int8_t));
     RunDtorsOnBlock(next);
-    sk_free(objEnd);
+    if (sizeClass >= 0) {
+        tBlockPool.release(objEnd, sizeClass);
+    } else {
+        sk_free(objEnd);
+    }
     return nullptr;
 }
 
 void SkArenaAlloc::ensureSpace(uint32_t size, uint32_t alignment) {
-    constexpr uint32_t headerSize = sizeof(Footer) + sizeof(ptrdiff_t);
+    constexpr uint32_t headerSize = sizeof(Footer) + sizeof(ptrdiff_t) + sizeof(int8_t);
     constexpr uint32_t maxSize = std::numeric_limits<uint32_t>::max();
     constexpr uint32_t overhead = headerSize + sizeof(Footer);
     AssertRelease(size <= maxSize - overhead);
@@ -92,7 +186,15 @@ void SkArenaAlloc::ensureSpace(uint32_t size, uint32_t alignment) {
         allocationSize = (allocationSize + mask) & ~mask;
     }
 
-    char* newBlock = static_cast<char*>(sk_malloc_throw(allocationSize));
+    // Blocks that fit a pool size class are rounded up to it, and reused if we have one.
+    char* newBlock;
+    const int sizeClass = BlockPool::SizeClass(allocationSize);
+    if (sizeClass >= 0) {
+        allocationSize = BlockPool::ClassSize(sizeClass);
+        newBlock = tBlockPool.acquire(sizeClass);
+    } else {
+        newBlock = static_cast<char*>(sk_malloc_throw(allocationSize));
+    }
 
     auto previousDtor = fDtorCursor;
     fCursor = newBlock;
@@ -103,6 +205,7 @@ void SkArenaAlloc::ensureSpace(uint32_t size, uint32_t alignment) {
     sk_asan_poison_memory_region(fCursor, fEnd - fCursor);
 
     this->installRaw(previousDtor);
+    this->installRaw((int8_t)sizeClass);
     this->installFooter(NextBlock, 0);
 }
 
@@ -205,6 +205,17 @@ public:
         return objStart;
     }
 
+    // Heap blocks of moderate size are recycled through a small per-thread pool, so arenas that
+    // regularly outgrow their inline storage (e.g. one per draw) don't malloc a block each time.
+    struct BlockPoolStats {
+        size_t fHits;         // Blocks reused from this thread's pool.
+        size_t fMisses;       // Poolable blocks that had to be malloc'd.
+        size_t fCachedBytes;  // Bytes held by this thread's pool right now.
+    };
+    static BlockPoolStats ThreadBlockPoolStats();
+    // Frees the blocks held by this thread's pool, and resets its stats.
+    static void PurgeThreadBlockPool();
+
 protected:
     using FooterAction = char* (char*);
     struct Footer {
@@ -62,6 +62,19 @@ SkSpan<std::byte> SkContainerAllocator::allocate(int capacity, double growthFact
     return sk_allocate_throw(capacity * fSizeOfT);
 }
 
+SkSpan<std::byte> SkContainerAllocator::reallocate(void* ptr, int capacity, double growthFactor) {
+    SkASSERT(capacity > 0);
+    SkASSERT(growthFactor >= 1.0);
+    SkASSERT_RELEASE(capacity <= fMaxCapacity);
+
+    if (growthFactor > 1.0) {
+        capacity = this->growthFactorCapacity(capacity, growthFactor);
+    }
+
+    const size_t size = std::max(capacity * fSizeOfT, kMinBytes);
+    return complete_size(sk_realloc_throw(ptr, size), size);
+}
+
 size_t SkContainerAllocator::roundUpCapacity(int64_t capacity) const {
     SkASSERT(capacity >= 0);
 
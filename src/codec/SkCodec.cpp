@@ -127,6 +127,17 @@ void Register(Decoder d) {
     decoders->push_back(d);
 }
 
+void RegisterPreferred(Decoder d) {
+    auto decoders = get_decoders_for_editing();
+    for (size_t i = 0; i < decoders->size(); i++) {
+        if ((*decoders)[i].id == d.id) {
+            decoders->erase(decoders->begin() + i);
+            break;
+        }
+    }
+    decoders->insert(decoders->begin(), d);
+}
+
 bool HasDecoder(std::string_view id) {
     for (const SkCodecs::Decoder& decoder : get_decoders()) {
         if (decoder.id == id) {
@@ -191,20 +202,41 @@ std::unique_ptr<SkCodec> SkCodec::MakeFromStream(
         }
     }
 
+    auto make = [&](const SkCodecs::Decoder& proc, std::unique_ptr<SkStream> procStream) {
+        // png and heif are special, since we want to be able to supply a SkPngChunkReader
+        // or SelectionPolicy respectively
+        if (proc.id == "png") {
+            return proc.makeFromStream(std::move(procStream), outResult, chunkReader);
+        } else if (proc.id == "heif") {
+            return proc.makeFromStream(std::move(procStream), outResult, &selectionPolicy);
+        }
+        return proc.makeFromStream(std::move(procStream), outResult, nullptr);
+    };
+
     SkCodecs::MakeFromStreamCallback rawFallback = nullptr;
-    for (const SkCodecs::Decoder& proc : decoders) {
-        if (proc.isFormat(buffer, bytesRead)) {
-            // png and heif are special, since we want to be able to supply a SkPngChunkReader
-            // or SelectionPolicy respectively
-            if (proc.id == "png") {
-                return proc.makeFromStream(std::move(stream), outResult, chunkReader);
-            } else if (proc.id == "heif") {
-                return proc.makeFromStream(std::move(stream), outResult, &selectionPolicy);
-            } else if (proc.id == "raw") {
-                rawFallback = proc.makeFromStream;
-                continue;
-            }
-            return proc.makeFromStream(std::move(stream), outResult, nullptr);
+    for (size_t i = 0; i < decoders.size(); ++i) {
+        const SkCodecs::Decoder& proc = decoders[i];
+        if (!proc.isFormat(buffer, bytesRead)) {
+            continue;
+        }
+        if (proc.id == "raw") {
+            rawFallback = proc.makeFromStream;
+            continue;
+        }
+
+        // If a later decoder also claims the data (e.g. this one was registered with
+        // RegisterPreferred() ahead of the software decoder for the same format), this one gets
+        // a copy of the stream, so that the later one can be tried if it fails.
+        bool laterMatch = false;
+        for (size_t j = i + 1; j < decoders.size() && !laterMatch; ++j) {
+            laterMatch = decoders[j].isFormat(buffer, bytesRead);
+        }
+        std::unique_ptr<SkStream> copy = laterMatch ? stream->duplicate() : nullptr;
+        if (!copy) {
+            return make(proc, std::move(stream));
+        }
+        if (std::unique_ptr<SkCodec> codec = make(proc, std::move(copy))) {
+            return codec;
         }
     }
     if (rawFallback != nullptr) {
@@ -812,16 +844,19 @@ bool SkCodec::initializeColorXform(const SkImageInfo& dstInfo, SkEncodedInfo::Al
         } else {
             fDstXformAlphaFormat = skcms_AlphaFormat_Unpremul;
         }
+        // It is okay for srcProfile to be null. This will use sRGB.
+        const auto* srcProfile = fEncodedInfo.profile();
+        if (!skcms_PrepareTransform(fSrcXformFormat, skcms_AlphaFormat_Unpremul, srcProfile,
+                                    fDstXformFormat, fDstXformAlphaFormat, &fDstProfile,
+                                    &fXform)) {
+            return false;
+        }
     }
     return true;
 }
 
 void SkCodec::applyColorXform(void* dst, const void* src, int count) const {
-    // It is okay for srcProfile to be null. This will use sRGB.
-    const auto* srcProfile = fEncodedInfo.profile();
-    SkAssertResult(skcms_Transform(src, fSrcXformFormat, skcms_AlphaFormat_Unpremul, srcProfile,
-                                   dst, fDstXformFormat, fDstXformAlphaFormat, &fDstProfile,
-                                   count));
+    SkAssertResult(skcms_RunPreparedTransform(&fXform, src, dst, count));
 }
 
 std::vector<SkCodec::FrameInfo> SkCodec::getFrameInfo() {
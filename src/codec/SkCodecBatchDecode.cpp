@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/codec/SkCodec.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/private/base/SkSemaphore.h"
+#include "include/private/base/SkTo.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Job {
+    std::unique_ptr<SkCodec> codec;
+    SkImageInfo              decodeInfo;  // What the codec decodes to...
+    SkISize                  dimensions;  // ... and what we then resample that to.
+
+    size_t bytes() const { return decodeInfo.computeMinByteSize(); }
+};
+
+void parse_header(const SkCodecs::BatchDecodeRequest& request, Job* job) {
+    job->codec = SkCodec::MakeFromData(request.data);
+    if (!job->codec) {
+        return;
+    }
+
+    const SkISize encoded = job->codec->dimensions();
+    SkISize wanted = request.dimensions.isEmpty() ? encoded : request.dimensions;
+    SkISize decoded = encoded;
+    if (wanted.width() < encoded.width() && wanted.height() < encoded.height()) {
+        const float scale = std::max((float)wanted.width()  / encoded.width(),
+                                     (float)wanted.height() / encoded.height());
+        const SkISize scaled = job->codec->getScaledDimensions(scale);
+        if (scaled.width() >= wanted.width() && scaled.height() >= wanted.height()) {
+            decoded = scaled;
+        }
+    }
+
+    SkAlphaType at = job->codec->getInfo().alphaType();
+    if (at == kUnpremul_SkAlphaType) {
+        at = kPremul_SkAlphaType;
+    }
+    job->decodeInfo = job->codec->getInfo().makeDimensions(decoded)
+                                           .makeColorType(request.colorType)
+                                           .makeAlphaType(at);
+    job->dimensions = wanted;
+}
+
+sk_sp<SkImage> decode(Job* job) {
+    auto [image, result] = job->codec->getImage(job->decodeInfo);
+    job->codec.reset();  // Drop the decoder's state as soon as we're done with it.
+    if (!image || image->dimensions() == job->dimensions) {
+        return image;
+    }
+
+    SkBitmap bm;
+    if (!bm.tryAllocPixels(job->decodeInfo.makeDimensions(job->dimensions)) ||
+        !image->scalePixels(bm.pixmap(),
+                            SkSamplingOptions(SkCubicResampler::Mitchell()),
+                            SkImage::kDisallow_CachingHint)) {
+        return nullptr;
+    }
+    bm.setImmutable();
+    return bm.asImage();
+}
+
+}  // namespace
+
+namespace SkCodecs {
+
+std::vector<sk_sp<SkImage>> DecodeBatch(SkSpan<const BatchDecodeRequest> requests,
+                                        SkExecutor& executor,
+                                        size_t memoryBudget) {
+    const int count = SkToInt(requests.size());
+    std::vector<Job> jobs(count);
+    std::vector<sk_sp<SkImage>> images(count);
+
+    SkTaskGroup tg(executor);
+    tg.batch(count, [&](int i) { parse_header(requests[i], &jobs[i]); });
+    tg.wait();
+
+    // Each decode counts its bytes against the budget from when it's queued until it's done.
+    // The tasks give their bytes back and signal; this thread waits for room before queuing more.
+    size_t queued = 0;
+    std::atomic<size_t> released{0};
+    SkSemaphore finished;
+    for (int i = 0; i < count; ++i) {
+        if (!jobs[i].codec) {
+            continue;
+        }
+        const size_t bytes = jobs[i].bytes();
+        while (queued > released.load() && queued - released.load() + bytes > memoryBudget) {
+            finished.wait();
+        }
+        queued += bytes;
+        tg.add([&, i, bytes] {
+            images[i] = decode(&jobs[i]);
+            released.fetch_add(bytes);
+            finished.signal();
+        });
+    }
+    tg.wait();
+
+    return images;
+}
+
+}  // namespace SkCodecs
@@ -12,6 +12,7 @@
 #include "include/core/SkAlphaType.h"
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkRefCnt.h"
@@ -29,6 +30,7 @@
 #include "src/codec/SkJpegPriv.h"
 #include "src/codec/SkParseEncodedOrigin.h"
 #include "src/codec/SkSwizzler.h"
+#include "src/core/SkTaskGroup.h"
 
 #ifdef SK_CODEC_DECODES_JPEG_GAINMAPS
 #include "include/private/SkGainmapInfo.h"
@@ -38,6 +40,7 @@
 #include "src/codec/SkJpegXmp.h"
 #endif  // SK_CODEC_DECODES_JPEG_GAINMAPS
 
+#include <algorithm>
 #include <array>
 #include <csetjmp>
 #include <cstring>
@@ -1384,7 +1387,245 @@ std::unique_ptr<SkJpegMetadataDecoder> SkJpegMetadataDecoder::Make(std::vector<S
     return std::make_unique<SkJpegMetadataDecoderImpl>(std::move(markerList));
 }
 
+namespace {
+
+// Where a baseline JPEG's restart markers are, and what is needed to split it at them.
+struct RestartLayout {
+    int fWidth = 0;
+    int fHeight = 0;
+    int fMcuWidth = 0;
+    int fMcuHeight = 0;
+    // Whether chroma is subsampled vertically, so upsampling it looks at the neighboring rows.
+    bool fVerticalUpsampling = false;
+    // The number of MCUs between restart markers.
+    int fRestartInterval = 0;
+    // The offsets of the frame's height, of the first entropy-coded byte, of the EndOfImage marker
+    // and of each RSTn marker.
+    size_t fHeightOffset = 0;
+    size_t fScanDataOffset = 0;
+    size_t fScanDataEnd = 0;
+    std::vector<size_t> fRestartOffsets;
+
+    int intervalCount() const { return SkToInt(fRestartOffsets.size()) + 1; }
+    int rowsPerInterval() const {
+        int mcusPerRow = (fWidth + fMcuWidth - 1) / fMcuWidth;
+        return fRestartInterval / mcusPerRow * fMcuHeight;
+    }
+};
+
+uint16_t read_be16(const uint8_t* p) { return (p[0] << 8) | p[1]; }
+
+// Returns true if the JPEG is a single baseline (or extended sequential Huffman) scan with restart
+// markers at the ends of MCU rows, and fills out 'layout'.
+bool find_restart_layout(const uint8_t* data, size_t size, RestartLayout* layout) {
+    if (size < 4 || data[0] != 0xFF || data[1] != kJpegMarkerStartOfImage) {
+        return false;
+    }
+
+    int componentCount = 0;
+    size_t offset = 2;
+    for (;;) {
+        if (offset + 4 > size || data[offset] != 0xFF) {
+            return false;
+        }
+        uint8_t marker = data[offset + 1];
+        if (marker == 0xFF) {
+            // Fill byte.
+            offset += 1;
+            continue;
+        }
+        size_t length = read_be16(data + offset + 2);
+        const uint8_t* params = data + offset + 4;
+        if (length < 2 || offset + 2 + length > size) {
+            return false;
+        }
+
+        if (marker == 0xC0 || marker == 0xC1) {
+            if (length < 8) {
+                return false;
+            }
+            layout->fHeightOffset = offset + 5;
+            layout->fHeight = read_be16(params + 1);
+            layout->fWidth = read_be16(params + 3);
+            componentCount = params[5];
+            if (length < 8 + 3u * componentCount) {
+                return false;
+            }
+            int maxH = 1, maxV = 1, minV = 4;
+            for (int i = 0; i < componentCount; ++i) {
+                uint8_t factors = params[6 + 3 * i + 1];
+                maxH = std::max(maxH, factors >> 4);
+                maxV = std::max(maxV, factors & 0xF);
+                minV = std::min(minV, factors & 0xF);
+            }
+            // A lone component is coded as one block per MCU, whatever its sampling factors.
+            layout->fMcuWidth = componentCount == 1 ? 8 : 8 * maxH;
+            layout->fMcuHeight = componentCount == 1 ? 8 : 8 * maxV;
+            layout->fVerticalUpsampling = componentCount > 1 && minV < maxV;
+        } else if (marker >= 0xC2 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 &&
+                   marker != 0xCC) {
+            // Progressive, lossless, hierarchical or arithmetic coded.
+            return false;
+        } else if (marker == 0xDD) {
+            if (length != 4) {
+                return false;
+            }
+            layout->fRestartInterval = read_be16(params);
+        } else if (marker == kJpegMarkerStartOfScan) {
+            if (!componentCount || params[0] != componentCount) {
+                return false;
+            }
+            layout->fScanDataOffset = offset + 2 + length;
+            break;
+        }
+        offset += 2 + length;
+    }
+
+    if (layout->fHeight == 0 || layout->fWidth == 0 || layout->fRestartInterval == 0) {
+        return false;
+    }
+    int mcusPerRow = (layout->fWidth + layout->fMcuWidth - 1) / layout->fMcuWidth;
+    int mcuRows = (layout->fHeight + layout->fMcuHeight - 1) / layout->fMcuHeight;
+    if (layout->fRestartInterval % mcusPerRow != 0) {
+        return false;
+    }
+
+    // Find the RSTn markers in the entropy-coded data, which must be followed by the EndOfImage.
+    for (size_t i = layout->fScanDataOffset; i + 1 < size; ++i) {
+        if (data[i] != 0xFF) {
+            continue;
+        }
+        uint8_t marker = data[i + 1];
+        if (marker == 0x00 || marker == 0xFF) {
+            // Stuffed or fill byte.
+            continue;
+        }
+        if (marker >= 0xD0 && marker <= 0xD7) {
+            if (marker - 0xD0u != layout->fRestartOffsets.size() % 8) {
+                return false;
+            }
+            layout->fRestartOffsets.push_back(i);
+            ++i;
+            continue;
+        }
+        if (marker != kJpegMarkerEndOfImage) {
+            // Another scan, or a marker like DNL that changes how the rest is decoded.
+            return false;
+        }
+        layout->fScanDataEnd = i;
+        int mcusPerInterval = layout->fRestartInterval;
+        int64_t mcuCount = (int64_t)mcusPerRow * mcuRows;
+        return layout->intervalCount() == (mcuCount + mcusPerInterval - 1) / mcusPerInterval;
+    }
+    return false;
+}
+
+// Makes a JPEG of the restart intervals [first, end), as a frame of 'height' rows.
+sk_sp<SkData> make_band(const uint8_t* data, const RestartLayout& layout, int first, int end,
+                        int height) {
+    size_t headerSize = layout.fScanDataOffset;
+    size_t start = first == 0 ? layout.fScanDataOffset : layout.fRestartOffsets[first - 1] + 2;
+    size_t stop = end == layout.intervalCount() ? layout.fScanDataEnd
+                                                : layout.fRestartOffsets[end - 1];
+    sk_sp<SkData> band = SkData::MakeUninitialized(headerSize + (stop - start) + 2);
+    uint8_t* out = static_cast<uint8_t*>(band->writable_data());
+
+    memcpy(out, data, headerSize);
+    out[layout.fHeightOffset] = height >> 8;
+    out[layout.fHeightOffset + 1] = height & 0xFF;
+    memcpy(out + headerSize, data + start, stop - start);
+    // The decoder expects the restart markers to count up from RST0.
+    for (int i = first; i < end - 1; ++i) {
+        out[headerSize + (layout.fRestartOffsets[i] - start) + 1] = 0xD0 + (i - first) % 8;
+    }
+    out[band->size() - 2] = 0xFF;
+    out[band->size() - 1] = kJpegMarkerEndOfImage;
+    return band;
+}
+
+// Decodes 'rows.height()' rows of 'jpeg', after skipping 'skipRows' rows, into 'rows'.
+SkCodec::Result decode_band(sk_sp<SkData> jpeg, int skipRows, const SkPixmap& rows) {
+    SkCodec::Result result;
+    std::unique_ptr<SkCodec> codec =
+            SkJpegCodec::MakeFromStream(SkMemoryStream::Make(std::move(jpeg)), &result);
+    if (!codec) {
+        return result;
+    }
+    result = codec->startScanlineDecode(rows.info().makeDimensions(codec->dimensions()));
+    if (result != SkCodec::kSuccess) {
+        return result;
+    }
+    if (!codec->skipScanlines(skipRows)) {
+        return SkCodec::kIncompleteInput;
+    }
+    int rowsDecoded = codec->getScanlines(rows.writable_addr(), rows.height(), rows.rowBytes());
+    return rowsDecoded == rows.height() ? SkCodec::kSuccess : SkCodec::kIncompleteInput;
+}
+
+}  // namespace
+
 namespace SkJpegDecoder {
+SkCodec::Result DecodeInParallel(sk_sp<SkData> data, const SkPixmap& dst, SkExecutor* executor) {
+    // Bands are at most this many per image, and at least this many restart intervals each.
+    static constexpr int kMaxBands = 16;
+    static constexpr int kMinIntervalsPerBand = 4;
+
+    if (!data) {
+        return SkCodec::kInvalidInput;
+    }
+
+    RestartLayout layout;
+    int bandCount = 0;
+    if (executor && find_restart_layout(data->bytes(), data->size(), &layout)) {
+        bandCount = std::min(kMaxBands, layout.intervalCount() / kMinIntervalsPerBand);
+    }
+    if (bandCount < 2 || dst.dimensions() != SkISize::Make(layout.fWidth, layout.fHeight)) {
+        SkCodec::Result result;
+        std::unique_ptr<SkCodec> codec = Decode(std::move(data), &result);
+        if (!codec) {
+            return result;
+        }
+        return codec->getPixels(dst);
+    }
+
+    const int intervalsPerBand = (layout.intervalCount() + bandCount - 1) / bandCount;
+    const int rowsPerInterval = layout.rowsPerInterval();
+    // Upsampled chroma depends on the rows around it, so bands with vertically subsampled chroma
+    // are decoded with an extra interval on each side, which is then thrown away.
+    const int overlap = layout.fVerticalUpsampling ? 1 : 0;
+
+    std::vector<SkCodec::Result> results(bandCount, SkCodec::kSuccess);
+    SkTaskGroup taskGroup(*executor);
+    taskGroup.batch(bandCount, [&](int band) {
+        int first = band * intervalsPerBand;
+        int end = std::min(first + intervalsPerBand, layout.intervalCount());
+        int decodeFirst = std::max(first - overlap, 0);
+        int decodeEnd = std::min(end + overlap, layout.intervalCount());
+
+        int top = first * rowsPerInterval;
+        int bottom = std::min(end * rowsPerInterval, layout.fHeight);
+        int decodeTop = decodeFirst * rowsPerInterval;
+        int decodeBottom = std::min(decodeEnd * rowsPerInterval, layout.fHeight);
+        if (top >= bottom) {
+            return;
+        }
+
+        SkPixmap rows;
+        SkAssertResult(dst.extractSubset(&rows, SkIRect::MakeLTRB(0, top, dst.width(), bottom)));
+        sk_sp<SkData> jpeg = make_band(data->bytes(), layout, decodeFirst, decodeEnd,
+                                       decodeBottom - decodeTop);
+        results[band] = decode_band(std::move(jpeg), top - decodeTop, rows);
+    });
+    taskGroup.wait();
+
+    for (SkCodec::Result result : results) {
+        if (result != SkCodec::kSuccess) {
+            return result;
+        }
+    }
+    return SkCodec::kSuccess;
+}
+
 bool IsJpeg(const void* data, size_t len) {
     return SkJpegCodec::IsJpeg(data, len);
 }
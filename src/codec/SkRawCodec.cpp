@@ -759,6 +759,12 @@ SkCodec::Result SkRawCodec::onGetPixels(const SkImageInfo& dstInfo, void* dst,
         cs->toProfile(&dstProfileStorage);
         dstProfile = &dstProfileStorage;
     }
+    skcms_PreparedTransform xform;
+    if (!skcms_PrepareTransform(srcFormat, skcms_AlphaFormat_Unpremul, srcProfile,
+                                dstFormat, skcms_AlphaFormat_Unpremul, dstProfile, &xform)) {
+        SkDebugf("failed to transform\n");
+        return kInternalError;
+    }
 
     for (int i = 0; i < height; ++i) {
         buffer.fArea = dng_rect(i, 0, i + 1, width);
@@ -770,9 +776,7 @@ SkCodec::Result SkRawCodec::onGetPixels(const SkImageInfo& dstInfo, void* dst,
             return kIncompleteInput;
         }
 
-        if (!skcms_Transform(&srcRow[0], srcFormat, skcms_AlphaFormat_Unpremul, srcProfile,
-                             dstRow,     dstFormat, skcms_AlphaFormat_Unpremul, dstProfile,
-                             dstInfo.width())) {
+        if (!skcms_RunPreparedTransform(&xform, &srcRow[0], dstRow, dstInfo.width())) {
             SkDebugf("failed to transform\n");
             *rowsDecoded = i;
             return kInternalError;
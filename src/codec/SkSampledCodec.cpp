@@ -10,12 +10,17 @@
 #include "include/codec/SkCodec.h"
 #include "include/codec/SkEncodedImageFormat.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkSamplingOptions.h"
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkTemplates.h"
 #include "src/base/SkMathPriv.h"
 #include "src/codec/SkCodecPriv.h"
 #include "src/codec/SkSampler.h"
+#include "src/core/SkAutoPixmapStorage.h"
+
+#include <cmath>
 
 SkSampledCodec::SkSampledCodec(SkCodec* codec)
     : INHERITED(codec)
@@ -164,11 +169,87 @@ SkCodec::Result SkSampledCodec::onGetAndroidPixels(const SkImageInfo& info, void
 }
 
 
+SkCodec::Result SkSampledCodec::resampledJpegDecode(const SkImageInfo& info, void* pixels,
+        size_t rowBytes, const AndroidOptions& options) {
+    const int sampleSize = options.fSampleSize;
+    // Linear filtering is only good for resizing by up to 2x, which covers sample sizes up to
+    // twice the largest that libjpeg-turbo can scale by.
+    if (sampleSize > 16) {
+        return SkCodec::kUnimplemented;
+    }
+
+    const SkIRect subset = options.fSubset ? *options.fSubset
+                                           : SkIRect::MakeSize(this->codec()->dimensions());
+    if (info.width() != get_scaled_dimension(subset.width(), sampleSize) ||
+        info.height() != get_scaled_dimension(subset.height(), sampleSize)) {
+        return SkCodec::kUnimplemented;
+    }
+
+    // The finest IDCT scale whose output is at least as big as the sampled image.
+    const int scaleNum = std::min(8, (8 + sampleSize - 1) / sampleSize);
+    const float scale = scaleNum / 8.0f;
+    const SkISize scaledSize = this->codec()->getScaledDimensions(scale);
+    if (!this->codec()->dimensionsSupported(scaledSize)) {
+        return SkCodec::kUnimplemented;
+    }
+
+    SkIRect scaledSubset = SkIRect::MakeLTRB(std::lround(subset.fLeft * scale),
+                                             std::lround(subset.fTop * scale),
+                                             std::lround(subset.fRight * scale),
+                                             std::lround(subset.fBottom * scale));
+    if (!scaledSubset.intersect(SkIRect::MakeSize(scaledSize))) {
+        return SkCodec::kUnimplemented;
+    }
+
+    const SkImageInfo scaledInfo = info.makeDimensions(scaledSize);
+    SkAutoPixmapStorage scaled;
+    if (!scaled.tryAlloc(info.makeDimensions(scaledSubset.size()))) {
+        return SkCodec::kInternalError;
+    }
+
+    // Only the subsetting in the x-dimension is done by the scanline decoder.
+    AndroidOptions scaledOptions = options;
+    SkIRect scanlineSubset = SkIRect::MakeXYWH(scaledSubset.x(), 0, scaledSubset.width(),
+                                               scaledSize.height());
+    scaledOptions.fSubset = &scanlineSubset;
+    SkCodec::Result result = this->codec()->startScanlineDecode(scaledInfo, &scaledOptions);
+    if (SkCodec::kIncompleteInput == result || SkCodec::kErrorInInput == result) {
+        return SkCodec::kInvalidInput;
+    } else if (SkCodec::kSuccess != result) {
+        return result;
+    }
+
+    SkASSERT(this->codec()->getScanlineOrder() == SkCodec::kTopDown_SkScanlineOrder);
+    int rowsDecoded = 0;
+    if (this->codec()->skipScanlines(scaledSubset.y())) {
+        rowsDecoded = this->codec()->getScanlines(scaled.writable_addr(), scaled.height(),
+                                                  scaled.rowBytes());
+    }
+    if (rowsDecoded != scaled.height()) {
+        this->codec()->fillIncompleteImage(scaled.info(), scaled.writable_addr(),
+                scaled.rowBytes(), options.fZeroInitialized, scaled.height(), rowsDecoded);
+        result = SkCodec::kIncompleteInput;
+    }
+
+    if (!scaled.scalePixels(SkPixmap(info, pixels, rowBytes),
+                            SkSamplingOptions(SkFilterMode::kLinear))) {
+        return SkCodec::kInternalError;
+    }
+    return result;
+}
+
 SkCodec::Result SkSampledCodec::sampledDecode(const SkImageInfo& info, void* pixels,
         size_t rowBytes, const AndroidOptions& options) {
     // We should only call this function when sampling.
     SkASSERT(options.fSampleSize > 1);
 
+    if (this->codec()->getEncodedFormat() == SkEncodedImageFormat::kJPEG) {
+        SkCodec::Result result = this->resampledJpegDecode(info, pixels, rowBytes, options);
+        if (SkCodec::kUnimplemented != result) {
+            return result;
+        }
+    }
+
     // FIXME: This was already called by onGetAndroidPixels. Can we reduce that?
     int sampleSize = options.fSampleSize;
     int nativeSampleSize;
@@ -60,6 +60,16 @@ private:
     SkCodec::Result sampledDecode(const SkImageInfo& info, void* pixels, size_t rowBytes,
             const AndroidOptions& options);
 
+    /**
+     *  Called by sampledDecode() for JPEGs. Crops and scales with libjpeg-turbo's IDCT by the
+     *  smallest factor of n/8 that is at least 1/sampleSize, and then resizes the result with a
+     *  linear filter to the requested size.
+     *
+     *  Returns kUnimplemented if sampleSize is too big for one resize to finish the scale.
+     */
+    SkCodec::Result resampledJpegDecode(const SkImageInfo& info, void* pixels, size_t rowBytes,
+            const AndroidOptions& options);
+
     using INHERITED = SkAndroidCodec;
 };
 #endif // SkSampledCodec_DEFINED
@@ -354,9 +354,14 @@ void SkBitmapDevice::drawRect(const SkRect& r, const SkPaint& paint) {
 }
 
 void SkBitmapDevice::drawOval(const SkRect& oval, const SkPaint& paint) {
+#ifdef SK_IGNORE_BLURRED_RRECT_OPT
     // call the VIRTUAL version, so any subclasses who do handle drawPath aren't
     // required to override drawOval.
     this->drawPath(SkPath::Oval(oval), paint, true);
+#else
+    // SkDrawBase::drawRRect() falls back to the same oval path when it can't fill it directly.
+    this->drawRRect(SkRRect::MakeOval(oval), paint);
+#endif
 }
 
 void SkBitmapDevice::drawRRect(const SkRRect& rrect, const SkPaint& paint) {
@@ -416,6 +421,10 @@ void SkBitmapDevice::drawImageRect(const SkImage* image, const SkRect* src, cons
     SkASSERT(dst.isFinite());
     SkASSERT(dst.isSorted());
 
+    if (as_IB(image)->skipRasterDraws()) {
+        return;
+    }
+
     SkBitmap bitmap;
     // TODO: Elevate direct context requirement to public API and remove cheat.
     auto dContext = as_IB(image)->directContext();
@@ -660,7 +669,7 @@ void SkBitmapDevice::replaceClip(const SkIRect& rect) {
 bool SkBitmapDevice::isClipWideOpen() const {
     const SkRasterClip& rc = fRCStack.rc();
     // If we're AA, we can't be wide-open (we would represent that as BW)
-    return rc.isBW() && rc.bwRgn().isRect() &&
+    return rc.isBW() && rc.bwRgn().isRect() && !rc.clipShader() &&
            rc.bwRgn().getBounds() == SkIRect{0, 0, this->width(), this->height()};
 }
 
@@ -675,7 +684,8 @@ bool SkBitmapDevice::isClipRect() const {
 
 bool SkBitmapDevice::isClipAntiAliased() const {
     const SkRasterClip& rc = fRCStack.rc();
-    return !rc.isEmpty() && rc.isAA();
+    // Antialiased rect and rrect clips are kept as a BW region plus a coverage shader.
+    return !rc.isEmpty() && (rc.isAA() || SkToBool(rc.clipShader()));
 }
 
 void SkBitmapDevice::android_utils_clipAsRgn(SkRegion* rgn) const {
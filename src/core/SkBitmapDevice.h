@@ -121,6 +121,7 @@ private:
     friend class SkDrawBase;
     friend class SkDrawTiler;
     friend class SkSurface_Raster;
+    friend class SkThreadedBitmapDevice;
 
     class BDDraw;
 
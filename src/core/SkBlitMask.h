@@ -10,12 +10,20 @@
 
 #include "include/core/SkColor.h"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace SkOpts {
     // Optimized mask-blit routine
     extern void (*blit_mask_d32_a8)(SkPMColor* dst, size_t dstRB,
                                     const SkAlpha* mask, size_t maskRB,
                                     SkColor color, int w, int h);
 
+    // Same, for LCD16 masks drawn over an opaque destination.
+    extern void (*blit_mask_d32_lcd16)(SkPMColor* dst, size_t dstRB,
+                                       const uint16_t* mask, size_t maskRB,
+                                       SkColor color, int w, int h);
+
     void Init_BlitMask();
 }  // namespace SkOpts
 
@@ -25,7 +25,8 @@
 
 namespace SkOpts {
     void Init_BlitMask_ssse3() {
-        blit_mask_d32_a8 = ssse3::blit_mask_d32_a8;
+        blit_mask_d32_a8    = ssse3::blit_mask_d32_a8;
+        blit_mask_d32_lcd16 = ssse3::blit_mask_d32_lcd16;
     }
 }  // namespace SkOpts
 
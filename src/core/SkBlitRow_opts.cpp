@@ -22,6 +22,7 @@ namespace SkOpts {
     DEFINE_DEFAULT(blit_row_s32a_opaque);
 
     void Init_BlitRow_hsw();
+    void Init_BlitRow_skx();
 
     static bool init() {
     #if defined(SK_ENABLE_OPTIMIZE_SIZE)
@@ -30,6 +31,10 @@ namespace SkOpts {
         #if SK_CPU_SSE_LEVEL < SK_CPU_SSE_LEVEL_AVX2
             if (SkCpu::Supports(SkCpu::HSW)) { Init_BlitRow_hsw(); }
         #endif
+
+        #if SK_CPU_SSE_LEVEL < SK_CPU_SSE_LEVEL_SKX
+            if (SkCpu::Supports(SkCpu::HSW | SkCpu::SKX)) { Init_BlitRow_skx(); }
+        #endif
     #endif
       return true;
     }
@@ -23,12 +23,16 @@
 #include "include/core/SkRRect.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkRegion.h"
 #include "include/core/SkScalar.h"
 #include "include/effects/SkImageFilters.h"
 #include "include/private/base/SkAlign.h"
 #include "include/private/base/SkAssert.h"
+#include "include/private/base/SkMath.h"
 #include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
 #include "src/base/SkTLazy.h"
+#include "src/core/SkBlitter.h"
 #include "src/core/SkBlitter_A8.h"
 #include "src/core/SkBlurMask.h"
 #include "src/core/SkCachedData.h"
@@ -373,6 +377,138 @@ SkBlurMaskFilterImpl::filterRRectToNine(const SkRRect& rrect, const SkMatrix& ma
     return kTrue_FilterReturn;
 }
 
+// Returns where the run of 255s in 'scanline' starts, and how long it is. A blurred scanline's
+// values rise to its middle and fall away again, so there is at most one.
+static int opaque_run(const uint8_t scanline[], int count, int* length) {
+    int start = 0;
+    while (start < count && scanline[start] != 255) {
+        ++start;
+    }
+    int end = start;
+    while (end < count && scanline[end] == 255) {
+        ++end;
+    }
+    *length = end - start;
+    return start;
+}
+
+// Blits the part of a blurred rect inside clipR. Its coverage at (x, y) is h[x] * v[y], relative
+// to outerR, and both are 255 inside opaqueR. So opaqueR is a solid rect, the rows beside it all
+// repeat h, and the columns above and below it are v[y] across each row. Only the corners need
+// their coverage worked out, a row at a time. 'row' and 'runs' must have room for outerR's width.
+static void blit_blurred_rect(const uint8_t h[], const uint8_t v[], const SkIRect& outerR,
+                              const SkIRect& opaqueR, const SkIRect& clipR,
+                              uint8_t row[], int16_t runs[], SkBlitter* blitter) {
+    SkIRect r;
+    if (!r.intersect(outerR, clipR)) {
+        return;
+    }
+    // The columns left of, across, and right of opaqueR.
+    const int midL = std::clamp(opaqueR.left(), r.left(), r.right()),
+              midR = std::clamp(opaqueR.right(), midL, r.right());
+
+    // Blits 'scanline', which starts at outerR.left(), over [left, right) of rows [top, bottom).
+    auto blitScanline = [&](const uint8_t* scanline, int left, int top, int right, int bottom) {
+        if (left < right) {
+            SkIRect bounds = SkIRect::MakeLTRB(left, top, right, bottom);
+            blitter->blitMask(SkMask(scanline + (left - outerR.left()),
+                                     bounds,
+                                     0,    // so we repeat the scanline for our height
+                                     SkMask::kA8_Format),
+                              bounds);
+        }
+    };
+
+    for (int y = r.top(); y < r.bottom();) {
+        if (y >= opaqueR.top() && y < opaqueR.bottom()) {
+            const int bottom = std::min(r.bottom(), opaqueR.bottom());
+            blitScanline(h, r.left(), y, midL, bottom);
+            if (midL < midR) {
+                blitter->blitRect(midL, y, midR - midL, bottom - y);
+            }
+            blitScanline(h, midR, y, r.right(), bottom);
+            y = bottom;
+            continue;
+        }
+
+        const U8CPU vy = v[y - outerR.top()];
+        if (vy) {
+            for (int x = r.left(); x < midL; ++x) {
+                row[x - outerR.left()] = SkMulDiv255Round(h[x - outerR.left()], vy);
+            }
+            for (int x = midR; x < r.right(); ++x) {
+                row[x - outerR.left()] = SkMulDiv255Round(h[x - outerR.left()], vy);
+            }
+            blitScanline(row, r.left(), y, midL, y + 1);
+            if (midL < midR) {
+                SkAlpha alpha[] = {SkToU8(vy)};
+                runs[0] = SkToS16(midR - midL);
+                runs[midR - midL] = 0;
+                blitter->blitAntiH(midL, y, alpha, runs);
+            }
+            blitScanline(row, midR, y, r.right(), y + 1);
+        }
+        ++y;
+    }
+}
+
+bool SkBlurMaskFilterImpl::filterRectDirect(const SkRect& rect, const SkMatrix& matrix,
+                                            const SkRasterClip& clip, SkBlitter* blitter) const {
+    // A normal blur of a rect is separable, so its coverage is the product of a blurred scanline
+    // across it and one down it, as in SkBlurMask::BlurRect(). Blitting rows straight from those
+    // skips building a mask or a ninepatch, and caching it. The other styles need the rect too.
+    if (kNormal_SkBlurStyle != fBlurStyle || rect_exceeds(rect, SkIntToScalar(32767))) {
+        return false;
+    }
+
+    const SkScalar sigma = this->computeXformedSigma(matrix);
+    const int profileSize = SkScalarCeilToInt(6*sigma);
+    if (profileSize <= 0) {
+        return false;
+    }
+    const int pad = profileSize/2;
+    const SkIRect outerR = SkIRect::MakeLTRB(SkScalarRoundToInt(rect.fLeft - pad),
+                                             SkScalarRoundToInt(rect.fTop - pad),
+                                             SkScalarRoundToInt(rect.fRight + pad),
+                                             SkScalarRoundToInt(rect.fBottom + pad));
+    // The scanlines assume they're at least as long as the profile.
+    if (outerR.width() < profileSize || outerR.height() < profileSize) {
+        return false;
+    }
+    if (!SkIRect::Intersects(outerR, clip.getBounds())) {
+        return true;
+    }
+
+    const int width = outerR.width(),
+              height = outerR.height();
+    skia_private::AutoSTMalloc<512, int16_t> runs(width + 1);
+    skia_private::AutoSTMalloc<1024, uint8_t> storage(profileSize + width + height + width);
+    uint8_t* profile = storage.get();
+    uint8_t* h = profile + profileSize;
+    uint8_t* v = h + width;
+    uint8_t* row = v + height;
+
+    SkBlurMask::ComputeBlurProfile(profile, profileSize, sigma);
+    SkBlurMask::ComputeBlurredScanline(h, profile, width, sigma);
+    SkBlurMask::ComputeBlurredScanline(v, profile, height, sigma);
+
+    int opaqueW, opaqueH;
+    const int opaqueX = opaque_run(h, width, &opaqueW),
+              opaqueY = opaque_run(v, height, &opaqueH);
+    const SkIRect opaqueR = SkIRect::MakeXYWH(outerR.left() + opaqueX, outerR.top() + opaqueY,
+                                              opaqueW, opaqueH);
+
+    SkAAClipBlitterWrapper wrapper(clip, blitter);
+    blitter = wrapper.getBlitter();
+
+    SkRegion::Cliperator clipper(wrapper.getRgn(), outerR);
+    while (!clipper.done()) {
+        blit_blurred_rect(h, v, outerR, opaqueR, clipper.rect(), row, runs, blitter);
+        clipper.next();
+    }
+    return true;
+}
+
 // Use the faster analytic blur approach for ninepatch rects
 static const bool c_analyticBlurNinepatch{true};
 
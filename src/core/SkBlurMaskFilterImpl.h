@@ -14,9 +14,11 @@
 #include "src/core/SkMask.h"
 #include "src/core/SkMaskFilterBase.h"
 
+class SkBlitter;
 class SkImageFilter;
 class SkMatrix;
 class SkRRect;
+class SkRasterClip;
 class SkReadBuffer;
 class SkWriteBuffer;
 enum SkBlurStyle : int;
@@ -54,6 +56,9 @@ private:
                                    const SkIRect& clipBounds,
                                    SkTLazy<NinePatch>*) const override;
 
+    bool filterRectDirect(const SkRect&, const SkMatrix&, const SkRasterClip&,
+                          SkBlitter*) const override;
+
     bool filterRectMask(SkMaskBuilder* dstM, const SkRect& r, const SkMatrix& matrix,
                         SkIPoint* margin, SkMaskBuilder::CreateMode createMode) const;
     bool filterRRectMask(SkMaskBuilder* dstM, const SkRRect& r, const SkMatrix& matrix,
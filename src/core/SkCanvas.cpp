@@ -43,6 +43,7 @@
 #include "src/base/SkMSAN.h"
 #include "src/core/SkBlenderBase.h"
 #include "src/core/SkCanvasPriv.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkDevice.h"
 #include "src/core/SkImageFilterTypes.h"
 #include "src/core/SkImageFilter_Base.h"
@@ -262,6 +263,7 @@ std::optional<AutoLayerForImageFilter> SkCanvas::aboutToDraw(
             return std::nullopt;
         }
     }
+    SkCounters::Add(SkCounters::Counter::kDraws);
 
     // TODO: Eventually all devices will use this code path and this will just test 'flags'.
     const bool skipMaskFilterLayer = (flags & PredrawFlags::kSkipMaskFilterAutoLayer) ||
@@ -296,11 +298,6 @@ void SkCanvas::resetForNextPicture(const SkIRect& bounds) {
 }
 
 void SkCanvas::init(sk_sp<SkDevice> device) {
-    // SkCanvas.h declares internal storage for the hidden struct MCRec, and this
-    // assert ensure it's sufficient. <= is used because the struct has pointer fields, so the
-    // declared size is an upper bound across architectures. When the size is smaller, more stack
-    static_assert(sizeof(MCRec) <= kMCRecSize);
-
     if (!device) {
         device = sk_make_sp<SkNoPixelsDevice>(SkIRect::MakeEmpty(), fProps);
     }
@@ -309,7 +306,7 @@ void SkCanvas::init(sk_sp<SkDevice> device) {
     SkASSERT(device);
 
     fSaveCount = 1;
-    fMCRec = new (fMCStack.push_back()) MCRec(device.get());
+    fMCRec = &fMCStack.emplace_back(device.get());
 
     // The root device and the canvas should always have the same pixel geometry
     SkASSERT(fProps.pixelGeometry() == device->surfaceProps().pixelGeometry());
@@ -320,39 +317,31 @@ void SkCanvas::init(sk_sp<SkDevice> device) {
     fQuickRejectBounds = this->computeDeviceClipBounds();
 }
 
-SkCanvas::SkCanvas() : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage)) {
+SkCanvas::SkCanvas() {
     this->init(nullptr);
 }
 
 SkCanvas::SkCanvas(int width, int height, const SkSurfaceProps* props)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage))
-        , fProps(SkSurfacePropsCopyOrDefault(props)) {
+        : fProps(SkSurfacePropsCopyOrDefault(props)) {
     this->init(sk_make_sp<SkNoPixelsDevice>(
             SkIRect::MakeWH(std::max(width, 0), std::max(height, 0)), fProps));
 }
 
-SkCanvas::SkCanvas(const SkIRect& bounds)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage)) {
+SkCanvas::SkCanvas(const SkIRect& bounds) {
     SkIRect r = bounds.isEmpty() ? SkIRect::MakeEmpty() : bounds;
     this->init(sk_make_sp<SkNoPixelsDevice>(r, fProps));
 }
 
 SkCanvas::SkCanvas(sk_sp<SkDevice> device)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage))
-        , fProps(device->surfaceProps()) {
+        : fProps(device->surfaceProps()) {
     this->init(std::move(device));
 }
 
 SkCanvas::~SkCanvas() {
     // Mark all pending layers to be discarded during restore (rather than drawn)
-    SkDeque::Iter iter(fMCStack, SkDeque::Iter::kFront_IterStart);
-    for (;;) {
-        MCRec* rec = (MCRec*)iter.next();
-        if (!rec) {
-            break;
-        }
-        if (rec->fLayer) {
-            rec->fLayer->fDiscard = true;
+    for (MCRec& rec : fMCStack) {
+        if (rec.fLayer) {
+            rec.fLayer->fDiscard = true;
         }
     }
 
@@ -430,13 +419,8 @@ void SkCanvas::checkForDeferredSave() {
 int SkCanvas::getSaveCount() const {
 #ifdef SK_DEBUG
     int count = 0;
-    SkDeque::Iter iter(fMCStack, SkDeque::Iter::kFront_IterStart);
-    for (;;) {
-        const MCRec* rec = (const MCRec*)iter.next();
-        if (!rec) {
-            break;
-        }
-        count += 1 + rec->fDeferredSaveCount;
+    for (const MCRec& rec : fMCStack) {
+        count += 1 + rec.fDeferredSaveCount;
     }
     SkASSERT(count == fSaveCount);
 #endif
@@ -464,7 +448,7 @@ void SkCanvas::restore() {
         fMCRec->fDeferredSaveCount -= 1;
     } else {
         // check for underflow
-        if (fMCStack.count() > 1) {
+        if (fMCStack.size() > 1) {
             this->willRestore();
             SkASSERT(fSaveCount > 1);
             fSaveCount -= 1;
@@ -487,7 +471,8 @@ void SkCanvas::restoreToCount(int count) {
 }
 
 void SkCanvas::internalSave() {
-    fMCRec = new (fMCStack.push_back()) MCRec(fMCRec);
+    // Once the stack has grown to this depth, the rec's storage is reused rather than allocated.
+    fMCRec = &fMCStack.emplace_back(fMCRec);
 
     this->topDevice()->pushClipStack();
 }
@@ -714,6 +699,79 @@ static skif::FilterResult apply_alpha_and_colorfilter(const skif::Context& ctx,
     return result;
 }
 
+// Returns the size of the square tiles 'filter' should be evaluated in to produce 'ctx's desired
+// output, or 0 if it should be evaluated all at once. Tiles start at the backend's tile size and
+// grow until the DAG's halo (e.g. a blur's or morphology's outset of its input) is small
+// relative to the tile, since every tile re-evaluates the halo it shares with its neighbors.
+static int filter_tile_size(const skif::Context& ctx, const SkImageFilter* filter) {
+    const SkMatrix& layerToDevice = ctx.mapping().layerToDevice();
+    int tileSize = ctx.backend()->tileSize();
+    if (!filter || tileSize <= 0 ||
+        !layerToDevice.isTranslate() ||
+        !SkScalarIsInt(layerToDevice.getTranslateX()) ||
+        !SkScalarIsInt(layerToDevice.getTranslateY())) {
+        // Tiles are clipped to their layer-space bounds when drawn, which only meet without
+        // seams or overlap when layer space is an integer translation of device space.
+        return 0;
+    }
+
+    const SkIRect output = SkIRect(ctx.desiredOutput());
+    while (tileSize < output.width() || tileSize < output.height()) {
+        const auto tile = skif::LayerSpace<SkIRect>(
+                SkIRect::MakeXYWH(output.fLeft, output.fTop, tileSize, tileSize));
+        const SkIRect input = SkIRect(as_IFB(filter)->getInputBounds(
+                ctx.mapping(), ctx.mapping().layerToDevice(tile), /*knownContentBounds=*/{}));
+        // Tiling pays off as long as a tile's input is at most a quarter larger than the tile.
+        if (4 * sk_64_mul(input.width(), input.height()) <= 5 * sk_64_mul(tileSize, tileSize)) {
+            return tileSize;
+        }
+        tileSize *= 2;
+    }
+    return 0;
+}
+
+// Evaluates 'filter' (or passes through 'source' when it's null) and draws its output into 'dst'
+// with the layer paint's alpha, color filter, and blender. When the backend prefers it, the
+// desired output is evaluated and drawn one tile at a time, so the DAG's intermediate images are
+// sized by a tile and its halo instead of the whole output, and are released before the next tile
+// allocates its own. Every filter computes its required input from the desired output, so each
+// tile reads past its edges as far as its blurs and morphology need, and the tiles produce the
+// same pixels as a single evaluation.
+static void filter_and_draw(const skif::Context& ctx,
+                            const SkImageFilter* filter,
+                            const skif::FilterResult& source,
+                            SkDevice* dst,
+                            const SkPaint& paint) {
+    const int tileSize = filter_tile_size(ctx, filter);
+    if (!tileSize) {
+        auto result = filter ? as_IFB(filter)->filterImage(ctx) : source;
+        result = apply_alpha_and_colorfilter(ctx, result, paint);
+        result.draw(ctx, dst, paint.getBlender());
+        return;
+    }
+
+    const SkIRect output = SkIRect(ctx.desiredOutput());
+    for (int y = output.fTop; y < output.fBottom; y += tileSize) {
+        for (int x = output.fLeft; x < output.fRight; x += tileSize) {
+            SkIRect tile = SkIRect::MakeXYWH(x, y, tileSize, tileSize);
+            SkAssertResult(tile.intersect(output));
+
+            const skif::Context tileCtx =
+                    ctx.withNewDesiredOutput(skif::LayerSpace<SkIRect>(tile));
+            auto result = as_IFB(filter)->filterImage(tileCtx);
+            result = apply_alpha_and_colorfilter(tileCtx, result, paint);
+
+            // The result can extend past its tile (e.g. when it's a deferred tiling of its
+            // input), so restrict it to the tile so neighboring tiles don't draw twice.
+            SkAutoDeviceTransformRestore adtr{dst, ctx.mapping().layerToDevice()};
+            dst->pushClipStack();
+            dst->clipRect(SkRect::Make(tile), SkClipOp::kIntersect, /*aa=*/false);
+            result.draw(tileCtx, dst, paint.getBlender());
+            dst->popClipStack();
+        }
+    }
+}
+
 void SkCanvas::internalDrawDeviceWithFilter(SkDevice* src,
                                             SkDevice* dst,
                                             FilterSpan filters,
@@ -863,10 +921,9 @@ void SkCanvas::internalDrawDeviceWithFilter(SkDevice* src,
     FilterSpan filtersOrNull = filters.empty() ? FilterSpan{&nullFilter, 1} : filters;
 
     for (const sk_sp<SkImageFilter>& filter : filtersOrNull) {
-        auto result = filter ? as_IFB(filter)->filterImage(ctx) : source;
-
         if (srcIsCoverageLayer) {
             SkASSERT(dst->useDrawCoverageMaskForMaskFilters());
+            auto result = filter ? as_IFB(filter)->filterImage(ctx) : source;
             // TODO: Can FilterResult optimize this in any meaningful way if it still has to go
             // through drawCoverageMask that requires an image (vs a coverage shader)?
             auto [coverageMask, origin] = result.imageAndOffset(ctx);
@@ -877,8 +934,7 @@ void SkCanvas::internalDrawDeviceWithFilter(SkDevice* src,
                         coverageMask.get(), deviceMatrixWithOffset, result.sampling(), paint);
             }
         } else {
-            result = apply_alpha_and_colorfilter(ctx, result, paint);
-            result.draw(ctx, dst, paint.getBlender());
+            filter_and_draw(ctx, filter.get(), source, dst, paint);
         }
     }
 }
@@ -1423,14 +1479,13 @@ void SkCanvas::internalRestore() {
     std::unique_ptr<BackImage> backImage = std::move(fMCRec->fBackImage);
 
     // now do the normal restore()
-    fMCRec->~MCRec();       // balanced in save()
-    fMCStack.pop_back();
-    fMCRec = (MCRec*) fMCStack.back();
-
-    if (!fMCRec) {
+    fMCStack.pop_back();    // keeps the capacity for the next save()
+    if (fMCStack.empty()) {
         // This was the last record, restored during the destruction of the SkCanvas
+        fMCRec = nullptr;
         return;
     }
+    fMCRec = &fMCStack.back();
 
     this->topDevice()->popClipStack();
     this->topDevice()->setGlobalCTM(fMCRec->fMatrix);
@@ -2174,6 +2229,34 @@ void SkCanvas::experimental_DrawEdgeAAImageSet(const ImageSetEntry imageSet[], i
                                 constraint);
 }
 
+void SkCanvas::experimental_DrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[],
+                                              int cnt, const int matrixIndices[],
+                                              const SkMatrix preViewMatrices[],
+                                              QuadAAFlags aaFlags, SkBlendMode mode) {
+    TRACE_EVENT0("skia", TRACE_FUNC);
+    if (cnt <= 0) {
+        return;
+    }
+    this->onDrawEdgeAARectSet(rects, colors, cnt, matrixIndices, preViewMatrices, aaFlags, mode);
+}
+
+void SkCanvas::drawEdgeAARectSetAsQuads(const SkRect rects[], const SkColor4f colors[], int count,
+                                        const int matrixIndices[],
+                                        const SkMatrix preViewMatrices[], QuadAAFlags aaFlags,
+                                        SkBlendMode mode) {
+    for (int i = 0; i < count; ++i) {
+        const int matrixIndex = matrixIndices ? matrixIndices[i] : -1;
+        if (matrixIndex >= 0) {
+            this->save();
+            this->concat(preViewMatrices[matrixIndex]);
+        }
+        this->experimental_DrawEdgeAAQuad(rects[i], nullptr, aaFlags, colors[i], mode);
+        if (matrixIndex >= 0) {
+            this->restore();
+        }
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //  These are the virtual drawing methods
 //////////////////////////////////////////////////////////////////////////////
@@ -2260,19 +2343,18 @@ void SkCanvas::onDrawBehind(const SkPaint& paint) {
     }
 
     SkIRect bounds;
-    SkDeque::Iter iter(fMCStack, SkDeque::Iter::kBack_IterStart);
-    for (;;) {
-        const MCRec* rec = (const MCRec*)iter.prev();
-        if (!rec) {
+    for (int i = fMCStack.size() - 1;; --i) {
+        if (i < 0) {
             return; // no backimages, so nothing to draw
         }
-        if (rec->fBackImage) {
+        const MCRec& rec = fMCStack[i];
+        if (rec.fBackImage) {
             // drawBehind should only have been called when the saveBehind record is active;
             // if this fails, it means a real saveLayer was made w/o being restored first.
-            SkASSERT(dev == rec->fDevice);
-            bounds = SkIRect::MakeXYWH(rec->fBackImage->fLoc.fX, rec->fBackImage->fLoc.fY,
-                                       rec->fBackImage->fImage->width(),
-                                       rec->fBackImage->fImage->height());
+            SkASSERT(dev == rec.fDevice);
+            bounds = SkIRect::MakeXYWH(rec.fBackImage->fLoc.fX, rec.fBackImage->fLoc.fY,
+                                       rec.fBackImage->fImage->width(),
+                                       rec.fBackImage->fImage->height());
             break;
         }
     }
@@ -2950,6 +3032,34 @@ void SkCanvas::onDrawEdgeAAQuad(const SkRect& r, const SkPoint clip[4], QuadAAFl
     }
 }
 
+void SkCanvas::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int count,
+                                   const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                   QuadAAFlags aaFlags, SkBlendMode mode) {
+    SkPaint paint;
+    paint.setBlendMode(mode);
+
+    // The set is only rejected as a whole; the device clips the individual rectangles.
+    auto entryBounds = [&](int i) {
+        SkRect bounds = rects[i].makeSorted();
+        if (matrixIndices && matrixIndices[i] >= 0) {
+            preViewMatrices[matrixIndices[i]].mapRect(&bounds);
+        }
+        return bounds;
+    };
+    SkRect setBounds = entryBounds(0);
+    for (int i = 1; i < count; ++i) {
+        setBounds.joinPossiblyEmptyRect(entryBounds(i));
+    }
+    if (this->internalQuickReject(setBounds, paint)) {
+        return;
+    }
+
+    if (this->predrawNotify()) {
+        this->topDevice()->drawEdgeAARectSet(rects, colors, count, matrixIndices, preViewMatrices,
+                                             aaFlags, mode);
+    }
+}
+
 void SkCanvas::onDrawEdgeAAImageSet2(const ImageSetEntry imageSet[], int count,
                                      const SkPoint dstClips[], const SkMatrix preViewMatrices[],
                                      const SkSamplingOptions& sampling, const SkPaint* paint,
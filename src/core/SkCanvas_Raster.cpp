@@ -26,8 +26,7 @@ class SkSurfaceProps;
 
 #endif
 
-SkCanvas::SkCanvas(const SkBitmap& bitmap, const SkSurfaceProps& props)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage)), fProps(props) {
+SkCanvas::SkCanvas(const SkBitmap& bitmap, const SkSurfaceProps& props) : fProps(props) {
     this->init(sk_make_sp<SkBitmapDevice>(bitmap, fProps));
 }
 
@@ -35,8 +34,7 @@ SkCanvas::SkCanvas(const SkBitmap& bitmap,
                    std::unique_ptr<SkRasterHandleAllocator> alloc,
                    SkRasterHandleAllocator::Handle hndl,
                    const SkSurfaceProps* props)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage))
-        , fProps(SkSurfacePropsCopyOrDefault(props))
+        : fProps(SkSurfacePropsCopyOrDefault(props))
         , fAllocator(std::move(alloc)) {
     this->init(sk_make_sp<SkBitmapDevice>(bitmap, fProps, hndl));
 }
@@ -44,8 +42,7 @@ SkCanvas::SkCanvas(const SkBitmap& bitmap,
 SkCanvas::SkCanvas(const SkBitmap& bitmap) : SkCanvas(bitmap, nullptr, nullptr, nullptr) {}
 
 #if defined(SK_BUILD_FOR_ANDROID_FRAMEWORK)
-SkCanvas::SkCanvas(const SkBitmap& bitmap, ColorBehavior)
-        : fMCStack(sizeof(MCRec), fMCRecStorage, sizeof(fMCRecStorage)) {
+SkCanvas::SkCanvas(const SkBitmap& bitmap, ColorBehavior) {
     SkBitmap tmp(bitmap);
     *const_cast<SkImageInfo*>(&tmp.info()) = tmp.info().makeColorSpace(nullptr);
     this->init(sk_make_sp<SkBitmapDevice>(tmp, fProps));
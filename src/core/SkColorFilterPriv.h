@@ -29,6 +29,11 @@ public:
                                                   const skcms_TransferFunction* tf,
                                                   const skcms_Matrix3x3* gamut,
                                                   const SkAlphaType* at);
+
+    // Returns one filter that does the same as outer composed with inner, when the pair folds
+    // into a single matrix or table filter, or else null. SkColorFilter::makeComposed() uses this
+    // to collapse chains of matrices and of tables as they're built.
+    static sk_sp<SkColorFilter> Fold(const SkColorFilter* outer, const SkColorFilter* inner);
 };
 
 #endif
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkContourMeasureCache.h"
+
+#include "include/core/SkPath.h"
+#include "include/core/SkTypes.h"
+#include "include/private/SkIDChangeListener.h"
+#include "include/private/base/SkOnce.h"
+#include "src/core/SkPathMeasurePriv.h"
+#include "src/core/SkPathPriv.h"
+#include "src/core/SkResourceCache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+sk_sp<SkPathContours> SkPathContours::Make(const SkPath& path, bool forceClosed,
+                                           SkScalar resScale) {
+    sk_sp<SkPathContours> contours(new SkPathContours);
+    contours->fStarts.push_back(0);
+
+    SkContourMeasureIter iter(path, forceClosed, resScale);
+    while (sk_sp<SkContourMeasure> contour = iter.next()) {
+        contours->fStarts.push_back(contours->fStarts.back() + contour->length());
+        contours->fContours.push_back(std::move(contour));
+    }
+    return contours;
+}
+
+int SkPathContours::findContour(SkScalar distance) const {
+    // fStarts[i + 1] is where contour i ends.
+    const SkScalar* ends = fStarts.begin() + 1;
+    return std::upper_bound(ends, fStarts.end(), distance) - ends;
+}
+
+int SkPathContours::getSegments(SkScalar startD, SkScalar stopD, SkPath* dst,
+                                bool startWithMoveTo) const {
+    int i = this->findContour(startD);
+    for (; i < this->count(); ++i) {
+        (void)fContours[i]->getSegment(startD - fStarts[i], stopD - fStarts[i], dst,
+                                       startWithMoveTo);
+        if (stopD <= fStarts[i + 1]) {
+            break;
+        }
+    }
+    return i;
+}
+
+size_t SkPathContours::approximateBytesUsed() const {
+    size_t bytes = sizeof(*this) + fContours.size_bytes() + fStarts.size_bytes();
+    for (const sk_sp<SkContourMeasure>& contour : fContours) {
+        bytes += SkPathMeasurePriv::ApproximateBytesUsed(*contour);
+    }
+    return bytes;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+static unsigned gContourMeasureKeyNamespaceLabel;
+
+// Measurements are cheap to redo compared to the images in the cache, so don't let them take
+// more than this share of it.
+static constexpr size_t kGlobalBudgetDivisor = 8;
+
+uint64_t shared_id_for_path(uint32_t pathGenID) {
+    uint64_t sharedID = SkSetFourByteTag('p', 'a', 't', 'h');
+    return (sharedID << 32) | pathGenID;
+}
+
+struct ContourMeasureKey : public SkResourceCache::Key {
+public:
+    ContourMeasureKey(uint32_t pathGenID, bool forceClosed, SkScalar resScale)
+            : fResScale(resScale)
+            , fForceClosed(forceClosed) {
+        this->init(&gContourMeasureKeyNamespaceLabel, shared_id_for_path(pathGenID),
+                   sizeof(fResScale) + sizeof(fForceClosed));
+    }
+
+    SkScalar fResScale;
+    uint32_t fForceClosed;
+};
+
+// Purges a path's measurements once its generation ID is stale.
+class PurgeOnChange final : public SkIDChangeListener {
+public:
+    explicit PurgeOnChange(uint32_t pathGenID) : fPathGenID(pathGenID) {}
+
+    void changed() override {
+        SkResourceCache::PostPurgeSharedID(shared_id_for_path(fPathGenID));
+    }
+
+private:
+    const uint32_t fPathGenID;
+};
+
+struct ContourMeasureRec : public SkResourceCache::Rec {
+    ContourMeasureRec(const ContourMeasureKey& key,
+                      sk_sp<const SkPathContours> contours,
+                      sk_sp<PurgeOnChange> listener)
+            : fKey(key), fContours(std::move(contours)), fListener(std::move(listener)) {}
+
+    ~ContourMeasureRec() override {
+        // Once we're gone there's nothing left to purge, so the path can drop the listener.
+        fListener->markShouldDeregister();
+    }
+
+    ContourMeasureKey           fKey;
+    sk_sp<const SkPathContours> fContours;
+    sk_sp<PurgeOnChange>        fListener;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override {
+        return sizeof(*this) + fContours->approximateBytesUsed();
+    }
+    const char* getCategory() const override { return "contour-measure"; }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* context) {
+        const ContourMeasureRec& rec = static_cast<const ContourMeasureRec&>(baseRec);
+        *static_cast<sk_sp<const SkPathContours>*>(context) = rec.fContours;
+        return true;
+    }
+};
+
+}  // namespace
+
+sk_sp<const SkPathContours> SkContourMeasureCache::FindOrMeasure(const SkPath& path,
+                                                                 bool forceClosed,
+                                                                 SkScalar resScale) {
+    if (path.isVolatile()) {
+        return SkPathContours::Make(path, forceClosed, resScale);
+    }
+
+    const uint32_t genID = path.getGenerationID();
+    ContourMeasureKey key(genID, forceClosed, resScale);
+    sk_sp<const SkPathContours> contours;
+    if (SkResourceCache::Find(key, ContourMeasureRec::Visitor, &contours)) {
+        return contours;
+    }
+
+    static SkOnce once;
+    once([] {
+        SkResourceCache::SetNamespaceByteLimit(
+                &gContourMeasureKeyNamespaceLabel,
+                SkResourceCache::GetTotalByteLimit() / kGlobalBudgetDivisor);
+    });
+
+    contours = SkPathContours::Make(path, forceClosed, resScale);
+    // Add the listener first: the cache may drop the rec (and deregister it) straight away.
+    auto listener = sk_make_sp<PurgeOnChange>(genID);
+    SkPathPriv::AddGenIDChangeListener(path, listener);
+    SkResourceCache::Add(new ContourMeasureRec(key, contours, std::move(listener)));
+    return contours;
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkContourMeasureCache_DEFINED
+#define SkContourMeasureCache_DEFINED
+
+#include "include/core/SkContourMeasure.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkScalar.h"
+#include "include/private/base/SkTArray.h"
+
+class SkPath;
+
+/**
+ *  Every contour of a path, measured, and the distance along the whole path at which each one
+ *  starts. Immutable once made, so it can be shared across threads.
+ */
+class SkPathContours : public SkNVRefCnt<SkPathContours> {
+public:
+    static sk_sp<SkPathContours> Make(const SkPath&, bool forceClosed, SkScalar resScale);
+
+    int count() const { return fContours.size(); }
+    const SkContourMeasure& contour(int i) const { return *fContours[i]; }
+    SkScalar contourStart(int i) const { return fStarts[i]; }
+
+    SkScalar length() const { return fStarts.back(); }
+
+    /** Returns the first contour that extends past 'distance', or count() if none does. Contours
+     *  are found with a binary search, so long paths don't cost more to index into.
+     */
+    int findContour(SkScalar distance) const;
+
+    /** Appends [startD, stopD) of the whole path to dst, calling SkContourMeasure::getSegment()
+     *  on each contour the range spans. Returns the index of the contour the range ends in, or
+     *  count() if it runs past the end of the path.
+     */
+    int getSegments(SkScalar startD, SkScalar stopD, SkPath* dst, bool startWithMoveTo) const;
+
+    size_t approximateBytesUsed() const;
+
+private:
+    skia_private::TArray<sk_sp<SkContourMeasure>> fContours;
+    skia_private::TArray<SkScalar>                fStarts;  // count() + 1, ending with length()
+};
+
+/**
+ *  Path effects like trim are applied to the same path over and over as their parameters
+ *  animate, and each time they would measure it all over again. This keeps the measurements in
+ *  the global SkResourceCache, keyed by the path's generation ID, and purges them when the path
+ *  changes or is deleted.
+ */
+class SkContourMeasureCache {
+public:
+    /** Returns path's contours, as SkContourMeasureIter(path, forceClosed, resScale) would measure
+     *  them. They come from the cache when the same path was measured the same way before, and
+     *  are added to it otherwise. Volatile paths are always measured from scratch.
+     */
+    static sk_sp<const SkPathContours> FindOrMeasure(const SkPath&,
+                                                     bool forceClosed,
+                                                     SkScalar resScale = 1);
+};
+
+#endif
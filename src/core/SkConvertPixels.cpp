@@ -8,21 +8,30 @@
 
 #include "include/core/SkColorType.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkSize.h"
+#include "include/core/SkYUVAInfo.h"
+#include "include/core/SkYUVAPixmaps.h"
 #include "include/private/SkColorData.h"
 #include "include/private/base/SkAssert.h"
 #include "include/private/base/SkTemplates.h"
 #include "src/base/SkHalf.h"
 #include "src/base/SkRectMemcpy.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkColorSpaceXformSteps.h"
 #include "src/core/SkImageInfoPriv.h"
 #include "src/core/SkRasterPipeline.h"
 #include "src/core/SkRasterPipelineOpContexts.h"
 #include "src/core/SkSwizzlePriv.h"
+#include "src/core/SkTaskGroup.h"
+#include "src/core/SkYUVAInfoLocation.h"
+#include "src/core/SkYUVMath.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <initializer_list>
+#include <tuple>
 
 static bool rect_memcpy(const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRB,
                         const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRB,
@@ -77,6 +86,53 @@ static bool swizzle_or_premul(const SkImageInfo& dstInfo,       void* dstPixels,
     return true;
 }
 
+static void force_opaque(uint32_t* dst, const uint32_t* src, int count) {
+    using U32 = skvx::Vec<8, uint32_t>;
+    while (count >= 8) {
+        (U32::Load(src) | 0xFF000000).store(dst);
+        dst += 8;
+        src += 8;
+        count -= 8;
+    }
+    while (count --> 0) {
+        *dst++ = *src++ | 0xFF000000;
+    }
+}
+
+// RGB_888x to or from 8888 only needs to swap R and B when one side is BGRA, and to fill in the
+// alpha byte, without going through the pipeline's float or 16-bit lanes.
+static bool swizzle_opaque(const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRB,
+                           const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRB,
+                           const SkColorSpaceXformSteps& steps) {
+    auto is_32bit_rgb = [](SkColorType ct) {
+        return ct == kRGBA_8888_SkColorType ||
+               ct == kBGRA_8888_SkColorType ||
+               ct == kRGB_888x_SkColorType;
+    };
+    if (!is_32bit_rgb(dstInfo.colorType()) ||
+        !is_32bit_rgb(srcInfo.colorType()) ||
+        (dstInfo.colorType() != kRGB_888x_SkColorType &&
+         srcInfo.colorType() != kRGB_888x_SkColorType) ||
+        steps.flags.mask() != 0b00000) {
+        return false;
+    }
+
+    const bool swapRB = dstInfo.colorType() == kBGRA_8888_SkColorType ||
+                        srcInfo.colorType() == kBGRA_8888_SkColorType;
+    for (int y = 0; y < dstInfo.height(); y++) {
+        auto dst = (uint32_t*)dstPixels;
+        auto src = (const uint32_t*)srcPixels;
+        if (swapRB) {
+            SkOpts::RGBA_to_BGRA(dst, src, dstInfo.width());
+            src = dst;
+        }
+        force_opaque(dst, src, dstInfo.width());
+        dstPixels = SkTAddOffset<void>(dstPixels, dstRB);
+        srcPixels = SkTAddOffset<const void>(srcPixels, srcRB);
+    }
+    return true;
+}
+
 static bool convert_to_alpha8(const SkImageInfo& dstInfo,       void* vdst, size_t dstRB,
                               const SkImageInfo& srcInfo, const void*  src, size_t srcRB,
                               const SkColorSpaceXformSteps&) {
@@ -229,6 +285,25 @@ static void convert_with_pipeline(const SkImageInfo& dstInfo, void* dstRow, int
     pipeline.run(0,0, srcInfo.width(), srcInfo.height());
 }
 
+std::atomic<bool> gSkParallelConvertPixels{false};
+
+static void convert_pixels(const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRB,
+                           const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRB,
+                           const SkColorSpaceXformSteps& steps) {
+    for (auto fn : {rect_memcpy, swizzle_or_premul, swizzle_opaque, convert_to_alpha8}) {
+        if (fn(dstInfo, dstPixels, dstRB, srcInfo, srcPixels, srcRB, steps)) {
+            return;
+        }
+    }
+    convert_with_pipeline(dstInfo, dstPixels, (int)(dstRB / dstInfo.bytesPerPixel()),
+                          srcInfo, srcPixels, (int)(srcRB / srcInfo.bytesPerPixel()), steps);
+}
+
+// Conversions smaller than this aren't worth handing to other threads.
+static constexpr int64_t kMinParallelPixels = 1 << 20;
+static constexpr int     kMinBandHeight     = 64;
+static constexpr int     kMaxBands          = 32;
+
 bool SkConvertPixels(const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRB,
                      const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRB) {
     SkASSERT(dstInfo.dimensions() == srcInfo.dimensions());
@@ -244,11 +319,161 @@ bool SkConvertPixels(const SkImageInfo& dstInfo,       void* dstPixels, size_t d
     SkColorSpaceXformSteps steps{srcInfo.colorSpace(), srcInfo.alphaType(),
                                  dstInfo.colorSpace(), dstInfo.alphaType()};
 
-    for (auto fn : {rect_memcpy, swizzle_or_premul, convert_to_alpha8}) {
-        if (fn(dstInfo, dstPixels, dstRB, srcInfo, srcPixels, srcRB, steps)) {
-            return true;
+    const int height = dstInfo.height();
+    if (!gSkParallelConvertPixels ||
+        (int64_t)dstInfo.width() * height < kMinParallelPixels ||
+        height < 2 * kMinBandHeight) {
+        convert_pixels(dstInfo, dstPixels, dstRB, srcInfo, srcPixels, srcRB, steps);
+        return true;
+    }
+
+    // Every row converts independently, so bands of rows can run concurrently.
+    const int bandCount  = std::min(kMaxBands, height / kMinBandHeight);
+    const int bandHeight = (height + bandCount - 1) / bandCount;
+    SkTaskGroup tasks;
+    tasks.batch(bandCount, [&](int i) {
+        const int top = i * bandHeight,
+                  rows = std::min(bandHeight, height - top);
+        if (rows <= 0) {
+            return;
+        }
+        convert_pixels(dstInfo.makeWH(dstInfo.width(), rows),
+                       SkTAddOffset<void>(dstPixels, top * dstRB), dstRB,
+                       srcInfo.makeWH(srcInfo.width(), rows),
+                       SkTAddOffset<const void>(srcPixels, top * srcRB), srcRB,
+                       steps);
+    });
+    tasks.wait();
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Maps each of count dst columns (or rows) to the nearest of n plane columns (or rows).
+static void nearest_indices(int count, int n, int indices[]) {
+    for (int i = 0; i < count; ++i) {
+        indices[i] = (int)(((int64_t)2 * i + 1) * n / (2 * count));
+    }
+}
+
+// Reads one channel of a plane's row at the given columns, as [0,1] floats.
+static void load_yuva_channel(const SkPixmap& plane, SkColorChannel channel, bool is16, int y,
+                              const int xs[], int count, float dst[]) {
+    const size_t bpp = plane.info().bytesPerPixel();
+    const size_t channelBytes = is16 ? 2 : 1;
+    // Single channel color types keep their channel first, whatever it's called.
+    const size_t offset = bpp == channelBytes ? 0 : (size_t)channel * channelBytes;
+    const uint8_t* row = static_cast<const uint8_t*>(plane.addr(0, y)) + offset;
+    if (is16) {
+        for (int i = 0; i < count; ++i) {
+            uint16_t v;
+            memcpy(&v, row + xs[i] * bpp, sizeof(v));
+            dst[i] = v * (1 / 65535.f);
+        }
+    } else {
+        for (int i = 0; i < count; ++i) {
+            dst[i] = row[xs[i] * bpp] * (1 / 255.f);
+        }
+    }
+}
+
+bool SkConvertYUVAPixels(const SkPixmap& dst, const SkYUVAPixmaps& src) {
+    const SkYUVAInfo& yuvaInfo = src.yuvaInfo();
+    if (!src.isValid() || yuvaInfo.origin() != kTopLeft_SkEncodedOrigin ||
+        dst.dimensions() != yuvaInfo.dimensions()) {
+        return false;
+    }
+    const SkYUVAPixmapInfo::DataType dataType = src.dataType();
+    if (dataType != SkYUVAPixmapInfo::DataType::kUnorm8 &&
+        dataType != SkYUVAPixmapInfo::DataType::kUnorm16) {
+        return false;
+    }
+    const SkColorType dstCT = dst.colorType();
+    if (dstCT != kRGBA_8888_SkColorType && dstCT != kBGRA_8888_SkColorType &&
+        dstCT != kRGBA_F16_SkColorType) {
+        return false;
+    }
+    const bool is16 = dataType == SkYUVAPixmapInfo::DataType::kUnorm16;
+    const bool premul = dst.alphaType() == kPremul_SkAlphaType;
+
+    float m[20];
+    SkColorMatrix_YUV2RGB(yuvaInfo.yuvColorSpace(), m);
+
+    const SkYUVAInfo::YUVALocations locations = src.toYUVALocations();
+    const bool hasAlpha = locations[SkYUVAInfo::kA].fPlane >= 0;
+    const int channelCount = hasAlpha ? 4 : 3;
+
+    // The planes' columns to sample for each dst column, and rows for each dst row.
+    const int w = dst.width(),
+              h = dst.height();
+    skia_private::AutoSTMalloc<4 * 256, int> xs(SkYUVAInfo::kMaxPlanes * w);
+    skia_private::AutoSTMalloc<4 * 256, int> ys(SkYUVAInfo::kMaxPlanes * h);
+    for (int i = 0; i < src.numPlanes(); ++i) {
+        nearest_indices(w, src.plane(i).width(),  xs.get() + i * w);
+        nearest_indices(h, src.plane(i).height(), ys.get() + i * h);
+    }
+
+    // Each row is first gathered into planar floats, padded to whole vectors, then converted.
+    constexpr int N = 8;
+    using F = skvx::Vec<N, float>;
+    const int stride = (w + N - 1) / N * N;
+    skia_private::AutoSTMalloc<4 * 256, float> rows(4 * stride);
+    float* yuva[4] = {rows.get(), rows.get() + stride, rows.get() + 2 * stride,
+                      rows.get() + 3 * stride};
+    std::fill_n(rows.get(), 4 * stride, 1.f);
+
+    for (int y = 0; y < h; ++y) {
+        for (int c = 0; c < channelCount; ++c) {
+            const auto [plane, channel] = locations[c];
+            load_yuva_channel(src.plane(plane), channel, is16, ys[plane * h + y],
+                              xs.get() + plane * w, w, yuva[c]);
+        }
+
+        for (int x = 0; x < w; x += N) {
+            const F Y = F::Load(yuva[0] + x),
+                    U = F::Load(yuva[1] + x),
+                    V = F::Load(yuva[2] + x),
+                    A = F::Load(yuva[3] + x);
+            F r = skvx::pin(m[ 0] * Y + m[ 1] * U + m[ 2] * V + m[ 4], F(0), F(1)),
+              g = skvx::pin(m[ 5] * Y + m[ 6] * U + m[ 7] * V + m[ 9], F(0), F(1)),
+              b = skvx::pin(m[10] * Y + m[11] * U + m[12] * V + m[14], F(0), F(1));
+            if (premul) {
+                r *= A;
+                g *= A;
+                b *= A;
+            }
+
+            const int n = std::min(N, w - x);
+            if (dstCT == kRGBA_F16_SkColorType) {
+                const auto R = skvx::to_half(r), G = skvx::to_half(g),
+                           B = skvx::to_half(b), Aa = skvx::to_half(A);
+                auto* px = static_cast<uint16_t*>(dst.writable_addr(x, y));
+                for (int i = 0; i < n; ++i) {
+                    px[4 * i + 0] = R[i];
+                    px[4 * i + 1] = G[i];
+                    px[4 * i + 2] = B[i];
+                    px[4 * i + 3] = Aa[i];
+                }
+            } else {
+                if (dstCT == kBGRA_8888_SkColorType) {
+                    std::swap(r, b);
+                }
+                auto to_byte = [](const F& v) {
+                    return skvx::cast<uint32_t>(v * 255.f + 0.5f);
+                };
+                const skvx::Vec<N, uint32_t> px = to_byte(r)
+                                                | to_byte(g) << 8
+                                                | to_byte(b) << 16
+                                                | to_byte(A) << 24;
+                if (n == N) {
+                    px.store(dst.writable_addr32(x, y));
+                } else {
+                    uint32_t tmp[N];
+                    px.store(tmp);
+                    memcpy(dst.writable_addr32(x, y), tmp, n * sizeof(uint32_t));
+                }
+            }
         }
     }
-    convert_with_pipeline(dstInfo, dstPixels, dstStride, srcInfo, srcPixels, srcStride, steps);
     return true;
 }
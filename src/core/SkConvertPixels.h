@@ -8,12 +8,28 @@
 #ifndef SkConvertPixels_DEFINED
 #define SkConvertPixels_DEFINED
 
+#include <atomic>
 #include <cstddef>
 
+class SkPixmap;
+class SkYUVAPixmaps;
 struct SkImageInfo;
 
+// When set, SkConvertPixels() splits very large conversions into bands of rows and converts them
+// concurrently on SkExecutor::GetDefault().
+extern std::atomic<bool> gSkParallelConvertPixels;
+
 [[nodiscard]] bool SkConvertPixels(
         const SkImageInfo& dstInfo,       void* dstPixels, size_t dstRowBytes,
         const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRowBytes);
 
+// Converts YUVA planes to RGBA with the matrix for their SkYUVColorSpace, taking each plane's
+// pixel nearest to the center of each dst pixel. The RGB values are left in the color space the
+// YUVA data was encoded from, whatever dst's is.
+//
+// Returns false, without writing to dst, unless the planes are 8- or 16-bit unorm (which covers
+// I420, NV12 and P010 layouts), the origin is top-left, and dst is an 8888 or F16 pixmap the size
+// of the image.
+[[nodiscard]] bool SkConvertYUVAPixels(const SkPixmap& dst, const SkYUVAPixmaps& src);
+
 #endif
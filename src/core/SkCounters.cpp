@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkCounters.h"
+
+#include "include/private/base/SkMutex.h"
+#include "src/base/SkTInternalLList.h"
+#include "src/core/SkCountersPriv.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace SkCounters {
+namespace {
+
+// The counters of one thread. Only that thread writes to them, so it needs no atomic adds, but
+// Read() may load them from any thread.
+struct ThreadCounters {
+    std::atomic<uint64_t> fValues[kCounterCount] = {};
+
+    SK_DECLARE_INTERNAL_LLIST_INTERFACE(ThreadCounters);
+};
+
+// Counters of the live threads, and the totals of the threads that have exited.
+struct Registry {
+    SkMutex fMutex;
+    SkTInternalLList<ThreadCounters> fLiveThreads SK_GUARDED_BY(fMutex);
+    std::atomic<uint64_t> fExitedThreads[kCounterCount] = {};
+};
+
+Registry& registry() {
+    static Registry* registry = new Registry;
+    return *registry;
+}
+
+// Folds this thread's counters into the registry's exited totals when the thread exits.
+struct ThreadCountersRetirer {
+    ~ThreadCountersRetirer();
+};
+
+thread_local ThreadCounters*       tCounters = nullptr;
+thread_local bool                  tExited = false;
+thread_local ThreadCountersRetirer tRetirer;
+
+ThreadCountersRetirer::~ThreadCountersRetirer() {
+    if (ThreadCounters* counters = tCounters) {
+        Registry& r = registry();
+        SkAutoMutexExclusive lock(r.fMutex);
+        for (int i = 0; i < kCounterCount; ++i) {
+            r.fExitedThreads[i].fetch_add(counters->fValues[i].load(std::memory_order_relaxed),
+                                          std::memory_order_relaxed);
+        }
+        r.fLiveThreads.remove(counters);
+        delete counters;
+    }
+    tCounters = nullptr;
+    tExited = true;
+}
+
+ThreadCounters* register_thread() {
+    (void)&tRetirer;  // Make sure we retire these counters when this thread exits.
+    auto counters = new ThreadCounters;
+    Registry& r = registry();
+    SkAutoMutexExclusive lock(r.fMutex);
+    r.fLiveThreads.addToHead(counters);
+    return counters;
+}
+
+}  // namespace
+
+void Add(Counter counter, uint64_t n) {
+    const int i = static_cast<int>(counter);
+    ThreadCounters* counters = tCounters;
+    if (!counters) {
+        if (tExited) {
+            // Late counts, from thread_local destructors, say.
+            registry().fExitedThreads[i].fetch_add(n, std::memory_order_relaxed);
+            return;
+        }
+        counters = tCounters = register_thread();
+    }
+    std::atomic<uint64_t>& value = counters->fValues[i];
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+Snapshot Read() {
+    Snapshot snapshot;
+    Registry& r = registry();
+    SkAutoMutexExclusive lock(r.fMutex);
+    for (int i = 0; i < kCounterCount; ++i) {
+        snapshot.fValues[i] = r.fExitedThreads[i].load(std::memory_order_relaxed);
+    }
+    for (ThreadCounters* counters : r.fLiveThreads) {
+        for (int i = 0; i < kCounterCount; ++i) {
+            snapshot.fValues[i] += counters->fValues[i].load(std::memory_order_relaxed);
+        }
+    }
+    return snapshot;
+}
+
+}  // namespace SkCounters
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkCountersPriv_DEFINED
+#define SkCountersPriv_DEFINED
+
+#include "include/core/SkCounters.h"
+#include "src/base/SkTime.h"
+
+#include <cstdint>
+
+namespace SkCounters {
+
+// Adds n to counter, on this thread's counters.
+void Add(Counter counter, uint64_t n = 1);
+
+// Counts a flush, and the time until it goes out of scope.
+class AutoCountFlush {
+public:
+    AutoCountFlush() : fStart(SkTime::GetNSecs()) {}
+    ~AutoCountFlush() {
+        Add(Counter::kFlushes);
+        Add(Counter::kFlushNanoseconds, static_cast<uint64_t>(SkTime::GetNSecs() - fStart));
+    }
+
+private:
+    const double fStart;
+};
+
+}  // namespace SkCounters
+
+#endif  // SkCountersPriv_DEFINED
@@ -32,6 +32,24 @@ void SkDescriptor::flatten(SkWriteBuffer& buffer) const {
     buffer.writePad32(static_cast<const void*>(this), this->fLength);
 }
 
+const SkDescriptor* SkDescriptor::ReadInPlace(SkReadBuffer& buffer) {
+    // The header and body were written contiguously, and the buffer keeps them 4-byte aligned,
+    // which is all an SkDescriptor needs.
+    auto desc = static_cast<const SkDescriptor*>(buffer.skip(sizeof(SkDescriptor)));
+    if (!desc || desc->getLength() < sizeof(SkDescriptor)) { return nullptr; }
+    if (!buffer.skip(desc->getLength() - sizeof(SkDescriptor))) { return nullptr; }
+
+// As in SkAutoDescriptor::MakeFromBuffer, fuzzers compute the checksum but ignore a mismatch.
+#if defined(SK_BUILD_FOR_FUZZER)
+    ComputeChecksum(desc);
+#else
+    if (ComputeChecksum(desc) != desc->fChecksum) { return nullptr; }
+#endif
+    if (!desc->isValid()) { return nullptr; }
+
+    return desc;
+}
+
 void* SkDescriptor::addEntry(uint32_t tag, size_t length, const void* data) {
     SkASSERT(tag);
     SkASSERT(SkAlign4(length) == length);
@@ -38,6 +38,11 @@ public:
 
     void flatten(SkWriteBuffer& buffer) const;
 
+    // Reads a descriptor written by flatten() without copying it: the result points into the
+    // buffer's memory, so it is only good for as long as that is. Returns nullptr if the data
+    // isn't a valid descriptor.
+    static const SkDescriptor* ReadInPlace(SkReadBuffer& buffer);
+
     uint32_t getLength() const { return fLength; }
     void* addEntry(uint32_t tag, size_t length, const void* data = nullptr);
     void computeChecksum();
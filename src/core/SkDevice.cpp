@@ -251,6 +251,23 @@ void SkDevice::drawEdgeAAQuad(const SkRect& r, const SkPoint clip[4], SkCanvas::
     }
 }
 
+void SkDevice::drawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int count,
+                                 const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                 SkCanvas::QuadAAFlags aaFlags, SkBlendMode mode) {
+    const SkM44 baseLocalToDevice = this->localToDevice44();
+    for (int i = 0; i < count; ++i) {
+        const int matrixIndex = matrixIndices ? matrixIndices[i] : -1;
+        SkASSERT(matrixIndex < 0 || preViewMatrices);
+        if (matrixIndex >= 0) {
+            this->setLocalToDevice(baseLocalToDevice * SkM44(preViewMatrices[matrixIndex]));
+        }
+        this->drawEdgeAAQuad(rects[i].makeSorted(), nullptr, aaFlags, colors[i], mode);
+        if (matrixIndex >= 0) {
+            this->setLocalToDevice(baseLocalToDevice);
+        }
+    }
+}
+
 void SkDevice::drawEdgeAAImageSet(const SkCanvas::ImageSetEntry images[], int count,
                                   const SkPoint dstClips[], const SkMatrix preViewMatrices[],
                                   const SkSamplingOptions& sampling, const SkPaint& paint,
@@ -312,6 +312,16 @@ void SkDrawBase::drawRRect(const SkRRect& rrect, const SkPaint& paint) const {
                 return;  // filterRRect() called the blitter, so we're done
             }
         }
+    } else if (paint.isAntiAlias()) {
+        // Axis-aligned rrects, ovals and circles can skip edge building and compute their
+        // coverage directly.
+        SkRRect devRRect;
+        if (rrect.transform(*fCTM, &devRRect)) {
+            SkAutoBlitterChoose blitter(*this, nullptr, paint);
+            if (SkScan::AntiFillRRect(devRRect, *fRC, blitter.get())) {
+                return;
+            }
+        }
     }
 
 DRAW_PATH:
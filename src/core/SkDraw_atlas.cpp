@@ -129,19 +129,41 @@ void SkDraw::drawAtlas(const SkRSXform xform[],
     }
     SkPath scratchPath;
 
+    // Sprites that miss the clip draw nothing, so we skip them before updating the shader, which
+    // inverts each sprite's matrix. Outsetting keeps us conservative about how the scan converters
+    // round.
+    const SkRect clipBounds = SkRect::Make(fRC->getBounds()).makeOutset(1, 1);
+    // Particle systems mostly draw unrotated sprites. When the CTM only scales and translates,
+    // those sprites' matrices only scale and translate too, and we build them directly.
+    const bool ctmIsScaleTranslate = fCTM->isScaleTranslate();
+
     for (int i = 0; i < count; ++i) {
+        const SkRSXform& rsx = xform[i];
+        const SkRect& tex = textures[i];
+        SkMatrix mx;
+        if (ctmIsScaleTranslate && rsx.fSSin == 0) {
+            const SkScalar sx = fCTM->getScaleX() * rsx.fSCos,
+                           sy = fCTM->getScaleY() * rsx.fSCos,
+                           tx = fCTM->getScaleX() * rsx.fTx + fCTM->getTranslateX(),
+                           ty = fCTM->getScaleY() * rsx.fTy + fCTM->getTranslateY();
+            mx.setScaleTranslate(sx, sy, tx - sx * tex.fLeft, ty - sy * tex.fTop);
+        } else {
+            mx.setRSXform(rsx);
+            mx.preTranslate(-tex.fLeft, -tex.fTop);
+            mx.postConcat(*fCTM);
+        }
+        if (!perspective && !mx.mapRect(tex).intersects(clipBounds)) {
+            continue;
+        }
+
         if (colors) {
             SkColor4f c4 = SkColor4f::FromColor(colors[i]);
             steps.apply(c4.vec());
             load_color(uniformCtx, c4.premul().vec());
         }
 
-        SkMatrix mx;
-        mx.setRSXform(xform[i]);
-        mx.preTranslate(-textures[i].fLeft, -textures[i].fTop);
-        mx.postConcat(*fCTM);
         if (transformShader->update(mx)) {
-            fill_rect(mx, *fRC, textures[i], blitter, &scratchPath);
+            fill_rect(mx, *fRC, tex, blitter, &scratchPath);
         }
     }
 }
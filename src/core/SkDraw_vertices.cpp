@@ -292,7 +292,25 @@ void SkDraw::drawFixedVertices(const SkVertices* vertices,
     if (!blitter) {
         return;
     }
+
+    // In a big mesh, many triangles can lie outside the clip. FillTriangle() would reject those,
+    // but only after we'd updated the shaders for them, inverting a matrix or two per triangle.
+    // Outsetting the bounds keeps us conservative about how FillTriangle() rounds them.
+    const SkRect clipBounds = SkRect::Make(fRC->getBounds()).makeOutset(1, 1);
+    auto missesClip = [&](const VertState& state) {
+        if (!dev2) {
+            return false;  // Triangles crossing w = 0 don't have simple bounds; let them be.
+        }
+        const SkPoint tri[] = {dev2[state.f0], dev2[state.f1], dev2[state.f2]};
+        SkRect bounds;
+        bounds.setBounds(tri, 3);
+        return !bounds.makeOutset(1, 1).intersects(clipBounds);
+    };
+
     while (vertProc(&state)) {
+        if (missesClip(state)) {
+            continue;
+        }
         if (triColorShader && !triColorShader->update(ctmInverse, positions, dstColors,
                                                       state.f0, state.f1, state.f2)) {
             continue;
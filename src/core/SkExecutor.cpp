@@ -10,8 +10,11 @@
 #include "include/private/base/SkSemaphore.h"
 #include "include/private/base/SkTArray.h"
 #include "src/base/SkNoDestructor.h"
+#include "src/base/SkSpinlock.h"
 
+#include <atomic>
 #include <deque>
+#include <memory>
 #include <thread>
 #include <utility>
 
@@ -143,6 +146,138 @@ private:
     bool                  fAllowBorrowing;
 };
 
+// An SkWorkStealingThreadPool gives each of its threads a queue of work for each priority.
+// Threads push and pop work at the back of their own queues, and when those are empty, steal
+// from the front of the others' queues.  Higher priority work is always taken first, from any
+// queue.  Work added from outside the pool is spread across the queues round-robin.
+class SkWorkStealingThreadPool final : public SkExecutor {
+public:
+    explicit SkWorkStealingThreadPool(int threads, bool allowBorrowing)
+            : fWorkers(new Worker[threads])
+            , fWorkerCount(threads)
+            , fAllowBorrowing(allowBorrowing) {
+        for (int i = 0; i < threads; i++) {
+            fThreads.emplace_back(&Loop, this, i);
+        }
+    }
+
+    ~SkWorkStealingThreadPool() override {
+        // Signal each thread that it's time to shut down.
+        for (int i = 0; i < fThreads.size(); i++) {
+            this->push(nullptr, Priority::kNormal, i);
+        }
+        for (int i = 0; i < fThreads.size(); i++) {
+            fThreads[i].join();
+        }
+    }
+
+    void add(std::function<void(void)> work) override {
+        this->addWithPriority(std::move(work), Priority::kNormal);
+    }
+
+    void addWithPriority(std::function<void(void)> work, Priority priority) override {
+        int index = (tCurrentPool == this)
+                  ? tCurrentWorker
+                  : (int)(fNextWorker.fetch_add(1, std::memory_order_relaxed) % fWorkerCount);
+        this->push(std::move(work), priority, index);
+    }
+
+    void borrow() override {
+        // If there is work waiting and we're allowed to borrow work, do it.
+        if (fAllowBorrowing && fWorkAvailable.try_wait()) {
+            SkAssertResult(this->do_work(tCurrentPool == this ? tCurrentWorker : 0));
+        }
+    }
+
+private:
+    static constexpr int kPriorities = (int)Priority::kHigh + 1;
+    // How many times an idle thread checks for more work before going to sleep.
+    static constexpr int kIdleSpins = 64;
+
+    struct Worker {
+        SkSpinlock                            fLock;
+        std::deque<std::function<void(void)>> fWork[kPriorities];
+    };
+
+    void push(std::function<void(void)> work, Priority priority, int index) {
+        {
+            Worker& worker = fWorkers[index];
+            SkAutoSpinlock lock(worker.fLock);
+            worker.fWork[(int)priority].emplace_back(std::move(work));
+        }
+        fWorkAvailable.signal(1);
+    }
+
+    // Pops from the back of our own queue, or steals from the front of another.
+    bool try_take(int priority, int index, std::function<void(void)>* work) {
+        for (int i = 0; i < fWorkerCount; i++) {
+            Worker& worker = fWorkers[(index + i) % fWorkerCount];
+            SkAutoSpinlock lock(worker.fLock);
+            std::deque<std::function<void(void)>>& list = worker.fWork[priority];
+            if (!list.empty()) {
+                if (i == 0) {
+                    *work = std::move(list.back());
+                    list.pop_back();
+                } else {
+                    *work = std::move(list.front());
+                    list.pop_front();
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // This method should be called only when fWorkAvailable indicates there's work to do.
+    bool do_work(int index) {
+        // fWorkAvailable counts work in all the queues, so having been signaled, some work is
+        // there for us.  Another thread may take the work we see first, so keep looking.
+        std::function<void(void)> work;
+        for (bool found = false; !found;) {
+            for (int p = kPriorities - 1; p >= 0 && !found; p--) {
+                found = this->try_take(p, index, &work);
+            }
+        }
+
+        if (!work) {
+            return false;  // This is Loop()'s signal to shut down.
+        }
+
+        work();
+        return true;
+    }
+
+    static void Loop(SkWorkStealingThreadPool* pool, int index) {
+        tCurrentPool = pool;
+        tCurrentWorker = index;
+        do {
+            // Spin a little before sleeping, as more work often arrives right away.
+            int spins = 0;
+            while (!pool->fWorkAvailable.try_wait()) {
+                if (++spins == kIdleSpins) {
+                    pool->fWorkAvailable.wait();
+                    break;
+                }
+                std::this_thread::yield();
+            }
+        } while (pool->do_work(index));
+        tCurrentPool = nullptr;
+    }
+
+    static thread_local SkWorkStealingThreadPool* tCurrentPool;
+    static thread_local int                       tCurrentWorker;
+
+    TArray<std::thread>       fThreads;
+    std::unique_ptr<Worker[]> fWorkers;
+    int                       fWorkerCount;
+    std::atomic<unsigned>     fNextWorker{0};
+    SkSemaphore               fWorkAvailable;
+    bool                      fAllowBorrowing;
+};
+
+thread_local SkWorkStealingThreadPool* SkWorkStealingThreadPool::tCurrentPool = nullptr;
+thread_local int                       SkWorkStealingThreadPool::tCurrentWorker = 0;
+
 std::unique_ptr<SkExecutor> SkExecutor::MakeFIFOThreadPool(int threads, bool allowBorrowing) {
     using WorkList = std::deque<std::function<void(void)>>;
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
@@ -153,3 +288,8 @@ std::unique_ptr<SkExecutor> SkExecutor::MakeLIFOThreadPool(int threads, bool all
     return std::make_unique<SkThreadPool<WorkList>>(threads > 0 ? threads : num_cores(),
                                                     allowBorrowing);
 }
+std::unique_ptr<SkExecutor> SkExecutor::MakeWorkStealingThreadPool(int threads,
+                                                                bool allowBorrowing) {
+    return std::make_unique<SkWorkStealingThreadPool>(threads > 0 ? threads : num_cores(),
+                                                      allowBorrowing);
+}
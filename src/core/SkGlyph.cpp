@@ -16,6 +16,7 @@
 #include "include/core/SkSpan.h"
 #include "include/private/base/SkFloatingPoint.h"
 #include "include/private/base/SkTFitsIn.h"
+#include "include/private/base/SkTemplates.h"
 #include "include/private/base/SkTo.h"
 #include "src/base/SkArenaAlloc.h"
 #include "src/base/SkBezierCurves.h"
@@ -24,6 +25,7 @@
 #include "src/core/SkWriteBuffer.h"
 #include "src/text/StrikeForGPU.h"
 
+#include <algorithm>
 #include <cstring>
 #include <optional>
 #include <tuple>
@@ -346,12 +348,92 @@ void SkGlyph::flattenMetrics(SkWriteBuffer& buffer) const {
     buffer.writeUInt(SkTo<uint32_t>(fMaskFormat));
 }
 
+// Glyph masks are mostly runs of clear or opaque pixels, so images are sent PackBits encoded
+// whenever that is smaller. Each control byte c < 128 is followed by c + 1 bytes to copy, and each
+// c >= 128 by one byte to repeat c - 125 times.
+static constexpr size_t kMinPackedRun = 3,
+                        kMaxPackedRun = 130,
+                        kMaxPackedCopy = 128;
+
+static size_t packed_bits_max_size(size_t size) {
+    return size + (size + kMaxPackedCopy - 1) / kMaxPackedCopy;
+}
+
+// dst must have room for packed_bits_max_size(size) bytes.
+static size_t pack_bits(const uint8_t* src, size_t size, uint8_t* dst) {
+    size_t packed = 0,
+           copyStart = 0;
+    auto copyUpTo = [&](size_t end) {
+        while (copyStart < end) {
+            const size_t n = std::min(end - copyStart, kMaxPackedCopy);
+            dst[packed++] = SkTo<uint8_t>(n - 1);
+            memcpy(dst + packed, src + copyStart, n);
+            packed += n;
+            copyStart += n;
+        }
+    };
+
+    for (size_t i = 0; i < size;) {
+        size_t run = 1;
+        while (i + run < size && run < kMaxPackedRun && src[i + run] == src[i]) {
+            run++;
+        }
+        if (run >= kMinPackedRun) {
+            copyUpTo(i);
+            dst[packed++] = SkTo<uint8_t>(run + 125);
+            dst[packed++] = src[i];
+            copyStart = i + run;
+        }
+        i += run;
+    }
+    copyUpTo(size);
+    return packed;
+}
+
+// Returns false unless src unpacks to exactly dstSize bytes.
+static bool unpack_bits(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize) {
+    size_t in = 0,
+           out = 0;
+    while (in < srcSize) {
+        const uint8_t c = src[in++];
+        if (c < 128) {
+            const size_t n = c + 1;
+            if (n > srcSize - in || n > dstSize - out) {
+                return false;
+            }
+            memcpy(dst + out, src + in, n);
+            in += n;
+            out += n;
+        } else {
+            const size_t n = c - 125;
+            if (in == srcSize || n > dstSize - out) {
+                return false;
+            }
+            memset(dst + out, src[in++], n);
+            out += n;
+        }
+    }
+    return out == dstSize;
+}
+
 void SkGlyph::flattenImage(SkWriteBuffer& buffer) const {
     SkASSERT(this->setImageHasBeenCalled());
 
     // If the glyph is empty or too big, then no image data is sent.
-    if (!this->isEmpty() && SkGlyphDigest::FitsInAtlas(*this)) {
-        buffer.writeByteArray(this->image(), this->imageSize());
+    if (this->isEmpty() || !SkGlyphDigest::FitsInAtlas(*this)) {
+        return;
+    }
+
+    const size_t size = this->imageSize();
+    skia_private::AutoSTMalloc<256, uint8_t> packed(packed_bits_max_size(size));
+    const size_t packedSize = pack_bits(static_cast<const uint8_t*>(this->image()), size,
+                                        packed.get());
+    const bool isPacked = packedSize < size;
+    buffer.writeBool(isPacked);
+    if (isPacked) {
+        buffer.writeByteArray(packed.get(), packedSize);
+    } else {
+        buffer.writeByteArray(this->image(), size);
     }
 }
 
@@ -365,8 +447,17 @@ size_t SkGlyph::addImageFromBuffer(SkReadBuffer& buffer, SkArenaAlloc* alloc) {
 
     size_t memoryIncrease = 0;
 
+    const bool isPacked = buffer.readBool();
     void* imageData = alloc->makeBytesAlignedTo(this->imageSize(), this->formatAlignment());
-    buffer.readByteArray(imageData, this->imageSize());
+    if (isPacked) {
+        size_t packedSize;
+        auto packed = static_cast<const uint8_t*>(buffer.skipByteArray(&packedSize));
+        buffer.validate(packed != nullptr &&
+                        unpack_bits(packed, packedSize,
+                                    static_cast<uint8_t*>(imageData), this->imageSize()));
+    } else {
+        buffer.readByteArray(imageData, this->imageSize());
+    }
     if (buffer.isValid()) {
         this->installImage(imageData);
         memoryIncrease += this->imageSize();
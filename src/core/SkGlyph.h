@@ -365,7 +365,7 @@ public:
 
     static bool FitsInAtlas(const SkGlyph& glyph);
 
-    // GetKey and Hash implement the required methods for THashTable.
+    // GetKey and Hash implement the required methods for THashTable and TSwissTable.
     static SkPackedGlyphID GetKey(SkGlyphDigest digest) {
         return SkPackedGlyphID{SkTo<uint32_t>(digest.fPackedID)};
     }
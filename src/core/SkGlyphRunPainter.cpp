@@ -21,19 +21,26 @@
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
+#include "include/core/SkTextBlob.h"
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkSpan_impl.h"
 #include "include/private/base/SkTArray.h"
+#include "src/core/SkChecksum.h"
 #include "src/core/SkGlyph.h"
+#include "src/core/SkLRUCache.h"
 #include "src/core/SkMask.h"
+#include "src/core/SkPaintPriv.h"
 #include "src/core/SkScalerContext.h"
 #include "src/core/SkStrike.h"
 #include "src/core/SkStrikeSpec.h"
 #include "src/text/GlyphRun.h"
 
 #include <algorithm>
+#include <cstring>
 #include <initializer_list>
+#include <optional>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 using namespace skia_private;
@@ -161,6 +168,70 @@ prepare_for_direct_mask_drawing(SkStrike* strike,
 }
 }  // namespace
 
+// -- SkGlyphRunListPainterCPU::MaskCache ----------------------------------------------------------
+// Static text is drawn from the same blob, at the same place, frame after frame. When every glyph
+// of a blob was drawn as a direct mask, this keeps the glyphs and their device positions, so the
+// next such draw goes straight to paintMasks() instead of building each run's strike descriptor
+// and looking every glyph up again. Holding the strikes keeps the glyphs' masks alive.
+class SkGlyphRunListPainterCPU::MaskCache {
+public:
+    SK_BEGIN_REQUIRE_DENSE
+    struct Key {
+        uint32_t fBlobID;
+        // Everything else in the paint that can change which glyphs, or which of their masks,
+        // the draw ends up with. The font is part of the blob.
+        uint32_t fUseDeviceProps;
+        SkColor  fLuminanceColor;
+        SkColor  fColor;  // For color glyphs whose masks are drawn in the paint's color.
+        uint32_t fStyle;
+        SkScalar fStrokeWidth;
+        SkScalar fStrokeMiter;
+        uint32_t fStrokeJoinAndCap;
+        SkScalar fPositionMatrix[9];
+
+        // Bitwise, so the hash agrees with it even for -0 and NaN.
+        bool operator==(const Key& that) const { return !memcmp(this, &that, sizeof(Key)); }
+    };
+    SK_END_REQUIRE_DENSE
+
+    struct Masks {
+        STArray<1, sk_sp<SkStrike>> fStrikes;
+        TArray<const SkGlyph*>      fGlyphs;
+        TArray<SkPoint>             fPositions;
+    };
+
+    // Blobs are only cached when their draws can be replayed as one paintMasks() call.
+    static std::optional<Key> MakeKey(const GlyphRunList& glyphRunList,
+                                      const SkPaint& paint,
+                                      bool useDeviceProps,
+                                      const SkMatrix& positionMatrix) {
+        if (!glyphRunList.canCache() || positionMatrix.hasPerspective() ||
+            paint.getPathEffect() || paint.getMaskFilter()) {
+            return std::nullopt;
+        }
+        Key key;
+        key.fBlobID = glyphRunList.blob()->uniqueID();
+        key.fUseDeviceProps = useDeviceProps;
+        key.fLuminanceColor = SkPaintPriv::ComputeLuminanceColor(paint);
+        key.fColor = paint.getColor();
+        key.fStyle = paint.getStyle();
+        key.fStrokeWidth = paint.getStrokeWidth();
+        key.fStrokeMiter = paint.getStrokeMiter();
+        key.fStrokeJoinAndCap = paint.getStrokeJoin() << 16 | paint.getStrokeCap();
+        positionMatrix.get9(key.fPositionMatrix);
+        return key;
+    }
+
+    Masks* find(const Key& key) { return fCache.find(key); }
+    void insert(const Key& key, Masks&& masks) { fCache.insert(key, std::move(masks)); }
+
+private:
+    // Few enough that the strikes held don't add up to much beyond what the strike cache holds.
+    static constexpr int kMaxBlobs = 64;
+
+    SkLRUCache<Key, Masks, SkForceDirectHash<Key>> fCache{kMaxBlobs};
+};
+
 // -- SkGlyphRunListPainterCPU ---------------------------------------------------------------------
 SkGlyphRunListPainterCPU::SkGlyphRunListPainterCPU(const SkSurfaceProps& props,
                                                    SkColorType colorType,
@@ -168,13 +239,39 @@ SkGlyphRunListPainterCPU::SkGlyphRunListPainterCPU(const SkSurfaceProps& props,
         : fDeviceProps{props}
         , fBitmapFallbackProps{SkSurfaceProps{props.flags(), kUnknown_SkPixelGeometry}}
         , fColorType{colorType}
-        , fScalerContextFlags{compute_scaler_context_flags(cs)} {}
+        , fScalerContextFlags{compute_scaler_context_flags(cs)}
+        , fMaskCache{std::make_unique<MaskCache>()} {}
+
+SkGlyphRunListPainterCPU::~SkGlyphRunListPainterCPU() = default;
 
 void SkGlyphRunListPainterCPU::drawForBitmapDevice(SkCanvas* canvas,
                                                    const BitmapDevicePainter* bitmapDevice,
                                                    const sktext::GlyphRunList& glyphRunList,
                                                    const SkPaint& paint,
                                                    const SkMatrix& drawMatrix) {
+    // The bitmap blitters can only draw lcd text to a N32 bitmap in srcOver. Otherwise,
+    // convert the lcd text into A8 text. The props communicate this to the scaler.
+    const bool useDeviceProps = kN32_SkColorType == fColorType && paint.isSrcOver();
+    auto& props = useDeviceProps ? fDeviceProps : fBitmapFallbackProps;
+
+    SkPoint drawOrigin = glyphRunList.origin();
+    SkMatrix positionMatrix{drawMatrix};
+    positionMatrix.preTranslate(drawOrigin.x(), drawOrigin.y());
+
+    const std::optional<MaskCache::Key> cacheKey =
+            MaskCache::MakeKey(glyphRunList, paint, useDeviceProps, positionMatrix);
+    if (cacheKey) {
+        if (MaskCache::Masks* masks = fMaskCache->find(*cacheKey)) {
+            bitmapDevice->paintMasks(SkMakeZip(masks->fGlyphs, masks->fPositions), paint);
+            return;
+        }
+    }
+    // Filled in as the runs are drawn, until one of them draws something other than direct masks.
+    std::optional<MaskCache::Masks> masksToCache;
+    if (cacheKey) {
+        masksToCache.emplace();
+    }
+
     STArray<64, const SkGlyph*> acceptedPackedGlyphIDs;
     STArray<64, SkPoint> acceptedPositions;
     STArray<64, SkGlyphID> rejectedGlyphIDs;
@@ -187,21 +284,13 @@ void SkGlyphRunListPainterCPU::drawForBitmapDevice(SkCanvas* canvas,
     rejectedPositions.resize(maxGlyphRunSize);
     const auto rejectedBuffer = SkMakeZip(rejectedGlyphIDs, rejectedPositions);
 
-    // The bitmap blitters can only draw lcd text to a N32 bitmap in srcOver. Otherwise,
-    // convert the lcd text into A8 text. The props communicate this to the scaler.
-    auto& props = (kN32_SkColorType == fColorType && paint.isSrcOver())
-                          ? fDeviceProps
-                          : fBitmapFallbackProps;
-
-    SkPoint drawOrigin = glyphRunList.origin();
-    SkMatrix positionMatrix{drawMatrix};
-    positionMatrix.preTranslate(drawOrigin.x(), drawOrigin.y());
     for (auto& glyphRun : glyphRunList) {
         const SkFont& runFont = glyphRun.font();
 
         SkZip<const SkGlyphID, const SkPoint> source = glyphRun.source();
 
         if (SkStrikeSpec::ShouldDrawAsPath(paint, runFont, positionMatrix)) {
+            masksToCache.reset();
             auto [strikeSpec, strikeToSourceScale] =
                     SkStrikeSpec::MakePath(runFont, paint, props, fScalerContextFlags);
 
@@ -287,6 +376,15 @@ void SkGlyphRunListPainterCPU::drawForBitmapDevice(SkCanvas* canvas,
                                                                         rejectedBuffer);
             source = rejected;
             bitmapDevice->paintMasks(accepted, paint);
+
+            if (masksToCache && source.empty()) {
+                masksToCache->fGlyphs.push_back_n(accepted.size(), accepted.get<0>().data());
+                masksToCache->fPositions.push_back_n(accepted.size(), accepted.get<1>().data());
+                masksToCache->fStrikes.push_back(std::move(strike));
+            }
+        }
+        if (!source.empty()) {
+            masksToCache.reset();
         }
         if (!source.empty()) {
             std::vector<SkPoint> sourcePositions;
@@ -378,4 +476,8 @@ void SkGlyphRunListPainterCPU::drawForBitmapDevice(SkCanvas* canvas,
         // TODO: have the mask stage above reject the glyphs that are too big, and handle the
         //  rejects in a more sophisticated stage.
     }
+
+    if (masksToCache) {
+        fMaskCache->insert(*cacheKey, std::move(*masksToCache));
+    }
 }
@@ -13,6 +13,7 @@
 #include "src/base/SkZip.h"
 
 #include <cstdint>
+#include <memory>
 
 class SkBitmap;
 class SkCanvas;
@@ -43,12 +44,15 @@ public:
     SkGlyphRunListPainterCPU(const SkSurfaceProps& props,
                              SkColorType colorType,
                              SkColorSpace* cs);
+    ~SkGlyphRunListPainterCPU();
 
     void drawForBitmapDevice(
             SkCanvas* canvas, const BitmapDevicePainter* bitmapDevice,
             const sktext::GlyphRunList& glyphRunList, const SkPaint& paint,
             const SkMatrix& drawMatrix);
 private:
+    class MaskCache;
+
     // The props as on the actual device.
     const SkSurfaceProps fDeviceProps;
 
@@ -56,5 +60,8 @@ private:
     const SkSurfaceProps fBitmapFallbackProps;
     const SkColorType fColorType;
     const SkScalerContextFlags fScalerContextFlags;
+
+    // The masks and positions of text blobs recently drawn entirely as direct masks.
+    std::unique_ptr<MaskCache> fMaskCache;
 };
 #endif  // SkGlyphRunPainter_DEFINED
@@ -7,6 +7,10 @@
 
 #include "include/core/SkGraphics.h"
 
+#include "include/core/SkExecutor.h"
+#include "include/core/SkFont.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkSurfaceProps.h"
 #include "src/core/SkBitmapProcState.h"
 #include "src/core/SkBlitMask.h"
 #include "src/core/SkBlitRow.h"
@@ -15,9 +19,15 @@
 #include "src/core/SkMemset.h"
 #include "src/core/SkOpts.h"
 #include "src/core/SkResourceCache.h"
+#include "src/core/SkRuntimeEffectPriv.h"
+#include "src/core/SkScalerContext.h"
 #include "src/core/SkStrikeCache.h"
 #include "src/core/SkSwizzlePriv.h"
 #include "src/core/SkTypefaceCache.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/SkSLProgramKind.h"
+
+#include <vector>
 
 void SkGraphics::Init() {
     // SkGraphics::Init() must be thread-safe and idempotent.
@@ -41,6 +51,7 @@ void SkGraphics::PurgeAllCaches() {
     SkGraphics::PurgeFontCache();
     SkGraphics::PurgeResourceCache();
     SkImageFilter_Base::PurgeCache();
+    SkGraphics::PurgeRuntimeEffectCache();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -69,6 +80,24 @@ int SkGraphics::GetFontCacheCountUsed() {
     return SkStrikeCache::GlobalStrikeCache()->getCacheCountUsed();
 }
 
+void SkGraphics::PrepopulateFontCache(const SkFont& font,
+                                      SkSpan<const SkGlyphID> glyphs,
+                                      const SkMatrix& matrix,
+                                      const SkSurfaceProps& surfaceProps,
+                                      SkExecutor* executor) {
+    // The same flags SkDevice::scalerContextFlags() picks for a surface without linear gamma.
+    constexpr SkScalerContextFlags kFlags = SkScalerContextFlags::kFakeGammaAndBoostContrast;
+    if (!executor) {
+        SkStrikeCache::GlobalStrikeCache()->prepopulate(font, glyphs, matrix, surfaceProps, kFlags);
+        return;
+    }
+    executor->add([font, glyphIDs = std::vector<SkGlyphID>(glyphs.begin(), glyphs.end()), matrix,
+                   surfaceProps] {
+        SkStrikeCache::GlobalStrikeCache()->prepopulate(
+                font, glyphIDs, matrix, surfaceProps, kFlags);
+    });
+}
+
 void SkGraphics::PurgeFontCache() {
     SkStrikeCache::GlobalStrikeCache()->purgeAll();
     SkTypefaceCache::PurgeAll();
@@ -78,6 +107,38 @@ void SkGraphics::PurgePinnedFontCache() {
     SkStrikeCache::GlobalStrikeCache()->purgePinned();
 }
 
+int SkGraphics::GetRuntimeEffectCacheCountLimit() {
+    return SkRuntimeEffectPriv::GetCacheCountLimit();
+}
+
+int SkGraphics::SetRuntimeEffectCacheCountLimit(int count) {
+    return SkRuntimeEffectPriv::SetCacheCountLimit(count);
+}
+
+void SkGraphics::PreloadSkSLModules() {
+    // Each program kind's module pulls in the modules it's built on.
+    static constexpr SkSL::ProgramKind kKinds[] = {
+        SkSL::ProgramKind::kRuntimeShader,
+        SkSL::ProgramKind::kPrivateRuntimeShader,
+#if defined(SK_GANESH) || defined(SK_GRAPHITE)
+        SkSL::ProgramKind::kVertex,
+        SkSL::ProgramKind::kFragment,
+#endif
+#if defined(SK_GRAPHITE)
+        SkSL::ProgramKind::kGraphiteVertex,
+        SkSL::ProgramKind::kGraphiteFragment,
+#endif
+    };
+    SkSL::Compiler compiler;
+    for (SkSL::ProgramKind kind : kKinds) {
+        compiler.moduleForProgramKind(kind);
+    }
+}
+
+void SkGraphics::PurgeRuntimeEffectCache() {
+    SkRuntimeEffectPriv::PurgeCache();
+}
+
 static SkGraphics::OpenTypeSVGDecoderFactory gSVGDecoderFactory = nullptr;
 
 SkGraphics::OpenTypeSVGDecoderFactory
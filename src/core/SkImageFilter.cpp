@@ -13,12 +13,15 @@
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPoint.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkTypeface.h"
 #include "include/core/SkTypes.h"
+#include "include/private/base/SkMutex.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTemplates.h"
 #include "src/core/SkImageFilterCache.h"
 #include "src/core/SkImageFilterTypes.h"
 #include "src/core/SkImageFilter_Base.h"
+#include "src/core/SkLRUCache.h"
 #include "src/core/SkLocalMatrixImageFilter.h"
 #include "src/core/SkPicturePriv.h"
 #include "src/core/SkReadBuffer.h"
@@ -32,6 +35,7 @@
 #include <atomic>
 #include <cstdint>
 #include <optional>
+#include <string>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +153,53 @@ static int32_t next_image_filter_unique_id() {
     return id;
 }
 
+namespace {
+
+// Flattens a filter graph into a structural fingerprint. Images and typefaces are written as their
+// unique IDs instead of their encoded contents, which is both cheaper and exactly what the cache
+// needs: a different image must produce a different fingerprint.
+class FingerprintWriteBuffer final : public SkBinaryWriteBuffer {
+public:
+    FingerprintWriteBuffer() : SkBinaryWriteBuffer({}) {}
+
+    void writeImage(const SkImage* image) override {
+        this->writeUInt(image ? image->uniqueID() : SK_InvalidUniqueID);
+    }
+
+    void writeTypeface(SkTypeface* typeface) override {
+        this->writeUInt(typeface ? typeface->uniqueID() : 0);
+    }
+};
+
+// Graphs with larger fingerprints (e.g. ones embedding big pictures) keep their unique ID.
+static constexpr size_t kMaxFingerprintSize = 16 * 1024;
+// Fingerprints outlive the filters that produced them so that a filter rebuilt with the same
+// parameters finds the ID (and cached results) of its predecessor.
+static constexpr int kMaxFingerprintCount = 256;
+
+uint32_t find_or_assign_cache_id(const SkImageFilter_Base* filter) {
+    FingerprintWriteBuffer buffer;
+    buffer.writeFlattenable(filter);
+    if (buffer.bytesWritten() > kMaxFingerprintSize) {
+        return filter->uniqueID();
+    }
+    std::string fingerprint(buffer.bytesWritten(), '\0');
+    buffer.writeToMemory(fingerprint.data());
+
+    static SkMutex mutex;
+    static SkLRUCache<std::string, uint32_t> fingerprints(kMaxFingerprintCount);
+
+    SkAutoMutexExclusive lock(mutex);
+    if (uint32_t* id = fingerprints.find(fingerprint)) {
+        return *id;
+    }
+    // Fingerprint IDs come from the same sequence as filter unique IDs, so they can't collide with
+    // graphs that fall back to their own unique IDs.
+    return *fingerprints.insert(std::move(fingerprint), next_image_filter_unique_id());
+}
+
+} // anonymous namespace
+
 SkImageFilter_Base::SkImageFilter_Base(sk_sp<SkImageFilter> const* inputs,
                                        int inputCount,
                                        std::optional<bool> usesSrc)
@@ -168,6 +219,11 @@ SkImageFilter_Base::~SkImageFilter_Base() {
     SkImageFilterCache::Get()->purgeByImageFilter(this);
 }
 
+uint32_t SkImageFilter_Base::cacheID() const {
+    fCacheIDOnce([this] { fCacheID = find_or_assign_cache_id(this); });
+    return fCacheID;
+}
+
 std::pair<sk_sp<SkImageFilter>, std::optional<SkRect>>
 SkImageFilter_Base::Unflatten(SkReadBuffer& buffer) {
     Common common;
@@ -251,7 +307,8 @@ skif::FilterResult SkImageFilter_Base::filterImage(const skif::Context& context)
     uint32_t srcGenID = srcInKey ? context.source().image()->uniqueID() : SK_InvalidUniqueID;
     const SkIRect srcSubset = srcInKey ? context.source().image()->subset() : SkIRect::MakeWH(0, 0);
 
-    SkImageFilterCacheKey key(fUniqueID,
+    const uint32_t cacheID = this->cacheID();
+    SkImageFilterCacheKey key(cacheID,
                               context.mapping().layerMatrix(),
                               SkIRect(context.desiredOutput()),
                               srcGenID, srcSubset);
@@ -262,7 +319,10 @@ skif::FilterResult SkImageFilter_Base::filterImage(const skif::Context& context)
     result = this->onFilterImage(context);
 
     if (context.backend()->cache()) {
-        context.backend()->cache()->set(key, this, result);
+        // Results shared by structurally identical filters must survive this filter's deletion,
+        // so they are only released by the cache's LRU policy.
+        const SkImageFilter* owner = cacheID == fUniqueID ? this : nullptr;
+        context.backend()->cache()->set(key, owner, result);
     }
 
     return result;
@@ -48,6 +48,12 @@ public:
         static uint32_t Hash(const Key& key) {
             return SkChecksum::Hash32(&key, sizeof(Key));
         }
+        // Hash of everything but the clip bounds, used to find results for larger clips.
+        static uint32_t UnclippedHash(const Key& key) {
+            Key unclipped = key;
+            unclipped.fClipBounds = SkIRect::MakeEmpty();
+            return Hash(unclipped);
+        }
         SK_DECLARE_INTERNAL_LLIST_INTERFACE(Value);
     };
 
@@ -55,7 +61,11 @@ public:
         SkASSERT(result);
 
         SkAutoMutexExclusive mutex(fMutex);
-        if (Value* v = fLookup.find(key)) {
+        Value* v = fLookup.find(key);
+        if (!v) {
+            v = this->findContainingClip(key);
+        }
+        if (v) {
             if (v != fLRU.head()) {
                 fLRU.remove(v);
                 fLRU.addToHead(v);
@@ -77,10 +87,18 @@ public:
         fLookup.add(v);
         fLRU.addToHead(v);
         fCurrentBytes += result.image() ? result.image()->getSize() : 0;
-        if (auto* values = fImageFilterValues.find(filter)) {
+        if (filter) {
+            if (auto* values = fImageFilterValues.find(filter)) {
+                values->push_back(v);
+            } else {
+                fImageFilterValues.set(filter, {v});
+            }
+        }
+        const uint32_t unclippedHash = Value::UnclippedHash(key);
+        if (auto* values = fUnclippedValues.find(unclippedHash)) {
             values->push_back(v);
         } else {
-            fImageFilterValues.set(filter, {v});
+            fUnclippedValues.set(unclippedHash, {v});
         }
 
         while (fCurrentBytes > fMaxBytes) {
@@ -119,21 +137,47 @@ public:
 
     SkDEBUGCODE(int count() const override { return fLookup.count(); })
 private:
-    void removeInternal(Value* v) {
-        if (v->fFilter) {
-            if (auto* values = fImageFilterValues.find(v->fFilter)) {
-                if (values->size() == 1 && (*values)[0] == v) {
-                    fImageFilterValues.remove(v->fFilter);
-                } else {
-                    for (auto it = values->begin(); it != values->end(); ++it) {
-                        if (*it == v) {
-                            values->erase(it);
-                            break;
-                        }
+    // A filter's result for a clip also covers any clip it contains, since the desired output only
+    // limits how much of the result is computed. This lets a lookup that moved or shrank within a
+    // previously filtered region reuse that result instead of refiltering.
+    Value* findContainingClip(const Key& key) const {
+        const auto* values = fUnclippedValues.find(Value::UnclippedHash(key));
+        if (!values) {
+            return nullptr;
+        }
+        for (Value* v : *values) {
+            if (v->fKey.fUniqueID == key.fUniqueID &&
+                v->fKey.fMatrix == key.fMatrix &&
+                v->fKey.fSrcGenID == key.fSrcGenID &&
+                v->fKey.fSrcSubset == key.fSrcSubset &&
+                v->fKey.fClipBounds.contains(key.fClipBounds)) {
+                return v;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename K>
+    static void RemoveValue(THashMap<K, std::vector<Value*>>& map, const K& key, Value* v) {
+        if (auto* values = map.find(key)) {
+            if (values->size() == 1 && (*values)[0] == v) {
+                map.remove(key);
+            } else {
+                for (auto it = values->begin(); it != values->end(); ++it) {
+                    if (*it == v) {
+                        values->erase(it);
+                        break;
                     }
                 }
             }
         }
+    }
+
+    void removeInternal(Value* v) {
+        if (v->fFilter) {
+            RemoveValue(fImageFilterValues, v->fFilter, v);
+        }
+        RemoveValue(fUnclippedValues, Value::UnclippedHash(v->fKey), v);
         fCurrentBytes -= v->fImage.image() ? v->fImage.image()->getSize() : 0;
         fLRU.remove(v);
         fLookup.remove(v->fKey);
@@ -144,6 +188,8 @@ private:
     mutable SkTInternalLList<Value>                     fLRU;
     // Value* always points to an item in fLookup.
     THashMap<const SkImageFilter*, std::vector<Value*>> fImageFilterValues;
+    // Value* always points to an item in fLookup, grouped by Value::UnclippedHash().
+    THashMap<uint32_t, std::vector<Value*>>             fUnclippedValues;
     size_t                                              fMaxBytes;
     size_t                                              fCurrentBytes;
     mutable SkMutex                                     fMutex;
@@ -51,9 +51,11 @@ struct SkImageFilterCacheKey {
     }
 };
 
-// This cache maps from (filter's unique ID + CTM + clipBounds + src bitmap generation ID) to result
-// NOTE: this is the _specific_ unique ID of the image filter, so refiltering the same image with a
-// copy of the image filter (with exactly the same parameters) will not yield a cache hit.
+// This cache maps from (filter's cache ID + CTM + clipBounds + src bitmap generation ID) to result.
+// The cache ID is shared by structurally identical filter graphs (see
+// SkImageFilter_Base::cacheID()), so a copy of an image filter with exactly the same parameters
+// will hit results computed for the original. A lookup whose clipBounds are contained in those of
+// an existing entry (with otherwise equal keys) returns that entry's larger result.
 class SkImageFilterCache : public SkRefCnt {
 public:
     static constexpr size_t kDefaultTransientSize = 32 * 1024 * 1024;
@@ -67,7 +69,8 @@ public:
     virtual bool get(const SkImageFilterCacheKey& key,
                      skif::FilterResult* result) const = 0;
     // 'filter' is included in the caching to allow the purging of all of an image filter's cached
-    // results when it is destroyed.
+    // results when it is destroyed. It may be null for results that should outlive the filter
+    // that produced them, which are then only removed by the cache's size limit or purge().
     virtual void set(const SkImageFilterCacheKey& key, const SkImageFilter* filter,
                      const skif::FilterResult& result) = 0;
     virtual void purge() = 0;
@@ -387,6 +387,10 @@ public:
     }
 
     const SkBlurEngine* getBlurEngine() const override { return nullptr; }
+
+    // Each 8888 intermediate of a tile is then about 4MB, and the allocator can hand the buffers
+    // freed by one tile straight to the next one.
+    int tileSize() const override { return 1024; }
 };
 
 } // anonymous namespace
@@ -1026,6 +1026,11 @@ public:
     // TODO: Once all Backends provide a blur engine, maybe just have Backend extend it.
     virtual const SkBlurEngine* getBlurEngine() const = 0;
 
+    // The smallest tiles to evaluate large desired outputs in, so that intermediate images are
+    // bounded by a tile (and the filters' halos around it) instead of the whole output. 0 if the
+    // backend evaluates every output all at once.
+    virtual int tileSize() const { return 0; }
+
     // Properties controlling the pixel data for offscreen surfaces rendered to during filtering.
     const SkSurfaceProps& surfaceProps() const { return fSurfaceProps; }
     SkColorType colorType() const { return fColorType; }
@@ -11,6 +11,7 @@
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkImageInfo.h"
+#include "include/private/base/SkOnce.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTemplates.h"
 
@@ -129,6 +130,12 @@ public:
 
     uint32_t uniqueID() const { return fUniqueID; }
 
+    // Returns the ID used to key this filter's results in SkImageFilterCache. Structurally
+    // identical filter graphs (same types, parameters, and referenced image IDs) share a cache ID
+    // even when they are distinct objects, so rebuilt filter chains can reuse earlier results.
+    // Graphs that are too large to fingerprint cheaply fall back to uniqueID().
+    uint32_t cacheID() const;
+
     static SkFlattenable::Type GetFlattenableType() {
         return kSkImageFilter_Type;
     }
@@ -304,6 +311,9 @@ private:
     bool fUsesSrcInput;
     uint32_t fUniqueID; // Globally unique
 
+    mutable SkOnce fCacheIDOnce;
+    mutable uint32_t fCacheID = 0;
+
     using INHERITED = SkImageFilter;
 };
 
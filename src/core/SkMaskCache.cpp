@@ -11,6 +11,7 @@
 #include "include/core/SkRect.h"
 #include "include/core/SkSize.h"
 #include "include/private/base/SkAssert.h"
+#include "include/private/base/SkOnce.h"
 #include "src/base/SkTLazy.h"
 #include "src/core/SkCachedData.h"
 #include "src/core/SkMask.h"
@@ -30,6 +31,18 @@ struct MaskValue {
     SkCachedData*   fData;
 };
 
+// Blur masks are cheap to regenerate and a busy client (e.g. animated shadows) can produce a lot
+// of them, so each mask namespace is limited to a share of the global cache instead of being able
+// to evict decoded images. The limit is taken from the total budget when the first mask is added.
+static constexpr size_t kGlobalBudgetDivisor = 4;
+
+static void set_global_namespace_limit(SkOnce* once, void* nameSpace) {
+    (*once)([nameSpace] {
+        SkResourceCache::SetNamespaceByteLimit(
+                nameSpace, SkResourceCache::GetTotalByteLimit() / kGlobalBudgetDivisor);
+    });
+}
+
 namespace {
 static unsigned gRRectBlurKeyNamespaceLabel;
 
@@ -103,6 +116,10 @@ void SkMaskCache::Add(SkScalar sigma, SkBlurStyle style,
                       const SkRRect& rrect, const SkMask& mask, SkCachedData* data,
                       SkResourceCache* localCache) {
     RRectBlurKey key(sigma, rrect, style);
+    if (!localCache) {
+        static SkOnce once;
+        set_global_namespace_limit(&once, &gRRectBlurKeyNamespaceLabel);
+    }
     return CHECK_LOCAL(localCache, add, Add, new RRectBlurRec(key, mask, data));
 }
 
@@ -193,5 +210,9 @@ void SkMaskCache::Add(SkScalar sigma, SkBlurStyle style,
                       const SkRect rects[], int count, const SkMask& mask, SkCachedData* data,
                       SkResourceCache* localCache) {
     RectsBlurKey key(sigma, style, rects, count);
+    if (!localCache) {
+        static SkOnce once;
+        set_global_namespace_limit(&once, &gRectsBlurKeyNamespaceLabel);
+    }
     return CHECK_LOCAL(localCache, add, Add, new RectsBlurRec(key, mask, data));
 }
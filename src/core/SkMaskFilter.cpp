@@ -234,6 +234,9 @@ bool SkMaskFilterBase::filterPath(const SkPath& devPath, const SkMatrix& matrix,
     if (SkStrokeRec::kFill_InitStyle == style) {
         rectCount = countNestedRects(devPath, rects);
     }
+    if (1 == rectCount && this->filterRectDirect(rects[0], matrix, clip, blitter)) {
+        return true;
+    }
     if (rectCount > 0) {
         SkTLazy<NinePatch> patch;
 
@@ -296,6 +299,11 @@ SkMaskFilterBase::filterRRectToNine(const SkRRect&, const SkMatrix&,
     return kUnimplemented_FilterReturn;
 }
 
+bool SkMaskFilterBase::filterRectDirect(const SkRect&, const SkMatrix&, const SkRasterClip&,
+                                        SkBlitter*) const {
+    return false;
+}
+
 SkMaskFilterBase::FilterReturn
 SkMaskFilterBase::filterRectsToNine(const SkRect[], int count, const SkMatrix&,
                                     const SkIRect& clipBounds, SkTLazy<NinePatch>*) const {
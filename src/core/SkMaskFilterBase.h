@@ -160,6 +160,15 @@ protected:
                                            const SkIRect& clipBounds,
                                            SkTLazy<NinePatch>*) const;
 
+    /**
+     *  Override if your subclass can filter a single filled rect and blit the result straight
+     *  to the blitter, computing each row's coverage as it goes rather than building a mask
+     *  (or ninepatch) first. Return true if the rect was drawn; return false (the default) to
+     *  have filterRectsToNine() and then filterMask() tried instead.
+     */
+    virtual bool filterRectDirect(const SkRect&, const SkMatrix&, const SkRasterClip&,
+                                  SkBlitter*) const;
+
 private:
     friend class SkDraw;
     friend class SkDrawBase;
@@ -110,6 +110,9 @@ SkMipmapAccessor::SkMipmapAccessor(const SkImage_Base* image, const SkMatrix& in
 
 SkMipmapAccessor* SkMipmapAccessor::Make(SkArenaAlloc* alloc, const SkImage* image,
                                          const SkMatrix& inv, SkMipmapMode mipmap) {
+    if (as_IB(image)->skipRasterDraws()) {
+        return nullptr;
+    }
     auto* access = alloc->make<SkMipmapAccessor>(as_IB(image), inv, mipmap);
     // return null if we failed to get the level (so the caller won't try to use it)
     return access->fUpper.addr() ? access : nullptr;
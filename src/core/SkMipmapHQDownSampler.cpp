@@ -13,6 +13,9 @@
 #include "src/base/SkHalf.h"
 #include "src/base/SkVx.h"
 #include "src/core/SkMipmap.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
 
 namespace {
 
@@ -257,6 +260,57 @@ template <typename F> void downsample_2_2(void* dst, const void* src, size_t src
     }
 }
 
+// The 2x2 box filter is the common case for every level of a power-of-two image, so 8888 and F16
+// have wide versions that filter several dst pixels per iteration with skvx (SSE/AVX2/NEON). They
+// sum in the same order as downsample_2_2() so their results are bit-identical.
+void downsample_2_2_8888(void* dst, const void* src, size_t srcRB, int count) {
+    SkASSERT(count > 0);
+    auto p0 = static_cast<const uint32_t*>(src);
+    auto p1 = (const uint32_t*)((const char*)p0 + srcRB);
+    auto d = static_cast<uint32_t*>(dst);
+
+    // 8 src pixels from each row -> 4 dst pixels
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        auto r0 = skvx::cast<uint16_t>(skvx::Vec<32, uint8_t>::Load(p0));
+        auto r1 = skvx::cast<uint16_t>(skvx::Vec<32, uint8_t>::Load(p1));
+        auto c = r0 + r1;
+        auto even = skvx::shuffle<0,1,2,3,  8, 9,10,11, 16,17,18,19, 24,25,26,27>(c);
+        auto odd  = skvx::shuffle<4,5,6,7, 12,13,14,15, 20,21,22,23, 28,29,30,31>(c);
+        skvx::cast<uint8_t>((even + odd) >> 2).store(d + i);
+        p0 += 8;
+        p1 += 8;
+    }
+    if (i < count) {
+        downsample_2_2<ColorTypeFilter_8888>(d + i, p0, srcRB, count - i);
+    }
+}
+
+void downsample_2_2_RGBA_F16(void* dst, const void* src, size_t srcRB, int count) {
+    SkASSERT(count > 0);
+    auto p0 = static_cast<const uint64_t*>(src);
+    auto p1 = (const uint64_t*)((const char*)p0 + srcRB);
+    auto d = static_cast<uint64_t*>(dst);
+
+    // 4 src pixels from each row -> 2 dst pixels
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        auto r0 = skvx::from_half(skvx::Vec<16, uint16_t>::Load(p0));
+        auto r1 = skvx::from_half(skvx::Vec<16, uint16_t>::Load(p1));
+        auto even0 = skvx::shuffle<0,1,2,3,  8, 9,10,11>(r0);
+        auto odd0  = skvx::shuffle<4,5,6,7, 12,13,14,15>(r0);
+        auto even1 = skvx::shuffle<0,1,2,3,  8, 9,10,11>(r1);
+        auto odd1  = skvx::shuffle<4,5,6,7, 12,13,14,15>(r1);
+        auto c = even0 + even1 + odd0 + odd1;
+        skvx::to_half(c * 0.25f).store(d + i);
+        p0 += 4;
+        p1 += 4;
+    }
+    if (i < count) {
+        downsample_2_2<ColorTypeFilter_RGBA_F16>(d + i, p0, srcRB, count - i);
+    }
+}
+
 template <typename F> void downsample_2_3(void* dst, const void* src, size_t srcRB, int count) {
     SkASSERT(count > 0);
     auto p0 = static_cast<const typename F::Type*>(src);
@@ -424,15 +478,33 @@ void HQDownSampler::buildLevel(const SkPixmap& dst, const SkPixmap& src) {
         }
     }
 
-    const void* srcBasePtr = src.addr();
     const size_t srcRB = src.rowBytes();
-    void* dstBasePtr = dst.writable_addr();
-
-    for (int y = 0; y < dst.height(); y++) {
-        proc(dstBasePtr, srcBasePtr, srcRB, dst.width());
-        srcBasePtr = (const char*)srcBasePtr + srcRB * 2; // jump two rows
-        dstBasePtr = (      char*)dstBasePtr + dst.rowBytes();
-    }
+    auto filterRows = [&](int startY, int endY) {
+        const void* srcBasePtr = (const char*)src.addr() + srcRB * 2 * startY;
+        void* dstBasePtr = (char*)dst.writable_addr() + dst.rowBytes() * startY;
+
+        for (int y = startY; y < endY; y++) {
+            proc(dstBasePtr, srcBasePtr, srcRB, dst.width());
+            srcBasePtr = (const char*)srcBasePtr + srcRB * 2; // jump two rows
+            dstBasePtr = (      char*)dstBasePtr + dst.rowBytes();
+        }
+    };
+
+    // Each dst row only reads its own src rows, so large levels are split into bands of rows that
+    // are filtered concurrently on the default executor. Small levels aren't worth the overhead.
+    static constexpr int kMinPixelsPerBand = 1 << 16;
+    const int dstHeight = dst.height();
+    const int rowsPerBand = std::max(1, kMinPixelsPerBand / dst.width());
+    const int bandCount = (dstHeight + rowsPerBand - 1) / rowsPerBand;
+    if (bandCount <= 1) {
+        filterRows(0, dstHeight);
+        return;
+    }
+
+    SkTaskGroup().batch(bandCount, [&](int band) {
+        const int startY = band * rowsPerBand;
+        filterRows(startY, std::min(startY + rowsPerBand, dstHeight));
+    });
 }
 
 } // namespace
@@ -453,7 +525,7 @@ std::unique_ptr<SkMipmapDownSampler> SkMipmap::MakeDownSampler(const SkPixmap& r
             proc_1_2 = downsample_1_2<ColorTypeFilter_8888>;
             proc_1_3 = downsample_1_3<ColorTypeFilter_8888>;
             proc_2_1 = downsample_2_1<ColorTypeFilter_8888>;
-            proc_2_2 = downsample_2_2<ColorTypeFilter_8888>;
+            proc_2_2 = downsample_2_2_8888;
             proc_2_3 = downsample_2_3<ColorTypeFilter_8888>;
             proc_3_1 = downsample_3_1<ColorTypeFilter_8888>;
             proc_3_2 = downsample_3_2<ColorTypeFilter_8888>;
@@ -496,7 +568,7 @@ std::unique_ptr<SkMipmapDownSampler> SkMipmap::MakeDownSampler(const SkPixmap& r
             proc_1_2 = downsample_1_2<ColorTypeFilter_RGBA_F16>;
             proc_1_3 = downsample_1_3<ColorTypeFilter_RGBA_F16>;
             proc_2_1 = downsample_2_1<ColorTypeFilter_RGBA_F16>;
-            proc_2_2 = downsample_2_2<ColorTypeFilter_RGBA_F16>;
+            proc_2_2 = downsample_2_2_RGBA_F16;
             proc_2_3 = downsample_2_3<ColorTypeFilter_RGBA_F16>;
             proc_3_1 = downsample_3_1<ColorTypeFilter_RGBA_F16>;
             proc_3_2 = downsample_3_2<ColorTypeFilter_RGBA_F16>;
@@ -11,6 +11,7 @@
 #ifndef SkOSFile_DEFINED
 #define SkOSFile_DEFINED
 
+#include <stdint.h>
 #include <stdio.h>
 
 #include "include/core/SkString.h"
@@ -66,6 +67,10 @@ bool    sk_exists(const char *path, SkFILE_Flags = (SkFILE_Flags)0);
 // Returns true if a directory exists at this path.
 bool    sk_isdir(const char *path);
 
+// Returns true if something exists at this path, along with its size in bytes and the time it
+// was last modified, in seconds since the epoch.
+bool    sk_stat(const char* path, uint64_t* size, int64_t* modifiedTime);
+
 // Like pread, but may affect the file position marker.
 // Returns the number of bytes read or SIZE_MAX if failed.
 size_t sk_qread(FILE*, void* buffer, size_t count, size_t offset);
@@ -241,6 +241,13 @@ void SkOverdrawCanvas::onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4
     }
 }
 
+void SkOverdrawCanvas::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[],
+                                           int count, const int matrixIndices[],
+                                           const SkMatrix preViewMatrices[], QuadAAFlags aa,
+                                           SkBlendMode mode) {
+    this->drawEdgeAARectSetAsQuads(rects, colors, count, matrixIndices, preViewMatrices, aa, mode);
+}
+
 void SkOverdrawCanvas::onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count,
                                              const SkPoint dstClips[],
                                              const SkMatrix preViewMatrices[],
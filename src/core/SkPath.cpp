@@ -2155,39 +2155,70 @@ struct Convexicator {
             return SkPathConvexity::kConvex;
         }
 
-        const SkPoint* last = points + count;
-        SkPoint currPt = *points++;
-        SkPoint firstPt = currPt;
+        SkPathConvexity result = SkPathConvexity::kConvex;  // that is, it may be convex
         int dxes = 0;
         int dyes = 0;
         int lastSx = kValueNeverReturnedBySign;
         int lastSy = kValueNeverReturnedBySign;
-        for (int outerLoop = 0; outerLoop < 2; ++outerLoop ) {
-            while (points != last) {
-                SkVector vec = *points - currPt;
-                if (!vec.isZero()) {
-                    // give up if vector construction failed
-                    if (!vec.isFinite()) {
-                        return SkPathConvexity::kUnknown;
-                    }
-                    int sx = sign(vec.fX);
-                    int sy = sign(vec.fY);
-                    dxes += (sx != lastSx);
-                    dyes += (sy != lastSy);
-                    if (dxes > 3 || dyes > 3) {
-                        return SkPathConvexity::kConcave;
-                    }
-                    lastSx = sx;
-                    lastSy = sy;
+        auto addVec = [&](const SkVector& vec) {
+            if (!vec.isZero()) {
+                // give up if vector construction failed
+                if (!vec.isFinite()) {
+                    result = SkPathConvexity::kUnknown;
+                    return false;
                 }
-                currPt = *points++;
-                if (outerLoop) {
-                    break;
+                int sx = sign(vec.fX);
+                int sy = sign(vec.fY);
+                dxes += (sx != lastSx);
+                dyes += (sy != lastSy);
+                if (dxes > 3 || dyes > 3) {
+                    result = SkPathConvexity::kConcave;
+                    return false;
                 }
+                lastSx = sx;
+                lastSy = sy;
+            }
+            return true;
+        };
+
+        // Count the sign changes of four edge vectors at a time. Blocks that contain a zero or
+        // non-finite vector are rare and take the scalar path, which skips or rejects them.
+        int i = 0;
+        for (; i + 4 < count; i += 4) {
+            skvx::float8 vecs = skvx::float8::Load(&points[i + 1].fX) -
+                                skvx::float8::Load(&points[i].fX);
+            auto zero = vecs == 0;
+            if (any(zero & skvx::shuffle<1,0,3,2,5,4,7,6>(zero)) || !all(vecs * 0 == 0)) {
+                for (int j = i; j < i + 4; ++j) {
+                    if (!addVec(points[j + 1] - points[j])) {
+                        return result;
+                    }
+                }
+                continue;
+            }
+            skvx::int8 signs = skvx::cast<int>(vecs < 0) & 1;
+            skvx::int8 prevSigns = skvx::shuffle<0,0,0,1,2,3,4,5>(signs);
+            prevSigns[0] = lastSx;
+            prevSigns[1] = lastSy;
+            skvx::int8 changes = skvx::cast<int>(signs != prevSigns) & 1;
+            skvx::int4 xChanges = skvx::shuffle<0,2,4,6>(changes);
+            skvx::int4 yChanges = skvx::shuffle<1,3,5,7>(changes);
+            dxes += xChanges[0] + xChanges[1] + xChanges[2] + xChanges[3];
+            dyes += yChanges[0] + yChanges[1] + yChanges[2] + yChanges[3];
+            if (dxes > 3 || dyes > 3) {
+                return SkPathConvexity::kConcave;
             }
-            points = &firstPt;
+            lastSx = signs[6];
+            lastSy = signs[7];
         }
-        return SkPathConvexity::kConvex;  // that is, it may be convex, don't know yet
+        for (; i + 1 < count; ++i) {
+            if (!addVec(points[i + 1] - points[i])) {
+                return result;
+            }
+        }
+        // the closing edge back to the first point
+        addVec(points[0] - points[count - 1]);
+        return result;
     }
 
     bool close() {
@@ -2263,9 +2294,28 @@ private:
 };
 
 SkPathConvexity SkPath::computeConvexity() const {
+    static_assert((uint8_t)SkPathConvexity::kUnknown == SkPathRef::kUnknownAnalysis);
+    static_assert((uint8_t)SkPathFirstDirection::kUnknown == SkPathRef::kUnknownAnalysis);
+
+    // Another SkPath sharing our points and verbs may have already done the work.
+    auto cachedConvexity = (SkPathConvexity)fPathRef->getCachedConvexity();
+    if (cachedConvexity != SkPathConvexity::kUnknown) {
+        if (cachedConvexity == SkPathConvexity::kConvex &&
+            this->getFirstDirection() == SkPathFirstDirection::kUnknown) {
+            this->setFirstDirection((SkPathFirstDirection)fPathRef->getCachedFirstDirection());
+        }
+        this->setConvexity(cachedConvexity);
+        return cachedConvexity;
+    }
+
     auto setComputedConvexity = [=](SkPathConvexity convexity){
         SkASSERT(SkPathConvexity::kUnknown != convexity);
         this->setConvexity(convexity);
+        if (convexity == SkPathConvexity::kConvex) {
+            // The first direction of a convex path is only ever computed along with its convexity.
+            fPathRef->setCachedFirstDirection((uint8_t)this->getFirstDirection());
+        }
+        fPathRef->setCachedConvexity((uint8_t)convexity);
         return convexity;
     };
 
@@ -2470,7 +2520,27 @@ static int find_max_y(const SkPoint pts[], int count) {
     SkASSERT(count > 0);
     SkScalar max = pts[0].fY;
     int firstIndex = 0;
-    for (int i = 1; i < count; ++i) {
+    int i = 1;
+    if (count > 8) {
+        // Track the first maximum seen by each of four lanes, then pick the earliest of the
+        // lanes that hold the overall maximum.
+        skvx::float4 laneMax = max;
+        skvx::int4 laneIndex = 0;
+        skvx::int4 index = {1, 2, 3, 4};
+        for (; i + 4 <= count; i += 4, index += 4) {
+            skvx::float4 y = skvx::shuffle<1,3,5,7>(skvx::float8::Load(&pts[i].fX));
+            auto greater = y > laneMax;
+            laneMax = if_then_else(greater, y, laneMax);
+            laneIndex = if_then_else(greater, index, laneIndex);
+        }
+        for (int lane = 0; lane < 4; ++lane) {
+            if (laneMax[lane] > max || (laneMax[lane] == max && laneIndex[lane] < firstIndex)) {
+                max = laneMax[lane];
+                firstIndex = laneIndex[lane];
+            }
+        }
+    }
+    for (; i < count; ++i) {
         SkScalar y = pts[i].fY;
         if (y > max) {
             max = y;
@@ -2547,6 +2617,12 @@ SkPathFirstDirection SkPathPriv::ComputeFirstDirection(const SkPath& path) {
         return d;
     }
 
+    d = (SkPathFirstDirection)path.fPathRef->getCachedFirstDirection();
+    if (d != SkPathFirstDirection::kUnknown) {
+        path.setFirstDirection(d);
+        return d;
+    }
+
     ContourIter iter(*path.fPathRef);
 
     // initialize with our logical y-min
@@ -2617,6 +2693,7 @@ SkPathFirstDirection SkPathPriv::ComputeFirstDirection(const SkPath& path) {
     if (ymaxCross) {
         d = crossToDir(ymaxCross);
         path.setFirstDirection(d);
+        path.fPathRef->setCachedFirstDirection((uint8_t)d);
     }
     return d;   // may still be kUnknown
 }
@@ -2918,6 +2995,64 @@ static int winding_line(const SkPoint pts[], SkScalar x, SkScalar y, int* onCurv
     return dir;
 }
 
+// Buffers line segments so that the common case of a point that lies on none of them can be
+// tested against four lines at a time. Any batch where a line might pass through the point is
+// handed to winding_line(), which tracks the on-curve count.
+class LineWindingBatch {
+public:
+    LineWindingBatch(SkScalar x, SkScalar y) : fX(x), fY(y) {}
+
+    void add(const SkPoint pts[2], int* winding, int* onCurveCount) {
+        fPts[fCount][0] = pts[0];
+        fPts[fCount][1] = pts[1];
+        if (++fCount == 4) {
+            this->flush(winding, onCurveCount);
+        }
+    }
+
+    void flush(int* winding, int* onCurveCount) {
+        if (fCount < 4 || !this->windingOfFour(winding)) {
+            for (int i = 0; i < fCount; ++i) {
+                *winding += winding_line(fPts[i], fX, fY, onCurveCount);
+            }
+        }
+        fCount = 0;
+    }
+
+private:
+    // Mirrors winding_line() for four lines, returning false without accumulating anything if
+    // the point might be on one of them.
+    bool windingOfFour(int* winding) const {
+        // Each row of fPts is x0, y0, x1, y1.
+        skvx::float4 x0, y0, x1, y1;
+        skvx::strided_load4(&fPts[0][0].fX, x0, y0, x1, y1);
+
+        skvx::float4 dy = y1 - y0;
+        auto down = y0 > y1;
+        skvx::int4 dir = if_then_else(down, skvx::int4(-1), skvx::int4(1));
+        skvx::float4 lo = if_then_else(down, y1, y0);
+        skvx::float4 hi = if_then_else(down, y0, y1);
+        auto inRange = (fY >= lo) & (fY <= hi);
+        auto onCurve = if_then_else(y0 == y1,
+                                    ((x0 - fX) * (x1 - fX) <= 0) & (x1 != fX),
+                                    (x0 == fX) & (y0 == fY));
+        auto crosses = inRange & (hi != fY);
+        skvx::float4 cross = (x1 - x0) * (fY - y0) - dy * (fX - x0);
+        auto crossNegative = cross < 0;
+        if (any(inRange & onCurve) || any(crosses & ~(crossNegative | (cross > 0)))) {
+            return false;
+        }
+        skvx::int4 crossSign = if_then_else(crossNegative, skvx::int4(-1), skvx::int4(1));
+        skvx::int4 w = if_then_else(crosses & (crossSign != dir), dir, skvx::int4(0));
+        *winding += w[0] + w[1] + w[2] + w[3];
+        return true;
+    }
+
+    const SkScalar fX, fY;
+    SkPoint fPts[4][2];
+    int fCount = 0;
+};
+
 static void tangent_cubic(const SkPoint pts[], SkScalar x, SkScalar y,
         SkTDArray<SkVector>* tangents) {
     if (!between(pts[0].fY, y, pts[1].fY) && !between(pts[1].fY, y, pts[2].fY)
@@ -3039,6 +3174,7 @@ bool SkPath::contains(SkScalar x, SkScalar y) const {
     bool done = false;
     int w = 0;
     int onCurveCount = 0;
+    LineWindingBatch lines(x, y);
     do {
         SkPoint pts[4];
         switch (iter.next(pts)) {
@@ -3046,7 +3182,7 @@ bool SkPath::contains(SkScalar x, SkScalar y) const {
             case SkPath::kClose_Verb:
                 break;
             case SkPath::kLine_Verb:
-                w += winding_line(pts, x, y, &onCurveCount);
+                lines.add(pts, &w, &onCurveCount);
                 break;
             case SkPath::kQuad_Verb:
                 w += winding_quad(pts, x, y, &onCurveCount);
@@ -3058,6 +3194,7 @@ bool SkPath::contains(SkScalar x, SkScalar y) const {
                 w += winding_cubic(pts, x, y, &onCurveCount);
                 break;
             case SkPath::kDone_Verb:
+                lines.flush(&w, &onCurveCount);
                 done = true;
                 break;
        }
@@ -235,7 +235,20 @@ SkPath SkPathBuilder::snapshot() const {
                                                      fSegmentMask)));
 }
 
+// Growth and overestimated incReserve() calls can leave a large path with a lot of unused
+// capacity. The arrays resize with realloc(), so returning it doesn't copy the points.
+template <typename Array> static void trim_excess(Array* array) {
+    constexpr size_t kMinExcessBytes = 4096;
+    const size_t excess = array->capacity() - array->size();
+    if (excess * sizeof((*array)[0]) >= kMinExcessBytes && excess > (size_t)array->size() / 8) {
+        array->shrink_to_fit();
+    }
+}
+
 SkPath SkPathBuilder::detach() {
+    trim_excess(&fPts);
+    trim_excess(&fVerbs);
+    trim_excess(&fConicWeights);
     auto path = this->make(sk_sp<SkPathRef>(new SkPathRef(std::move(fPts),
                                                           std::move(fVerbs),
                                                           std::move(fConicWeights),
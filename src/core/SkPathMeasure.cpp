@@ -61,3 +61,7 @@ size_t SkPathMeasurePriv::CountSegments(const SkPathMeasure& meas) {
     }
     return 0;
 }
+
+size_t SkPathMeasurePriv::ApproximateBytesUsed(const SkContourMeasure& cntr) {
+    return sizeof(cntr) + cntr.fSegments.size_bytes() + cntr.fPts.size_bytes();
+}
@@ -28,11 +28,15 @@ void SkPathMeasure_segTo(const SkPoint pts[], unsigned segType,
 
 // for testing
 
+class SkContourMeasure;
 class SkPathMeasure;
 
 class SkPathMeasurePriv {
 public:
     static size_t CountSegments(const SkPathMeasure&);
+
+    // How much memory the contour's segment and point tables take up.
+    static size_t ApproximateBytesUsed(const SkContourMeasure&);
 };
 
 #endif  // SkPathMeasurePriv_DEFINED
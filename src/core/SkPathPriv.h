@@ -19,6 +19,7 @@
 #include "include/private/SkIDChangeListener.h"
 #include "include/private/SkPathRef.h"
 #include "include/private/base/SkDebug.h"
+#include "include/private/base/SkTDArray.h"
 #include "src/core/SkPathEnums.h"
 
 #include <cstdint>
@@ -415,6 +416,7 @@ public:
     }
     static void ForceComputeConvexity(const SkPath& path) {
         path.setConvexity(SkPathConvexity::kUnknown);
+        path.fPathRef->setCachedConvexity(SkPathRef::kUnknownAnalysis);
         (void)path.isConvex();
     }
 
@@ -432,6 +434,15 @@ public:
         return SkPath::MakeInternal(analysis, points, verbs, verbCount, conics, fillType,
                                     isVolatile);
     }
+
+    // A denser alternative to SkPath::writeToMemory(), used for the path tables in SKPs. Counts
+    // are varints, and each coordinate is stored as the difference of its bits from the previous
+    // point's. The encoding is byte-aligned, and appended to dst.
+    static void WriteCompact(const SkPath&, SkTDArray<uint8_t>* dst);
+
+    // Reads a path written by WriteCompact() from [src, stop). Returns a pointer just past it, or
+    // nullptr if the data is invalid.
+    static const uint8_t* ReadCompact(const uint8_t* src, const uint8_t* stop, SkPath*);
 };
 
 // Lightweight variant of SkPath::Iter that only returns segments (e.g. lines/conics).
@@ -50,6 +50,7 @@ SkPathRef::Editor::Editor(sk_sp<SkPathRef>* pathRef,
     fPathRef->callGenIDChangeListeners();
     fPathRef->fGenerationID = 0;
     fPathRef->fBoundsIsDirty = true;
+    fPathRef->resetAnalyses();
     SkDEBUGCODE(fPathRef->fEditorsAttached++;)
 }
 
@@ -198,6 +199,7 @@ void SkPathRef::CreateTransformedCopy(sk_sp<SkPathRef>* dst,
     }
 
     (*dst)->fSegmentMask = src.fSegmentMask;
+    (*dst)->resetAnalyses();
 
     // It's an oval only if it stays a rect.
     bool rectStaysRect = matrix.rectStaysRect();
@@ -231,6 +233,7 @@ void SkPathRef::Rewind(sk_sp<SkPathRef>* pathRef) {
         (*pathRef)->fSegmentMask = 0;
         (*pathRef)->fIsOval = false;
         (*pathRef)->fIsRRect = false;
+        (*pathRef)->resetAnalyses();
         SkDEBUGCODE((*pathRef)->validate();)
     } else {
         int oldVCnt = (*pathRef)->countVerbs();
@@ -299,6 +302,7 @@ void SkPathRef::interpolate(const SkPathRef& ending, SkScalar weight, SkPathRef*
     out->fBoundsIsDirty = true;
     out->fIsOval = false;
     out->fIsRRect = false;
+    out->resetAnalyses();
 }
 
 std::tuple<SkPoint*, SkScalar*> SkPathRef::growForVerbsInPath(const SkPathRef& path) {
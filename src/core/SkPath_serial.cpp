@@ -7,8 +7,11 @@
 
 #include "include/core/SkData.h"
 #include "include/private/SkPathRef.h"
+#include "include/private/base/SkFloatBits.h"
 #include "include/private/base/SkMath.h"
+#include "include/private/base/SkTDArray.h"
 #include "include/private/base/SkTPin.h"
+#include "include/private/base/SkTemplates.h"
 #include "include/private/base/SkTo.h"
 #include "src/base/SkAutoMalloc.h"
 #include "src/base/SkBuffer.h"
@@ -18,6 +21,9 @@
 #include "src/core/SkRRectPriv.h"
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 
 enum SerializationOffsets {
     kType_SerializationShift = 28,       // requires 4 bits
@@ -260,3 +266,131 @@ size_t SkPath::readFromMemory_EQ4Or5(const void* storage, size_t length) {
                                  extract_filltype(packed), false);
     return buffer.pos();
 }
+
+//////////////////////////////////////////////////////////////////////////////////////////////////
+// compact form
+//
+// A leading byte holds the fill type and which form follows:
+//   kGeneral: the verb count as a varint, the verbs, then the x and y of each point as zigzag
+//             varints of the difference of their bits from the previous point's, then the conic
+//             weights. The point and weight counts follow from the verbs.
+//   kRRect:   the writeToMemory() form, prefixed by its size as a varint, so ovals and rrects
+//             are still recognized as such after reading.
+
+static void write_varint(uint32_t v, SkTDArray<uint8_t>* dst) {
+    while (v >= 0x80) {
+        dst->push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    dst->push_back((uint8_t)v);
+}
+
+static const uint8_t* read_varint(const uint8_t* src, const uint8_t* stop, uint32_t* v) {
+    *v = 0;
+    for (int shift = 0; shift < 35 && src < stop; shift += 7) {
+        const uint8_t byte = *src++;
+        *v |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return src;
+        }
+    }
+    return nullptr;
+}
+
+void SkPathPriv::WriteCompact(const SkPath& path, SkTDArray<uint8_t>* dst) {
+    const uint8_t fillType = (uint8_t)path.getFillType();
+
+    if (size_t bytes = path.writeToMemoryAsRRect(nullptr)) {
+        dst->push_back(fillType | (SerializationType::kRRect << 4));
+        write_varint(SkToU32(bytes), dst);
+        path.writeToMemoryAsRRect(dst->append(SkToInt(bytes)));
+        return;
+    }
+
+    const SkPathRef* ref = path.fPathRef.get();
+    dst->push_back(fillType | (SerializationType::kGeneral << 4));
+    write_varint(SkToU32(ref->countVerbs()), dst);
+    memcpy(dst->append(ref->countVerbs()), ref->verbsBegin(), ref->countVerbs());
+
+    uint32_t prev[2] = {0, 0};
+    const SkPoint* pts = ref->points();
+    for (int n = 0; n < ref->countPoints(); ++n) {
+        for (int i = 0; i < 2; ++i) {
+            const uint32_t bits = (uint32_t)SkFloat2Bits(i == 0 ? pts[n].fX : pts[n].fY);
+            const int32_t delta = (int32_t)(bits - prev[i]);
+            write_varint(((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31), dst);
+            prev[i] = bits;
+        }
+    }
+    const size_t weightBytes = ref->countWeights() * sizeof(SkScalar);
+    memcpy(dst->append(SkToInt(weightBytes)), ref->conicWeights(), weightBytes);
+}
+
+const uint8_t* SkPathPriv::ReadCompact(const uint8_t* src, const uint8_t* stop, SkPath* path) {
+    if (src >= stop) {
+        return nullptr;
+    }
+    const uint8_t header = *src++;
+    const SkPathFillType fillType = static_cast<SkPathFillType>(header & 0x3);
+
+    uint32_t count;
+    if (!(src = read_varint(src, stop, &count)) || count > (size_t)(stop - src)) {
+        return nullptr;
+    }
+
+    switch (header >> 4) {
+        case SerializationType::kRRect: {
+            SkPath rrect;
+            if (rrect.readFromMemory(src, count) != count) {
+                return nullptr;
+            }
+            *path = std::move(rrect);
+            return src + count;
+        }
+        case SerializationType::kGeneral:
+            break;
+        default:
+            return nullptr;
+    }
+
+    const uint8_t* verbs = src;
+    const int verbCount = SkToInt(count);
+    src += count;
+    if (verbCount == 0) {
+        path->reset();
+        path->setFillType(fillType);
+        return src;
+    }
+    const SkPathVerbAnalysis analysis = sk_path_analyze_verbs(verbs, verbCount);
+    // Every point takes at least two bytes.
+    if (!analysis.valid || (size_t)analysis.points > (size_t)(stop - src) / 2) {
+        return nullptr;
+    }
+
+    skia_private::AutoSTMalloc<32, SkPoint> points(analysis.points);
+    uint32_t prev[2] = {0, 0};
+    for (int i = 0; i < analysis.points; ++i) {
+        float xy[2];
+        for (int j = 0; j < 2; ++j) {
+            uint32_t zigzag;
+            if (!(src = read_varint(src, stop, &zigzag))) {
+                return nullptr;
+            }
+            prev[j] += (zigzag >> 1) ^ (0 - (zigzag & 1));
+            xy[j] = SkBits2Float((int32_t)prev[j]);
+        }
+        points[i] = {xy[0], xy[1]};
+    }
+
+    const size_t weightBytes = analysis.weights * sizeof(SkScalar);
+    if (weightBytes > (size_t)(stop - src)) {
+        return nullptr;
+    }
+    skia_private::AutoSTMalloc<8, SkScalar> weights(analysis.weights);
+    memcpy(weights.get(), src, weightBytes);
+    src += weightBytes;
+
+    *path = SkPathPriv::MakePath(analysis, points.get(), verbs, verbCount, weights.get(),
+                                 fillType, false);
+    return src;
+}
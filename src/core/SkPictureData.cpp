@@ -7,17 +7,20 @@
 
 #include "src/core/SkPictureData.h"
 
+#include "include/core/SkData.h"
 #include "include/core/SkFlattenable.h"
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkSerialProcs.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
 #include "include/core/SkTypeface.h"
+#include "include/private/base/SkAlign.h"
 #include "include/private/base/SkDebug.h"
+#include "include/private/base/SkTDArray.h"
 #include "include/private/base/SkTFitsIn.h"
 #include "include/private/base/SkTemplates.h"
 #include "include/private/base/SkTo.h"
-#include "src/base/SkAutoMalloc.h"
+#include "src/core/SkPathPriv.h"
 #include "src/core/SkPicturePriv.h"
 #include "src/core/SkPictureRecord.h"
 #include "src/core/SkPtrRecorder.h"
@@ -28,6 +31,7 @@
 #include "src/core/SkVerticesPriv.h"
 #include "src/core/SkWriteBuffer.h"
 
+#include <cstdint>
 #include <cstring>
 #include <utility>
 
@@ -166,9 +170,11 @@ void SkPictureData::flattenToBuffer(SkWriteBuffer& buffer, bool textBlobsOnly) c
         if (numPaths > 0) {
             write_tag_size(buffer, SK_PICT_PATH_BUFFER_TAG, numPaths);
             buffer.writeInt(numPaths);
+            SkTDArray<uint8_t> compact;
             for (const SkPath& path : fPaths) {
-                buffer.writePath(path);
+                SkPathPriv::WriteCompact(path, &compact);
             }
+            buffer.writeByteArray(compact.begin(), compact.size());
         }
     }
 
@@ -220,10 +226,29 @@ static SkSerialProcs skip_typeface_proc(const SkSerialProcs& procs) {
 // textBlobsOnly serves to indicate that we are on the first pass and skip as much work as
 // possible that is not relevant to collecting text blobs in topLevelTypeFaceSet
 // TODO(nifong): dedupe typefaces and all other shared resources in a faster and more readable way.
+// Since kAlignedStreamSections, the op data and buffer sections of a stream are preceded by a
+// byte count of zero padding, so that they start 4-byte aligned and can be read in place.
+static void write_section_padding(SkWStream* stream) {
+    // The count itself is one byte.
+    const size_t padding = (4 - (stream->bytesWritten() + 1) % 4) % 4;
+    const uint32_t zero = 0;
+    stream->write8(SkToU8(padding));
+    stream->write(&zero, padding);
+}
+
+static bool skip_section_padding(SkStream* stream, const SkPictInfo& info) {
+    if (info.getVersion() < SkPicturePriv::kAlignedStreamSections) {
+        return true;
+    }
+    uint8_t padding;
+    return stream->readU8(&padding) && padding < 4 && stream->skip(padding) == padding;
+}
+
 void SkPictureData::serialize(SkWStream* stream, const SkSerialProcs& procs,
                               SkRefCntSet* topLevelTypeFaceSet, bool textBlobsOnly) const {
     // This can happen at pretty much any time, so might as well do it first.
     write_tag_size(stream, SK_PICT_READER_TAG, fOpData->size());
+    write_section_padding(stream);
     stream->write(fOpData->bytes(), fOpData->size());
 
     // We serialize all typefaces into the typeface section of the top-level picture.
@@ -261,6 +286,7 @@ void SkPictureData::serialize(SkWStream* stream, const SkSerialProcs& procs,
 
     // Write the buffer.
     write_tag_size(stream, SK_PICT_BUFFER_SIZE_TAG, buffer.bytesWritten());
+    write_section_padding(stream);
     buffer.writeToStream(stream);
 
     // Write sub-pictures by calling serialize again.
@@ -299,16 +325,37 @@ void SkPictureData::flatten(SkWriteBuffer& buffer) const {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// Reads size bytes of the stream. If the stream is reading sharedData, the result refers to it
+// instead of being copied, as long as it is 4-byte aligned as SkReadBuffer requires (which it
+// always is in SKPs written since kAlignedStreamSections).
+static sk_sp<SkData> read_section(SkStream* stream, size_t size, const SkData* sharedData) {
+    if (sharedData) {
+        const size_t offset = stream->getPosition();
+        if (offset <= sharedData->size() && SkIsAlign4((uintptr_t)sharedData->bytes() + offset)) {
+            sk_sp<SkData> section = SkData::MakeSubset(sharedData, offset, size);
+            if (!section || stream->skip(size) != size) {
+                return nullptr;
+            }
+            return section;
+        }
+    }
+    return SkData::MakeFromStream(stream, size);
+}
+
 bool SkPictureData::parseStreamTag(SkStream* stream,
                                    uint32_t tag,
                                    uint32_t size,
                                    const SkDeserialProcs& procs,
                                    SkTypefacePlayback* topLevelTFPlayback,
-                                   int recursionLimit) {
+                                   int recursionLimit,
+                                   const SkData* sharedData) {
     switch (tag) {
         case SK_PICT_READER_TAG:
             SkASSERT(nullptr == fOpData);
-            fOpData = SkData::MakeFromStream(stream, size);
+            if (!skip_section_padding(stream, fInfo)) {
+                return false;
+            }
+            fOpData = read_section(stream, size, sharedData);
             if (!fOpData) {
                 return false;
             }
@@ -373,8 +420,8 @@ bool SkPictureData::parseStreamTag(SkStream* stream,
             fPictures.reserve_exact(SkToInt(size));
 
             for (uint32_t i = 0; i < size; i++) {
-                auto pic = SkPicture::MakeFromStreamPriv(stream, &procs,
-                                                         topLevelTFPlayback, recursionLimit - 1);
+                auto pic = SkPicture::MakeFromStreamPriv(stream, &procs, topLevelTFPlayback,
+                                                         recursionLimit - 1, sharedData);
                 if (!pic) {
                     return false;
                 }
@@ -385,13 +432,20 @@ bool SkPictureData::parseStreamTag(SkStream* stream,
             if (StreamRemainingLengthIsBelow(stream, size)) {
                 return false;
             }
-            SkAutoMalloc storage(size);
-            if (stream->read(storage.get(), size) != size) {
+            if (!skip_section_padding(stream, fInfo)) {
+                return false;
+            }
+            sk_sp<SkData> bufferData = read_section(stream, size, sharedData);
+            if (!bufferData) {
                 return false;
             }
 
-            SkReadBuffer buffer(storage.get(), size);
+            SkReadBuffer buffer(bufferData->data(), size);
             buffer.setVersion(fInfo.getVersion());
+            if (sharedData) {
+                // Even if the section had to be copied, the images in it can share that copy.
+                buffer.setBackingData(std::move(bufferData));
+            }
 
             if (!fFactoryPlayback) {
                 return false;
@@ -474,12 +528,27 @@ void SkPictureData::parseBufferTag(SkReadBuffer& buffer, uint32_t tag, uint32_t
                 if (!buffer.validate(count >= 0)) {
                     return;
                 }
-                for (int i = 0; i < count; i++) {
-                    buffer.readPath(&fPaths.push_back());
-                    if (!buffer.isValid()) {
-                        return;
+                if (buffer.isVersionLT(SkPicturePriv::kCompactPathTables)) {
+                    for (int i = 0; i < count; i++) {
+                        buffer.readPath(&fPaths.push_back());
+                        if (!buffer.isValid()) {
+                            return;
+                        }
                     }
+                    break;
+                }
+                size_t bytes;
+                const uint8_t* src = static_cast<const uint8_t*>(buffer.skipByteArray(&bytes));
+                // Every path takes at least a byte.
+                if (!buffer.validate(src != nullptr && (size_t)count <= bytes)) {
+                    return;
+                }
+                const uint8_t* stop = src + bytes;
+                fPaths.reserve_exact(count);
+                for (int i = 0; i < count && src; i++) {
+                    src = SkPathPriv::ReadCompact(src, stop, &fPaths.push_back());
                 }
+                buffer.validate(src == stop);
             } break;
         case SK_PICT_TEXTBLOB_BUFFER_TAG:
             new_array_from_buffer(buffer, size, fTextBlobs, SkTextBlobPriv::MakeFromBuffer);
@@ -499,9 +568,8 @@ void SkPictureData::parseBufferTag(SkReadBuffer& buffer, uint32_t tag, uint32_t
             if (!buffer.validateCanReadN<uint8_t>(size)) {
                 return;
             }
-            auto data(SkData::MakeUninitialized(size));
-            if (!buffer.readByteArray(data->writable_data(), size) ||
-                !buffer.validate(nullptr == fOpData)) {
+            sk_sp<SkData> data = buffer.readByteArrayAsData();
+            if (!buffer.validate(data && data->size() == size && nullptr == fOpData)) {
                 return;
             }
             SkASSERT(nullptr == fOpData);
@@ -523,13 +591,14 @@ SkPictureData* SkPictureData::CreateFromStream(SkStream* stream,
                                                const SkPictInfo& info,
                                                const SkDeserialProcs& procs,
                                                SkTypefacePlayback* topLevelTFPlayback,
-                                               int recursionLimit) {
+                                               int recursionLimit,
+                                               const SkData* sharedData) {
     std::unique_ptr<SkPictureData> data(new SkPictureData(info));
     if (!topLevelTFPlayback) {
         topLevelTFPlayback = &data->fTFPlayback;
     }
 
-    if (!data->parseStream(stream, procs, topLevelTFPlayback, recursionLimit)) {
+    if (!data->parseStream(stream, procs, topLevelTFPlayback, recursionLimit, sharedData)) {
         return nullptr;
     }
     return data.release();
@@ -549,7 +618,8 @@ SkPictureData* SkPictureData::CreateFromBuffer(SkReadBuffer& buffer,
 bool SkPictureData::parseStream(SkStream* stream,
                                 const SkDeserialProcs& procs,
                                 SkTypefacePlayback* topLevelTFPlayback,
-                                int recursionLimit) {
+                                int recursionLimit,
+                                const SkData* sharedData) {
     for (;;) {
         uint32_t tag;
         if (!stream->readU32(&tag)) { return false; }
@@ -559,7 +629,8 @@ bool SkPictureData::parseStream(SkStream* stream,
 
         uint32_t size;
         if (!stream->readU32(&size)) { return false; }
-        if (!this->parseStreamTag(stream, tag, size, procs, topLevelTFPlayback, recursionLimit)) {
+        if (!this->parseStreamTag(stream, tag, size, procs, topLevelTFPlayback, recursionLimit,
+                                  sharedData)) {
             return false; // we're invalid
         }
     }
@@ -115,6 +115,8 @@ public:
     // V102: Convolution image filter uses ::Crop to apply tile mode
     // V103: Remove deprecated per-image filter crop rect
     // v104: SaveLayer supports multiple image filters
+    // V105: Op data and buffer sections of streams are 4-byte aligned
+    // V106: Path tables use SkPathPriv's compact encoding
 
     enum Version {
         kPictureShaderFilterParam_Version   = 82,
@@ -140,6 +142,9 @@ public:
         kConvolutionImageFilterTilingUpdate = 102,
         kRemoveDeprecatedCropRect           = 103,
         kMultipleFiltersOnSaveLayer         = 104,
+        kAlignedStreamSections              = 105,
+        kCompactPathTables                  = 106,
+        kSharedSlugDescriptors              = 107,
 
         // Only SKPs within the min/current picture version range (inclusive) can be read.
         //
@@ -164,7 +169,7 @@ public:
         //
         // Contact the Infra Gardener if the above steps do not work for you.
         kMin_Version     = kPictureShaderFilterParam_Version,
-        kCurrent_Version = kMultipleFiltersOnSaveLayer
+        kCurrent_Version = kSharedSlugDescriptors
     };
 };
 
@@ -784,6 +784,14 @@ void SkPictureRecord::onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4]
     this->validate(initialOffset, size);
 }
 
+void SkPictureRecord::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[],
+                                          int count, const int matrixIndices[],
+                                          const SkMatrix preViewMatrices[], QuadAAFlags aa,
+                                          SkBlendMode mode) {
+    // Recorded as one quad per entry.
+    this->drawEdgeAARectSetAsQuads(rects, colors, count, matrixIndices, preViewMatrices, aa, mode);
+}
+
 void SkPictureRecord::onDrawEdgeAAImageSet2(const SkCanvas::ImageSetEntry set[], int count,
                                             const SkPoint dstClips[],
                                             const SkMatrix preViewMatrices[],
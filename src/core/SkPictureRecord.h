@@ -249,6 +249,8 @@ protected:
 
     void onDrawEdgeAAQuad(const SkRect&, const SkPoint[4], QuadAAFlags, const SkColor4f&,
                           SkBlendMode) override;
+    void onDrawEdgeAARectSet(const SkRect[], const SkColor4f[], int count, const int[],
+                             const SkMatrix[], QuadAAFlags, SkBlendMode) override;
     void onDrawEdgeAAImageSet2(const ImageSetEntry[], int count, const SkPoint[], const SkMatrix[],
                                const SkSamplingOptions&,const SkPaint*, SrcRectConstraint) override;
 
@@ -73,7 +73,7 @@ sk_sp<SkPicture> SkPictureRecorder::finishRecordingAsPicture() {
     }
 
     // TODO: delay as much of this work until just before first playback?
-    SkRecordOptimize(fRecord.get());
+    SkRecordOptimize(fRecord.get(), fCullRect);
 
     SkDrawableList* drawableList = fRecorder->getDrawableList();
     std::unique_ptr<SkBigPicture::SnapshotArray> pictList{
@@ -113,6 +113,17 @@ sk_sp<SkPicture> SkPictureRecorder::finishRecordingAsPictureWithCull(const SkRec
     return this->finishRecordingAsPicture();
 }
 
+void SkPictureRecorder::appendChildRecording(SkPictureRecorder* child) {
+    SkASSERT(child && child != this);
+    if (!fActivelyRecording || !child->fActivelyRecording) {
+        return;
+    }
+    child->fActivelyRecording = false;
+    child->fRecorder->restoreToCount(1);  // If it was missing any restores, add them now.
+    child->fBBH.reset();
+
+    fRecorder->splice(child->fRecorder.get(), std::move(child->fRecord));
+}
 
 void SkPictureRecorder::partialReplay(SkCanvas* canvas) const {
     if (nullptr == canvas) {
@@ -133,7 +144,7 @@ sk_sp<SkDrawable> SkPictureRecorder::finishRecordingAsDrawable() {
     fActivelyRecording = false;
     fRecorder->restoreToCount(1);  // If we were missing any restores, add them now.
 
-    SkRecordOptimize(fRecord.get());
+    SkRecordOptimize(fRecord.get(), fCullRect);
 
     if (fBBH) {
         AutoTArray<SkRect> bounds(fRecord->count());
@@ -0,0 +1,287 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkColorType.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkRefCnt.h"
+#include "include/private/base/SkFloatingPoint.h"
+#include "include/private/base/SkTPin.h"
+#include "src/base/SkVx.h"
+#include "src/core/SkImageInfoPriv.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using ResampleFilter = SkPixmap::ResampleFilter;
+
+// How many rows of dst each task produces. Each task also filters the (overlapping) rows of src
+// that its rows need, so this trades that redundant work against how finely rows are spread.
+constexpr int kRowsPerTask = 16;
+
+float mitchell(float x) {
+    constexpr float B = 1/3.f, C = 1/3.f;
+    x = std::fabs(x);
+    if (x < 1) {
+        return ((12 - 9*B - 6*C)*x*x*x + (-18 + 12*B + 6*C)*x*x + (6 - 2*B)) * (1/6.f);
+    }
+    if (x < 2) {
+        return ((-B - 6*C)*x*x*x + (6*B + 30*C)*x*x + (-12*B - 48*C)*x + (8*B + 24*C)) * (1/6.f);
+    }
+    return 0;
+}
+
+float sinc(float x) {
+    if (x == 0) {
+        return 1;
+    }
+    x *= SK_FloatPI;
+    return std::sin(x) / x;
+}
+
+float lanczos3(float x) {
+    return std::fabs(x) < 3 ? sinc(x) * sinc(x / 3) : 0;
+}
+
+// Downscales by more than 2x first average src over boxes of this many pixels, leaving at least
+// 2x for the filter itself. The filter's taps then run over the averages rather than every src
+// pixel, which for large downscales is most of the work, for very little loss of quality.
+int box_size(int srcSize, int dstSize) {
+    return std::max(1, srcSize / (2 * dstSize));
+}
+
+// The weights each dst pixel along one axis gives the src pixels (or boxes) along that axis. The
+// filter is stretched by the downscale factor, so it covers every src pixel that maps to the dst
+// pixel. Taps that would fall past the edges of src are folded into the edge pixels (clamp).
+class FilterTable {
+public:
+    // 'srcExtent' is how many src pixels the dst pixels span, which is only less than 'srcSize'
+    // when the last box is partial.
+    FilterTable(int srcSize, float srcExtent, int dstSize, ResampleFilter filter) {
+        float (*eval)(float) = filter == ResampleFilter::kLanczos3 ? lanczos3 : mitchell;
+        const float radius = filter == ResampleFilter::kLanczos3 ? 3 : 2;
+
+        const float scale = dstSize / srcExtent;
+        const float filterScale = std::min(scale, 1.f);
+        const float support = radius / filterScale;
+        fTaps = std::min((int)std::ceil(2 * support) + 1, srcSize);
+
+        fStarts.resize(dstSize);
+        fWeights.assign(dstSize * fTaps, 0.f);
+        for (int i = 0; i < dstSize; ++i) {
+            const float center = (i + 0.5f) / scale;
+            const int first = (int)std::ceil(center - 0.5f - support);
+            const int last = (int)std::floor(center - 0.5f + support);
+            const int start = SkTPin(first, 0, srcSize - fTaps);
+            fStarts[i] = start;
+
+            float* weights = &fWeights[i * fTaps];
+            float sum = 0;
+            for (int j = first; j <= last; ++j) {
+                const float w = eval((j + 0.5f - center) * filterScale);
+                weights[SkTPin(j, start, start + fTaps - 1) - start] += w;
+                sum += w;
+            }
+            for (int k = 0; k < fTaps; ++k) {
+                weights[k] /= sum;
+            }
+        }
+    }
+
+    int taps() const { return fTaps; }
+    int start(int i) const { return fStarts[i]; }
+    const float* weights(int i) const { return &fWeights[i * fTaps]; }
+
+private:
+    int fTaps;
+    std::vector<int> fStarts;
+    std::vector<float> fWeights;
+};
+
+using float4 = skvx::float4;
+
+// Everything resample_rows() needs to know about the whole resample.
+struct Resample {
+    SkPixmap            src, dst;
+    sk_sp<SkColorSpace> workingSpace;
+    bool                direct;  // Can src be read without converting it first?
+    int                 boxW, boxH;
+    int                 boxesW, boxesH;
+    FilterTable         xTable, yTable;  // From boxes to dst pixels
+};
+
+// Premul 8888 pixels that need no color conversion are read straight from src, which saves
+// converting every src pixel to float first.
+bool can_read_directly(const SkPixmap& src, const SkColorSpace* workingSpace) {
+    return (src.colorType() == kRGBA_8888_SkColorType ||
+            src.colorType() == kBGRA_8888_SkColorType) &&
+           src.alphaType() != kUnpremul_SkAlphaType &&
+           (!workingSpace || SkColorSpace::Equals(src.colorSpace(), workingSpace));
+}
+
+// Adds each run of boxW pixels in one row of src to the matching box.
+template <typename Pixel, typename LoadFn>
+void add_to_boxes(const Pixel* src, int srcW, int boxW, LoadFn&& load, float4* boxes) {
+    for (int x = 0, b = 0; x < srcW; ++b) {
+        float4 sum = boxes[b];
+        for (const int end = std::min(x + boxW, srcW); x < end; ++x) {
+            sum += load(src[x]);
+        }
+        boxes[b] = sum;
+    }
+}
+
+// Produces rows [y0, y1) of dst: averages each row of boxes they need, as premul float pixels in
+// the working color space, and filters it down to dst's width. Then filters those rows down to
+// each dst row and converts it to dst's format.
+bool resample_rows(const Resample& r, int y0, int y1) {
+    const int srcW = r.src.width(), srcH = r.src.height(), dstW = r.dst.width();
+    const SkImageInfo srcRowInfo = SkImageInfo::Make(srcW, 1, kRGBA_F32_SkColorType,
+                                                     kPremul_SkAlphaType, r.workingSpace);
+    const SkImageInfo dstRowInfo = srcRowInfo.makeWH(dstW, 1);
+    const bool swapRB = r.direct && r.src.colorType() == kBGRA_8888_SkColorType;
+
+    const int firstRow = r.yTable.start(y0);
+    const int lastRow = r.yTable.start(y1 - 1) + r.yTable.taps() - 1;
+    std::vector<float4> srcRow(r.direct ? 0 : srcW);
+    std::vector<float4> boxes(r.boxesW);
+    std::vector<float4> rows((lastRow - firstRow + 1) * dstW);  // rows of boxes, at dst's width
+
+    for (int by = firstRow; by <= lastRow; ++by) {
+        std::fill(boxes.begin(), boxes.end(), float4(0));
+        const int sy0 = by * r.boxH, sy1 = std::min(sy0 + r.boxH, srcH);
+        for (int sy = sy0; sy < sy1; ++sy) {
+            if (r.direct) {
+                add_to_boxes(r.src.addr32(0, sy), srcW, r.boxW, [](uint32_t px) {
+                    return skvx::cast<float>(skvx::byte4::Load(&px));
+                }, boxes.data());
+            } else {
+                if (!r.src.readPixels(srcRowInfo, srcRow.data(), srcRowInfo.minRowBytes(), 0, sy)) {
+                    return false;
+                }
+                add_to_boxes(srcRow.data(), srcW, r.boxW, [](const float4& px) {
+                    return px;
+                }, boxes.data());
+            }
+        }
+        for (int bx = 0; bx < r.boxesW; ++bx) {
+            const int count = (std::min((bx + 1) * r.boxW, srcW) - bx * r.boxW) * (sy1 - sy0);
+            boxes[bx] *= (r.direct ? 1/255.f : 1.f) / count;
+            if (swapRB) {
+                boxes[bx] = skvx::shuffle<2, 1, 0, 3>(boxes[bx]);
+            }
+        }
+
+        float4* row = &rows[(by - firstRow) * dstW];
+        for (int x = 0; x < dstW; ++x) {
+            const float4* px = &boxes[r.xTable.start(x)];
+            const float* weights = r.xTable.weights(x);
+            float4 sum = 0;
+            for (int k = 0; k < r.xTable.taps(); ++k) {
+                sum += weights[k] * px[k];
+            }
+            row[x] = sum;
+        }
+    }
+
+    std::vector<float4> dstRow(dstW);
+    for (int y = y0; y < y1; ++y) {
+        std::fill(dstRow.begin(), dstRow.end(), float4(0));
+        const float* weights = r.yTable.weights(y);
+        for (int k = 0; k < r.yTable.taps(); ++k) {
+            const float4* row = &rows[(r.yTable.start(y) + k - firstRow) * dstW];
+            for (int x = 0; x < dstW; ++x) {
+                dstRow[x] += weights[k] * row[x];
+            }
+        }
+        // The filters' negative lobes can overshoot, so keep the pixels premul and in range.
+        for (float4& px : dstRow) {
+            const float a = std::min(std::max(px[3], 0.f), 1.f);
+            px = skvx::pin(px, float4(0), float4(a));
+            px[3] = a;
+        }
+        SkPixmap rowPixmap(dstRowInfo, dstRow.data(), dstRowInfo.minRowBytes());
+        if (!rowPixmap.readPixels(r.dst.info().makeWH(dstW, 1),
+                                  r.dst.writable_addr(0, y),
+                                  r.dst.rowBytes())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // namespace
+
+bool SkPixmap::resamplePixels(const SkPixmap& actualDst,
+                              ResampleFilter filter,
+                              bool linear,
+                              SkExecutor* executor) const {
+    SkPixmap src = *this,
+             dst = actualDst;
+    if (src.width() <= 0 || src.height() <= 0 || dst.width() <= 0 || dst.height() <= 0 ||
+        !src.addr() || !dst.addr() || dst.rowBytes() < dst.info().minRowBytes()) {
+        return false;
+    }
+
+    sk_sp<SkColorSpace> workingSpace = dst.refColorSpace();
+    if (linear) {
+        // Converting to or from an untagged pixmap is a no-op, which would leave linear pixels in
+        // dst. So treat untagged pixmaps as the other one's color space, or as sRGB.
+        sk_sp<SkColorSpace> space = dst.colorSpace() ? dst.refColorSpace()
+                                  : src.colorSpace() ? src.refColorSpace()
+                                                     : SkColorSpace::MakeSRGB();
+        if (!src.colorSpace()) {
+            src.setColorSpace(space);
+        }
+        if (!dst.colorSpace()) {
+            dst.setColorSpace(space);
+        }
+        workingSpace = space->makeLinearGamma();
+    }
+    const SkImageInfo workingInfo = SkImageInfo::Make(1, 1, kRGBA_F32_SkColorType,
+                                                      kPremul_SkAlphaType, workingSpace);
+    if (!SkImageInfoValidConversion(workingInfo, src.info()) ||
+        !SkImageInfoValidConversion(dst.info(), workingInfo)) {
+        return false;
+    }
+
+    const int boxW = box_size(src.width(), dst.width()),
+              boxH = box_size(src.height(), dst.height());
+    const int boxesW = (src.width() + boxW - 1) / boxW,
+              boxesH = (src.height() + boxH - 1) / boxH;
+    const bool direct = can_read_directly(src, workingSpace.get());
+    const Resample r{src, dst, workingSpace, direct, boxW, boxH, boxesW, boxesH,
+                     FilterTable(boxesW, (float)src.width() / boxW, dst.width(), filter),
+                     FilterTable(boxesH, (float)src.height() / boxH, dst.height(), filter)};
+
+    const int tasks = (dst.height() + kRowsPerTask - 1) / kRowsPerTask;
+    std::atomic<bool> ok{true};
+    auto task = [&](int i) {
+        const int y0 = i * kRowsPerTask;
+        const int y1 = std::min(y0 + kRowsPerTask, dst.height());
+        if (!resample_rows(r, y0, y1)) {
+            ok.store(false, std::memory_order_relaxed);
+        }
+    };
+    if (executor) {
+        SkTaskGroup tg(*executor);
+        tg.batch(tasks, task);
+        tg.wait();
+    } else {
+        for (int i = 0; i < tasks; ++i) {
+            task(i);
+        }
+    }
+    return ok.load(std::memory_order_relaxed);
+}
@@ -7,8 +7,52 @@
 
 #include "src/core/SkRTree.h"
 
+#include "src/base/SkMathPriv.h"
+#include "src/base/SkVx.h"
+
+#include <algorithm>
+
+namespace {
+
+using float4 = skvx::float4;
+
+// A query rect's edges, each splatted across a vector.
+struct Query {
+    explicit Query(const SkRect& r)
+            : fLeft(r.fLeft), fTop(r.fTop), fRight(r.fRight), fBottom(r.fBottom) {}
+
+    float4 fLeft, fTop, fRight, fBottom;
+};
+
+// Returns a bit for each of node's children [i, i+4) that intersects the query, decided exactly
+// as SkRect::Intersects(childBounds, query) would, down to which operand std::max() and
+// std::min() pick when one is NaN.
+template <typename Node>
+int intersect4(const Node& node, int i, const Query& q) {
+    float4 L = float4::Load(node.fLeft   + i),
+           T = float4::Load(node.fTop    + i),
+           R = float4::Load(node.fRight  + i),
+           B = float4::Load(node.fBottom + i);
+    L = if_then_else(L < q.fLeft,   q.fLeft,   L);
+    T = if_then_else(T < q.fTop,    q.fTop,    T);
+    R = if_then_else(q.fRight  < R, q.fRight,  R);
+    B = if_then_else(q.fBottom < B, q.fBottom, B);
+    const skvx::int4 hits = (L < R) & (T < B) & skvx::int4(1, 2, 4, 8);
+    return hits[0] | hits[1] | hits[2] | hits[3];
+}
+
+}  // namespace
+
 SkRTree::SkRTree() : fCount(0) {}
 
+void SkRTree::Node::setChild(int i, const Branch& branch) {
+    fLeft[i]     = branch.fBounds.fLeft;
+    fTop[i]      = branch.fBounds.fTop;
+    fRight[i]    = branch.fBounds.fRight;
+    fBottom[i]   = branch.fBounds.fBottom;
+    fChildren[i] = branch.fChild;
+}
+
 void SkRTree::insert(const SkRect boundsArray[], int N) {
     SkASSERT(0 == fCount);
 
@@ -23,7 +67,7 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
 
         Branch b;
         b.fBounds = bounds;
-        b.fOpIndex = i;
+        b.fChild.fOpIndex = i;
         branches.push_back(b);
     }
 
@@ -33,8 +77,8 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
             fNodes.reserve(1);
             Node* n = this->allocateNodeAtLevel(0);
             n->fNumChildren = 1;
-            n->fChildren[0] = branches[0];
-            fRoot.fSubtree = n;
+            n->setChild(0, branches[0]);
+            fRoot.fChild.fSubtree = n;
             fRoot.fBounds  = branches[0].fBounds;
         } else {
             fNodes.reserve(CountNodes(fCount));
@@ -45,7 +89,7 @@ void SkRTree::insert(const SkRect boundsArray[], int N) {
 
 SkRTree::Node* SkRTree::allocateNodeAtLevel(uint16_t level) {
     SkDEBUGCODE(Node* p = fNodes.data());
-    fNodes.push_back(Node{});
+    fNodes.push_back(Node{});  // Zeroes the bounds past the children, making them empty.
     Node& out = fNodes.back();
     SkASSERT(fNodes.data() == p);  // If this fails, we didn't reserve() enough.
     out.fNumChildren = 0;
@@ -123,14 +167,14 @@ SkRTree::Branch SkRTree::bulkLoad(std::vector<Branch>* branches, int level) {
         }
         Node* n = allocateNodeAtLevel(level);
         n->fNumChildren = 1;
-        n->fChildren[0] = (*branches)[currentBranch];
+        n->setChild(0, (*branches)[currentBranch]);
         Branch b;
         b.fBounds = (*branches)[currentBranch].fBounds;
-        b.fSubtree = n;
+        b.fChild.fSubtree = n;
         ++currentBranch;
         for (int k = 1; k < incrementBy && currentBranch < (int)branches->size(); ++k) {
             b.fBounds.join((*branches)[currentBranch].fBounds);
-            n->fChildren[k] = (*branches)[currentBranch];
+            n->setChild(k, (*branches)[currentBranch]);
             ++n->fNumChildren;
             ++currentBranch;
         }
@@ -143,20 +187,70 @@ SkRTree::Branch SkRTree::bulkLoad(std::vector<Branch>* branches, int level) {
 
 void SkRTree::search(const SkRect& query, std::vector<int>* results) const {
     if (fCount > 0 && SkRect::Intersects(fRoot.fBounds, query)) {
-        this->search(fRoot.fSubtree, query, results);
+        this->search(fRoot.fChild.fSubtree, query, results);
     }
 }
 
-void SkRTree::search(Node* node, const SkRect& query, std::vector<int>* results) const {
-    for (int i = 0; i < node->fNumChildren; ++i) {
-        if (SkRect::Intersects(node->fChildren[i].fBounds, query)) {
+void SkRTree::search(const Node* node, const SkRect& query, std::vector<int>* results) const {
+    const Query q(query);
+    for (int i = 0; i < node->fNumChildren; i += 4) {
+        for (int hits = intersect4(*node, i, q); hits; hits &= hits - 1) {
+            const Child& child = node->fChildren[i + SkCTZ(hits)];
             if (0 == node->fLevel) {
-                results->push_back(node->fChildren[i].fOpIndex);
+                results->push_back(child.fOpIndex);
             } else {
-                this->search(node->fChildren[i].fSubtree, query, results);
+                this->search(child.fSubtree, query, results);
+            }
+        }
+    }
+}
+
+void SkRTree::search(SkSpan<const SkRect> queries, std::vector<int> results[]) const {
+    if (fCount == 0) {
+        return;
+    }
+    // Queries go down the tree in groups of up to 32, one bit each.
+    for (size_t first = 0; first < queries.size(); first += 32) {
+        const SkSpan<const SkRect> group =
+                queries.subspan(first, std::min<size_t>(32, queries.size() - first));
+        uint32_t active = 0;
+        for (size_t i = 0; i < group.size(); ++i) {
+            if (SkRect::Intersects(fRoot.fBounds, group[i])) {
+                active |= 1u << i;
+            }
+        }
+        if (active) {
+            this->search(fRoot.fChild.fSubtree, group.data(), active, results + first);
+        }
+    }
+}
+
+void SkRTree::search(const Node* node, const SkRect queries[], uint32_t active,
+                     std::vector<int> results[]) const {
+    // For each child, which of the active queries intersect it.
+    uint32_t childHits[kPaddedChildren] = {};
+    for (uint32_t queryBits = active; queryBits; queryBits &= queryBits - 1) {
+        const int query = SkCTZ(queryBits);
+        const Query q(queries[query]);
+        for (int i = 0; i < node->fNumChildren; i += 4) {
+            for (int hits = intersect4(*node, i, q); hits; hits &= hits - 1) {
+                childHits[i + SkCTZ(hits)] |= 1u << query;
             }
         }
     }
+
+    for (int i = 0; i < node->fNumChildren; ++i) {
+        if (!childHits[i]) {
+            continue;
+        }
+        if (0 == node->fLevel) {
+            for (uint32_t queryBits = childHits[i]; queryBits; queryBits &= queryBits - 1) {
+                results[SkCTZ(queryBits)].push_back(node->fChildren[i].fOpIndex);
+            }
+        } else {
+            this->search(node->fChildren[i].fSubtree, queries, childHits[i], results);
+        }
+    }
 }
 
 size_t SkRTree::bytesUsed() const {
@@ -10,6 +10,10 @@
 
 #include "include/core/SkBBHFactory.h"
 #include "include/core/SkRect.h"
+#include "include/core/SkSpan.h"
+
+#include <cstdint>
+#include <vector>
 
 /**
  * An R-Tree implementation. In short, it is a balanced n-ary tree containing a hierarchy of
@@ -35,10 +39,17 @@ public:
     void search(const SkRect& query, std::vector<int>* results) const override;
     size_t bytesUsed() const override;
 
+    /**
+     *  Appends to results[i] what search(queries[i], &results[i]) would, walking the tree once
+     *  for all of them rather than once per query. Nodes that several queries (e.g. neighboring
+     *  tiles) reach are only loaded once.
+     */
+    void search(SkSpan<const SkRect> queries, std::vector<int> results[]) const;
+
     // Methods and constants below here are only public for tests.
 
     // Return the depth of the tree structure.
-    int getDepth() const { return fCount ? fRoot.fSubtree->fLevel + 1 : 0; }
+    int getDepth() const { return fCount ? fRoot.fChild.fSubtree->fLevel + 1 : 0; }
     // Insertion count (not overall node count, which may be greater).
     int getCount() const { return fCount; }
 
@@ -49,21 +60,38 @@ public:
 private:
     struct Node;
 
+    union Child {
+        Node* fSubtree;
+        int fOpIndex;
+    };
+
     struct Branch {
-        union {
-            Node* fSubtree;
-            int fOpIndex;
-        };
+        Child fChild;
         SkRect fBounds;
     };
 
+    // Children are tested against queries four at a time.
+    static constexpr int kPaddedChildren = (kMaxChildren + 3) & ~3;
+
+    // Each edge of the children's bounds is kept in its own array, so the bounds of four children
+    // load as one vector per edge. The padding past fNumChildren is left as empty rects, which
+    // never intersect anything.
     struct Node {
         uint16_t fNumChildren;
         uint16_t fLevel;
-        Branch fChildren[kMaxChildren];
+        float fLeft  [kPaddedChildren],
+              fTop   [kPaddedChildren],
+              fRight [kPaddedChildren],
+              fBottom[kPaddedChildren];
+        Child fChildren[kPaddedChildren];
+
+        void setChild(int i, const Branch&);
     };
 
-    void search(Node* root, const SkRect& query, std::vector<int>* results) const;
+    void search(const Node*, const SkRect& query, std::vector<int>* results) const;
+    // 'active' has a bit set for each of queries[0..31] that the node's bounds intersect.
+    void search(const Node*, const SkRect queries[], uint32_t active,
+                std::vector<int> results[]) const;
 
     // Consumes the input array.
     Branch bulkLoad(std::vector<Branch>* branches, int level = 0);
@@ -6,9 +6,12 @@
  */
 
 #include "include/core/SkBlendMode.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkRRect.h"
 #include "src/core/SkRasterClip.h"
 #include "src/core/SkRegionPriv.h"
+#include "src/shaders/SkAnalyticClipShader.h"
 
 SkRasterClip::SkRasterClip(const SkRasterClip& that)
         : fIsBW(that.fIsBW)
@@ -88,6 +91,7 @@ bool SkRasterClip::setEmpty() {
     fIsBW = true;
     fBW.setEmpty();
     fAA.setEmpty();
+    fShader = nullptr;
     fIsEmpty = true;
     fIsRect = false;
     return false;
@@ -98,6 +102,7 @@ bool SkRasterClip::setRect(const SkIRect& rect) {
 
     fIsBW = true;
     fAA.setEmpty();
+    fShader = nullptr;
     fIsRect = fBW.setRect(rect);
     fIsEmpty = !fIsRect;
     return fIsRect;
@@ -162,6 +167,9 @@ bool SkRasterClip::op(const SkRect& localRect, const SkMatrix& matrix, SkClipOp
 
     if (fIsBW && !doAA) {
         (void)fBW.op(devRect.round(), (SkRegion::Op) op);
+    } else if (fIsBW && op == SkClipOp::kIntersect &&
+               this->intersectAnalytic(SkRRect::MakeRect(devRect))) {
+        return !fIsEmpty;
     } else {
         if (fIsBW) {
             this->convertToAA();
@@ -172,9 +180,30 @@ bool SkRasterClip::op(const SkRect& localRect, const SkMatrix& matrix, SkClipOp
 }
 
 bool SkRasterClip::op(const SkRRect& rrect, const SkMatrix& matrix, SkClipOp op, bool doAA) {
+    SkRRect devRRect;
+    if (fIsBW && doAA && op == SkClipOp::kIntersect && rrect.transform(matrix, &devRRect) &&
+        this->intersectAnalytic(devRRect)) {
+        return !fIsEmpty;
+    }
     return this->op(SkPath::RRect(rrect), matrix, op, doAA);
 }
 
+bool SkRasterClip::intersectAnalytic(const SkRRect& devRRect) {
+    AUTO_RASTERCLIP_VALIDATE(*this);
+    SkASSERT(fIsBW);
+
+    if (!SkAnalyticClipShader::IsSupported(devRRect)) {
+        return false;
+    }
+    (void)fBW.op(devRRect.rect().roundOut(), SkRegion::kIntersect_Op);
+    // The rrect's edges only matter if it cuts into the pixels we have left.
+    if (this->updateCacheAndReturnNonEmpty() &&
+        !devRRect.contains(SkRect::Make(fBW.getBounds()))) {
+        (void)this->op(sk_make_sp<SkAnalyticClipShader>(devRRect));
+    }
+    return true;
+}
+
 bool SkRasterClip::op(const SkPath& path, const SkMatrix& matrix, SkClipOp op, bool doAA) {
     AUTO_RASTERCLIP_VALIDATE(*this);
 
@@ -253,6 +282,7 @@ void SkRasterClip::translate(int dx, int dy, SkRasterClip* dst) const {
     }
 
     dst->fIsBW = fIsBW;
+    dst->fShader = fShader ? fShader->makeWithLocalMatrix(SkMatrix::Translate(dx, dy)) : nullptr;
     if (fIsBW) {
         fBW.translate(dx, dy, &dst->fBW);
         dst->fAA.setEmpty();
@@ -85,6 +85,8 @@ public:
     void validate() const {}
 #endif
 
+    // The coverage of antialiased rect and rrect clips is often applied through this, as well as
+    // that of any clipShader() calls, so it may be set even though the clip is BW.
     sk_sp<SkShader> clipShader() const { return fShader; }
 
 private:
@@ -121,6 +123,11 @@ private:
 
     void convertToAA();
 
+    // Intersects a BW clip with an antialiased device-space rrect by clipping to its bounds and
+    // adding its coverage to fShader, rather than by converting to an SkAAClip. Returns false,
+    // without changing the clip, if the rrect isn't one that can be handled this way.
+    bool intersectAnalytic(const SkRRect& devRRect);
+
     bool op(const SkRasterClip&, SkClipOp);
 };
 
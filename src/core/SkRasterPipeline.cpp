@@ -63,7 +63,45 @@ uint8_t* SkRasterPipeline::tailPointer() {
     return fTailPointer;
 }
 
+bool SkRasterPipeline::appendFusedStage(SkRasterPipelineOp op, void* ctx) {
+    // Only stages appended back to back are fused, so the stage count seen by anything that has
+    // already been appended is unaffected.
+    const StageList* last = fStages;
+    const StageList* prev = last ? last->prev : nullptr;
+    switch (op) {
+        case Op::premul:
+            // load_8888, premul -> load_8888_premul
+            if (last && last->stage == Op::load_8888) {
+                fStages = last->prev;
+                fNumStages -= 1;
+                this->uncheckedAppend(Op::load_8888_premul, last->ctx);
+                return true;
+            }
+            break;
+
+        case Op::store_8888:
+            // load_8888_dst, srcover, store_8888 -> srcover_rgba_8888, when loading and storing
+            // the same pixels.
+            if (last && last->stage == Op::srcover &&
+                prev && prev->stage == Op::load_8888_dst && prev->ctx == ctx) {
+                fStages = prev->prev;
+                fNumStages -= 2;
+                this->uncheckedAppend(Op::srcover_rgba_8888, ctx);
+                return true;
+            }
+            break;
+
+        default:
+            break;
+    }
+    return false;
+}
+
 void SkRasterPipeline::uncheckedAppend(SkRasterPipelineOp op, void* ctx) {
+    if (this->appendFusedStage(op, ctx)) {
+        return;
+    }
+
     bool isLoad = false, isStore = false;
     SkColorType ct = kUnknown_SkColorType;
 
@@ -103,6 +141,11 @@ void SkRasterPipeline::uncheckedAppend(SkRasterPipelineOp op, void* ctx) {
             isStore = true;
             break;
         }
+        case Op::load_8888_premul: {
+            ct = kRGBA_8888_SkColorType;
+            isLoad = true;
+            break;
+        }
         case Op::srcover_rgba_8888: {
             ct = kRGBA_8888_SkColorType;
             isLoad = true;
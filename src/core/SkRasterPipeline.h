@@ -145,6 +145,10 @@ private:
     StartPipelineFn buildPipeline(SkRasterPipelineStage*) const;
 
     void uncheckedAppend(SkRasterPipelineOp, void*);
+
+    // Replaces common sequences of stages, ending with the one being appended, with a single stage
+    // that does the same work. Returns true if it appended the fused stage.
+    bool appendFusedStage(SkRasterPipelineOp, void*);
     int stagesNeeded() const;
 
     void addMemoryContext(SkRasterPipeline_MemoryCtx*, int bytesPerPixel, bool load, bool store);
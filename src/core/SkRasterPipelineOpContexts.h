@@ -97,6 +97,15 @@ struct SkRasterPipeline_TileCtx {
     int   mirrorBiasDir = -1;
 };
 
+// For bilerp_tiled_8888. The sample coordinates have already been tiled into the image, and the
+// neighbors that fall off a repeating edge wrap around to the opposite one. All other edges clamp,
+// which is also what mirror tiling needs once the coordinates are mirrored.
+struct SkRasterPipeline_BilerpTileCtx {
+    const SkRasterPipeline_GatherCtx* gather;
+    bool repeatX = false;
+    bool repeatY = false;
+};
+
 struct SkRasterPipeline_DecalTileCtx {
     uint32_t mask[SkRasterPipeline_kMaxStride];
     float    limit_x;
@@ -165,11 +174,50 @@ struct SkRasterPipeline_GradientCtx {
     float* ts;
 };
 
+// A gradient with stops at arbitrary positions, plus the stop to start searching from for t in
+// each of cellCount equal parts of [0,1]. gradient.ts ends with +inf, past the last stop.
+struct SkRasterPipeline_IndexedGradientCtx {
+    SkRasterPipeline_GradientCtx gradient;
+    const uint32_t* firstStop;  // cellCount + 1 entries, the last for t >= 1
+    uint32_t cellCount;
+    uint32_t maxSteps;          // the most stops that fall in any one cell
+};
+
 struct SkRasterPipeline_EvenlySpaced2StopGradientCtx {
     float f[4];
     float b[4];
 };
 
+// Fractal noise or turbulence, as in SVG's feTurbulence. See SkPerlinNoiseShader.
+struct SkRasterPipeline_PerlinNoiseCtx {
+    const uint8_t* latticeSelector;  // 256 entries
+    const float* gradient;           // 4 channels of 256 (x,y) gradients
+    const int* stitching;            // width, wrapX, height, wrapY for each octave, or null
+    float offsetX, offsetY;          // added to the pixel coordinates before rounding them
+    float baseFrequencyX, baseFrequencyY;
+    int numOctaves;
+    bool fractalNoise;               // or else turbulence
+};
+
+// The corners are ordered upper-left, upper-right, lower-left, lower-right; that is, bit 0 is set
+// for the right corners and bit 1 for the lower ones.
+struct SkRasterPipeline_RRectCoverageCtx {
+    float left, top, right, bottom;
+    float centerX[4], centerY[4];    // the centers of the corner ellipses
+    float invRX2[4], invRY2[4];      // 1/rx^2 and 1/ry^2, or 0 for a square corner
+};
+
+// Applies a gainmap to the base image color in r,g,b,a. See SkGainmapShader.
+struct SkRasterPipeline_GainmapCtx {
+    const float* gainmap;             // the gainmap's r,g,b,a for each pixel, as from store_src
+    float logGainScale[3];            // W * (log(ratioMax) - log(ratioMin))
+    float logGainBias[3];             // W * log(ratioMin)
+    float gamma[3];
+    float epsilonBase[3], epsilonOther[3];
+    int channel;                      // -1 to use the gainmap's r,g,b, or else one channel for all
+    bool noGamma;
+};
+
 struct SkRasterPipeline_2PtConicalCtx {
     uint32_t fMask[SkRasterPipeline_kMaxStride_highp];
     float    fP0,
@@ -211,6 +259,15 @@ struct SkRasterPipeline_BinaryOpCtx {
     SkRPOffset src;
 };
 
+// For binary ops whose right-hand side is read from where it lives, rather than from a copy on the
+// stack. `src` points to value slots for the `_from_slots` ops, or to scalars which are broadcast
+// to every lane (uniforms or immutable values) for the `_from_scalars` ops.
+struct SkRasterPipeline_MemoryBinaryOpCtx {
+    float* dst;
+    const float* src;
+    int numSlots;
+};
+
 struct SkRasterPipeline_TernaryOpCtx {
     SkRPOffset dst;
     SkRPOffset delta;
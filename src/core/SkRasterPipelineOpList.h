@@ -27,7 +27,7 @@
     M(alpha_to_gray) M(alpha_to_gray_dst)                          \
     M(alpha_to_red) M(alpha_to_red_dst)                            \
     M(bt709_luminance_or_luma_to_alpha) M(bt709_luminance_or_luma_to_rgb) \
-    M(bilerp_clamp_8888)                                           \
+    M(bilerp_clamp_8888) M(bilerp_tiled_8888)                      \
     M(load_src) M(store_src) M(store_src_a) M(load_dst) M(store_dst) \
     M(scale_u8) M(scale_565) M(scale_1_float) M(scale_native)      \
     M( lerp_u8) M( lerp_565) M( lerp_1_float) M(lerp_native)       \
@@ -36,16 +36,19 @@
     M(clear) M(modulate) M(multiply) M(plus_) M(screen) M(xor_)    \
     M(darken) M(difference)                                        \
     M(exclusion) M(hardlight) M(lighten) M(overlay)                \
-    M(srcover_rgba_8888)                                           \
+    M(srcover_rgba_8888) M(load_8888_premul)                       \
     M(matrix_translate) M(matrix_scale_translate)                  \
-    M(matrix_2x3)                                                  \
+    M(matrix_2x3) M(matrix_4x5)                                    \
     M(matrix_perspective)                                          \
     M(decal_x)    M(decal_y)   M(decal_x_and_y)                    \
     M(check_decal_mask)                                            \
     M(clamp_x_1) M(mirror_x_1) M(repeat_x_1)                       \
+    M(mirror_x)   M(repeat_x)                                      \
+    M(mirror_y)   M(repeat_y)                                      \
     M(clamp_x_and_y)                                               \
     M(evenly_spaced_gradient)                                      \
     M(gradient)                                                    \
+    M(indexed_gradient)                                            \
     M(evenly_spaced_2_stop_gradient)                               \
     M(xy_to_unit_angle)                                            \
     M(xy_to_radius)                                                \
@@ -146,6 +149,14 @@
         M(cmpne_n_floats) M(cmpne_float)  M(cmpne_2_floats) M(cmpne_3_floats) M(cmpne_4_floats) \
     M(cmpne_imm_int)                                                                            \
         M(cmpne_n_ints)   M(cmpne_int)    M(cmpne_2_ints)   M(cmpne_3_ints)   M(cmpne_4_ints)   \
+    M(add_n_floats_from_slots)     M(add_n_ints_from_slots)                                     \
+    M(sub_n_floats_from_slots)     M(sub_n_ints_from_slots)                                     \
+    M(mul_n_floats_from_slots)     M(mul_n_ints_from_slots)                                     \
+    M(div_n_floats_from_slots)     M(div_n_ints_from_slots)                                     \
+    M(add_n_floats_from_scalars)   M(add_n_ints_from_scalars)                                   \
+    M(sub_n_floats_from_scalars)   M(sub_n_ints_from_scalars)                                   \
+    M(mul_n_floats_from_scalars)   M(mul_n_ints_from_scalars)                                   \
+    M(div_n_floats_from_scalars)   M(div_n_ints_from_scalars)                                   \
     M(trace_line)         M(trace_var)    M(trace_enter)    M(trace_exit)     M(trace_scope)
 
 // `SK_RASTER_PIPELINE_OPS_HIGHP_ONLY` defines ops that are only available in highp; this subset
@@ -170,15 +181,16 @@
     M(byte_tables)                                                             \
     M(colorburn) M(colordodge) M(softlight)                                    \
     M(hue) M(saturation) M(color) M(luminosity)                                \
-    M(matrix_3x3) M(matrix_3x4) M(matrix_4x5) M(matrix_4x3)                    \
+    M(matrix_3x3) M(matrix_3x4) M(matrix_4x3)                                  \
     M(parametric) M(gamma_) M(PQish) M(HLGish) M(HLGinvish)                    \
     M(rgb_to_hsl) M(hsl_to_rgb)                                                \
     M(css_lab_to_xyz) M(css_oklab_to_linear_srgb)                              \
     M(css_hcl_to_lab)                                                          \
     M(css_hsl_to_srgb) M(css_hwb_to_srgb)                                      \
     M(gauss_a_to_rgba)                                                         \
-    M(mirror_x)   M(repeat_x)                                                  \
-    M(mirror_y)   M(repeat_y)                                                  \
+    M(perlin_noise)                                                            \
+    M(rrect_coverage)                                                          \
+    M(gainmap_apply)                                                           \
     M(negate_x)                                                                \
     M(bicubic_clamp_8888)                                                      \
     M(bilinear_setup)                                                          \
@@ -26,6 +26,7 @@
 #include "src/base/SkAutoMalloc.h"
 #include "src/base/SkMathPriv.h"
 #include "src/base/SkSafeMath.h"
+#include "src/core/SkDescriptor.h"
 #include "src/core/SkMatrixPriv.h"
 #include "src/core/SkMipmapBuilder.h"
 #include "src/core/SkWriteBuffer.h"
@@ -320,6 +321,15 @@ sk_sp<SkData> SkReadBuffer::readByteArrayAsData() {
         return nullptr;
     }
 
+    if (fBackingData) {
+        const char* bytes = static_cast<const char*>(this->skipByteArray(&numBytes));
+        if (!bytes) {
+            return nullptr;
+        }
+        const size_t offset = bytes - static_cast<const char*>(fBackingData->data());
+        return SkData::MakeSubset(fBackingData.get(), offset, numBytes);
+    }
+
     SkAutoMalloc buffer(numBytes);
     if (!this->readByteArray(buffer.get(), numBytes)) {
         return nullptr;
@@ -327,6 +337,23 @@ sk_sp<SkData> SkReadBuffer::readByteArrayAsData() {
     return SkData::MakeFromMalloc(buffer.release(), numBytes);
 }
 
+const SkDescriptor* SkReadBuffer::readDescriptor() {
+    // 0 means the descriptor follows; otherwise this is one we've read before, counting from 1.
+    const uint32_t index = this->readUInt();
+    if (index > 0) {
+        if (!this->validate(index <= (uint32_t)fDescriptors.size())) {
+            return nullptr;
+        }
+        return fDescriptors[index - 1];
+    }
+    const SkDescriptor* desc = SkDescriptor::ReadInPlace(*this);
+    if (!this->validate(desc != nullptr)) {
+        return nullptr;
+    }
+    fDescriptors.push_back(desc);
+    return desc;
+}
+
 uint32_t SkReadBuffer::getArrayCount() {
     const size_t inc = sizeof(uint32_t);
     if (!this->validate(IsPtrAlign4(fCurr) && this->isAvailable(inc))) {
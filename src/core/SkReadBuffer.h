@@ -10,6 +10,7 @@
 
 #include "include/core/SkColor.h"
 #include "include/core/SkColorFilter.h"
+#include "include/core/SkData.h"
 #include "include/core/SkFlattenable.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkPaint.h"
@@ -23,6 +24,7 @@
 #include "include/core/SkShader.h"
 #include "include/private/base/SkAlign.h"
 #include "include/private/base/SkAssert.h"
+#include "include/private/base/SkTArray.h"
 #include "src/core/SkBlenderBase.h"
 #include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkMaskFilterBase.h"
@@ -37,7 +39,7 @@
 #include <cstdint>
 
 class SkBlender;
-class SkData;
+class SkDescriptor;
 class SkImage;
 class SkM44;
 class SkMaskFilter;
@@ -162,6 +164,11 @@ public:
 
     sk_sp<SkData> readByteArrayAsData();
 
+    // Reads a descriptor written by SkWriteBuffer::writeDescriptor(). The result points into the
+    // buffer's memory rather than being copied out of it, so it lives only as long as that does.
+    // Returns nullptr and invalidates the buffer if there isn't a valid descriptor to read.
+    const SkDescriptor* readDescriptor();
+
     // helpers to get info about arrays and binary data
     uint32_t getArrayCount();
 
@@ -191,6 +198,16 @@ public:
     bool allowSkSL() const { return fAllowSkSL; }
     void setAllowSkSL(bool allow) { fAllowSkSL = allow; }
 
+    /**
+     *  Declares that the buffer's memory lies within data. Byte arrays read with
+     *  readByteArrayAsData() (e.g. encoded images) then reference data instead of being copied.
+     */
+    void setBackingData(sk_sp<SkData> data) {
+        SkASSERT(!data || (fBase >= (const char*)data->bytes() &&
+                           fStop <= (const char*)data->bytes() + data->size()));
+        fBackingData = std::move(data);
+    }
+
     /**
      *  If isValid is false, sets the buffer to be "invalid". Returns true if the buffer
      *  is still valid.
@@ -257,6 +274,11 @@ private:
 
     SkDeserialProcs fProcs;
 
+    sk_sp<SkData> fBackingData;
+
+    // Descriptors read so far, in the order they were first written.
+    skia_private::TArray<const SkDescriptor*> fDescriptors;
+
     static bool IsPtrAlign4(const void* ptr) {
         return SkIsAlign4((uintptr_t)ptr);
     }
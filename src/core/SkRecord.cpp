@@ -8,6 +8,8 @@
 #include "src/core/SkRecord.h"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 SkRecord::~SkRecord() {
     Destroyer destroyer;
@@ -22,6 +24,24 @@ void SkRecord::grow() {
     fRecords.realloc(fReserved);
 }
 
+void SkRecord::splice(sk_sp<SkRecord> child) {
+    SkASSERT(child && child.get() != this);
+    if (child->fCount == 0) {
+        return;
+    }
+    if (fCount + child->fCount > fReserved) {
+        fReserved = std::max(fReserved * 2, fCount + child->fCount);
+        fRecords.realloc(fReserved);
+    }
+    memcpy(fRecords.get() + fCount, child->fRecords.get(), child->fCount * sizeof(Record));
+    fCount += child->fCount;
+    // We destroy these commands now, so child must not.
+    child->fCount = 0;
+
+    fApproxBytesAllocated += child->bytesUsed();
+    fSpliced.push_back(std::move(child));
+}
+
 size_t SkRecord::bytesUsed() const {
     size_t bytes = fApproxBytesAllocated + sizeof(SkRecord);
     return bytes;
@@ -34,4 +54,11 @@ void SkRecord::defrag() {
     Record* noops = std::remove_if(fRecords.get(), fRecords.get() + fCount,
                                    [](Record op) { return op.type() == SkRecords::NoOp_Type; });
     fCount = noops - fRecords.get();
+
+    // Doubling may have left up to half of fRecords unused. Records are usually done growing by
+    // the time they're defragged, so give that back.
+    if (fCount > 0 && fCount < fReserved) {
+        fRecords.realloc(fCount);
+        fReserved = fCount;
+    }
 }
@@ -10,6 +10,7 @@
 
 #include "include/core/SkRefCnt.h"
 #include "include/private/base/SkAssert.h"
+#include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTemplates.h"
 #include "src/base/SkArenaAlloc.h"
 #include "src/core/SkRecords.h"
@@ -89,6 +90,11 @@ public:
         return fRecords[i].set(this->allocCommand<T>());
     }
 
+    // Move all of child's commands onto the end of this SkRecord, leaving child empty.
+    // Only the command pointers are copied: the commands themselves stay in child's memory,
+    // and this SkRecord keeps child alive until it is destroyed.
+    void splice(sk_sp<SkRecord> child);
+
     // Does not return the bytes in any pointers embedded in the Records; callers
     // need to iterate with a visitor to measure those they care for.
     size_t bytesUsed() const;
@@ -180,6 +186,9 @@ private:
     // chunks, returning a stable handle to that data for later retrieval.
     SkArenaAlloc fAlloc{256};
     size_t       fApproxBytesAllocated{0};
+
+    // SkRecords spliced into this one, which own the memory of some of our commands.
+    skia_private::TArray<sk_sp<SkRecord>> fSpliced;
 };
 
 #endif//SkRecord_DEFINED
@@ -0,0 +1,539 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkRecordDamage.h"
+
+#include "include/core/SkBBHFactory.h"
+#include "include/core/SkBlender.h"
+#include "include/core/SkColorFilter.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageFilter.h"
+#include "include/core/SkMaskFilter.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPathEffect.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkRSXform.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkSamplingOptions.h"
+#include "include/core/SkShader.h"
+#include "include/core/SkTextBlob.h"
+#include "include/core/SkVertices.h"
+#include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
+#include "src/core/SkBigPicture.h"
+#include "src/core/SkChecksum.h"
+#include "src/core/SkPathPriv.h"
+#include "src/core/SkPicturePriv.h"
+#include "src/core/SkRecord.h"
+#include "src/core/SkRecordDraw.h"
+#include "src/core/SkRecords.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+using namespace skia_private;
+
+namespace {
+
+// Diffing costs O((N+M)*D) time and O(D^2) memory for D inserted or removed ops. Past this many,
+// the frames are different enough that damaging the whole changed span is about as good.
+static constexpr int kMaxEdits = 256;
+
+class Hasher {
+public:
+    explicit Hasher(uint64_t seed) : fHash(seed) {}
+
+    uint64_t value() const { return fHash; }
+
+    template <typename T>
+    void mix(const T& v) {
+        static_assert(std::is_trivially_copyable<T>::value);
+        fHash = SkChecksum::Hash64(&v, sizeof(T), fHash);
+    }
+
+    template <typename T>
+    void mixArray(const T* v, size_t count) {
+        static_assert(std::is_trivially_copyable<T>::value);
+        this->mix(count);
+        if (count) {
+            fHash = SkChecksum::Hash64(v, count * sizeof(T), fHash);
+        }
+    }
+
+    void mix(const SkMatrix& matrix) {
+        SkScalar m[9];
+        matrix.get9(m);
+        this->mixArray(m, 9);
+    }
+
+    void mix(const SkSamplingOptions& sampling) {
+        this->mix(sampling.maxAniso);
+        this->mix(sampling.useCubic);
+        this->mix(sampling.cubic.B);
+        this->mix(sampling.cubic.C);
+        this->mix(sampling.filter);
+        this->mix(sampling.mipmap);
+    }
+
+    // Effects are compared by identity rather than by what they'd draw. Both records hold a ref
+    // on every effect they use, so distinct effects can't share an address here.
+    void mix(const SkPaint& paint) {
+        this->mix(paint.getColor4f());
+        this->mix(paint.getStrokeWidth());
+        this->mix(paint.getStrokeMiter());
+        this->mix(paint.getStyle());
+        this->mix(paint.getStrokeCap());
+        this->mix(paint.getStrokeJoin());
+        this->mix(paint.isAntiAlias());
+        this->mix(paint.isDither());
+        this->mix(paint.getShader());
+        this->mix(paint.getColorFilter());
+        this->mix(paint.getBlender());
+        this->mix(paint.getPathEffect());
+        this->mix(paint.getMaskFilter());
+        this->mix(paint.getImageFilter());
+    }
+
+    void mix(const SkPaint* paint) {
+        this->mix(paint != nullptr);
+        if (paint) {
+            this->mix(*paint);
+        }
+    }
+
+    void mix(const SkRect* rect) {
+        this->mix(rect != nullptr);
+        if (rect) {
+            this->mix(*rect);
+        }
+    }
+
+    void mix(const SkPath& path) {
+        this->mix(path.getFillType());
+        this->mixArray(SkPathPriv::VerbData(path), path.countVerbs());
+        this->mixArray(SkPathPriv::PointData(path), path.countPoints());
+        this->mixArray(SkPathPriv::ConicWeightData(path), SkPathPriv::ConicWeightCnt(path));
+    }
+
+    void mix(const SkRegion& region) {
+        for (SkRegion::Iterator iter(region); !iter.done(); iter.next()) {
+            this->mix(iter.rect());
+        }
+    }
+
+    void mix(const SkImage* image) { this->mix(image ? image->uniqueID() : 0); }
+
+private:
+    uint64_t fHash;
+};
+
+// Builds the sequence of keys for the ops of a record that draw, along with their indices.
+class OpKeys {
+public:
+    explicit OpKeys(uint64_t salt) : fSalt(salt) { fState.push_back(0); }
+
+    void setCurrentOp(int currentOp) { fCurrentOp = currentOp; }
+
+    const std::vector<uint64_t>& keys() const { return fKeys; }
+    const std::vector<int>& indices() const { return fIndices; }
+
+    template <typename T>
+    void operator()(const T& op) {
+        Hasher hasher(T::kType);
+        if (!hash(op, &hasher)) {
+            // Unique to this op and this record, so it never matches anything.
+            hasher.mix(fSalt);
+            hasher.mix(fCurrentOp);
+        }
+        this->update(op, hasher.value());
+    }
+
+private:
+    // State changes are folded into the key of every op they apply to.
+    void pushState(uint64_t state) { fState.push_back(state); }
+    void popState() {
+        if (fState.size() > 1) {
+            fState.pop_back();
+        }
+    }
+    void mixState(uint64_t content) {
+        Hasher hasher(fState.back());
+        hasher.mix(content);
+        fState.back() = hasher.value();
+    }
+    uint64_t drawKey(uint64_t content) const {
+        Hasher hasher(fState.back());
+        hasher.mix(content);
+        return hasher.value();
+    }
+    void appendDraw(uint64_t content) {
+        fKeys.push_back(this->drawKey(content));
+        fIndices.push_back(fCurrentOp);
+    }
+
+    void update(const SkRecords::NoOp&, uint64_t) {}
+    void update(const SkRecords::DrawAnnotation&, uint64_t) {}
+    void update(const SkRecords::Save&, uint64_t) { this->pushState(fState.back()); }
+    void update(const SkRecords::SaveBehind&, uint64_t content) {
+        this->pushState(this->drawKey(content));
+    }
+    void update(const SkRecords::SaveLayer&, uint64_t content) {
+        // The layer itself draws when it's restored, over the bounds of everything inside it.
+        this->appendDraw(content);
+        this->pushState(this->drawKey(content));
+    }
+    void update(const SkRecords::Restore&, uint64_t) { this->popState(); }
+
+    template <typename T>
+    void update(const T&, uint64_t content) {
+        if (T::kTags & SkRecords::kDraw_Tag) {
+            this->appendDraw(content);
+        } else {
+            this->mixState(content);
+        }
+    }
+
+    // Ops that can't be keyed by their content always count as changed.
+    template <typename T>
+    static bool hash(const T&, Hasher*) { return false; }
+
+    static bool hash(const SkRecords::NoOp&, Hasher*) { return true; }
+    static bool hash(const SkRecords::Restore&, Hasher*) { return true; }
+    static bool hash(const SkRecords::Save&, Hasher*) { return true; }
+    static bool hash(const SkRecords::DrawAnnotation&, Hasher*) { return true; }
+    static bool hash(const SkRecords::ResetClip&, Hasher*) { return true; }
+
+    static bool hash(const SkRecords::SaveLayer& op, Hasher* h) {
+        h->mix(static_cast<const SkRect*>(op.bounds));
+        h->mix(static_cast<const SkPaint*>(op.paint));
+        h->mix(op.backdrop.get());
+        h->mix(op.saveLayerFlags);
+        h->mix(op.backdropScale);
+        h->mix(op.filters.size());
+        for (size_t i = 0; i < op.filters.size(); i++) {
+            h->mix(op.filters[i].get());
+        }
+        return true;
+    }
+    static bool hash(const SkRecords::SaveBehind& op, Hasher* h) {
+        h->mix(static_cast<const SkRect*>(op.subset));
+        return true;
+    }
+
+    static bool hash(const SkRecords::SetMatrix& op, Hasher* h) {
+        h->mix(static_cast<const SkMatrix&>(op.matrix));
+        return true;
+    }
+    static bool hash(const SkRecords::Concat& op, Hasher* h) {
+        h->mix(static_cast<const SkMatrix&>(op.matrix));
+        return true;
+    }
+    static bool hash(const SkRecords::SetM44& op, Hasher* h) { h->mix(op.matrix); return true; }
+    static bool hash(const SkRecords::Concat44& op, Hasher* h) { h->mix(op.matrix); return true; }
+    static bool hash(const SkRecords::Translate& op, Hasher* h) {
+        h->mix(op.dx);
+        h->mix(op.dy);
+        return true;
+    }
+    static bool hash(const SkRecords::Scale& op, Hasher* h) {
+        h->mix(op.sx);
+        h->mix(op.sy);
+        return true;
+    }
+
+    static void mix(const SkRecords::ClipOpAndAA& opAA, Hasher* h) {
+        h->mix(opAA.op());
+        h->mix(opAA.aa());
+    }
+    static bool hash(const SkRecords::ClipPath& op, Hasher* h) {
+        h->mix(static_cast<const SkPath&>(op.path));
+        mix(op.opAA, h);
+        return true;
+    }
+    static bool hash(const SkRecords::ClipRRect& op, Hasher* h) {
+        h->mix(op.rrect);
+        mix(op.opAA, h);
+        return true;
+    }
+    static bool hash(const SkRecords::ClipRect& op, Hasher* h) {
+        h->mix(op.rect);
+        mix(op.opAA, h);
+        return true;
+    }
+    static bool hash(const SkRecords::ClipRegion& op, Hasher* h) {
+        h->mix(op.region);
+        h->mix(op.op);
+        return true;
+    }
+    static bool hash(const SkRecords::ClipShader& op, Hasher* h) {
+        h->mix(op.shader.get());
+        h->mix(op.op);
+        return true;
+    }
+
+    static bool hash(const SkRecords::DrawArc& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.oval);
+        h->mix(op.startAngle);
+        h->mix(op.sweepAngle);
+        h->mix(op.useCenter);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawDRRect& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.outer);
+        h->mix(op.inner);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawImage& op, Hasher* h) {
+        h->mix(static_cast<const SkPaint*>(op.paint));
+        h->mix(op.image.get());
+        h->mix(op.left);
+        h->mix(op.top);
+        h->mix(op.sampling);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawImageRect& op, Hasher* h) {
+        h->mix(static_cast<const SkPaint*>(op.paint));
+        h->mix(op.image.get());
+        h->mix(op.src);
+        h->mix(op.dst);
+        h->mix(op.sampling);
+        h->mix(op.constraint);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawOval& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.oval);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawPaint& op, Hasher* h) { h->mix(op.paint); return true; }
+    static bool hash(const SkRecords::DrawBehind& op, Hasher* h) { h->mix(op.paint); return true; }
+    static bool hash(const SkRecords::DrawPath& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(static_cast<const SkPath&>(op.path));
+        return true;
+    }
+    static bool hash(const SkRecords::DrawPicture& op, Hasher* h) {
+        // Pictures are immutable, so their unique ID stands in for their content.
+        h->mix(static_cast<const SkPaint*>(op.paint));
+        h->mix(op.picture->uniqueID());
+        h->mix(static_cast<const SkMatrix&>(op.matrix));
+        return true;
+    }
+    static bool hash(const SkRecords::DrawPoints& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.mode);
+        h->mixArray(static_cast<const SkPoint*>(op.pts), op.count);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawRRect& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.rrect);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawRect& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.rect);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawRegion& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.region);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawTextBlob& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.blob->uniqueID());
+        h->mix(op.x);
+        h->mix(op.y);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawPatch& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mixArray(static_cast<const SkPoint*>(op.cubics), op.cubics ? 12 : 0);
+        h->mixArray(static_cast<const SkColor*>(op.colors), op.colors ? 4 : 0);
+        h->mixArray(static_cast<const SkPoint*>(op.texCoords), op.texCoords ? 4 : 0);
+        h->mix(op.bmode);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawAtlas& op, Hasher* h) {
+        h->mix(static_cast<const SkPaint*>(op.paint));
+        h->mix(op.atlas.get());
+        h->mixArray(static_cast<const SkRSXform*>(op.xforms), op.count);
+        h->mixArray(static_cast<const SkRect*>(op.texs), op.count);
+        h->mixArray(static_cast<const SkColor*>(op.colors), op.colors ? op.count : 0);
+        h->mix(op.mode);
+        h->mix(op.sampling);
+        h->mix(static_cast<const SkRect*>(op.cull));
+        return true;
+    }
+    static bool hash(const SkRecords::DrawVertices& op, Hasher* h) {
+        h->mix(op.paint);
+        h->mix(op.vertices->uniqueID());
+        h->mix(op.bmode);
+        return true;
+    }
+    static bool hash(const SkRecords::DrawEdgeAAQuad& op, Hasher* h) {
+        h->mix(op.rect);
+        h->mixArray(static_cast<const SkPoint*>(op.clip), op.clip ? 4 : 0);
+        h->mix(op.aa);
+        h->mix(op.color);
+        h->mix(op.mode);
+        return true;
+    }
+
+    const uint64_t        fSalt;
+    int                   fCurrentOp = 0;
+    std::vector<uint64_t> fState;
+    std::vector<uint64_t> fKeys;
+    std::vector<int>      fIndices;
+};
+
+static OpKeys make_keys(const SkRecord& record, uint64_t salt) {
+    OpKeys keys(salt);
+    for (int i = 0; i < record.count(); i++) {
+        keys.setCurrentOp(i);
+        record.visit(i, keys);
+    }
+    return keys;
+}
+
+// Marks the elements of a and b that aren't part of their longest common subsequence, using
+// Myers' O((N+M)D) diff. Returns false if that would take more than maxEdits edits.
+static bool diff(const uint64_t a[], int n, const uint64_t b[], int m, int maxEdits,
+                 bool aChanged[], bool bChanged[]) {
+    const int maxD = std::min(n + m, maxEdits);
+    const int offset = maxD + 1;
+
+    // v[offset + k] is the furthest x reached on diagonal k = x - y. trace[d] is the part of v
+    // that step d produced, diagonals -d through d, kept to walk the edit path back.
+    std::vector<int> v(2 * offset + 1, 0);
+    std::vector<std::vector<int>> trace;
+    int edits = -1;
+    for (int d = 0; d <= maxD && edits < 0; d++) {
+        for (int k = -d; k <= d; k += 2) {
+            const bool down = k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]);
+            int x = down ? v[offset + k + 1] : v[offset + k - 1] + 1;
+            int y = x - k;
+            while (x < n && y < m && a[x] == b[y]) {
+                x++;
+                y++;
+            }
+            v[offset + k] = x;
+            if (x >= n && y >= m) {
+                edits = d;
+                break;
+            }
+        }
+        trace.emplace_back(v.begin() + offset - d, v.begin() + offset + d + 1);
+    }
+    if (edits < 0) {
+        return false;
+    }
+
+    int x = n, y = m;
+    for (int d = edits; d > 0; d--) {
+        const std::vector<int>& prev = trace[d - 1];
+        auto furthest = [&](int k) { return prev[k + d - 1]; };
+
+        const int k = x - y;
+        const bool down = k == -d || (k != d && furthest(k - 1) < furthest(k + 1));
+        const int prevK = down ? k + 1 : k - 1;
+        const int prevX = furthest(prevK),
+                  prevY = prevX - prevK;
+        if (down) {
+            bChanged[prevY] = true;  // inserted
+        } else {
+            aChanged[prevX] = true;  // removed
+        }
+        x = prevX;
+        y = prevY;
+    }
+    return true;
+}
+
+static void add_damage(SkRegion* damage,
+                       const SkRecord& record,
+                       const SkRect& cullRect,
+                       const int indices[],
+                       const bool changed[],
+                       int count) {
+    if (std::none_of(changed, changed + count, [](bool c) { return c; })) {
+        return;
+    }
+    AutoTArray<SkRect> bounds(record.count());
+    AutoTMalloc<SkBBoxHierarchy::Metadata> meta(record.count());
+    SkRecordFillBounds(cullRect, record, bounds.data(), meta);
+
+    for (int i = 0; i < count; i++) {
+        if (changed[i]) {
+            const SkIRect rect = bounds[indices[i]].roundOut();
+            if (!rect.isEmpty()) {
+                damage->op(rect, SkRegion::kUnion_Op);
+            }
+        }
+    }
+}
+
+}  // namespace
+
+SkRegion SkRecordDamage(const SkRect& cullRect, const SkRecord& before, const SkRecord& after) {
+    const OpKeys beforeKeys = make_keys(before, 1),
+                 afterKeys  = make_keys(after, 2);
+    const std::vector<uint64_t>& a = beforeKeys.keys();
+    const std::vector<uint64_t>& b = afterKeys.keys();
+
+    // Most frames only change in the middle, so only diff what's between the common ends.
+    size_t prefix = 0;
+    while (prefix < a.size() && prefix < b.size() && a[prefix] == b[prefix]) {
+        prefix++;
+    }
+    size_t suffix = 0;
+    while (suffix < a.size() - prefix && suffix < b.size() - prefix &&
+           a[a.size() - 1 - suffix] == b[b.size() - 1 - suffix]) {
+        suffix++;
+    }
+    const int n = SkToInt(a.size() - prefix - suffix),
+              m = SkToInt(b.size() - prefix - suffix);
+
+    SkRegion damage;
+    if (n == 0 && m == 0) {
+        return damage;
+    }
+
+    AutoTArray<bool> aChanged(n), bChanged(m);
+    std::fill_n(aChanged.data(), n, false);
+    std::fill_n(bChanged.data(), m, false);
+    if (!diff(a.data() + prefix, n, b.data() + prefix, m, kMaxEdits,
+              aChanged.data(), bChanged.data())) {
+        std::fill_n(aChanged.data(), n, true);
+        std::fill_n(bChanged.data(), m, true);
+    }
+
+    add_damage(&damage, before, cullRect, beforeKeys.indices().data() + prefix,
+               aChanged.data(), n);
+    add_damage(&damage, after, cullRect, afterKeys.indices().data() + prefix,
+               bChanged.data(), m);
+    return damage;
+}
+
+SkRegion SkPictureDamage(const SkPicture& before, const SkPicture& after) {
+    SkRect cullRect = before.cullRect();
+    cullRect.join(after.cullRect());
+
+    const SkBigPicture* bigBefore = SkPicturePriv::AsSkBigPicture(sk_ref_sp(&before));
+    const SkBigPicture* bigAfter  = SkPicturePriv::AsSkBigPicture(sk_ref_sp(&after));
+    if (!bigBefore || !bigAfter) {
+        return SkRegion(cullRect.roundOut());
+    }
+    return SkRecordDamage(cullRect, *bigBefore->record(), *bigAfter->record());
+}
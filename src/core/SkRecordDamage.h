@@ -0,0 +1,41 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkRecordDamage_DEFINED
+#define SkRecordDamage_DEFINED
+
+#include "include/core/SkRegion.h"
+
+class SkPicture;
+class SkRecord;
+struct SkRect;
+
+/**
+ *  Returns the region that may render differently when after is played back in place of before,
+ *  in the records' identity (recording) space, rounded out to whole pixels. Callers re-rendering
+ *  a frame from a new picture can clip its playback to this region and keep the old pixels
+ *  everywhere else.
+ *
+ *  Every drawing op is keyed by a hash of its content (geometry, paint, and the identity of any
+ *  images, text blobs, pictures or effects it references) combined with the matrix, clip and
+ *  layer state it draws under. The sequences of keys are diffed, and the bounds of every op that
+ *  only appears in one of the records (from SkRecordFillBounds(), so including any layer filter
+ *  outsets, but not shrunk by clips) are added to the damage. Ops that can't be keyed by content, like drawables,
+ *  always count as changed.
+ *
+ *  cullRect is the bounds both records were recorded into. If the records differ by too many ops
+ *  to diff cheaply, everything between their first and last difference is damaged.
+ */
+SkRegion SkRecordDamage(const SkRect& cullRect, const SkRecord& before, const SkRecord& after);
+
+/**
+ *  SkRecordDamage() for two pictures, using the union of their cull rects. Pictures that aren't
+ *  backed by an SkRecord (e.g. those with a single op) are damaged everywhere they draw.
+ */
+SkRegion SkPictureDamage(const SkPicture& before, const SkPicture& after);
+
+#endif  // SkRecordDamage_DEFINED
@@ -7,19 +7,36 @@
 
 #include "src/core/SkRecordOpts.h"
 
+#include "include/core/SkBBHFactory.h"
 #include "include/core/SkBlendMode.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkClipOp.h"
 #include "include/core/SkColor.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPoint.h"
+#include "include/core/SkRRect.h"
+#include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkScalar.h"
 #include "include/private/base/SkMath.h"
+#include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
+#include "src/core/SkChecksum.h"
+#include "src/core/SkPaintPriv.h"
+#include "src/core/SkPathPriv.h"
 #include "src/core/SkRecord.h"
+#include "src/core/SkRecordDraw.h"
 #include "src/core/SkRecordPattern.h"
 #include "src/core/SkRecords.h"
+#include "src/core/SkTHash.h"
 
 #include <cstdint>
 #include <optional>
+#include <type_traits>
+#include <utility>
 
 using namespace SkRecords;
 
@@ -266,6 +283,354 @@ void SkRecordMergeSvgOpacityAndFilterLayers(SkRecord* record) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Paths that are rebuilt for every draw each hold their own points and verbs, even when they're
+// identical. Pointing all the equal paths at the first one's SkPathRef lets the others go.
+class PathSharer {
+public:
+    void operator()(DrawPath* op)      { this->share(&op->path); }
+    void operator()(ClipPath* op)      { this->share(&op->path); }
+    void operator()(DrawShadowRec* op) { this->share(&op->path); }
+    template <typename T>
+    void operator()(T*) {}
+
+private:
+    static uint32_t Hash(const SkPath& path) {
+        uint32_t hash = SkChecksum::Hash32(SkPathPriv::VerbData(path), path.countVerbs(),
+                                           (uint32_t)path.getFillType());
+        hash = SkChecksum::Hash32(SkPathPriv::PointData(path),
+                                  path.countPoints() * sizeof(SkPoint), hash);
+        return SkChecksum::Hash32(SkPathPriv::ConicWeightData(path),
+                                  SkPathPriv::ConicWeightCnt(path) * sizeof(SkScalar), hash);
+    }
+
+    void share(SkPath* path) {
+        if (path->isEmpty()) {
+            return;
+        }
+        const uint32_t hash = Hash(*path);
+        if (const SkPath** first = fFirst.find(hash)) {
+            // On a hash collision we just keep the copy.
+            if (**first == *path && (*first)->isVolatile() == path->isVolatile()) {
+                *path = **first;
+            }
+        } else {
+            fFirst.set(hash, path);
+        }
+    }
+
+    // The first path seen with each hash. These live in the SkRecord's ops.
+    skia_private::THashMap<uint32_t, const SkPath*> fFirst;
+};
+
+void SkRecordShareDuplicatePaths(SkRecord* record) {
+    PathSharer sharer;
+    for (int i = 0; i < record->count(); i++) {
+        record->mutate(i, sharer);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// The passes below need to know where ops land, so they follow the CTM the same way FillBounds
+// does. Everything is in the picture's identity space, and like the BBH they take anything
+// outside the cull rect to be undefined.
+class MatrixTracker {
+public:
+    const SkMatrix& ctm() const { return fCTM; }
+
+    template <typename T> void update(const T&) {}
+    void update(const Restore& op)   { fCTM = op.matrix; }
+    void update(const SetMatrix& op) { fCTM = op.matrix; }
+    void update(const SetM44& op)    { fCTM = op.matrix.asM33(); }
+    void update(const Concat44& op)  { fCTM.preConcat(op.matrix.asM33()); }
+    void update(const Concat& op)    { fCTM.preConcat(op.matrix); }
+    void update(const Scale& op)     { fCTM.preScale(op.sx, op.sy); }
+    void update(const Translate& op) { fCTM.preTranslate(op.dx, op.dy); }
+
+private:
+    SkMatrix fCTM = SkMatrix::I();
+};
+
+void SkRecordNoopCulledDraws(SkRecord* record, const SkRect& cullRect) {
+    if (cullRect.isEmpty()) {
+        return;
+    }
+    skia_private::AutoTArray<SkRect> bounds(record->count());
+    skia_private::AutoTMalloc<SkBBoxHierarchy::Metadata> meta(record->count());
+    SkRecordFillBounds(cullRect, *record, bounds.data(), meta);
+
+    for (int i = 0; i < record->count(); i++) {
+        // Only real draws; FillBounds also marks annotations and layer Restores as draws.
+        if (meta[i].isDraw && bounds[i].isEmpty() &&
+            record->visit(i, [](const auto& op) {
+                return SkToBool(std::remove_reference_t<decltype(op)>::kTags & kDraw_Tag);
+            })) {
+            record->replace<NoOp>(i);
+        }
+    }
+}
+
+// Tracks a conservative bound on the clip, and no-ops intersecting clips that contain it.
+class RedundantClipNooper {
+public:
+    RedundantClipNooper(SkRecord* record, const SkRect& cullRect)
+            : fRecord(record), fCullRect(cullRect) {
+        fClipStack.push_back(cullRect);
+    }
+
+    void setCurrentOp(int currentOp) { fCurrentOp = currentOp; }
+
+    template <typename T> void operator()(const T& op) {
+        fMatrix.update(op);
+        this->trackClip(op);
+    }
+
+private:
+    template <typename T> void trackClip(const T&) {}
+    void trackClip(const Save&)       { fClipStack.push_back(fClipStack.back()); }
+    void trackClip(const SaveLayer&)  { fClipStack.push_back(fClipStack.back()); }
+    void trackClip(const SaveBehind&) { fClipStack.push_back(fClipStack.back()); }
+    void trackClip(const Restore&) {
+        if (fClipStack.size() > 1) {
+            fClipStack.pop_back();
+        }
+    }
+    void trackClip(const ResetClip&) { fClipStack.back() = fCullRect; }
+
+    void trackClip(const ClipRect& op) {
+        this->clip(op.opAA, op.rect, [&](const SkRect& device, const SkIRect& clip) {
+            // Non-AA rect clips snap to the nearest pixel edges.
+            return op.opAA.aa() ? device.contains(SkRect::Make(clip))
+                                : device.round().contains(clip);
+        });
+    }
+    void trackClip(const ClipRRect& op) {
+        this->clip(op.opAA, op.rrect.getBounds(), [&](const SkRect&, const SkIRect& clip) {
+            SkRect local;
+            return this->mapToLocal(clip, &local) && op.rrect.contains(local);
+        });
+    }
+    void trackClip(const ClipPath& op) {
+        this->clip(op.opAA, op.path.getBounds(), [&](const SkRect&, const SkIRect& clip) {
+            SkRect local;
+            return !op.path.isInverseFillType() && this->mapToLocal(clip, &local) &&
+                   op.path.conservativelyContainsRect(local);
+        });
+    }
+
+    // contains(deviceBounds, clip) says whether the clip op keeps every pixel of clip.
+    template <typename Contains>
+    void clip(ClipOpAndAA opAA, const SkRect& localBounds, Contains&& contains) {
+        if (opAA.op() != SkClipOp::kIntersect) {
+            return;  // Difference clips only shrink the clip, so the bound still holds.
+        }
+        const SkRect device = fMatrix.ctm().mapRect(localBounds);
+        SkRect& current = fClipStack.back();
+        if (fMatrix.ctm().rectStaysRect() && contains(device, current.roundOut())) {
+            fRecord->replace<NoOp>(fCurrentOp);
+            return;
+        }
+        if (!current.intersect(device)) {
+            current.setEmpty();
+        }
+    }
+
+    bool mapToLocal(const SkIRect& clip, SkRect* local) const {
+        SkMatrix inverse;
+        if (!fMatrix.ctm().invert(&inverse)) {
+            return false;
+        }
+        *local = inverse.mapRect(SkRect::Make(clip));
+        return true;
+    }
+
+    SkRecord* fRecord;
+    const SkRect fCullRect;
+    int fCurrentOp = 0;
+    MatrixTracker fMatrix;
+    skia_private::STArray<8, SkRect> fClipStack;  // Conservative device bounds of the clip.
+};
+
+void SkRecordNoopRedundantClips(SkRecord* record, const SkRect& cullRect) {
+    if (cullRect.isEmpty()) {
+        return;
+    }
+    RedundantClipNooper nooper(record, cullRect);
+    for (int i = 0; i < record->count(); i++) {
+        nooper.setCurrentOp(i);
+        record->visit(i, nooper);
+    }
+}
+
+// Finds draws that a later opaque DrawRect or DrawPaint paints over completely, and no-ops them.
+//
+// Each save level keeps the ops drawn at that level since its clip last changed, along with any
+// Save/Restore blocks closed at that level, which can only be dropped as a whole. Since the clip
+// hasn't changed, everything an occluder paints is inside the same clip as those ops. That only
+// makes them invisible when the clip is hard-edged, so levels with anti-aliased clips are
+// skipped.
+class OccludedDrawNooper {
+public:
+    OccludedDrawNooper(SkRecord* record, const SkRect bounds[])
+            : fRecord(record), fBounds(bounds) {
+        fLevels.push_back({-1, /*active=*/true, /*removable=*/true, {}});
+    }
+
+    void setCurrentOp(int currentOp) { fCurrentOp = currentOp; }
+
+    template <typename T> void operator()(const T& op) {
+        fMatrix.update(op);
+        this->track(op);
+    }
+
+private:
+    struct Span {
+        int begin, end;  // inclusive
+        SkRect bounds;
+    };
+    struct Level {
+        int saveIndex;
+        bool active;     // Can anything be dropped at this level?
+        bool removable;  // Could this level's block be dropped as a whole?
+        skia_private::TArray<Span> candidates;
+    };
+
+    void push(bool active) {
+        fLevels.push_back({fCurrentOp, active && fLevels.back().active, true, {}});
+    }
+
+    void track(const Save&) { this->push(true); }
+    void track(const SaveLayer& op) {
+        if (op.backdrop || (op.saveLayerFlags & SkCanvas::kInitWithPrevious_SaveLayerFlag)) {
+            // These read what's already been drawn, maybe beyond the pixels they cover.
+            this->barrier();
+        }
+        const SkPaint* paint = op.paint;
+        // FillBounds moves the bounds of ops under filters, so they wouldn't line up with the
+        // occluders' geometry any more.
+        this->push(op.filters.empty() &&
+                   !(paint && (paint->getImageFilter() || paint->getMaskFilter() ||
+                               paint->getPathEffect())));
+    }
+    void track(const SaveBehind&) {
+        this->barrier();
+        this->push(false);
+    }
+    void track(const Restore&) {
+        if (fLevels.size() <= 1) {
+            return;
+        }
+        const Level level = std::move(fLevels.back());
+        fLevels.pop_back();
+        Level& parent = fLevels.back();
+        parent.removable &= level.removable;
+        if (level.removable && !fBounds[fCurrentOp].isEmpty()) {
+            parent.candidates.push_back({level.saveIndex, fCurrentOp, fBounds[fCurrentOp]});
+        }
+    }
+
+    void track(const ClipRect& op)   { this->clip(op.opAA.aa()); }
+    void track(const ClipRRect& op)  { this->clip(op.opAA.aa()); }
+    void track(const ClipPath& op)   { this->clip(op.opAA.aa()); }
+    void track(const ClipRegion&)    { this->clip(false); }
+    void track(const ClipShader&)    { this->clip(true); }
+    void track(const ResetClip&)     { this->clip(true); }  // The device clip could be soft.
+
+    // These can do anything with what's under them, and mustn't be dropped themselves.
+    void track(const DrawPicture&)    { this->barrier(); fLevels.back().removable = false; }
+    void track(const DrawDrawable&)   { this->barrier(); fLevels.back().removable = false; }
+    void track(const DrawBehind&)     { this->barrier(); fLevels.back().removable = false; }
+    void track(const DrawAnnotation&) { fLevels.back().removable = false; }
+
+    void track(const DrawPaint& op) {
+        if (IsOpaque(op.paint)) {
+            this->occlude(nullptr);
+        }
+        this->addCandidate();
+    }
+    void track(const DrawRect& op) {
+        if (IsOpaque(op.paint) && op.paint.getStyle() == SkPaint::kFill_Style &&
+            fMatrix.ctm().rectStaysRect()) {
+            // Only pixels entirely inside the rect are surely overwritten.
+            const SkIRect covered = fMatrix.ctm().mapRect(op.rect).roundIn();
+            this->occlude(&covered);
+        }
+        this->addCandidate();
+    }
+
+    template <typename T> void track(const T&) {
+        if (T::kTags & kDraw_Tag) {
+            this->addCandidate();
+        }
+    }
+
+    static bool IsOpaque(const SkPaint& paint) {
+        return !paint.getMaskFilter() && !paint.getImageFilter() && !paint.getPathEffect() &&
+               SkPaintPriv::Overwrites(&paint, SkPaintPriv::kNone_ShaderOverrideOpacity);
+    }
+
+    void addCandidate() {
+        if (!fBounds[fCurrentOp].isEmpty()) {
+            fLevels.back().candidates.push_back({fCurrentOp, fCurrentOp, fBounds[fCurrentOp]});
+        }
+    }
+
+    // Drops the current level's candidates inside covered, or all of them if it's null.
+    void occlude(const SkIRect* covered) {
+        Level& level = fLevels.back();
+        if (!level.active) {
+            return;
+        }
+        int kept = 0;
+        for (const Span& span : level.candidates) {
+            // Pad by a pixel for anti-aliasing and hairlines the bounds might not include.
+            if (covered && !covered->contains(span.bounds.makeOutset(1, 1).roundOut())) {
+                level.candidates[kept++] = span;
+                continue;
+            }
+            for (int i = span.begin; i <= span.end; i++) {
+                fRecord->replace<NoOp>(i);
+            }
+        }
+        level.candidates.resize_back(kept);
+    }
+
+    void clip(bool soft) {
+        Level& level = fLevels.back();
+        level.candidates.clear();
+        level.active &= !soft;
+    }
+
+    void barrier() {
+        for (Level& level : fLevels) {
+            level.candidates.clear();
+        }
+    }
+
+    SkRecord* fRecord;
+    const SkRect* fBounds;
+    int fCurrentOp = 0;
+    MatrixTracker fMatrix;
+    skia_private::STArray<8, Level> fLevels;
+};
+
+void SkRecordNoopOccludedDraws(SkRecord* record, const SkRect& cullRect) {
+    if (cullRect.isEmpty()) {
+        return;
+    }
+    skia_private::AutoTArray<SkRect> bounds(record->count());
+    skia_private::AutoTMalloc<SkBBoxHierarchy::Metadata> meta(record->count());
+    SkRecordFillBounds(cullRect, *record, bounds.data(), meta);
+
+    OccludedDrawNooper nooper(record, bounds.data());
+    for (int i = 0; i < record->count(); i++) {
+        nooper.setCurrentOp(i);
+        record->visit(i, nooper);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 void SkRecordOptimize(SkRecord* record) {
     // This might be useful  as a first pass in the future if we want to weed
     // out junk for other optimization passes.  Right now, nothing needs it,
@@ -283,6 +648,15 @@ void SkRecordOptimize(SkRecord* record) {
     SkRecordNoopSaveLayerDrawRestores(record);
 #endif
     SkRecordMergeSvgOpacityAndFilterLayers(record);
+    SkRecordShareDuplicatePaths(record);
 
     record->defrag();
 }
+
+void SkRecordOptimize(SkRecord* record, const SkRect& cullRect) {
+    SkRecordNoopCulledDraws(record, cullRect);
+    SkRecordNoopRedundantClips(record, cullRect);
+    SkRecordNoopOccludedDraws(record, cullRect);
+
+    SkRecordOptimize(record);
+}
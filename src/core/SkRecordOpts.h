@@ -9,10 +9,15 @@
 #define SkRecordOpts_DEFINED
 
 class SkRecord;
+struct SkRect;
 
 // Run all optimizations in recommended order.
 void SkRecordOptimize(SkRecord*);
 
+// Also runs the passes that need to know the cull rect. Like the bounding box hierarchy, these
+// take anything drawn outside the cull rect to be undefined.
+void SkRecordOptimize(SkRecord*, const SkRect& cullRect);
+
 // Turns logical no-op Save-[non-drawing command]*-Restore patterns into actual no-ops.
 void SkRecordNoopSaveRestores(SkRecord*);
 
@@ -26,4 +31,18 @@ void SkRecordNoopSaveLayerDrawRestores(SkRecord*);
 // the alpha of the first SaveLayer to the second SaveLayer.
 void SkRecordMergeSvgOpacityAndFilterLayers(SkRecord*);
 
+// Makes equal paths share one copy of their points and verbs.
+void SkRecordShareDuplicatePaths(SkRecord*);
+
+// No-ops draws that land entirely outside the cull rect.
+void SkRecordNoopCulledDraws(SkRecord*, const SkRect& cullRect);
+
+// No-ops intersecting clips that can't shrink the clip they're applied to.
+void SkRecordNoopRedundantClips(SkRecord*, const SkRect& cullRect);
+
+// No-ops draws, and whole Save/Restore blocks, that a later opaque DrawRect or DrawPaint covers.
+// This assumes the canvas the record is played back into has a hard-edged clip, as an
+// anti-aliased one would let the covered draws show through along its edge.
+void SkRecordNoopOccludedDraws(SkRecord*, const SkRect& cullRect);
+
 #endif//SkRecordOpts_DEFINED
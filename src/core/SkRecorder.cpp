@@ -39,6 +39,8 @@
 #include <cstring>
 #include <memory>
 #include <new>
+#include <type_traits>
+#include <utility>
 
 class SkBlender;
 class SkMesh;
@@ -118,6 +120,47 @@ void SkRecorder::forgetRecord() {
     fRecord = nullptr;
 }
 
+void SkRecorder::splice(SkRecorder* child, sk_sp<SkRecord> childRecord) {
+    SkASSERT(child != this && child->fRecord == childRecord.get());
+
+    // The child recorded as if its canvas started with an identity matrix and no clip. Wrapping
+    // its commands in a save/restore keeps any matrix or clip it left behind from leaking out.
+    this->save();
+
+    const int start = fRecord->count();
+    fRecord->splice(std::move(childRecord));
+
+    std::unique_ptr<SkDrawableList> drawables = child->detachDrawableList();
+    const int drawableOffset = fDrawableList ? fDrawableList->count() : 0;
+    if (drawables && drawables->count() > 0) {
+        if (!fDrawableList) {
+            fDrawableList = std::make_unique<SkDrawableList>();
+        }
+        for (SkDrawable* drawable : *drawables) {
+            fDrawableList->append(drawable);
+        }
+    }
+
+    // SetM44 replaces the whole matrix, so it must now start from our current one, and the
+    // indices of the child's drawables have moved.
+    const SkM44 ctm = this->getLocalToDevice();
+    for (int i = start; i < fRecord->count(); i++) {
+        fRecord->mutate(i, [&](auto* op) {
+            using T = std::remove_pointer_t<decltype(op)>;
+            if constexpr (std::is_same_v<T, SkRecords::SetM44>) {
+                op->matrix = ctm * op->matrix;
+            } else if constexpr (std::is_same_v<T, SkRecords::DrawDrawable>) {
+                op->index += drawableOffset;
+            }
+        });
+    }
+
+    fApproxBytesUsedBySubPictures += child->approxBytesUsedBySubPictures();
+    child->forgetRecord();
+
+    this->restore();
+}
+
 // To make appending to fRecord a little less verbose.
 template<typename T, typename... Args>
 void SkRecorder::append(Args&&... args) {
@@ -319,6 +362,13 @@ void SkRecorder::onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4],
             rect, this->copy(clip, 4), aa, color, mode);
 }
 
+void SkRecorder::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int count,
+                                     const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                     QuadAAFlags aa, SkBlendMode mode) {
+    // Recorded as one quad per entry.
+    this->drawEdgeAARectSetAsQuads(rects, colors, count, matrixIndices, preViewMatrices, aa, mode);
+}
+
 void SkRecorder::onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count,
                                        const SkPoint dstClips[], const SkMatrix preViewMatrices[],
                                        const SkSamplingOptions& sampling, const SkPaint* paint,
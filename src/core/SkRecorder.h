@@ -90,6 +90,11 @@ public:
     // Make SkRecorder forget entirely about its SkRecord*; all calls to SkRecorder will fail.
     void forgetRecord();
 
+    // Appends everything child recorded into childRecord, as if it had been drawn through this
+    // canvas at its current matrix and clip. The commands are moved rather than copied, and
+    // child's drawables are taken along with them. child forgets its record.
+    void splice(SkRecorder* child, sk_sp<SkRecord> childRecord);
+
     void willSave() override;
     SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec&) override;
     bool onDoSaveBehind(const SkRect*) override;
@@ -152,6 +157,8 @@ public:
 
     void onDrawEdgeAAQuad(const SkRect&, const SkPoint[4], QuadAAFlags, const SkColor4f&,
                           SkBlendMode) override;
+    void onDrawEdgeAARectSet(const SkRect[], const SkColor4f[], int count, const int[],
+                             const SkMatrix[], QuadAAFlags, SkBlendMode) override;
     void onDrawEdgeAAImageSet2(const ImageSetEntry[], int count, const SkPoint[], const SkMatrix[],
                                const SkSamplingOptions&, const SkPaint*,
                                SrcRectConstraint) override;
@@ -654,16 +654,105 @@ void SkRegion::translate(int dx, int dy, SkRegion* dst) const {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+static bool is_region_rect(const SkIRect& r) {
+    // Matches the rects that setRect() doesn't turn into the empty region.
+    return !r.isEmpty() &&
+           SkRegion_kRunTypeSentinel != r.right() &&
+           SkRegion_kRunTypeSentinel != r.bottom();
+}
+
+/*  Rather than op()-ing the rects in one at a time, which builds an intermediate region per rect,
+ *  sweep down through every distinct top and bottom edge. Between two edges the set of rects that
+ *  cover the band doesn't change, so each band's intervals are just those rects' [left, right)
+ *  pairs, sorted and merged. As in RgnOper, a band identical to the one above it only extends its
+ *  bottom.
+ */
 bool SkRegion::setRects(const SkIRect rects[], int count) {
-    if (0 == count) {
-        this->setEmpty();
-    } else {
-        this->setRect(rects[0]);
-        for (int i = 1; i < count; i++) {
-            this->op(rects[i], kUnion_Op);
+    AutoSTMalloc<32, const SkIRect*> sorted(count);
+    int n = 0;
+    for (int i = 0; i < count; ++i) {
+        if (is_region_rect(rects[i])) {
+            sorted[n++] = &rects[i];
+        }
+    }
+    if (n <= 1) {
+        return n == 0 ? this->setEmpty() : this->setRect(*sorted[0]);
+    }
+    std::sort(sorted.get(), sorted.get() + n, [](const SkIRect* a, const SkIRect* b) {
+        return a->fTop < b->fTop;
+    });
+
+    AutoSTMalloc<64, RunType> edges(2 * n);
+    for (int i = 0; i < n; ++i) {
+        edges[2 * i + 0] = sorted[i]->fTop;
+        edges[2 * i + 1] = sorted[i]->fBottom;
+    }
+    std::sort(edges.get(), edges.get() + 2 * n);
+    const int edgeCount = SkToInt(std::unique(edges.get(), edges.get() + 2 * n) - edges.get());
+
+    AutoSTMalloc<32, const SkIRect*> active(n);
+    struct Span { RunType fLeft, fRight; };
+    AutoSTMalloc<32, Span> spans(n);
+    int activeCount = 0;
+    int next = 0;   // the next rect in sorted[] to become active
+
+    RunArray array;
+    array[0] = edges[0];    // top
+    int dst = 1;            // where the next band's bottom goes
+    int prevStart = 0;      // the intervals of the band last accepted, and their length
+    int prevLen = 0;        // including the x-sentinel; never matches a real band at first
+
+    for (int e = 0; e + 1 < edgeCount; ++e) {
+        const RunType top = edges[e],
+                      bot = edges[e + 1];
+
+        // Retire the rects that ended above this band, and pick up the ones starting at its top.
+        int kept = 0;
+        for (int i = 0; i < activeCount; ++i) {
+            if (active[i]->fBottom > top) {
+                active[kept++] = active[i];
+            }
+        }
+        activeCount = kept;
+        while (next < n && sorted[next]->fTop == top) {
+            active[activeCount++] = sorted[next++];
+        }
+
+        for (int i = 0; i < activeCount; ++i) {
+            spans[i] = {active[i]->fLeft, active[i]->fRight};
+        }
+        std::sort(spans.get(), spans.get() + activeCount, [](const Span& a, const Span& b) {
+            return a.fLeft < b.fLeft;
+        });
+
+        // bottom, interval count, at most activeCount intervals, x-sentinel, and a y-sentinel.
+        array.resizeToAtLeast(dst + 2 + 2 * activeCount + 2);
+        const int start = dst + 2;
+        int end = start;
+        for (int i = 0; i < activeCount; ++i) {
+            if (end > start && spans[i].fLeft <= array[end - 1]) {
+                array[end - 1] = std::max(array[end - 1], spans[i].fRight);
+            } else {
+                array[end++] = spans[i].fLeft;
+                array[end++] = spans[i].fRight;
+            }
+        }
+        array[end++] = SkRegion_kRunTypeSentinel;
+
+        const int len = end - start;
+        if (len == prevLen && !memcmp(&array[prevStart], &array[start], len * sizeof(RunType))) {
+            array[prevStart - 2] = bot;
+        } else {
+            array[dst + 0] = bot;
+            array[dst + 1] = (len - 1) >> 1;
+            prevStart = start;
+            prevLen = len;
+            dst = end;
         }
     }
-    return !this->isEmpty();
+    array[dst++] = SkRegion_kRunTypeSentinel;
+
+    return this->setRuns(&array[0], dst);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -788,6 +877,22 @@ static int operate_on_span(const SkRegionPriv::RunType a_runs[],
             dstOffset + distance_to_sentinel(a_runs) + distance_to_sentinel(b_runs) + 2);
     SkRegionPriv::RunType* dst = &(*array)[dstOffset]; // get pointer AFTER resizing.
 
+    // When only one side has intervals on this scanline (common in bands where the regions don't
+    // overlap vertically), the result is either a copy of those intervals or nothing at all.
+    const bool a_empty = SkRegion_kRunTypeSentinel == a_runs[0],
+               b_empty = SkRegion_kRunTypeSentinel == b_runs[0];
+    if (a_empty || b_empty) {
+        const int inside = a_empty ? 2 : 1;
+        const SkRegionPriv::RunType* src = a_empty ? b_runs : a_runs;
+        if (!(a_empty && b_empty) && (unsigned)(inside - min) <= (unsigned)(max - min)) {
+            const int n = distance_to_sentinel(src);
+            memcpy(dst, src, n * sizeof(SkRegionPriv::RunType));
+            dst += n;
+        }
+        *dst++ = SkRegion_kRunTypeSentinel;
+        return dst - &(*array)[0];
+    }
+
     spanRec rec;
     bool    firstInterval = true;
 
@@ -16,6 +16,7 @@
 #include "include/private/base/SkMalloc.h"
 #include "include/private/base/SkMath.h"
 #include "include/private/base/SkMutex.h"
+#include "include/private/base/SkOnce.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTo.h"
 #include "src/core/SkCachedData.h"
@@ -29,6 +30,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 
 using namespace skia_private;
 
@@ -86,6 +88,9 @@ namespace {
 class SkResourceCache::Hash :
     public THashTable<SkResourceCache::Rec*, SkResourceCache::Key, HashTraits> {};
 
+class SkResourceCache::NamespaceBudgets :
+    public THashMap<void*, SkResourceCache::NamespaceBudget> {};
+
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -93,19 +98,24 @@ void SkResourceCache::init() {
     fHead = nullptr;
     fTail = nullptr;
     fHash = new Hash;
+    fNamespaceBudgets = new NamespaceBudgets;
     fTotalBytesUsed = 0;
     fCount = 0;
     fSingleAllocationByteLimit = 0;
+    fDiscardableCountLimit = SK_DISCARDABLEMEMORY_SCALEDIMAGECACHE_COUNT_LIMIT;
 
     // One of these should be explicit set by the caller after we return.
     fTotalByteLimit = 0;
     fDiscardableFactory = nullptr;
 }
 
-SkResourceCache::SkResourceCache(DiscardableFactory factory)
+SkResourceCache::SkResourceCache(DiscardableFactory factory, int countLimit)
         : fPurgeSharedIDInbox(SK_InvalidUniqueID) {
     this->init();
     fDiscardableFactory = factory;
+    if (countLimit > 0) {
+        fDiscardableCountLimit = countLimit;
+    }
 }
 
 SkResourceCache::SkResourceCache(size_t byteLimit)
@@ -122,6 +132,7 @@ SkResourceCache::~SkResourceCache() {
         rec = next;
     }
     delete fHash;
+    delete fNamespaceBudgets;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -184,7 +195,9 @@ void SkResourceCache::add(Rec* rec, void* payload) {
                  bytesStr.c_str(), rec, rec->getHash(), totalStr.c_str(), fCount);
     }
 
-    // since the new rec may push us over-budget, we perform a purge check now
+    // since the new rec may push us over-budget, we perform a purge check now. The rec's own
+    // namespace pays for its limit first, so it doesn't evict other namespaces' recs.
+    this->purgeNamespaceAsNeeded(rec->getKey().getNamespace());
     this->purgeAsNeeded();
 }
 
@@ -198,6 +211,10 @@ void SkResourceCache::remove(Rec* rec) {
 
     fTotalBytesUsed -= used;
     fCount -= 1;
+    if (NamespaceBudget* budget = fNamespaceBudgets->find(rec->getKey().getNamespace())) {
+        SkASSERT(used <= budget->fBytesUsed);
+        budget->fBytesUsed -= used;
+    }
 
     //SkDebugf("-RC count [%3d] bytes %d\n", fCount, fTotalBytesUsed);
 
@@ -217,7 +234,7 @@ void SkResourceCache::purgeAsNeeded(bool forcePurge) {
     int    countLimit;
 
     if (fDiscardableFactory) {
-        countLimit = SK_DISCARDABLEMEMORY_SCALEDIMAGECACHE_COUNT_LIMIT;
+        countLimit = fDiscardableCountLimit;
         byteLimit = UINT32_MAX;  // no limit based on bytes
     } else {
         countLimit = SK_MaxS32; // no limit based on count
@@ -238,6 +255,52 @@ void SkResourceCache::purgeAsNeeded(bool forcePurge) {
     }
 }
 
+void SkResourceCache::purgeNamespaceAsNeeded(void* nameSpace) {
+    NamespaceBudget* budget = fNamespaceBudgets->find(nameSpace);
+    if (!budget || !budget->fByteLimit) {
+        return;
+    }
+
+    Rec* rec = fTail;
+    while (rec && budget->fBytesUsed > budget->fByteLimit) {
+        Rec* prev = rec->fPrev;
+        if (rec->getKey().getNamespace() == nameSpace && rec->canBePurged()) {
+            this->remove(rec);
+        }
+        rec = prev;
+    }
+}
+
+size_t SkResourceCache::purgeBytes(size_t bytes) {
+    size_t freed = 0;
+    Rec* rec = fTail;
+    while (rec && freed < bytes) {
+        Rec* prev = rec->fPrev;
+        if (rec->canBePurged()) {
+            freed += rec->bytesUsed();
+            this->remove(rec);
+        }
+        rec = prev;
+    }
+    return freed;
+}
+
+size_t SkResourceCache::setNamespaceByteLimit(void* nameSpace, size_t limit) {
+    NamespaceBudget* budget = fNamespaceBudgets->find(nameSpace);
+    if (!budget) {
+        budget = fNamespaceBudgets->set(nameSpace, NamespaceBudget());
+    }
+    size_t prevLimit = budget->fByteLimit;
+    budget->fByteLimit = limit;
+    this->purgeNamespaceAsNeeded(nameSpace);
+    return prevLimit;
+}
+
+size_t SkResourceCache::getNamespaceBytesUsed(void* nameSpace) const {
+    const NamespaceBudget* budget = fNamespaceBudgets->find(nameSpace);
+    return budget ? budget->fBytesUsed : 0;
+}
+
 //#define SK_TRACK_PURGE_SHAREDID_HITRATE
 
 #ifdef SK_TRACK_PURGE_SHAREDID_HITRATE
@@ -369,6 +432,11 @@ void SkResourceCache::addToHead(Rec* rec) {
     }
     fTotalBytesUsed += rec->bytesUsed();
     fCount += 1;
+    if (NamespaceBudget* budget = fNamespaceBudgets->find(rec->getKey().getNamespace())) {
+        budget->fBytesUsed += rec->bytesUsed();
+    } else {
+        fNamespaceBudgets->set(rec->getKey().getNamespace(), {rec->bytesUsed(), 0});
+    }
 
     this->validate();
 }
@@ -463,94 +531,211 @@ void SkResourceCache::checkMessages() {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static SkResourceCache* gResourceCache = nullptr;
+#ifndef SK_RESOURCE_CACHE_SHARD_COUNT
+    #define SK_RESOURCE_CACHE_SHARD_COUNT   4
+#endif
+
+namespace {
+
+static constexpr int kShardCount = SK_RESOURCE_CACHE_SHARD_COUNT;
+static_assert(kShardCount > 0);
+
+struct Shard {
+    SkMutex          fMutex;
+    SkResourceCache* fCache;
+    // Mirrors fCache->getTotalBytesUsed() so that the global budget can be checked without taking
+    // every shard's mutex.
+    std::atomic<size_t> fBytesUsed{0};
+};
+
+}  // namespace
+
 static SkMutex& resource_cache_mutex() {
     static SkMutex& mutex = *(new SkMutex);
     return mutex;
 }
 
-/** Must hold resource_cache_mutex() when calling. */
-static SkResourceCache* get_cache() {
-    // resource_cache_mutex() is always held when this is called, so we don't need to be fancy in here.
-    resource_cache_mutex().assertHeld();
-    if (nullptr == gResourceCache) {
+// Guarded by resource_cache_mutex(). These apply to the global cache as a whole; the shards
+// themselves are created without a byte budget (or with an even share of the discardable count
+// limit), and the total is enforced by purge_to_budget().
 #ifdef SK_USE_DISCARDABLE_SCALEDIMAGECACHE
-        gResourceCache = new SkResourceCache(SkDiscardableMemory::Create);
+// Like SkResourceCache(DiscardableFactory), there is no explicit byte budget.
+static size_t gTotalByteLimit = 0;
 #else
-        gResourceCache = new SkResourceCache(SK_DEFAULT_IMAGE_CACHE_LIMIT);
+static size_t gTotalByteLimit = SK_DEFAULT_IMAGE_CACHE_LIMIT;
 #endif
+static size_t gSingleAllocationByteLimit = 0;
+
+static Shard* get_shards() {
+    static SkOnce once;
+    static Shard* shards;
+    once([] {
+        shards = new Shard[kShardCount];
+        for (int i = 0; i < kShardCount; ++i) {
+#ifdef SK_USE_DISCARDABLE_SCALEDIMAGECACHE
+            shards[i].fCache = new SkResourceCache(
+                    SkDiscardableMemory::Create,
+                    std::max(1, SK_DISCARDABLEMEMORY_SCALEDIMAGECACHE_COUNT_LIMIT / kShardCount));
+#else
+            shards[i].fCache = new SkResourceCache(SIZE_MAX);
+#endif
+        }
+    });
+    return shards;
+}
+
+static int shard_index(const SkResourceCache::Key& key) {
+    // The key hash also places recs within a shard's hash table, so remix it before truncating.
+    return SkChecksum::CheapMix(key.hash()) % kShardCount;
+}
+
+// Calls fn(SkResourceCache*) on each shard while holding that shard's mutex.
+template <typename Fn>
+static void for_each_shard(Fn&& fn) {
+    Shard* shards = get_shards();
+    for (int i = 0; i < kShardCount; ++i) {
+        SkAutoMutexExclusive am(shards[i].fMutex);
+        fn(shards[i].fCache);
+        shards[i].fBytesUsed.store(shards[i].fCache->getTotalBytesUsed(),
+                                   std::memory_order_relaxed);
     }
-    return gResourceCache;
 }
 
-size_t SkResourceCache::GetTotalBytesUsed() {
+static size_t total_bytes_used() {
+    Shard* shards = get_shards();
+    size_t used = 0;
+    for (int i = 0; i < kShardCount; ++i) {
+        used += shards[i].fBytesUsed.load(std::memory_order_relaxed);
+    }
+    return used;
+}
+
+// Brings the sum of all shards under 'byteLimit', purging from 'firstShard' (the one that just
+// grew) before the others. Only one shard mutex is held at a time.
+static void purge_to_budget(size_t byteLimit, int firstShard) {
+    size_t used = total_bytes_used();
+    if (used <= byteLimit) {
+        return;
+    }
+    size_t excess = used - byteLimit;
+
+    Shard* shards = get_shards();
+    for (int i = 0; i < kShardCount && excess > 0; ++i) {
+        Shard& shard = shards[(firstShard + i) % kShardCount];
+        SkAutoMutexExclusive am(shard.fMutex);
+        excess -= std::min(excess, shard.fCache->purgeBytes(excess));
+        shard.fBytesUsed.store(shard.fCache->getTotalBytesUsed(), std::memory_order_relaxed);
+    }
+}
+
+static size_t global_byte_limit() {
     SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getTotalBytesUsed();
+    return gTotalByteLimit;
+}
+
+size_t SkResourceCache::GetTotalBytesUsed() {
+    return total_bytes_used();
 }
 
 size_t SkResourceCache::GetTotalByteLimit() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getTotalByteLimit();
+    return global_byte_limit();
 }
 
 size_t SkResourceCache::SetTotalByteLimit(size_t newLimit) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->setTotalByteLimit(newLimit);
+    if (GetDiscardableFactory()) {
+        return 0;
+    }
+    size_t prevLimit;
+    {
+        SkAutoMutexExclusive am(resource_cache_mutex());
+        prevLimit = gTotalByteLimit;
+        gTotalByteLimit = newLimit;
+    }
+    if (newLimit < prevLimit) {
+        purge_to_budget(newLimit, 0);
+    }
+    return prevLimit;
 }
 
 SkResourceCache::DiscardableFactory SkResourceCache::GetDiscardableFactory() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->discardableFactory();
+    // This is fixed when the shards are created, so no lock is needed.
+    return get_shards()[0].fCache->discardableFactory();
 }
 
 SkCachedData* SkResourceCache::NewCachedData(size_t bytes) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->newCachedData(bytes);
+    if (DiscardableFactory factory = GetDiscardableFactory()) {
+        SkDiscardableMemory* dm = factory(bytes);
+        return dm ? new SkCachedData(bytes, dm) : nullptr;
+    }
+    return new SkCachedData(sk_malloc_throw(bytes), bytes);
 }
 
 void SkResourceCache::Dump() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->dump();
+    for_each_shard([](SkResourceCache* cache) { cache->dump(); });
 }
 
 size_t SkResourceCache::SetSingleAllocationByteLimit(size_t size) {
     SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->setSingleAllocationByteLimit(size);
+    size_t oldLimit = gSingleAllocationByteLimit;
+    gSingleAllocationByteLimit = size;
+    return oldLimit;
 }
 
 size_t SkResourceCache::GetSingleAllocationByteLimit() {
     SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getSingleAllocationByteLimit();
+    return gSingleAllocationByteLimit;
 }
 
 size_t SkResourceCache::GetEffectiveSingleAllocationByteLimit() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->getEffectiveSingleAllocationByteLimit();
+    // Same policy as getEffectiveSingleAllocationByteLimit(), but against the global budget.
+    size_t limit = GetSingleAllocationByteLimit();
+    if (!GetDiscardableFactory()) {
+        size_t totalLimit = global_byte_limit();
+        limit = (0 == limit) ? totalLimit : std::min(limit, totalLimit);
+    }
+    return limit;
 }
 
 void SkResourceCache::PurgeAll() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->purgeAll();
+    for_each_shard([](SkResourceCache* cache) { cache->purgeAll(); });
 }
 
 void SkResourceCache::CheckMessages() {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->checkMessages();
+    for_each_shard([](SkResourceCache* cache) { cache->checkMessages(); });
+}
+
+size_t SkResourceCache::SetNamespaceByteLimit(void* nameSpace, size_t limit) {
+    const size_t shardLimit = limit ? std::max<size_t>(1, limit / kShardCount) : 0;
+    size_t prevLimit = 0;
+    for_each_shard([&](SkResourceCache* cache) {
+        prevLimit += cache->setNamespaceByteLimit(nameSpace, shardLimit);
+    });
+    return prevLimit;
 }
 
 bool SkResourceCache::Find(const Key& key, FindVisitor visitor, void* context) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    return get_cache()->find(key, visitor, context);
+    Shard& shard = get_shards()[shard_index(key)];
+    SkAutoMutexExclusive am(shard.fMutex);
+    bool found = shard.fCache->find(key, visitor, context);
+    shard.fBytesUsed.store(shard.fCache->getTotalBytesUsed(), std::memory_order_relaxed);
+    return found;
 }
 
 void SkResourceCache::Add(Rec* rec, void* payload) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->add(rec, payload);
+    const int index = shard_index(rec->getKey());
+    Shard& shard = get_shards()[index];
+    {
+        SkAutoMutexExclusive am(shard.fMutex);
+        shard.fCache->add(rec, payload);
+        shard.fBytesUsed.store(shard.fCache->getTotalBytesUsed(), std::memory_order_relaxed);
+    }
+    if (size_t byteLimit = global_byte_limit()) {
+        purge_to_budget(byteLimit, index);
+    }
 }
 
 void SkResourceCache::VisitAll(Visitor visitor, void* context) {
-    SkAutoMutexExclusive am(resource_cache_mutex());
-    get_cache()->visitAll(visitor, context);
+    for_each_shard([&](SkResourceCache* cache) { cache->visitAll(visitor, context); });
 }
 
 void SkResourceCache::PostPurgeSharedID(uint64_t sharedID) {
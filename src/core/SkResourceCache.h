@@ -24,8 +24,11 @@ class SkTraceMemoryDump;
  *  thread-safe, so if a given instance is to be shared across threads, the
  *  caller must manage the access itself (e.g. via a mutex).
  *
- *  As a convenience, a global instance is also defined, which can be safely
+ *  As a convenience, a global cache is also defined, which can be safely
  *  access across threads via the static methods (e.g. FindAndLock, etc.).
+ *  It is made of several instances (shards), each with its own mutex, chosen
+ *  by key hash so that threads working on different keys rarely contend. The
+ *  total byte limit applies to the sum of all shards.
  */
 class SkResourceCache {
 public:
@@ -168,6 +171,14 @@ public:
     static void PurgeAll();
     static void CheckMessages();
 
+    /**
+     *  Limit the bytes used by Recs whose keys share 'nameSpace' (see Key::init()), so that one
+     *  busy kind of Rec can't evict everything else. Returns the previous limit; 0 means the
+     *  namespace is only bound by the total budget. The global cache is split into shards by key
+     *  hash, and each shard enforces an even share of this limit.
+     */
+    static size_t SetNamespaceByteLimit(void* nameSpace, size_t limit);
+
     static void TestDumpMemoryStatistics();
 
     /** Dump memory usage statistics of every Rec in the cache using the
@@ -196,9 +207,10 @@ public:
      *  allocates memory for the pixels. In this mode, the cache has
      *  not explicit budget, and so methods like getTotalBytesUsed()
      *  and getTotalByteLimit() will return 0, and setTotalByteLimit
-     *  will ignore its argument and return 0.
+     *  will ignore its argument and return 0. Instead, the number of Recs is
+     *  limited to 'countLimit' (0 uses the build's default).
      */
-    SkResourceCache(DiscardableFactory);
+    SkResourceCache(DiscardableFactory, int countLimit = 0);
 
     /**
      *  Construct the cache, allocating memory with malloc, and respect the
@@ -243,8 +255,22 @@ public:
      */
     size_t setTotalByteLimit(size_t newLimit);
 
+    /**
+     *  Set the maximum number of bytes available to Recs in 'nameSpace'. When adding a Rec puts
+     *  its namespace over this limit, the namespace's least recently used Recs are purged (before
+     *  any other namespace's). Returns the previous limit; 0 means no namespace limit.
+     */
+    size_t setNamespaceByteLimit(void* nameSpace, size_t limit);
+    size_t getNamespaceBytesUsed(void* nameSpace) const;
+
     void purgeSharedID(uint64_t sharedID);
 
+    /**
+     *  Purge least recently used Recs until at least 'bytes' have been freed, or nothing else can
+     *  be purged. Returns the number of bytes freed.
+     */
+    size_t purgeBytes(size_t bytes);
+
     void purgeAll() {
         this->purgeAsNeeded(true);
     }
@@ -271,11 +297,20 @@ private:
     size_t  fTotalByteLimit;
     size_t  fSingleAllocationByteLimit;
     int     fCount;
+    int     fDiscardableCountLimit;
+
+    struct NamespaceBudget {
+        size_t fBytesUsed = 0;
+        size_t fByteLimit = 0;  // 0 == unlimited
+    };
+    class NamespaceBudgets;
+    NamespaceBudgets* fNamespaceBudgets;
 
     SkMessageBus<PurgeSharedIDMessage, uint32_t>::Inbox fPurgeSharedIDInbox;
 
     void checkMessages();
     void purgeAsNeeded(bool forcePurge = false);
+    void purgeNamespaceAsNeeded(void* nameSpace);
 
     // linklist management
     void moveToHead(Rec*);
@@ -123,6 +123,9 @@ SkRuntimeEffect::Uniform SkRuntimeEffectPriv::VarAsUniform(const SkSL::Variable&
     if (var.layout().fFlags & SkSL::LayoutFlag::kColor) {
         uni.flags |= Uniform::kColor_Flag;
     }
+    if (var.layout().fFlags & SkSL::LayoutFlag::kSpecialize) {
+        uni.flags |= Uniform::kSpecialize_Flag;
+    }
 
     uni.offset = *offset;
     *offset += uni.sizeInBytes();
@@ -449,6 +452,10 @@ SkSL::ProgramSettings SkRuntimeEffect::MakeSettings(const Options& options) {
     settings.fForceNoInline = options.forceUnoptimized;
     settings.fOptimize = !options.forceUnoptimized;
     settings.fMaxVersionAllowed = options.maxVersionAllowed;
+    // The same program is used for every backend, including the raster pipeline, which has no
+    // driver compiler to clean up repeated work after us.
+    settings.fEliminateCommonSubexpressions = true;
+    settings.fHoistLoopInvariants = true;
 
     // SkSL created by the GPU backend is typically parsed, converted to a backend format,
     // and the IR is immediately discarded. In that situation, it makes sense to use node
@@ -464,9 +471,70 @@ SkSL::ProgramSettings SkRuntimeEffect::MakeSettings(const Options& options) {
 // in the IR generator would provide better errors messages (with locations).
 #define RETURN_FAILURE(...) return Result{nullptr, SkStringPrintf(__VA_ARGS__)}
 
+namespace {
+
+// Effects made from the same SkSL, kind and options are identical, and immutable once made, so
+// they can be shared instead of compiling the SkSL again. That includes the Raster Pipeline
+// program, which each effect compiles once, on first use.
+struct CachedEffect {
+    SkString fSource;
+    SkSL::ProgramKind fKind;
+    uint32_t fOptions;
+    sk_sp<SkRuntimeEffect> fEffect;
+};
+
+// Most apps make a handful of effects up front. This leaves room for ones that are rebuilt from
+// dynamically generated SkSL without holding on to many programs that won't be used again.
+static constexpr int kDefaultEffectCacheCountLimit = 32;
+
+SkMutex& effect_cache_mutex() {
+    static SkNoDestructor<SkMutex> mutex;
+    return *mutex;
+}
+
+SkLRUCache<uint64_t, CachedEffect>& effect_cache() {
+    static SkNoDestructor<SkLRUCache<uint64_t, CachedEffect>> cache(
+            kDefaultEffectCacheCountLimit);
+    return *cache;
+}
+
+}  // namespace
+
+int SkRuntimeEffectPriv::GetCacheCountLimit() {
+    SkAutoMutexExclusive lock(effect_cache_mutex());
+    return effect_cache().maxCount();
+}
+
+int SkRuntimeEffectPriv::SetCacheCountLimit(int count) {
+    SkAutoMutexExclusive lock(effect_cache_mutex());
+    int prevCount = effect_cache().maxCount();
+    effect_cache().setMaxCount(std::max(count, 0));
+    return prevCount;
+}
+
+void SkRuntimeEffectPriv::PurgeCache() {
+    SkAutoMutexExclusive lock(effect_cache_mutex());
+    effect_cache().reset();
+}
+
 SkRuntimeEffect::Result SkRuntimeEffect::MakeFromSource(SkString sksl,
                                                         const Options& options,
                                                         SkSL::ProgramKind kind) {
+    const uint32_t optionBits = (options.forceUnoptimized   ? 1 : 0) |
+                                (options.allowPrivateAccess ? 2 : 0) |
+                                (static_cast<uint32_t>(options.maxVersionAllowed) << 2);
+    const uint64_t key = SkChecksum::Hash64(sksl.c_str(), sksl.size(),
+                                            (static_cast<uint64_t>(kind) << 32) | optionBits);
+    auto matches = [&](const CachedEffect& cached) {
+        return cached.fKind == kind && cached.fOptions == optionBits && cached.fSource == sksl;
+    };
+    {
+        SkAutoMutexExclusive lock(effect_cache_mutex());
+        if (CachedEffect* cached = effect_cache().find(key); cached && matches(*cached)) {
+            return Result{cached->fEffect, SkString()};
+        }
+    }
+
     SkSL::Compiler compiler;
     SkSL::ProgramSettings settings = MakeSettings(options);
     std::unique_ptr<SkSL::Program> program =
@@ -476,7 +544,15 @@ SkRuntimeEffect::Result SkRuntimeEffect::MakeFromSource(SkString sksl,
         RETURN_FAILURE("%s", compiler.errorText().c_str());
     }
 
-    return MakeInternal(std::move(program), options, kind);
+    Result result = MakeInternal(std::move(program), options, kind);
+    if (result.effect) {
+        SkAutoMutexExclusive lock(effect_cache_mutex());
+        if (effect_cache().maxCount() > 0) {
+            effect_cache().insert_or_update(key, {std::move(sksl), kind, optionBits,
+                                                  result.effect});
+        }
+    }
+    return result;
 }
 
 SkRuntimeEffect::Result SkRuntimeEffect::MakeInternal(std::unique_ptr<SkSL::Program> program,
@@ -547,6 +623,11 @@ SkRuntimeEffect::Result SkRuntimeEffect::MakeInternal(std::unique_ptr<SkSL::Prog
         if (SkSL::Analysis::ReturnsInputAlpha(*main->definition(), *program->usage())) {
             flags |= kAlphaUnchanged_Flag;
         }
+        // Color filters that compute `M * color + t` can be drawn as a color matrix, which the
+        // raster backend can run in lowp.
+        if (SkSL::Analysis::IsAffineColorFilter(*main->definition(), *program->usage())) {
+            flags |= kAffineColorFilter_Flag;
+        }
     }
 
     // Determine if this effect uses of the color transform intrinsics. Effects need to know this
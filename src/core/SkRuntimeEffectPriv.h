@@ -82,6 +82,10 @@ public:
         return *effect.fBaseProgram;
     }
 
+    static bool IsAffineColorFilter(const SkRuntimeEffect& effect) {
+        return effect.isAffineColorFilter();
+    }
+
     static SkRuntimeEffect::Options ES3Options() {
         SkRuntimeEffect::Options options;
         options.maxVersionAllowed = SkSL::Version::k300;
@@ -92,6 +96,11 @@ public:
         options->allowPrivateAccess = true;
     }
 
+    // Controls the cache of effects made from SkSL source. See SkGraphics.
+    static int GetCacheCountLimit();
+    static int SetCacheCountLimit(int count);
+    static void PurgeCache();
+
     static SkRuntimeEffect::Uniform VarAsUniform(const SkSL::Variable&,
                                                  const SkSL::Context&,
                                                  size_t* offset);
@@ -31,6 +31,7 @@
 #include "src/core/SkStroke.h"
 #include "src/core/SkSurfacePriv.h"
 #include "src/core/SkTextFormatParams.h"
+#include "src/core/SkTraceEvent.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/utils/SkMatrix22.h"
 #include <new>
@@ -573,6 +574,7 @@ void SkScalerContext::GenerateImageFromPath(
 }
 
 void SkScalerContext::getImage(const SkGlyph& origGlyph) {
+    TRACE_EVENT0("skia", TRACE_FUNC);
     SkASSERT(origGlyph.fAdvancesBoundsFormatAndInitialPathDone);
 
     const SkGlyph* unfilteredGlyph = &origGlyph;
@@ -17,6 +17,7 @@ class SkRasterClip;
 class SkRegion;
 class SkBlitter;
 class SkPath;
+class SkRRect;
 
 /** Defines a fixed-point rectangle, identical to the integer SkIRect, but its
     coordinates are treated as SkFixed rather than int32_t.
@@ -25,6 +26,8 @@ typedef SkIRect SkXRect;
 
 extern std::atomic<bool> gSkUseAnalyticAA;
 extern std::atomic<bool> gSkForceAnalyticAA;
+// When set, very large analytic AA fills are scan converted in strips on SkExecutor::GetDefault().
+extern std::atomic<bool> gSkParallelAnalyticAA;
 
 class AdditiveBlitter;
 
@@ -55,6 +58,9 @@ public:
     static void FillRect(const SkRect&, const SkRasterClip&, SkBlitter*);
     static void AntiFillRect(const SkRect&, const SkRasterClip&, SkBlitter*);
     static void AntiFillXRect(const SkXRect&, const SkRasterClip&, SkBlitter*);
+    // Fills an axis-aligned rrect (or oval) with analytic coverage. Returns false, without
+    // drawing, when the rrect is one the caller should scan convert as a path instead.
+    static bool AntiFillRRect(const SkRRect&, const SkRasterClip&, SkBlitter*);
     static void FillPath(const SkPath&, const SkRasterClip&, SkBlitter*);
     static void AntiFillPath(const SkPath&, const SkRasterClip&, SkBlitter*);
     static void FrameRect(const SkRect&, const SkPoint& strokeSize,
@@ -85,6 +91,7 @@ private:
     static void FillRect(const SkRect&, const SkRegion* clip, SkBlitter*);
     static void AntiFillRect(const SkRect&, const SkRegion* clip, SkBlitter*);
     static void AntiFillXRect(const SkXRect&, const SkRegion*, SkBlitter*);
+    static bool AntiFillRRect(const SkRRect&, const SkRegion* clip, SkBlitter*);
     static void AntiFillPath(const SkPath&, const SkRegion& clip, SkBlitter*, bool forceRLE);
     static void FillTriangle(const SkPoint pts[], const SkRegion*, SkBlitter*);
 
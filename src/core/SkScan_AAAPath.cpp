@@ -22,7 +22,11 @@
 #include "src/core/SkRasterClip.h"
 #include "src/core/SkScan.h"
 #include "src/core/SkScanPriv.h"
+#include "src/core/SkTaskGroup.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <utility>
 
 #if defined(SK_DISABLE_AAA)
@@ -1847,7 +1851,8 @@ static void aaa_fill_path(const SkPath& path,
                           int stop_y,
                           bool pathContainedInClip,
                           bool isUsingMask,
-                          bool forceRLE) {  // forceRLE implies that SkAAClip is calling us
+                          bool forceRLE,  // forceRLE implies that SkAAClip is calling us
+                          int fillHeight = 0) {  // Set when filling one strip of a taller fill.
     SkASSERT(blitter);
 
     SkAnalyticEdgeBuilder builder;
@@ -1931,8 +1936,8 @@ static void aaa_fill_path(const SkPath& path,
                 (SkFixedFloorToInt(tailEdge.fPrev->fLowerY - headEdge.fNext->fUpperY) + 1) * 4;
 
         // We skip intersection computation if there are many points which probably already
-        // give us enough fractional scan lines.
-        bool skipIntersect = path.countPoints() > (stop_y - start_y) * 2;
+        // give us enough fractional scan lines. Strips make the same choice as the whole fill.
+        bool skipIntersect = path.countPoints() > (fillHeight ? fillHeight : stop_y - start_y) * 2;
 
         aaa_walk_edges(&headEdge,
                        &tailEdge,
@@ -1949,6 +1954,131 @@ static void aaa_fill_path(const SkPath& path,
     }
 }
 
+// Records the coverage of one horizontal strip of a path into its own A8 buffer, so that strips
+// can be scan converted on different threads without sharing the real blitter.
+class StripMaskBlitter final : public SkBlitter {
+public:
+    StripMaskBlitter(const SkIRect& bounds, uint8_t* storage)
+            : fBounds(bounds), fStorage(storage), fRowBytes(bounds.width()) {
+        sk_bzero(fStorage, fRowBytes * fBounds.height());
+    }
+
+    void blitH(int x, int y, int width) override {
+        memset(this->addr(x, y), 0xFF, width);
+    }
+
+    void blitAntiH(int x, int y, const SkAlpha antialias[], const int16_t runs[]) override {
+        uint8_t* dst = this->addr(x, y);
+        for (int count = *runs; count > 0; count = *runs) {
+            if (*antialias) {
+                memset(dst, *antialias, count);
+            }
+            runs      += count;
+            antialias += count;
+            dst       += count;
+        }
+    }
+
+    void blitV(int x, int y, int height, SkAlpha alpha) override {
+        uint8_t* dst = this->addr(x, y);
+        while (--height >= 0) {
+            *dst = alpha;
+            dst += fRowBytes;
+        }
+    }
+
+    void blitRect(int x, int y, int width, int height) override {
+        uint8_t* dst = this->addr(x, y);
+        while (--height >= 0) {
+            memset(dst, 0xFF, width);
+            dst += fRowBytes;
+        }
+    }
+
+private:
+    uint8_t* addr(int x, int y) const {
+        SkASSERT(fBounds.contains(x, y));
+        return fStorage + (y - fBounds.fTop) * fRowBytes + (x - fBounds.fLeft);
+    }
+
+    const SkIRect fBounds;
+    uint8_t*      fStorage;
+    const size_t  fRowBytes;
+};
+
+// Strips are at least this tall, so each one has enough rows to amortize building its own edges.
+static constexpr int kMinStripHeight = 64;
+static constexpr int kMaxStrips      = 32;
+// Every strip keeps a full A8 mask until it is blitted, so cap the total memory they may use.
+static constexpr int64_t kMaxStripStorage = 32 << 20;
+// Paths with fewer verbs than this are cheap enough to walk on one thread.
+static constexpr int kMinStripVerbs = 256;
+
+static bool should_fill_in_strips(const SkPath&  path,
+                                  const SkIRect& ir,
+                                  const SkIRect& clipBounds,
+                                  bool           forceRLE,
+                                  SkIRect*       bounds) {
+    // SkAAClip (forceRLE) must see its rows in order, and inverse fills cover the whole clip
+    // rather than just the path bounds.
+    if (!gSkParallelAnalyticAA || forceRLE || path.isInverseFillType() ||
+        path.countVerbs() < kMinStripVerbs || !bounds->intersect(ir, clipBounds)) {
+        return false;
+    }
+    return bounds->height() >= kMinStripHeight * 2 &&
+           SkToS64(bounds->width()) * bounds->height() <= kMaxStripStorage;
+}
+
+// Splits bounds into horizontal strips, scan converts each strip concurrently on the default
+// SkExecutor into its own mask, and then blits the masks in order from the calling thread.
+// Each strip builds its own edges, clipped to its rows, so the strips share nothing but the path.
+static void aaa_fill_path_in_strips(const SkPath& path, SkBlitter* blitter, const SkIRect& bounds) {
+    const int stripCount  = std::min(kMaxStrips, bounds.height() / kMinStripHeight);
+    const int stripHeight = (bounds.height() + stripCount - 1) / stripCount;
+    // Resolve the path's lazily computed state up front, since every strip reads it.
+    const bool isConvex   = path.isConvex();
+    path.updateBoundsCache();
+
+    skia_private::AutoTMalloc<uint8_t> storage(SkToSizeT(bounds.width()) * bounds.height());
+
+    auto stripBounds = [&](int i) {
+        const int top = bounds.fTop + i * stripHeight;
+        return SkIRect::MakeLTRB(bounds.fLeft, top,
+                                 bounds.fRight, std::min(top + stripHeight, bounds.fBottom));
+    };
+    auto stripStorage = [&](int i) {
+        return storage.get() + SkToSizeT(i) * stripHeight * bounds.width();
+    };
+
+    SkTaskGroup tasks;
+    tasks.batch(stripCount, [&](int i) {
+        const SkIRect strip = stripBounds(i);
+        if (strip.isEmpty()) {
+            return;
+        }
+        StripMaskBlitter stripBlitter(strip, stripStorage(i));
+        // As in SkScan::AAAFillPath(), only concave fills need their alphas clamped.
+        if (isConvex) {
+            RunBasedAdditiveBlitter additiveBlitter(&stripBlitter, strip, strip, false);
+            aaa_fill_path(path, strip, &additiveBlitter,
+                          strip.fTop, strip.fBottom, false, false, false, bounds.height());
+        } else {
+            SafeRLEAdditiveBlitter additiveBlitter(&stripBlitter, strip, strip, false);
+            aaa_fill_path(path, strip, &additiveBlitter,
+                          strip.fTop, strip.fBottom, false, false, false, bounds.height());
+        }
+    });
+    tasks.wait();
+
+    for (int i = 0; i < stripCount; ++i) {
+        const SkIRect strip = stripBounds(i);
+        if (!strip.isEmpty()) {
+            blitter->blitMask(SkMask(stripStorage(i), strip, bounds.width(), SkMask::kA8_Format),
+                              strip);
+        }
+    }
+}
+
 // Check if the path is a rect and fat enough after clipping; if so, blit it.
 static inline bool try_blit_fat_anti_rect(SkBlitter* blitter,
                                           const SkPath& path,
@@ -1975,6 +2105,7 @@ void SkScan::AAAFillPath(const SkPath&  path,
                          bool           forceRLE) {
     bool containedInClip = clipBounds.contains(ir);
     bool isInverse       = path.isInverseFillType();
+    SkIRect stripBounds;
 
     // The mask blitter (where we store intermediate alpha values directly in a mask, and then call
     // the real blitter once in the end to blit the whole mask) is faster than the RLE blitter when
@@ -1997,6 +2128,8 @@ void SkScan::AAAFillPath(const SkPath&  path,
                           true,
                           forceRLE);
         }
+    } else if (should_fill_in_strips(path, ir, clipBounds, forceRLE, &stripBounds)) {
+        aaa_fill_path_in_strips(path, blitter, stripBounds);
     } else if (!isInverse && path.isConvex()) {
         // If the filling area is convex (i.e., path.isConvex && !isInverse), our simpler
         // aaa_walk_convex_edges won't generate alphas above 255. Hence we don't need
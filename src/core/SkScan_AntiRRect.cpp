@@ -0,0 +1,299 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkScan.h"
+
+#include "include/core/SkRRect.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRegion.h"
+#include "include/core/SkScalar.h"
+#include "include/private/base/SkTPin.h"
+#include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
+#include "src/base/SkVx.h"
+#include "src/core/SkBlitter.h"
+#include "src/core/SkRasterClip.h"
+#include "src/core/SkScanPriv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+/*  Analytic coverage for axis-aligned round rects, ovals and circles.
+
+    Rather than building edges for the flattened outline, each pixel's coverage is computed
+    directly from its center: the straight sides contribute the exact area of the pixel that lies
+    inside them, and the corners contribute the usual approximate signed distance to their ellipse,
+    f(p) / |grad f(p)|, which is the same estimate the GPU backends use for analytic rrects.
+
+    Each scanline is split into a run of fully covered pixels in the middle, and the pixels on
+    either side of it that need the distance function. Those are evaluated N at a time.
+ */
+
+namespace {
+
+constexpr int N = 8;
+using F = skvx::Vec<N, float>;
+
+// The distance estimate is poor where an ellipse bends sharply within a pixel, so corners whose
+// tightest radius of curvature, min(rx, ry)^2 / max(rx, ry), is smaller than this are left to the
+// path scan converters. For circles, this is just the radius.
+constexpr float kMinCurvatureRadius = 0.5f;
+
+// Past this we'd lose too much precision in the float math.
+constexpr float kMaxCoord = 32767;
+
+struct Corner {
+    float fCX, fCY;         // center of the corner ellipse
+    float fRX, fRY;
+    float fInvRX2, fInvRY2; // 1/rx^2 and 1/ry^2, or 0 for a square corner
+
+    Corner(float cx, float cy, SkVector radii)
+            : fCX(cx)
+            , fCY(cy)
+            , fRX(radii.fX)
+            , fRY(radii.fY)
+            , fInvRX2(radii.fX > 0 ? 1 / (radii.fX * radii.fX) : 0)
+            , fInvRY2(radii.fY > 0 ? 1 / (radii.fY * radii.fY) : 0) {}
+
+    bool isRound() const { return fInvRX2 > 0; }
+};
+
+class RRectCoverage {
+public:
+    explicit RRectCoverage(const SkRRect& rr)
+            : fBounds(rr.rect())
+            , fCorners{make_corner(rr, SkRRect::kUpperLeft_Corner),
+                       make_corner(rr, SkRRect::kUpperRight_Corner),
+                       make_corner(rr, SkRRect::kLowerLeft_Corner),
+                       make_corner(rr, SkRRect::kLowerRight_Corner)}
+            , fMidX(fBounds.centerX())
+            , fMidY(fBounds.centerY()) {}
+
+    // The fraction of row y that lies between the top and bottom of the rrect.
+    float rowCoverage(int y) const {
+        return SkTPin(std::min(y + 1.f, fBounds.fBottom) - std::max((float)y, fBounds.fTop),
+                      0.f, 1.f);
+    }
+
+    // Fills alpha[] with the coverage of the pixels [x, x + count) of row y.
+    void row(int y, int x, int count, SkAlpha alpha[]) const {
+        const float yc = y + 0.5f;
+        const float covY = this->rowCoverage(y);
+
+        // The radii of neighboring corners don't have to match, so each side of the row picks its
+        // corner separately. A corner's ellipse only applies above (or below) its center. When the
+        // radii are lopsided, a pixel can lie in the quadrants of both a left and a right corner,
+        // and then it must be inside both ellipses.
+        float dyL, dyR;
+        const Corner& l = this->cornerForRow(0, yc, &dyL);
+        const Corner& r = this->cornerForRow(1, yc, &dyR);
+
+        const F iota = {0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f};
+        for (int i = 0; i < count; i += N) {
+            const F xc = iota + (float)(x + i);
+            const F covX = pin(min(xc + 0.5f, fBounds.fRight) - max(xc - 0.5f, fBounds.fLeft),
+                               F(0.f), F(1.f));
+            F cov = covX * covY;
+            if (dyL > 0) {
+                cov = min(cov, corner_coverage(l, max(l.fCX - xc, 0.f), dyL));
+            }
+            if (dyR > 0) {
+                cov = min(cov, corner_coverage(r, max(xc - r.fCX, 0.f), dyR));
+            }
+
+            const auto a = skvx::cast<uint8_t>(cov * 255.f + 0.5f);
+            if (count - i >= N) {
+                a.store(alpha + i);
+            } else {
+                uint8_t tmp[N];
+                a.store(tmp);
+                memcpy(alpha + i, tmp, count - i);
+            }
+        }
+    }
+
+    // Returns the pixel columns [*L, *R) of row y that are far enough from the corners that their
+    // coverage is just rowCoverage(y).
+    void interior(int y, int* L, int* R) const {
+        // The row may reach into both the upper and the lower corner of a side, so take the
+        // tighter bound of the two.
+        const Corner &ul = fCorners[0], &ur = fCorners[1], &ll = fCorners[2], &lr = fCorners[3];
+        const float left  = std::max(ul.fCX - half_width(ul, ul.fCY - y),
+                                     ll.fCX - half_width(ll, y + 1 - ll.fCY)),
+                    right = std::min(ur.fCX + half_width(ur, ur.fCY - y),
+                                     lr.fCX + half_width(lr, y + 1 - lr.fCY));
+        // Pad by a pixel on each side so the distance estimate has surely saturated.
+        *L = (int)std::ceil(left + 1);
+        *R = (int)std::floor(right - 1);
+    }
+
+private:
+    // Coverage of pixels offset by (dx, dy) >= 0 from the center of a corner, outwards.
+    static F corner_coverage(const Corner& c, const F& dx, float dy) {
+        if (!c.isRound()) {
+            return 1.f;
+        }
+        const F gx = dx * c.fInvRX2;
+        const float gy = dy * c.fInvRY2;
+        const F f = dx * gx + dy * gy - 1.f,
+                dist = f / (2.f * sqrt(gx * gx + gy * gy));
+        // dist is only meaningful in the corner's quadrant, past the center of the ellipse.
+        return if_then_else(dx > 0.f, pin(0.5f - dist, F(0.f), F(1.f)), F(1.f));
+    }
+
+    // Returns the corner on one side (0 = left, 1 = right) whose ellipse covers row center yc,
+    // and the distance from its center to yc. The distance is 0 when neither corner does.
+    const Corner& cornerForRow(int side, float yc, float* dy) const {
+        const Corner& upper = fCorners[side];
+        const Corner& lower = fCorners[side + 2];
+        if (yc < upper.fCY) {
+            *dy = upper.fCY - yc;
+            return upper;
+        }
+        *dy = std::max(yc - lower.fCY, 0.f);
+        return lower;
+    }
+
+    static Corner make_corner(const SkRRect& rr, SkRRect::Corner corner) {
+        const SkRect& r = rr.rect();
+        const SkVector radii = rr.radii(corner);
+        const bool left = corner == SkRRect::kUpperLeft_Corner ||
+                          corner == SkRRect::kLowerLeft_Corner,
+                   top  = corner == SkRRect::kUpperLeft_Corner ||
+                          corner == SkRRect::kUpperRight_Corner;
+        return Corner(left ? r.fLeft + radii.fX : r.fRight - radii.fX,
+                      top ? r.fTop + radii.fY : r.fBottom - radii.fY,
+                      radii);
+    }
+
+    // The half-width of a corner's ellipse at distance dy from its center, measured along the
+    // direction away from the rrect's interior. Returns rx when dy <= 0, which is where the
+    // corner's side is straight.
+    static float half_width(const Corner& c, float dy) {
+        if (!c.isRound() || dy <= 0) {
+            return c.fRX;
+        }
+        if (dy >= c.fRY) {
+            return 0;
+        }
+        const float t = dy / c.fRY;
+        return c.fRX * std::sqrt(1 - t * t);
+    }
+
+    const SkRect fBounds;
+    const Corner fCorners[4];  // upper-left, upper-right, lower-left, lower-right
+    const float  fMidX, fMidY;
+};
+
+// Appends alpha[0..count) as runs, merging neighbors with the same coverage.
+int append_runs(const SkAlpha alpha[], int count, SkAlpha outAlpha[], int16_t outRuns[], int n) {
+    for (int i = 0; i < count;) {
+        int j = i + 1;
+        while (j < count && alpha[j] == alpha[i]) {
+            ++j;
+        }
+        outAlpha[n] = alpha[i];
+        outRuns[n] = SkToS16(j - i);
+        n += j - i;
+        i = j;
+    }
+    return n;
+}
+
+bool is_supported(const SkRRect& rr) {
+    if (rr.isEmpty() || !rr.rect().isFinite()) {
+        return false;
+    }
+    const SkRect& r = rr.rect();
+    if (r.fLeft < -kMaxCoord || r.fTop < -kMaxCoord || r.fRight > kMaxCoord ||
+        r.fBottom > kMaxCoord) {
+        return false;
+    }
+    for (int i = 0; i < 4; ++i) {
+        const SkVector radii = rr.radii((SkRRect::Corner)i);
+        const float minR = std::min(radii.fX, radii.fY),
+                    maxR = std::max(radii.fX, radii.fY);
+        if (maxR > 0 && minR * minR < kMinCurvatureRadius * maxR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void anti_fill_rrect(const SkRRect& rr, const SkIRect& ir, SkBlitter* blitter) {
+    const int width = ir.width();
+    skia_private::AutoSTMalloc<256, SkAlpha> rowAlpha(width);
+    skia_private::AutoSTMalloc<256, SkAlpha> alpha(width + 1);
+    skia_private::AutoSTMalloc<256, int16_t> runs(width + 1);
+
+    const RRectCoverage coverage(rr);
+    for (int y = ir.fTop; y < ir.fBottom; ++y) {
+        int L, R;
+        coverage.interior(y, &L, &R);
+        L = SkTPin(L, ir.fLeft, ir.fRight);
+        R = SkTPin(R, L, ir.fRight);
+
+        int n = 0;
+        if (L > ir.fLeft) {
+            coverage.row(y, ir.fLeft, L - ir.fLeft, rowAlpha.get());
+            n = append_runs(rowAlpha.get(), L - ir.fLeft, alpha.get(), runs.get(), n);
+        }
+        if (R > L) {
+            alpha[n] = SkToU8((int)(coverage.rowCoverage(y) * 255.f + 0.5f));
+            runs[n] = SkToS16(R - L);
+            n += R - L;
+        }
+        if (ir.fRight > R) {
+            coverage.row(y, R, ir.fRight - R, rowAlpha.get());
+            n = append_runs(rowAlpha.get(), ir.fRight - R, alpha.get(), runs.get(), n);
+        }
+        SkASSERT(n == width);
+        runs[n] = 0;
+        blitter->blitAntiH(ir.fLeft, y, alpha.get(), runs.get());
+    }
+}
+
+}  // namespace
+
+bool SkScan::AntiFillRRect(const SkRRect& rr, const SkRegion* clip, SkBlitter* blitter) {
+    if (!is_supported(rr)) {
+        return false;
+    }
+
+    SkIRect ir = rr.rect().roundOut();
+    if (clip) {
+        if (!ir.intersect(clip->getBounds())) {
+            return true;
+        }
+    }
+    if (ir.isEmpty()) {
+        return true;
+    }
+    if (ir.width() > SK_MaxS16) {
+        // Too wide for the runs passed to blitAntiH().
+        return false;
+    }
+
+    SkScanClipper clipper(blitter, clip, ir, /*skipRejectTest=*/true, /*boundsPreClipped=*/true);
+    if (SkBlitter* clippedBlitter = clipper.getBlitter()) {
+        anti_fill_rrect(rr, ir, clippedBlitter);
+    }
+    return true;
+}
+
+bool SkScan::AntiFillRRect(const SkRRect& rr, const SkRasterClip& clip, SkBlitter* blitter) {
+    if (!is_supported(rr)) {
+        return false;
+    }
+    if (clip.isBW()) {
+        return AntiFillRRect(rr, &clip.bwRgn(), blitter);
+    }
+    SkAAClipBlitterWrapper wrap(clip, blitter);
+    return AntiFillRRect(rr, &wrap.getRgn(), wrap.getBlitter());
+}
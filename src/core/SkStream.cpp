@@ -200,21 +200,61 @@ void SkFILEStream::close() {
     fEnd = 0;
     fStart = 0;
     fCurrent = 0;
+    fBuffer.reset();
+    fBufferStart = 0;
+    fBufferEnd = 0;
 }
 
+static constexpr size_t kFILEStreamReadAhead = 16 * 1024;
+
 size_t SkFILEStream::read(void* buffer, size_t size) {
     if (size > fEnd - fCurrent) {
         size = fEnd - fCurrent;
     }
-    size_t bytesRead = size;
-    if (buffer) {
-        bytesRead = sk_qread(fFILE.get(), buffer, size, fCurrent);
+    if (!buffer || size == 0) {
+        fCurrent += size;
+        return size;
     }
-    if (bytesRead == SIZE_MAX) {
-        return 0;
+
+    // First whatever we have buffered...
+    size_t bytesRead = 0;
+    if (fBufferStart <= fCurrent && fCurrent < fBufferEnd) {
+        bytesRead = std::min(size, fBufferEnd - fCurrent);
+        memcpy(buffer, fBuffer.get() + (fCurrent - fBufferStart), bytesRead);
+        fCurrent += bytesRead;
+        if (bytesRead == size) {
+            return bytesRead;
+        }
+        buffer = SkTAddOffset<void>(buffer, bytesRead);
+        size -= bytesRead;
     }
-    fCurrent += bytesRead;
-    return bytesRead;
+
+    // ... then large reads go straight to the FILE, and small ones refill the buffer.
+    if (size >= kFILEStreamReadAhead) {
+        size_t n = sk_qread(fFILE.get(), buffer, size, fCurrent);
+        if (n == SIZE_MAX) {
+            return bytesRead;
+        }
+        fCurrent += n;
+        return bytesRead + n;
+    }
+
+    if (!fBuffer) {
+        fBuffer.reset(new uint8_t[kFILEStreamReadAhead]);
+    }
+    size_t n = sk_qread(fFILE.get(), fBuffer.get(),
+                        std::min(kFILEStreamReadAhead, fEnd - fCurrent), fCurrent);
+    if (n == SIZE_MAX) {
+        fBufferStart = fBufferEnd = 0;
+        return bytesRead;
+    }
+    fBufferStart = fCurrent;
+    fBufferEnd = fCurrent + n;
+
+    n = std::min(size, n);
+    memcpy(buffer, fBuffer.get(), n);
+    fCurrent += n;
+    return bytesRead + n;
 }
 
 bool SkFILEStream::isAtEnd() const {
@@ -411,9 +451,15 @@ const void* SkMemoryStream::getAtPos() {
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+static constexpr size_t kFILEWStreamBufferSize = 64 * 1024;
+
 SkFILEWStream::SkFILEWStream(const char path[])
 {
     fFILE = sk_fopen(path, kWrite_SkFILE_Flag);
+    if (fFILE) {
+        fBuffer.reset(new char[kFILEWStreamBufferSize]);
+        setvbuf(fFILE, fBuffer.get(), _IOFBF, kFILEWStreamBufferSize);
+    }
 }
 
 SkFILEWStream::~SkFILEWStream()
@@ -16,6 +16,7 @@
 #include "include/core/SkTypeface.h"
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkTFitsIn.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkGlyph.h"
 #include "src/core/SkMask.h"
 #include "src/core/SkReadBuffer.h"
@@ -28,6 +29,7 @@
 #include <new>
 #include <optional>
 #include <utility>
+#include <vector>
 
 using namespace skglyph;
 
@@ -114,6 +116,27 @@ SkStrike::FlattenGlyphsByType(SkWriteBuffer& buffer,
     }
 }
 
+void SkStrike::flattenGlyphs(SkWriteBuffer& buffer) const {
+    // The copies share the image, path and drawable data owned by fAlloc, which is only ever
+    // appended to, so they stay valid for as long as the strike is alive.
+    std::vector<SkGlyph> images, paths, drawables;
+    {
+        SkAutoMutexExclusive lock{fStrikeLock};
+        for (const SkGlyph* glyph : fGlyphForIndex) {
+            if (glyph->setImageHasBeenCalled()) {
+                images.push_back(*glyph);
+            }
+            if (glyph->setPathHasBeenCalled()) {
+                paths.push_back(*glyph);
+            }
+            if (glyph->setDrawableHasBeenCalled()) {
+                drawables.push_back(*glyph);
+            }
+        }
+    }
+    FlattenGlyphsByType(buffer, images, paths, drawables);
+}
+
 bool SkStrike::mergeFromBuffer(SkReadBuffer& buffer) {
     // Read glyphs with images for the current strike.
     const int imagesCount = buffer.readInt();
@@ -341,6 +364,7 @@ SkGlyphDigest SkStrike::digestFor(ActionType actionType, SkPackedGlyphID packedG
         glyph = fAlloc.make<SkGlyph>(fScalerContext->makeGlyph(packedGlyphID, &fAlloc));
         fMemoryIncrease += sizeof(SkGlyph);
         digestPtr = this->addGlyphAndDigest(glyph);
+        SkCounters::Add(SkCounters::Counter::kGlyphCacheMisses);
     }
 
     digestPtr->setActionFor(actionType, glyph, this);
@@ -445,11 +469,13 @@ SkSpan<const SkGlyph*> SkStrike::internalPrepare(
 
 void SkStrike::updateMemoryUsage(size_t increase) {
     if (increase > 0) {
-        // fRemoved and the cache's total memory are managed under the cache's lock. This allows
+        // fRemoved and the shard's total memory are managed under the shard's lock. This allows
         // them to be accessed under LRU operation.
-        SkAutoMutexExclusive lock{fStrikeCache->fLock};
+        SkStrikeCache::Shard& shard = fStrikeCache->shardFor(this->getDescriptor());
+        SkAutoMutexExclusive lock{shard.fLock};
         fMemoryUsed += increase;
         if (!fRemoved) {
+            shard.fTotalMemoryUsed += increase;
             fStrikeCache->fTotalMemoryUsed += increase;
         }
     }
@@ -18,7 +18,7 @@
 #include "src/core/SkGlyph.h"
 #include "src/core/SkScalerContext.h"
 #include "src/core/SkStrikeSpec.h"
-#include "src/core/SkTHash.h"
+#include "src/core/SkTSwissTable.h"
 #include "src/text/StrikeForGPU.h"
 
 #include <cstddef>
@@ -62,6 +62,10 @@ public:
                                     SkSpan<SkGlyph> paths,
                                     SkSpan<SkGlyph> drawables);
 
+    // Flatten every glyph whose image, path or drawable has been generated, in the format read
+    // by mergeFromBuffer.
+    void flattenGlyphs(SkWriteBuffer& buffer) const SK_EXCLUDES(fStrikeLock);
+
     // Lookup (or create if needed) the returned glyph using toID. If that glyph is not initialized
     // with an image, then use the information in fromGlyph to initialize the width, height top,
     // left, format and image of the glyph. This is mainly used preserving the glyph if it was
@@ -178,7 +182,7 @@ private:
     // SkGlyphDigest's fIndex field stores the index. This pointer provides an unchanging
     // reference to the SkGlyph as long as the strike is alive, and fGlyphForIndex
     // provides a dense index for glyphs.
-    skia_private::THashTable<SkGlyphDigest, SkPackedGlyphID, SkGlyphDigest>
+    skia_private::TSwissTable<SkGlyphDigest, SkPackedGlyphID, SkGlyphDigest>
             fDigestForPackedGlyphID SK_GUARDED_BY(fStrikeLock);
 
     // Maps from a glyphIndex to a glyph
@@ -197,7 +201,7 @@ private:
 
     SkArenaAlloc            fAlloc SK_GUARDED_BY(fStrikeLock) {kMinAllocAmount};
 
-    // The following are protected by the SkStrikeCache's mutex.
+    // The following are protected by the mutex of the SkStrikeCache shard that holds this strike.
     SkStrike*                       fNext{nullptr};
     SkStrike*                       fPrev{nullptr};
     std::unique_ptr<SkStrikePinner> fPinner;
@@ -7,18 +7,37 @@
 
 #include "src/core/SkStrikeCache.h"
 
+#include "include/core/SkData.h"
+#include "include/core/SkFont.h"
+#include "include/core/SkFontMgr.h"
 #include "include/core/SkGraphics.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkSurfaceProps.h"
 #include "include/core/SkTraceMemoryDump.h"
+#include "include/core/SkTypeface.h"
 #include "include/private/base/SkAssert.h"
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkMutex.h"
+#include "include/private/base/SkTo.h"
 #include "src/core/SkDescriptor.h"
+#include "src/core/SkFontMetricsPriv.h"
+#include "src/core/SkGlyph.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkScalerContext.h"
 #include "src/core/SkStrike.h"
 #include "src/core/SkStrikeSpec.h"
+#include "src/core/SkTHash.h"
+#include "src/core/SkWriteBuffer.h"
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <optional>
 #include <utility>
+#include <vector>
 
 class SkScalerContext;
 struct SkFontMetrics;
@@ -36,11 +55,20 @@ SkStrikeCache* SkStrikeCache::GlobalStrikeCache() {
     return cache;
 }
 
+auto SkStrikeCache::shardFor(const SkDescriptor& desc) -> Shard& {
+    // Use the top bits: each shard's lookup table hashes on the bottom ones.
+    return fShards[desc.getChecksum() >> (32 - kShardBits)];
+}
+
 auto SkStrikeCache::findOrCreateStrike(const SkStrikeSpec& strikeSpec) -> sk_sp<SkStrike> {
-    SkAutoMutexExclusive ac(fLock);
-    sk_sp<SkStrike> strike = this->internalFindStrikeOrNull(strikeSpec.descriptor());
-    if (strike == nullptr) {
-        strike = this->internalCreateStrike(strikeSpec);
+    sk_sp<SkStrike> strike;
+    {
+        Shard& shard = this->shardFor(strikeSpec.descriptor());
+        SkAutoMutexExclusive ac(shard.fLock);
+        strike = this->internalFindStrikeOrNull(&shard, strikeSpec.descriptor());
+        if (strike == nullptr) {
+            strike = this->internalCreateStrike(&shard, strikeSpec);
+        }
     }
     this->internalPurge();
     return strike;
@@ -50,6 +78,164 @@ sk_sp<StrikeForGPU> SkStrikeCache::findOrCreateScopedStrike(const SkStrikeSpec&
     return this->findOrCreateStrike(strikeSpec);
 }
 
+static constexpr uint32_t kSnapshotMagic = SkSetFourByteTag('s', 'k', 's', 'c');
+static constexpr uint32_t kSnapshotVersion = 2;
+
+// Point the descriptor's rec at the typeface that will back the strike in this process.
+static bool set_typeface_id(SkDescriptor* descriptor, SkTypefaceID typefaceID) {
+    uint32_t size;
+    // findEntry returns a const void*, remove the const in order to update in place.
+    void* ptr = const_cast<void*>(descriptor->findEntry(kRec_SkDescriptorTag, &size));
+    SkScalerContextRec rec;
+    if (!ptr || size != sizeof(rec)) { return false; }
+    std::memcpy((void*)&rec, ptr, size);
+    rec.fTypefaceID = typefaceID;
+    std::memcpy(ptr, &rec, size);
+    descriptor->computeChecksum();
+    return true;
+}
+
+sk_sp<SkData> SkStrikeCache::writeSnapshot() const {
+    // Collect the strikes first, so no shard is locked while their glyphs are flattened.
+    std::vector<sk_sp<SkStrike>> strikes;
+    for (const Shard& shard : fShards) {
+        SkAutoMutexExclusive ac(shard.fLock);
+        for (SkStrike* strike = shard.fHead; strike != nullptr; strike = strike->fNext) {
+            // Pinned strikes are owned by a remote glyph cache client, and are backed by proxy
+            // typefaces that can't be recreated.
+            if (strike->fPinner == nullptr) {
+                strikes.push_back(sk_ref_sp(strike));
+            }
+        }
+    }
+
+    // Each typeface is written once, and strikes refer to it by index.
+    skia_private::THashMap<SkTypefaceID, int> typefaceIndices;
+    std::vector<sk_sp<SkData>> typefaceData;
+    std::vector<int> typefaceGlyphCounts;
+    std::vector<int> strikeTypefaces;
+    for (const sk_sp<SkStrike>& strike : strikes) {
+        const SkTypeface& typeface = strike->strikeSpec().typeface();
+        int* index = typefaceIndices.find(typeface.uniqueID());
+        if (index == nullptr) {
+            sk_sp<SkData> data = typeface.serialize();
+            index = typefaceIndices.set(typeface.uniqueID(), data ? SkToInt(typefaceData.size())
+                                                                  : -1);
+            if (data) {
+                typefaceData.push_back(std::move(data));
+                typefaceGlyphCounts.push_back(typeface.countGlyphs());
+            }
+        }
+        strikeTypefaces.push_back(*index);
+    }
+
+    SkBinaryWriteBuffer buffer{nullptr, 0, {}};
+    buffer.writeUInt(kSnapshotMagic);
+    buffer.writeUInt(kSnapshotVersion);
+
+    buffer.writeInt(SkToInt(typefaceData.size()));
+    for (size_t i = 0; i < typefaceData.size(); ++i) {
+        buffer.writeDataAsByteArray(typefaceData[i].get());
+        buffer.writeInt(typefaceGlyphCounts[i]);
+    }
+
+    buffer.writeInt(SkToInt(std::count_if(strikeTypefaces.begin(), strikeTypefaces.end(),
+                                          [](int index) { return index >= 0; })));
+    for (size_t i = 0; i < strikes.size(); ++i) {
+        if (strikeTypefaces[i] < 0) {
+            continue;
+        }
+        const SkStrike& strike = *strikes[i];
+        buffer.writeInt(strikeTypefaces[i]);
+        strike.getDescriptor().flatten(buffer);
+        SkFontMetricsPriv::Flatten(buffer, strike.getFontMetrics());
+
+        // The glyphs go in their own byte array, so that a reader can skip strikes it does not
+        // restore.
+        SkBinaryWriteBuffer glyphs{nullptr, 0, {}};
+        strike.flattenGlyphs(glyphs);
+        buffer.writeDataAsByteArray(glyphs.snapshotAsData().get());
+    }
+
+    return buffer.snapshotAsData();
+}
+
+int SkStrikeCache::readSnapshot(const void* data, size_t size, sk_sp<SkFontMgr> fontMgr) {
+    SkReadBuffer buffer{data, size};
+    // Limit the kinds of effects that appear in a glyph's drawable (crbug.com/1442140).
+    buffer.setAllowSkSL(false);
+
+    const uint32_t magic = buffer.readUInt();
+    const uint32_t version = buffer.readUInt();
+    if (!buffer.validate(magic == kSnapshotMagic && version == kSnapshotVersion)) {
+        return -1;
+    }
+
+    const int typefaceCount = buffer.readInt();
+    if (!buffer.validate(typefaceCount >= 0)) {
+        return -1;
+    }
+    std::vector<sk_sp<SkTypeface>> typefaces;
+    for (int i = 0; i < typefaceCount; ++i) {
+        sk_sp<SkData> typefaceData = buffer.readByteArrayAsData();
+        const int glyphCount = buffer.readInt();
+        if (!buffer.isValid()) {
+            return -1;
+        }
+        SkMemoryStream stream{std::move(typefaceData)};
+        sk_sp<SkTypeface> typeface = SkTypeface::MakeDeserialize(&stream, fontMgr);
+        // The font behind a name may have changed since the snapshot was written.
+        if (typeface && typeface->countGlyphs() != glyphCount) {
+            typeface = nullptr;
+        }
+        typefaces.push_back(std::move(typeface));
+    }
+
+    const int strikeCount = buffer.readInt();
+    if (!buffer.validate(strikeCount >= 0)) {
+        return -1;
+    }
+    int restored = 0;
+    for (int i = 0; i < strikeCount; ++i) {
+        const int typefaceIndex = buffer.readInt();
+        std::optional<SkAutoDescriptor> descriptor = SkAutoDescriptor::MakeFromBuffer(buffer);
+        std::optional<SkFontMetrics> fontMetrics = SkFontMetricsPriv::MakeFromBuffer(buffer);
+        size_t glyphsSize;
+        const void* glyphs = buffer.skipByteArray(&glyphsSize);
+        if (!buffer.validate(descriptor.has_value() && fontMetrics.has_value() &&
+                             0 <= typefaceIndex && typefaceIndex < typefaceCount)) {
+            return -1;
+        }
+
+        const sk_sp<SkTypeface>& typeface = typefaces[typefaceIndex];
+        if (typeface == nullptr || !set_typeface_id(descriptor->getDesc(), typeface->uniqueID())) {
+            continue;
+        }
+
+        const SkDescriptor& desc = *descriptor->getDesc();
+        sk_sp<SkStrike> strike;
+        {
+            Shard& shard = this->shardFor(desc);
+            SkAutoMutexExclusive ac(shard.fLock);
+            if (this->internalFindStrikeOrNull(&shard, desc) != nullptr) {
+                continue;
+            }
+            strike = this->internalCreateStrike(
+                    &shard, SkStrikeSpec{desc, typeface}, &fontMetrics.value());
+        }
+
+        SkReadBuffer glyphBuffer{glyphs, glyphsSize};
+        glyphBuffer.setAllowSkSL(false);
+        if (!strike->mergeFromBuffer(glyphBuffer)) {
+            return -1;
+        }
+        restored += 1;
+    }
+
+    this->internalPurge();
+    return restored;
+}
+
 void SkStrikeCache::PurgeAll() {
     GlobalStrikeCache()->purgeAll();
 }
@@ -90,93 +276,142 @@ void SkStrikeCache::DumpMemoryStatistics(SkTraceMemoryDump* dump) {
 }
 
 sk_sp<SkStrike> SkStrikeCache::findStrike(const SkDescriptor& desc) {
-    SkAutoMutexExclusive ac(fLock);
-    sk_sp<SkStrike> result = this->internalFindStrikeOrNull(desc);
+    sk_sp<SkStrike> result;
+    {
+        Shard& shard = this->shardFor(desc);
+        SkAutoMutexExclusive ac(shard.fLock);
+        result = this->internalFindStrikeOrNull(&shard, desc);
+    }
     this->internalPurge();
     return result;
 }
 
-auto SkStrikeCache::internalFindStrikeOrNull(const SkDescriptor& desc) -> sk_sp<SkStrike> {
+auto SkStrikeCache::internalFindStrikeOrNull(Shard* shard,
+                                             const SkDescriptor& desc) -> sk_sp<SkStrike> {
+    SkStrike* head = shard->fHead;
 
     // Check head because it is likely the strike we are looking for.
-    if (fHead != nullptr && fHead->getDescriptor() == desc) { return sk_ref_sp(fHead); }
+    if (head != nullptr && head->getDescriptor() == desc) { return sk_ref_sp(head); }
 
     // Do the heavy search looking for the strike.
-    sk_sp<SkStrike>* strikeHandle = fStrikeLookup.find(desc);
+    sk_sp<SkStrike>* strikeHandle = shard->fStrikeLookup.find(desc);
     if (strikeHandle == nullptr) { return nullptr; }
     SkStrike* strikePtr = strikeHandle->get();
     SkASSERT(strikePtr != nullptr);
-    if (fHead != strikePtr) {
+    if (head != strikePtr) {
         // Make most recently used
         strikePtr->fPrev->fNext = strikePtr->fNext;
         if (strikePtr->fNext != nullptr) {
             strikePtr->fNext->fPrev = strikePtr->fPrev;
         } else {
-            fTail = strikePtr->fPrev;
+            shard->fTail = strikePtr->fPrev;
         }
-        fHead->fPrev = strikePtr;
-        strikePtr->fNext = fHead;
+        head->fPrev = strikePtr;
+        strikePtr->fNext = head;
         strikePtr->fPrev = nullptr;
-        fHead = strikePtr;
+        shard->fHead = strikePtr;
     }
     return sk_ref_sp(strikePtr);
 }
 
+void SkStrikeCache::prepopulate(const SkFont& font,
+                                SkSpan<const SkGlyphID> glyphIDs,
+                                const SkMatrix& matrix,
+                                const SkSurfaceProps& surfaceProps,
+                                SkScalerContextFlags scalerContextFlags) {
+    // The strike is locked while a batch is generated, so batches keep a thread that draws with
+    // the same strike from waiting for the whole set.
+    static constexpr size_t kBatchSize = 64;
+    const SkGlyph* results[kBatchSize];
+    const SkPaint paint;
+
+    if (SkStrikeSpec::ShouldDrawAsPath(paint, font, matrix)) {
+        auto [strikeSpec, _] =
+                SkStrikeSpec::MakePath(font, paint, surfaceProps, scalerContextFlags);
+        sk_sp<SkStrike> strike = strikeSpec.findOrCreateStrike(this);
+        for (size_t i = 0; i < glyphIDs.size(); i += kBatchSize) {
+            strike->preparePaths(glyphIDs.subspan(i, std::min(kBatchSize, glyphIDs.size() - i)),
+                                 results);
+        }
+        return;
+    }
+
+    SkStrikeSpec strikeSpec =
+            SkStrikeSpec::MakeMask(font, paint, surfaceProps, scalerContextFlags, matrix);
+    sk_sp<SkStrike> strike = strikeSpec.findOrCreateStrike(this);
+
+    // Positions are rounded to one of four offsets along each axis that has subpixel positioning.
+    const SkIPoint subpixelMask = strike->roundingSpec().ignorePositionFieldMask;
+    const uint32_t xCount = subpixelMask.x() ? 1u << SkPackedGlyphID::kSubPixelPosLen : 1,
+                   yCount = subpixelMask.y() ? 1u << SkPackedGlyphID::kSubPixelPosLen : 1;
+    SkPackedGlyphID packedIDs[kBatchSize];
+    size_t count = 0;
+    for (SkGlyphID glyphID : glyphIDs) {
+        for (uint32_t y = 0; y < yCount; ++y) {
+            for (uint32_t x = 0; x < xCount; ++x) {
+                packedIDs[count++] = SkPackedGlyphID{glyphID, x, y};
+                if (count == kBatchSize) {
+                    strike->prepareImages(packedIDs, results);
+                    count = 0;
+                }
+            }
+        }
+    }
+    strike->prepareImages(SkSpan(packedIDs, count), results);
+}
+
 sk_sp<SkStrike> SkStrikeCache::createStrike(
         const SkStrikeSpec& strikeSpec,
         SkFontMetrics* maybeMetrics,
         std::unique_ptr<SkStrikePinner> pinner) {
-    SkAutoMutexExclusive ac(fLock);
-    return this->internalCreateStrike(strikeSpec, maybeMetrics, std::move(pinner));
+    Shard& shard = this->shardFor(strikeSpec.descriptor());
+    SkAutoMutexExclusive ac(shard.fLock);
+    return this->internalCreateStrike(&shard, strikeSpec, maybeMetrics, std::move(pinner));
 }
 
 auto SkStrikeCache::internalCreateStrike(
+        Shard* shard,
         const SkStrikeSpec& strikeSpec,
         SkFontMetrics* maybeMetrics,
         std::unique_ptr<SkStrikePinner> pinner) -> sk_sp<SkStrike> {
     std::unique_ptr<SkScalerContext> scaler = strikeSpec.createScalerContext();
     auto strike =
         sk_make_sp<SkStrike>(this, strikeSpec, std::move(scaler), maybeMetrics, std::move(pinner));
-    this->internalAttachToHead(strike);
+    this->internalAttachToHead(shard, strike);
     return strike;
 }
 
 void SkStrikeCache::purgePinned(size_t minBytesNeeded) {
-    SkAutoMutexExclusive ac(fLock);
     this->internalPurge(minBytesNeeded, /* checkPinners= */ true);
 }
 
 void SkStrikeCache::purgeAll() {
-    SkAutoMutexExclusive ac(fLock);
-    this->internalPurge(fTotalMemoryUsed, /* checkPinners= */ true);
+    for (Shard& shard : fShards) {
+        SkAutoMutexExclusive ac(shard.fLock);
+        this->internalPurgeShard(&shard, shard.fTotalMemoryUsed, shard.fCacheCount,
+                                 /* checkPinners= */ true);
+    }
 }
 
 size_t SkStrikeCache::getTotalMemoryUsed() const {
-    SkAutoMutexExclusive ac(fLock);
     return fTotalMemoryUsed;
 }
 
 int SkStrikeCache::getCacheCountUsed() const {
-    SkAutoMutexExclusive ac(fLock);
     return fCacheCount;
 }
 
 int SkStrikeCache::getCacheCountLimit() const {
-    SkAutoMutexExclusive ac(fLock);
     return fCacheCountLimit;
 }
 
 size_t SkStrikeCache::setCacheSizeLimit(size_t newLimit) {
-    SkAutoMutexExclusive ac(fLock);
-
-    size_t prevLimit = fCacheSizeLimit;
-    fCacheSizeLimit = newLimit;
+    size_t prevLimit = fCacheSizeLimit.exchange(newLimit);
     this->internalPurge();
     return prevLimit;
 }
 
 size_t  SkStrikeCache::getCacheSizeLimit() const {
-    SkAutoMutexExclusive ac(fLock);
     return fCacheSizeLimit;
 }
 
@@ -185,21 +420,20 @@ int SkStrikeCache::setCacheCountLimit(int newCount) {
         newCount = 0;
     }
 
-    SkAutoMutexExclusive ac(fLock);
-
-    int prevCount = fCacheCountLimit;
-    fCacheCountLimit = newCount;
+    int prevCount = fCacheCountLimit.exchange(newCount);
     this->internalPurge();
     return prevCount;
 }
 
 void SkStrikeCache::forEachStrike(std::function<void(const SkStrike&)> visitor) const {
-    SkAutoMutexExclusive ac(fLock);
+    for (const Shard& shard : fShards) {
+        SkAutoMutexExclusive ac(shard.fLock);
 
-    this->validate();
+        this->validate(shard);
 
-    for (SkStrike* strike = fHead; strike != nullptr; strike = strike->fNext) {
-        visitor(*strike);
+        for (SkStrike* strike = shard.fHead; strike != nullptr; strike = strike->fNext) {
+            visitor(*strike);
+        }
     }
 }
 
@@ -209,24 +443,29 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded, bool checkPinners) {
     checkPinners = true;
 #endif
 
-    if (fPinnerCount == fCacheCount && !checkPinners)
+    // These are read without any lock, so they may be slightly stale; that only makes a purge
+    // happen one call sooner or later.
+    const size_t  totalMemoryUsed = fTotalMemoryUsed;
+    const int32_t cacheCount      = fCacheCount;
+
+    if (fPinnerCount == cacheCount && !checkPinners)
         return 0;
 
     size_t bytesNeeded = 0;
-    if (fTotalMemoryUsed > fCacheSizeLimit) {
-        bytesNeeded = fTotalMemoryUsed - fCacheSizeLimit;
+    if (totalMemoryUsed > fCacheSizeLimit) {
+        bytesNeeded = totalMemoryUsed - fCacheSizeLimit;
     }
     bytesNeeded = std::max(bytesNeeded, minBytesNeeded);
     if (bytesNeeded) {
         // no small purges!
-        bytesNeeded = std::max(bytesNeeded, fTotalMemoryUsed >> 2);
+        bytesNeeded = std::max(bytesNeeded, totalMemoryUsed >> 2);
     }
 
     int countNeeded = 0;
-    if (fCacheCount > fCacheCountLimit) {
-        countNeeded = fCacheCount - fCacheCountLimit;
+    if (cacheCount > fCacheCountLimit) {
+        countNeeded = cacheCount - fCacheCountLimit;
         // no small purges!
-        countNeeded = std::max(countNeeded, fCacheCount >> 2);
+        countNeeded = std::max(countNeeded, cacheCount >> 2);
     }
 
     // early exit
@@ -234,12 +473,44 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded, bool checkPinners) {
         return 0;
     }
 
+    // Each shard frees its share of the overage, in proportion to how much of the cache it holds.
+    // Strikes are spread over the shards by hash, so this approximates purging one global LRU.
+    size_t bytesFreed = 0;
+    for (Shard& shard : fShards) {
+        SkAutoMutexExclusive ac(shard.fLock);
+        size_t shardBytes = 0;
+        if (bytesNeeded && totalMemoryUsed) {
+            const double share = static_cast<double>(shard.fTotalMemoryUsed) / totalMemoryUsed;
+            shardBytes = static_cast<size_t>(std::ceil(share * bytesNeeded));
+        }
+        int shardCount = 0;
+        if (countNeeded && cacheCount) {
+            shardCount = (countNeeded * shard.fCacheCount + cacheCount - 1) / cacheCount;
+        }
+        if (shardBytes || shardCount) {
+            bytesFreed += this->internalPurgeShard(&shard, shardBytes, shardCount, checkPinners);
+        }
+    }
+
+#ifdef SPEW_PURGE_STATUS
+    if (bytesFreed) {
+        SkDebugf("purging %dK from font cache\n", (int)(bytesFreed >> 10));
+    }
+#endif
+
+    return bytesFreed;
+}
+
+size_t SkStrikeCache::internalPurgeShard(Shard* shard,
+                                         size_t bytesNeeded,
+                                         int countNeeded,
+                                         bool checkPinners) {
     size_t  bytesFreed = 0;
     int     countFreed = 0;
 
     // Start at the tail and proceed backwards deleting; the list is in LRU
     // order, with unimportant entries at the tail.
-    SkStrike* strike = fTail;
+    SkStrike* strike = shard->fTail;
     while (strike != nullptr && (bytesFreed < bytesNeeded || countFreed < countNeeded)) {
         SkStrike* prev = strike->fPrev;
 
@@ -247,47 +518,44 @@ size_t SkStrikeCache::internalPurge(size_t minBytesNeeded, bool checkPinners) {
         if (strike->fPinner == nullptr || (checkPinners && strike->fPinner->canDelete())) {
             bytesFreed += strike->fMemoryUsed;
             countFreed += 1;
-            this->internalRemoveStrike(strike);
+            this->internalRemoveStrike(shard, strike);
         }
         strike = prev;
     }
 
-    this->validate();
-
-#ifdef SPEW_PURGE_STATUS
-    if (countFreed) {
-        SkDebugf("purging %dK from font cache [%d entries]\n",
-                 (int)(bytesFreed >> 10), countFreed);
-    }
-#endif
+    this->validate(*shard);
 
     return bytesFreed;
 }
 
-void SkStrikeCache::internalAttachToHead(sk_sp<SkStrike> strike) {
-    SkASSERT(fStrikeLookup.find(strike->getDescriptor()) == nullptr);
+void SkStrikeCache::internalAttachToHead(Shard* shard, sk_sp<SkStrike> strike) {
+    SkASSERT(shard->fStrikeLookup.find(strike->getDescriptor()) == nullptr);
     SkStrike* strikePtr = strike.get();
-    fStrikeLookup.set(std::move(strike));
+    shard->fStrikeLookup.set(std::move(strike));
     SkASSERT(nullptr == strikePtr->fPrev && nullptr == strikePtr->fNext);
 
+    shard->fCacheCount += 1;
+    shard->fTotalMemoryUsed += strikePtr->fMemoryUsed;
     fCacheCount += 1;
     fPinnerCount += strikePtr->fPinner != nullptr ? 1 : 0;
     fTotalMemoryUsed += strikePtr->fMemoryUsed;
 
-    if (fHead != nullptr) {
-        fHead->fPrev = strikePtr;
-        strikePtr->fNext = fHead;
+    if (shard->fHead != nullptr) {
+        shard->fHead->fPrev = strikePtr;
+        strikePtr->fNext = shard->fHead;
     }
 
-    if (fTail == nullptr) {
-        fTail = strikePtr;
+    if (shard->fTail == nullptr) {
+        shard->fTail = strikePtr;
     }
 
-    fHead = strikePtr; // Transfer ownership of strike to the cache list.
+    shard->fHead = strikePtr; // Transfer ownership of strike to the cache list.
 }
 
-void SkStrikeCache::internalRemoveStrike(SkStrike* strike) {
-    SkASSERT(fCacheCount > 0);
+void SkStrikeCache::internalRemoveStrike(Shard* shard, SkStrike* strike) {
+    SkASSERT(shard->fCacheCount > 0);
+    shard->fCacheCount -= 1;
+    shard->fTotalMemoryUsed -= strike->fMemoryUsed;
     fCacheCount -= 1;
     fPinnerCount -= strike->fPinner != nullptr ? 1 : 0;
     fTotalMemoryUsed -= strike->fMemoryUsed;
@@ -295,38 +563,39 @@ void SkStrikeCache::internalRemoveStrike(SkStrike* strike) {
     if (strike->fPrev) {
         strike->fPrev->fNext = strike->fNext;
     } else {
-        fHead = strike->fNext;
+        shard->fHead = strike->fNext;
     }
     if (strike->fNext) {
         strike->fNext->fPrev = strike->fPrev;
     } else {
-        fTail = strike->fPrev;
+        shard->fTail = strike->fPrev;
     }
 
     strike->fPrev = strike->fNext = nullptr;
     strike->fRemoved = true;
-    fStrikeLookup.remove(strike->getDescriptor());
+    shard->fStrikeLookup.remove(strike->getDescriptor());
 }
 
-void SkStrikeCache::validate() const {
+void SkStrikeCache::validate(const Shard& shard) const {
 #ifdef SK_DEBUG
     size_t computedBytes = 0;
     int computedCount = 0;
 
-    const SkStrike* strike = fHead;
+    const SkStrike* strike = shard.fHead;
     while (strike != nullptr) {
         computedBytes += strike->fMemoryUsed;
         computedCount += 1;
-        SkASSERT(fStrikeLookup.findOrNull(strike->getDescriptor()) != nullptr);
+        SkASSERT(shard.fStrikeLookup.findOrNull(strike->getDescriptor()) != nullptr);
         strike = strike->fNext;
     }
 
-    if (fCacheCount != computedCount) {
-        SkDebugf("fCacheCount: %d, computedCount: %d", fCacheCount, computedCount);
+    if (shard.fCacheCount != computedCount) {
+        SkDebugf("fCacheCount: %d, computedCount: %d", shard.fCacheCount, computedCount);
         SK_ABORT("fCacheCount != computedCount");
     }
-    if (fTotalMemoryUsed != computedBytes) {
-        SkDebugf("fTotalMemoryUsed: %zu, computedBytes: %zu", fTotalMemoryUsed, computedBytes);
+    if (shard.fTotalMemoryUsed != computedBytes) {
+        SkDebugf("fTotalMemoryUsed: %zu, computedBytes: %zu",
+                 shard.fTotalMemoryUsed, computedBytes);
         SK_ABORT("fTotalMemoryUsed == computedBytes");
     }
 #endif
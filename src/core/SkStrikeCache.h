@@ -9,6 +9,8 @@
 #define SkStrikeCache_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSpan.h"
+#include "include/core/SkTypes.h"
 #include "include/private/base/SkLoadUserConfig.h" // IWYU pragma: keep
 #include "include/private/base/SkMutex.h"
 #include "include/private/base/SkThreadAnnotations.h"
@@ -16,15 +18,22 @@
 #include "src/core/SkTHash.h"
 #include "src/text/StrikeForGPU.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 
+class SkData;
 class SkDescriptor;
+class SkFont;
+class SkFontMgr;
+class SkMatrix;
 class SkStrikeSpec;
+class SkSurfaceProps;
 class SkTraceMemoryDump;
 struct SkFontMetrics;
+enum class SkScalerContextFlags : uint32_t;
 
 //  SK_DEFAULT_FONT_CACHE_COUNT_LIMIT and SK_DEFAULT_FONT_CACHE_LIMIT can be set using -D on your
 //  compiler commandline, or by using the defines in SkUserConfig.h
@@ -38,23 +47,27 @@ struct SkFontMetrics;
 
 ///////////////////////////////////////////////////////////////////////////////
 
+// The cache is split into shards, each with its own lock, lookup table and LRU list. A strike
+// always lives in the shard picked by its descriptor's checksum, so threads looking up different
+// strikes rarely contend. The budget is still enforced for the cache as a whole: the totals are
+// kept across all shards, and purging frees each shard's share of the overage from its LRU tail.
 class SkStrikeCache final : public sktext::StrikeForGPUCacheInterface {
 public:
     SkStrikeCache() = default;
 
     static SkStrikeCache* GlobalStrikeCache();
 
-    sk_sp<SkStrike> findStrike(const SkDescriptor& desc) SK_EXCLUDES(fLock);
+    sk_sp<SkStrike> findStrike(const SkDescriptor& desc);
 
     sk_sp<SkStrike> createStrike(
             const SkStrikeSpec& strikeSpec,
             SkFontMetrics* maybeMetrics = nullptr,
-            std::unique_ptr<SkStrikePinner> = nullptr) SK_EXCLUDES(fLock);
+            std::unique_ptr<SkStrikePinner> = nullptr);
 
-    sk_sp<SkStrike> findOrCreateStrike(const SkStrikeSpec& strikeSpec) SK_EXCLUDES(fLock);
+    sk_sp<SkStrike> findOrCreateStrike(const SkStrikeSpec& strikeSpec);
 
     sk_sp<sktext::StrikeForGPU> findOrCreateScopedStrike(
-            const SkStrikeSpec& strikeSpec) override SK_EXCLUDES(fLock);
+            const SkStrikeSpec& strikeSpec) override;
 
     static void PurgeAll();
     static void Dump();
@@ -63,55 +76,101 @@ public:
     // SkTraceMemoryDump interface.
     static void DumpMemoryStatistics(SkTraceMemoryDump* dump);
 
-    void purgeAll() SK_EXCLUDES(fLock); // does not change budget
-    void purgePinned(size_t minBytesNeeded = 0) SK_EXCLUDES(fLock);
-
-    int getCacheCountLimit() const SK_EXCLUDES(fLock);
-    int setCacheCountLimit(int limit) SK_EXCLUDES(fLock);
-    int getCacheCountUsed() const SK_EXCLUDES(fLock);
-
-    size_t getCacheSizeLimit() const SK_EXCLUDES(fLock);
-    size_t setCacheSizeLimit(size_t limit) SK_EXCLUDES(fLock);
-    size_t getTotalMemoryUsed() const SK_EXCLUDES(fLock);
+    // Snapshots let a process skip regenerating the glyphs it drew on a previous run.
+    // writeSnapshot() flattens the metrics, masks, paths and drawables generated so far for every
+    // strike. Typefaces are recorded with SkTypeface::serialize(), so system fonts are recorded
+    // by name and style, and only fonts made from memory carry their data.
+    sk_sp<SkData> writeSnapshot() const;
+
+    // Warms the cache from a snapshot, which may point straight into a memory-mapped file; the
+    // glyph data is copied out. A typeface is resolved with SkTypeface::MakeDeserialize(), with
+    // fontMgr as the fallback; strikes whose typeface can't be found, or no longer matches, and
+    // strikes already in the cache are skipped. Returns the number of strikes added, or -1 if the
+    // data is not a valid snapshot.
+    int readSnapshot(const void* data, size_t size, sk_sp<SkFontMgr> fontMgr);
+
+    // Generates glyphs ahead of their first draw, the way a device with these surface props and
+    // scaler context flags draws them with a default paint and the given matrix: as paths if the
+    // font is too large for masks, and otherwise as masks, including each subpixel variant.
+    void prepopulate(const SkFont& font,
+                     SkSpan<const SkGlyphID> glyphIDs,
+                     const SkMatrix& matrix,
+                     const SkSurfaceProps& surfaceProps,
+                     SkScalerContextFlags scalerContextFlags);
+
+    void purgeAll(); // does not change budget
+    void purgePinned(size_t minBytesNeeded = 0);
+
+    int getCacheCountLimit() const;
+    int setCacheCountLimit(int limit);
+    int getCacheCountUsed() const;
+
+    size_t getCacheSizeLimit() const;
+    size_t setCacheSizeLimit(size_t limit);
+    size_t getTotalMemoryUsed() const;
 
 private:
-    friend class SkStrike;  // for SkStrike::updateDelta
+    friend class SkStrike;  // for SkStrike::updateMemoryUsage
     static constexpr char kGlyphCacheDumpName[] = "skia/sk_glyph_cache";
-    sk_sp<SkStrike> internalFindStrikeOrNull(const SkDescriptor& desc) SK_REQUIRES(fLock);
+
+    static constexpr int kShardBits = 3;
+    static constexpr int kShardCount = 1 << kShardBits;
+
+    struct StrikeTraits {
+        static const SkDescriptor& GetKey(const sk_sp<SkStrike>& strike);
+        static uint32_t Hash(const SkDescriptor& descriptor);
+    };
+
+    struct Shard {
+        mutable SkMutex fLock;
+        SkStrike* fHead SK_GUARDED_BY(fLock) {nullptr};
+        SkStrike* fTail SK_GUARDED_BY(fLock) {nullptr};
+        skia_private::THashTable<sk_sp<SkStrike>, SkDescriptor, StrikeTraits> fStrikeLookup
+                SK_GUARDED_BY(fLock);
+        size_t  fTotalMemoryUsed SK_GUARDED_BY(fLock) {0};
+        int32_t fCacheCount SK_GUARDED_BY(fLock) {0};
+    };
+
+    Shard& shardFor(const SkDescriptor& desc);
+
+    sk_sp<SkStrike> internalFindStrikeOrNull(Shard* shard, const SkDescriptor& desc)
+            SK_REQUIRES(shard->fLock);
     sk_sp<SkStrike> internalCreateStrike(
+            Shard* shard,
             const SkStrikeSpec& strikeSpec,
             SkFontMetrics* maybeMetrics = nullptr,
-            std::unique_ptr<SkStrikePinner> = nullptr) SK_REQUIRES(fLock);
+            std::unique_ptr<SkStrikePinner> = nullptr) SK_REQUIRES(shard->fLock);
 
-    // The following methods can only be called when mutex is already held.
-    void internalRemoveStrike(SkStrike* strike) SK_REQUIRES(fLock);
-    void internalAttachToHead(sk_sp<SkStrike> strike) SK_REQUIRES(fLock);
+    // The following methods can only be called when the shard's mutex is already held.
+    void internalRemoveStrike(Shard* shard, SkStrike* strike) SK_REQUIRES(shard->fLock);
+    void internalAttachToHead(Shard* shard, sk_sp<SkStrike> strike) SK_REQUIRES(shard->fLock);
 
     // Checkout budgets, modulated by the specified min-bytes-needed-to-purge,
-    // and attempt to purge caches to match.
+    // and attempt to purge caches to match. Locks each shard in turn, so no shard's mutex may
+    // be held by the caller.
     // Returns number of bytes freed.
-    size_t internalPurge(size_t minBytesNeeded = 0, bool checkPinners = false) SK_REQUIRES(fLock);
+    size_t internalPurge(size_t minBytesNeeded = 0, bool checkPinners = false);
 
-    // A simple accounting of what each glyph cache reports and the strike cache total.
-    void validate() const SK_REQUIRES(fLock);
+    // Frees up to bytesNeeded and countNeeded from the tail of one shard's LRU list.
+    size_t internalPurgeShard(Shard* shard,
+                              size_t bytesNeeded,
+                              int countNeeded,
+                              bool checkPinners) SK_REQUIRES(shard->fLock);
 
-    void forEachStrike(std::function<void(const SkStrike&)> visitor) const SK_EXCLUDES(fLock);
+    // A simple accounting of what each glyph cache reports and the shard total.
+    void validate(const Shard& shard) const SK_REQUIRES(shard.fLock);
 
-    mutable SkMutex fLock;
-    SkStrike* fHead SK_GUARDED_BY(fLock) {nullptr};
-    SkStrike* fTail SK_GUARDED_BY(fLock) {nullptr};
-    struct StrikeTraits {
-        static const SkDescriptor& GetKey(const sk_sp<SkStrike>& strike);
-        static uint32_t Hash(const SkDescriptor& descriptor);
-    };
-    skia_private::THashTable<sk_sp<SkStrike>, SkDescriptor, StrikeTraits> fStrikeLookup
-            SK_GUARDED_BY(fLock);
-
-    size_t  fCacheSizeLimit{SK_DEFAULT_FONT_CACHE_LIMIT};
-    size_t  fTotalMemoryUsed SK_GUARDED_BY(fLock) {0};
-    int32_t fCacheCountLimit{SK_DEFAULT_FONT_CACHE_COUNT_LIMIT};
-    int32_t fCacheCount SK_GUARDED_BY(fLock) {0};
-    int32_t fPinnerCount SK_GUARDED_BY(fLock) {0};
+    void forEachStrike(std::function<void(const SkStrike&)> visitor) const;
+
+    Shard fShards[kShardCount];
+
+    // Totals across all the shards. These are only changed with a shard's mutex held, but are
+    // read without one to check the budget.
+    std::atomic<size_t>  fCacheSizeLimit{SK_DEFAULT_FONT_CACHE_LIMIT};
+    std::atomic<size_t>  fTotalMemoryUsed{0};
+    std::atomic<int32_t> fCacheCountLimit{SK_DEFAULT_FONT_CACHE_COUNT_LIMIT};
+    std::atomic<int32_t> fCacheCount{0};
+    std::atomic<int32_t> fPinnerCount{0};
 };
 
 #endif  // SkStrikeCache_DEFINED
@@ -12,6 +12,7 @@
 #include "src/core/SkGeometry.h"
 #include "src/core/SkPathPriv.h"
 #include "src/core/SkPointPriv.h"
+#include "src/core/SkStrokeCache.h"
 
 #include <utility>
 
@@ -1416,9 +1417,30 @@ private:
     bool            fSwapWithSrc;
 };
 
+// Below this many verbs, stroking is cheap enough that it isn't worth a cache entry.
+static constexpr int kMinVerbsToCache = 32;
+
 void SkStroke::strokePath(const SkPath& src, SkPath* dst) const {
     SkASSERT(dst);
 
+    const bool cacheable = fWidth > 0 && !src.isVolatile() &&
+                           src.countVerbs() >= kMinVerbsToCache;
+    if (!cacheable) {
+        this->strokePathUncached(src, dst);
+        return;
+    }
+    // Read the ID first, since src and dst may be the same path.
+    const uint32_t srcGenID = src.getGenerationID();
+    if (SkStrokeCache::Find(srcGenID, *this, dst)) {
+        return;
+    }
+    this->strokePathUncached(src, dst);
+    SkStrokeCache::Add(srcGenID, *this, *dst);
+}
+
+void SkStroke::strokePathUncached(const SkPath& src, SkPath* dst) const {
+    SkASSERT(dst);
+
     SkScalar radius = SkScalarHalf(fWidth);
 
     AutoTmpPath tmp(src, &dst);
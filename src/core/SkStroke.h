@@ -37,7 +37,10 @@ public:
     SkPaint::Join   getJoin() const { return (SkPaint::Join)fJoin; }
     void        setJoin(SkPaint::Join);
 
+    SkScalar getMiterLimit() const { return fMiterLimit; }
     void    setMiterLimit(SkScalar);
+
+    SkScalar getWidth() const { return fWidth; }
     void    setWidth(SkScalar);
 
     bool    getDoFill() const { return SkToBool(fDoFill); }
@@ -62,11 +65,17 @@ public:
      */
     void    strokeRect(const SkRect& rect, SkPath* result,
                        SkPathDirection = SkPathDirection::kCW) const;
+    /**
+     *  Stroke the specified path. Strokes of non-volatile paths with enough verbs are cached in
+     *  SkResourceCache, so stroking the same path again the same way copies the cached outline.
+     */
     void    strokePath(const SkPath& path, SkPath*) const;
 
     ////////////////////////////////////////////////////////////////
 
 private:
+    void    strokePathUncached(const SkPath& path, SkPath*) const;
+
     SkScalar    fWidth, fMiterLimit;
     SkScalar    fResScale;
     uint8_t     fCap, fJoin;
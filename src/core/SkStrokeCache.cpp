@@ -0,0 +1,85 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkStrokeCache.h"
+
+#include "include/core/SkPath.h"
+#include "include/core/SkScalar.h"
+#include "include/private/base/SkOnce.h"
+#include "src/core/SkResourceCache.h"
+#include "src/core/SkStroke.h"
+
+#include <cstddef>
+
+#define CHECK_LOCAL(localCache, localName, globalName, ...) \
+    ((localCache) ? localCache->localName(__VA_ARGS__) : SkResourceCache::globalName(__VA_ARGS__))
+
+namespace {
+static unsigned gStrokeKeyNamespaceLabel;
+
+// Stroked outlines can be rebuilt from their source paths, so like blur masks they are limited to
+// a share of the global cache instead of being able to evict decoded images.
+static constexpr size_t kGlobalBudgetDivisor = 4;
+
+struct StrokeKey : public SkResourceCache::Key {
+public:
+    StrokeKey(uint32_t srcGenID, const SkStroke& stroke)
+        : fSrcGenID(srcGenID)
+        , fWidth(stroke.getWidth())
+        , fMiterLimit(stroke.getMiterLimit())
+        , fResScale(stroke.getResScale())
+        , fCapJoinFill(stroke.getCap() | (stroke.getJoin() << 8) | (stroke.getDoFill() << 16))
+    {
+        this->init(&gStrokeKeyNamespaceLabel, 0,
+                   sizeof(fSrcGenID) + sizeof(fWidth) + sizeof(fMiterLimit) + sizeof(fResScale) +
+                   sizeof(fCapJoinFill));
+    }
+
+    uint32_t fSrcGenID;
+    SkScalar fWidth;
+    SkScalar fMiterLimit;
+    SkScalar fResScale;
+    uint32_t fCapJoinFill;
+};
+
+struct StrokeRec : public SkResourceCache::Rec {
+    StrokeRec(const StrokeKey& key, const SkPath& stroked) : fKey(key), fStroked(stroked) {}
+
+    StrokeKey fKey;
+    SkPath    fStroked;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override { return sizeof(*this) + fStroked.approximateBytesUsed(); }
+    const char* getCategory() const override { return "stroke"; }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextData) {
+        const StrokeRec& rec = static_cast<const StrokeRec&>(baseRec);
+        *static_cast<SkPath*>(contextData) = rec.fStroked;
+        return true;
+    }
+};
+}  // namespace
+
+bool SkStrokeCache::Find(uint32_t srcGenID, const SkStroke& stroke, SkPath* dst,
+                         SkResourceCache* localCache) {
+    StrokeKey key(srcGenID, stroke);
+    return CHECK_LOCAL(localCache, find, Find, key, StrokeRec::Visitor, dst);
+}
+
+void SkStrokeCache::Add(uint32_t srcGenID, const SkStroke& stroke, const SkPath& stroked,
+                        SkResourceCache* localCache) {
+    StrokeKey key(srcGenID, stroke);
+    if (!localCache) {
+        static SkOnce once;
+        once([] {
+            SkResourceCache::SetNamespaceByteLimit(
+                    &gStrokeKeyNamespaceLabel,
+                    SkResourceCache::GetTotalByteLimit() / kGlobalBudgetDivisor);
+        });
+    }
+    return CHECK_LOCAL(localCache, add, Add, new StrokeRec(key, stroked));
+}
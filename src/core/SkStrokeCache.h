@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkStrokeCache_DEFINED
+#define SkStrokeCache_DEFINED
+
+#include <cstdint>
+
+class SkPath;
+class SkResourceCache;
+class SkStroke;
+
+/**
+ *  Caches the outlines SkStroke makes for paths, keyed by the source path's generation ID and
+ *  the stroke's parameters (width, miter limit, cap, join, fill and resolution scale). Paths drawn
+ *  again unchanged, e.g. static map geometry redrawn every frame, skip re-stroking.
+ */
+class SkStrokeCache {
+public:
+    /**
+     *  If the stroke of the path with this generation ID is cached, copy it into dst and return
+     *  true. Otherwise return false and leave dst unchanged.
+     */
+    static bool Find(uint32_t srcGenID, const SkStroke&, SkPath* dst,
+                     SkResourceCache* localCache = nullptr);
+
+    /**
+     *  Add the stroke of the path with this generation ID to the cache.
+     */
+    static void Add(uint32_t srcGenID, const SkStroke&, const SkPath& stroked,
+                    SkResourceCache* localCache = nullptr);
+};
+
+#endif
@@ -24,7 +24,14 @@ namespace SkOpts {
                            RGB_to_BGR1,     // i.e. swap RB and insert an opaque alpha
                            gray_to_RGB1,    // i.e. expand to color channels + an opaque alpha
                            grayA_to_RGBA,   // i.e. expand to color channels
-                           grayA_to_rgbA;   // i.e. expand to color channels and premultiply
+                           grayA_to_rgbA,   // i.e. expand to color channels and premultiply
+                           RGBA16_to_RGBA,  // i.e. keep the high byte of big-endian components
+                           RGBA16_to_BGRA,  // i.e. keep the high bytes and swap RB
+                           RGB16_to_RGB1,   // i.e. keep the high bytes and insert an opaque alpha
+                           RGB16_to_BGR1;   // i.e. keep the high bytes, swap RB, insert alpha
+
+    using Swizzle_8888_index = void (*)(uint32_t*, const uint8_t*, int, const uint32_t[256]);
+    extern Swizzle_8888_index index_to_8888;  // i.e. look up each byte in a color table
 
     void Init_Swizzler();
 }  // namespace SkOpts
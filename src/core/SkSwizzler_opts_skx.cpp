@@ -0,0 +1,37 @@
+
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/private/base/SkFeatures.h"
+#include "src/core/SkOpts.h"
+#include "src/core/SkOptsTargets.h"
+#include "src/core/SkSwizzlePriv.h"
+
+#if defined(SK_CPU_X86) && !defined(SK_ENABLE_OPTIMIZE_SIZE)
+
+// The order of these includes is important:
+// 1) Select the target CPU architecture by defining SK_OPTS_TARGET and including SkOpts_SetTarget
+// 2) Include the code to compile, typically in a _opts.h file.
+// 3) Include SkOpts_RestoreTarget to switch back to the default CPU architecture
+
+#define SK_OPTS_TARGET SK_OPTS_TARGET_SKX
+#include "src/opts/SkOpts_SetTarget.h"
+
+#include "src/opts/SkSwizzler_opts.h"
+
+#include "src/opts/SkOpts_RestoreTarget.h"
+
+namespace SkOpts {
+    void Init_Swizzler_skx() {
+        // The remaining swizzles have no AVX-512 specializations, and keep their hsw versions.
+        RGBA_to_BGRA = skx::RGBA_to_BGRA;
+        RGBA_to_rgbA = skx::RGBA_to_rgbA;
+        RGBA_to_bgrA = skx::RGBA_to_bgrA;
+    }
+}  // namespace SkOpts
+
+#endif // SK_CPU_X86 && !SK_ENABLE_OPTIMIZE_SIZE
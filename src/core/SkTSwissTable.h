@@ -0,0 +1,313 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkTSwissTable_DEFINED
+#define SkTSwissTable_DEFINED
+
+#include "include/core/SkTypes.h"
+#include "include/private/base/SkMath.h"
+#include "src/base/SkMathPriv.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace skia_private {
+
+// TSwissTable is a drop-in alternative to THashTable, with the same Traits (GetKey and Hash) and
+// the same API, suited to hot lookups in tables that are mostly read.
+//
+// It is an open-addressing table laid out like Abseil's "Swiss tables": next to the slots, it
+// keeps one control byte per slot, holding either 7 bits of that slot's hash, or a marker for
+// empty and deleted slots. Lookups check a group of 16 control bytes at a time (with SSE2 where
+// available), and only compare keys for slots whose 7 hash bits match. Deleted slots are left as
+// tombstones until the next resize.
+//
+// As with THashTable, the pointers returned by set() and find() are valid only until the next
+// call to set() or remove().
+template <typename T, typename K, typename Traits = T>
+class TSwissTable {
+public:
+    TSwissTable() = default;
+    ~TSwissTable() { this->destroySlots(); }
+
+    TSwissTable(const TSwissTable&  that) { *this = that; }
+    TSwissTable(      TSwissTable&& that) { *this = std::move(that); }
+
+    TSwissTable& operator=(const TSwissTable& that) {
+        if (this != &that) {
+            this->reset();
+            if (that.fCount > 0) {
+                this->resize(that.fCapacity);
+                that.foreach([this](const T& val) { this->uncheckedSet(T(val)); });
+            }
+        }
+        return *this;
+    }
+
+    TSwissTable& operator=(TSwissTable&& that) {
+        if (this != &that) {
+            this->destroySlots();
+            fCount    = that.fCount;
+            fDeleted  = that.fDeleted;
+            fCapacity = that.fCapacity;
+            fCtrl     = std::move(that.fCtrl);
+            fSlots    = std::move(that.fSlots);
+
+            that.fCount = that.fDeleted = that.fCapacity = 0;
+        }
+        return *this;
+    }
+
+    // Clear the table.
+    void reset() { *this = TSwissTable(); }
+
+    // How many entries are in the table?
+    int count() const { return fCount; }
+
+    // How many slots does the table contain?
+    int capacity() const { return fCapacity; }
+
+    // Approximately how many bytes of memory do we use beyond sizeof(*this)?
+    size_t approxBytesUsed() const {
+        return fCapacity ? fCapacity * (sizeof(Slot) + 1) + kGroupWidth : 0;
+    }
+
+    // Copy val into the hash table, returning a pointer to the copy now in the table.
+    // If there already is an entry in the table with the same key, we overwrite it.
+    T* set(T val) {
+        if (T* existing = this->find(Traits::GetKey(val))) {
+            *existing = std::move(val);
+            return existing;
+        }
+        if (fCapacity == 0) {
+            this->rehash(kGroupWidth);
+        } else if (8 * (fCount + fDeleted + 1) > 7 * fCapacity) {
+            // Grow if we're really full, or otherwise just clear out the tombstones.
+            this->rehash(16 * (fCount + 1) > 7 * fCapacity ? 2 * fCapacity : fCapacity);
+        }
+        return this->uncheckedSet(std::move(val));
+    }
+
+    // If there is an entry in the table with this key, return a pointer to it.  If not, null.
+    T* find(const K& key) const {
+        int index = this->findIndex(key);
+        return index >= 0 ? &fSlots[index].fVal : nullptr;
+    }
+
+    // If there is an entry in the table with this key, return it.  If not, null.
+    // This only works for pointer type T, and cannot be used to find an nullptr entry.
+    T findOrNull(const K& key) const {
+        if (T* p = this->find(key)) {
+            return *p;
+        }
+        return nullptr;
+    }
+
+    // Remove the value with this key from the hash table.
+    void remove(const K& key) {
+        int index = this->findIndex(key);
+        SkASSERT(index >= 0);
+        fSlots[index].fVal.~T();
+        this->setCtrl(index, kDeleted);
+        fCount--;
+        fDeleted++;
+        if (4 * fCount <= fCapacity && fCapacity > kGroupWidth) {
+            this->rehash(fCapacity / 2);
+        }
+    }
+
+    // Hash tables will automatically resize themselves when set() and remove() are called, but
+    // resize() can be called to manually grow capacity before a bulk insertion.
+    void resize(int capacity) {
+        SkASSERT(capacity >= fCount);
+        int newCapacity = kGroupWidth;
+        while (newCapacity < capacity || 8 * fCount > 7 * newCapacity) {
+            newCapacity *= 2;
+        }
+        this->rehash(newCapacity);
+    }
+
+    // Call fn on every entry in the table.  You may mutate the entries, but be very careful.
+    template <typename Fn>  // f(T*)
+    void foreach(Fn&& fn) {
+        for (int i = 0; i < fCapacity; i++) {
+            if (IsFull(fCtrl[i])) {
+                fn(&fSlots[i].fVal);
+            }
+        }
+    }
+
+    // Call fn on every entry in the table.  You may not mutate anything.
+    template <typename Fn>  // f(T) or f(const T&)
+    void foreach(Fn&& fn) const {
+        for (int i = 0; i < fCapacity; i++) {
+            if (IsFull(fCtrl[i])) {
+                fn(static_cast<const T&>(fSlots[i].fVal));
+            }
+        }
+    }
+
+private:
+    static constexpr int kGroupWidth = 16;
+
+    // Control bytes.  Full slots hold the low 7 bits of their hash, so are never negative.
+    static constexpr int8_t kEmpty   = -128;
+    static constexpr int8_t kDeleted = -2;
+    static bool IsFull(int8_t ctrl) { return ctrl >= 0; }
+
+    static uint32_t H1(uint32_t hash) { return hash >> 7; }
+    static int8_t   H2(uint32_t hash) { return (int8_t)(hash & 0x7f); }
+
+    // The control bytes of kGroupWidth consecutive slots.  Each match returns a bitmask with bit i
+    // set if the i-th control byte in the group matches.
+    class Group {
+    public:
+    #if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSE2
+        explicit Group(const int8_t* ctrl)
+                : fCtrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+        uint32_t match(int8_t h2) const {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), fCtrl));
+        }
+        uint32_t matchEmpty() const { return this->match(kEmpty); }
+        // kEmpty and kDeleted are the only control bytes with their high bit set.
+        uint32_t matchEmptyOrDeleted() const { return _mm_movemask_epi8(fCtrl); }
+
+    private:
+        __m128i fCtrl;
+    #else
+        explicit Group(const int8_t* ctrl) { memcpy(fCtrl, ctrl, kGroupWidth); }
+
+        uint32_t match(int8_t h2) const {
+            uint32_t bits = 0;
+            for (int i = 0; i < kGroupWidth; i++) {
+                bits |= (uint32_t)(fCtrl[i] == h2) << i;
+            }
+            return bits;
+        }
+        uint32_t matchEmpty() const { return this->match(kEmpty); }
+        uint32_t matchEmptyOrDeleted() const {
+            uint32_t bits = 0;
+            for (int i = 0; i < kGroupWidth; i++) {
+                bits |= (uint32_t)(fCtrl[i] < 0) << i;
+            }
+            return bits;
+        }
+
+    private:
+        int8_t fCtrl[kGroupWidth];
+    #endif
+    };
+
+    // Groups are probed quadratically (by triangular numbers of groups), which with a power of two
+    // capacity visits every slot.  Groups can start anywhere, so the first kGroupWidth control
+    // bytes are mirrored past the end of the table.
+    int findIndex(const K& key) const {
+        if (fCount == 0) {
+            return -1;
+        }
+        const uint32_t hash = Traits::Hash(key);
+        const int mask = fCapacity - 1;
+        int pos = H1(hash) & mask;
+        for (int step = kGroupWidth;; step += kGroupWidth) {
+            Group group(&fCtrl[pos]);
+            for (uint32_t bits = group.match(H2(hash)); bits; bits &= bits - 1) {
+                int index = (pos + SkCTZ(bits)) & mask;
+                if (key == Traits::GetKey(fSlots[index].fVal)) {
+                    return index;
+                }
+            }
+            if (group.matchEmpty()) {
+                return -1;
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    // Moves val into the first free slot on its probe sequence.  The key must not be present,
+    // and there must be room.
+    T* uncheckedSet(T&& val) {
+        const uint32_t hash = Traits::Hash(Traits::GetKey(val));
+        const int mask = fCapacity - 1;
+        int pos = H1(hash) & mask;
+        for (int step = kGroupWidth;; step += kGroupWidth) {
+            if (uint32_t bits = Group(&fCtrl[pos]).matchEmptyOrDeleted()) {
+                int index = (pos + SkCTZ(bits)) & mask;
+                if (fCtrl[index] == kDeleted) {
+                    fDeleted--;
+                }
+                this->setCtrl(index, H2(hash));
+                fCount++;
+                return new (&fSlots[index].fVal) T(std::move(val));
+            }
+            pos = (pos + step) & mask;
+        }
+    }
+
+    void setCtrl(int index, int8_t ctrl) {
+        fCtrl[index] = ctrl;
+        if (index < kGroupWidth) {
+            fCtrl[fCapacity + index] = ctrl;
+        }
+    }
+
+    void rehash(int capacity) {
+        SkASSERT(SkIsPow2(capacity) && capacity >= kGroupWidth);
+        SkASSERT(8 * fCount <= 7 * capacity);
+        const int oldCapacity = fCapacity;
+        std::unique_ptr<int8_t[]> oldCtrl  = std::move(fCtrl);
+        std::unique_ptr<Slot[]>   oldSlots = std::move(fSlots);
+        SkDEBUGCODE(int oldCount = fCount;)
+
+        fCount    = 0;
+        fDeleted  = 0;
+        fCapacity = capacity;
+        fCtrl.reset(new int8_t[capacity + kGroupWidth]);
+        memset(fCtrl.get(), kEmpty, capacity + kGroupWidth);
+        fSlots.reset(new Slot[capacity]);
+
+        for (int i = 0; i < oldCapacity; i++) {
+            if (IsFull(oldCtrl[i])) {
+                this->uncheckedSet(std::move(oldSlots[i].fVal));
+                oldSlots[i].fVal.~T();
+            }
+        }
+        SkASSERT(fCount == oldCount);
+    }
+
+    void destroySlots() {
+        for (int i = 0; i < fCapacity; i++) {
+            if (IsFull(fCtrl[i])) {
+                fSlots[i].fVal.~T();
+            }
+        }
+    }
+
+    // Storage for a T, constructed only while its control byte is full.
+    union Slot {
+        T fVal;
+        Slot() {}
+        ~Slot() {}
+    };
+
+    int fCount    = 0,
+        fDeleted  = 0,
+        fCapacity = 0;
+    std::unique_ptr<int8_t[]> fCtrl;
+    std::unique_ptr<Slot[]>   fSlots;
+};
+
+}  // namespace skia_private
+
+#endif  // SkTSwissTable_DEFINED
@@ -8,29 +8,65 @@
 #include "include/core/SkExecutor.h"
 #include "src/core/SkTaskGroup.h"
 
+#include <algorithm>
 #include <utility>
 
-SkTaskGroup::SkTaskGroup(SkExecutor& executor) : fPending(0), fExecutor(executor) {}
+SkTaskGroup::SkTaskGroup(SkExecutor& executor, SkExecutor::Priority priority)
+        : fPending(0), fExecutor(executor), fPriority(priority) {}
 
 void SkTaskGroup::add(std::function<void(void)> fn) {
     fPending.fetch_add(+1, std::memory_order_relaxed);
-    fExecutor.add([this, fn{std::move(fn)}] {
+    fExecutor.addWithPriority([this, fn{std::move(fn)}] {
         fn();
         fPending.fetch_add(-1, std::memory_order_release);
-    });
+    }, fPriority);
 }
 
+namespace {
+// Shared by all the tasks of one batch().  Each task claims the next index to run, and the last
+// one to finish deletes the batch.  Each task then captures only a pointer to the batch, which
+// std::function stores inline without allocating.
+struct Batch {
+    Batch(int N, std::function<void(int)> fn, std::atomic<int32_t>* pending)
+            : fFn(std::move(fn)), fNext(0), fRemaining(N), fPending(pending) {}
+
+    void runOne() {
+        fFn(fNext.fetch_add(1, std::memory_order_relaxed));
+        fPending->fetch_add(-1, std::memory_order_release);
+        if (fRemaining.fetch_add(-1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    std::function<void(int)> fFn;
+    std::atomic<int>         fNext;
+    std::atomic<int>         fRemaining;
+    std::atomic<int32_t>*    fPending;
+};
+}  // namespace
+
 void SkTaskGroup::batch(int N, std::function<void(int)> fn) {
-    // TODO: I really thought we had some sort of more clever chunking logic.
+    if (N <= 0) {
+        return;
+    }
+    auto batch = new Batch(N, std::move(fn), &fPending);
     fPending.fetch_add(+N, std::memory_order_relaxed);
     for (int i = 0; i < N; i++) {
-        fExecutor.add([=] {
-            fn(i);
-            fPending.fetch_add(-1, std::memory_order_release);
-        });
+        fExecutor.addWithPriority([batch] { batch->runOne(); }, fPriority);
     }
 }
 
+void SkTaskGroup::parallelFor(int N, int chunkSize, std::function<void(int, int)> fn) {
+    SkASSERT(chunkSize > 0);
+    if (N <= 0) {
+        return;
+    }
+    this->batch((N - 1) / chunkSize + 1, [N, chunkSize, fn{std::move(fn)}](int chunk) {
+        const int begin = chunk * chunkSize;
+        fn(begin, std::min(begin + chunkSize, N));
+    });
+}
+
 bool SkTaskGroup::done() const {
     return fPending.load(std::memory_order_acquire) == 0;
 }
@@ -16,16 +16,22 @@
 
 class SkTaskGroup : SkNoncopyable {
 public:
-    // Tasks added to this SkTaskGroup will run on its executor.
-    explicit SkTaskGroup(SkExecutor& executor = SkExecutor::GetDefault());
+    // Tasks added to this SkTaskGroup will run on its executor, at the given priority.
+    explicit SkTaskGroup(SkExecutor& executor = SkExecutor::GetDefault(),
+                         SkExecutor::Priority priority = SkExecutor::Priority::kNormal);
     ~SkTaskGroup() { this->wait(); }
 
     // Add a task to this SkTaskGroup.
     void add(std::function<void(void)> fn);
 
     // Add a batch of N tasks, all calling fn with different arguments.
+    // fn is stored once for the whole batch, so adding each task doesn't allocate.
     void batch(int N, std::function<void(int)> fn);
 
+    // Split [0,N) into ranges of at most chunkSize, and add a task calling fn(begin, end) for each.
+    // Fine-grained loops (per-row, per-span) should use this rather than a batch of N tasks.
+    void parallelFor(int N, int chunkSize, std::function<void(int begin, int end)> fn);
+
     // Returns true if all Tasks previously add()ed to this SkTaskGroup have run.
     // It is safe to reuse this SkTaskGroup once done().
     bool done() const;
@@ -43,6 +49,7 @@ public:
 private:
     std::atomic<int32_t> fPending;
     SkExecutor&          fExecutor;
+    SkExecutor::Priority fPriority;
 };
 
 #endif//SkTaskGroup_DEFINED
@@ -9,7 +9,6 @@
 
 #include "include/core/SkData.h"
 #include "include/core/SkMaskFilter.h"
-#include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPathEffect.h"
 #include "include/core/SkPoint.h"
@@ -21,6 +20,7 @@
 #include "include/private/base/SkTo.h"
 #include "src/base/SkSafeMath.h"
 #include "src/base/SkTLazy.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkFontPriv.h"
 #include "src/core/SkGlyph.h"
 #include "src/core/SkReadBuffer.h"
@@ -272,10 +272,6 @@ SkTextBlobBuilder::~SkTextBlobBuilder() {
     }
 }
 
-static SkRect map_quad_to_rect(const SkRSXform& xform, const SkRect& rect) {
-    return SkMatrix().setRSXform(xform).mapRect(rect);
-}
-
 SkRect SkTextBlobBuilder::TightRunBounds(const SkTextBlob::RunRecord& run) {
     const SkFont& font = run.font();
     SkRect bounds;
@@ -290,12 +286,13 @@ SkRect SkTextBlobBuilder::TightRunBounds(const SkTextBlob::RunRecord& run) {
     font.getBounds(run.glyphBuffer(), run.glyphCount(), glyphBounds.get(), nullptr);
 
     if (SkTextBlob::kRSXform_Positioning == run.positioning()) {
-        bounds.setEmpty();
         const SkRSXform* xform = run.xformBuffer();
         SkASSERT((void*)(xform + run.glyphCount()) <= SkTextBlob::RunRecord::Next(&run));
+        SkRSXformBounds xformBounds;
         for (unsigned i = 0; i < run.glyphCount(); ++i) {
-            bounds.join(map_quad_to_rect(xform[i], glyphBounds[i]));
+            xformBounds.join(xform[i], glyphBounds[i]);
         }
+        bounds = xformBounds.bounds();
     } else {
         SkASSERT(SkTextBlob::kFull_Positioning == run.positioning() ||
                  SkTextBlob::kHorizontal_Positioning == run.positioning());
@@ -342,9 +339,19 @@ SkRect SkTextBlobBuilder::ConservativeRunBounds(const SkTextBlob::RunRecord& run
         const SkScalar* glyphPos = run.posBuffer();
         SkASSERT((void*)(glyphPos + run.glyphCount()) <= SkTextBlob::RunRecord::Next(&run));
 
-        SkScalar minX = *glyphPos;
-        SkScalar maxX = *glyphPos;
-        for (unsigned i = 1; i < run.glyphCount(); ++i) {
+        // Four positions at a time, then the rest.
+        const unsigned count = run.glyphCount();
+        unsigned i = 0;
+        skvx::float4 minX4 = *glyphPos,
+                     maxX4 = *glyphPos;
+        for (; i + 4 <= count; i += 4) {
+            const skvx::float4 x = skvx::float4::Load(glyphPos + i);
+            minX4 = min(minX4, x);
+            maxX4 = max(maxX4, x);
+        }
+        SkScalar minX = min(minX4);
+        SkScalar maxX = max(maxX4);
+        for (; i < count; ++i) {
             SkScalar x = glyphPos[i];
             minX = std::min(x, minX);
             maxX = std::max(x, maxX);
@@ -361,10 +368,11 @@ SkRect SkTextBlobBuilder::ConservativeRunBounds(const SkTextBlob::RunRecord& run
     case SkTextBlob::kRSXform_Positioning: {
         const SkRSXform* xform = run.xformBuffer();
         SkASSERT((void*)(xform + run.glyphCount()) <= SkTextBlob::RunRecord::Next(&run));
-        bounds.setEmpty();
+        SkRSXformBounds xformBounds;
         for (unsigned i = 0; i < run.glyphCount(); ++i) {
-            bounds.join(map_quad_to_rect(xform[i], fontBounds));
+            xformBounds.join(xform[i], fontBounds);
         }
+        bounds = xformBounds.bounds();
     } break;
     default:
         SK_ABORT("unsupported positioning mode");
@@ -13,10 +13,14 @@
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkMaskFilter.h"
 #include "include/core/SkPathEffect.h"
+#include "include/core/SkRSXform.h"
+#include "include/core/SkRect.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkTextBlob.h"
 #include "include/core/SkTypeface.h"
+#include "include/private/base/SkFloatingPoint.h"
 #include "src/base/SkSafeMath.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkPaintPriv.h"
 
 class SkReadBuffer;
@@ -41,6 +45,42 @@ public:
     static bool HasRSXForm(const SkTextBlob& blob);
 };
 
+// Accumulates the bounds of glyph rects placed by RSXforms. The result is the same as joining
+// SkMatrix().setRSXform(xform).mapRect(rect) for each glyph, but the matrices aren't built, and
+// the four corners of each rect are mapped together.
+class SkRSXformBounds {
+public:
+    void join(SkScalar scos, SkScalar ssin, SkScalar tx, SkScalar ty, const SkRect& rect) {
+        // SkRect::join() skips empty rects, which includes those scaled to nothing.
+        if (rect.isEmpty() || (scos == 0 && ssin == 0)) {
+            return;
+        }
+        const skvx::float4 cx = {rect.fLeft, rect.fRight, rect.fRight, rect.fLeft},
+                           cy = {rect.fTop,  rect.fTop,   rect.fBottom, rect.fBottom};
+        const skvx::float4 x = cx * scos - cy * ssin + tx,
+                           y = cx * ssin + cy * scos + ty;
+        fMinX = min(fMinX, x);
+        fMinY = min(fMinY, y);
+        fMaxX = max(fMaxX, x);
+        fMaxY = max(fMaxY, y);
+    }
+    void join(const SkRSXform& xform, const SkRect& rect) {
+        this->join(xform.fSCos, xform.fSSin, xform.fTx, xform.fTy, rect);
+    }
+
+    // Returns an empty rect if nothing was joined.
+    SkRect bounds() const {
+        const SkRect bounds = SkRect::MakeLTRB(min(fMinX), min(fMinY), max(fMaxX), max(fMaxY));
+        return bounds.isSorted() ? bounds : SkRect::MakeEmpty();
+    }
+
+private:
+    skvx::float4 fMinX = SK_FloatInfinity,
+                 fMinY = SK_FloatInfinity,
+                 fMaxX = SK_FloatNegativeInfinity,
+                 fMaxY = SK_FloatNegativeInfinity;
+};
+
 //
 // Textblob data is laid out into externally-managed storage as follows:
 //
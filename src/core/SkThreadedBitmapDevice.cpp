@@ -0,0 +1,235 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkThreadedBitmapDevice.h"
+
+#include "include/core/SkBlender.h"
+#include "include/core/SkClipOp.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkPoint.h"
+#include "include/core/SkRRect.h"
+#include "include/private/base/SkAssert.h"
+#include "include/private/base/SkTo.h"
+#include "src/core/SkDraw.h"
+#include "src/core/SkSpecialImage.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
+#include <utility>
+
+SkThreadedBitmapDevice::SkThreadedBitmapDevice(const SkBitmap& bitmap,
+                                               const SkSurfaceProps& surfaceProps,
+                                               SkExecutor& executor,
+                                               int tileSize)
+        : INHERITED(bitmap, surfaceProps)
+        , fExecutor(executor)
+        , fTileSize(std::max(tileSize, 1)) {}
+
+SkThreadedBitmapDevice::~SkThreadedBitmapDevice() {
+    this->flush();
+}
+
+void SkThreadedBitmapDevice::queueDraw(const SkRect* localBounds,
+                                       const SkPaint& paint,
+                                       DrawFn draw) {
+    const SkRasterClip& rc = fRCStack.rc();
+    if (rc.isEmpty()) {
+        return;
+    }
+
+    SkIRect devBounds = rc.getBounds();
+    if (localBounds && paint.canComputeFastBounds()) {
+        SkRect storage;
+        const SkRect& fastBounds = paint.computeFastBounds(*localBounds, &storage);
+        // Outset by a pixel to cover antialiasing and hairline caps that bleed past the geometry.
+        SkIRect drawBounds = this->localToDevice().mapRect(fastBounds).roundOut().makeOutset(1, 1);
+        if (!devBounds.intersect(drawBounds)) {
+            return;
+        }
+    }
+
+    fQueue.push_back(fAlloc.make<DrawElement>(
+            DrawElement{devBounds, this->localToDevice(), SkRasterClip(rc), std::move(draw)}));
+}
+
+void SkThreadedBitmapDevice::drawTile(const SkPixmap& root, const SkIRect& tile) const {
+    SkPixmap tileDst;
+    if (!root.extractSubset(&tileDst, tile)) {
+        return;
+    }
+    const SkIRect tileClip = SkIRect::MakeSize(tileDst.dimensions());
+
+    for (const DrawElement* element : fQueue) {
+        if (!SkIRect::Intersects(element->fDevBounds, tile)) {
+            continue;
+        }
+
+        SkRasterClip tileRC;
+        element->fRC.translate(-tile.fLeft, -tile.fTop, &tileRC);
+        if (!tileRC.op(tileClip, SkClipOp::kIntersect)) {
+            continue;
+        }
+        const SkMatrix tileCTM = SkMatrix::Translate(-tile.fLeft, -tile.fTop) * element->fCTM;
+
+        SkDraw draw;
+        draw.fDst = tileDst;
+        draw.fCTM = &tileCTM;
+        draw.fRC = &tileRC;
+        draw.fProps = &this->surfaceProps();
+        element->fDraw(draw);
+    }
+}
+
+void SkThreadedBitmapDevice::flush() {
+    if (fQueue.empty()) {
+        return;
+    }
+
+    SkPixmap root;
+    if (fBitmap.peekPixels(&root)) {
+        const int tilesX = (root.width()  + fTileSize - 1) / fTileSize,
+                  tilesY = (root.height() + fTileSize - 1) / fTileSize;
+
+        SkTaskGroup tasks(fExecutor);
+        tasks.batch(tilesX * tilesY, [&](int i) {
+            const int x = (i % tilesX) * fTileSize,
+                      y = (i / tilesX) * fTileSize;
+            this->drawTile(root, SkIRect::MakeXYWH(x, y, fTileSize, fTileSize));
+        });
+        tasks.wait();
+        fBitmap.notifyPixelsChanged();
+    }
+
+    fQueue.clear();
+    fAlloc.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SkThreadedBitmapDevice::drawPaint(const SkPaint& paint) {
+    this->queueDraw(nullptr, paint, [paint](const SkDraw& draw) {
+        draw.drawPaint(paint);
+    });
+}
+
+void SkThreadedBitmapDevice::drawPoints(SkCanvas::PointMode mode, size_t count,
+                                        const SkPoint pts[], const SkPaint& paint) {
+    if (!count) {
+        return;
+    }
+    SkRect bounds;
+    const bool hasBounds = bounds.setBoundsCheck(pts, SkToInt(count));
+    std::vector<SkPoint> points(pts, pts + count);
+    this->queueDraw(hasBounds ? &bounds : nullptr, paint,
+                    [mode, points{std::move(points)}, paint](const SkDraw& draw) {
+                        draw.drawPoints(mode, points.size(), points.data(), paint, nullptr);
+                    });
+}
+
+void SkThreadedBitmapDevice::drawRect(const SkRect& r, const SkPaint& paint) {
+    this->queueDraw(&r, paint, [r, paint](const SkDraw& draw) {
+        draw.drawRect(r, paint);
+    });
+}
+
+void SkThreadedBitmapDevice::drawRRect(const SkRRect& rrect, const SkPaint& paint) {
+#ifdef SK_IGNORE_BLURRED_RRECT_OPT
+    this->drawPath(SkPath::RRect(rrect), paint, true);
+#else
+    this->queueDraw(&rrect.getBounds(), paint, [rrect, paint](const SkDraw& draw) {
+        draw.drawRRect(rrect, paint);
+    });
+#endif
+}
+
+void SkThreadedBitmapDevice::drawPath(const SkPath& path, const SkPaint& paint, bool) {
+    // Every tile draws the same path, so none of them may mutate it, and its lazily computed
+    // bounds must be resolved before it is shared across threads.
+    path.updateBoundsCache();
+    const SkRect* bounds = path.isInverseFillType() ? nullptr : &path.getBounds();
+    this->queueDraw(bounds, paint, [path, paint](const SkDraw& draw) {
+        draw.drawPath(path, paint, nullptr, false);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+void SkThreadedBitmapDevice::drawImageRect(const SkImage* image, const SkRect* src,
+                                           const SkRect& dst, const SkSamplingOptions& sampling,
+                                           const SkPaint& paint,
+                                           SkCanvas::SrcRectConstraint constraint) {
+    this->flush();
+    // This either draws synchronously, or calls back into drawRect() with an image shader.
+    INHERITED::drawImageRect(image, src, dst, sampling, paint, constraint);
+}
+
+void SkThreadedBitmapDevice::drawVertices(const SkVertices* vertices,
+                                          sk_sp<SkBlender> blender,
+                                          const SkPaint& paint,
+                                          bool skipColorXform) {
+    this->flush();
+    INHERITED::drawVertices(vertices, std::move(blender), paint, skipColorXform);
+}
+
+void SkThreadedBitmapDevice::drawAtlas(const SkRSXform xform[],
+                                       const SkRect tex[],
+                                       const SkColor colors[],
+                                       int count,
+                                       sk_sp<SkBlender> blender,
+                                       const SkPaint& paint) {
+    this->flush();
+    INHERITED::drawAtlas(xform, tex, colors, count, std::move(blender), paint);
+}
+
+void SkThreadedBitmapDevice::drawSpecial(SkSpecialImage* src,
+                                         const SkMatrix& localToDevice,
+                                         const SkSamplingOptions& sampling,
+                                         const SkPaint& paint,
+                                         SkCanvas::SrcRectConstraint constraint) {
+    this->flush();
+    INHERITED::drawSpecial(src, localToDevice, sampling, paint, constraint);
+}
+
+void SkThreadedBitmapDevice::onDrawGlyphRunList(SkCanvas* canvas,
+                                                const sktext::GlyphRunList& glyphRunList,
+                                                const SkPaint& initialPaint,
+                                                const SkPaint& drawingPaint) {
+    this->flush();
+    INHERITED::onDrawGlyphRunList(canvas, glyphRunList, initialPaint, drawingPaint);
+}
+
+sk_sp<SkSpecialImage> SkThreadedBitmapDevice::snapSpecial(const SkIRect& bounds, bool forceCopy) {
+    this->flush();
+    return INHERITED::snapSpecial(bounds, forceCopy);
+}
+
+void SkThreadedBitmapDevice::setImmutable() {
+    this->flush();
+    INHERITED::setImmutable();
+}
+
+bool SkThreadedBitmapDevice::onReadPixels(const SkPixmap& pm, int x, int y) {
+    this->flush();
+    return INHERITED::onReadPixels(pm, x, y);
+}
+
+bool SkThreadedBitmapDevice::onWritePixels(const SkPixmap& pm, int x, int y) {
+    this->flush();
+    return INHERITED::onWritePixels(pm, x, y);
+}
+
+bool SkThreadedBitmapDevice::onPeekPixels(SkPixmap* pmap) {
+    this->flush();
+    return INHERITED::onPeekPixels(pmap);
+}
+
+bool SkThreadedBitmapDevice::onAccessPixels(SkPixmap* pmap) {
+    this->flush();
+    return INHERITED::onAccessPixels(pmap);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkThreadedBitmapDevice_DEFINED
+#define SkThreadedBitmapDevice_DEFINED
+
+#include "include/core/SkExecutor.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkRect.h"
+#include "src/base/SkArenaAlloc.h"
+#include "src/core/SkBitmapDevice.h"
+#include "src/core/SkRasterClip.h"
+
+#include <functional>
+#include <vector>
+
+class SkDraw;
+
+/**
+ *  An opt-in SkBitmapDevice that defers the common geometric draws (paint, points, rects, rrects,
+ *  ovals and paths) into a queue, and rasterizes them in parallel on an SkExecutor when flushed.
+ *
+ *  The device is split into square tiles. Each queued draw captures its matrix and raster clip,
+ *  and on flush every tile replays the draws that intersect it, in order, through the usual
+ *  SkDraw/SkBlitter stack with the clip intersected against the tile. Tiles never share pixels,
+ *  so they can be rasterized concurrently without synchronization.
+ *
+ *  Everything else (images, text, vertices, layers, pixel access) flushes the queue and then
+ *  draws synchronously, so the results are always in submission order.
+ *
+ *  The queue is flushed when the device is destroyed, or when its pixels are read or accessed
+ *  (e.g. SkCanvas::readPixels or SkCanvas::peekPixels). Callers that wrap their own pixels should
+ *  call flush() before touching them directly.
+ */
+class SkThreadedBitmapDevice final : public SkBitmapDevice {
+public:
+    static constexpr int kDefaultTileSize = 256;
+
+    SkThreadedBitmapDevice(const SkBitmap& bitmap,
+                           const SkSurfaceProps& surfaceProps,
+                           SkExecutor& executor = SkExecutor::GetDefault(),
+                           int tileSize = kDefaultTileSize);
+    ~SkThreadedBitmapDevice() override;
+
+    // Rasterize every queued draw. Blocks until all tiles are complete.
+    void flush();
+
+    int queuedDrawCount() const { return SkToInt(fQueue.size()); }
+
+    void drawPaint(const SkPaint& paint) override;
+    void drawPoints(SkCanvas::PointMode mode, size_t count,
+                    const SkPoint[], const SkPaint& paint) override;
+    void drawRect(const SkRect& r, const SkPaint& paint) override;
+    void drawRRect(const SkRRect& rr, const SkPaint& paint) override;
+    void drawPath(const SkPath&, const SkPaint&, bool pathIsMutable) override;
+
+    void drawImageRect(const SkImage*, const SkRect* src, const SkRect& dst,
+                       const SkSamplingOptions&, const SkPaint&,
+                       SkCanvas::SrcRectConstraint) override;
+    void drawVertices(const SkVertices*, sk_sp<SkBlender>, const SkPaint&, bool) override;
+    void drawAtlas(const SkRSXform[], const SkRect[], const SkColor[], int count, sk_sp<SkBlender>,
+                   const SkPaint&) override;
+    void drawSpecial(SkSpecialImage*, const SkMatrix&, const SkSamplingOptions&,
+                     const SkPaint&, SkCanvas::SrcRectConstraint) override;
+
+    sk_sp<SkSpecialImage> snapSpecial(const SkIRect&, bool forceCopy = false) override;
+
+    void setImmutable() override;
+
+private:
+    using DrawFn = std::function<void(const SkDraw&)>;
+
+    struct DrawElement {
+        SkIRect      fDevBounds;
+        SkMatrix     fCTM;
+        SkRasterClip fRC;
+        DrawFn       fDraw;
+    };
+
+    // Queues a draw covering localBounds (mapped through the CTM). If localBounds is null, or
+    // the paint can't compute fast bounds, the draw is assumed to cover the whole clip.
+    void queueDraw(const SkRect* localBounds, const SkPaint& paint, DrawFn);
+    void drawTile(const SkPixmap& root, const SkIRect& tile) const;
+
+    void onDrawGlyphRunList(SkCanvas*,
+                            const sktext::GlyphRunList&,
+                            const SkPaint& initialPaint,
+                            const SkPaint& drawingPaint) override;
+
+    bool onReadPixels(const SkPixmap&, int x, int y) override;
+    bool onWritePixels(const SkPixmap&, int, int) override;
+    bool onPeekPixels(SkPixmap*) override;
+    bool onAccessPixels(SkPixmap*) override;
+
+    SkExecutor&               fExecutor;
+    const int                 fTileSize;
+    SkArenaAllocWithReset     fAlloc{4096};
+    std::vector<DrawElement*> fQueue;
+
+    using INHERITED = SkBitmapDevice;
+};
+
+#endif  // SkThreadedBitmapDevice_DEFINED
@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/core/SkTiledPictureDraw.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+#include "src/core/SkBigPicture.h"
+#include "src/core/SkPicturePriv.h"
+#include "src/core/SkTaskGroup.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+static bool draw_into(const SkPicture* picture,
+                      const SkMatrix& matrix,
+                      const SkPixmap& dst,
+                      const SkIPoint& origin,
+                      const SkSurfaceProps* props) {
+    std::unique_ptr<SkCanvas> canvas =
+            SkCanvas::MakeRasterDirect(dst.info(), dst.writable_addr(), dst.rowBytes(), props);
+    if (!canvas) {
+        return false;
+    }
+    canvas->translate(-origin.fX, -origin.fY);
+    canvas->concat(matrix);
+    // SkRecordDraw() queries the picture's bounding box hierarchy with the local clip bounds,
+    // which here are just this tile.
+    picture->playback(canvas.get());
+    return true;
+}
+
+bool SkTiledPictureDraw(const SkPicture* picture,
+                        const SkMatrix& matrix,
+                        const SkPixmap& dst,
+                        SkExecutor& executor,
+                        const SkSurfaceProps* props,
+                        int tileSize) {
+    if (!picture) {
+        return false;
+    }
+    if (dst.addr() == nullptr) {
+        return false;
+    }
+
+    // Only the tiles under the picture's cull rect can be drawn into.
+    SkIRect drawBounds = matrix.mapRect(picture->cullRect()).roundOut();
+    if (!drawBounds.intersect(dst.bounds())) {
+        return true;
+    }
+
+    const SkBigPicture* bigPicture = SkPicturePriv::AsSkBigPicture(sk_ref_sp(picture));
+    if (!bigPicture || !bigPicture->bbh()) {
+        return draw_into(picture, matrix, dst, {0, 0}, props);
+    }
+
+    tileSize = std::max(tileSize, 1);
+    const int left = drawBounds.fLeft - drawBounds.fLeft % tileSize,
+              top  = drawBounds.fTop  - drawBounds.fTop  % tileSize;
+    const int tilesX = (drawBounds.fRight  - left + tileSize - 1) / tileSize,
+              tilesY = (drawBounds.fBottom - top  + tileSize - 1) / tileSize;
+
+    // Each tile has its own canvas, so a failure to make one is reported once, after all the
+    // others are done.
+    std::atomic<bool> ok{true};
+    SkTaskGroup tasks(executor);
+    tasks.batch(tilesX * tilesY, [&](int i) {
+        const SkIRect tile = SkIRect::MakeXYWH(left + (i % tilesX) * tileSize,
+                                               top  + (i / tilesX) * tileSize,
+                                               tileSize, tileSize);
+        SkPixmap tileDst;
+        if (!dst.extractSubset(&tileDst, tile)) {
+            return;
+        }
+        if (!draw_into(picture, matrix, tileDst, tile.topLeft(), props)) {
+            ok = false;
+        }
+    });
+    tasks.wait();
+    return ok;
+}
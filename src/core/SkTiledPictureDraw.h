@@ -0,0 +1,38 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkTiledPictureDraw_DEFINED
+#define SkTiledPictureDraw_DEFINED
+
+class SkExecutor;
+class SkMatrix;
+class SkPicture;
+class SkPixmap;
+class SkSurfaceProps;
+
+/**
+ *  Plays picture back into dst through matrix, splitting dst into square tiles that are
+ *  rasterized concurrently on executor. Blocks until every tile is done.
+ *
+ *  Each tile gets its own raster canvas over its part of dst, clipped to the tile, so tiles never
+ *  share pixels. If the picture was recorded with a bounding box hierarchy (e.g. an SkRTree), the
+ *  playback of each tile only visits the ops that intersect it. Pictures without one are played
+ *  back serially, since every tile would otherwise replay every op.
+ *
+ *  The results match a single SkCanvas::drawPicture() into dst, except for ops that read back
+ *  pixels outside the tile they draw into (e.g. backdrop filters on a saveLayer).
+ *
+ *  Returns false if dst can't be drawn into with a raster canvas.
+ */
+bool SkTiledPictureDraw(const SkPicture* picture,
+                        const SkMatrix& matrix,
+                        const SkPixmap& dst,
+                        SkExecutor& executor,
+                        const SkSurfaceProps* props = nullptr,
+                        int tileSize = 256);
+
+#endif  // SkTiledPictureDraw_DEFINED
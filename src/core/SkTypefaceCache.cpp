@@ -5,20 +5,24 @@
  * found in the LICENSE file.
  */
 
-#include "include/private/base/SkMutex.h"
 #include "src/core/SkTypefaceCache.h"
+
+#include "src/base/SkSharedMutex.h"
+
 #include <atomic>
+#include <cstring>
 
 #define TYPEFACE_CACHE_LIMIT    1024
 
 SkTypefaceCache::SkTypefaceCache() {}
 
-void SkTypefaceCache::add(sk_sp<SkTypeface> face) {
+void SkTypefaceCache::add(sk_sp<SkTypeface> face, uint32_t hash) {
     if (fTypefaces.size() >= TYPEFACE_CACHE_LIMIT) {
         this->purge(TYPEFACE_CACHE_LIMIT >> 2);
     }
 
     fTypefaces.emplace_back(std::move(face));
+    fHashes.push_back(hash);
 }
 
 sk_sp<SkTypeface> SkTypefaceCache::findByProcAndRef(FindProc proc, void* ctx) const {
@@ -30,12 +34,24 @@ sk_sp<SkTypeface> SkTypefaceCache::findByProcAndRef(FindProc proc, void* ctx) co
     return nullptr;
 }
 
+sk_sp<SkTypeface> SkTypefaceCache::findByHashProcAndRef(uint32_t hash,
+                                                        FindProc proc,
+                                                        void* ctx) const {
+    for (int i = 0; i < fHashes.size(); ++i) {
+        if (fHashes[i] == hash && proc(fTypefaces[i].get(), ctx)) {
+            return fTypefaces[i];
+        }
+    }
+    return nullptr;
+}
+
 void SkTypefaceCache::purge(int numToPurge) {
     int count = fTypefaces.size();
     int i = 0;
     while (i < count) {
         if (fTypefaces[i]->unique()) {
             fTypefaces.removeShuffle(i);
+            fHashes.removeShuffle(i);
             --count;
             if (--numToPurge == 0) {
                 return;
@@ -62,28 +78,55 @@ SkTypefaceID SkTypefaceCache::NewTypefaceID() {
     return nextID.fetch_add(1, std::memory_order_relaxed);
 }
 
-static SkMutex& typeface_cache_mutex() {
-    static SkMutex& mutex = *(new SkMutex);
+static SkSharedMutex& typeface_cache_mutex() {
+    static SkSharedMutex& mutex = *(new SkSharedMutex);
     return mutex;
 }
 
 void SkTypefaceCache::Add(sk_sp<SkTypeface> face) {
-    SkAutoMutexExclusive ama(typeface_cache_mutex());
+    SkAutoSharedMutexExclusive ama(typeface_cache_mutex());
     Get().add(std::move(face));
 }
 
 sk_sp<SkTypeface> SkTypefaceCache::FindByProcAndRef(FindProc proc, void* ctx) {
-    SkAutoMutexExclusive ama(typeface_cache_mutex());
+    SkAutoSharedMutexShared ama(typeface_cache_mutex());
     return Get().findByProcAndRef(proc, ctx);
 }
 
 void SkTypefaceCache::PurgeAll() {
-    SkAutoMutexExclusive ama(typeface_cache_mutex());
+    SkAutoSharedMutexExclusive ama(typeface_cache_mutex());
     Get().purgeAll();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+SkString SkFallbackTypefaceCache::MakeKey(const char familyName[],
+                                          const SkFontStyle& style,
+                                          const char* bcp47[],
+                                          int bcp47Count,
+                                          SkUnichar character) {
+    // Each string is written with its terminator, so that the fields can't run into each other.
+    // A null family name is kept apart from an empty one.
+    SkString key;
+    key.append(familyName ? "f" : "n");
+    if (familyName) {
+        key.append(familyName, strlen(familyName) + 1);
+    }
+    const int32_t values[] = {style.weight(), style.width(), style.slant(), character};
+    key.append(reinterpret_cast<const char*>(values), sizeof(values));
+    for (int i = 0; i < bcp47Count; ++i) {
+        key.append(bcp47[i], strlen(bcp47[i]) + 1);
+    }
+    return key;
+}
+
+void SkFallbackTypefaceCache::purgeAll() {
+    SkAutoMutexExclusive lock(fMutex);
+    fCache.reset();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 #ifdef SK_DEBUG
 static bool DumpProc(SkTypeface* face, void* ctx) {
     SkString n;
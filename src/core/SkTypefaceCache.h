@@ -10,9 +10,18 @@
 #ifndef SkTypefaceCache_DEFINED
 #define SkTypefaceCache_DEFINED
 
+#include "include/core/SkFontStyle.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkString.h"
 #include "include/core/SkTypeface.h"
+#include "include/core/SkTypes.h"
+#include "include/private/base/SkMutex.h"
 #include "include/private/base/SkTArray.h"
+#include "include/private/base/SkThreadAnnotations.h"
+#include "src/core/SkLRUCache.h"
+
+#include <cstdint>
+#include <utility>
 
 class SkTypefaceCache {
 public:
@@ -28,8 +37,11 @@ public:
     /**
      *  Add a typeface to the cache. Later, if we need to purge the cache,
      *  typefaces uniquely owned by the cache will be unref()ed.
+     *
+     *  The hash is whatever the caller's FindProc compares, hashed, so that lookups with the same
+     *  hash only call the proc for the typefaces that may match.
      */
-    void add(sk_sp<SkTypeface>);
+    void add(sk_sp<SkTypeface>, uint32_t hash = 0);
 
     /**
      *  Iterate through the cache, calling proc(typeface, ctx) for each typeface.
@@ -38,6 +50,11 @@ public:
      */
     sk_sp<SkTypeface> findByProcAndRef(FindProc proc, void* ctx) const;
 
+    /**
+     *  Like findByProcAndRef(), but only calls proc for the typefaces added with this hash.
+     */
+    sk_sp<SkTypeface> findByHashProcAndRef(uint32_t hash, FindProc proc, void* ctx) const;
+
     /**
      *  This will unref all of the typefaces in the cache for which the cache
      *  is the only owner. Normally this is handled automatically as needed.
@@ -54,6 +71,7 @@ public:
 
     // These are static wrappers around a global instance of a cache.
 
+    // Lookups share the global lock, so threads only wait for each other while one adds or purges.
     static void Add(sk_sp<SkTypeface>);
     static sk_sp<SkTypeface> FindByProcAndRef(FindProc proc, void* ctx);
     static void PurgeAll();
@@ -68,7 +86,56 @@ private:
 
     void purge(int count);
 
+    // The hashes are kept apart from the typefaces so a lookup scans them without touching any
+    // typeface that can't match.
     skia_private::TArray<sk_sp<SkTypeface>> fTypefaces;
+    skia_private::TArray<uint32_t>          fHashes;
+};
+
+/**
+ *  Remembers the results of SkFontMgr::matchFamilyStyleCharacter(), which font managers find by
+ *  searching through their fallback fonts on every call. Results are keyed on all of the call's
+ *  arguments, and include the calls that found no typeface. Thread safe.
+ */
+class SkFallbackTypefaceCache {
+public:
+    explicit SkFallbackTypefaceCache(int maxCount = 256) : fCache(maxCount) {}
+
+    /**
+     *  Returns the cached result for these arguments, or calls match() and caches what it
+     *  returns. No lock is held while match() runs.
+     */
+    template <typename Match>
+    sk_sp<SkTypeface> findOrMatch(const char familyName[],
+                                  const SkFontStyle& style,
+                                  const char* bcp47[],
+                                  int bcp47Count,
+                                  SkUnichar character,
+                                  Match&& match) {
+        SkString key = MakeKey(familyName, style, bcp47, bcp47Count, character);
+        {
+            SkAutoMutexExclusive lock(fMutex);
+            if (sk_sp<SkTypeface>* found = fCache.find(key)) {
+                return *found;
+            }
+        }
+        sk_sp<SkTypeface> typeface = match();
+        SkAutoMutexExclusive lock(fMutex);
+        fCache.insert_or_update(key, typeface);
+        return typeface;
+    }
+
+    void purgeAll();
+
+private:
+    static SkString MakeKey(const char familyName[],
+                            const SkFontStyle& style,
+                            const char* bcp47[],
+                            int bcp47Count,
+                            SkUnichar character);
+
+    SkMutex fMutex;
+    SkLRUCache<SkString, sk_sp<SkTypeface>> fCache SK_GUARDED_BY(fMutex);
 };
 
 #endif
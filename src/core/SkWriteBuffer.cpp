@@ -18,6 +18,7 @@
 #include "include/private/base/SkAssert.h"
 #include "include/private/base/SkTFitsIn.h"
 #include "include/private/base/SkTo.h"
+#include "src/core/SkDescriptor.h"
 #include "src/core/SkMatrixPriv.h"
 #include "src/core/SkMipmap.h"
 #include "src/core/SkPaintPriv.h"
@@ -39,6 +40,27 @@ class SkRegion;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+void SkWriteBuffer::writeDescriptor(const SkDescriptor& desc) {
+    // Refer back to an identical descriptor if one was written already, by its index plus one.
+    if (const int* index = fDescriptorIndices.find(desc.getChecksum())) {
+        const SkData* written = fDescriptors[*index].get();
+        if (written->size() == desc.getLength() &&
+            memcmp(written->data(), &desc, desc.getLength()) == 0) {
+            this->writeUInt(*index + 1);
+            return;
+        }
+    }
+
+    // Otherwise write a zero, and the descriptor itself. On a checksum collision the newer
+    // descriptor is always written in full.
+    this->writeUInt(0);
+    desc.flatten(*this);
+    if (!fDescriptorIndices.find(desc.getChecksum())) {
+        fDescriptorIndices.set(desc.getChecksum(), fDescriptors.size());
+        fDescriptors.push_back(SkData::MakeWithCopy(&desc, desc.getLength()));
+    }
+}
+
 SkBinaryWriteBuffer::SkBinaryWriteBuffer(const SkSerialProcs& p)
         : SkWriteBuffer(p), fFactorySet(nullptr), fTFSet(nullptr) {}
 
@@ -14,6 +14,7 @@
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkSerialProcs.h"
+#include "include/private/base/SkTArray.h"
 #include "src/core/SkTHash.h"
 #include "src/core/SkWriter32.h"
 
@@ -21,6 +22,7 @@
 #include <cstdint>
 #include <string_view>
 
+class SkDescriptor;
 class SkFactorySet;
 class SkFlattenable;
 class SkImage;
@@ -85,10 +87,21 @@ public:
     virtual void writeTypeface(SkTypeface* typeface) = 0;
     virtual void writePaint(const SkPaint& paint) = 0;
 
+    /**
+     *  Writes desc for SkReadBuffer::readDescriptor(). Each distinct descriptor is written in full
+     *  only the first time; writing it again just refers back to that first copy.
+     */
+    void writeDescriptor(const SkDescriptor& desc);
+
     const SkSerialProcs& serialProcs() const { return fProcs; }
 
 protected:
     SkSerialProcs   fProcs;
+
+private:
+    // The descriptors written so far, and the index of each in fDescriptors, by checksum.
+    skia_private::TArray<sk_sp<SkData>>    fDescriptors;
+    skia_private::THashMap<uint32_t, int>  fDescriptorIndices;
 };
 
 /**
@@ -10,55 +10,21 @@
 #include "include/core/SkFlattenable.h"
 #include "include/core/SkPath.h"
 #include "include/core/SkPathEffect.h"
-#include "include/core/SkPathMeasure.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkTPin.h"
+#include "src/core/SkContourMeasureCache.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/effects/SkTrimPE.h"
 
-#include <cstddef>
 #include <cstdint>
 
 class SkMatrix;
 class SkStrokeRec;
 struct SkRect;
 
-namespace {
-
-// Returns the number of contours iterated to satisfy the request.
-static size_t add_segments(const SkPath& src, SkScalar start, SkScalar stop, SkPath* dst,
-                           bool requires_moveto = true) {
-    SkASSERT(start < stop);
-
-    SkPathMeasure measure(src, false);
-
-    SkScalar current_segment_offset = 0;
-    size_t            contour_count = 1;
-
-    do {
-        const auto next_offset = current_segment_offset + measure.getLength();
-
-        if (start < next_offset) {
-            measure.getSegment(start - current_segment_offset,
-                               stop  - current_segment_offset,
-                               dst, requires_moveto);
-
-            if (stop <= next_offset)
-                break;
-        }
-
-        contour_count++;
-        current_segment_offset = next_offset;
-    } while (measure.nextContour());
-
-    return contour_count;
-}
-
-} // namespace
-
 SkTrimPE::SkTrimPE(SkScalar startT, SkScalar stopT, SkTrimPathEffect::Mode mode)
     : fStartT(startT), fStopT(stopT), fMode(mode) {}
 
@@ -69,21 +35,19 @@ bool SkTrimPE::onFilterPath(SkPath* dst, const SkPath& src, SkStrokeRec*, const
         return true;
     }
 
-    // First pass: compute the total len.
-    SkScalar len = 0;
-    SkPathMeasure meas(src, false);
-    do {
-        len += meas.getLength();
-    } while (meas.nextContour());
+    // The contours come from the cache when this path has been trimmed before, so animating the
+    // trim doesn't measure the path again every frame.
+    const sk_sp<const SkPathContours> contours =
+            SkContourMeasureCache::FindOrMeasure(src, /*forceClosed=*/false);
+    const SkScalar len = contours->length();
 
     const auto arcStart = len * fStartT,
                arcStop  = len * fStopT;
 
-    // Second pass: actually add segments.
     if (fMode == SkTrimPathEffect::Mode::kNormal) {
         // Normal mode -> one span.
         if (arcStart < arcStop) {
-            add_segments(src, arcStart, arcStop, dst);
+            contours->getSegments(arcStart, arcStop, dst, /*startWithMoveTo=*/true);
         }
     } else {
         // Inverted mode -> one logical span which wraps around at the end -> two actual spans.
@@ -95,17 +59,18 @@ bool SkTrimPE::onFilterPath(SkPath* dst, const SkPath& src, SkStrokeRec*, const
 
         bool requires_moveto = true;
         if (arcStop < len) {
-            // since we're adding the "tail" first, this is the total number of contours
-            const auto contour_count = add_segments(src, arcStop, len, dst);
+            // since we're adding the "tail" first, this is the last contour in the path
+            const int last_contour = contours->getSegments(arcStop, len, dst,
+                                                           /*startWithMoveTo=*/true);
 
             // if the path consists of a single closed contour, we don't want to disconnect
             // the two parts with a moveto.
-            if (contour_count == 1 && src.isLastContourClosed()) {
+            if (last_contour == 0 && src.isLastContourClosed()) {
                 requires_moveto = false;
             }
         }
         if (0 <  arcStart) {
-            add_segments(src, 0, arcStart, dst, requires_moveto);
+            contours->getSegments(0, arcStart, dst, requires_moveto);
         }
     }
 
@@ -7,11 +7,17 @@
 
 #include "src/effects/colorfilters/SkComposeColorFilter.h"
 
+#include "include/core/SkColorTable.h"
 #include "include/core/SkRefCnt.h"
 #include "include/private/base/SkAssert.h"
+#include "src/core/SkColorFilterPriv.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/effects/colorfilters/SkColorFilterBase.h"
+#include "src/effects/colorfilters/SkMatrixColorFilter.h"
+#include "src/effects/colorfilters/SkTableColorFilter.h"
+
+#include <cstdint>
 
 #include <utility>
 struct SkStageRec;
@@ -45,11 +51,111 @@ sk_sp<SkFlattenable> SkComposeColorFilter::CreateProc(SkReadBuffer& buffer) {
     return outer ? outer->makeComposed(std::move(inner)) : inner;
 }
 
+// Between two filters, the inner one premultiplies its output and the outer one unpremultiplies
+// it again. That's a no-op, except that it zeroes r,g,b where the inner filter made alpha 0. The
+// folded filters skip it, so they may only do so when the outer filter keeps alpha at 0.
+
+static sk_sp<SkColorFilter> fold_matrices(const SkMatrixColorFilter* outer,
+                                          const SkMatrixColorFilter* inner) {
+    if (outer->domain() != SkMatrixColorFilter::Domain::kRGBA ||
+        inner->domain() != SkMatrixColorFilter::Domain::kRGBA) {
+        return nullptr;
+    }
+    const float* O = outer->matrix();
+    const float* I = inner->matrix();
+
+    // The inner filter clamps its output to [0,1], which can only be skipped when it can't
+    // leave [0,1] for inputs in [0,1].
+    for (int row = 0; row < 4; ++row) {
+        float lo = I[5*row + 4],
+              hi = I[5*row + 4];
+        for (int col = 0; col < 4; ++col) {
+            (I[5*row + col] < 0 ? lo : hi) += I[5*row + col];
+        }
+        if (lo < 0 || hi > 1) {
+            return nullptr;
+        }
+    }
+    if (O[15] != 0 || O[16] != 0 || O[17] != 0 || O[19] != 0) {
+        return nullptr;
+    }
+
+    float concat[20];
+    for (int row = 0; row < 4; ++row) {
+        for (int col = 0; col < 5; ++col) {
+            float sum = col == 4 ? O[5*row + 4] : 0;
+            for (int k = 0; k < 4; ++k) {
+                sum += O[5*row + k] * I[5*k + col];
+            }
+            concat[5*row + col] = sum;
+        }
+    }
+    return SkColorFilters::Matrix(concat);
+}
+
+static sk_sp<SkColorFilter> fold_tables(const SkTableColorFilter* outer,
+                                        const SkTableColorFilter* inner) {
+    const SkColorTable* O = outer->table();
+    const SkColorTable* I = inner->table();
+    if (O->alphaTable()[0] != 0) {
+        return nullptr;
+    }
+
+    uint8_t a[256], r[256], g[256], b[256];
+    for (int i = 0; i < 256; ++i) {
+        a[i] = O->alphaTable()[I->alphaTable()[i]];
+        r[i] = O->redTable()  [I->redTable()  [i]];
+        g[i] = O->greenTable()[I->greenTable()[i]];
+        b[i] = O->blueTable() [I->blueTable() [i]];
+    }
+    return SkColorFilters::TableARGB(a, r, g, b);
+}
+
+sk_sp<SkColorFilter> SkColorFilterPriv::Fold(const SkColorFilter* outer,
+                                             const SkColorFilter* inner) {
+    const SkColorFilterBase* o = as_CFB(outer);
+    const SkColorFilterBase* i = as_CFB(inner);
+    if (o->type() != i->type()) {
+        return nullptr;
+    }
+    switch (o->type()) {
+        case SkColorFilterBase::Type::kMatrix:
+            return fold_matrices(static_cast<const SkMatrixColorFilter*>(o),
+                                 static_cast<const SkMatrixColorFilter*>(i));
+        case SkColorFilterBase::Type::kTable:
+            return fold_tables(static_cast<const SkTableColorFilter*>(o),
+                               static_cast<const SkTableColorFilter*>(i));
+        default:
+            return nullptr;
+    }
+}
+
 sk_sp<SkColorFilter> SkColorFilter::makeComposed(sk_sp<SkColorFilter> inner) const {
     if (!inner) {
         return sk_ref_sp(this);
     }
 
+    // The last filter of this chain runs right before the first filter of the inner chain. If
+    // those two fold into one, rebuild the chain around it, which folds any further neighbors.
+    auto as_compose = [](const SkColorFilter* cf) {
+        return as_CFB(cf)->type() == SkColorFilterBase::Type::kCompose
+                       ? static_cast<const SkComposeColorFilter*>(cf)
+                       : nullptr;
+    };
+    const SkComposeColorFilter* outerChain = as_compose(this);
+    const SkComposeColorFilter* innerChain = as_compose(inner.get());
+    if (sk_sp<SkColorFilter> folded = SkColorFilterPriv::Fold(
+                outerChain ? outerChain->inner().get() : this,
+                innerChain ? innerChain->outer().get() : inner.get())) {
+        if (innerChain) {
+            folded = folded->makeComposed(innerChain->inner());
+        }
+        if (outerChain) {
+            folded = outerChain->outer()->makeComposed(std::move(folded));
+        }
+        return folded;
+    }
+
     return sk_sp<SkColorFilter>(new SkComposeColorFilter(sk_ref_sp(this), std::move(inner)));
 }
 
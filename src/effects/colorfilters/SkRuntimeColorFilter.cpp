@@ -22,8 +22,13 @@
 #include "include/private/SkSLSampleUsage.h"
 #include "include/private/base/SkAssert.h"
 #include "include/private/base/SkDebug.h"
+#include "include/private/base/SkFloatingPoint.h"
 #include "include/private/base/SkTArray.h"
+#include "src/base/SkArenaAlloc.h"
 #include "src/core/SkEffectPriv.h"
+#include "src/core/SkRasterPipeline.h"
+#include "src/core/SkRasterPipelineOpContexts.h"
+#include "src/core/SkRasterPipelineOpList.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkRuntimeEffectPriv.h"
 #include "src/core/SkWriteBuffer.h"
@@ -61,6 +66,36 @@ bool SkRuntimeColorFilter::appendStages(const SkStageRec& rec, bool) const {
                                                     rec.fAlloc);
         SkShaders::MatrixRec matrix(SkMatrix::I());
         matrix.markCTMApplied();
+        if (fEffect->isAffineColorFilter()) {
+            // The program can't run on lowp's 16-bit fixed point colors, but the color matrix it
+            // computes can. The result for transparent black is the matrix's translation, and the
+            // result for each unit color, relative to that, is one of its columns.
+            float colors[5][4] = {{0, 0, 0, 0}, {1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0},
+                                  {0, 0, 0, 1}};
+            SkRasterPipeline_MemoryCtx ctx = {colors, 5};
+            SkSTArenaAlloc<1024> alloc;
+            SkRasterPipeline probe(&alloc);
+            SkStageRec probeRec = {&probe, &alloc, rec.fDstColorType, rec.fDstCS,
+                                   rec.fPaintColor, rec.fSurfaceProps};
+            RuntimeEffectRPCallbacks callbacks(probeRec, matrix, fChildren, fEffect->fSampleUsages);
+            probe.append(SkRasterPipelineOp::load_f32, &ctx);
+            if (program->appendStages(&probe, &alloc, &callbacks, uniforms)) {
+                probe.append(SkRasterPipelineOp::store_f32, &ctx);
+                probe.run(0, 0, 5, 1);
+
+                float* colorMatrix = rec.fAlloc->makeArray<float>(20);
+                for (int row = 0; row < 4; ++row) {
+                    for (int col = 0; col < 4; ++col) {
+                        colorMatrix[row * 5 + col] = colors[col + 1][row] - colors[0][row];
+                    }
+                    colorMatrix[row * 5 + 4] = colors[0][row];
+                }
+                if (sk_floats_are_finite(colorMatrix, 20)) {
+                    rec.fPipeline->append(SkRasterPipelineOp::matrix_4x5, colorMatrix);
+                    return true;
+                }
+            }
+        }
         RuntimeEffectRPCallbacks callbacks(rec, matrix, fChildren, fEffect->fSampleUsages);
         bool success = program->appendStages(rec.fPipeline, rec.fAlloc, &callbacks, uniforms);
         return success;
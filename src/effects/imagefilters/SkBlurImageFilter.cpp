@@ -28,6 +28,7 @@
 #include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkSpecialImage.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkWriteBuffer.h"
 
 #include <algorithm>
@@ -768,6 +769,36 @@ private:
     skvx::Vec<4, uint32_t>* fBuffer1Cursor;
 };
 
+// Runs 'blurLine' over lines [start, end) of 'lineLength' pixels each. Lines are split into bands of
+// adjacent lines that are blurred concurrently on the default SkExecutor; each band gets its own
+// pass, since passes carry running sums. Small blurs run as a single band to avoid task overhead.
+template <typename BlurLineFn>
+void blur_lines(const PassMaker* maker, int start, int end, int lineLength,
+                BlurLineFn&& blurLine) {
+    static constexpr int kMinPixelsPerBand = 1 << 16;
+    const int linesPerBand = std::max(1, kMinPixelsPerBand / std::max(1, lineLength));
+    const int bandCount = (end - start + linesPerBand - 1) / linesPerBand;
+
+    auto blurBand = [&](int band) {
+        SkSTArenaAlloc<256> alloc;
+        auto buffer = alloc.makeBytesAlignedTo(maker->bufferSizeBytes(),
+                                               alignof(skvx::Vec<4, uint32_t>));
+        Pass* pass = maker->makePass(buffer, &alloc);
+
+        const int bandStart = start + band * linesPerBand,
+                  bandEnd   = std::min(end, bandStart + linesPerBand);
+        for (int line = bandStart; line < bandEnd; ++line) {
+            blurLine(pass, line);
+        }
+    };
+
+    if (bandCount > 1) {
+        SkTaskGroup().batch(bandCount, blurBand);
+    } else if (bandCount == 1) {
+        blurBand(0);
+    }
+}
+
 // TODO: Implement CPU backend for different fTileMode. This is still worth doing inline with the
 // blur; at the moment the tiling is applied via the CropImageFilter and carried as metadata on
 // the FilterResult. This is forcefully applied in onFilterImage() to get a simple SkSpecialImage to
@@ -833,10 +864,6 @@ sk_sp<SkSpecialImage> cpu_blur(const skif::Context& ctx,
     }
     dst.eraseColor(SK_ColorTRANSPARENT);
 
-    auto buffer = alloc.makeBytesAlignedTo(std::max(makerX->bufferSizeBytes(),
-                                                    makerY->bufferSizeBytes()),
-                                           alignof(skvx::Vec<4, uint32_t>));
-
     // Basic Plan: The three cases to handle
     // * Horizontal and Vertical - blur horizontally while copying values from the source to
     //     the destination. Then, do an in-place vertical blur.
@@ -854,20 +881,14 @@ sk_sp<SkSpecialImage> cpu_blur(const skif::Context& ctx,
         loopStart = std::max(srcBounds.top(),    dstBounds.top());
         loopEnd   = std::min(srcBounds.bottom(), dstBounds.bottom());
 
-        auto srcAddr = src.getAddr32(0, loopStart - srcBounds.top());
-        auto dstAddr = dst.getAddr32(0, loopStart - dstBounds.top());
-
         // Iterate over each row to calculate 1D blur along X.
-        Pass* pass = makerX->makePass(buffer, &alloc);
-        for (int y = loopStart; y < loopEnd; ++y) {
+        blur_lines(makerX, loopStart, loopEnd, dstBounds.width(), [&](Pass* pass, int y) {
             pass->blur(srcBounds.left()  - dstBounds.left(),
                        srcBounds.right() - dstBounds.left(),
                        dstBounds.width(),
-                       srcAddr, 1,
-                       dstAddr, 1);
-            srcAddr += src.rowBytesAsPixels();
-            dstAddr += dst.rowBytesAsPixels();
-        }
+                       src.getAddr32(0, y - srcBounds.top()), 1,
+                       dst.getAddr32(0, y - dstBounds.top()), 1);
+        });
 
         // Set up the Y pass to blur from the full dst into the non-outset portion of dst
         src = dst;
@@ -885,19 +906,14 @@ sk_sp<SkSpecialImage> cpu_blur(const skif::Context& ctx,
     // Iterate over each column to calculate 1D blur along Y. This is either blurring from src into
     // dst for a 1D blur; or it's blurring from dst into dst for the second pass of a 2D blur.
     if (makerY->window() > 1) {
-        auto srcAddr = src.getAddr32(loopStart - srcBounds.left(), 0);
-        auto dstAddr = dst.getAddr32(loopStart - dstBounds.left(), dstYOffset);
-
-        Pass* pass = makerY->makePass(buffer, &alloc);
-        for (int x = loopStart; x < loopEnd; ++x) {
+        // Bands of adjacent columns share cache lines, which keeps the strided access cheap.
+        blur_lines(makerY, loopStart, loopEnd, dstBounds.height(), [&](Pass* pass, int x) {
             pass->blur(srcBounds.top()    - dstBounds.top(),
                        srcBounds.bottom() - dstBounds.top(),
                        dstBounds.height(),
-                       srcAddr, src.rowBytesAsPixels(),
-                       dstAddr, dst.rowBytesAsPixels());
-            srcAddr += 1;
-            dstAddr += 1;
-        }
+                       src.getAddr32(x - srcBounds.left(), 0), src.rowBytesAsPixels(),
+                       dst.getAddr32(x - dstBounds.left(), dstYOffset), dst.rowBytesAsPixels());
+        });
     }
 
     originalDstBounds.offset(-dstOrigin); // Make relative to dst's pixels
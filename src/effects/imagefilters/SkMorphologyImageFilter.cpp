@@ -7,9 +7,14 @@
 
 #include "include/effects/SkImageFilters.h"
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkColorType.h"
 #include "include/core/SkFlattenable.h"
 #include "include/core/SkImageFilter.h"
+#include "include/core/SkImageInfo.h"
 #include "include/core/SkM44.h"
+#include "include/core/SkPixmap.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
@@ -18,14 +23,20 @@
 #include "include/core/SkTypes.h"
 #include "include/effects/SkRuntimeEffect.h"
 #include "include/private/base/SkSpan_impl.h"
+#include "include/private/base/SkTo.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkImageFilterTypes.h"
 #include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkRuntimeEffectPriv.h"
+#include "src/core/SkSpecialImage.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkWriteBuffer.h"
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <memory>
 #include <optional>
 #include <utility>
 
@@ -244,6 +255,156 @@ skif::FilterResult morphology_pass(const skif::Context& ctx, const skif::FilterR
     return childOutput;
 }
 
+// The CPU applies each axis with the van Herk/Gil-Werman algorithm, which takes three min/max
+// operations per pixel regardless of the radius. Each line is split into blocks as long as the
+// window, and every window covers a suffix of one block and a prefix of the next, so the running
+// aggregates of the blocks' prefixes and suffixes give every window with one more operation.
+//
+// A line of 'count' output pixels reads 'count + 2*radius' input pixels. Each of its pixels is
+// 'lanes' adjacent N32 pixels that are processed together: one for the X pass, and a strip of
+// columns for the Y pass so that it runs along rows of memory.
+template <MorphType kType>
+void aggregate(const uint32_t* a, const uint32_t* b, uint32_t* dst, int lanes) {
+    using byte16 = skvx::Vec<16, uint8_t>;
+    int i = 0;
+    for (; i + 4 <= lanes; i += 4) {
+        const byte16 va = byte16::Load(a + i), vb = byte16::Load(b + i);
+        (kType == MorphType::kDilate ? max(va, vb) : min(va, vb)).store(dst + i);
+    }
+    for (; i < lanes; ++i) {
+        const skvx::byte4 va = skvx::byte4::Load(a + i), vb = skvx::byte4::Load(b + i);
+        (kType == MorphType::kDilate ? max(va, vb) : min(va, vb)).store(dst + i);
+    }
+}
+
+template <MorphType kType>
+void morphology_line(const uint32_t* src, size_t srcStride, uint32_t* dst, size_t dstStride,
+                     int count, int radius, int lanes, uint32_t* prefix, uint32_t* suffix) {
+    const int window = 2 * radius + 1;
+    const int length = count + 2 * radius;
+    const size_t laneBytes = lanes * sizeof(uint32_t);
+
+    for (int i = 0; i < length; ++i) {
+        if (i % window == 0) {
+            memcpy(prefix + i * lanes, src + i * srcStride, laneBytes);
+        } else {
+            aggregate<kType>(prefix + (i - 1) * lanes, src + i * srcStride, prefix + i * lanes,
+                             lanes);
+        }
+    }
+    for (int i = length - 1; i >= 0; --i) {
+        if (i == length - 1 || i % window == window - 1) {
+            memcpy(suffix + i * lanes, src + i * srcStride, laneBytes);
+        } else {
+            aggregate<kType>(suffix + (i + 1) * lanes, src + i * srcStride, suffix + i * lanes,
+                             lanes);
+        }
+    }
+    for (int i = 0; i < count; ++i) {
+        aggregate<kType>(suffix + i * lanes, prefix + (i + 2 * radius) * lanes,
+                         dst + i * dstStride, lanes);
+    }
+}
+
+// Runs 'morphLine' over 'lineCount' lines, each needing 'scratchPixels' of prefix and suffix
+// storage. As in the CPU blur, lines are split into bands that run concurrently on the default
+// SkExecutor, each with its own scratch.
+template <typename MorphLineFn>
+void morphology_lines(int lineCount, int pixelsPerLine, size_t scratchPixels,
+                      MorphLineFn&& morphLine) {
+    static constexpr int kMinPixelsPerBand = 1 << 16;
+    const int linesPerBand = std::max(1, kMinPixelsPerBand / std::max(1, pixelsPerLine));
+    const int bandCount = (lineCount + linesPerBand - 1) / linesPerBand;
+
+    auto morphBand = [&](int band) {
+        std::unique_ptr<uint32_t[]> scratch(new uint32_t[2 * scratchPixels]);
+        const int bandEnd = std::min(lineCount, (band + 1) * linesPerBand);
+        for (int line = band * linesPerBand; line < bandEnd; ++line) {
+            morphLine(line, scratch.get(), scratch.get() + scratchPixels);
+        }
+    };
+
+    if (bandCount > 1) {
+        SkTaskGroup().batch(bandCount, morphBand);
+    } else if (bandCount == 1) {
+        morphBand(0);
+    }
+}
+
+template <MorphType kType>
+sk_sp<SkSpecialImage> cpu_morphology(const skif::Context& ctx,
+                                     const sk_sp<SkSpecialImage>& input,
+                                     skif::LayerSpace<SkIPoint> inputOrigin,
+                                     skif::LayerSpace<SkISize> radii,
+                                     skif::LayerSpace<SkIRect> dstBounds) {
+    SkBitmap inputBitmap;
+    if (!SkSpecialImages::AsBitmap(input.get(), &inputBitmap) ||
+        inputBitmap.colorType() != kN32_SkColorType) {
+        return nullptr;
+    }
+
+    // Copy the input into a buffer covering every window of the output, with transparent black
+    // beyond the input's edges, so the passes never need to check bounds.
+    skif::LayerSpace<SkIRect> srcBounds = dstBounds;
+    srcBounds.outset(radii);
+    const SkImageInfo info = inputBitmap.info().makeWH(srcBounds.width(), srcBounds.height());
+    SkBitmap src;
+    if (!src.tryAllocPixels(info)) {
+        return nullptr;
+    }
+    src.eraseColor(SK_ColorTRANSPARENT);
+    const SkIPoint inputOffset = {inputOrigin.x() - srcBounds.left(),
+                                  inputOrigin.y() - srcBounds.top()};
+    SkIRect inputRect = SkIRect::MakeSize(inputBitmap.dimensions()).makeOffset(inputOffset);
+    SkPixmap inputPixels;
+    if (inputRect.intersect(SkIRect::MakeSize(info.dimensions())) &&
+        inputBitmap.pixmap().extractSubset(&inputPixels, inputRect.makeOffset(-inputOffset))) {
+        SkAssertResult(src.writePixels(inputPixels, inputRect.left(), inputRect.top()));
+    }
+
+    const int width = dstBounds.width(), height = dstBounds.height();
+    const int rx = radii.width(), ry = radii.height();
+
+    // The X pass produces every row the Y pass reads.
+    SkBitmap rows;
+    if (rx > 0) {
+        if (!rows.tryAllocPixels(info.makeWH(width, srcBounds.height()))) {
+            return nullptr;
+        }
+        morphology_lines(srcBounds.height(), srcBounds.width(), width + 2 * rx,
+                         [&](int y, uint32_t* prefix, uint32_t* suffix) {
+            morphology_line<kType>(src.getAddr32(0, y), 1, rows.getAddr32(0, y), 1,
+                                   width, rx, /*lanes=*/1, prefix, suffix);
+        });
+    } else {
+        SkAssertResult(src.extractSubset(&rows, SkIRect::MakeWH(width, srcBounds.height())));
+    }
+
+    SkBitmap dst;
+    if (ry > 0) {
+        if (!dst.tryAllocPixels(info.makeWH(width, height))) {
+            return nullptr;
+        }
+        // Strips of columns keep the Y pass reading whole runs of each row.
+        static constexpr int kStripWidth = 64;
+        const int stripCount = (width + kStripWidth - 1) / kStripWidth;
+        morphology_lines(stripCount, kStripWidth * srcBounds.height(),
+                         (size_t)kStripWidth * (height + 2 * ry),
+                         [&](int strip, uint32_t* prefix, uint32_t* suffix) {
+            const int x = strip * kStripWidth;
+            morphology_line<kType>(rows.getAddr32(x, 0), rows.rowBytesAsPixels(),
+                                   dst.getAddr32(x, 0), dst.rowBytesAsPixels(),
+                                   height, ry, std::min(kStripWidth, width - x), prefix, suffix);
+        });
+    } else {
+        SkAssertResult(rows.extractSubset(&dst, SkIRect::MakeXYWH(0, ry, width, height)));
+    }
+
+    return SkSpecialImages::MakeFromRaster(SkIRect::MakeWH(width, height),
+                                           dst,
+                                           ctx.backend()->surfaceProps());
+}
+
 } // end namespace
 
 sk_sp<SkImageFilter> SkImageFilters::Dilate(SkScalar radiusX, SkScalar radiusY,
@@ -304,8 +465,30 @@ skif::FilterResult SkMorphologyImageFilter::onFilterImage(const skif::Context& c
         return {};
     }
 
-    // The X pass has to preserve the extra rows to later be consumed by the Y pass.
     skif::LayerSpace<SkISize> radii = this->radii(ctx.mapping());
+    const bool gpuBacked = SkToBool(ctx.backend()->getBlurEngine());
+    if (!gpuBacked && (radii.width() > 0 || radii.height() > 0)) {
+        // Resolve everything the output's windows read, including any tiling of the child.
+        skif::LayerSpace<SkIRect> srcBounds = maxOutput;
+        srcBounds.outset(radii);
+        auto [resolvedChildOutput, origin] =
+                childOutput.imageAndOffset(ctx.withNewDesiredOutput(srcBounds));
+        if (!resolvedChildOutput) {
+            return {};
+        }
+        sk_sp<SkSpecialImage> result =
+                fType == MorphType::kDilate
+                        ? cpu_morphology<MorphType::kDilate>(ctx, resolvedChildOutput, origin,
+                                                             radii, maxOutput)
+                        : cpu_morphology<MorphType::kErode>(ctx, resolvedChildOutput, origin,
+                                                            radii, maxOutput);
+        if (result) {
+            return skif::FilterResult{std::move(result), maxOutput.topLeft()};
+        }
+        // Otherwise the CPU passes couldn't run (e.g. the input isn't N32), but the shaders can.
+    }
+
+    // The X pass has to preserve the extra rows to later be consumed by the Y pass.
     skif::LayerSpace<SkIRect> maxOutputX = maxOutput;
     maxOutputX.outset(skif::LayerSpace<SkISize>({0, radii.height()}));
     childOutput = morphology_pass(ctx.withNewDesiredOutput(maxOutputX), childOutput, fType,
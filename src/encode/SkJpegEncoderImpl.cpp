@@ -13,7 +13,9 @@
 #include "include/core/SkData.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
+#include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSize.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkYUVAInfo.h"
 #include "include/core/SkYUVAPixmaps.h"
@@ -25,16 +27,20 @@
 #include "src/base/SkMSAN.h"
 #include "src/codec/SkJpegConstants.h"
 #include "src/codec/SkJpegPriv.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/encode/SkImageEncoderFns.h"
 #include "src/encode/SkImageEncoderPriv.h"
 #include "src/encode/SkJPEGWriteUtility.h"
 #include "src/image/SkImage_Base.h"
 
+#include <algorithm>
 #include <csetjmp>
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 class GrDirectContext;
 class SkColorSpace;
@@ -178,41 +184,56 @@ bool SkJpegEncoderMgr::setParams(const SkImageInfo& srcInfo,
     return true;
 }
 
-// Convert a row of an SkYUVAPixmaps to a row of Y,U,V triples.
-// TODO(ccameron): This is horribly inefficient.
-static void yuva_copy_row(const SkYUVAPixmaps* src, int row, uint8_t* dst) {
-    int width = src->plane(0).width();
-    switch (src->yuvaInfo().planeConfig()) {
-        case SkYUVAInfo::PlaneConfig::kY_U_V: {
-            auto [ssWidthU, ssHeightU] = src->yuvaInfo().planeSubsamplingFactors(1);
-            auto [ssWidthV, ssHeightV] = src->yuvaInfo().planeSubsamplingFactors(2);
-            const uint8_t* srcY = reinterpret_cast<const uint8_t*>(src->plane(0).addr(0, row));
-            const uint8_t* srcU =
-                    reinterpret_cast<const uint8_t*>(src->plane(1).addr(0, row / ssHeightU));
-            const uint8_t* srcV =
-                    reinterpret_cast<const uint8_t*>(src->plane(2).addr(0, row / ssHeightV));
-            for (int col = 0; col < width; ++col) {
-                dst[3 * col + 0] = srcY[col];
-                dst[3 * col + 1] = srcU[col / ssWidthU];
-                dst[3 * col + 2] = srcV[col / ssWidthV];
+// The scratch space write_raw_imcu_row() needs: an iMCU row of every component, padded out to
+// whole blocks.
+static size_t raw_imcu_row_bytes(const jpeg_compress_struct& cinfo) {
+    size_t bytes = 0;
+    for (int c = 0; c < cinfo.num_components; ++c) {
+        const jpeg_component_info& comp = cinfo.comp_info[c];
+        bytes += (size_t)comp.width_in_blocks * DCTSIZE * comp.v_samp_factor * DCTSIZE;
+    }
+    return bytes;
+}
+
+// Writes the iMCU row of |src| that starts at image row |row| with jpeg_write_raw_data(), so that
+// libjpeg neither converts the colors nor downsamples the chroma again. Rows are passed straight
+// from the planes when they are already whole blocks wide. Others, and interleaved UV rows, are
+// copied to |scratch|, with the last pixel and row repeated out to the block edges.
+static void write_raw_imcu_row(jpeg_compress_struct* cinfo,
+                               const SkYUVAPixmaps& src,
+                               int row,
+                               uint8_t* scratch) {
+    const bool interleavedUV = src.yuvaInfo().planeConfig() == SkYUVAInfo::PlaneConfig::kY_UV;
+    SkASSERT(cinfo->num_components == 3 && cinfo->max_v_samp_factor <= 2);
+
+    JSAMPROW rows[3][2 * DCTSIZE];
+    JSAMPARRAY components[3];
+    for (int c = 0; c < 3; ++c) {
+        const jpeg_component_info& comp = cinfo->comp_info[c];
+        const SkPixmap& plane = src.plane(interleavedUV ? std::min(c, 1) : c);
+        const int step = interleavedUV && c > 0 ? 2 : 1;
+        const int offset = interleavedUV && c == 2 ? 1 : 0;
+        const int paddedWidth = comp.width_in_blocks * DCTSIZE;
+        const int width = std::min(plane.width(), paddedWidth);
+        const int firstRow = row * comp.v_samp_factor / cinfo->max_v_samp_factor;
+
+        for (int r = 0; r < comp.v_samp_factor * DCTSIZE; ++r) {
+            const int srcRow = std::min(firstRow + r, plane.height() - 1);
+            const uint8_t* srcPixels = static_cast<const uint8_t*>(plane.addr(0, srcRow));
+            if (step == 1 && width == paddedWidth) {
+                rows[c][r] = const_cast<JSAMPROW>(srcPixels);
+                continue;
             }
-            break;
-        }
-        case SkYUVAInfo::PlaneConfig::kY_UV: {
-            auto [ssWidthUV, ssHeightUV] = src->yuvaInfo().planeSubsamplingFactors(1);
-            const uint8_t* srcY = reinterpret_cast<const uint8_t*>(src->plane(0).addr(0, row));
-            const uint8_t* srcUV =
-                    reinterpret_cast<const uint8_t*>(src->plane(1).addr(0, row / ssHeightUV));
-            for (int col = 0; col < width; ++col) {
-                dst[3 * col + 0] = srcY[col];
-                dst[3 * col + 1] = srcUV[2 * (col / ssWidthUV) + 0];
-                dst[3 * col + 2] = srcUV[2 * (col / ssWidthUV) + 1];
+            for (int x = 0; x < width; ++x) {
+                scratch[x] = srcPixels[x * step + offset];
             }
-            break;
+            memset(scratch + width, scratch[width - 1], paddedWidth - width);
+            rows[c][r] = scratch;
+            scratch += paddedWidth;
         }
-        default:
-            break;
+        components[c] = rows[c];
     }
+    jpeg_write_raw_data(cinfo, components, cinfo->max_v_samp_factor * DCTSIZE);
 }
 
 bool SkJpegEncoderMgr::setParams(const SkYUVAPixmapInfo& srcInfo,
@@ -237,7 +258,7 @@ bool SkJpegEncoderMgr::setParams(const SkYUVAPixmapInfo& srcInfo,
     }
 
     // Support only Y,U,V and Y,UV configurations (they are the only ones supported by
-    // yuva_copy_row).
+    // write_raw_imcu_row).
     switch (srcInfo.yuvaInfo().planeConfig()) {
         case SkYUVAInfo::PlaneConfig::kY_U_V:
         case SkYUVAInfo::PlaneConfig::kY_UV:
@@ -252,15 +273,22 @@ bool SkJpegEncoderMgr::setParams(const SkYUVAPixmapInfo& srcInfo,
     fCInfo.comp_info[0].h_samp_factor = ssHoriz;
     fCInfo.comp_info[0].v_samp_factor = ssVert;
 
+    // The planes are already YCbCr at the sampling factors above, so they are passed to libjpeg
+    // as they are rather than being expanded to full resolution RGB-like rows.
+    fCInfo.raw_data_in = TRUE;
+
     fCInfo.optimize_coding = TRUE;
     return true;
 }
 
+// If |restartInterval| is not zero, the image is encoded with restart markers every that many MCUs
+// and with the standard Huffman tables, as a strip of a larger image (see encode_in_strips()).
 static std::unique_ptr<SkEncoder> Make(SkWStream* dst,
                                        const SkPixmap* src,
                                        const SkYUVAPixmaps* srcYUVA,
                                        const SkColorSpace* srcYUVAColorSpace,
-                                       const SkJpegEncoder::Options& options) {
+                                       const SkJpegEncoder::Options& options,
+                                       unsigned int restartInterval = 0) {
     // Exactly one of |src| or |srcYUVA| should be specified.
     if (srcYUVA) {
         SkASSERT(!src);
@@ -292,6 +320,11 @@ static std::unique_ptr<SkEncoder> Make(SkWStream* dst,
     }
 
     jpeg_set_quality(encoderMgr->cinfo(), options.fQuality, TRUE);
+    if (restartInterval) {
+        // Every strip must use the same tables.
+        encoderMgr->cinfo()->optimize_coding = FALSE;
+        encoderMgr->cinfo()->restart_interval = restartInterval;
+    }
     jpeg_start_compress(encoderMgr->cinfo(), TRUE);
 
     // Write XMP metadata. This will only write the standard XMP segment.
@@ -337,7 +370,7 @@ SkJpegEncoderImpl::SkJpegEncoderImpl(std::unique_ptr<SkJpegEncoderMgr> encoderMg
 
 SkJpegEncoderImpl::SkJpegEncoderImpl(std::unique_ptr<SkJpegEncoderMgr> encoderMgr,
                                      const SkYUVAPixmaps* src)
-        : SkEncoder(src->plane(0), encoderMgr->cinfo()->input_components * src->yuvaInfo().width())
+        : SkEncoder(src->plane(0), raw_imcu_row_bytes(*encoderMgr->cinfo()))
         , fEncoderMgr(std::move(encoderMgr))
         , fSrcYUVA(src) {}
 
@@ -350,11 +383,15 @@ bool SkJpegEncoderImpl::onEncodeRows(int numRows) {
     }
 
     if (fSrcYUVA) {
-        // TODO(ccameron): Consider using jpeg_write_raw_data, to avoid having to re-pack the data.
-        for (int i = 0; i < numRows; i++) {
-            yuva_copy_row(fSrcYUVA, fCurrRow + i, fStorage.get());
-            JSAMPLE* jpegSrcRow = fStorage.get();
-            jpeg_write_scanlines(fEncoderMgr->cinfo(), &jpegSrcRow, 1);
+        // Raw data is written an iMCU row at a time, so rows are held back until a whole one has
+        // been requested, or the image ends.
+        const int height = fSrc.height();
+        const int rowsPerIMCU = fEncoderMgr->cinfo()->max_v_samp_factor * DCTSIZE;
+        const int lastRow = fCurrRow + numRows;
+        while (fRawRowsWritten < lastRow &&
+               (fRawRowsWritten + rowsPerIMCU <= lastRow || lastRow == height)) {
+            write_raw_imcu_row(fEncoderMgr->cinfo(), *fSrcYUVA, fRawRowsWritten, fStorage.get());
+            fRawRowsWritten += rowsPerIMCU;
         }
     } else {
         const size_t srcBytes = SkColorTypeBytesPerPixel(fSrc.colorType()) * fSrc.width();
@@ -391,9 +428,181 @@ bool SkJpegEncoderImpl::onEncodeRows(int numRows) {
     return true;
 }
 
+// Returns the size of an MCU in pixels, which is also the size of an iMCU row, as encoded by
+// SkJpegEncoderMgr::setParams().
+static SkISize mcu_size(const SkPixmap* src,
+                        const SkYUVAPixmaps* srcYUVA,
+                        const SkJpegEncoder::Options& options) {
+    if (srcYUVA) {
+        auto [h, v] = SkYUVAInfo::SubsamplingFactors(srcYUVA->yuvaInfo().subsampling());
+        return {h * DCTSIZE, v * DCTSIZE};
+    }
+    switch (src->colorType()) {
+        case kGray_8_SkColorType:
+        case kAlpha_8_SkColorType:
+        case kR8_unorm_SkColorType:
+            return {DCTSIZE, DCTSIZE};
+        default:
+            break;
+    }
+    switch (options.fDownsample) {
+        case SkJpegEncoder::Downsample::k420: return {2 * DCTSIZE, 2 * DCTSIZE};
+        case SkJpegEncoder::Downsample::k422: return {2 * DCTSIZE, DCTSIZE};
+        case SkJpegEncoder::Downsample::k444: return {DCTSIZE, DCTSIZE};
+    }
+    SkUNREACHABLE;
+}
+
+// Finds the end of the SOS segment of a JPEG written by libjpeg, and the offset of its SOF marker.
+static bool find_scan(const SkData& jpeg, size_t* sofOffset, size_t* scanOffset) {
+    const uint8_t* bytes = jpeg.bytes();
+    const size_t size = jpeg.size();
+    *sofOffset = 0;
+    size_t offset = kJpegMarkerCodeSize;
+    while (offset + kJpegMarkerCodeSize + kJpegSegmentParameterLengthSize <= size) {
+        if (bytes[offset] != 0xFF) {
+            return false;
+        }
+        const uint8_t marker = bytes[offset + 1];
+        const size_t length = (bytes[offset + 2] << 8) | bytes[offset + 3];
+        if (marker >= 0xC0 && marker <= 0xC2) {
+            *sofOffset = offset;
+        }
+        offset += kJpegMarkerCodeSize + length;
+        if (marker == kJpegMarkerStartOfScan) {
+            *scanOffset = offset;
+            // The scan must end with an EOI, and the SOF must have room for the height.
+            return *sofOffset && offset + kJpegMarkerCodeSize <= size &&
+                   bytes[size - 2] == 0xFF && bytes[size - 1] == kJpegMarkerEndOfImage;
+        }
+    }
+    return false;
+}
+
+// Encodes bands of whole iMCU rows on |executor|, each as a JPEG of its own whose only interval
+// covers the band, and splices their entropy-coded data together with restart markers in between.
+// Restart markers reset the DC predictions, and the strips share the standard Huffman tables, so
+// the result is the JPEG that a single encoder with the same restart interval would write. The
+// strip count only depends on the image size, so the output doesn't depend on the thread count.
+//
+// Returns null if the image is too small to split, or if a strip failed to encode, in which case
+// the encode should be done serially.
+static sk_sp<SkData> encode_in_strips(const SkPixmap* src,
+                                      const SkYUVAPixmaps* srcYUVA,
+                                      const SkColorSpace* srcYUVAColorSpace,
+                                      const SkJpegEncoder::Options& options) {
+    // Enough rows per strip that the restart markers and standard tables cost little.
+    constexpr int kMinIMCURowsPerStrip = 4;
+    constexpr int kMaxStrips = 16;
+
+    if (srcYUVA && (!srcYUVA->isValid() ||
+                    srcYUVA->yuvaInfo().origin() != kTopLeft_SkEncodedOrigin)) {
+        return nullptr;
+    }
+    if (!srcYUVA && (!src || !SkPixmapIsValid(*src))) {
+        return nullptr;
+    }
+    const SkISize dims = srcYUVA ? srcYUVA->yuvaInfo().dimensions() : src->dimensions();
+    const SkISize mcu = mcu_size(src, srcYUVA, options);
+    const int mcusPerRow = (dims.width() + mcu.width() - 1) / mcu.width();
+    const int iMCURows = (dims.height() + mcu.height() - 1) / mcu.height();
+    const int strips = std::min(kMaxStrips, iMCURows / kMinIMCURowsPerStrip);
+    if (strips < 2) {
+        return nullptr;
+    }
+    int iMCURowsPerStrip = (iMCURows + strips - 1) / strips;
+    // Restart intervals are 16-bit.
+    iMCURowsPerStrip = std::min(iMCURowsPerStrip, 0xFFFF / mcusPerRow);
+    if (iMCURowsPerStrip < 1) {
+        return nullptr;
+    }
+    const int rowsPerStrip = iMCURowsPerStrip * mcu.height();
+    const int stripCount = (dims.height() + rowsPerStrip - 1) / rowsPerStrip;
+
+    std::vector<sk_sp<SkData>> encodedStrips(stripCount);
+    SkTaskGroup taskGroup(*options.fExecutor);
+    taskGroup.batch(stripCount, [&](int i) {
+        const int top = i * rowsPerStrip;
+        const int height = std::min(rowsPerStrip, dims.height() - top);
+        SkDynamicMemoryWStream stripStream;
+        std::unique_ptr<SkEncoder> encoder;
+        SkPixmap stripPixmap;
+        SkYUVAPixmaps stripYUVA;
+        if (srcYUVA) {
+            const SkYUVAInfo& info = srcYUVA->yuvaInfo();
+            SkYUVAInfo stripInfo({dims.width(), height}, info.planeConfig(), info.subsampling(),
+                                 info.yuvColorSpace());
+            SkISize planeDims[SkYUVAInfo::kMaxPlanes];
+            SkPixmap planes[SkYUVAInfo::kMaxPlanes];
+            for (int p = 0; p < stripInfo.planeDimensions(planeDims); ++p) {
+                const int planeTop = top / std::get<1>(info.planeSubsamplingFactors(p));
+                if (!srcYUVA->plane(p).extractSubset(
+                            &planes[p],
+                            SkIRect::MakeXYWH(0, planeTop, planeDims[p].width(),
+                                              planeDims[p].height()))) {
+                    return;
+                }
+            }
+            stripYUVA = SkYUVAPixmaps::FromExternalPixmaps(stripInfo, planes);
+            encoder = Make(&stripStream, nullptr, &stripYUVA, srcYUVAColorSpace, options,
+                           iMCURowsPerStrip * mcusPerRow);
+        } else {
+            if (!src->extractSubset(&stripPixmap,
+                                    SkIRect::MakeXYWH(0, top, dims.width(), height))) {
+                return;
+            }
+            encoder = Make(&stripStream, &stripPixmap, nullptr, nullptr, options,
+                           iMCURowsPerStrip * mcusPerRow);
+        }
+        if (encoder && encoder->encodeRows(height)) {
+            encodedStrips[i] = stripStream.detachAsData();
+        }
+    });
+    taskGroup.wait();
+
+    // The first strip provides the markers, including the metadata, the tables and the restart
+    // interval, with the height changed to the whole image's.
+    size_t sofOffset, scanOffset;
+    if (!encodedStrips[0] || !find_scan(*encodedStrips[0], &sofOffset, &scanOffset)) {
+        return nullptr;
+    }
+    // The height follows the marker, the segment length and the sample precision.
+    const size_t heightOffset = sofOffset + kJpegMarkerCodeSize +
+                                kJpegSegmentParameterLengthSize + 1;
+    const uint8_t height[] = {(uint8_t)(dims.height() >> 8), (uint8_t)dims.height()};
+    const uint8_t* header = encodedStrips[0]->bytes();
+    SkDynamicMemoryWStream out;
+    out.write(header, heightOffset);
+    out.write(height, sizeof(height));
+    out.write(header + heightOffset + sizeof(height), scanOffset - heightOffset - sizeof(height));
+
+    for (int i = 0; i < stripCount; ++i) {
+        size_t stripSofOffset, stripScanOffset;
+        if (!encodedStrips[i] ||
+            !find_scan(*encodedStrips[i], &stripSofOffset, &stripScanOffset)) {
+            return nullptr;
+        }
+        if (i > 0) {
+            const uint8_t restart[] = {0xFF, (uint8_t)(0xD0 + ((i - 1) & 7))};
+            out.write(restart, sizeof(restart));
+        }
+        // Everything between the SOS segment and the EOI.
+        out.write(encodedStrips[i]->bytes() + stripScanOffset,
+                  encodedStrips[i]->size() - stripScanOffset - kJpegMarkerCodeSize);
+    }
+    const uint8_t endOfImage[] = {0xFF, kJpegMarkerEndOfImage};
+    out.write(endOfImage, sizeof(endOfImage));
+    return out.detachAsData();
+}
+
 namespace SkJpegEncoder {
 
 bool Encode(SkWStream* dst, const SkPixmap& src, const Options& options) {
+    if (options.fExecutor) {
+        if (sk_sp<SkData> encoded = encode_in_strips(&src, nullptr, nullptr, options)) {
+            return dst->write(encoded->data(), encoded->size());
+        }
+    }
     auto encoder = Make(dst, src, options);
     return encoder.get() && encoder->encodeRows(src.height());
 }
@@ -402,6 +611,11 @@ bool Encode(SkWStream* dst,
             const SkYUVAPixmaps& src,
             const SkColorSpace* srcColorSpace,
             const Options& options) {
+    if (options.fExecutor) {
+        if (sk_sp<SkData> encoded = encode_in_strips(nullptr, &src, srcColorSpace, options)) {
+            return dst->write(encoded->data(), encoded->size());
+        }
+    }
     auto encoder = Make(dst, src, srcColorSpace, options);
     return encoder.get() && encoder->encodeRows(src.yuvaInfo().height());
 }
@@ -29,6 +29,8 @@ protected:
 private:
     std::unique_ptr<SkJpegEncoderMgr> fEncoderMgr;
     const SkYUVAPixmaps* fSrcYUVA = nullptr;
+    // The rows of fSrcYUVA passed to libjpeg so far, which is a whole number of iMCU rows.
+    int fRawRowsWritten = 0;
 };
 
 #endif
@@ -13,6 +13,7 @@
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
 #include "include/core/SkDataTable.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkRefCnt.h"
@@ -24,9 +25,11 @@
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkNoncopyable.h"
 #include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
 #include "modules/skcms/skcms.h"
 #include "src/base/SkMSAN.h"
 #include "src/codec/SkPngPriv.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/encode/SkImageEncoderFns.h"
 #include "src/encode/SkImageEncoderPriv.h"
 #include "src/image/SkImage_Base.h"
@@ -41,6 +44,7 @@
 
 #include <png.h>
 #include <pngconf.h>
+#include "zlib.h"  // NO_G3_REWRITE
 
 class GrDirectContext;
 class SkImage;
@@ -81,6 +85,7 @@ public:
     bool setColorSpace(const SkImageInfo& info, const SkPngEncoder::Options& options);
     bool writeInfo(const SkImageInfo& srcInfo);
     void chooseProc(const SkImageInfo& srcInfo);
+    bool writeChunk(const char name[], const void* data, size_t length);
 
     png_structp pngPtr() { return fPngPtr; }
     png_infop infoPtr() { return fInfoPtr; }
@@ -433,6 +438,307 @@ bool SkPngEncoderMgr::writeInfo(const SkImageInfo& srcInfo) {
 
 void SkPngEncoderMgr::chooseProc(const SkImageInfo& srcInfo) { fProc = choose_proc(srcInfo); }
 
+bool SkPngEncoderMgr::writeChunk(const char name[], const void* data, size_t length) {
+    if (setjmp(png_jmpbuf(fPngPtr))) {
+        return false;
+    }
+
+    png_write_chunk(fPngPtr, (png_const_bytep)name, (png_const_bytep)data, length);
+    return true;
+}
+
+namespace {
+
+// When encoding on an executor, the rows are split into groups of about this many filtered bytes.
+constexpr size_t kTargetGroupBytes = 256 * 1024;
+
+// Each group is compressed with up to this much of the previous group's data as its preset
+// dictionary, which is all a deflate stream can refer back to. Splitting the rows then only costs
+// a few bytes per group.
+constexpr size_t kDeflateWindowBytes = 32 * 1024;
+
+enum PngFilterType : uint8_t { kNone = 0, kSub = 1, kUp = 2, kAvg = 3, kPaeth = 4 };
+
+inline uint8_t paeth_predictor(int a, int b, int c) {
+    int p = a + b - c;
+    int pa = std::abs(p - a);
+    int pb = std::abs(p - b);
+    int pc = std::abs(p - c);
+    if (pa <= pb && pa <= pc) {
+        return a;
+    }
+    return pb <= pc ? b : c;
+}
+
+// The filtered value of byte i of row, given the unfiltered previous row (zeros for the first).
+template <PngFilterType kType>
+inline uint8_t filtered_byte(const uint8_t* row, const uint8_t* prev, size_t i, size_t bpp) {
+    int left = i >= bpp ? row[i - bpp] : 0;
+    int upLeft = i >= bpp ? prev[i - bpp] : 0;
+    switch (kType) {
+        case kNone:  return row[i];
+        case kSub:   return row[i] - left;
+        case kUp:    return row[i] - prev[i];
+        case kAvg:   return row[i] - ((left + prev[i]) >> 1);
+        case kPaeth: return row[i] - paeth_predictor(left, prev[i], upLeft);
+    }
+    SkUNREACHABLE;
+}
+
+template <PngFilterType kType>
+void filter_row(const uint8_t* row, const uint8_t* prev, size_t rowBytes, size_t bpp,
+                uint8_t* dst) {
+    for (size_t i = 0; i < rowBytes; ++i) {
+        dst[i] = filtered_byte<kType>(row, prev, i, bpp);
+    }
+}
+
+// Like libpng's heuristic, estimates how well a filtered row compresses by the sum of its bytes'
+// magnitudes, read as signed values. Only every pixelStride-th pixel is looked at.
+template <PngFilterType kType>
+uint32_t filter_cost(const uint8_t* row, const uint8_t* prev, size_t rowBytes, size_t bpp,
+                     size_t pixelStride) {
+    uint32_t cost = 0;
+    for (size_t x = 0; x < rowBytes; x += bpp * pixelStride) {
+        for (size_t i = x; i < x + bpp; ++i) {
+            cost += std::abs((int8_t)filtered_byte<kType>(row, prev, i, bpp));
+        }
+    }
+    return cost;
+}
+
+uint32_t filter_cost(PngFilterType type, const uint8_t* row, const uint8_t* prev,
+                     size_t rowBytes, size_t bpp, size_t pixelStride) {
+    switch (type) {
+        case kNone:  return filter_cost<kNone> (row, prev, rowBytes, bpp, pixelStride);
+        case kSub:   return filter_cost<kSub>  (row, prev, rowBytes, bpp, pixelStride);
+        case kUp:    return filter_cost<kUp>   (row, prev, rowBytes, bpp, pixelStride);
+        case kAvg:   return filter_cost<kAvg>  (row, prev, rowBytes, bpp, pixelStride);
+        case kPaeth: return filter_cost<kPaeth>(row, prev, rowBytes, bpp, pixelStride);
+    }
+    SkUNREACHABLE;
+}
+
+// Writes the filter type byte and the filtered row to dst, which must fit rowBytes + 1 bytes.
+void filter_row(int filterFlags, const uint8_t* row, const uint8_t* prev, size_t rowBytes,
+                size_t bpp, size_t pixelStride, uint8_t* dst) {
+    static constexpr struct {
+        SkPngEncoder::FilterFlag fFlag;
+        PngFilterType fType;
+    } kFilters[] = {
+        {SkPngEncoder::FilterFlag::kNone, kNone},
+        {SkPngEncoder::FilterFlag::kSub, kSub},
+        {SkPngEncoder::FilterFlag::kUp, kUp},
+        {SkPngEncoder::FilterFlag::kAvg, kAvg},
+        {SkPngEncoder::FilterFlag::kPaeth, kPaeth},
+    };
+
+    PngFilterType best = kNone;
+    uint32_t bestCost = UINT32_MAX;
+    int filterCount = 0;
+    for (const auto& filter : kFilters) {
+        if (filterFlags & (int)filter.fFlag) {
+            best = filter.fType;
+            ++filterCount;
+        }
+    }
+    if (filterCount > 1) {
+        for (const auto& filter : kFilters) {
+            if (filterFlags & (int)filter.fFlag) {
+                uint32_t cost = filter_cost(filter.fType, row, prev, rowBytes, bpp, pixelStride);
+                if (cost < bestCost) {
+                    best = filter.fType;
+                    bestCost = cost;
+                }
+            }
+        }
+    }
+
+    dst[0] = best;
+    switch (best) {
+        case kNone:  memcpy(dst + 1, row, rowBytes);                     break;
+        case kSub:   filter_row<kSub>  (row, prev, rowBytes, bpp, dst + 1); break;
+        case kUp:    filter_row<kUp>   (row, prev, rowBytes, bpp, dst + 1); break;
+        case kAvg:   filter_row<kAvg>  (row, prev, rowBytes, bpp, dst + 1); break;
+        case kPaeth: filter_row<kPaeth>(row, prev, rowBytes, bpp, dst + 1); break;
+    }
+}
+
+struct RowGroup {
+    int fStartRow;
+    int fRowCount;
+    std::vector<uint8_t> fFiltered;
+    uint32_t fAdler;
+    std::vector<uint8_t> fCompressed;
+    bool fCompressedOk = false;
+};
+
+class GroupedImageWriter {
+public:
+    GroupedImageWriter(SkPngEncoderMgr* mgr, const SkPixmap& src,
+                       const SkPngEncoder::Options& options, size_t rowBytes, size_t bpp)
+            : fMgr(mgr)
+            , fSrc(src)
+            , fRowBytes(rowBytes)
+            , fBpp(bpp)
+            , fFilterFlags((int)options.fFilterFlags & (int)SkPngEncoder::FilterFlag::kAll)
+            , fPixelStride(options.fFastFilterSelection ? 4 : 1)
+            , fZLibLevel(std::min(std::max(0, options.fZLibLevel), 9)) {
+        if (fFilterFlags == 0) {
+            fFilterFlags = (int)SkPngEncoder::FilterFlag::kNone;
+        }
+        // Without an executor, one group avoids paying for the split.
+        int rowsPerGroup = src.height();
+        if (options.fExecutor) {
+            rowsPerGroup = (int)std::max<size_t>(1, kTargetGroupBytes / (fRowBytes + 1));
+        }
+        for (int y = 0; y < src.height(); y += rowsPerGroup) {
+            fGroups.push_back({y, std::min(rowsPerGroup, src.height() - y), {}, 0, {}});
+        }
+    }
+
+    bool write(SkExecutor* executor) {
+        auto forEachGroup = [&](std::function<void(int)> fn) {
+            if (executor) {
+                SkTaskGroup taskGroup(*executor);
+                taskGroup.batch(SkToInt(fGroups.size()), std::move(fn));
+                taskGroup.wait();
+            } else {
+                for (size_t i = 0; i < fGroups.size(); ++i) {
+                    fn(i);
+                }
+            }
+        };
+
+        forEachGroup([this](int i) { this->filterGroup(&fGroups[i]); });
+        fAdler = fGroups[0].fAdler;
+        for (size_t i = 1; i < fGroups.size(); ++i) {
+            fAdler = adler32_combine(fAdler, fGroups[i].fAdler, fGroups[i].fFiltered.size());
+        }
+        forEachGroup([this](int i) { this->compressGroup(i); });
+
+        for (const RowGroup& group : fGroups) {
+            if (!group.fCompressedOk ||
+                !fMgr->writeChunk("IDAT", group.fCompressed.data(), group.fCompressed.size())) {
+                return false;
+            }
+        }
+        return fMgr->writeChunk("IEND", nullptr, 0);
+    }
+
+private:
+    void filterGroup(RowGroup* group) const {
+        std::vector<uint8_t> rows(2 * fRowBytes, 0);
+        uint8_t* prev = rows.data();
+        uint8_t* row = prev + fRowBytes;
+        group->fFiltered.resize(group->fRowCount * (fRowBytes + 1));
+
+        if (group->fStartRow > 0) {
+            this->transformRow(group->fStartRow - 1, prev);
+        }
+        for (int y = 0; y < group->fRowCount; ++y) {
+            this->transformRow(group->fStartRow + y, row);
+            filter_row(fFilterFlags, row, prev, fRowBytes, fBpp, fPixelStride,
+                       group->fFiltered.data() + y * (fRowBytes + 1));
+            std::swap(prev, row);
+        }
+        group->fAdler = adler32(1, group->fFiltered.data(), group->fFiltered.size());
+    }
+
+    void transformRow(int y, uint8_t* dst) const {
+        const void* srcRow = fSrc.addr(0, y);
+        sk_msan_assert_initialized(srcRow,
+                                   (const uint8_t*)srcRow + (fSrc.width() << fSrc.shiftPerPixel()));
+        fMgr->proc()((char*)dst,
+                     (const char*)srcRow,
+                     fSrc.width(),
+                     SkColorTypeBytesPerPixel(fSrc.colorType()));
+    }
+
+    // Compresses the group to a sequence of raw deflate blocks that can be concatenated with the
+    // other groups'. The first group starts with the zlib header and the last one ends the stream.
+    void compressGroup(int index) {
+        RowGroup* group = &fGroups[index];
+        bool isFirst = index == 0;
+        bool isLast = index == (int)fGroups.size() - 1;
+
+        z_stream stream = {};
+        // libpng compresses filtered rows with Z_FILTERED too.
+        int strategy = fFilterFlags == (int)SkPngEncoder::FilterFlag::kNone ? Z_DEFAULT_STRATEGY
+                                                                             : Z_FILTERED;
+        if (deflateInit2(&stream, fZLibLevel, Z_DEFLATED, -15, 8, strategy) != Z_OK) {
+            return;
+        }
+        if (!isFirst) {
+            const std::vector<uint8_t>& prevData = fGroups[index - 1].fFiltered;
+            size_t dictSize = std::min(prevData.size(), kDeflateWindowBytes);
+            deflateSetDictionary(&stream, prevData.data() + prevData.size() - dictSize, dictSize);
+        }
+
+        std::vector<uint8_t>& out = group->fCompressed;
+        out.resize(deflateBound(&stream, group->fFiltered.size()) + 16);
+        size_t written = 0;
+        if (isFirst) {
+            // CMF is deflate with a 32K window. FLG has the level hint zlib would write, and the
+            // check bits that make CMF * 256 + FLG a multiple of 31.
+            uint8_t cmf = 0x78;
+            uint8_t flg = (fZLibLevel < 2 ? 0 : fZLibLevel < 6 ? 1 : fZLibLevel == 6 ? 2 : 3) << 6;
+            if (int rem = (cmf * 256 + flg) % 31) {
+                flg += 31 - rem;
+            }
+            out[written++] = cmf;
+            out[written++] = flg;
+        }
+
+        stream.next_in = group->fFiltered.data();
+        stream.avail_in = group->fFiltered.size();
+        // A sync flush ends the group's output on a byte boundary without ending the stream.
+        int flush = isLast ? Z_FINISH : Z_SYNC_FLUSH;
+        bool ok = false;
+        for (;;) {
+            if (written == out.size()) {
+                out.resize(out.size() * 2);
+            }
+            stream.next_out = out.data() + written;
+            stream.avail_out = out.size() - written;
+            int ret = deflate(&stream, flush);
+            written = out.size() - stream.avail_out;
+            if (ret == Z_STREAM_END || (flush == Z_SYNC_FLUSH && ret == Z_OK && stream.avail_out)) {
+                ok = true;
+                break;
+            }
+            // More calls can only help if the output was full.
+            if ((ret != Z_OK && ret != Z_BUF_ERROR) || stream.avail_out) {
+                break;
+            }
+        }
+        deflateEnd(&stream);
+        if (!ok) {
+            return;
+        }
+
+        out.resize(written);
+        if (isLast) {
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                out.push_back((fAdler >> shift) & 0xFF);
+            }
+        }
+        group->fCompressedOk = true;
+    }
+
+    SkPngEncoderMgr* fMgr;
+    const SkPixmap& fSrc;
+    const size_t fRowBytes;
+    const size_t fBpp;
+    int fFilterFlags;
+    const size_t fPixelStride;
+    const int fZLibLevel;
+    std::vector<RowGroup> fGroups;
+    uint32_t fAdler = 1;
+};
+
+}  // namespace
+
 SkPngEncoderImpl::SkPngEncoderImpl(std::unique_ptr<SkPngEncoderMgr> encoderMgr, const SkPixmap& src)
         : SkEncoder(src, encoderMgr->pngBytesPerPixel() * src.width())
         , fEncoderMgr(std::move(encoderMgr)) {}
@@ -467,7 +773,9 @@ bool SkPngEncoderImpl::onEncodeRows(int numRows) {
 }
 
 namespace SkPngEncoder {
-std::unique_ptr<SkEncoder> Make(SkWStream* dst, const SkPixmap& src, const Options& options) {
+static std::unique_ptr<SkPngEncoderMgr> make_encoder_mgr(SkWStream* dst,
+                                                         const SkPixmap& src,
+                                                         const Options& options) {
     if (!SkPixmapIsValid(src)) {
         return nullptr;
     }
@@ -490,13 +798,41 @@ std::unique_ptr<SkEncoder> Make(SkWStream* dst, const SkPixmap& src, const Optio
     }
 
     encoderMgr->chooseProc(src.info());
+    return encoderMgr;
+}
 
+std::unique_ptr<SkEncoder> Make(SkWStream* dst, const SkPixmap& src, const Options& options) {
+    std::unique_ptr<SkPngEncoderMgr> encoderMgr = make_encoder_mgr(dst, src, options);
+    if (!encoderMgr) {
+        return nullptr;
+    }
     return std::make_unique<SkPngEncoderImpl>(std::move(encoderMgr), src);
 }
 
 bool Encode(SkWStream* dst, const SkPixmap& src, const Options& options) {
-    auto encoder = Make(dst, src, options);
-    return encoder.get() && encoder->encodeRows(src.height());
+    std::unique_ptr<SkPngEncoderMgr> encoderMgr = make_encoder_mgr(dst, src, options);
+    if (!encoderMgr) {
+        return false;
+    }
+
+    if (options.fExecutor || options.fFastFilterSelection) {
+        // The grouped writer filters the rows itself, so it only handles rows that libpng would
+        // write as they are, e.g. not those it has been told to drop a filler channel from.
+        png_structp pngPtr = encoderMgr->pngPtr();
+        png_infop infoPtr = encoderMgr->infoPtr();
+        size_t rowBytes = png_get_rowbytes(pngPtr, infoPtr);
+        size_t bitsPerPixel =
+                png_get_channels(pngPtr, infoPtr) * png_get_bit_depth(pngPtr, infoPtr);
+        if (src.height() > 0 && encoderMgr->proc() &&
+            rowBytes == (size_t)(encoderMgr->pngBytesPerPixel() * src.width())) {
+            GroupedImageWriter writer(encoderMgr.get(), src, options, rowBytes,
+                                      std::max<size_t>(1, bitsPerPixel / 8));
+            return writer.write(options.fExecutor);
+        }
+    }
+
+    SkPngEncoderImpl encoder(std::move(encoderMgr), src);
+    return encoder.encodeRows(src.height());
 }
 
 sk_sp<SkData> Encode(GrDirectContext* ctx, const SkImage* img, const Options& options) {
@@ -51,8 +51,33 @@ static int stream_writer(const uint8_t* data, size_t data_size, const WebPPictur
 
 using WebPPictureImportProc = int (*)(WebPPicture* picture, const uint8_t* pixels, int stride);
 
+static bool init_webp_config(WebPConfig* webp_config, const SkWebpEncoder::Options& opts) {
+    if (!WebPConfigPreset(webp_config, WEBP_PRESET_DEFAULT, opts.fQuality)) {
+        return false;
+    }
+
+    // Set compression and method.
+    // The default choices of |webp_config.method| currently just match Chrome's defaults.
+    if (SkWebpEncoder::Compression::kLossy == opts.fCompression) {
+        webp_config->lossless = 0;
+#ifndef SK_WEBP_ENCODER_USE_DEFAULT_METHOD
+        webp_config->method = 3;
+#endif
+        webp_config->partitions = opts.fPartitions;
+    } else {
+        webp_config->lossless = 1;
+        webp_config->method = 0;
+    }
+    if (opts.fMethod >= 0) {
+        webp_config->method = opts.fMethod;
+    }
+    webp_config->thread_level = opts.fUseThreads ? 1 : 0;
+
+    // Rejects out of range methods, partitions and qualities.
+    return WebPValidateConfig(webp_config);
+}
+
 static bool preprocess_webp_picture(WebPPicture* pic,
-                                    WebPConfig* webp_config,
                                     const SkPixmap& pixmap,
                                     const SkWebpEncoder::Options& opts) {
     if (!SkPixmapIsValid(pixmap)) {
@@ -72,21 +97,9 @@ static bool preprocess_webp_picture(WebPPicture* pic,
     pic->width = pixmap.width();
     pic->height = pixmap.height();
 
-    // Set compression, method, and pixel format.
+    // Set pixel format.
     // libwebp recommends using BGRA for lossless and YUV for lossy.
-    // The choices of |webp_config.method| currently just match Chrome's defaults.  We
-    // could potentially expose this decision to the client.
-    if (SkWebpEncoder::Compression::kLossy == opts.fCompression) {
-        webp_config->lossless = 0;
-#ifndef SK_WEBP_ENCODER_USE_DEFAULT_METHOD
-        webp_config->method = 3;
-#endif
-        pic->use_argb = 0;
-    } else {
-        webp_config->lossless = 1;
-        webp_config->method = 0;
-        pic->use_argb = 1;
-    }
+    pic->use_argb = SkWebpEncoder::Compression::kLossless == opts.fCompression ? 1 : 0;
 
     {
         const SkColorType ct = pixmap.colorType();
@@ -133,7 +146,7 @@ bool Encode(SkWStream* stream, const SkPixmap& pixmap, const Options& opts) {
     }
 
     WebPConfig webp_config;
-    if (!WebPConfigPreset(&webp_config, WEBP_PRESET_DEFAULT, opts.fQuality)) {
+    if (!init_webp_config(&webp_config, opts)) {
         return false;
     }
 
@@ -143,7 +156,7 @@ bool Encode(SkWStream* stream, const SkPixmap& pixmap, const Options& opts) {
     }
     SkAutoTCallVProc<WebPPicture, WebPPictureFree> autoPic(&pic);
 
-    if (!preprocess_webp_picture(&pic, &webp_config, pixmap, opts)) {
+    if (!preprocess_webp_picture(&pic, pixmap, opts)) {
         return false;
     }
 
@@ -195,6 +208,12 @@ bool EncodeAnimated(SkWStream* stream, SkSpan<const SkEncoder::Frame> frames, co
     const int canvasHeight = frames.front().pixmap.height();
     int timestamp = 0;
 
+    // Every frame is encoded with the same config.
+    WebPConfig webp_config;
+    if (!init_webp_config(&webp_config, opts)) {
+        return false;
+    }
+
     std::unique_ptr<WebPAnimEncoder, void (*)(WebPAnimEncoder*)> enc(
             WebPAnimEncoderNew(canvasWidth, canvasHeight, nullptr), WebPAnimEncoderDelete);
     if (!enc) {
@@ -208,25 +227,18 @@ bool EncodeAnimated(SkWStream* stream, SkSpan<const SkEncoder::Frame> frames, co
             return false;
         }
 
-        WebPConfig webp_config;
-        if (!WebPConfigPreset(&webp_config, WEBP_PRESET_DEFAULT, opts.fQuality)) {
-            return false;
-        }
-
         WebPPicture pic;
         if (!WebPPictureInit(&pic)) {
             return false;
         }
         SkAutoTCallVProc<WebPPicture, WebPPictureFree> autoPic(&pic);
 
-        if (!preprocess_webp_picture(&pic, &webp_config, pixmap, opts)) {
-            return false;
-        }
-
-        if (!WebPEncode(&webp_config, &pic)) {
+        if (!preprocess_webp_picture(&pic, pixmap, opts)) {
             return false;
         }
 
+        // WebPAnimEncoderAdd() encodes the picture itself, against the previous frame, so
+        // there's no need to WebPEncode() it first.
         if (!WebPAnimEncoderAdd(enc.get(), &pic, timestamp, &webp_config)) {
             return false;
         }
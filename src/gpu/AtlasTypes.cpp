@@ -10,6 +10,8 @@
 #include "include/private/base/SkMalloc.h"
 #include "src/core/SkSwizzlePriv.h"
 
+#include <cstring>
+
 namespace skgpu {
 
 Plot::Plot(int pageIndex, int plotIndex, AtlasGenerationCounter* generationCounter,
@@ -91,6 +93,26 @@ bool Plot::addSubImage(int width, int height, const void* image, AtlasLocator* a
     return true;
 }
 
+void Plot::copySubImagesFrom(const Plot& src) {
+    SkASSERT(fWidth == src.fWidth && fHeight == src.fHeight);
+    SkASSERT(fBytesPerPixel == src.fBytesPerPixel);
+    SkASSERT(fColorType == src.fColorType);
+
+    fRectanizer.copyFrom(src.fRectanizer);
+    fFlushesSinceLastUse = src.fFlushesSinceLastUse;
+    if (!src.fData) {
+        return;
+    }
+    const size_t size = fBytesPerPixel * fWidth * fHeight;
+    if (!fData) {
+        fData = reinterpret_cast<unsigned char*>(sk_malloc_throw(size));
+    }
+    memcpy(fData, src.fData, size);
+
+    fDirtyRect.setWH(fWidth, fHeight);
+    SkDEBUGCODE(fDirty = true;)
+}
+
 std::pair<const void*, SkIRect> Plot::prepareForUpload() {
     // We should only be issuing uploads if we are dirty
     SkASSERT(fDirty);
@@ -134,4 +156,23 @@ void Plot::resetRects() {
     SkDEBUGCODE(fDirty = false;)
 }
 
+void PlotRelocations::add(const Plot& from, const Plot& to) {
+    SkASSERT(from.genID() < to.genID());
+    fRelocations.set(from.genID(), {to.plotLocator(),
+                                    SkTo<int16_t>(to.offset().fX - from.offset().fX),
+                                    SkTo<int16_t>(to.offset().fY - from.offset().fY)});
+}
+
+bool PlotRelocations::forward(AtlasLocator* atlasLocator) const {
+    bool moved = false;
+    // A moved plot's new home may itself have been moved since. Every move goes to a plot with a
+    // newer genID, so this always ends.
+    while (const Relocation* relocation = fRelocations.find(atlasLocator->genID())) {
+        atlasLocator->offsetRect(relocation->fDX, relocation->fDY);
+        atlasLocator->updatePlotLocator(relocation->fTo);
+        moved = true;
+    }
+    return moved;
+}
+
 } // namespace skgpu
@@ -18,6 +18,7 @@
 #include "include/private/base/SkTo.h"
 #include "src/base/SkTInternalLList.h"
 #include "src/core/SkIPoint16.h"
+#include "src/core/SkTHash.h"
 #include "src/gpu/RectanizerSkyline.h"
 
 class GrOpFlushState;
@@ -336,6 +337,14 @@ public:
         fUVs[2] = (fUVs[2] & 0x1FFF) | page;
     }
 
+    // Move the bounds by (dx, dy) within the page, leaving the page index alone.
+    void offsetRect(int dx, int dy) {
+        fUVs[0] = (fUVs[0] & 0xE000) | ((fUVs[0] & 0x1FFF) + dx);
+        fUVs[1] += dy;
+        fUVs[2] = (fUVs[2] & 0xE000) | ((fUVs[2] & 0x1FFF) + dx);
+        fUVs[3] += dy;
+    }
+
     void updateRect(skgpu::IRect16 rect) {
         SkASSERT(rect.fLeft <= rect.fRight);
         SkASSERT(rect.fRight <= 0x1FFF);
@@ -447,9 +456,19 @@ public:
         return fPlotLocator;
     }
     SkDEBUGCODE(size_t bpp() const { return fBytesPerPixel; })
+    /** The offset of the plot in the backing texture. */
+    SkIPoint16 offset() const { return fOffset; }
 
     bool addSubImage(int width, int height, const void* image, AtlasLocator* atlasLocator);
 
+    /**
+     * Take over the subimages of src, which must have the same dimensions and format, at the same
+     * positions relative to the plot. The whole plot is left dirty, so it will be uploaded to its
+     * new place in the atlas. This is used to compact an atlas without re-adding every subimage;
+     * the caller is expected to evict src afterwards.
+     */
+    void copySubImagesFrom(const Plot& src);
+
     /**
      * To manage the lifetime of a plot, we use two tokens. We use the last upload token to
      * know when we can 'piggy back' uploads, i.e. if the last upload hasn't been flushed to
@@ -516,6 +535,51 @@ private:
 
 typedef SkTInternalLList<Plot> PlotList;
 
+/**
+ * When an atlas compacts, it may move the subimages of a plot into another plot rather than evict
+ * them. PlotRelocations remembers where each moved plot went, so that a client holding a locator
+ * into the old plot can forward it to the new one instead of adding its subimage all over again.
+ */
+class PlotRelocations {
+public:
+    void add(const Plot& from, const Plot& to);
+
+    /**
+     * If the plot that atlasLocator refers to was moved, point atlasLocator at where its subimage
+     * is now and return true. The caller must still check that the plot it now refers to is
+     * current, as that plot may since have been evicted in turn.
+     */
+    bool forward(AtlasLocator*) const;
+
+    /** Forget every relocation that no longer leads to a plot for which isCurrent() is true. */
+    template <typename Fn>  // bool isCurrent(PlotLocator)
+    void prune(Fn&& isCurrent) {
+        skia_private::STArray<8, uint64_t> stale;
+        fRelocations.foreach([&](uint64_t genID, const Relocation& relocation) {
+            PlotLocator to = relocation.fTo;
+            while (const Relocation* next = fRelocations.find(to.genID())) {
+                to = next->fTo;
+            }
+            if (!isCurrent(to)) {
+                stale.push_back(genID);
+            }
+        });
+        for (uint64_t genID : stale) {
+            fRelocations.remove(genID);
+        }
+    }
+
+    int count() const { return fRelocations.count(); }
+
+private:
+    struct Relocation {
+        PlotLocator fTo;
+        int16_t fDX, fDY;
+    };
+    // Keyed by the genID of the plot that was moved, which no other plot will ever have.
+    skia_private::THashMap<uint64_t, Relocation> fRelocations;
+};
+
 } // namespace skgpu
 
 #endif // skgpu_AtlasTypes_DEFINED
@@ -11,6 +11,7 @@
 #include "src/base/SkMathPriv.h"
 #include "src/core/SkRuntimeEffectPriv.h"
 
+#include <algorithm>
 #include <array>
 
 namespace skgpu {
@@ -294,4 +295,90 @@ const SkRuntimeEffect* GetBlur2DEffect(const SkISize& radii) {
     return get_effect(kernelArea, make2DEffect);
 }
 
+namespace {
+
+// Per-axis variance contributed by one downsample and one upsample pass at the finest level, in
+// units of that level's texels. The down pass is a 2x2 box (0.25) plus diagonal taps at +/-o with
+// total weight 1/2 (o^2/2); the up pass is evaluated in half-resolution texels, so its o^2/3
+// scales by 4. Each coarser level contributes 4x as much, so N levels sum to (4^N-1)/3 times this.
+float dual_filter_level_variance(float offset) {
+    return 0.25f + (0.5f + 4.f/3.f) * offset * offset;
+}
+
+float dual_filter_offset(float sigma, int passes) {
+    const float levelScale = ((1 << (2*passes)) - 1) / 3.f;
+    const float offsetSqrd = (sigma*sigma / levelScale - 0.25f) / (0.5f + 4.f/3.f);
+    return offsetSqrd > 0.f ? std::min(sk_float_sqrt(offsetSqrd), kMaxDualFilterOffset) : -1.f;
+}
+
+} // anonymous namespace
+
+bool ComputeDualFilterBlurParams(SkSize sigma, DualFilterBlurParams* params) {
+    SkASSERT(params);
+    const float maxSigma = std::max(sigma.width(), sigma.height());
+    if (std::min(sigma.width(), sigma.height()) <= kMaxLinearBlurSigma) {
+        return false;
+    }
+
+    // Use the fewest passes whose maximum offset can reach the larger sigma; more passes with
+    // smaller offsets look smoother but cost an extra pair of render passes each.
+    const float maxLevelVariance = dual_filter_level_variance(kMaxDualFilterOffset);
+    int passes = 1;
+    while (passes < kMaxDualFilterPasses &&
+           ((1 << (2*passes)) - 1) / 3.f * maxLevelVariance < maxSigma * maxSigma) {
+        ++passes;
+    }
+
+    const float offsetX = dual_filter_offset(sigma.width(), passes);
+    const float offsetY = dual_filter_offset(sigma.height(), passes);
+    if (offsetX < 0.f || offsetY < 0.f) {
+        // The smaller sigma is below what 'passes' levels of downsampling produce on their own.
+        return false;
+    }
+
+    params->fPasses = passes;
+    params->fOffset = {offsetX, offsetY};
+    return true;
+}
+
+const SkRuntimeEffect* GetDualFilterDownEffect() {
+    static const SkRuntimeEffect* effect = SkMakeRuntimeEffect(SkRuntimeEffect::MakeForShader,
+            "uniform half2 offset;"
+            "uniform shader child;"
+
+            "half4 main(float2 coord) {"
+                // Each output texel is centered on the corner shared by four input texels, so
+                // the center tap is a 2x2 box filter when 'child' is linearly sampled.
+                "float2 c = 2*coord;"
+                "half4 sum = 4*child.eval(c);"
+                "sum += child.eval(c + float2(-offset.x, -offset.y));"
+                "sum += child.eval(c + float2( offset.x, -offset.y));"
+                "sum += child.eval(c + float2(-offset.x,  offset.y));"
+                "sum += child.eval(c + float2( offset.x,  offset.y));"
+                "return sum / 8;"
+            "}");
+    return effect;
+}
+
+const SkRuntimeEffect* GetDualFilterUpEffect() {
+    static const SkRuntimeEffect* effect = SkMakeRuntimeEffect(SkRuntimeEffect::MakeForShader,
+            "uniform half2 offset;"
+            "uniform shader child;"
+
+            "half4 main(float2 coord) {"
+                "float2 c = 0.5*coord;"
+                "half4 sum = child.eval(c + float2(-offset.x, 0));"
+                "sum += child.eval(c + float2(offset.x, 0));"
+                "sum += child.eval(c + float2(0, -offset.y));"
+                "sum += child.eval(c + float2(0,  offset.y));"
+                "float2 h = 0.5*offset;"
+                "sum += 2*child.eval(c + float2(-h.x, -h.y));"
+                "sum += 2*child.eval(c + float2( h.x, -h.y));"
+                "sum += 2*child.eval(c + float2(-h.x,  h.y));"
+                "sum += 2*child.eval(c + float2( h.x,  h.y));"
+                "return sum / 12;"
+            "}");
+    return effect;
+}
+
 } // namespace skgpu
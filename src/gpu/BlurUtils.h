@@ -141,6 +141,38 @@ void Compute1DBlurLinearKernel(float sigma,
                                int radius,
                                std::array<SkV4, kMaxBlurSamples/2>& offsetsAndKernel);
 
+// Dual-filter ("dual Kawase") blurs approximate a large Gaussian by repeatedly downsampling the
+// input by 2x with a 5-tap filter and then upsampling it back with an 8-tap filter. The cost is
+// independent of sigma (beyond the number of passes, which grows with log2(sigma)), but the result
+// only approximates the Gaussian distribution. It is intended for large backdrop-style blurs
+// where exact fidelity is less important than GPU time.
+//
+// Sigmas at or below kMaxLinearBlurSigma are cheap enough with the Gaussian effects above, so the
+// dual filter is only used beyond that.
+static constexpr int kMaxDualFilterPasses = 8;
+// Tap offsets, in source texels of each pass, above this start to show sampling artifacts.
+static constexpr float kMaxDualFilterOffset = 2.f;
+
+struct DualFilterBlurParams {
+    // Number of downsample passes; the same number of upsample passes follow.
+    int fPasses = 0;
+    // Per-axis tap offset, in source texels of each pass.
+    SkV2 fOffset = {0.f, 0.f};
+};
+
+// Chooses the pass count and tap offsets that best approximate a Gaussian blur of 'sigma'. Returns
+// false if the dual filter cannot approximate 'sigma' (e.g. it is too small, or the two axes are
+// too anisotropic to share a pass count), in which case the regular Gaussian should be used.
+bool ComputeDualFilterBlurParams(SkSize sigma, DualFilterBlurParams* params);
+
+// Return runtime effects for the downsample and upsample passes of a dual-filter blur. Both have
+// a 'child' shader that should be bound to the previous pass with linear sampling, and a half2
+// 'offset' uniform set to DualFilterBlurParams::fOffset. The down effect reads 'child' at twice
+// its output coordinates and the up effect reads it at half its output coordinates, so each pass
+// should be drawn into a target whose size is half (or double) the dimensions of its input.
+const SkRuntimeEffect* GetDualFilterDownEffect();
+const SkRuntimeEffect* GetDualFilterUpEffect();
+
 } // namespace skgpu
 
 #endif // skgpu_BlurUtils_DEFINED
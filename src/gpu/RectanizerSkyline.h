@@ -33,6 +33,13 @@ public:
 
     bool addRect(int w, int h, SkIPoint16* loc) final;
 
+    // Take on the packing of another skyline with the same dimensions.
+    void copyFrom(const RectanizerSkyline& that) {
+        SkASSERT(this->width() == that.width() && this->height() == that.height());
+        fSkyline = that.fSkyline;
+        fAreaSoFar = that.fAreaSoFar;
+    }
+
     float percentFull() const final {
         return fAreaSoFar / ((float)this->width() * this->height());
     }
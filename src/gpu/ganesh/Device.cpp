@@ -76,6 +76,7 @@
 #include "src/gpu/ganesh/GrFragmentProcessor.h"
 #include "src/gpu/ganesh/GrFragmentProcessors.h"
 #include "src/gpu/ganesh/GrImageInfo.h"
+#include "src/gpu/ganesh/GrOpsTypes.h"
 #include "src/gpu/ganesh/GrPaint.h"
 #include "src/gpu/ganesh/GrProxyProvider.h"
 #include "src/gpu/ganesh/GrRecordingContextPriv.h"
@@ -615,6 +616,50 @@ void Device::drawEdgeAAQuad(const SkRect& rect,
     }
 }
 
+void Device::drawEdgeAARectSet(const SkRect rects[],
+                               const SkColor4f colors[],
+                               int count,
+                               const int matrixIndices[],
+                               const SkMatrix preViewMatrices[],
+                               SkCanvas::QuadAAFlags aaFlags,
+                               SkBlendMode mode) {
+    ASSERT_SINGLE_OWNER
+    GR_CREATE_TRACE_MARKER_CONTEXT("skgpu::ganesh::Device", "drawEdgeAARectSet", fContext.get());
+
+    GrPaint grPaint;
+    if (mode != SkBlendMode::kSrcOver) {
+        grPaint.setXPFactory(GrXPFactory::FromBlendMode(mode));
+    }
+    const GrQuadAAFlags grAAFlags = SkToGrQuadAAFlags(aaFlags);
+
+    // Runs of entries that share a pre-view matrix go to drawQuadSet() together, which packs them
+    // into as few FillRectOps as it can. Huge sets are passed in pieces to bound the scratch space.
+    static constexpr int kMaxQuadsPerCall = 1024;
+    skia_private::TArray<GrQuadSetEntry> quads(std::min(count, kMaxQuadsPerCall));
+    auto matrixIndex = [&](int i) { return matrixIndices ? std::max(matrixIndices[i], -1) : -1; };
+    for (int start = 0; start < count;) {
+        const int index = matrixIndex(start);
+        int end = start + 1;
+        while (end < count && end - start < kMaxQuadsPerCall && matrixIndex(end) == index) {
+            ++end;
+        }
+
+        quads.clear();
+        for (int i = start; i < end; ++i) {
+            SkPMColor4f color =
+                    SkColor4fPrepForDst(colors[i], fSurfaceDrawContext->colorInfo()).premul();
+            quads.push_back({rects[i].makeSorted(), color, SkMatrix::I(), grAAFlags});
+        }
+        SkASSERT(index < 0 || preViewMatrices);
+        const SkMatrix viewMatrix =
+                index >= 0 ? SkMatrix::Concat(this->localToDevice(), preViewMatrices[index])
+                           : this->localToDevice();
+        fSurfaceDrawContext->drawQuadSet(this->clip(), GrPaint::Clone(grPaint), viewMatrix,
+                                         quads.data(), quads.size());
+        start = end;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 void Device::drawRRect(const SkRRect& rrect, const SkPaint& paint) {
@@ -12,6 +12,7 @@
 #include "src/gpu/ganesh/GrBaseContextPriv.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrContextThreadSafeProxyPriv.h"
+#include "src/gpu/ganesh/GrProgramDescInterner.h"
 #include "src/gpu/ganesh/GrThreadSafeCache.h"
 #include "src/gpu/ganesh/GrThreadSafePipelineBuilder.h"
 #include "src/gpu/ganesh/effects/GrSkSLFP.h"
@@ -41,6 +42,7 @@ void GrContextThreadSafeProxy::init(sk_sp<const GrCaps> caps,
     fTextBlobRedrawCoordinator =
             std::make_unique<sktext::gpu::TextBlobRedrawCoordinator>(fContextID);
     fThreadSafeCache = std::make_unique<GrThreadSafeCache>();
+    fProgramDescInterner = std::make_unique<GrProgramDescInterner>();
     fPipelineBuilder = std::move(pipelineBuilder);
 }
 
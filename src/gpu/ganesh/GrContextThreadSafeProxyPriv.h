@@ -44,6 +44,9 @@ public:
     GrThreadSafeCache* threadSafeCache() { return fProxy->fThreadSafeCache.get(); }
     const GrThreadSafeCache* threadSafeCache() const { return fProxy->fThreadSafeCache.get(); }
 
+    // Shared by all the DDL recorders made from this proxy.
+    GrProgramDescInterner* programDescInterner() { return fProxy->fProgramDescInterner.get(); }
+
     void abandonContext() { fProxy->abandonContext(); }
     bool abandoned() const { return fProxy->abandoned(); }
 
@@ -6,11 +6,11 @@
  */
 
 #include "include/gpu/GrRecordingContext.h"
-#include "src/core/SkChecksum.h"
-#include "src/core/SkLRUCache.h"
+#include "src/core/SkTHash.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrContextThreadSafeProxyPriv.h"
 #include "src/gpu/ganesh/GrProgramDesc.h"
+#include "src/gpu/ganesh/GrProgramDescInterner.h"
 #include "src/gpu/ganesh/GrProgramInfo.h"
 #include "src/gpu/ganesh/GrRecordingContextPriv.h"
 #include "src/gpu/ganesh/effects/GrSkSLFP.h"
@@ -53,60 +53,26 @@ private:
             return;
         }
 
-        fProgramInfoMap.add(desc, programInfo);
+        const GrProgramDesc* interned =
+                fThreadSafeProxy->priv().programDescInterner()->intern(desc);
+        if (!fRecordedDescs.contains(interned)) {
+            fRecordedDescs.add(interned);
+            fProgramData.emplace_back(interned, programInfo);
+        }
     }
 
     void detachProgramData(TArray<ProgramData>* dst) final {
         SkASSERT(dst->empty());
 
-        fProgramInfoMap.toArray(dst);
+        dst->swap(fProgramData);
+        fRecordedDescs.reset();
     }
 
-
-private:
-    class ProgramInfoMap : public ::SkNoncopyable {
-        typedef const GrProgramDesc  CacheKey;
-        typedef const GrProgramInfo* CacheValue;
-
-    public:
-        // All the programInfo data should be stored in the record-time arena so there is no
-        // need to ref them here or to delete them in the destructor.
-        ProgramInfoMap() : fMap(10) {}
-        ~ProgramInfoMap() {}
-
-        // TODO: this is doing a lot of reallocating of the ProgramDesc! Once the program descs
-        // are allocated in the record-time area there won't be a problem.
-        void add(CacheKey& desc, const GrProgramInfo* programInfo) {
-            SkASSERT(desc.isValid());
-
-            const CacheValue* preExisting = fMap.find(desc);
-            if (preExisting) {
-                return;
-            }
-
-            fMap.insert(desc, programInfo);
-        }
-
-        void toArray(TArray<ProgramData>* dst) {
-            fMap.foreach([dst](CacheKey* programDesc, CacheValue* programInfo) {
-                             // TODO: remove this allocation once the program descs are stored
-                             // in the record-time arena.
-                             dst->emplace_back(std::make_unique<const GrProgramDesc>(*programDesc),
-                                               *programInfo);
-                         });
-        }
-
-    private:
-        struct DescHash {
-            uint32_t operator()(CacheKey& desc) const {
-                return SkChecksum::Hash32(desc.asKey(), desc.keyLength());
-            }
-        };
-
-        SkLRUCache<CacheKey, CacheValue, DescHash> fMap;
-    };
-
-    ProgramInfoMap fProgramInfoMap;
+    // All the programInfo data is stored in the record-time arena and the descs are owned by the
+    // thread safe proxy's interner, so there is nothing to ref or delete here. Since interned descs
+    // are unique, they can be deduped by address.
+    THashSet<const GrProgramDesc*> fRecordedDescs;
+    TArray<ProgramData> fProgramData;
 
     using INHERITED = GrRecordingContext;
 };
@@ -25,6 +25,7 @@
 #include "src/base/SkAutoMalloc.h"
 #include "src/core/SkCompressedDataUtils.h"
 #include "src/core/SkMipmap.h"
+#include "src/core/SkReadBuffer.h"
 #include "src/core/SkTaskGroup.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/GpuTypesPriv.h"
@@ -41,6 +42,7 @@
 #include "src/gpu/ganesh/GrDrawOpAtlas.h"
 #include "src/gpu/ganesh/GrDrawingManager.h"
 #include "src/gpu/ganesh/GrGpu.h"
+#include "src/gpu/ganesh/GrPersistentCacheUtils.h"
 #include "src/gpu/ganesh/GrPixmap.h"
 #include "src/gpu/ganesh/GrProxyProvider.h"
 #include "src/gpu/ganesh/GrRenderTargetProxy.h"
@@ -388,6 +390,23 @@ void GrDirectContext::performDeferredCleanup(std::chrono::milliseconds msNotUsed
     this->getTextBlobRedrawCoordinator()->purgeStaleBlobs();
 }
 
+void GrDirectContext::onMemoryPressure(GrMemoryPressureLevel level) {
+    ASSERT_SINGLE_OWNER
+
+    if (this->abandoned()) {
+        return;
+    }
+
+    if (level == GrMemoryPressureLevel::kCritical) {
+        this->freeGpuResources();
+        return;
+    }
+
+    fResourceCache->purgeForMemoryPressure(level);
+    fGpu->releaseUnlockedBackendObjects();
+    this->getTextBlobRedrawCoordinator()->purgeStaleBlobs();
+}
+
 void GrDirectContext::purgeUnlockedResources(size_t bytesToPurge, bool preferScratchResources) {
     ASSERT_SINGLE_OWNER
 
@@ -1134,6 +1153,45 @@ bool GrDirectContext::precompileShader(const SkData& key, const SkData& data) {
     return fGpu->precompileShader(key, data);
 }
 
+sk_sp<SkData> GrDirectContext::MakeShaderManifest(const sk_sp<SkData> keys[],
+                                                  const sk_sp<SkData> data[],
+                                                  int count) {
+    for (int i = 0; i < count; ++i) {
+        if (!keys[i] || !data[i]) {
+            return nullptr;
+        }
+    }
+    return GrPersistentCacheUtils::PackShaderManifest(keys, data, count);
+}
+
+int GrDirectContext::precompileShaders(const SkData& manifest, int firstEntry, int maxEntries) {
+    ASSERT_SINGLE_OWNER
+    if (this->abandoned() || firstEntry < 0 || maxEntries <= 0) {
+        return 0;
+    }
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
+
+    SkReadBuffer reader(manifest.data(), manifest.size());
+    int count = GrPersistentCacheUtils::ReadShaderManifestHeader(&reader);
+    if (firstEntry >= count) {
+        return 0;
+    }
+    sk_sp<SkData> key, data;
+    for (int i = 0; i < firstEntry; ++i) {
+        if (!GrPersistentCacheUtils::ReadShaderManifestEntry(&reader, &key, &data)) {
+            return 0;
+        }
+    }
+    int visited = 0;
+    for (; visited < maxEntries && firstEntry + visited < count; ++visited) {
+        if (!GrPersistentCacheUtils::ReadShaderManifestEntry(&reader, &key, &data)) {
+            break;
+        }
+        fGpu->precompileShader(*key, *data);
+    }
+    return visited;
+}
+
 #ifdef SK_ENABLE_DUMP_GPU
 #include "include/core/SkString.h"
 #include "src/utils/SkJSONWriter.h"
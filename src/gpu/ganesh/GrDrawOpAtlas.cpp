@@ -177,6 +177,18 @@ inline bool GrDrawOpAtlas::updatePlot(GrDeferredUploadTarget* target,
     return true;
 }
 
+bool GrDrawOpAtlas::forwardLocator(GrDeferredUploadTarget* target, AtlasLocator* atlasLocator) {
+    if (!fRelocations.forward(atlasLocator) || !this->hasID(atlasLocator->plotLocator())) {
+        return false;
+    }
+    Plot* plot = fPages[atlasLocator->pageIndex()].fPlotArray[atlasLocator->plotIndex()].get();
+    if (plot->needsUpload()) {
+        return this->updatePlot(target, atlasLocator, plot);
+    }
+    this->makeMRU(plot, plot->pageIndex());
+    return true;
+}
+
 bool GrDrawOpAtlas::uploadToPage(unsigned int pageIdx, GrDeferredUploadTarget* target, int width,
                                  int height, const void* image, AtlasLocator* atlasLocator) {
     SkASSERT(fViews[pageIdx].proxy() && fViews[pageIdx].proxy()->isInstantiated());
@@ -420,7 +432,7 @@ void GrDrawOpAtlas::compact(AtlasToken startTokenForNextFlush) {
         }
 
         // If recently used plots in the last page are using less than a quarter of the page, try
-        // to evict them if there's available space in earlier pages. Since we prioritize uploading
+        // to move them if there's available space in earlier pages. Since we prioritize uploading
         // to the first pages, this will eventually clear out usage of this page unless we have a
         // large need.
         if (availablePlots.size() && usedPlots && usedPlots <= fNumPlots / 4) {
@@ -428,12 +440,11 @@ void GrDrawOpAtlas::compact(AtlasToken startTokenForNextFlush) {
             while (Plot* plot = plotIter.get()) {
                 // If this plot was used recently
                 if (plot->flushesSinceLastUsed() <= kPlotRecentlyUsedCount) {
-                    // See if there's room in an earlier page and if so evict.
+                    // See if there's room in an earlier page and if so move the plot there.
                     // We need to be somewhat harsh here so that a handful of plots that are
                     // consistently in use don't end up locking the page in memory.
                     if (availablePlots.size() > 0) {
-                        this->processEvictionAndResetRects(plot);
-                        this->processEvictionAndResetRects(availablePlots.back());
+                        this->relocatePlot(plot, availablePlots.back());
                         availablePlots.pop_back();
                         --usedPlots;
                     }
@@ -456,9 +467,19 @@ void GrDrawOpAtlas::compact(AtlasToken startTokenForNextFlush) {
         }
     }
 
+    fRelocations.prune([this](PlotLocator plotLocator) { return this->hasID(plotLocator); });
     fPrevFlushToken = startTokenForNextFlush;
 }
 
+void GrDrawOpAtlas::relocatePlot(Plot* from, Plot* to) {
+    SkASSERT(to->pageIndex() < from->pageIndex());
+    this->processEvictionAndResetRects(to);
+    to->copySubImagesFrom(*from);
+    fRelocations.add(*from, *to);
+    this->makeMRU(to, to->pageIndex());
+    this->processEvictionAndResetRects(from);
+}
+
 bool GrDrawOpAtlas::createPages(
         GrProxyProvider* proxyProvider, GenerationCounter* generationCounter) {
     SkASSERT(SkIsPow2(fTextureWidth) && SkIsPow2(fTextureHeight));
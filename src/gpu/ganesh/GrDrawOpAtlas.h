@@ -42,8 +42,9 @@ class GrTextureProxy;
  * determined by using the GrDrawUploadToken system: After a flush each subarea of the page
  * is checked to see whether it was used in that flush. If less than a quarter of the plots have
  * been used recently (within kPlotRecentlyUsedCount iterations) and there are available
- * plots in lower index pages, the higher index page will be deactivated, and its glyphs will
- * gradually migrate to other pages via the usual upload system.
+ * plots in lower index pages, the higher index page will be deactivated. Each recently used plot
+ * on it is moved, subimages and all, into an available plot on a lower page, and clients can
+ * forward their locators to the moved subimages with forwardLocator() rather than add them again.
  *
  * Garbage collection is initiated by the GrDrawOpAtlas's client via the compact() method. One
  * solution is to make the client a subclass of GrOnFlushCallbackObject, register it with the
@@ -125,6 +126,13 @@ public:
         return plot < fNumPlots && page < fNumActivePages && plotGeneration == locatorGeneration;
     }
 
+    /**
+     * If the plot holding atlasLocator's subimage was moved by compact(), point atlasLocator at
+     * the subimage's new place, scheduling an upload of the plot it moved to if need be, and
+     * return true. Returns false if the subimage has to be added to the atlas again.
+     */
+    bool forwardLocator(GrDeferredUploadTarget*, skgpu::AtlasLocator*);
+
     /** To ensure the atlas does not evict a given entry, the client must set the last use token. */
     void setLastUseToken(const skgpu::AtlasLocator& atlasLocator, skgpu::AtlasToken token) {
         SkASSERT(this->hasID(atlasLocator.plotLocator()));
@@ -201,6 +209,7 @@ private:
         this->processEviction(plot->plotLocator());
         plot->resetRects();
     }
+    void relocatePlot(skgpu::Plot* from, skgpu::Plot* to);
 
     GrBackendFormat       fFormat;
     SkColorType           fColorType;
@@ -227,6 +236,7 @@ private:
     int                   fFlushesSinceLastUse;
 
     std::vector<skgpu::PlotEvictionCallback*> fEvictionCallbacks;
+    skgpu::PlotRelocations fRelocations;
 
     struct Page {
         // allocated array of Plots
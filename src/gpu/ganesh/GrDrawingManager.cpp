@@ -15,6 +15,7 @@
 #include "include/gpu/GrRecordingContext.h"
 #include "include/private/chromium/GrDeferredDisplayList.h"
 #include "src/base/SkTInternalLList.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/gpu/ganesh/GrBufferTransferRenderTask.h"
 #include "src/gpu/ganesh/GrBufferUpdateRenderTask.h"
 #include "src/gpu/ganesh/GrClientMappedBufferManager.h"
@@ -119,6 +120,8 @@ bool GrDrawingManager::flush(SkSpan<GrSurfaceProxy*> proxies,
         }
     }
 
+    SkCounters::AutoCountFlush countFlush;
+
     auto dContext = fContext->asDirectContext();
     SkASSERT(dContext);
     dContext->priv().clientMappedBufferManager()->process();
@@ -209,6 +212,7 @@ bool GrDrawingManager::flush(SkSpan<GrSurfaceProxy*> proxies,
     if (cachePurgeNeeded) {
         resourceCache->purgeAsNeeded();
     }
+    resourceCache->didFlush();
     fFlushing = false;
 
     return true;
@@ -417,7 +421,7 @@ bool GrDrawingManager::reorderTasks(GrResourceAllocator* resourceAllocator) {
         if (auto opsTask = task->asOpsTask()) {
             size_t remaining = fDAG.size() - i - 1;
             SkSpan<sk_sp<GrRenderTask>> nextTasks{fDAG.end() - remaining, remaining};
-            int removeCount = opsTask->mergeFrom(nextTasks);
+            int removeCount = opsTask->mergeFrom(nextTasks, *fContext->priv().caps());
             for (const auto& removed : nextTasks.first(removeCount)) {
                 removed->disown(this);
             }
@@ -589,6 +593,7 @@ void GrDrawingManager::moveRenderTasksToDDL(GrDeferredDisplayList* ddl) {
     ddl->fArenas = std::move(fContext->priv().detachArenas());
 
     fContext->priv().detachProgramData(&ddl->fProgramData);
+    ddl->fThreadSafeProxy = fContext->threadSafeProxy();
 
     SkDEBUGCODE(this->validate());
 }
@@ -73,11 +73,13 @@
 #include "src/gpu/ganesh/effects/GrTextureEffect.h"
 #include "src/gpu/ganesh/gradients/GrGradientShader.h"
 #include "src/gpu/ganesh/image/GrImageUtils.h"
+#include "src/shaders/SkAnalyticClipShader.h"
 #include "src/shaders/SkBlendShader.h"
 #include "src/shaders/SkColorFilterShader.h"
 #include "src/shaders/SkColorShader.h"
 #include "src/shaders/SkCoordClampShader.h"
 #include "src/shaders/SkEmptyShader.h"
+#include "src/shaders/SkGainmapApplyShader.h"
 #include "src/shaders/SkImageShader.h"
 #include "src/shaders/SkLocalMatrixShader.h"
 #include "src/shaders/SkPerlinNoiseShaderImpl.h"
@@ -496,6 +498,13 @@ GrFPResult Make(GrRecordingContext* ctx,
     SkUNREACHABLE;
 }
 
+static std::unique_ptr<GrFragmentProcessor> make_shader_fp(const SkAnalyticClipShader*,
+                                                           const GrFPArgs&,
+                                                           const SkShaders::MatrixRec&) {
+    // Only ever used for raster clips.
+    return nullptr;
+}
+
 static std::unique_ptr<GrFragmentProcessor> make_shader_fp(const SkBlendShader* shader,
                                                            const GrFPArgs& args,
                                                            const SkShaders::MatrixRec& mRec) {
@@ -611,6 +620,13 @@ static std::unique_ptr<GrFragmentProcessor> make_shader_fp(const SkEmptyShader*
     return nullptr;
 }
 
+static std::unique_ptr<GrFragmentProcessor> make_shader_fp(const SkGainmapApplyShader* shader,
+                                                           const GrFPArgs& args,
+                                                           const SkShaders::MatrixRec& mRec) {
+    // The runtime effect is already a single program on the GPU.
+    return Make(shader->runtimeShader().get(), args, mRec);
+}
+
 static bool needs_subset(sk_sp<const SkImage> img, const SkRect& subset) {
     return subset != SkRect::Make(img->dimensions());
 }
@@ -668,9 +684,8 @@ static std::unique_ptr<GrFragmentProcessor> make_shader_fp(const SkPerlinNoiseSh
     SkASSERT(!shader->stitchTiles() || !shader->tileSize().isEmpty());
 
     auto paintingData = shader->getPaintingData(totalMatrix);
-    paintingData->generateBitmaps();
 
-    // Like shadeSpan, we start from device space. We will account for that below with a device
+    // Like the raster pipeline, we start from device space. We will account for that below with a device
     // space effect.
 
     auto context = args.fContext;
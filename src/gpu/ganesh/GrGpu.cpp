@@ -14,6 +14,7 @@
 #include "include/gpu/GrDirectContext.h"
 #include "src/base/SkMathPriv.h"
 #include "src/core/SkCompressedDataUtils.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkMipmap.h"
 #include "src/gpu/ganesh/GrAttachment.h"
 #include "src/gpu/ganesh/GrBackendUtils.h"
@@ -506,6 +507,10 @@ bool GrGpu::writePixels(GrSurface* surface,
 
     this->didWriteToSurface(surface, kTopLeft_GrSurfaceOrigin, &rect, mipLevelCount);
     fStats.incTextureUploads();
+    for (int i = 0; i < mipLevelCount; ++i) {
+        SkCounters::Add(SkCounters::Counter::kBytesUploaded,
+                        texels[i].fRowBytes * std::max(rect.height() >> i, 1));
+    }
 
     return true;
 }
@@ -748,6 +753,7 @@ GrOpsRenderPass* GrGpu::getOpsRenderPass(
 }
 
 bool GrGpu::submitToGpu(GrSyncCpu sync) {
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     this->stats()->incNumSubmitToGpus();
 
     if (auto manager = this->stagingBufferManager()) {
@@ -130,4 +130,36 @@ bool UnpackCachedShaders(SkReadBuffer* reader,
     return reader->isValid();
 }
 
+static constexpr SkFourByteTag kShaderManifestTag = SkSetFourByteTag('G', 'R', 'S', 'M');
+
+sk_sp<SkData> PackShaderManifest(const sk_sp<SkData> keys[], const sk_sp<SkData> data[],
+                                 int count) {
+    SkBinaryWriteBuffer writer({});
+    writer.writeUInt(kShaderManifestTag);
+    writer.writeInt(kCurrentVersion);
+    writer.writeInt(count);
+    for (int i = 0; i < count; ++i) {
+        writer.writeDataAsByteArray(keys[i].get());
+        writer.writeDataAsByteArray(data[i].get());
+    }
+    return writer.snapshotAsData();
+}
+
+int ReadShaderManifestHeader(SkReadBuffer* reader) {
+    SkFourByteTag tag = reader->readUInt();
+    int version       = reader->readInt();
+    int count         = reader->readInt();
+    if (!reader->validate(tag == kShaderManifestTag && version == kCurrentVersion &&
+                          count >= 0)) {
+        return -1;
+    }
+    return count;
+}
+
+bool ReadShaderManifestEntry(SkReadBuffer* reader, sk_sp<SkData>* key, sk_sp<SkData>* data) {
+    *key = reader->readByteArrayAsData();
+    *data = reader->readByteArrayAsData();
+    return reader->validate(*key && *data && !(*key)->isEmpty() && !(*data)->isEmpty());
+}
+
 }  // namespace GrPersistentCacheUtils
@@ -46,6 +46,16 @@ bool UnpackCachedShaders(SkReadBuffer* reader,
                          int numInterfaces,
                          ShaderMetadata* meta = nullptr);
 
+// A shader manifest bundles key/data pairs that were given to a GrContextOptions::PersistentCache,
+// so an application can ship the programs it recorded and precompile them at startup.
+sk_sp<SkData> PackShaderManifest(const sk_sp<SkData> keys[], const sk_sp<SkData> data[], int count);
+
+// Returns the number of entries in the manifest, or -1 if the reader doesn't hold one.
+int ReadShaderManifestHeader(SkReadBuffer* reader);
+
+// Reads the next manifest entry, or returns false if the manifest is malformed.
+bool ReadShaderManifestEntry(SkReadBuffer* reader, sk_sp<SkData>* key, sk_sp<SkData>* data);
+
 }  // namespace GrPersistentCacheUtils
 
 #endif
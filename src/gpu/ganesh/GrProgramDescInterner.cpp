@@ -0,0 +1,25 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/gpu/ganesh/GrProgramDescInterner.h"
+
+const GrProgramDesc* GrProgramDescInterner::intern(const GrProgramDesc& desc) {
+    SkASSERT(desc.isValid());
+
+    SkAutoMutexExclusive lock(fMutex);
+    if (const GrProgramDesc* const* interned = fDescs.find(desc)) {
+        return *interned;
+    }
+    const GrProgramDesc* interned = fDescStorage.make<GrProgramDesc>(desc);
+    fDescs.set(interned);
+    return interned;
+}
+
+int GrProgramDescInterner::count() const {
+    SkAutoMutexExclusive lock(fMutex);
+    return fDescs.count();
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef GrProgramDescInterner_DEFINED
+#define GrProgramDescInterner_DEFINED
+
+#include "include/private/base/SkMutex.h"
+#include "include/private/base/SkNoncopyable.h"
+#include "include/private/base/SkThreadAnnotations.h"
+#include "src/base/SkArenaAlloc.h"
+#include "src/core/SkChecksum.h"
+#include "src/core/SkTHash.h"
+#include "src/gpu/ganesh/GrProgramDesc.h"
+
+/**
+ * A thread-safe set of the GrProgramDescs recorded by all the DDL recorders of one
+ * GrContextThreadSafeProxy. When many DDLs are recorded from similar content, e.g. the tiles of
+ * one picture, they mostly need the same programs. Each DDL then refers to the one interned copy
+ * of a desc instead of allocating its own, and can dedupe its program list by pointer.
+ */
+class GrProgramDescInterner : SkNoncopyable {
+public:
+    GrProgramDescInterner() = default;
+
+    // Returns the interned copy of 'desc', which stays valid for the lifetime of this object.
+    const GrProgramDesc* intern(const GrProgramDesc& desc);
+
+    int count() const;
+
+private:
+    struct Traits {
+        static const GrProgramDesc& GetKey(const GrProgramDesc* desc) { return *desc; }
+        static uint32_t Hash(const GrProgramDesc& desc) {
+            return SkChecksum::Hash32(desc.asKey(), desc.keyLength());
+        }
+    };
+
+    mutable SkMutex fMutex;
+    SkArenaAlloc fDescStorage SK_GUARDED_BY(fMutex){16 * sizeof(GrProgramDesc)};
+    skia_private::THashTable<const GrProgramDesc*, GrProgramDesc, Traits> fDescs
+            SK_GUARDED_BY(fMutex);
+};
+
+#endif
@@ -34,14 +34,13 @@ using namespace skia_private;
 
 using TextBlobRedrawCoordinator = sktext::gpu::TextBlobRedrawCoordinator;
 
-GrRecordingContext::ProgramData::ProgramData(std::unique_ptr<const GrProgramDesc> desc,
-                                             const GrProgramInfo* info)
-        : fDesc(std::move(desc))
+GrRecordingContext::ProgramData::ProgramData(const GrProgramDesc* desc, const GrProgramInfo* info)
+        : fDesc(desc)
         , fInfo(info) {
 }
 
 GrRecordingContext::ProgramData::ProgramData(ProgramData&& other)
-        : fDesc(std::move(other.fDesc))
+        : fDesc(other.fDesc)
         , fInfo(other.fInfo) {
 }
 
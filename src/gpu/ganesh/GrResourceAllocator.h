@@ -74,6 +74,17 @@ class GrDirectContext;
  * proxies. If any of these fails, return false.
  *
  * The drawing manager will drop the flush if any proxies fail to instantiate.
+ *
+ *************************************************************************************************
+ * What gets shared?
+ *
+ * Two proxies share a surface only when their intervals don't overlap and their scratch keys
+ * match exactly. Approx-fit proxies round their dimensions up into coarse bins, so most transient
+ * layers can share. But exact-fit proxies of different sizes, or proxies in different formats,
+ * never share, even when one surface would have the memory for both. Doing better would mean
+ * placing surfaces in shared memory heaps (e.g. aliased VkDeviceMemory or MTLHeap), which GrGpu
+ * doesn't expose. It would also break the invariant that a proxy's surface is no bigger than the
+ * proxy's own backing store.
  */
 class GrResourceAllocator {
 public:
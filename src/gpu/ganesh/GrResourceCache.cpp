@@ -8,6 +8,7 @@
 #include "src/gpu/ganesh/GrResourceCache.h"
 #include <atomic>
 #include <vector>
+#include "include/core/SkTraceMemoryDump.h"
 #include "include/gpu/GrDirectContext.h"
 #include "include/private/base/SingleOwner.h"
 #include "include/private/base/SkTo.h"
@@ -128,6 +129,9 @@ void GrResourceCache::removeResource(GrGpuResource* resource) {
         fScratchMap.remove(resource->resourcePriv().getScratchKey(), resource);
     }
     if (resource->getUniqueKey().isValid()) {
+        if (resource->resourcePriv().isPurgeable()) {
+            this->recordEviction(resource);
+        }
         fUniqueHash.remove(resource->getUniqueKey());
     }
     this->validate();
@@ -259,12 +263,15 @@ void GrResourceCache::changeUniqueKey(GrGpuResource* resource, const skgpu::Uniq
             if (!old->resourcePriv().getScratchKey().isValid() &&
                 old->resourcePriv().isPurgeable()) {
                 old->cacheAccess().release();
+                // It is being replaced rather than evicted.
+                fEvictionFlushes.insert_or_update(newKey.hash(), kNotEvicted);
             } else {
                 // removeUniqueKey expects an external owner of the resource.
                 this->removeUniqueKey(sk_ref_sp(old).get());
             }
         }
         SkASSERT(nullptr == fUniqueHash.find(newKey));
+        this->checkForRecreation(newKey);
 
         // Remove the entry for this resource if it already has a unique key.
         if (resource->getUniqueKey().isValid()) {
@@ -629,6 +636,74 @@ void GrResourceCache::purgeUnlockedResources(size_t bytesToPurge, bool preferScr
     }
 }
 
+void GrResourceCache::purgeForMemoryPressure(GrMemoryPressureLevel level) {
+    if (level == GrMemoryPressureLevel::kCritical) {
+        this->purgeUnlockedResources(GrPurgeResourceOptions::kAllResources);
+        return;
+    }
+
+    this->purgeAsNeeded();
+    const size_t targetBytes = fMaxBytes / 2;
+    if (fBudgetedBytes <= targetBytes) {
+        return;
+    }
+
+    enum RecreationCost { kScratch, kUniquelyKeyed, kRecreatedBefore, kLast = kRecreatedBefore };
+    auto recreationCost = [this](GrGpuResource* resource) {
+        const skgpu::UniqueKey& key = resource->getUniqueKey();
+        if (!key.isValid()) {
+            return kScratch;
+        }
+        return fRecreatedKeys.find(key.hash()) ? kRecreatedBefore : kUniquelyKeyed;
+    };
+
+    // Sort the queue so each group is visited in LRU order.
+    fPurgeableQueue.sort();
+
+    // Pick the victims first. Releasing them must be done as a separate pass to avoid messing up
+    // the sorted order of the queue.
+    SkTDArray<GrGpuResource*> victims;
+    size_t budgetedBytes = fBudgetedBytes;
+    for (int cost = kScratch; cost <= kLast && budgetedBytes > targetBytes; ++cost) {
+        for (int i = 0; i < fPurgeableQueue.count() && budgetedBytes > targetBytes; ++i) {
+            GrGpuResource* resource = fPurgeableQueue.at(i);
+            SkASSERT(resource->resourcePriv().isPurgeable());
+            if (recreationCost(resource) != cost) {
+                continue;
+            }
+            *victims.append() = resource;
+            if (GrBudgetedType::kBudgeted == resource->resourcePriv().budgetedType()) {
+                budgetedBytes -= resource->gpuMemorySize();
+            }
+        }
+    }
+    for (GrGpuResource* resource : victims) {
+        resource->cacheAccess().release();
+    }
+
+    this->validate();
+}
+
+void GrResourceCache::recordEviction(const GrGpuResource* resource) {
+    fEvictionFlushes.insert_or_update(resource->getUniqueKey().hash(), fFlushCount);
+}
+
+void GrResourceCache::checkForRecreation(const skgpu::UniqueKey& key) {
+    uint32_t* evictionFlush = fEvictionFlushes.find(key.hash());
+    if (!evictionFlush || *evictionFlush == kNotEvicted) {
+        return;
+    }
+    uint32_t flushesSinceEviction = fFlushCount - *evictionFlush;
+    *evictionFlush = kNotEvicted;
+    if (flushesSinceEviction > kRecreationWindowInFlushes) {
+        return;
+    }
+    ++fNumRecreatedAfterEviction;
+    fRecreatedKeys.insert_or_update(key.hash(), true);
+    SK_HISTOGRAM_EXACT_LINEAR("GPU.ResourceCache.FlushesUntilRecreatedAfterEviction",
+                              flushesSinceEviction, kRecreationWindowInFlushes + 1);
+}
+
 bool GrResourceCache::requestsFlush() const {
     return this->overBudget() && !fPurgeableQueue.count() &&
            fNumBudgetedResourcesFlushWillMakePurgeable > 0;
@@ -727,6 +802,8 @@ void GrResourceCache::dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) c
     for (int i = 0; i < fPurgeableQueue.count(); ++i) {
         fPurgeableQueue.at(i)->dumpMemoryStatistics(traceMemoryDump);
     }
+    traceMemoryDump->dumpNumericValue("skia/gpu_resources/recreated_after_eviction", "count",
+                                      "objects", fNumRecreatedAfterEviction);
 }
 
 #if GR_CACHE_STATS
@@ -14,6 +14,7 @@
 #include "include/private/base/SkTArray.h"
 #include "src/base/SkTDPQueue.h"
 #include "src/base/SkTInternalLList.h"
+#include "src/core/SkLRUCache.h"
 #include "src/core/SkMessageBus.h"
 #include "src/core/SkTHash.h"
 #include "src/core/SkTMultiMap.h"
@@ -201,6 +202,28 @@ public:
      */
     void purgeUnlockedResources(size_t bytesToPurge, bool preferScratchResources);
 
+    /**
+     * With kModerate, purges unlocked resources until the budgeted bytes are at most half of the
+     * budget. Victims are picked in increasing order of estimated re-creation cost: scratch
+     * resources only lose their allocation, uniquely keyed ones lose their contents, and keys that
+     * were recreated soon after an earlier eviction are likely to be needed again. Each group is
+     * purged in LRU order. With kCritical, purges all unlocked resources.
+     */
+    void purgeForMemoryPressure(GrMemoryPressureLevel);
+
+    /** Called at the end of each flush. Used to measure how soon evicted resources come back. */
+    void didFlush() { ++fFlushCount; }
+
+    // A resource given the unique key of one evicted at most this many flushes earlier counts as
+    // recreated after eviction.
+    static constexpr uint32_t kRecreationWindowInFlushes = 60;
+
+    /**
+     * Returns the number of times a uniquely keyed resource was evicted and then recreated within
+     * kRecreationWindowInFlushes flushes, i.e. evictions that were wasted work.
+     */
+    int numRecreatedAfterEviction() const { return fNumRecreatedAfterEviction; }
+
     /** Returns true if the cache would like a flush to occur in order to make more resources
         purgeable. */
     bool requestsFlush() const;
@@ -319,6 +342,11 @@ private:
     void purgeUnlockedResources(const skgpu::StdSteadyClock::time_point* purgeTime,
                                 GrPurgeResourceOptions opts);
 
+    // Remembers the unique key of a resource that is being purged, and notices when a new resource
+    // takes it soon after.
+    void recordEviction(const GrGpuResource*);
+    void checkForRecreation(const skgpu::UniqueKey&);
+
 #ifdef SK_DEBUG
     bool isInCache(const GrGpuResource* r) const;
     void validate() const;
@@ -392,6 +420,16 @@ private:
     size_t                              fPurgeableBytes = 0;
     int                                 fNumBudgetedResourcesFlushWillMakePurgeable = 0;
 
+    // The flush count at which recently evicted uniquely keyed resources were purged, and the keys
+    // that were recreated within the window, both keyed by the unique key's hash. Entries whose
+    // key has been taken again are kNotEvicted.
+    static constexpr int                kMaxTrackedEvictions = 256;
+    static constexpr uint32_t           kNotEvicted = UINT32_MAX;
+    uint32_t                            fFlushCount = 0;
+    SkLRUCache<uint32_t, uint32_t>      fEvictionFlushes{kMaxTrackedEvictions};
+    SkLRUCache<uint32_t, bool>          fRecreatedKeys{kMaxTrackedEvictions};
+    int                                 fNumRecreatedAfterEviction = 0;
+
     InvalidUniqueKeyInbox               fInvalidUniqueKeyInbox;
     UnrefResourceMessage::Bus::Inbox    fUnrefResourceInbox;
 
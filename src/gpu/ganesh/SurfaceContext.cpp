@@ -1321,12 +1321,15 @@ SurfaceContext::PixelTransferResult SurfaceContext::transferPixels(GrColorType d
     rowBytes = SkAlignTo(rowBytes, this->caps()->transferBufferRowBytesAlignment());
     size_t size = rowBytes * rect.height();
     // By using kStream_GrAccessPattern here, we are not able to cache and reuse the buffer for
-    // multiple reads. Switching to kDynamic_GrAccessPattern would allow for this, however doing
-    // so causes a crash in a chromium test. See skbug.com/11297
+    // multiple reads. Switching to kDynamic_GrAccessPattern allows for this, however doing so
+    // by default causes a crash in a chromium test. See skbug.com/11297
+    GrAccessPattern accessPattern = direct->priv().options().fRecycleReadbackTransferBuffers
+                                            ? kDynamic_GrAccessPattern
+                                            : kStream_GrAccessPattern;
     auto buffer = direct->priv().resourceProvider()->createBuffer(
             size,
             GrGpuBufferType::kXferGpuToCpu,
-            GrAccessPattern::kStream_GrAccessPattern,
+            accessPattern,
             GrResourceProvider::ZeroInit::kNo);
     if (!buffer) {
         return {};
@@ -20,6 +20,7 @@
 #include "src/core/SkAutoPixmapStorage.h"
 #include "src/core/SkBlendModePriv.h"
 #include "src/core/SkConvertPixels.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkDrawProcs.h"
 #include "src/core/SkDrawShadowInfo.h"
 #include "src/core/SkLatticeIter.h"
@@ -1917,6 +1918,7 @@ void SurfaceDrawContext::addDrawOp(const GrClip* clip,
     GrDrawOp* drawOp = (GrDrawOp*)op.get();
     SkDEBUGCODE(this->validate();)
     SkDEBUGCODE(drawOp->fAddDrawOpCalled = true;)
+    SkCounters::Add(SkCounters::Counter::kOpsBuilt);
     GR_CREATE_TRACE_MARKER_CONTEXT("SurfaceDrawContext", "addDrawOp", fContext);
 
     // Setup clip
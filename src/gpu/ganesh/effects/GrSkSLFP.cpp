@@ -302,6 +302,12 @@ std::unique_ptr<GrSkSLFP> GrSkSLFP::MakeWithData(
     std::unique_ptr<GrSkSLFP> fp(new (uniformSize + specializedSize)
                                          GrSkSLFP(std::move(effect), name, OptFlags::kNone));
     sk_careful_memcpy(fp->uniformData(), uniforms->data(), uniformSize);
+    SkSpan<const SkRuntimeEffect::Uniform> effectUniforms = fp->fEffect->uniforms();
+    for (size_t i = 0; i < effectUniforms.size(); ++i) {
+        if (effectUniforms[i].isSpecialized()) {
+            fp->specialized()[i] = Specialized::kYes;
+        }
+    }
     for (auto& childFP : childFPs) {
         fp->addChild(std::move(childFP), /*mergeOptFlags=*/true);
     }
@@ -265,6 +265,13 @@ bool GrGLBuffer::onUpdateData(const void* src, size_t offset, size_t size, bool
 
     // bindbuffer handles dirty context
     GrGLenum target = this->glGpu()->bindBuffer(fIntendedType, this);
+    if (!preserve && offset == 0 && size == this->size() &&
+        this->glCaps().invalidateBufferType() == GrGLCaps::InvalidateBufferType::kNullData) {
+        // Orphaning with null data only to fill the whole buffer right after costs two calls
+        // into the driver; respecifying the buffer with the data does both in one.
+        return GL_ALLOC_CALL(this->glGpu(), BufferData(target, size, src, fUsage)) ==
+               GR_GL_NO_ERROR;
+    }
     if (!preserve) {
         GrGLenum error = invalidate_buffer(this->glGpu(), target, fUsage, fBufferID, this->size());
         if (error != GR_GL_NO_ERROR) {
@@ -19,17 +19,20 @@
 #include "include/core/SkScalar.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkSurface.h"
+#include "include/core/SkTiledImageUtils.h"
 #include "include/core/SkTypes.h"
 #include "include/core/SkYUVAInfo.h"
 #include "include/core/SkYUVAPixmaps.h"
 #include "include/gpu/GpuTypes.h"
 #include "include/gpu/GrBackendSurface.h"
 #include "include/gpu/GrContextOptions.h"
+#include "include/gpu/GrDirectContext.h"
 #include "include/gpu/GrRecordingContext.h"
 #include "include/gpu/GrTypes.h"
 #include "include/gpu/ganesh/SkSurfaceGanesh.h"
 #include "include/private/SkIDChangeListener.h"
 #include "include/private/base/SkMutex.h"
+#include "include/private/base/SkTemplates.h"
 #include "include/private/gpu/ganesh/GrImageContext.h"
 #include "include/private/gpu/ganesh/GrTextureGenerator.h"
 #include "include/private/gpu/ganesh/GrTypesPriv.h"
@@ -46,13 +49,19 @@
 #include "src/gpu/ganesh/GrBlurUtils.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrColorSpaceXform.h"
+#include "src/gpu/ganesh/GrDirectContextPriv.h"
 #include "src/gpu/ganesh/GrFragmentProcessor.h"
+#include "src/gpu/ganesh/GrGpu.h"
+#include "src/gpu/ganesh/GrGpuBuffer.h"
 #include "src/gpu/ganesh/GrImageInfo.h"
 #include "src/gpu/ganesh/GrProxyProvider.h"
 #include "src/gpu/ganesh/GrRecordingContextPriv.h"
+#include "src/gpu/ganesh/GrResourceProvider.h"
+#include "src/gpu/ganesh/GrResourceProviderPriv.h"
 #include "src/gpu/ganesh/GrSamplerState.h"
 #include "src/gpu/ganesh/GrSurfaceProxy.h"
 #include "src/gpu/ganesh/GrSurfaceProxyView.h"
+#include "src/gpu/ganesh/GrTexture.h"
 #include "src/gpu/ganesh/GrTextureProxy.h"
 #include "src/gpu/ganesh/GrThreadSafeCache.h"
 #include "src/gpu/ganesh/GrYUVATextureProxies.h"
@@ -71,6 +80,7 @@
 #include "src/image/SkImage_Picture.h"
 #include "src/image/SkImage_Raster.h"
 
+#include <algorithm>
 #include <string_view>
 #include <utility>
 
@@ -144,18 +154,136 @@ static GrSurfaceOrigin get_origin(const SkImage_Lazy* img) {
 }
 
 
-static GrSurfaceProxyView texture_proxy_view_from_planes(GrRecordingContext* ctx,
-                                                         const SkImage_Lazy* img,
-                                                         skgpu::Budgeted budgeted) {
+// Decodes the planes of img straight into a mapped transfer buffer and uploads the plane textures
+// from it. This skips the planes' allocation in the SkYUVPlanesCache and the copy of them that
+// uploading from CPU memory makes.
+static bool plane_views_from_transfer_buffer(GrDirectContext* dContext,
+                                             const SkImage_Lazy* img,
+                                             SkYUVAInfo* yuvaInfo,
+                                             GrSurfaceProxyView views[SkYUVAInfo::kMaxPlanes],
+                                             GrColorType colorTypes[SkYUVAInfo::kMaxPlanes]) {
+    const GrCaps* caps = dContext->priv().caps();
+    if (!caps->transferFromBufferToTextureSupport() ||
+        !(caps->mapBufferFlags() & GrCaps::kCanMap_MapFlag)) {
+        return false;
+    }
+    GrResourceProvider* resourceProvider = dContext->priv().resourceProvider();
+
+    sk_sp<GrGpuBuffer> buffer;
+    SkYUVAPixmaps planes;
+    GrBackendFormat formats[SkYUVAInfo::kMaxPlanes];
+    size_t offsets[SkYUVAInfo::kMaxPlanes];
+    auto makePlanes = [&](const SkYUVAPixmapInfo& info) -> SkYUVAPixmaps {
+        size_t size = 0;
+        for (int i = 0; i < info.numPlanes(); ++i) {
+            const SkImageInfo& planeInfo = info.planeInfo(i);
+            colorTypes[i] = SkColorTypeToGrColorType(planeInfo.colorType());
+            formats[i] = caps->getDefaultBackendFormat(colorTypes[i], GrRenderable::kNo);
+            if (!formats[i].isValid()) {
+                return {};
+            }
+            GrCaps::SupportedWrite write =
+                    caps->supportedWritePixelsColorType(colorTypes[i], formats[i], colorTypes[i]);
+            if (write.fColorType != colorTypes[i] ||
+                (info.rowBytes(i) != planeInfo.minRowBytes() &&
+                 !caps->transferPixelsToRowBytesSupport())) {
+                return {};
+            }
+            size_t alignment = std::max<size_t>(write.fOffsetAlignmentForTransferBuffer, 1);
+            offsets[i] = (size + alignment - 1) / alignment * alignment;
+            size = offsets[i] + info.rowBytes(i) * planeInfo.height();
+        }
+        buffer = resourceProvider->createBuffer(size,
+                                                GrGpuBufferType::kXferCpuToGpu,
+                                                kStream_GrAccessPattern,
+                                                GrResourceProvider::ZeroInit::kNo);
+        void* memory = buffer ? buffer->map() : nullptr;
+        if (!memory) {
+            return {};
+        }
+        SkPixmap pixmaps[SkYUVAInfo::kMaxPlanes];
+        for (int i = 0; i < info.numPlanes(); ++i) {
+            pixmaps[i].reset(info.planeInfo(i),
+                             SkTAddOffset<void>(memory, offsets[i]),
+                             info.rowBytes(i));
+        }
+        planes = SkYUVAPixmaps::FromExternalPixmaps(info.yuvaInfo(), pixmaps);
+        return planes;
+    };
+    bool decoded = img->getPlanesInto(SupportedTextureFormats(*dContext), makePlanes);
+    if (buffer && buffer->isMapped()) {
+        buffer->unmap();
+    }
+    if (!decoded) {
+        return false;
+    }
+
+    GrProxyProvider* proxyProvider = dContext->priv().proxyProvider();
+    for (int i = 0; i < planes.numPlanes(); ++i) {
+        GrColorType colorType = colorTypes[i];
+        size_t offset = offsets[i];
+        size_t rowBytes = planes.plane(i).rowBytes();
+        sk_sp<GrTextureProxy> proxy = proxyProvider->createLazyProxy(
+                [buffer, colorType, offset, rowBytes](GrResourceProvider* resourceProvider,
+                                                      const GrSurfaceProxy::LazySurfaceDesc& desc) {
+                    sk_sp<GrTexture> texture = resourceProvider->createTexture(desc.fDimensions,
+                                                                               desc.fFormat,
+                                                                               desc.fTextureType,
+                                                                               desc.fRenderable,
+                                                                               desc.fSampleCnt,
+                                                                               desc.fMipmapped,
+                                                                               desc.fBudgeted,
+                                                                               desc.fProtected,
+                                                                               desc.fLabel);
+                    if (!texture || !resourceProvider->priv().gpu()->transferPixelsTo(
+                                            texture.get(),
+                                            SkIRect::MakeSize(desc.fDimensions),
+                                            colorType,
+                                            colorType,
+                                            buffer,
+                                            offset,
+                                            rowBytes)) {
+                        return GrSurfaceProxy::LazyCallbackResult();
+                    }
+                    return GrSurfaceProxy::LazyCallbackResult(std::move(texture));
+                },
+                formats[i],
+                planes.plane(i).dimensions(),
+                skgpu::Mipmapped::kNo,
+                GrMipmapStatus::kNotAllocated,
+                GrInternalSurfaceFlags::kNone,
+                SkBackingFit::kExact,
+                skgpu::Budgeted::kYes,
+                GrProtected::kNo,
+                GrSurfaceProxy::UseAllocator::kYes,
+                "ImageLazy_PlaneFromTransferBuffer");
+        // Upload now, like GrMakeUncachedBitmapProxyView() does with a direct context, so the
+        // buffer is released as soon as possible.
+        if (!proxy || !proxy->priv().doLazyInstantiation(resourceProvider)) {
+            return false;
+        }
+        views[i] = GrSurfaceProxyView(std::move(proxy),
+                                      kTopLeft_GrSurfaceOrigin,
+                                      caps->getReadSwizzle(formats[i], colorType));
+    }
+    *yuvaInfo = planes.yuvaInfo();
+    return true;
+}
+
+// Decodes the planes of img into the SkYUVPlanesCache, if they aren't there already, and makes
+// plane textures that upload from them.
+static bool plane_views_from_cached_planes(GrRecordingContext* ctx,
+                                           const SkImage_Lazy* img,
+                                           SkYUVAInfo* yuvaInfo,
+                                           GrSurfaceProxyView views[SkYUVAInfo::kMaxPlanes],
+                                           GrColorType colorTypes[SkYUVAInfo::kMaxPlanes]) {
     auto supportedDataTypes = SupportedTextureFormats(*ctx);
     SkYUVAPixmaps yuvaPixmaps;
     sk_sp<SkCachedData> dataStorage = img->getPlanes(supportedDataTypes, &yuvaPixmaps);
     if (!dataStorage) {
-        return {};
+        return false;
     }
 
-    GrSurfaceProxyView views[SkYUVAInfo::kMaxPlanes];
-    GrColorType pixmapColorTypes[SkYUVAInfo::kMaxPlanes];
     for (int i = 0; i < yuvaPixmaps.numPlanes(); ++i) {
         // If the sizes of the components are not all the same we choose to create exact-match
         // textures for the smaller ones rather than add a texture domain to the draw.
@@ -186,9 +314,25 @@ static GrSurfaceProxyView texture_proxy_view_from_planes(GrRecordingContext* ctx
         std::tie(views[i], std::ignore) =
                 GrMakeUncachedBitmapProxyView(ctx, bitmap, skgpu::Mipmapped::kNo, fit);
         if (!views[i]) {
-            return {};
+            return false;
         }
-        pixmapColorTypes[i] = SkColorTypeToGrColorType(bitmap.colorType());
+        colorTypes[i] = SkColorTypeToGrColorType(bitmap.colorType());
+    }
+    *yuvaInfo = yuvaPixmaps.yuvaInfo();
+    return true;
+}
+
+static GrSurfaceProxyView texture_proxy_view_from_planes(GrRecordingContext* ctx,
+                                                         const SkImage_Lazy* img,
+                                                         skgpu::Budgeted budgeted) {
+    SkYUVAInfo yuvaInfo;
+    GrSurfaceProxyView views[SkYUVAInfo::kMaxPlanes];
+    GrColorType pixmapColorTypes[SkYUVAInfo::kMaxPlanes];
+    GrDirectContext* dContext = ctx->asDirectContext();
+    if (!(dContext &&
+          plane_views_from_transfer_buffer(dContext, img, &yuvaInfo, views, pixmapColorTypes)) &&
+        !plane_views_from_cached_planes(ctx, img, &yuvaInfo, views, pixmapColorTypes)) {
+        return {};
     }
 
     // TODO: investigate preallocating mip maps here
@@ -209,7 +353,7 @@ static GrSurfaceProxyView texture_proxy_view_from_planes(GrRecordingContext* ctx
         return {};
     }
 
-    GrYUVATextureProxies yuvaProxies(yuvaPixmaps.yuvaInfo(), views, pixmapColorTypes);
+    GrYUVATextureProxies yuvaProxies(yuvaInfo, views, pixmapColorTypes);
     SkAssertResult(yuvaProxies.isValid());
 
     std::unique_ptr<GrFragmentProcessor> fp = GrYUVtoRGBEffect::Make(
@@ -269,6 +413,52 @@ static GrSurfaceProxyView generate_picture_texture(GrRecordingContext* ctx,
     return view;
 }
 
+// Picture-backed images made from the same picture, at the same size and offset, have the same
+// contents. Icons and other vector art are often wrapped in a new image each time they're drawn,
+// so rather than draw the picture again for each of those images (and key the texture to just one
+// of them), they share a texture in the GrThreadSafeCache. Only the direct context adds to it,
+// since a texture drawn by a DDL recorder isn't ready until its DDL is replayed, but recorders
+// can use what the direct context has drawn.
+static bool make_picture_key(const SkImage_Picture* img, skgpu::UniqueKey* key) {
+    uint32_t keyValues[SkTiledImageUtils::kNumImageKeyValues];
+    if (!img->getImageKeyValues(keyValues)) {
+        return false;
+    }
+    static const skgpu::UniqueKey::Domain kDomain = skgpu::UniqueKey::GenerateDomain();
+    skgpu::UniqueKey::Builder builder(key, kDomain, SkTiledImageUtils::kNumImageKeyValues,
+                                      "Picture Image");
+    for (int i = 0; i < SkTiledImageUtils::kNumImageKeyValues; ++i) {
+        builder[i] = keyValues[i];
+    }
+    return true;
+}
+
+static GrSurfaceProxyView find_or_generate_picture_texture(GrRecordingContext* ctx,
+                                                           const SkImage_Picture* img,
+                                                           const skgpu::UniqueKey& key,
+                                                           skgpu::Mipmapped mipmapped) {
+    GrThreadSafeCache* threadSafeCache = ctx->priv().threadSafeCache();
+    GrSurfaceProxyView view = threadSafeCache->find(key);
+    if (view && (mipmapped == skgpu::Mipmapped::kNo ||
+                 view.asTextureProxy()->mipmapped() == skgpu::Mipmapped::kYes)) {
+        return view;
+    }
+    if (!ctx->asDirectContext()) {
+        return {};
+    }
+
+    GrSurfaceProxyView generated =
+            generate_picture_texture(ctx, img, mipmapped, GrImageTexGenPolicy::kDraw);
+    if (!generated) {
+        return view;
+    }
+    if (view) {
+        // Replace the cached texture with the mipmapped one, which serves either kind of draw.
+        threadSafeCache->remove(key);
+    }
+    return threadSafeCache->add(key, generated);
+}
+
 // Returns the texture proxy. We will always cache the generated texture on success.
 // We have 4 ways to try to return a texture (in sorted order)
 //
@@ -293,6 +483,18 @@ GrSurfaceProxyView LockTextureProxyView(GrRecordingContext* rContext,
 
     enum { kLockTexturePathCount = kRGBA_LockTexturePath + 1 };
 
+    if (img->type() == SkImage_Base::Type::kLazyPicture &&
+        texGenPolicy == GrImageTexGenPolicy::kDraw) {
+        auto picture = static_cast<const SkImage_Picture*>(img);
+        skgpu::UniqueKey pictureKey;
+        if (make_picture_key(picture, &pictureKey)) {
+            if (auto view = find_or_generate_picture_texture(rContext, picture, pictureKey,
+                                                             mipmapped)) {
+                return view;
+            }
+        }
+    }
+
     skgpu::UniqueKey key;
     if (texGenPolicy == GrImageTexGenPolicy::kDraw) {
         GrMakeKeyFromImageID(&key, img->uniqueID(), SkIRect::MakeSize(img->dimensions()));
@@ -9,6 +9,7 @@
 
 #include "include/gpu/GrContextOptions.h"
 #include "include/gpu/GrDirectContext.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
 #include "src/gpu/ganesh/GrProgramDesc.h"
@@ -249,6 +250,7 @@ GrMtlPipelineState* GrMtlResourceProvider::PipelineStateCache::onRefPipelineStat
            return nullptr;
         }
         fStats.incNumCompilationSuccesses();
+        SkCounters::Add(SkCounters::Counter::kPipelinesCompiled);
         entry = fMap.insert(desc, std::make_unique<Entry>(pipelineState));
         *stat = Stats::ProgramCacheResult::kMiss;
         return (*entry)->fPipelineState.get();
@@ -12,12 +12,20 @@
 #include "src/base/SkRandom.h"
 #include "src/core/SkMatrixPriv.h"
 #include "src/core/SkRectPriv.h"
+#include "src/gpu/KeyBuilder.h"
+#include "src/gpu/ganesh/GrBuffer.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrDefaultGeoProcFactory.h"
+#include "src/gpu/ganesh/GrGeometryProcessor.h"
+#include "src/gpu/ganesh/GrGpuBuffer.h"
 #include "src/gpu/ganesh/GrOpFlushState.h"
 #include "src/gpu/ganesh/GrProgramInfo.h"
 #include "src/gpu/ganesh/GrRecordingContextPriv.h"
+#include "src/gpu/ganesh/GrResourceProvider.h"
 #include "src/gpu/ganesh/SkGr.h"
+#include "src/gpu/ganesh/glsl/GrGLSLFragmentShaderBuilder.h"
+#include "src/gpu/ganesh/glsl/GrGLSLVarying.h"
+#include "src/gpu/ganesh/glsl/GrGLSLVertexGeoBuilder.h"
 #include "src/gpu/ganesh/ops/GrSimpleMeshDrawOpHelper.h"
 
 using namespace skia_private;
@@ -33,7 +41,7 @@ public:
 
     DrawAtlasOpImpl(GrProcessorSet*, const SkPMColor4f& color,
                     const SkMatrix& viewMatrix, GrAAType, int spriteCount, const SkRSXform* xforms,
-                    const SkRect* rects, const SkColor* colors);
+                    const SkRect* rects, const SkColor* colors, bool useInstancing);
 
     const char* name() const override { return "DrawAtlasOp"; }
 
@@ -76,7 +84,9 @@ private:
 
     struct Geometry {
         SkPMColor4f fColor;
-        TArray<uint8_t, true> fVerts;
+        int fQuadCount;
+        // Four vertices per quad, or one instance per quad when fUseInstancing is set.
+        TArray<uint8_t, true> fData;
     };
 
     STArray<1, Geometry, true> fGeoData;
@@ -85,9 +95,136 @@ private:
     SkPMColor4f fColor;
     int fQuadCount;
     bool fHasColors;
+    bool fUseInstancing;
 
     GrSimpleMesh* fMesh = nullptr;
     GrProgramInfo* fProgramInfo = nullptr;
+
+    // Only used when fUseInstancing is set.
+    sk_sp<const GrBuffer> fInstanceBuffer;
+    int fBaseInstance = 0;
+    sk_sp<const GrGpuBuffer> fCornerBufferIfNoIDSupport;
+};
+
+// Draws each sprite as an instance carrying its RSXform, texture rect and optional color. The
+// quad is expanded in the vertex shader, so the CPU writes less than half of the data that the
+// non-instanced path writes.
+class DrawAtlasInstancedGP final : public GrGeometryProcessor {
+public:
+    static GrGeometryProcessor* Make(SkArenaAlloc* arena,
+                                     bool hasColors,
+                                     const SkPMColor4f& color,
+                                     const SkMatrix& viewMatrix,
+                                     const GrShaderCaps& shaderCaps) {
+        return arena->make([&](void* ptr) {
+            return new (ptr) DrawAtlasInstancedGP(hasColors, color, viewMatrix, shaderCaps);
+        });
+    }
+
+    const char* name() const override { return "DrawAtlasInstancedGP"; }
+
+    void addToKey(const GrShaderCaps& caps, skgpu::KeyBuilder* b) const override {
+        uint32_t key = fInColor.isInitialized() ? 0x1 : 0x0;
+        key = ProgramImpl::AddMatrixKeys(caps, key, fViewMatrix, SkMatrix::I());
+        b->add32(key);
+    }
+
+    std::unique_ptr<ProgramImpl> makeProgramImpl(const GrShaderCaps&) const override {
+        return std::make_unique<Impl>();
+    }
+
+private:
+    class Impl : public ProgramImpl {
+    public:
+        void setData(const GrGLSLProgramDataManager& pdman,
+                     const GrShaderCaps& shaderCaps,
+                     const GrGeometryProcessor& geomProc) override {
+            const auto& gp = geomProc.cast<DrawAtlasInstancedGP>();
+            SetTransform(pdman, shaderCaps, fViewMatrixUniform, gp.fViewMatrix, &fViewMatrixPrev);
+            if (!gp.fInColor.isInitialized() && gp.fColor != fColor) {
+                pdman.set4fv(fColorUniform, 1, gp.fColor.vec());
+                fColor = gp.fColor;
+            }
+        }
+
+    private:
+        void onEmitCode(EmitArgs& args, GrGPArgs* gpArgs) override {
+            const auto& gp = args.fGeomProc.cast<DrawAtlasInstancedGP>();
+            GrGLSLVertexBuilder* vertBuilder = args.fVertBuilder;
+            GrGLSLFPFragmentBuilder* fragBuilder = args.fFragBuilder;
+            args.fVaryingHandler->emitAttributes(gp);
+
+            if (args.fShaderCaps->fVertexIDSupport) {
+                // If we don't have sk_VertexID support then "corner" already came in as a vertex
+                // attrib.
+                vertBuilder->codeAppend(
+                        "float2 corner = float2(sk_VertexID & 1, sk_VertexID >> 1);");
+            }
+            // Matches SkRSXform::toTriStrip() and the texture coords of the non-instanced path.
+            vertBuilder->codeAppend("float2 spritePos = corner * (texRect.zw - texRect.xy);");
+            vertBuilder->codeAppend(
+                    "float2 position = float2(xform.x * spritePos.x - xform.y * spritePos.y,"
+                                             "xform.y * spritePos.x + xform.x * spritePos.y) +"
+                                      "xform.zw;");
+            vertBuilder->codeAppend(
+                    "float2 localCoord = texRect.xy * (1 - corner) + texRect.zw * corner;");
+
+            fragBuilder->codeAppendf("half4 %s;", args.fOutputColor);
+            if (gp.fInColor.isInitialized()) {
+                args.fVaryingHandler->addPassThroughAttribute(
+                        gp.fInColor.asShaderVar(),
+                        args.fOutputColor,
+                        GrGLSLVaryingHandler::Interpolation::kCanBeFlat);
+            } else {
+                this->setupUniformColor(fragBuilder, args.fUniformHandler, args.fOutputColor,
+                                        &fColorUniform);
+            }
+
+            WriteOutputPosition(vertBuilder,
+                                args.fUniformHandler,
+                                *args.fShaderCaps,
+                                gpArgs,
+                                "position",
+                                gp.fViewMatrix,
+                                &fViewMatrixUniform);
+            gpArgs->fLocalCoordVar.set(SkSLType::kFloat2, "localCoord");
+
+            fragBuilder->codeAppendf("const half4 %s = half4(1);", args.fOutputCoverage);
+        }
+
+        SkMatrix    fViewMatrixPrev = SkMatrix::InvalidMatrix();
+        SkPMColor4f fColor          = SK_PMColor4fILLEGAL;
+
+        UniformHandle fViewMatrixUniform;
+        UniformHandle fColorUniform;
+    };
+
+    DrawAtlasInstancedGP(bool hasColors,
+                         const SkPMColor4f& color,
+                         const SkMatrix& viewMatrix,
+                         const GrShaderCaps& shaderCaps)
+            : GrGeometryProcessor(kDrawAtlasInstancedGP_ClassID)
+            , fColor(color)
+            , fViewMatrix(viewMatrix) {
+        if (!shaderCaps.fVertexIDSupport) {
+            constexpr static Attribute kCornerAttrib(
+                    "corner", kFloat2_GrVertexAttribType, SkSLType::kFloat2);
+            this->setVertexAttributesWithImplicitOffsets(&kCornerAttrib, 1);
+        }
+        // Matches the order DrawAtlasOpImpl writes each instance in.
+        fInXform = {"xform", kFloat4_GrVertexAttribType, SkSLType::kFloat4};
+        fInTexRect = {"texRect", kFloat4_GrVertexAttribType, SkSLType::kFloat4};
+        if (hasColors) {
+            fInColor = MakeColorAttribute("color", /*wideColor=*/false);
+        }
+        this->setInstanceAttributesWithImplicitOffsets(&fInXform, 3);
+    }
+
+    Attribute fInXform;
+    Attribute fInTexRect;
+    Attribute fInColor;
+    SkPMColor4f fColor;
+    SkMatrix fViewMatrix;
 };
 
 GrGeometryProcessor* make_gp(SkArenaAlloc* arena,
@@ -107,34 +244,77 @@ GrGeometryProcessor* make_gp(SkArenaAlloc* arena,
 DrawAtlasOpImpl::DrawAtlasOpImpl(GrProcessorSet* processorSet, const SkPMColor4f& color,
                                  const SkMatrix& viewMatrix, GrAAType aaType, int spriteCount,
                                  const SkRSXform* xforms, const SkRect* rects,
-                                 const SkColor* colors)
-        : GrMeshDrawOp(ClassID()), fHelper(processorSet, aaType), fColor(color) {
+                                 const SkColor* colors, bool useInstancing)
+        : GrMeshDrawOp(ClassID())
+        , fHelper(processorSet, aaType)
+        , fColor(color)
+        , fUseInstancing(useInstancing) {
     SkASSERT(xforms);
     SkASSERT(rects);
 
     fViewMatrix = viewMatrix;
     Geometry& installedGeo = fGeoData.push_back();
     installedGeo.fColor = color;
+    installedGeo.fQuadCount = spriteCount;
+    fHasColors = SkToBool(colors);
+    fQuadCount = spriteCount;
+
+    SkRect bounds = SkRectPriv::MakeLargestInverted();
+    // TODO4F: Preserve float colors
+    int paintAlpha = GrColorUnpackA(installedGeo.fColor.toBytes_RGBA());
+    auto spriteGrColor = [&](int spriteIndex) {
+        // convert to GrColor
+        SkColor spriteColor = colors[spriteIndex];
+        if (paintAlpha != 255) {
+            spriteColor = SkColorSetA(spriteColor,
+                                      SkMulDiv255Round(SkColorGetA(spriteColor), paintAlpha));
+        }
+        return SkColorToPremulGrColor(spriteColor);
+    };
+
+    if (fUseInstancing) {
+        // Order within the instance is: xform texRect [color]
+        size_t instanceStride = sizeof(SkRSXform) + sizeof(SkRect);
+        if (colors) {
+            instanceStride += sizeof(GrColor);
+        }
+        installedGeo.fData.reset(static_cast<int>(instanceStride * spriteCount));
+        uint8_t* currInstance = installedGeo.fData.begin();
+        for (int spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex) {
+            const SkRect& currRect = rects[spriteIndex];
+            SkPoint strip[4];
+            xforms[spriteIndex].toTriStrip(currRect.width(), currRect.height(), strip);
+            for (const SkPoint& pt : strip) {
+                SkRectPriv::GrowToInclude(&bounds, pt);
+            }
+
+            memcpy(currInstance, &xforms[spriteIndex], sizeof(SkRSXform));
+            memcpy(currInstance + sizeof(SkRSXform), &currRect, sizeof(SkRect));
+            if (colors) {
+                GrColor grColor = spriteGrColor(spriteIndex);
+                memcpy(currInstance + sizeof(SkRSXform) + sizeof(SkRect), &grColor,
+                       sizeof(GrColor));
+            }
+            currInstance += instanceStride;
+        }
+        this->setTransformedBounds(bounds, viewMatrix, HasAABloat::kNo, IsHairline::kNo);
+        return;
+    }
 
     // Figure out stride and offsets
     // Order within the vertex is: position [color] texCoord
     size_t texOffset = sizeof(SkPoint);
     size_t vertexStride = 2 * sizeof(SkPoint);
-    fHasColors = SkToBool(colors);
     if (colors) {
         texOffset += sizeof(GrColor);
         vertexStride += sizeof(GrColor);
     }
 
     // Compute buffer size and alloc buffer
-    fQuadCount = spriteCount;
     int allocSize = static_cast<int>(4 * vertexStride * spriteCount);
-    installedGeo.fVerts.reset(allocSize);
-    uint8_t* currVertex = installedGeo.fVerts.begin();
+    installedGeo.fData.reset(allocSize);
+    uint8_t* currVertex = installedGeo.fData.begin();
 
-    SkRect bounds = SkRectPriv::MakeLargestInverted();
-    // TODO4F: Preserve float colors
-    int paintAlpha = GrColorUnpackA(installedGeo.fColor.toBytes_RGBA());
     for (int spriteIndex = 0; spriteIndex < spriteCount; ++spriteIndex) {
         // Transform rect
         SkPoint strip[4];
@@ -143,13 +323,7 @@ DrawAtlasOpImpl::DrawAtlasOpImpl(GrProcessorSet* processorSet, const SkPMColor4f
 
         // Copy colors if necessary
         if (colors) {
-            // convert to GrColor
-            SkColor spriteColor = colors[spriteIndex];
-            if (paintAlpha != 255) {
-                spriteColor = SkColorSetA(spriteColor,
-                                          SkMulDiv255Round(SkColorGetA(spriteColor), paintAlpha));
-            }
-            GrColor grColor = SkColorToPremulGrColor(spriteColor);
+            GrColor grColor = spriteGrColor(spriteIndex);
 
             *(reinterpret_cast<GrColor*>(currVertex + sizeof(SkPoint))) = grColor;
             *(reinterpret_cast<GrColor*>(currVertex + vertexStride + sizeof(SkPoint))) = grColor;
@@ -193,7 +367,7 @@ SkString DrawAtlasOpImpl::onDumpInfo() const {
     SkString string;
     for (const auto& geo : fGeoData) {
         string.appendf("Color: 0x%08x, Quads: %d\n", geo.fColor.toBytes_RGBA(),
-                       geo.fVerts.size() / 4);
+                       geo.fQuadCount);
     }
     string += fHelper.dumpInfo();
     return string;
@@ -209,23 +383,63 @@ void DrawAtlasOpImpl::onCreateProgramInfo(const GrCaps* caps,
                                           GrXferBarrierFlags renderPassXferBarriers,
                                           GrLoadOp colorLoadOp) {
     // Setup geometry processor
-    GrGeometryProcessor* gp = make_gp(arena,
-                                      this->hasColors(),
-                                      this->color(),
-                                      this->viewMatrix());
+    GrGeometryProcessor* gp;
+    GrPrimitiveType primitiveType;
+    if (fUseInstancing) {
+        gp = DrawAtlasInstancedGP::Make(arena,
+                                        this->hasColors(),
+                                        this->color(),
+                                        this->viewMatrix(),
+                                        *caps->shaderCaps());
+        primitiveType = GrPrimitiveType::kTriangleStrip;
+    } else {
+        gp = make_gp(arena, this->hasColors(), this->color(), this->viewMatrix());
+        primitiveType = GrPrimitiveType::kTriangles;
+    }
 
     fProgramInfo = fHelper.createProgramInfo(caps, arena, writeView, usesMSAASurface,
                                              std::move(appliedClip), dstProxyView, gp,
-                                             GrPrimitiveType::kTriangles, renderPassXferBarriers,
+                                             primitiveType, renderPassXferBarriers,
                                              colorLoadOp);
 }
 
+SKGPU_DECLARE_STATIC_UNIQUE_KEY(gUnitQuadBufferKey);
+
 void DrawAtlasOpImpl::onPrepareDraws(GrMeshDrawTarget* target) {
     if (!fProgramInfo) {
         this->createProgramInfo(target);
     }
 
     int instanceCount = fGeoData.size();
+
+    if (fUseInstancing) {
+        size_t instanceStride = fProgramInfo->geomProc().instanceStride();
+        void* instances = target->makeVertexSpace(instanceStride, fQuadCount, &fInstanceBuffer,
+                                                  &fBaseInstance);
+        if (!instances) {
+            SkDebugf("Could not allocate instances\n");
+            return;
+        }
+        uint8_t* instancePtr = reinterpret_cast<uint8_t*>(instances);
+        for (int i = 0; i < instanceCount; i++) {
+            const Geometry& args = fGeoData[i];
+            SkASSERT(args.fData.size() == SkToInt(instanceStride) * args.fQuadCount);
+
+            memcpy(instancePtr, args.fData.begin(), args.fData.size());
+            instancePtr += args.fData.size();
+        }
+
+        if (!target->caps().shaderCaps()->fVertexIDSupport) {
+            constexpr static SkPoint kUnitQuad[4] = {{0,0}, {0,1}, {1,0}, {1,1}};
+
+            SKGPU_DEFINE_STATIC_UNIQUE_KEY(gUnitQuadBufferKey);
+
+            fCornerBufferIfNoIDSupport = target->resourceProvider()->findOrMakeStaticBuffer(
+                    GrGpuBufferType::kVertex, sizeof(kUnitQuad), kUnitQuad, gUnitQuadBufferKey);
+        }
+        return;
+    }
+
     size_t vertexStride = fProgramInfo->geomProc().vertexStride();
 
     int numQuads = this->quadCount();
@@ -240,8 +454,8 @@ void DrawAtlasOpImpl::onPrepareDraws(GrMeshDrawTarget* target) {
     for (int i = 0; i < instanceCount; i++) {
         const Geometry& args = fGeoData[i];
 
-        size_t allocSize = args.fVerts.size();
-        memcpy(vertPtr, args.fVerts.begin(), allocSize);
+        size_t allocSize = args.fData.size();
+        memcpy(vertPtr, args.fData.begin(), allocSize);
         vertPtr += allocSize;
     }
 
@@ -249,6 +463,18 @@ void DrawAtlasOpImpl::onPrepareDraws(GrMeshDrawTarget* target) {
 }
 
 void DrawAtlasOpImpl::onExecute(GrOpFlushState* flushState, const SkRect& chainBounds) {
+    if (fUseInstancing) {
+        if (!fProgramInfo || !fInstanceBuffer ||
+            (fProgramInfo->geomProc().hasVertexAttributes() && !fCornerBufferIfNoIDSupport)) {
+            return;
+        }
+        flushState->bindPipelineAndScissorClip(*fProgramInfo, chainBounds);
+        flushState->bindTextures(fProgramInfo->geomProc(), nullptr, fProgramInfo->pipeline());
+        flushState->bindBuffers(nullptr, std::move(fInstanceBuffer), fCornerBufferIfNoIDSupport);
+        flushState->drawInstanced(fQuadCount, fBaseInstance, 4, 0);
+        return;
+    }
+
     if (!fProgramInfo || !fMesh) {
         return;
     }
@@ -272,7 +498,7 @@ GrOp::CombineResult DrawAtlasOpImpl::onCombineIfPossible(GrOp* t,
         return CombineResult::kCannotCombine;
     }
 
-    if (this->hasColors() != that->hasColors()) {
+    if (this->hasColors() != that->hasColors() || fUseInstancing != that->fUseInstancing) {
         return CombineResult::kCannotCombine;
     }
 
@@ -319,10 +545,11 @@ GrOp::Owner Make(GrRecordingContext* context,
                  const SkRSXform* xforms,
                  const SkRect* rects,
                  const SkColor* colors) {
+    bool useInstancing = context->priv().caps()->drawInstancedSupport();
     return GrSimpleMeshDrawOpHelper::FactoryHelper<DrawAtlasOpImpl>(context, std::move(paint),
                                                                     viewMatrix, aaType,
                                                                     spriteCount, xforms,
-                                                                    rects, colors);
+                                                                    rects, colors, useInstancing);
 }
 
 }  // namespace skgpu::ganesh::DrawAtlasOp
@@ -9,6 +9,7 @@
 
 #include "include/core/SkData.h"
 #include "include/core/SkMesh.h"
+#include "include/private/base/SkTemplates.h"
 #include "src/base/SkArenaAlloc.h"
 #include "src/core/SkMeshPriv.h"
 #include "src/core/SkRuntimeEffectPriv.h"
@@ -19,6 +20,7 @@
 #include "src/gpu/ganesh/GrMeshBuffers.h"
 #include "src/gpu/ganesh/GrOpFlushState.h"
 #include "src/gpu/ganesh/GrProgramInfo.h"
+#include "src/gpu/ganesh/GrResourceProvider.h"
 #include "src/gpu/ganesh/effects/GrTextureEffect.h"
 #include "src/gpu/ganesh/glsl/GrGLSLColorSpaceXformHelper.h"
 #include "src/gpu/ganesh/glsl/GrGLSLFragmentShaderBuilder.h"
@@ -639,6 +641,9 @@ private:
                              GrLoadOp colorLoadOp) override;
 
     void onPrepareDraws(GrMeshDrawTarget*) override;
+
+    // For an op drawing a single SkVertices, its vertices in a static buffer in the resource cache.
+    sk_sp<const GrBuffer> findOrMakeStaticVertexBuffer(GrMeshDrawTarget*) const;
     void onExecute(GrOpFlushState*, const SkRect& chainBounds) override;
 #if defined(GR_TEST_UTILS)
     SkString onDumpInfo() const override;
@@ -1057,12 +1062,48 @@ void MeshOp::onCreateProgramInfo(const GrCaps* caps,
                                              colorLoadOp);
 }
 
+// SkVertices are immutable, so once uploaded, an SkVertices' vertex and index data can stay in
+// the resource cache under its uniqueID, and meshes drawn every frame upload nothing after the
+// first. The cached buffers are purgeable, so those of deleted SkVertices age out with the rest.
+static skgpu::UniqueKey vertices_buffer_key(const SkVertices& vertices, GrGpuBufferType type) {
+    static const skgpu::UniqueKey::Domain kDomain = skgpu::UniqueKey::GenerateDomain();
+    skgpu::UniqueKey key;
+    skgpu::UniqueKey::Builder builder(&key, kDomain, 2, "SkVertices Buffer");
+    builder[0] = vertices.uniqueID();
+    builder[1] = static_cast<uint32_t>(type);
+    builder.finish();
+    return key;
+}
+
+sk_sp<const GrBuffer> MeshOp::findOrMakeStaticVertexBuffer(GrMeshDrawTarget* target) const {
+    const SkVertices* vertices = fMeshes[0].vertices();
+    const skgpu::UniqueKey key = vertices_buffer_key(*vertices, GrGpuBufferType::kVertex);
+    GrResourceProvider* resourceProvider = target->resourceProvider();
+    if (auto buffer = resourceProvider->findByUniqueKey<const GrGpuBuffer>(key)) {
+        return buffer;
+    }
+    // The op's spec, and so the vertex layout, is a function of the SkVertices' attributes alone.
+    const size_t size = fSpecification->stride() * fVertexCount;
+    AutoTMalloc<char> data(size);
+    skgpu::VertexWriter verts(data.get(), size);
+    fMeshes[0].writeVertices(verts, *fSpecification, /*transform=*/false);
+    return resourceProvider->findOrMakeStaticBuffer(GrGpuBufferType::kVertex,
+                                                    size,
+                                                    data.get(),
+                                                    key);
+}
+
 void MeshOp::onPrepareDraws(GrMeshDrawTarget* target) {
     size_t vertexStride = fSpecification->stride();
     sk_sp<const GrBuffer> vertexBuffer;
     int firstVertex;
     std::tie(vertexBuffer, firstVertex) = fMeshes[0].gpuVB();
 
+    if (!vertexBuffer && fMeshes.size() == 1 && fMeshes[0].isFromVertices()) {
+        SkASSERT(fViewMatrix != SkMatrix::InvalidMatrix());
+        vertexBuffer = this->findOrMakeStaticVertexBuffer(target);
+        firstVertex = 0;
+    }
     if (!vertexBuffer) {
         skgpu::VertexWriter verts = target->makeVertexWriter(vertexStride,
                                                              fVertexCount,
@@ -1087,7 +1128,15 @@ void MeshOp::onPrepareDraws(GrMeshDrawTarget* target) {
     int firstIndex = 0;
 
     std::tie(indexBuffer, firstIndex) = fMeshes[0].gpuIB();
-    if (fIndexCount && !indexBuffer) {
+    if (fIndexCount && !indexBuffer && fMeshes.size() == 1 && fMeshes[0].isFromVertices()) {
+        const SkVertices* vertices = fMeshes[0].vertices();
+        indexBuffer = target->resourceProvider()->findOrMakeStaticBuffer(
+                GrGpuBufferType::kIndex,
+                fIndexCount * sizeof(uint16_t),
+                vertices->priv().indices(),
+                vertices_buffer_key(*vertices, GrGpuBufferType::kIndex));
+        firstIndex = 0;
+    } else if (fIndexCount && !indexBuffer) {
         uint16_t* indices = nullptr;
         indices = target->makeIndexSpace(fIndexCount, &indexBuffer, &firstIndex);
         if (!indices) {
@@ -1106,7 +1155,7 @@ void MeshOp::onPrepareDraws(GrMeshDrawTarget* target) {
         }
         SkASSERT(voffset == fVertexCount);
         SkASSERT(ioffset == fIndexCount);
-    } else if (indexBuffer) {
+    } else if (indexBuffer && !fMeshes[0].isFromVertices()) {
         SkASSERT(fMeshes.size() == 1);
         SkASSERT(firstIndex % sizeof(uint16_t) == 0);
         firstIndex /= sizeof(uint16_t);
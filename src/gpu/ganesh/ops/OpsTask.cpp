@@ -681,7 +681,7 @@ bool OpsTask::canMerge(const OpsTask* opsTask) const {
            !opsTask->fCannotMergeBackward;
 }
 
-int OpsTask::mergeFrom(SkSpan<const sk_sp<GrRenderTask>> tasks) {
+int OpsTask::mergeFrom(SkSpan<const sk_sp<GrRenderTask>> tasks, const GrCaps& caps) {
     int mergedCount = 0;
     for (const sk_sp<GrRenderTask>& task : tasks) {
         auto opsTask = task->asOpsTask();
@@ -744,8 +744,13 @@ int OpsTask::mergeFrom(SkSpan<const sk_sp<GrRenderTask>> tasks) {
                                      toMerge->fDeferredProxies.data());
         fSampledProxies.move_back_n(toMerge->fSampledProxies.size(),
                                     toMerge->fSampledProxies.data());
+        int seam = fOpChains.size();
         fOpChains.move_back_n(toMerge->fOpChains.size(),
                               toMerge->fOpChains.data());
+        // Each task was forward combined when it was closed, but nothing could combine across
+        // the task boundary then. Interleaved saveLayers and simple draws often split runs of
+        // rect, texture and text ops that are only adjacent once the DAG has been reordered.
+        this->combineAcrossSeam(seam, caps);
         toMerge->fDeferredProxies.clear();
         toMerge->fSampledProxies.clear();
         toMerge->fOpChains.clear();
@@ -1054,6 +1059,46 @@ void OpsTask::forwardCombine(const GrCaps& caps) {
     }
 }
 
+void OpsTask::combineAcrossSeam(int seam, const GrCaps& caps) {
+    GrOP_INFO("opsTask: %d CombineAcrossSeam %d|%d ops:\n", this->uniqueID(), seam,
+              fOpChains.size() - seam);
+
+    // Chains emptied by an earlier combine draw nothing and are skipped on both sides.
+    for (int i = std::max(0, seam - kMaxOpChainDistance); i < seam; ++i) {
+        OpChain& chain = fOpChains[i];
+        if (!chain.shouldExecute()) {
+            continue;
+        }
+        // The chains between 'i' and the seam were already checked by forwardCombine(). We only
+        // need to know whether 'chain' can be reordered across them.
+        bool blocked = false;
+        for (int k = i + 1; k < seam; ++k) {
+            if (fOpChains[k].shouldExecute() &&
+                !can_reorder(chain.bounds(), fOpChains[k].bounds())) {
+                blocked = true;
+                break;
+            }
+        }
+        if (blocked) {
+            continue;
+        }
+        int maxCandidateIdx = std::min(i + kMaxOpChainDistance, fOpChains.size() - 1);
+        for (int j = seam; j <= maxCandidateIdx; ++j) {
+            OpChain& candidate = fOpChains[j];
+            if (!candidate.shouldExecute()) {
+                continue;
+            }
+            if (candidate.prependChain(&chain, caps, fArenas->arenaAlloc(), fAuditTrail)) {
+                break;
+            }
+            // Stop traversing if we would cause a painter's order violation.
+            if (!can_reorder(chain.bounds(), candidate.bounds())) {
+                break;
+            }
+        }
+    }
+}
+
 GrRenderTask::ExpectedOutcome OpsTask::onMakeClosed(GrRecordingContext* rContext,
                                                     SkIRect* targetUpdateBounds) {
     this->forwardCombine(*rContext->priv().caps());
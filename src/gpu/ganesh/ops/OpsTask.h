@@ -98,8 +98,9 @@ public:
     bool canMerge(const OpsTask*) const;
 
     // Merge as many opsTasks as possible from the head of 'tasks'. They should all be
-    // renderPass compatible. Return the number of tasks merged into 'this'.
-    int mergeFrom(SkSpan<const sk_sp<GrRenderTask>> tasks);
+    // renderPass compatible. Ops near the seams between the merged tasks are combined where
+    // possible. Return the number of tasks merged into 'this'.
+    int mergeFrom(SkSpan<const sk_sp<GrRenderTask>> tasks, const GrCaps&);
 
 #ifdef SK_DEBUG
     int numClips() const override { return fNumClips; }
@@ -258,6 +259,10 @@ private:
 
     void forwardCombine(const GrCaps&);
 
+    // Like forwardCombine(), but only tries to combine the chains before 'seam' with the chains
+    // from 'seam' on. Used after appending another opsTask's chains in mergeFrom().
+    void combineAcrossSeam(int seam, const GrCaps&);
+
     // Remove all ops, proxies, etc. Used in the merging algorithm when tasks can be skipped.
     void reset();
 
@@ -164,6 +164,8 @@ void PathStencilCoverOp::prePreparePrograms(const GrTessellationShader::ProgramA
         fTessellator = PathWedgeTessellator::Make(args.fArena,
                                                   args.fCaps->shaderCaps()->fInfinitySupport);
     }
+    // The patches only accumulate winding counts in the stencil buffer, so their order is free.
+    fTessellator->setDrawByResolveLevel(true);
     auto* tessShader = GrPathTessellationShader::Make(*args.fCaps->shaderCaps(),
                                                       args.fArena,
                                                       shaderMatrix,
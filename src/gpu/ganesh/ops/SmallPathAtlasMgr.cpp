@@ -105,6 +105,17 @@ SmallPathShapeData* SmallPathAtlasMgr::findOrCreate(const GrStyledShape& shape,
     return this->findOrCreate(key);
 }
 
+SmallPathShapeData* SmallPathAtlasMgr::findInAtlas(const GrStyledShape& shape,
+                                                   int desiredDimension) {
+    SmallPathShapeDataKey key(shape, desiredDimension);
+
+    auto shapeData = fShapeCache.find(key);
+    if (!shapeData || !fAtlas->hasID(shapeData->fAtlasLocator.plotLocator())) {
+        return nullptr;
+    }
+    return shapeData;
+}
+
 SmallPathShapeData* SmallPathAtlasMgr::findOrCreate(const GrStyledShape& shape,
                                                     const SkMatrix& ctm) {
     SmallPathShapeDataKey key(shape, ctm);
@@ -44,6 +44,10 @@ public:
     SmallPathShapeData* findOrCreate(const GrStyledShape&, int desiredDimension);
     SmallPathShapeData* findOrCreate(const GrStyledShape&, const SkMatrix& ctm);
 
+    // Returns the SDF entry for the shape at desiredDimension if it is currently in the atlas, and
+    // nullptr otherwise. Unlike findOrCreate, this never adds an entry.
+    SmallPathShapeData* findInAtlas(const GrStyledShape&, int desiredDimension);
+
     GrDrawOpAtlas::ErrorCode addToAtlas(GrResourceProvider*,
                                         GrDeferredUploadTarget*,
                                         int width, int height, const void* image,
@@ -54,6 +54,25 @@ static constexpr SkScalar kMaxSize = 2*kMaxMIP;
 // padding around path bounds to allow for antialiased pixels
 static const int kAntiAliasPad = 1;
 
+// Returns the distance field for 'shape' at 'desiredDimension', or at one of the larger mip levels
+// up to 'maxDimension', if one is already in the atlas. The SDF quads are sized in path space, so
+// any mip level draws correctly; the finest one that is cached is preferred.
+SmallPathShapeData* find_cached_df(SmallPathAtlasMgr* atlasMgr,
+                                   const GrStyledShape& shape,
+                                   SkScalar desiredDimension,
+                                   SkScalar maxDimension) {
+    for (SkScalar dim = desiredDimension;; dim *= 2) {
+        dim = std::min(dim, kMaxMIP);
+        if (SmallPathShapeData* shapeData =
+                    atlasMgr->findInAtlas(shape, SkScalarCeilToInt(dim))) {
+            return shapeData;
+        }
+        if (dim >= kMaxMIP || 2 * dim > maxDimension) {
+            return nullptr;
+        }
+    }
+}
+
 class SmallPathOp final : public GrMeshDrawOp {
 private:
     using Helper = GrSimpleMeshDrawOpHelperWithStencil;
@@ -251,6 +270,9 @@ private:
                 SkASSERT(maxScale <= mipScale + SK_ScalarNearlyZero);
 
                 SkScalar mipSize = mipScale*SkScalarAbs(maxDim);
+                // Like the sizes picked below, cached distance fields from larger mip levels may
+                // be drawn at up to 1/4 of their size.
+                const SkScalar maxReusedMipSize = 4 * mipSize;
                 // For sizes less than kIdealMinMIP we want to use as large a distance field as we can
                 // so we can preserve as much detail as possible. However, we can't scale down more
                 // than a 1/4 of the size without artifacts. So the idea is that we pick the mipsize
@@ -270,8 +292,13 @@ private:
                 SkScalar desiredDimension = std::min(mipSize, kMaxMIP);
                 int ceilDesiredDimension = SkScalarCeilToInt(desiredDimension);
 
-                // check to see if df path is cached
-                shapeData = atlasMgr->findOrCreate(args.fShape, ceilDesiredDimension);
+                // check to see if df path is cached, at this mip level or a larger one, so a path
+                // that is zoomed out doesn't need to be regenerated
+                shapeData = find_cached_df(atlasMgr, args.fShape, desiredDimension,
+                                           maxReusedMipSize);
+                if (!shapeData) {
+                    shapeData = atlasMgr->findOrCreate(args.fShape, ceilDesiredDimension);
+                }
                 if (!shapeData->fAtlasLocator.plotLocator().isValid()) {
                     SkScalar scale = desiredDimension / maxDim;
 
@@ -31,6 +31,7 @@
 #include "src/gpu/ganesh/ops/GrMeshDrawOp.h"
 #include "src/gpu/ganesh/ops/GrSimpleMeshDrawOpHelperWithStencil.h"
 
+#include <cmath>
 #include <cstdio>
 
 #if !defined(SK_ENABLE_OPTIMIZE_SIZE)
@@ -83,6 +84,49 @@ bool is_newer_better(SkData* incumbent, SkData* challenger) {
     return true;
 }
 
+// Non-AA triangulations are made at a power of two tolerance at or below the requested one. A path
+// that is being zoomed in then keeps matching its cached triangulation (see cache_match) for up to
+// twice as long before it has to be triangulated again.
+SkScalar bucket_tolerance(SkScalar tol) {
+    if (!(tol > 0) || !SkScalarIsFinite(tol)) {
+        return tol;
+    }
+    return std::exp2(std::floor(std::log2(tol)));
+}
+
+// There is one AA triangulation step for every 1/kAAScaleStepsPerOctave of an octave of scale.
+static constexpr float kAAScaleStepsPerOctave = 32;
+
+// AA triangulations are made in device space, since their coverage ramps are one pixel wide, so one
+// can only be reused by draws whose view matrices map it onto their own device space. This returns
+// the matrix to triangulate with instead of 'viewMatrix'. It drops the whole quarter pixels from
+// the translation, because GrAATriangulator rounds vertices to quarter pixels, so the triangulation
+// is shared by every draw scrolled by a multiple of a quarter pixel. For scale+translate matrices,
+// it also snaps the scales to kAAScaleStepsPerOctave steps, so an animated zoom reuses each
+// triangulation across several frames, at the cost of the ramp stretching by up to about 1%.
+SkMatrix aa_triangulation_matrix(const SkMatrix& viewMatrix) {
+    SkASSERT(!viewMatrix.hasPerspective());
+    SkMatrix m = viewMatrix;
+    if (m.isScaleTranslate()) {
+        auto snapScale = [](float s) {
+            if (s == 0 || !SkScalarIsFinite(s)) {
+                return s;
+            }
+            float steps = std::round(std::log2(std::abs(s)) * kAAScaleStepsPerOctave);
+            return std::copysign(std::exp2(steps / kAAScaleStepsPerOctave), s);
+        };
+        m.setScaleX(snapScale(m.getScaleX()));
+        m.setScaleY(snapScale(m.getScaleY()));
+    }
+    auto fractionalQuarters = [](float t) { return t - std::floor(t * 4) * 0.25f; };
+    m.setTranslateX(fractionalQuarters(m.getTranslateX()));
+    m.setTranslateY(fractionalQuarters(m.getTranslateY()));
+    return m;
+}
+
+// All AA triangulations stored under the same key are equivalent.
+bool prefer_incumbent(SkData*, SkData*) { return false; }
+
 // When the SkPathRef genID changes, invalidate a corresponding GrResource described by key.
 class UniqueKeyInvalidator : public SkIDChangeListener {
 public:
@@ -211,6 +255,11 @@ public:
             , fViewMatrix(viewMatrix)
             , fDevClipBounds(devClipBounds)
             , fAntiAlias(GrAAType::kCoverage == aaType) {
+        if (fAntiAlias && shape.hasUnstyledKey() && !shape.inverseFilled() &&
+            !viewMatrix.hasPerspective()) {
+            fAATriangulationMatrix = aa_triangulation_matrix(viewMatrix);
+            fCacheAATriangulation = fAATriangulationMatrix.invert(&fAATriangulationMatrixInverse);
+        }
         SkRect devBounds;
         viewMatrix.mapRect(&devBounds, shape.bounds());
         if (shape.inverseFilled()) {
@@ -262,6 +311,26 @@ private:
         builder.finish();
     }
 
+    static void CreateAAKey(skgpu::UniqueKey* key,
+                            const GrStyledShape& shape,
+                            const SkMatrix& triangulationMatrix) {
+        static const skgpu::UniqueKey::Domain kDomain = skgpu::UniqueKey::GenerateDomain();
+
+        static constexpr int kMatrixCnt = 6;
+        int shapeKeyDataCnt = shape.unstyledKeySize();
+        SkASSERT(shapeKeyDataCnt >= 0);
+        skgpu::UniqueKey::Builder builder(key, kDomain, shapeKeyDataCnt + kMatrixCnt, "AA Path");
+        shape.writeUnstyledKey(&builder[0]);
+        const SkScalar matrixValues[kMatrixCnt] = {triangulationMatrix.getScaleX(),
+                                                   triangulationMatrix.getSkewX(),
+                                                   triangulationMatrix.getTranslateX(),
+                                                   triangulationMatrix.getSkewY(),
+                                                   triangulationMatrix.getScaleY(),
+                                                   triangulationMatrix.getTranslateY()};
+        memcpy(&builder[shapeKeyDataCnt], matrixValues, sizeof(matrixValues));
+        builder.finish();
+    }
+
     // Triangulate the provided 'shape' in the shape's coordinate space. 'tol' should already
     // have been mapped back from device space.
     static int Triangulate(GrEagerVertexAllocator* allocator,
@@ -304,21 +373,7 @@ private:
         }
 
         if (fVertexData) {
-            if (!fVertexData->gpuBuffer()) {
-                sk_sp<GrGpuBuffer> buffer = rp->createBuffer(fVertexData->vertices(),
-                                                             fVertexData->size(),
-                                                             GrGpuBufferType::kVertex,
-                                                             kStatic_GrAccessPattern);
-                if (!buffer) {
-                    return;
-                }
-
-                // Since we have a direct context and a ref on 'fVertexData' we need not worry
-                // about any threading issues in this call.
-                fVertexData->setGpuBuffer(std::move(buffer));
-            }
-
-            fMesh = CreateMesh(target, fVertexData->refGpuBuffer(), 0, fVertexData->numVertices());
+            this->createMeshFromVertexData(target);
             return;
         }
 
@@ -326,6 +381,7 @@ private:
         StaticVertexAllocator allocator(rp, canMapVB);
 
         bool isLinear;
+        tol = bucket_tolerance(tol);
         int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
                                       &isLinear);
         if (vertexCount == 0) {
@@ -352,9 +408,75 @@ private:
         fMesh = CreateMesh(target, fVertexData->refGpuBuffer(), 0, fVertexData->numVertices());
     }
 
+    // Uploads 'fVertexData', which came from the cache, if it isn't on the GPU yet.
+    void createMeshFromVertexData(GrMeshDrawTarget* target) {
+        SkASSERT(fVertexData);
+        if (!fVertexData->gpuBuffer()) {
+            sk_sp<GrGpuBuffer> buffer = target->resourceProvider()->createBuffer(
+                    fVertexData->vertices(),
+                    fVertexData->size(),
+                    GrGpuBufferType::kVertex,
+                    kStatic_GrAccessPattern);
+            if (!buffer) {
+                return;
+            }
+
+            // Since we have a direct context and a ref on 'fVertexData' we need not worry
+            // about any threading issues in this call.
+            fVertexData->setGpuBuffer(std::move(buffer));
+        }
+
+        fMesh = CreateMesh(target, fVertexData->refGpuBuffer(), 0, fVertexData->numVertices());
+    }
+
+    void createCachedAAMesh(GrMeshDrawTarget* target) {
+        SkASSERT(fAntiAlias && fCacheAATriangulation);
+        auto threadSafeCache = target->threadSafeCache();
+
+        skgpu::UniqueKey key;
+        CreateAAKey(&key, fShape, fAATriangulationMatrix);
+
+        if (!fVertexData) {
+            fVertexData = std::get<0>(threadSafeCache->findVertsWithData(key));
+        }
+        if (fVertexData) {
+            this->createMeshFromVertexData(target);
+            return;
+        }
+
+        SkPath path = this->getPath();
+        if (path.isEmpty()) {
+            return;
+        }
+        path.transform(fAATriangulationMatrix);
+        bool canMapVB = GrCaps::kNone_MapFlags != target->caps().mapBufferFlags();
+        StaticVertexAllocator allocator(target->resourceProvider(), canMapVB);
+        // The clip bounds only matter for inverse fills, which aren't cached.
+        int vertexCount = GrAATriangulator::PathToAATriangles(path,
+                                                              GrPathUtils::kDefaultTolerance,
+                                                              SkRect::Make(fDevClipBounds),
+                                                              &allocator);
+        if (vertexCount == 0) {
+            return;
+        }
+
+        fVertexData = allocator.detachVertexData();
+        auto [tmpV, tmpD] = threadSafeCache->addVertsWithData(key, fVertexData, prefer_incumbent);
+        if (tmpV == fVertexData) {
+            fShape.addGenIDChangeListener(
+                    sk_make_sp<UniqueKeyInvalidator>(key, target->contextUniqueID()));
+        }
+
+        fMesh = CreateMesh(target, fVertexData->refGpuBuffer(), 0, fVertexData->numVertices());
+    }
+
     void createAAMesh(GrMeshDrawTarget* target) {
-        SkASSERT(!fVertexData);
         SkASSERT(fAntiAlias);
+        if (fCacheAATriangulation) {
+            this->createCachedAAMesh(target);
+            return;
+        }
+        SkASSERT(!fVertexData);
         SkPath path = this->getPath();
         if (path.isEmpty()) {
             return;
@@ -400,7 +522,15 @@ private:
             } else {
                 coverageType = Coverage::kSolid_Type;
             }
-            if (fAntiAlias) {
+            if (fCacheAATriangulation) {
+                // The vertices are in the space of fAATriangulationMatrix.
+                SkMatrix drawMatrix = SkMatrix::Concat(fViewMatrix, fAATriangulationMatrixInverse);
+                LocalCoords localCoords = fHelper.usesLocalCoords()
+                        ? LocalCoords(localCoordsType, &fAATriangulationMatrixInverse)
+                        : LocalCoords(localCoordsType);
+                gp = GrDefaultGeoProcFactory::Make(arena, color, coverageType, localCoords,
+                                                   drawMatrix);
+            } else if (fAntiAlias) {
                 gp = GrDefaultGeoProcFactory::MakeForDeviceSpace(arena, color, coverageType,
                                                                  localCoordsType, fViewMatrix);
             } else {
@@ -464,6 +594,7 @@ private:
         GrCpuVertexAllocator allocator;
 
         bool isLinear;
+        tol = bucket_tolerance(tol);
         int vertexCount = Triangulate(&allocator, fViewMatrix, fShape, fDevClipBounds, tol,
                                       &isLinear);
         if (vertexCount == 0) {
@@ -539,6 +670,11 @@ private:
     SkIRect        fDevClipBounds;
     bool           fAntiAlias;
 
+    // Cached AA triangulations are made with fAATriangulationMatrix instead of fViewMatrix.
+    bool           fCacheAATriangulation = false;
+    SkMatrix       fAATriangulationMatrix;
+    SkMatrix       fAATriangulationMatrixInverse;
+
     GrSimpleMesh*  fMesh = nullptr;
     GrProgramInfo* fProgramInfo = nullptr;
 
@@ -608,8 +744,8 @@ PathRenderer::CanDrawPath TriangulatingPathRenderer::onCanDrawPath(
             }
             break;
         case GrAAType::kCoverage:
-            // Use analytic AA if we don't have MSAA. In this case, we do not cache, so we accept
-            // paths without keys.
+            // Use analytic AA if we don't have MSAA. In this case, we only cache paths that have
+            // keys, so we accept paths without them too.
             SkPath path;
             args.fShape->asPath(&path);
             if (path.countVerbs() > fMaxVerbCount) {
@@ -25,20 +25,83 @@ namespace {
 
 using namespace skgpu::tess;
 
-using CurveWriter = PatchWriter<VertexChunkPatchAllocator,
+// Collects runs of consecutive cubics so the PatchWriter can evaluate Wang's formula for several of
+// them at once. The run must be flushed before anything else is written, or any patch attribs are
+// changed, to keep the patches in path order.
+template <typename Writer>
+class CubicBatch {
+public:
+    explicit CubicBatch(Writer* writer) : fWriter(writer) {}
+    ~CubicBatch() { this->flush(); }
+
+    void add(const AffineMatrix& m, const SkPoint pts[4]) {
+        m.map2Points(pts).store(fPts + 4 * fCount);
+        m.map2Points(pts + 2).store(fPts + 4 * fCount + 2);
+        if (++fCount == kMaxCubics) {
+            this->flush();
+        }
+    }
+
+    void flush() {
+        if (fCount) {
+            fWriter->writeCubics(fPts, fCount);
+            fCount = 0;
+        }
+    }
+
+private:
+    static constexpr int kMaxCubics = 4 * Writer::kCubicBatchSize;
+
+    Writer* fWriter;
+    SkPoint fPts[4 * kMaxCubics];
+    int fCount = 0;
+};
+
+template <typename PatchAllocator>
+using CurveWriter = PatchWriter<PatchAllocator,
                                 Optional<PatchAttribs::kColor>,
                                 Optional<PatchAttribs::kWideColorIfEnabled>,
                                 Optional<PatchAttribs::kExplicitCurveType>,
                                 AddTrianglesWhenChopping,
                                 DiscardFlatCurves>;
 
-void write_curve_patches(CurveWriter&& patchWriter,
+template <typename PatchAllocator>
+void write_curve_patches(CurveWriter<PatchAllocator>&& patchWriter,
+                         GrInnerFanTriangulator::BreadcrumbTriangleList* extraTriangles,
                          const SkMatrix& shaderMatrix,
                          const PathTessellator::PathDrawList& pathDrawList) {
+#if !defined(SK_ENABLE_OPTIMIZE_SIZE)
+    // Write out extra space-filling triangles to connect the curve patches with any external
+    // source of geometry (e.g. inner triangulation that handles winding explicitly).
+    if (extraTriangles) {
+        SkDEBUGCODE(int breadcrumbCount = 0;)
+        for (const auto* tri = extraTriangles->head(); tri; tri = tri->fNext) {
+            SkDEBUGCODE(++breadcrumbCount;)
+            auto p0 = skvx::float2::Load(tri->fPts);
+            auto p1 = skvx::float2::Load(tri->fPts + 1);
+            auto p2 = skvx::float2::Load(tri->fPts + 2);
+            if (any((p0 == p1) & (p1 == p2))) {
+                // Cull completely horizontal or vertical triangles. GrTriangulator can't always
+                // get these breadcrumb edges right when they run parallel to the sweep
+                // direction because their winding is undefined by its current definition.
+                // FIXME(skia:12060): This seemed safe, but if there is a view matrix it will
+                // introduce T-junctions.
+                continue;
+            }
+            patchWriter.writeTriangle(p0, p1, p2);
+        }
+        SkASSERT(breadcrumbCount == extraTriangles->count());
+    }
+#else
+    SkASSERT(!extraTriangles);
+#endif
+
     patchWriter.setShaderTransform(wangs_formula::VectorXform{shaderMatrix});
+    CubicBatch cubics(&patchWriter);
     for (auto [pathMatrix, path, color] : pathDrawList) {
         AffineMatrix m(pathMatrix);
         if (patchWriter.attribs() & PatchAttribs::kColor) {
+            cubics.flush();
             patchWriter.updateColorAttrib(color);
         }
         for (auto [verb, pts, w] : SkPathPriv::Iterate(path)) {
@@ -47,6 +110,7 @@ void write_curve_patches(CurveWriter&& patchWriter,
                     auto [p0, p1] = m.map2Points(pts);
                     auto p2 = m.map1Point(pts+2);
 
+                    cubics.flush();
                     patchWriter.writeQuadratic(p0, p1, p2);
                     break;
                 }
@@ -55,15 +119,13 @@ void write_curve_patches(CurveWriter&& patchWriter,
                     auto [p0, p1] = m.map2Points(pts);
                     auto p2 = m.map1Point(pts+2);
 
+                    cubics.flush();
                     patchWriter.writeConic(p0, p1, p2, *w);
                     break;
                 }
 
                 case SkPathVerb::kCubic: {
-                    auto [p0, p1] = m.map2Points(pts);
-                    auto [p2, p3] = m.map2Points(pts+2);
-
-                    patchWriter.writeCubic(p0, p1, p2, p3);
+                    cubics.add(m, pts);
                     break;
                 }
 
@@ -73,23 +135,28 @@ void write_curve_patches(CurveWriter&& patchWriter,
     }
 }
 
-using WedgeWriter = PatchWriter<VertexChunkPatchAllocator,
+template <typename PatchAllocator>
+using WedgeWriter = PatchWriter<PatchAllocator,
                                 Required<PatchAttribs::kFanPoint>,
                                 Optional<PatchAttribs::kColor>,
                                 Optional<PatchAttribs::kWideColorIfEnabled>,
                                 Optional<PatchAttribs::kExplicitCurveType>>;
 
-void write_wedge_patches(WedgeWriter&& patchWriter,
+template <typename PatchAllocator>
+void write_wedge_patches(WedgeWriter<PatchAllocator>&& patchWriter,
                          const SkMatrix& shaderMatrix,
                          const PathTessellator::PathDrawList& pathDrawList) {
     patchWriter.setShaderTransform(wangs_formula::VectorXform{shaderMatrix});
+    CubicBatch cubics(&patchWriter);
     for (auto [pathMatrix, path, color] : pathDrawList) {
         AffineMatrix m(pathMatrix);
         if (patchWriter.attribs() & PatchAttribs::kColor) {
+            cubics.flush();
             patchWriter.updateColorAttrib(color);
         }
         MidpointContourParser parser(path);
         while (parser.parseNextContour()) {
+            cubics.flush();
             patchWriter.updateFanPointAttrib(m.mapPoint(parser.currentMidpoint()));
             SkPoint lastPoint = {0, 0};
             SkPoint startPoint = {0, 0};
@@ -103,6 +170,7 @@ void write_wedge_patches(WedgeWriter&& patchWriter,
                     case SkPathVerb::kLine: {
                         // Explicitly convert the line to an equivalent cubic w/ four distinct
                         // control points because it fans better and avoids double-hitting pixels.
+                        cubics.flush();
                         patchWriter.writeLine(m.map2Points(pts));
                         lastPoint = pts[1];
                         break;
@@ -112,6 +180,7 @@ void write_wedge_patches(WedgeWriter&& patchWriter,
                         auto [p0, p1] = m.map2Points(pts);
                         auto p2 = m.map1Point(pts+2);
 
+                        cubics.flush();
                         patchWriter.writeQuadratic(p0, p1, p2);
                         lastPoint = pts[2];
                         break;
@@ -121,16 +190,14 @@ void write_wedge_patches(WedgeWriter&& patchWriter,
                         auto [p0, p1] = m.map2Points(pts);
                         auto p2 = m.map1Point(pts+2);
 
+                        cubics.flush();
                         patchWriter.writeConic(p0, p1, p2, *w);
                         lastPoint = pts[2];
                         break;
                     }
 
                     case SkPathVerb::kCubic: {
-                        auto [p0, p1] = m.map2Points(pts);
-                        auto [p2, p3] = m.map2Points(pts+2);
-
-                        patchWriter.writeCubic(p0, p1, p2, p3);
+                        cubics.add(m, pts);
                         lastPoint = pts[3];
                         break;
                     }
@@ -142,6 +209,7 @@ void write_wedge_patches(WedgeWriter&& patchWriter,
             }
             if (lastPoint != startPoint) {
                 SkPoint pts[2] = {lastPoint, startPoint};
+                cubics.flush();
                 patchWriter.writeLine(m.map2Points(pts));
             }
         }
@@ -150,6 +218,55 @@ void write_wedge_patches(WedgeWriter&& patchWriter,
 
 }  // namespace
 
+void PathTessellator::uploadResolveLevelBins(GrMeshDrawTarget* target,
+                                             const ResolveLevelPatchBins& bins,
+                                             int extraTrianglesPerPatch) {
+    SkASSERT(fVertexChunkArray.empty());
+    int totalCount = 0;
+    for (int count : bins.fCounts) {
+        totalCount += count;
+    }
+    if (!totalCount) {
+        return;
+    }
+    sk_sp<const GrBuffer> buffer;
+    int baseInstance;
+    VertexWriter vertexWriter = target->makeVertexWriter(bins.fStride, totalCount, &buffer,
+                                                         &baseInstance);
+    if (!vertexWriter) {
+        return;
+    }
+    for (int resolveLevel = 0; resolveLevel <= kMaxResolveLevel; ++resolveLevel) {
+        int count = bins.fCounts[resolveLevel];
+        if (!count) {
+            continue;
+        }
+        vertexWriter << VertexWriter::Array<char>(bins.fData[resolveLevel].data(),
+                                                  bins.fData[resolveLevel].size());
+        fVertexChunkArray.push_back({buffer, count, baseInstance});
+        int vertexCount =
+                (NumCurveTrianglesAtResolveLevel(resolveLevel) + extraTrianglesPerPatch) * 3;
+        fChunkVertexCounts.push_back(vertexCount);
+        fMaxVertexCount = std::max(fMaxVertexCount, vertexCount);
+        baseInstance += count;
+    }
+}
+
+void PathTessellator::drawChunks(GrOpFlushState* flushState) const {
+    if (!fFixedVertexBuffer || !fFixedIndexBuffer) {
+        return;
+    }
+    SkASSERT(fChunkVertexCounts.empty() || fChunkVertexCounts.size() == fVertexChunkArray.size());
+    for (int i = 0; i < fVertexChunkArray.size(); ++i) {
+        const GrVertexChunk& chunk = fVertexChunkArray[i];
+        int vertexCount = fChunkVertexCounts.empty() ? fMaxVertexCount : fChunkVertexCounts[i];
+        flushState->bindBuffers(fFixedIndexBuffer, chunk.fBuffer, fFixedVertexBuffer);
+        // The vertex count is the logical number of vertices that the GPU needs to emit, so
+        // since we're using drawIndexedInstanced, it's provided as the "index count" parameter.
+        flushState->drawIndexedInstanced(vertexCount, 0, chunk.fCount, chunk.fBase, 0);
+    }
+}
+
 SKGPU_DECLARE_STATIC_UNIQUE_KEY(gFixedCountCurveVertexBufferKey);
 SKGPU_DECLARE_STATIC_UNIQUE_KEY(gFixedCountCurveIndexBufferKey);
 
@@ -168,35 +285,23 @@ void PathCurveTessellator::prepareWithTriangles(
 #endif
 
 
-    if (patchPreallocCount) {
+    if (patchPreallocCount && fDrawByResolveLevel) {
+        ResolveLevelPatchBins bins;
+        write_curve_patches(CurveWriter<ResolveLevelPatchAllocator>{fAttribs, &bins},
+                            extraTriangles,
+                            shaderMatrix,
+                            pathDrawList);
+        this->uploadResolveLevelBins(target, bins, /*extraTrianglesPerPatch=*/0);
+    } else if (patchPreallocCount) {
         LinearTolerances worstCase;
-        CurveWriter writer{fAttribs, &worstCase, target, &fVertexChunkArray, patchPreallocCount};
-
-#if !defined(SK_ENABLE_OPTIMIZE_SIZE)
-        // Write out extra space-filling triangles to connect the curve patches with any external
-        // source of geometry (e.g. inner triangulation that handles winding explicitly).
-        if (extraTriangles) {
-            SkDEBUGCODE(int breadcrumbCount = 0;)
-            for (const auto* tri = extraTriangles->head(); tri; tri = tri->fNext) {
-                SkDEBUGCODE(++breadcrumbCount;)
-                auto p0 = skvx::float2::Load(tri->fPts);
-                auto p1 = skvx::float2::Load(tri->fPts + 1);
-                auto p2 = skvx::float2::Load(tri->fPts + 2);
-                if (any((p0 == p1) & (p1 == p2))) {
-                    // Cull completely horizontal or vertical triangles. GrTriangulator can't always
-                    // get these breadcrumb edges right when they run parallel to the sweep
-                    // direction because their winding is undefined by its current definition.
-                    // FIXME(skia:12060): This seemed safe, but if there is a view matrix it will
-                    // introduce T-junctions.
-                    continue;
-                }
-                writer.writeTriangle(p0, p1, p2);
-            }
-            SkASSERT(breadcrumbCount == extraTriangles->count());
-        }
-#endif
-
-        write_curve_patches(std::move(writer), shaderMatrix, pathDrawList);
+        write_curve_patches(CurveWriter<VertexChunkPatchAllocator>{fAttribs,
+                                                                   &worstCase,
+                                                                   target,
+                                                                   &fVertexChunkArray,
+                                                                   patchPreallocCount},
+                            extraTriangles,
+                            shaderMatrix,
+                            pathDrawList);
         fMaxVertexCount = FixedCountCurves::VertexCount(worstCase);
     }
 
@@ -218,15 +323,7 @@ void PathCurveTessellator::prepareWithTriangles(
 }
 
 void PathCurveTessellator::draw(GrOpFlushState* flushState) const {
-    if (!fFixedVertexBuffer || !fFixedIndexBuffer) {
-        return;
-    }
-    for (const GrVertexChunk& chunk : fVertexChunkArray) {
-        flushState->bindBuffers(fFixedIndexBuffer, chunk.fBuffer, fFixedVertexBuffer);
-        // The max vertex count is the logical number of vertices that the GPU needs to emit, so
-        // since we're using drawIndexedInstanced, it's provided as the "index count" parameter.
-        flushState->drawIndexedInstanced(fMaxVertexCount, 0, chunk.fCount, chunk.fBase, 0);
-    }
+    this->drawChunks(flushState);
 }
 
 void PathCurveTessellator::drawHullInstances(GrOpFlushState* flushState,
@@ -245,10 +342,23 @@ void PathWedgeTessellator::prepare(GrMeshDrawTarget* target,
                                    const SkMatrix& shaderMatrix,
                                    const PathDrawList& pathDrawList,
                                    int totalCombinedPathVerbCnt) {
-    if (int patchPreallocCount = FixedCountWedges::PreallocCount(totalCombinedPathVerbCnt)) {
+    int patchPreallocCount = FixedCountWedges::PreallocCount(totalCombinedPathVerbCnt);
+    if (patchPreallocCount && fDrawByResolveLevel) {
+        ResolveLevelPatchBins bins;
+        write_wedge_patches(WedgeWriter<ResolveLevelPatchAllocator>{fAttribs, &bins},
+                            shaderMatrix,
+                            pathDrawList);
+        // Each wedge also draws the triangle that fans its curve to the fan point.
+        this->uploadResolveLevelBins(target, bins, /*extraTrianglesPerPatch=*/1);
+    } else if (patchPreallocCount) {
         LinearTolerances worstCase;
-        WedgeWriter writer{fAttribs, &worstCase, target, &fVertexChunkArray, patchPreallocCount};
-        write_wedge_patches(std::move(writer), shaderMatrix, pathDrawList);
+        write_wedge_patches(WedgeWriter<VertexChunkPatchAllocator>{fAttribs,
+                                                                   &worstCase,
+                                                                   target,
+                                                                   &fVertexChunkArray,
+                                                                   patchPreallocCount},
+                            shaderMatrix,
+                            pathDrawList);
         fMaxVertexCount = FixedCountWedges::VertexCount(worstCase);
     }
 
@@ -270,13 +380,7 @@ void PathWedgeTessellator::prepare(GrMeshDrawTarget* target,
 }
 
 void PathWedgeTessellator::draw(GrOpFlushState* flushState) const {
-    if (!fFixedVertexBuffer || !fFixedIndexBuffer) {
-        return;
-    }
-    for (const GrVertexChunk& chunk : fVertexChunkArray) {
-        flushState->bindBuffers(fFixedIndexBuffer, chunk.fBuffer, fFixedVertexBuffer);
-        flushState->drawIndexedInstanced(fMaxVertexCount, 0, chunk.fCount, chunk.fBase, 0);
-    }
+    this->drawChunks(flushState);
 }
 
 }  // namespace skgpu::ganesh
@@ -8,6 +8,7 @@
 #ifndef PathTessellator_DEFINED
 #define PathTessellator_DEFINED
 
+#include "include/private/base/SkTArray.h"
 #include "src/base/SkArenaAlloc.h"
 #include "src/gpu/ganesh/GrGpuBuffer.h"
 #include "src/gpu/ganesh/GrVertexChunkArray.h"
@@ -21,6 +22,8 @@ class SkPath;
 
 namespace skgpu::ganesh {
 
+struct ResolveLevelPatchBins;
+
 // Prepares GPU data for, and then draws a path's tessellated geometry. Depending on the subclass,
 // the caller may or may not be required to draw the path's inner fan separately.
 class PathTessellator {
@@ -55,6 +58,15 @@ public:
 
     PatchAttribs patchAttribs() const { return fAttribs; }
 
+    // Every fixed-count instance draws enough vertices for the most complex patch in its draw. If
+    // set before prepare(), patches are instead sorted by the resolve level they require and drawn
+    // with one instanced draw per level, so simple curves don't pay for the complex ones. This
+    // reorders the patches, so it may only be used when the result doesn't depend on their order,
+    // e.g. when stencilling winding counts.
+    void setDrawByResolveLevel(bool drawByResolveLevel) {
+        fDrawByResolveLevel = drawByResolveLevel;
+    }
+
     // Called before draw(). Prepares GPU buffers containing the geometry to tessellate.
     virtual void prepare(GrMeshDrawTarget* target,
                          const SkMatrix& shaderMatrix,
@@ -72,12 +84,24 @@ protected:
         }
     }
 
+    // Copies the sorted patches into a vertex buffer, adding one chunk for each resolve level that
+    // has patches. Each patch draws 'extraTrianglesPerPatch' triangles on top of its curve's.
+    void uploadResolveLevelBins(GrMeshDrawTarget*,
+                                const ResolveLevelPatchBins&,
+                                int extraTrianglesPerPatch);
+
+    // Issues an instanced draw for each chunk of patches.
+    void drawChunks(GrOpFlushState*) const;
+
     PatchAttribs fAttribs;
+    bool fDrawByResolveLevel = false;
 
     GrVertexChunkArray fVertexChunkArray;
     // The max number of vertices that must be drawn to account for the accumulated tessellation
     // levels of the written patches.
     int fMaxVertexCount = 0;
+    // When drawing by resolve level, the number of vertices to draw for each chunk.
+    skia_private::STArray<tess::kMaxResolveLevel + 1, int> fChunkVertexCounts;
 
     sk_sp<const GrGpuBuffer> fFixedVertexBuffer;
     sk_sp<const GrGpuBuffer> fFixedIndexBuffer;
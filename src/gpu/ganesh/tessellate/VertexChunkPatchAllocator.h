@@ -8,8 +8,13 @@
 #ifndef VertexChunkPatchAllocator_DEFINED
 #define VertexChunkPatchAllocator_DEFINED
 
+#include "include/private/base/SkTArray.h"
+#include "include/private/base/SkTo.h"
 #include "src/gpu/ganesh/GrVertexChunkArray.h"
 #include "src/gpu/tessellate/LinearTolerances.h"
+#include "src/gpu/tessellate/Tessellation.h"
+
+#include <algorithm>
 
 namespace skgpu::ganesh {
 
@@ -39,6 +44,32 @@ private:
     GrVertexChunkBuilder    fBuilder;
 };
 
+// CPU-side patch data, sorted by the resolve level each patch requires.
+struct ResolveLevelPatchBins {
+    size_t fStride = 0;
+    int fCounts[tess::kMaxResolveLevel + 1] = {};
+    skia_private::TArray<char> fData[tess::kMaxResolveLevel + 1];
+};
+
+// A PatchAllocator that sorts patches into ResolveLevelPatchBins instead of writing them straight
+// to GPU buffers, so each resolve level can be drawn with only as many vertices as it needs. The
+// bins are copied into a single vertex buffer once the PatchWriter is done.
+class ResolveLevelPatchAllocator {
+public:
+    ResolveLevelPatchAllocator(size_t stride, ResolveLevelPatchBins* bins) : fBins(bins) {
+        fBins->fStride = stride;
+    }
+
+    VertexWriter append(const tess::LinearTolerances& tolerances) {
+        int resolveLevel = std::min(tolerances.requiredResolveLevel(), tess::kMaxResolveLevel);
+        ++fBins->fCounts[resolveLevel];
+        return {fBins->fData[resolveLevel].push_back_n(SkToInt(fBins->fStride)), fBins->fStride};
+    }
+
+private:
+    ResolveLevelPatchBins* fBins;
+};
+
 }  // namespace skgpu::ganesh
 
 #endif // VertexChunkPatchAllocator_DEFINED
@@ -44,6 +44,13 @@ bool GrAtlasManager::hasGlyph(MaskFormat format, Glyph* glyph) {
     return this->getAtlas(format)->hasID(glyph->fAtlasLocator.plotLocator());
 }
 
+bool GrAtlasManager::forwardGlyph(MaskFormat format,
+                                  Glyph* glyph,
+                                  GrDeferredUploadTarget* uploadTarget) {
+    SkASSERT(glyph);
+    return this->getAtlas(format)->forwardLocator(uploadTarget, &glyph->fAtlasLocator);
+}
+
 template <typename INT_TYPE>
 static void expand_bits(INT_TYPE* dst,
                         const uint8_t* src,
@@ -389,7 +396,8 @@ std::tuple<bool, int> GlyphVector::regenerateAtlasForGanesh(
             Glyph* gpuGlyph = variant.glyph;
             SkASSERT(gpuGlyph != nullptr);
 
-            if (!atlasManager->hasGlyph(maskFormat, gpuGlyph)) {
+            if (!atlasManager->hasGlyph(maskFormat, gpuGlyph) &&
+                !atlasManager->forwardGlyph(maskFormat, gpuGlyph, uploadTarget)) {
                 const SkGlyph& skGlyph = *metricsAndImages.glyph(gpuGlyph->fPackedID);
                 auto code = atlasManager->addGlyphToAtlas(
                         skGlyph, gpuGlyph, srcPadding, target->resourceProvider(), uploadTarget);
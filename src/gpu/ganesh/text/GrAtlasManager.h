@@ -53,6 +53,9 @@ public:
 
     bool hasGlyph(skgpu::MaskFormat, sktext::gpu::Glyph*);
 
+    // If the atlas moved the glyph's mask when compacting, point the glyph at where it is now.
+    bool forwardGlyph(skgpu::MaskFormat, sktext::gpu::Glyph*, GrDeferredUploadTarget*);
+
     GrDrawOpAtlas::ErrorCode addGlyphToAtlas(const SkGlyph&,
                                              sktext::gpu::Glyph*,
                                              int srcPadding,
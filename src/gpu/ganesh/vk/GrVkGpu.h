@@ -152,6 +152,10 @@ public:
 
     void onResolveRenderTarget(GrRenderTarget* target, const SkIRect& resolveRect) override;
 
+    // Secondary command buffers are recorded on the flushing thread, one render pass at a time.
+    // Recording them in parallel would need op execution to stop sharing this GrVkGpu's
+    // resource provider, descriptor set and uniform allocators, and pipeline state cache, none
+    // of which are thread safe.
     void submitSecondaryCommandBuffer(std::unique_ptr<GrVkSecondaryCommandBuffer>);
 
     void submit(GrOpsRenderPass*) override;
@@ -7,6 +7,7 @@
 
 #include "include/gpu/GrContextOptions.h"
 #include "include/gpu/GrDirectContext.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
 #include "src/gpu/ganesh/GrFragmentProcessor.h"
 #include "src/gpu/ganesh/GrProcessor.h"
@@ -124,6 +125,7 @@ GrVkPipelineState* GrVkResourceProvider::PipelineStateCache::findOrCreatePipelin
         if (!pipelineState) {
             return nullptr;
         }
+        SkCounters::Add(SkCounters::Counter::kPipelinesCompiled);
         entry = fMap.insert(desc, std::make_unique<Entry>(fGpu, pipelineState));
         return (*entry)->fPipelineState.get();
     }
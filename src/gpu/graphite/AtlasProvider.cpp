@@ -8,6 +8,7 @@
 #include "src/gpu/graphite/AtlasProvider.h"
 
 #include "include/gpu/graphite/Recorder.h"
+#include "src/gpu/graphite/ComputeTask.h"
 #include "src/gpu/graphite/DrawContext.h"
 #include "src/gpu/graphite/Log.h"
 #include "src/gpu/graphite/PathAtlas.h"
@@ -15,6 +16,7 @@
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/RendererProvider.h"
 #include "src/gpu/graphite/TextureProxy.h"
+#include "src/gpu/graphite/compute/DispatchGroup.h"
 #include "src/gpu/graphite/text/TextAtlasManager.h"
 
 namespace skgpu::graphite {
@@ -33,11 +35,30 @@ AtlasProvider::AtlasProvider(Recorder* recorder)
         , fRasterPathAtlas(std::make_unique<RasterPathAtlas>())
         , fPathAtlasFlags(QueryPathAtlasSupport(recorder->priv().caps())) {}
 
-std::unique_ptr<ComputePathAtlas> AtlasProvider::createComputePathAtlas() const {
-    if (this->isAvailable(PathAtlasFlags::kCompute)) {
-        return ComputePathAtlas::CreateDefault();
+ComputePathAtlas* AtlasProvider::getComputePathAtlas() {
+    if (!fComputePathAtlas && this->isAvailable(PathAtlasFlags::kCompute)) {
+        fComputePathAtlas = ComputePathAtlas::CreateDefault();
     }
-    return nullptr;
+    return fComputePathAtlas.get();
+}
+
+bool AtlasProvider::hasPendingComputePathAtlasMasks() const {
+    return fComputePathAtlas && fComputePathAtlas->hasMasks();
+}
+
+sk_sp<Task> AtlasProvider::snapComputePathAtlasTask(Recorder* recorder) {
+    if (!this->hasPendingComputePathAtlasMasks()) {
+        return nullptr;
+    }
+    auto dispatchGroup = fComputePathAtlas->recordDispatches(recorder);
+    fComputePathAtlas->reset();
+    if (!dispatchGroup) {
+        return nullptr;
+    }
+
+    ComputeTask::DispatchGroupList dispatchGroups;
+    dispatchGroups.push_back(std::move(dispatchGroup));
+    return ComputeTask::Make(std::move(dispatchGroups));
 }
 
 RasterPathAtlas* AtlasProvider::getRasterPathAtlas() const {
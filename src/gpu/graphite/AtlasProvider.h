@@ -24,6 +24,7 @@ class DrawContext;
 class PathAtlas;
 class RasterPathAtlas;
 class Recorder;
+class Task;
 class TextAtlasManager;
 class TextureProxy;
 
@@ -57,10 +58,18 @@ public:
         return SkToBool(fPathAtlasFlags & atlasType);
     }
 
-    // Creates a new transient atlas handler that uses compute shaders to rasterize coverage masks
-    // for path rendering. This method returns nullptr if compute shaders are not supported by the
-    // owning Recorder's context.
-    std::unique_ptr<ComputePathAtlas> createComputePathAtlas() const;
+    // Gets the atlas handler that uses compute shaders to rasterize coverage masks for path
+    // rendering. It is shared by all Devices of the owning Recorder. This method returns nullptr if
+    // compute shaders are not supported by the owning Recorder's context.
+    ComputePathAtlas* getComputePathAtlas();
+
+    // Returns true if shapes have been added to the compute path atlas since it was last snapped.
+    bool hasPendingComputePathAtlasMasks() const;
+
+    // Records the compute dispatches that render every pending mask of the compute path atlas
+    // into a single ComputeTask and resets the atlas. The task must be added to the Recorder before
+    // the tasks of any draws that sample the masks. Returns nullptr if there is nothing to render.
+    sk_sp<Task> snapComputePathAtlasTask(Recorder*);
 
     // Gets the atlas handler that uses the CPU raster pipeline to create coverage masks
     // for path rendering.
@@ -91,13 +100,20 @@ private:
     // upload.
     std::unique_ptr<RasterPathAtlas> fRasterPathAtlas;
 
+    // Accumulates the coverage masks rendered by compute shaders for the pending draws of every
+    // Device of the Recorder. Batching them lets a single DispatchGroup render the masks of a whole
+    // flush, instead of one per DrawPass. The Recorder snaps the dispatches before it flushes its
+    // Devices, and a Device that is flushed on its own while the atlas has masks flushes all of
+    // them, since their draws may be sampling the same atlas texture. Lazily created.
+    std::unique_ptr<ComputePathAtlas> fComputePathAtlas;
+
     // Allocated and cached texture proxies shared by all PathAtlas instances. It is possible for
     // the same texture to be bound to multiple DispatchGroups and DrawPasses across flushes. The
     // owning Recorder must guarantee that any uploads or compute dispatches are scheduled to remain
     // coherent across flushes.
     // TODO: This requirement might change with a more sophisticated reuse scheme for texture
     // allocations. For now our model is simple: all PathAtlases target the same texture and only
-    // one of them will render to the texture during a given command submission.
+    // one of them will render to the texture between two flushes of the Recorder's Devices.
     std::unordered_map<uint64_t, sk_sp<TextureProxy>> fTexturePool;
 
     PathAtlasFlagsBitMask fPathAtlasFlags = PathAtlasFlags::kNone;
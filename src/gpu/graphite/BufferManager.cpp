@@ -30,6 +30,12 @@ static constexpr size_t kIndexBufferSize =   2 << 10; //  2 KB
 static constexpr size_t kUniformBufferSize = 2 << 10; //  2 KB
 static constexpr size_t kStorageBufferSize = 2 << 10; //  2 KB
 
+// Persistent uniform buffers are retired once full, so they're made large enough to hold all of
+// the static uniforms of a typical frame. Blocks larger than a fraction of that are not worth
+// keeping, since they would fill the buffer after a few frames.
+static constexpr size_t kPersistentUniformBufferSize = 256 << 10; // 256 KB
+static constexpr size_t kMaxPersistentUniformBlockSize = kPersistentUniformBufferSize / 16;
+
 // The limit for all data created by the StaticBufferManager. This data remains alive for
 // the entire SharedContext so we want to keep it small and give a concrete upper bound to
 // clients for our steady-state memory usage.
@@ -91,7 +97,9 @@ DrawBufferManager::DrawBufferManager(ResourceProvider* resourceProvider,
                 { BufferType::kStorage,       kStorageBufferSize, caps },  // GPU-only storage
                 { BufferType::kVertexStorage, kVertexBufferSize,  caps },
                 { BufferType::kIndexStorage,  kIndexBufferSize,   caps },
-                { BufferType::kIndirect,      kStorageBufferSize, caps } }} {}
+                { BufferType::kIndirect,      kStorageBufferSize, caps } }}
+        , fSupportsPersistentUniforms(caps->drawBufferCanBeMapped() &&
+                                      !caps->bufferMapsAreAsync()) {}
 
 DrawBufferManager::~DrawBufferManager() {}
 
@@ -117,6 +125,66 @@ std::tuple<VertexWriter, BindBufferInfo> DrawBufferManager::getVertexWriter(size
     return {VertexWriter(ptr, requiredBytes), bindInfo};
 }
 
+BindBufferInfo DrawBufferManager::getPersistentUniforms(const UniformDataBlock& uniforms) {
+    if (!fSupportsPersistentUniforms || !uniforms.size() ||
+        uniforms.size() > kMaxPersistentUniformBlockSize) {
+        return {};
+    }
+
+    PersistentUniforms& persistent = fPersistentUniforms;
+    if (persistent.fBlocks) {
+        const UniformDataBlock* block = persistent.fBlocks->insert(uniforms);
+        if (const size_t* offset = persistent.fOffsets.find(block)) {
+            persistent.fUsedByRecording = true;
+            return {persistent.fBuffer.get(), *offset};
+        }
+    }
+
+    const size_t blockSize = this->alignUniformBlockSize(uniforms.size());
+    if (persistent.fBuffer && !can_fit(blockSize,
+                                       persistent.fBuffer->size(),
+                                       persistent.fOffset,
+                                       fCurrentBuffers[kUniformBufferIndex].fStartAlignment)) {
+        this->retirePersistentUniforms();
+    }
+    if (!persistent.fBuffer) {
+        persistent.fBuffer = fResourceProvider->findOrCreateBuffer(kPersistentUniformBufferSize,
+                                                                   BufferType::kUniform,
+                                                                   AccessPattern::kHostVisible);
+        if (!persistent.fBuffer) {
+            return {};
+        }
+        persistent.fOffset = 0;
+        persistent.fBlocks = std::make_unique<UniformDataCache>();
+    }
+
+    void* mapPtr = persistent.fBuffer->map();
+    if (!mapPtr) {
+        return {};
+    }
+    size_t offset = SkAlignTo(persistent.fOffset,
+                              fCurrentBuffers[kUniformBufferIndex].fStartAlignment);
+    memcpy(SkTAddOffset<void>(mapPtr, static_cast<ptrdiff_t>(offset)),
+           uniforms.data(),
+           uniforms.size());
+    persistent.fOffset = offset + blockSize;
+    persistent.fUsedByRecording = true;
+    persistent.fOffsets.set(persistent.fBlocks->insert(uniforms), offset);
+    return {persistent.fBuffer.get(), offset};
+}
+
+void DrawBufferManager::retirePersistentUniforms() {
+    PersistentUniforms& persistent = fPersistentUniforms;
+    if (persistent.fBuffer && persistent.fUsedByRecording) {
+        fUsedBuffers.emplace_back(std::move(persistent.fBuffer), BindBufferInfo{});
+    }
+    persistent.fBuffer.reset();
+    persistent.fOffset = 0;
+    persistent.fUsedByRecording = false;
+    persistent.fBlocks.reset();
+    persistent.fOffsets.reset();
+}
+
 void DrawBufferManager::returnVertexBytes(size_t unusedBytes) {
     SkASSERT(fCurrentBuffers[kVertexBufferIndex].fOffset >= unusedBytes);
     fCurrentBuffers[kVertexBufferIndex].fOffset -= unusedBytes;
@@ -223,6 +291,16 @@ void DrawBufferManager::transferToRecording(Recording* recording) {
         recording->priv().addTask(ClearBuffersTask::Make(std::move(fClearList)));
     }
 
+    // The current persistent uniform buffer stays with this manager, so later Recordings can keep
+    // reusing its contents; this Recording just needs a ref if it reads from it.
+    if (fPersistentUniforms.fBuffer && fPersistentUniforms.fUsedByRecording) {
+        if (fPersistentUniforms.fBuffer->isMapped()) {
+            fPersistentUniforms.fBuffer->unmap();
+        }
+        recording->priv().addResourceRef(fPersistentUniforms.fBuffer);
+        fPersistentUniforms.fUsedByRecording = false;
+    }
+
     for (auto& [buffer, transferBuffer] : fUsedBuffers) {
         if (transferBuffer) {
             SkASSERT(buffer);
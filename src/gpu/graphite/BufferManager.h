@@ -10,12 +10,15 @@
 
 #include "include/core/SkRefCnt.h"
 #include "include/private/base/SkTArray.h"
+#include "src/core/SkTHash.h"
 #include "src/gpu/BufferWriter.h"
 #include "src/gpu/graphite/DrawTypes.h"
+#include "src/gpu/graphite/PipelineDataCache.h"
 #include "src/gpu/graphite/ResourceTypes.h"
 #include "src/gpu/graphite/UploadBufferManager.h"
 
 #include <array>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -56,6 +59,14 @@ public:
     BindBufferInfo getIndexStorage(size_t requiredBytes);
     BindBufferInfo getIndirectStorage(size_t requiredBytes);
 
+    // Returns the location of a copy of 'uniforms' in a uniform buffer that persists across
+    // Recordings. Identical data that was written by an earlier Recording is reused in place, so
+    // uniforms that don't change from frame to frame are only copied and uploaded once. Each block
+    // takes up alignUniformBlockSize(uniforms.size()) bytes. Returns an empty binding if persistent
+    // uniforms aren't supported, or the data is too large for them, in which case the caller should
+    // fall back to getUniformWriter().
+    BindBufferInfo getPersistentUniforms(const UniformDataBlock& uniforms);
+
     // Returns the last 'unusedBytes' from the last call to getVertexWriter(). Assumes that
     // 'unusedBytes' is less than the 'requiredBytes' to the original allocation.
     void returnVertexBytes(size_t unusedBytes);
@@ -88,6 +99,10 @@ private:
                                      bool supportCpuUpload = false,
                                      ClearBuffer cleared = ClearBuffer::kNo);
 
+    // Stops adding to the current persistent uniform buffer, handing it to the current Recording
+    // if that used it. Earlier Recordings keep their own refs to it.
+    void retirePersistentUniforms();
+
     ResourceProvider* const fResourceProvider;
     const Caps* const fCaps;
     UploadBufferManager* fUploadManager;
@@ -107,6 +122,24 @@ private:
 
     // List of buffer regions that were requested to be cleared at the time of allocation.
     skia_private::TArray<ClearBufferInfo> fClearList;
+
+    // Uniform data that outlives a single Recording. It's only used when draw buffers can be mapped
+    // synchronously, so that writes land directly in the buffer the GPU reads from, rather than in
+    // a transfer buffer whose copy would belong to just one Recording. Blocks are appended without
+    // ever overwriting earlier ones, which may still be read by Recordings in flight. Once the
+    // buffer is full it is retired and a new one is started, like a ring whose slots are freed as
+    // the Recordings that reference them finish.
+    struct PersistentUniforms {
+        sk_sp<Buffer> fBuffer;
+        size_t fOffset = 0;
+        // Whether any block in fBuffer has been used since the last transferToRecording().
+        bool fUsedByRecording = false;
+        // Copies of the blocks in fBuffer, for matching new data against, and their offsets.
+        std::unique_ptr<UniformDataCache> fBlocks;
+        skia_private::THashMap<const UniformDataBlock*, size_t> fOffsets;
+    };
+    const bool fSupportsPersistentUniforms;
+    PersistentUniforms fPersistentUniforms;
 };
 
 /**
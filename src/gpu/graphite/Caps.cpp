@@ -34,6 +34,8 @@ void Caps::finishInitialization(const ContextOptions& options) {
     } else {
         fShaderErrorHandler = DefaultShaderErrorHandler();
     }
+    fPersistentCache = options.fPersistentCache;
+    fPreferComputePathAtlas = options.fPreferComputePathAtlas;
 
 #if defined(GRAPHITE_TEST_UTILS)
     if (options.fOptionsPriv) {
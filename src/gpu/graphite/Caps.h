@@ -14,6 +14,7 @@
 
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
+#include "include/gpu/graphite/ContextOptions.h"
 #include "include/private/base/SkAlign.h"
 #include "src/base/SkEnumBitMask.h"
 #include "src/gpu/ResourceKey.h"
@@ -35,7 +36,6 @@ namespace skgpu { class ShaderErrorHandler; }
 namespace skgpu::graphite {
 
 enum class BufferType : int;
-struct ContextOptions;
 class ComputePipelineDesc;
 class GraphicsPipelineDesc;
 class GraphiteResourceKey;
@@ -232,6 +232,10 @@ public:
 
     skgpu::ShaderErrorHandler* shaderErrorHandler() const { return fShaderErrorHandler; }
 
+    ContextOptions::PersistentCache* persistentCache() const { return fPersistentCache; }
+
+    bool preferComputePathAtlas() const { return fPreferComputePathAtlas; }
+
     // Returns what method of dst read is required for a draw using the dst color.
     DstReadRequirement getDstReadRequirement() const;
 
@@ -333,6 +337,9 @@ protected:
      */
     ShaderErrorHandler* fShaderErrorHandler = nullptr;
 
+    ContextOptions::PersistentCache* fPersistentCache = nullptr;
+    bool fPreferComputePathAtlas = false;
+
 #if defined(GRAPHITE_TEST_UTILS)
     std::string fDeviceName;
     int fMaxTextureAtlasSize = 2048;
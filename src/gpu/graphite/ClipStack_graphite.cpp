@@ -10,6 +10,7 @@
 #include "include/core/SkMatrix.h"
 #include "include/core/SkShader.h"
 #include "include/core/SkStrokeRec.h"
+#include "include/private/base/SkTPin.h"
 #include "src/base/SkTLazy.h"
 #include "src/core/SkPathPriv.h"
 #include "src/core/SkRRectPriv.h"
@@ -20,6 +21,8 @@
 #include "src/gpu/graphite/geom/BoundsManager.h"
 #include "src/gpu/graphite/geom/Geometry.h"
 
+using namespace skia_private;
+
 namespace skgpu::graphite {
 
 namespace {
@@ -952,6 +955,99 @@ void ClipStack::SaveRecord::replaceWithElement(RawElement&& toAdd,
     fOldestValidIndex = fStartingElementIndex;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// ClipStack::ElementGrid
+
+ClipStack::ElementGrid::ElementGrid(const Rect& deviceBounds)
+        : fCellSize(deviceBounds.size() / kGridSize) {
+    SkASSERT(all(deviceBounds.topLeft() == 0.f));
+}
+
+int ClipStack::ElementGrid::cellX(float x) const {
+    return static_cast<int>(SkTPin<float>(x / fCellSize.x(), 0.f, kGridSize - 1));
+}
+
+int ClipStack::ElementGrid::cellY(float y) const {
+    return static_cast<int>(SkTPin<float>(y / fCellSize.y(), 0.f, kGridSize - 1));
+}
+
+void ClipStack::ElementGrid::update(const RawElement::Stack& elements) {
+    const int count = elements.count();
+    if (fValidCount < fGridCount) {
+        // Every cell lists its elements in stack order, so the stale ones are at the end.
+        for (TArray<Entry>& cell : fCells) {
+            while (!cell.empty() && cell.back().fIndex >= fValidCount) {
+                cell.pop_back();
+            }
+        }
+        fGridCount = fValidCount;
+    }
+    if (fGridCount == count) {
+        return;
+    }
+
+    // The new elements are on top of the stack, so walk down to them and add them back in order.
+    STArray<16, const RawElement*> added;
+    int i = count - 1;
+    for (const RawElement& e : elements.ritems()) {
+        if (i < fGridCount) {
+            break;
+        }
+        added.push_back(&e);
+        --i;
+    }
+    for (int j = added.size() - 1; j >= 0; --j) {
+        this->add(count - 1 - j, *added[j]);
+    }
+    fValidCount = fGridCount = count;
+}
+
+void ClipStack::ElementGrid::add(int index, const RawElement& element) {
+    // Outset by a pixel, since visitClipStackForDraw() restricts draws to the rounded out scissor
+    // and so a draw can extend just past the outer bounds of the intersect elements.
+    const Rect bounds = element.outerBounds().makeOutset(1.f);
+    const int x0 = this->cellX(bounds.left()), x1 = this->cellX(bounds.right());
+    const int y0 = this->cellY(bounds.top()),  y1 = this->cellY(bounds.bot());
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            const Rect cell = Rect::XYWH(skvx::float2(x, y) * fCellSize, fCellSize);
+            if (element.op() == SkClipOp::kIntersect && element.innerBounds().contains(cell)) {
+                // Any draw within this cell is inside the element's full coverage.
+                continue;
+            }
+            fCells[y * kGridSize + x].push_back({index, &element});
+        }
+    }
+}
+
+void ClipStack::ElementGrid::elementsNear(const Rect& drawBounds,
+                                          int oldestIndex,
+                                          TArray<const RawElement*>* elements) const {
+    SkASSERT(fValidCount == fGridCount);
+    STArray<16, Entry> entries;
+    const int x0 = this->cellX(drawBounds.left()), x1 = this->cellX(drawBounds.right());
+    const int y0 = this->cellY(drawBounds.top()),  y1 = this->cellY(drawBounds.bot());
+    for (int y = y0; y <= y1; ++y) {
+        for (int x = x0; x <= x1; ++x) {
+            const TArray<Entry>& cell = fCells[y * kGridSize + x];
+            // Only the end of each cell's list is at or above 'oldestIndex'.
+            for (int i = cell.size() - 1; i >= 0 && cell[i].fIndex >= oldestIndex; --i) {
+                entries.push_back(cell[i]);
+            }
+        }
+    }
+
+    // Elements spanning several cells are listed by each of them.
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.fIndex > b.fIndex;
+    });
+    for (int i = 0; i < entries.size(); ++i) {
+        if (i == 0 || entries[i].fIndex != entries[i - 1].fIndex) {
+            elements->push_back(entries[i].fElement);
+        }
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // ClipStack
 
@@ -990,6 +1086,9 @@ void ClipStack::restore() {
     // When we remove a save record, we delete all elements >= its starting index and any masks
     // that were rasterized for it.
     current.removeElements(&fElements, fDevice);
+    if (fElementGrid) {
+        fElementGrid->invalidateFrom(current.firstActiveElementIndex());
+    }
 
     fSaves.pop_back();
     // Restore any remaining elements that were only invalidated by the now-removed save record.
@@ -1074,6 +1173,10 @@ void ClipStack::clipShape(const Transform& localToDevice,
 
     bool wasDeferred;
     SaveRecord& save = this->writableSaveRecord(&wasDeferred);
+    if (fElementGrid) {
+        // Adding the element may modify or remove any of the elements the record owns.
+        fElementGrid->invalidateFrom(save.firstActiveElementIndex());
+    }
     SkDEBUGCODE(int elementCount = fElements.count();)
     if (!save.addElement(std::move(element), &fElements, fDevice)) {
         if (wasDeferred) {
@@ -1224,23 +1327,55 @@ Clip ClipStack::visitClipStackForDraw(const Transform& localToDevice,
 
     SkASSERT(outEffectiveElements);
     SkASSERT(outEffectiveElements->empty());
-    int i = fElements.count();
-    for (const RawElement& e : fElements.ritems()) {
-        --i;
-        if (i < cs.oldestElementIndex()) {
-            // All earlier elements have been invalidated by elements already processed so the draw
-            // can't be affected by them and cannot contribute to their usage bounds.
-            break;
-        }
-
+    // Returns false if the element clips out the draw.
+    auto applyElement = [&](const RawElement& e) {
         auto influence = e.testForDraw(draw);
         if (influence == RawElement::DrawInfluence::kClipOut) {
             outEffectiveElements->clear();
-            return kClippedOut;
+            return false;
         }
         if (influence == RawElement::DrawInfluence::kIntersect) {
             outEffectiveElements->push_back(&e);
         }
+        return true;
+    };
+
+    // All elements older than the oldest valid index have been invalidated by newer elements so
+    // the draw can't be affected by them and cannot contribute to their usage bounds.
+    if (fElements.count() - cs.oldestElementIndex() >= ElementGrid::kMinElements) {
+        if (!fElementGrid) {
+            fElementGrid = std::make_unique<ElementGrid>(deviceBounds);
+        }
+        fElementGrid->update(fElements);
+
+        STArray<16, const RawElement*> nearby;
+        fElementGrid->elementsNear(drawBounds, cs.oldestElementIndex(), &nearby);
+        for (const RawElement* e : nearby) {
+            if (!applyElement(*e)) {
+                return kClippedOut;
+            }
+        }
+#if defined(SK_DEBUG)
+        // The grid should only have left out elements that don't affect the draw.
+        int i = fElements.count();
+        for (const RawElement& e : fElements.ritems()) {
+            if (--i < cs.oldestElementIndex()) {
+                break;
+            }
+            SkASSERT(e.testForDraw(draw) == RawElement::DrawInfluence::kNone ||
+                     std::find(nearby.begin(), nearby.end(), &e) != nearby.end());
+        }
+#endif
+    } else {
+        int i = fElements.count();
+        for (const RawElement& e : fElements.ritems()) {
+            if (--i < cs.oldestElementIndex()) {
+                break;
+            }
+            if (!applyElement(e)) {
+                return kClippedOut;
+            }
+        }
     }
 
     return Clip(drawBounds, transformedShapeBounds, scissor.asSkIRect(), cs.shader());
@@ -16,6 +16,9 @@
 #include "src/gpu/graphite/geom/Shape.h"
 #include "src/gpu/graphite/geom/Transform_graphite.h"
 
+#include <algorithm>
+#include <memory>
+
 class SkShader;
 class SkStrokeRec;
 
@@ -323,6 +326,52 @@ private:
         ClipState fState;
     };
 
+    // A uniform grid over the device that lists, for each cell, the elements that could affect a
+    // draw touching that cell: difference elements whose outer bounds overlap the cell, and
+    // intersect elements whose inner bounds don't cover it. With deep element stacks, this lets
+    // visitClipStackForDraw() test just the elements near a draw instead of every one of them.
+    //
+    // Elements are only modified or removed at or above the current SaveRecord's first active
+    // index, so the grid is updated lazily: changes to the stack lower the number of elements the
+    // grid is known to reflect, and the next draw that uses the grid adds back everything above it.
+    class ElementGrid {
+    public:
+        // Below this many elements to test, it's faster to test all of them.
+        static constexpr int kMinElements = 16;
+
+        explicit ElementGrid(const Rect& deviceBounds);
+
+        // Elements at 'index' and above may have changed or been removed.
+        void invalidateFrom(int index) { fValidCount = std::min(fValidCount, index); }
+
+        void update(const RawElement::Stack& elements);
+
+        // Fills 'elements' with every element at or above 'oldestIndex' that could affect a draw
+        // within 'drawBounds', from most recent to oldest.
+        void elementsNear(const Rect& drawBounds,
+                          int oldestIndex,
+                          skia_private::TArray<const RawElement*>* elements) const;
+
+    private:
+        static constexpr int kGridSize = 16;
+
+        struct Entry {
+            int fIndex;
+            const RawElement* fElement;
+        };
+
+        void add(int index, const RawElement& element);
+
+        int cellX(float x) const;
+        int cellY(float y) const;
+
+        // Cells are stored row-major, each listing its elements from oldest to most recent.
+        skia_private::TArray<Entry> fCells[kGridSize * kGridSize];
+        skvx::float2 fCellSize;
+        int fGridCount = 0;  // Elements [0, fGridCount) have been added to the grid...
+        int fValidCount = 0; // ... and of those, [0, fValidCount) haven't changed since.
+    };
+
     Rect deviceBounds() const;
 
     const SaveRecord& currentSaveRecord() const {
@@ -337,6 +386,9 @@ private:
     RawElement::Stack fElements;
     SaveRecord::Stack fSaves; // always has one wide open record at the top
 
+    // Created the first time a draw has enough elements to test for it to be worthwhile.
+    mutable std::unique_ptr<ElementGrid> fElementGrid;
+
     Device* fDevice; // the device this clip stack is coupled with
 };
 
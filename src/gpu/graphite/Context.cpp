@@ -18,6 +18,8 @@
 #include "include/gpu/graphite/TextureInfo.h"
 #include "src/base/SkRectMemcpy.h"
 #include "src/core/SkConvertPixels.h"
+#include "src/core/SkCountersPriv.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/core/SkYUVMath.h"
 #include "src/gpu/RefCntedCallback.h"
@@ -85,6 +87,9 @@ Context::Context(sk_sp<SharedContext> sharedContext,
                                                              SK_InvalidGenID,
                                                              options.fGpuBudgetInBytes);
     fMappedBufferManager = std::make_unique<ClientMappedBufferManager>(this->contextID());
+    if (options.fExecutor) {
+        fPrecompileTasks = std::make_unique<SkTaskGroup>(*options.fExecutor);
+    }
 #if defined(GRAPHITE_TEST_UTILS)
     if (options.fOptionsPriv) {
         fStoreContextRefInRecorder = options.fOptionsPriv->fStoreContextRefInRecorder;
@@ -93,6 +98,10 @@ Context::Context(sk_sp<SharedContext> sharedContext,
 }
 
 Context::~Context() {
+    if (fPrecompileTasks) {
+        // Pending compilation uses the SharedContext, which the client may destroy with us.
+        fPrecompileTasks->wait();
+    }
 #if defined(GRAPHITE_TEST_UTILS)
     ASSERT_SINGLE_OWNER
     for (auto& recorder : fTrackedRecorders) {
@@ -138,12 +147,22 @@ std::unique_ptr<Recorder> Context::makeRecorder(const RecorderOptions& options)
 }
 
 bool Context::insertRecording(const InsertRecordingInfo& info) {
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     ASSERT_SINGLE_OWNER
+    SkCounters::AutoCountFlush countFlush;
 
-    return fQueueManager->addRecording(info, this);
+    if (!fQueueManager->addRecording(info, this)) {
+        return false;
+    }
+    // Any Recording inserted from now on is ordered after this one's uploads, so other Recorders
+    // may now draw with the textures it uploaded.
+    fSharedContext->globalCache()->publishUploadedProxies(
+            info.fRecording->priv().sharedProxyUploads());
+    return true;
 }
 
 bool Context::submit(SyncToCpu syncToCpu) {
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     ASSERT_SINGLE_OWNER
 
     if (syncToCpu == SyncToCpu::kYes && !fSharedContext->caps()->allowCpuSync()) {
@@ -799,6 +818,21 @@ void Context::dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const {
     // used bytes here (see Ganesh implementation).
 }
 
+ResourceCacheStats Context::resourceCacheStats() const {
+    ASSERT_SINGLE_OWNER
+    return fResourceProvider->getResourceCacheStats();
+}
+
+void Context::resetResourceCacheStats() {
+    ASSERT_SINGLE_OWNER
+    fResourceProvider->resetResourceCacheStats();
+}
+
+void Context::setResourceCategoryBudget(ResourceCategory category, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    fResourceProvider->setResourceCategoryBudget(category, maxBytes);
+}
+
 bool Context::supportsProtectedContent() const {
     return fSharedContext->isProtected() == Protected::kYes;
 }
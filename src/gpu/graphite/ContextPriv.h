@@ -49,6 +49,13 @@ public:
     ResourceProvider* resourceProvider() const {
         return fContext->fResourceProvider.get();
     }
+    SharedContext* sharedContext() const {
+        return fContext->fSharedContext.get();
+    }
+    // Null unless the Context was made with a ContextOptions::fExecutor.
+    SkTaskGroup* precompileTasks() const {
+        return fContext->fPrecompileTasks.get();
+    }
 
 #if defined(GRAPHITE_TEST_UTILS)
     void startCapture() {
@@ -654,10 +654,13 @@ void Device::drawPaint(const SkPaint& paint) {
                 fDC->clear(*color);
                 return;
             }
-            // TODO(michaelludwig): this paint doesn't depend on the destination, so we can reset
-            // the DrawContext to use a discard load op. The drawPaint will cover anything else
-            // entirely. We still need shader evaluation to get per-pixel colors (since the paint
-            // couldn't be reduced to a solid color).
+            // This paint doesn't depend on the destination, and the drawPaint will cover it
+            // entirely, so the render pass doesn't need to load what came before. We still need
+            // shader evaluation to get per-pixel colors (since the paint couldn't be reduced to a
+            // solid color). A mask filter could leave some pixels uncovered, though.
+            if (!paint.getMaskFilter()) {
+                fDC->discard();
+            }
         }
     }
 
@@ -940,9 +943,18 @@ void Device::drawGeometry(const Transform& localToDevice,
         // that should be detected now as well. Maybe add dashPath to Device so canvas can handle it
         SkStrokeRec newStyle = style;
         newStyle.setResScale(localToDevice.maxScaleFactor());
+        // As the raster backend does, give the effect the local bounds of the clip (outset for AA),
+        // so that dashing can skip the parts of the path that can't be seen.
+        SkRect cullRect;
+        const SkRect* cullRectPtr = nullptr;
+        if (localToDevice.type() != Transform::Type::kProjection) {
+            cullRect = localToDevice.inverseMapRect(fClip.conservativeBounds().makeOutset(1.f))
+                                    .asSkRect();
+            cullRectPtr = &cullRect;
+        }
         SkPath dst;
         if (paint.getPathEffect()->filterPath(&dst, geometry.shape().asPath(), &newStyle,
-                                              nullptr, localToDevice)) {
+                                              cullRectPtr, localToDevice)) {
             // Recurse using the path and new style, while disabling downstream path effect handling
             this->drawGeometry(localToDevice, Geometry(Shape(dst)), paint, newStyle,
                                flags | DrawFlags::kIgnorePathEffect, std::move(primitiveBlender),
@@ -1260,7 +1272,9 @@ std::pair<const Renderer*, PathAtlas*> Device::chooseRenderer(const Transform& l
     // Path rendering options. For now the strategy is very simple and not optimal:
     // I. Use tessellation if MSAA is required for an effect.
     // II: otherwise:
-    //    1. Always use compute AA if supported unless it was excluded by ContextOptions.
+    //    1. Always use compute AA if supported unless it was excluded by ContextOptions. If
+    //       ContextOptions::fPreferComputePathAtlas is set, this includes every path that fits in
+    //       the atlas, not just those that are cheap to atlas.
     //    2. Use CPU raster AA if hardware MSAA is disabled or it was explicitly requested by
     //       ContextOptions.
     //    3. Otherwise use tessellation.
@@ -1280,6 +1294,7 @@ std::pair<const Renderer*, PathAtlas*> Device::chooseRenderer(const Transform& l
 
     PathAtlas* pathAtlas = nullptr;
     bool msaaSupported = fRecorder->priv().caps()->defaultMSAASamplesCount() > 1;
+    bool preferComputeAtlas = false;
 
     // Prefer compute atlas draws if supported. This currently implicitly filters out clip draws as
     // they require MSAA. Eventually we may want to route clip shapes to the atlas as well but not
@@ -1288,7 +1303,9 @@ std::pair<const Renderer*, PathAtlas*> Device::chooseRenderer(const Transform& l
     if (atlasProvider->isAvailable(AtlasProvider::PathAtlasFlags::kCompute) &&
         (strategy == PathRendererStrategy::kComputeAnalyticAA ||
          strategy == PathRendererStrategy::kDefault)) {
-        pathAtlas = fDC->getComputePathAtlas(fRecorder);
+        pathAtlas = atlasProvider->getComputePathAtlas();
+        preferComputeAtlas = strategy == PathRendererStrategy::kDefault &&
+                             fRecorder->priv().caps()->preferComputePathAtlas();
     // Only use CPU rendered paths when multisampling is disabled
     // TODO: enable other uses of the software path renderer
     } else if (atlasProvider->isAvailable(AtlasProvider::PathAtlasFlags::kRaster) &&
@@ -1315,7 +1332,12 @@ std::pair<const Renderer*, PathAtlas*> Device::chooseRenderer(const Transform& l
         // get evaluated again if we fall back to a different renderer).
         Rect drawBounds = localToDevice.mapRect(shape.bounds());
         drawBounds.intersect(fClip.conservativeBounds());
-        if (pathAtlas->isSuitableForAtlasing(drawBounds)) {
+        if (preferComputeAtlas) {
+            skvx::float2 maskSize = drawBounds.makeRoundOut().size();
+            if (maskSize.x() <= pathAtlas->width() && maskSize.y() <= pathAtlas->height()) {
+                return {renderers->coverageMask(), pathAtlas};
+            }
+        } else if (pathAtlas->isSuitableForAtlasing(drawBounds)) {
             return {renderers->coverageMask(), pathAtlas};
         }
     }
@@ -1372,6 +1394,14 @@ void Device::flushPendingWorkToRecorder() {
     TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     SkASSERT(fRecorder);
 
+    // The compute path atlas is shared by every Device of the Recorder and its masks are rendered
+    // by a single dispatch group before any of their draws. If it has masks, other Devices may
+    // have pending draws that sample them too, so they all need to be flushed together.
+    if (fRecorder->priv().atlasProvider()->hasPendingComputePathAtlasMasks()) {
+        fRecorder->priv().flushTrackedDevices();
+        return;
+    }
+
     // TODO: we may need to further split this function up since device->device drawList and
     // DrawPass stealing will need to share some of the same logic w/o becoming a Task.
 
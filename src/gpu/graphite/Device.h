@@ -151,7 +151,9 @@ public:
 
     void drawDrawable(SkCanvas*, SkDrawable*, const SkMatrix*) override {}
     void drawMesh(const SkMesh&, sk_sp<SkBlender>, const SkPaint&) override {}
-    void drawShadow(const SkPath&, const SkDrawShadowRec&) override {}
+    // drawShadow() is left to SkDevice, which draws the shadow tessellations that SkShadowUtils
+    // caches per path with drawVertices() and the Gaussian color filter, both of which Graphite
+    // supports.
 
     // Special images and layers
     sk_sp<SkSurface> makeSurface(const SkImageInfo&, const SkSurfaceProps&) override;
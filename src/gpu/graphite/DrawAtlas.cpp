@@ -122,6 +122,14 @@ inline bool DrawAtlas::updatePlot(AtlasLocator* atlasLocator, Plot* plot) {
     return true;
 }
 
+bool DrawAtlas::forwardLocator(AtlasLocator* atlasLocator) {
+    if (!fRelocations.forward(atlasLocator) || !this->hasID(atlasLocator->plotLocator())) {
+        return false;
+    }
+    Plot* plot = fPages[atlasLocator->pageIndex()].fPlotArray[atlasLocator->plotIndex()].get();
+    return this->updatePlot(atlasLocator, plot);
+}
+
 bool DrawAtlas::addToPage(unsigned int pageIdx, int width, int height, const void* image,
                           AtlasLocator* atlasLocator) {
     SkASSERT(fProxies[pageIdx]);
@@ -345,7 +353,7 @@ void DrawAtlas::compact(AtlasToken startTokenForNextFlush) {
         }
 
         // If recently used plots in the last page are using less than a quarter of the page, try
-        // to evict them if there's available space in lower index pages. Since we prioritize
+        // to move them if there's available space in lower index pages. Since we prioritize
         // uploading to the first pages, this will eventually clear out usage of this page unless
         // we have a large need.
         if (availablePlots.size() && usedPlots && usedPlots <= fNumPlots / 4) {
@@ -353,12 +361,11 @@ void DrawAtlas::compact(AtlasToken startTokenForNextFlush) {
             while (Plot* plot = plotIter.get()) {
                 // If this plot was used recently
                 if (plot->flushesSinceLastUsed() <= kPlotRecentlyUsedCount) {
-                    // See if there's room in an lower index page and if so evict.
+                    // See if there's room in an lower index page and if so move the plot there.
                     // We need to be somewhat harsh here so that a handful of plots that are
                     // consistently in use don't end up locking the page in memory.
                     if (availablePlots.size() > 0) {
-                        this->processEvictionAndResetRects(plot);
-                        this->processEvictionAndResetRects(availablePlots.back());
+                        this->relocatePlot(plot, availablePlots.back());
                         availablePlots.pop_back();
                         --usedPlots;
                     }
@@ -381,9 +388,19 @@ void DrawAtlas::compact(AtlasToken startTokenForNextFlush) {
         }
     }
 
+    fRelocations.prune([this](PlotLocator plotLocator) { return this->hasID(plotLocator); });
     fPrevFlushToken = startTokenForNextFlush;
 }
 
+void DrawAtlas::relocatePlot(Plot* from, Plot* to) {
+    SkASSERT(to->pageIndex() < from->pageIndex());
+    this->processEvictionAndResetRects(to);
+    to->copySubImagesFrom(*from);
+    fRelocations.add(*from, *to);
+    this->makeMRU(to, to->pageIndex());
+    this->processEvictionAndResetRects(from);
+}
+
 bool DrawAtlas::createPages(AtlasGenerationCounter* generationCounter) {
     SkASSERT(SkIsPow2(fTextureWidth) && SkIsPow2(fTextureHeight));
 
@@ -43,8 +43,9 @@ class TextureProxy;
  * determined by using the AtlasToken system: After a DrawPass is snapped a subarea of the page, or
  * "plot" is checked to see whether it was used in that DrawPass. If less than a quarter of the
  * plots have been used recently (within kPlotRecentlyUsedCount iterations) and there are available
- * plots in lower index pages, the higher index page will be deactivated, and its glyphs will
- * gradually migrate to other pages via the usual upload system.
+ * plots in lower index pages, the higher index page will be deactivated. Each recently used plot
+ * on it is moved, subimages and all, into an available plot on a lower page, and clients can
+ * forward their locators to the moved subimages with forwardLocator() rather than add them again.
  *
  * Garbage collection is initiated by the DrawAtlas's client via the compact() method.
  */
@@ -122,6 +123,13 @@ public:
         return plot < fNumPlots && page < fNumActivePages && plotGeneration == locatorGeneration;
     }
 
+    /**
+     * If the plot holding atlasLocator's subimage was moved by compact(), point atlasLocator at
+     * the subimage's new place and return true. The plot it moved to is uploaded by the next
+     * recordUploads(). Returns false if the subimage has to be added to the atlas again.
+     */
+    bool forwardLocator(AtlasLocator*);
+
     /** To ensure the atlas does not evict a given entry, the client must set the last use token. */
     void setLastUseToken(const AtlasLocator& atlasLocator, AtlasToken token) {
         SkASSERT(this->hasID(atlasLocator.plotLocator()));
@@ -192,6 +200,7 @@ private:
         this->processEviction(plot->plotLocator());
         plot->resetRects();
     }
+    void relocatePlot(Plot* from, Plot* to);
 
     SkColorType           fColorType;
     size_t                fBytesPerPixel;
@@ -220,6 +229,7 @@ private:
     int fFlushesSinceLastUse;
 
     std::vector<PlotEvictionCallback*> fEvictionCallbacks;
+    PlotRelocations fRelocations;
 
     struct Page {
         // allocated array of Plots
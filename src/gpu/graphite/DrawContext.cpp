@@ -13,6 +13,7 @@
 
 #include "include/gpu/graphite/Context.h"
 #include "include/gpu/graphite/Recorder.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/graphite/AtlasProvider.h"
 #include "src/gpu/graphite/Buffer.h"
@@ -94,9 +95,15 @@ void DrawContext::clear(const SkColor4f& clearColor) {
     // a fullscreen clear will overwrite anything that came before, so start a new DrawList
     // and clear any drawpasses that haven't been snapped yet
     fPendingDraws = std::make_unique<DrawList>();
-    if (fComputePathAtlas) {
-        fComputePathAtlas->reset();
-    }
+    fDispatchGroups.clear();
+    fDrawPasses.clear();
+}
+
+void DrawContext::discard() {
+    fPendingLoadOp = LoadOp::kDiscard;
+
+    // As with clear(), nothing recorded before this can show through.
+    fPendingDraws = std::make_unique<DrawList>();
     fDispatchGroups.clear();
     fDrawPasses.clear();
 }
@@ -109,6 +116,7 @@ void DrawContext::recordDraw(const Renderer* renderer,
                              const PaintParams* paint,
                              const StrokeStyle* stroke) {
     SkASSERT(SkIRect::MakeSize(this->imageInfo().dimensions()).contains(clip.scissor()));
+    SkCounters::Add(SkCounters::Counter::kOpsBuilt);
     fPendingDraws->recordDraw(renderer, localToDevice, geometry, clip, ordering, paint, stroke);
 }
 
@@ -135,21 +143,11 @@ bool DrawContext::recordUpload(Recorder* recorder,
                                          std::move(condContext));
 }
 
-PathAtlas* DrawContext::getComputePathAtlas(Recorder* recorder) {
-    if (!fComputePathAtlas) {
-        fComputePathAtlas = recorder->priv().atlasProvider()->createComputePathAtlas();
-    }
-    return fComputePathAtlas.get();
-}
-
 void DrawContext::snapDrawPass(Recorder* recorder) {
     if (fPendingDraws->renderStepCount() == 0 && fPendingLoadOp != LoadOp::kClear) {
         return;
     }
 
-    // Instantiate the compute pass that may render an atlas texture used by this draw pass.
-    this->snapPathAtlasDispatches(recorder);
-
     auto pass = DrawPass::Make(recorder,
                                std::move(fPendingDraws),
                                fTarget,
@@ -285,22 +283,7 @@ sk_sp<Task> DrawContext::snapComputeTask(Recorder* recorder) {
     TRACE_EVENT_INSTANT1("skia.gpu", TRACE_FUNC, TRACE_EVENT_SCOPE_THREAD,
                          "# groups", fDispatchGroups.size());
 
-    SkASSERT(fDispatchGroups.size() == 1);
     return ComputeTask::Make(std::move(fDispatchGroups));
 }
 
-void DrawContext::snapPathAtlasDispatches(Recorder* recorder) {
-    if (!fComputePathAtlas) {
-        // Platform doesn't support compute or atlas was never initialized.
-        return;
-    }
-    auto dispatchGroup = fComputePathAtlas->recordDispatches(recorder);
-    if (dispatchGroup) {
-        // For now this check is valid as all coverage mask draws involve dispatches
-        SkASSERT(fPendingDraws->hasCoverageMaskDraws());
-        fDispatchGroups.push_back(std::move(dispatchGroup));
-    }
-    fComputePathAtlas->reset();
-}
-
 } // namespace skgpu::graphite
@@ -30,10 +30,8 @@ class Recorder;
 class Transform;
 
 class Caps;
-class ComputePathAtlas;
 class DispatchGroup;
 class DrawPass;
-class PathAtlas;
 class RasterPathAtlas;
 class Task;
 class TextAtlasManager;
@@ -65,6 +63,9 @@ public:
     int pendingRenderSteps() const { return fPendingDraws->renderStepCount(); }
 
     void clear(const SkColor4f& clearColor);
+    // Like clear(), except that the next draw pass starts with undefined contents, so the caller
+    // must cover every pixel. On tiling GPUs, this saves loading the target into tile memory.
+    void discard();
 
     void recordDraw(const Renderer* renderer,
                     const Transform& localToDevice,
@@ -83,11 +84,6 @@ public:
                       const SkIRect& dstRect,
                       std::unique_ptr<ConditionalUploadContext>);
 
-    // Returns the transient path atlas that uses compute to accumulate coverage masks for atlas
-    // draws recorded to this SDC. The atlas gets created lazily upon request. Returns nullptr
-    // if compute path generation is not supported.
-    PathAtlas* getComputePathAtlas(Recorder*);
-
     // Ends the current DrawList being accumulated by the SDC, converting it into an optimized and
     // immutable DrawPass. The DrawPass will be ordered after any other snapped DrawPasses or
     // appended DrawPasses from a child SDC. A new DrawList is started to record subsequent drawing
@@ -120,7 +116,8 @@ public:
 
     // Moves all accummulated DispatchGroups into a ComputeTask and returns it. A DispatchGroup may
     // be recorded internally as a dependency of a DrawPass (which may happen during a call to
-    // `snapDrawPass()`) or directly by the caller (e.g. as part of compute-based atlas render).
+    // `snapDrawPass()`) or directly by the caller. Compute-based atlas renders are shared by all
+    // of a Recorder's DrawContexts and are snapped by the AtlasProvider instead.
     //
     // The returned Task encapsulates all recorded dispatches and the caller is responsible for
     // ensuring that the Task gets executed ahead of draws.
@@ -137,9 +134,6 @@ public:
 private:
     DrawContext(sk_sp<TextureProxy>, const SkImageInfo&, const SkSurfaceProps&);
 
-    // If a compute atlas was initialized, schedule its accummulated paths to be rendered.
-    void snapPathAtlasDispatches(Recorder*);
-
     sk_sp<TextureProxy> fTarget;
     SkImageInfo fImageInfo;
     const SkSurfaceProps fSurfaceProps;
@@ -152,20 +146,6 @@ private:
     StoreOp fPendingStoreOp = StoreOp::kStore;
     std::array<float, 4> fPendingClearColor = { 0, 0, 0, 0 };
 
-    // Accumulates atlas coverage masks generated by compute dispatches that are required by one or
-    // more entries in `fPendingDraws`. When pending draws are snapped into a new DrawPass, a
-    // compute dispatch group gets recorded which schedules the accumulated masks to get drawn into
-    // an atlas texture. The accumulated masks are then cleared which frees up the atlas for
-    // future draws.
-    //
-    // TODO: Currently every PathAtlas contains a single texture. If multiple snapped draw
-    // passes resulted in multiple ComputePathAtlas dispatch groups, the later dispatches would
-    // overwrite the atlas texture since all compute tasks are scheduled before render tasks. This
-    // is currently not an issue since there is only one DrawPass per flush but we may want to
-    // either support one atlas texture per DrawPass or record the dispatches once per
-    // RenderPassTask rather than DrawPass.
-    std::unique_ptr<ComputePathAtlas> fComputePathAtlas;
-
     // Stores previously snapped DrawPasses of this DC, or inlined child DCs whose content
     // couldn't have been copied directly to fPendingDraws. While each DrawPass is immutable, the
     // list of DrawPasses is not final until there is an external dependency on the SDC's content
@@ -10,6 +10,7 @@
 #include "include/gpu/graphite/GraphiteTypes.h"
 #include "include/gpu/graphite/Recorder.h"
 #include "include/private/base/SkAlign.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/graphite/Buffer.h"
 #include "src/gpu/graphite/BufferManager.h"
@@ -228,6 +229,11 @@ public:
             size_t udbDataSize = udbSize;
             if (!fUseStorageBuffers) {
                 udbSize = bufferMgr->alignUniformBlockSize(udbSize);
+                // Each uniform buffer block is bound on its own, so blocks that are identical to
+                // ones written by an earlier Recording can be bound where they already are.
+                if (this->writePersistentUniforms(bufferMgr, udbSize, &cache)) {
+                    continue;
+                }
             }
             auto [writer, bufferInfo] =
                     fUseStorageBuffers ? bufferMgr->getSsboWriter(udbSize * cache.size())
@@ -259,6 +265,31 @@ public:
         }
     }
 
+    // Binds every block in 'cache' from the DrawBufferManager's persistent uniforms, writing any
+    // that can't be placed there individually instead. Returns false, without changing anything,
+    // if persistent uniforms aren't available for the first block.
+    static bool writePersistentUniforms(DrawBufferManager* bufferMgr,
+                                        size_t udbSize,
+                                        UniformCache* cache) {
+        SkSpan<CpuOrGpuData> dataBlocks = cache->data();
+        for (size_t i = 0; i < dataBlocks.size(); ++i) {
+            const UniformDataBlock* cpuData = dataBlocks[i].fCpuData;
+            BindBufferInfo bufferInfo = bufferMgr->getPersistentUniforms(*cpuData);
+            if (!bufferInfo) {
+                if (i == 0) {
+                    return false;
+                }
+                UniformWriter writer;
+                std::tie(writer, bufferInfo) = bufferMgr->getUniformWriter(udbSize);
+                writer.write(cpuData->data(), cpuData->size());
+            }
+            dataBlocks[i].fGpuData.fBuffer = bufferInfo.fBuffer;
+            dataBlocks[i].fGpuData.fOffset = bufferInfo.fOffset;
+            dataBlocks[i].fGpuData.fBindingSize = static_cast<uint32_t>(udbSize);
+        }
+        return true;
+    }
+
     // Updates the current tracked pipeline and uniform index and returns whether or not
     // bindBuffers() needs to be called, depending on if 'fUseStorageBuffers' is true or not.
     bool setCurrentUniforms(GraphicsPipelineCache::Index pipelineIndex,
@@ -325,11 +356,18 @@ private:
  *  2. An index into a cache of pipeline descriptions is used to encode the identity of the
  *     pipeline (SortKeys that differ in the bits from #1 necessarily would have different
  *     descriptions, but then the specific ordering of the RenderSteps isn't enforced).
- * Last, the SortKey encodes an index into the set of uniform bindings accumulated for a DrawPass.
- * This allows the SortKey to cluster draw steps that have both a compatible pipeline and do not
- * require rebinding uniform data or other state (e.g. scissor). Since the uniform data index and
- * the pipeline description index are packed into indices and not actual pointers, a given SortKey
- * is only valid for the a specific DrawList->DrawPass conversion.
+ * Last, the SortKey encodes an index into the set of texture bindings and uniform bindings
+ * accumulated for a DrawPass. This allows the SortKey to cluster draw steps that have both a
+ * compatible pipeline and do not require rebinding textures, uniform data or other state (e.g.
+ * scissor). Since the uniform data index and the pipeline description index are packed into indices
+ * and not actual pointers, a given SortKey is only valid for the a specific DrawList->DrawPass
+ * conversion.
+ *
+ * Texture bindings are the most significant of those. When uniforms are read from storage buffers,
+ * each draw finds its own with the SSBO indices in its instance data, so draws that differ only in
+ * their uniforms don't need any rebinding and are appended to the same instanced draw call. Sorting
+ * by uniforms first would interleave their texture bindings and split those draws up again. With
+ * uniform buffers, a texture rebind is also the more expensive of the two to make.
  */
 class DrawPass::SortKey {
 public:
@@ -343,9 +381,9 @@ public:
                        StencilIndexField::set(draw->fDrawParams.order().stencilIndex().bits())  |
                        RenderStepField::set(static_cast<uint32_t>(renderStep))                  |
                        PipelineField::set(pipelineIndex))
-        , fUniformKey(GeometryUniformField::set(geomUniformIndex)   |
-                      ShadingUniformField::set(shadingUniformIndex) |
-                      TextureBindingsField::set(textureBindingIndex))
+        , fUniformKey(TextureBindingsField::set(textureBindingIndex) |
+                      GeometryUniformField::set(geomUniformIndex)     |
+                      ShadingUniformField::set(shadingUniformIndex))
         , fDraw(draw) {
         SkASSERT(pipelineIndex < GraphicsPipelineCache::kInvalidIndex);
         SkASSERT(renderStep <= draw->fRenderer->numRenderSteps());
@@ -388,9 +426,9 @@ private:
     // The uniform/texture index fields need 1 extra bit to encode "no-data". Values that are
     // greater than or equal to 2^(bits-1) represent "no-data", while values between
     // [0, 2^(bits-1)-1] can access data arrays without extra logic.
-    using GeometryUniformField = Bitfield<17, 47>; // bits >= 1+log2(max total steps)
-    using ShadingUniformField  = Bitfield<17, 30>; // bits >= 1+log2(max total steps)
-    using TextureBindingsField = Bitfield<30, 0>;  // bits >= 1+log2(max total steps)
+    using TextureBindingsField = Bitfield<17, 47>; // bits >= 1+log2(max total steps)
+    using GeometryUniformField = Bitfield<17, 30>; // bits >= 1+log2(max total steps)
+    using ShadingUniformField  = Bitfield<30, 0>;  // bits >= 1+log2(max total steps)
     uint64_t fUniformKey;
 
     // Backpointer to the draw that produced the sort key
@@ -407,6 +445,53 @@ private:
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace {
+
+// Below this many keys per task, handing chunks to other threads costs more than it saves.
+static constexpr int kMinSortKeysPerTask = 8192;
+static constexpr int kMaxSortTasks = 8;
+
+// Sorts the keys in independent chunks on the executor, then merges neighbouring chunks pairwise
+// until one remains. Each step only depends on the keys, so the result is the same every time, for
+// any number of threads.
+template <typename Key>
+void parallel_sort(SkExecutor* executor, std::vector<Key>* keys) {
+    const int count = SkToInt(keys->size());
+    int numChunks = 1;
+    while (numChunks < kMaxSortTasks && count / (2 * numChunks) >= kMinSortKeysPerTask) {
+        numChunks *= 2;
+    }
+    if (numChunks == 1) {
+        std::sort(keys->begin(), keys->end());
+        return;
+    }
+
+    TRACE_EVENT1("skia.gpu", TRACE_FUNC, "chunks", numChunks);
+    auto chunkStart = [&](int chunk) {
+        return keys->begin() + SkToInt((int64_t) count * chunk / numChunks);
+    };
+
+    SkTaskGroup tasks(*executor);
+    tasks.batch(numChunks, [&](int chunk) {
+        std::sort(chunkStart(chunk), chunkStart(chunk + 1));
+    });
+    tasks.wait();
+
+    for (int width = 1; width < numChunks; width *= 2) {
+        tasks.batch(numChunks / (2 * width), [&](int i) {
+            const int first = 2 * width * i;
+            std::inplace_merge(chunkStart(first),
+                               chunkStart(first + width),
+                               chunkStart(first + 2 * width));
+        });
+        tasks.wait();
+    }
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 sk_sp<TextureProxy> add_copy_target_task(Recorder* recorder,
                                          sk_sp<TextureProxy> target,
                                          const SkImageInfo& targetInfo,
@@ -582,7 +667,11 @@ std::unique_ptr<DrawPass> DrawPass::Make(Recorder* recorder,
     // vs. algorithms that require an extra O(n) storage.
     // TODO: It's not strictly necessary, but would a stable sort be useful or just end up hiding
     // bugs in the DrawOrder determination code?
-    std::sort(keys.begin(), keys.end());
+    if (SkExecutor* executor = recorder->priv().executor()) {
+        parallel_sort(executor, &keys);
+    } else {
+        std::sort(keys.begin(), keys.end());
+    }
 
     // Used to record vertex/instance data, buffer binds, and draw calls
     DrawWriter drawWriter(&drawPass->fCommandList, bufferMgr);
@@ -11,6 +11,7 @@
 #include "src/gpu/graphite/ContextUtils.h"
 #include "src/gpu/graphite/GraphicsPipeline.h"
 #include "src/gpu/graphite/Resource.h"
+#include "src/gpu/graphite/TextureProxy.h"
 
 namespace skgpu::graphite {
 
@@ -24,6 +25,7 @@ GlobalCache::~GlobalCache() {
     SkASSERT(fGraphicsPipelineCache.count() == 0);
     SkASSERT(fComputePipelineCache.count() == 0);
     SkASSERT(fStaticResource.size() == 0);
+    SkASSERT(fUploadedProxies.count() == 0);
 }
 
 void GlobalCache::deleteResources() {
@@ -32,6 +34,8 @@ void GlobalCache::deleteResources() {
     fGraphicsPipelineCache.reset();
     fComputePipelineCache.reset();
     fStaticResource.clear();
+    fUploadedProxies.reset();
+    fPendingUploadKeys.reset();
 }
 
 sk_sp<GraphicsPipeline> GlobalCache::findGraphicsPipeline(const UniqueKey& key) {
@@ -55,7 +59,33 @@ sk_sp<GraphicsPipeline> GlobalCache::addGraphicsPipeline(const UniqueKey& key,
     return *entry;
 }
 
+void GlobalCache::recordCreatedGraphicsPipeline(const UniqueKey& key,
+                                                const GraphicsPipelineDesc& pipelineDesc,
+                                                const RenderPassDesc& renderPassDesc) {
+    SkAutoSpinlock lock{fSpinLock};
+    if (!fCreatedGraphicsPipelines.find(key)) {
+        fCreatedGraphicsPipelines.set(key, {pipelineDesc, renderPassDesc});
+    }
+}
+
+skia_private::TArray<GlobalCache::CreatedGraphicsPipeline>
+GlobalCache::createdGraphicsPipelines() const {
+    SkAutoSpinlock lock{fSpinLock};
+    skia_private::TArray<CreatedGraphicsPipeline> created;
+    created.reserve(fCreatedGraphicsPipelines.count());
+    fCreatedGraphicsPipelines.foreach([&](const UniqueKey&, const CreatedGraphicsPipeline& c) {
+        created.push_back(c);
+    });
+    return created;
+}
+
 #if defined(GRAPHITE_TEST_UTILS)
+int GlobalCache::numUploadedProxies() const {
+    SkAutoSpinlock lock{fSpinLock};
+
+    return fUploadedProxies.count();
+}
+
 int GlobalCache::numGraphicsPipelines() const {
     SkAutoSpinlock lock{fSpinLock};
 
@@ -99,4 +129,53 @@ void GlobalCache::addStaticResource(sk_sp<Resource> resource) {
     fStaticResource.push_back(std::move(resource));
 }
 
+sk_sp<TextureProxy> GlobalCache::findUploadedProxy(const UniqueKey& key) {
+    SkAutoSpinlock lock{fSpinLock};
+
+    // The uploading Recorder still holds a ref, since it removes the proxy before dropping it.
+    UploadedProxy* entry = fUploadedProxies.find(key);
+    return entry && entry->fPublished ? sk_ref_sp(entry->fProxy) : nullptr;
+}
+
+void GlobalCache::addPendingUploadedProxy(const UniqueKey& key, TextureProxy* proxy) {
+    SkAutoSpinlock lock{fSpinLock};
+
+    if (!fUploadedProxies.find(key)) {
+        fPendingUploadKeys.set(proxy, key);
+        fUploadedProxies.set(key, {proxy, /*fPublished=*/false});
+    } // else another Recorder uploaded the same pixels first, and its copy is the one we share
+}
+
+void GlobalCache::publishUploadedProxies(SkSpan<const sk_sp<TextureProxy>> proxies) {
+    SkAutoSpinlock lock{fSpinLock};
+
+    for (const sk_sp<TextureProxy>& proxy : proxies) {
+        UniqueKey* key = fPendingUploadKeys.find(proxy.get());
+        if (!key) {
+            continue;  // Published by an earlier insert of the same Recording, or since removed
+        }
+        UploadedProxy* entry = fUploadedProxies.find(*key);
+        SkASSERT(entry && entry->fProxy == proxy.get());
+        if (proxy->isInstantiated()) {
+            entry->fPublished = true;
+        } else {
+            fUploadedProxies.remove(*key);
+        }
+        fPendingUploadKeys.remove(proxy.get());
+    }
+}
+
+void GlobalCache::removeUploadedProxy(const UniqueKey& key, const TextureProxy* proxy) {
+    SkAutoSpinlock lock{fSpinLock};
+
+    UploadedProxy* entry = fUploadedProxies.find(key);
+    if (!entry || entry->fProxy != proxy) {
+        return;  // The key was added by another Recorder
+    }
+    if (!entry->fPublished) {
+        fPendingUploadKeys.remove(proxy);
+    }
+    fUploadedProxies.remove(key);
+}
+
 } // namespace skgpu::graphite
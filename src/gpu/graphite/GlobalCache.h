@@ -9,10 +9,14 @@
 #define skgpu_graphite_GlobalCache_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSpan.h"
 #include "include/private/base/SkTArray.h"
 #include "src/base/SkSpinlock.h"
 #include "src/core/SkLRUCache.h"
+#include "src/core/SkTHash.h"
 #include "src/gpu/ResourceKey.h"
+#include "src/gpu/graphite/AttachmentTypes.h"
+#include "src/gpu/graphite/GraphicsPipelineDesc.h"
 
 #include <functional>
 
@@ -22,6 +26,7 @@ class ComputePipeline;
 class GraphicsPipeline;
 class Resource;
 class ShaderCodeDictionary;
+class TextureProxy;
 
 /**
  * GlobalCache holds GPU resources that should be shared by every Recorder. The common requirement
@@ -58,6 +63,20 @@ public:
             SK_EXCLUDES(fSpinLock);
 #endif
 
+    // Every distinct GraphicsPipeline created so far, by any Recorder or by Precompile(), as the
+    // descriptions it was created from. Unlike the pipeline cache this is never evicted from, so
+    // SerializePipelineManifest() can write out everything a run has used for a later run to
+    // precompile.
+    struct CreatedGraphicsPipeline {
+        GraphicsPipelineDesc fPipelineDesc;
+        RenderPassDesc fRenderPassDesc;
+    };
+    void recordCreatedGraphicsPipeline(const UniqueKey&,
+                                       const GraphicsPipelineDesc&,
+                                       const RenderPassDesc&) SK_EXCLUDES(fSpinLock);
+    skia_private::TArray<CreatedGraphicsPipeline> createdGraphicsPipelines() const
+            SK_EXCLUDES(fSpinLock);
+
     // Find and add operations for ComputePipelines, with the same pattern as GraphicsPipelines.
     sk_sp<ComputePipeline> findComputePipeline(const UniqueKey&) SK_EXCLUDES(fSpinLock);
     sk_sp<ComputePipeline> addComputePipeline(const UniqueKey&,
@@ -69,6 +88,27 @@ public:
     // or reference tracking.
     void addStaticResource(sk_sp<Resource>) SK_EXCLUDES(fSpinLock);
 
+    // Textures uploaded from raster images by one Recorder, which other Recorders may then sample
+    // instead of uploading their own copies. They use the same keys as the Recorders' ProxyCaches.
+    //
+    // The Recorder that uploads a texture adds it as pending, and it is only returned by
+    // findUploadedProxy() once the Context has published it, after inserting the Recording that
+    // holds its upload. Every Recording inserted after that is ordered after the upload, so a
+    // Recorder that finds the texture needs no further dependency on the one that uploaded it. If
+    // a key is already present, pending or not, later adds are ignored.
+    //
+    // The GlobalCache doesn't ref these proxies, so that the uploading Recorder's ProxyCache can
+    // still tell when no one else is using them. Instead, that ProxyCache must remove a proxy
+    // here before it lets go of its own ref.
+    sk_sp<TextureProxy> findUploadedProxy(const UniqueKey&) SK_EXCLUDES(fSpinLock);
+    void addPendingUploadedProxy(const UniqueKey&, TextureProxy*) SK_EXCLUDES(fSpinLock);
+    void publishUploadedProxies(SkSpan<const sk_sp<TextureProxy>>) SK_EXCLUDES(fSpinLock);
+    void removeUploadedProxy(const UniqueKey&, const TextureProxy*) SK_EXCLUDES(fSpinLock);
+
+#if defined(GRAPHITE_TEST_UTILS)
+    int numUploadedProxies() const SK_EXCLUDES(fSpinLock);
+#endif
+
 private:
     struct KeyHash {
         uint32_t operator()(const UniqueKey& key) const { return key.hash(); }
@@ -87,6 +127,19 @@ private:
     ComputePipelineCache  fComputePipelineCache  SK_GUARDED_BY(fSpinLock);
 
     skia_private::TArray<sk_sp<Resource>> fStaticResource SK_GUARDED_BY(fSpinLock);
+
+    skia_private::THashMap<UniqueKey, CreatedGraphicsPipeline, KeyHash>
+            fCreatedGraphicsPipelines SK_GUARDED_BY(fSpinLock);
+
+    struct UploadedProxy {
+        TextureProxy* fProxy;
+        bool fPublished = false;
+    };
+    skia_private::THashMap<UniqueKey, UploadedProxy, KeyHash>
+            fUploadedProxies SK_GUARDED_BY(fSpinLock);
+    // The keys of the pending entries in fUploadedProxies, so they can be published by proxy.
+    skia_private::THashMap<const TextureProxy*, UniqueKey>
+            fPendingUploadKeys SK_GUARDED_BY(fSpinLock);
 };
 
 }  // namespace skgpu::graphite
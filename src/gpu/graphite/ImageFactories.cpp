@@ -10,6 +10,7 @@
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkSurface.h"
+#include "include/core/SkTiledImageUtils.h"
 #include "include/core/SkYUVAInfo.h"
 #include "include/core/SkYUVAPixmaps.h"
 #include "include/gpu/GpuTypes.h"
@@ -27,6 +28,7 @@
 #include "src/gpu/graphite/Image_Graphite.h"
 #include "src/gpu/graphite/Image_YUVA_Graphite.h"
 #include "src/gpu/graphite/Log.h"
+#include "src/gpu/graphite/ProxyCache.h"
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/ResourceProvider.h"
 #include "src/gpu/graphite/Surface_Graphite.h"
@@ -281,9 +283,10 @@ sk_sp<SkImage> MakeWithFilter(skgpu::graphite::Recorder* recorder,
 static sk_sp<SkImage> generate_picture_texture(skgpu::graphite::Recorder* recorder,
                                                const SkImage_Picture* img,
                                                const SkImageInfo& info,
-                                               SkImage::RequiredProperties requiredProps) {
+                                               SkImage::RequiredProperties requiredProps,
+                                               skgpu::Budgeted budgeted) {
     auto mm = requiredProps.fMipmapped ? skgpu::Mipmapped::kYes : skgpu::Mipmapped::kNo;
-    sk_sp<SkSurface> surface = SkSurfaces::RenderTarget(recorder, info, mm, img->props());
+    sk_sp<SkSurface> surface = Surface::MakeGraphite(recorder, info, budgeted, mm, img->props());
     if (!surface) {
         SKGPU_LOG_E("Failed to create Surface");
         return nullptr;
@@ -303,6 +306,41 @@ static sk_sp<SkImage> generate_picture_texture(skgpu::graphite::Recorder* record
     return SkSurfaces::AsImage(surface);
 }
 
+// Picture-backed images made from the same picture, at the same size and offset, have the same
+// contents. Icons and other vector art are often wrapped in a new image each time they're drawn,
+// so rather than draw the picture again for each of those images, they share one budgeted texture
+// through the ProxyCache, across frames and Recorders.
+static sk_sp<SkImage> find_or_generate_picture_texture(skgpu::graphite::Recorder* recorder,
+                                                       const SkImage_Picture* img,
+                                                       SkImage::RequiredProperties requiredProps) {
+    uint32_t keyValues[SkTiledImageUtils::kNumImageKeyValues];
+    if (!img->getImageKeyValues(keyValues)) {
+        return generate_picture_texture(recorder, img, img->imageInfo(), requiredProps,
+                                        skgpu::Budgeted::kNo);
+    }
+
+    auto mm = requiredProps.fMipmapped ? skgpu::Mipmapped::kYes : skgpu::Mipmapped::kNo;
+    sk_sp<TextureProxy> proxy = recorder->priv().proxyCache()->findOrCreateCachedProxy(
+            recorder, keyValues, mm, [&]() -> sk_sp<TextureProxy> {
+                sk_sp<SkImage> image = generate_picture_texture(recorder, img, img->imageInfo(),
+                                                                requiredProps,
+                                                                skgpu::Budgeted::kYes);
+                if (!image) {
+                    return nullptr;
+                }
+                return static_cast<Image*>(image.get())->textureProxyView().refProxy();
+            });
+    if (!proxy) {
+        return nullptr;
+    }
+
+    skgpu::Swizzle swizzle = recorder->priv().caps()->getReadSwizzle(img->colorType(),
+                                                                     proxy->textureInfo());
+    return sk_make_sp<Image>(kNeedNewImageUniqueID,
+                             TextureProxyView(std::move(proxy), swizzle),
+                             img->imageInfo().colorInfo());
+}
+
 /*
  *  We only have 2 ways to create a Graphite-backed image.
  *
@@ -316,10 +354,9 @@ static sk_sp<SkImage> make_texture_image_from_lazy(skgpu::graphite::Recorder* re
     {
         if (img->type() == SkImage_Base::Type::kLazyPicture) {
             sk_sp<SkImage> newImage =
-                    generate_picture_texture(recorder,
-                                             static_cast<const SkImage_Picture*>(img),
-                                             img->imageInfo(),
-                                             requiredProps);
+                    find_or_generate_picture_texture(recorder,
+                                                     static_cast<const SkImage_Picture*>(img),
+                                                     requiredProps);
             if (newImage) {
                 SkASSERT(as_IB(newImage)->isGraphiteBacked());
                 return newImage;
@@ -8,19 +8,25 @@
 #include "src/gpu/graphite/Image_YUVA_Graphite.h"
 
 #include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkImage.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSurface.h"
 #include "include/core/SkYUVAInfo.h"
 #include "include/core/SkYUVAPixmaps.h"
 #include "include/gpu/GpuTypes.h"
 #include "include/gpu/graphite/Image.h"
 #include "include/gpu/graphite/Recorder.h"
+#include "include/gpu/graphite/Surface.h"
 #include "include/gpu/graphite/YUVABackendTextures.h"
 #include "src/gpu/RefCntedCallback.h"
 #include "src/gpu/graphite/Caps.h"
+#include "src/gpu/graphite/Image_Graphite.h"
 #include "src/gpu/graphite/Log.h"
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/ResourceProvider.h"
+#include "src/gpu/graphite/Surface_Graphite.h"
 #include "src/gpu/graphite/Texture.h"
 #include "src/gpu/graphite/TextureProxy.h"
 #include "src/gpu/graphite/TextureProxyView.h"
@@ -64,6 +70,48 @@ sk_sp<SkImage> Image_YUVA::onReinterpretColorSpace(sk_sp<SkColorSpace> newCS) co
     return sk_make_sp<Image_YUVA>(kNeedNewImageUniqueID, fYUVAProxies, std::move(newCS));
 }
 
+sk_sp<SkImage> Image_YUVA::flattened(Recorder* recorder, Mipmapped mipmapped) const {
+    if (!fCanFlatten) {
+        return nullptr;
+    }
+    for (int i = 0; i < fYUVAProxies.numPlanes(); ++i) {
+        if (fYUVAProxies.proxy(i)->isVolatile()) {
+            return nullptr;
+        }
+    }
+
+    SkAutoMutexExclusive lock(fFlattenedLock);
+    if (fFlattened && fFlattenedRecorderID == recorder->priv().uniqueID() &&
+        (mipmapped == Mipmapped::kNo || fFlattened->hasMipmaps())) {
+        return fFlattened;
+    }
+
+    sk_sp<SkSurface> surface = SkSurfaces::RenderTarget(recorder, this->imageInfo(), mipmapped);
+    if (!surface) {
+        return nullptr;
+    }
+    auto src = sk_make_sp<Image_YUVA>(kNeedNewImageUniqueID, fYUVAProxies, this->refColorSpace());
+    src->fCanFlatten = false;
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    surface->getCanvas()->drawImage(src, 0, 0, SkFilterMode::kNearest, &paint);
+    // The draw has to be recorded before the mipmaps are made from it.
+    Flush(surface.get());
+
+    TextureProxyView view = static_cast<Surface*>(surface.get())->readSurfaceView();
+    if (mipmapped == Mipmapped::kYes &&
+        !GenerateMipmaps(recorder, view.refProxy(), this->imageInfo().colorInfo())) {
+        SKGPU_LOG_W("Image_YUVA::flattened: Failed to generate mipmaps");
+        return nullptr;
+    }
+
+    fFlattened = sk_make_sp<Image>(kNeedNewImageUniqueID,
+                                   std::move(view),
+                                   this->imageInfo().colorInfo());
+    fFlattenedRecorderID = recorder->priv().uniqueID();
+    return fFlattened;
+}
+
 }  // namespace skgpu::graphite
 
 using namespace skgpu::graphite;
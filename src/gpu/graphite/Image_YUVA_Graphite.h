@@ -11,6 +11,8 @@
 #include "src/gpu/graphite/Image_Base_Graphite.h"
 
 #include "include/gpu/graphite/Image.h"
+#include "include/private/base/SkMutex.h"
+#include "include/private/base/SkThreadAnnotations.h"
 #include "src/gpu/graphite/YUVATextureProxies.h"
 
 namespace skgpu {
@@ -49,6 +51,12 @@ public:
         return fYUVAProxies;
     }
 
+    // Returns this image converted to RGBA, for the Recorder to sample instead of the planes. The
+    // conversion is drawn the first time it's asked for and kept, so later calls from the same
+    // Recorder reuse it, unless they want mipmaps it lacks. Returns null if the planes are
+    // volatile, since their contents may change from one Recording to the next.
+    sk_sp<SkImage> flattened(Recorder*, Mipmapped) const;
+
     static sk_sp<TextureProxy> MakePromiseImageLazyProxy(
             const Caps*,
             SkISize dimensions,
@@ -76,6 +84,14 @@ private:
     }
 
     mutable YUVATextureProxies fYUVAProxies;
+
+    // The image that flattened() draws from is a copy of this one, which must not try to flatten
+    // itself in turn.
+    bool fCanFlatten = true;
+
+    mutable SkMutex fFlattenedLock;
+    mutable sk_sp<SkImage> fFlattened SK_GUARDED_BY(fFlattenedLock);
+    mutable uint32_t fFlattenedRecorderID SK_GUARDED_BY(fFlattenedLock) = SK_InvalidUniqueID;
 };
 
 } // namespace skgpu::graphite
@@ -55,11 +55,13 @@
 #include "src/gpu/graphite/UniformManager.h"
 #include "src/gpu/graphite/YUVATextureProxies.h"
 #include "src/image/SkImage_Base.h"
+#include "src/shaders/SkAnalyticClipShader.h"
 #include "src/shaders/SkBlendShader.h"
 #include "src/shaders/SkColorFilterShader.h"
 #include "src/shaders/SkColorShader.h"
 #include "src/shaders/SkCoordClampShader.h"
 #include "src/shaders/SkEmptyShader.h"
+#include "src/shaders/SkGainmapApplyShader.h"
 #include "src/shaders/SkImageShader.h"
 #include "src/shaders/SkLocalMatrixShader.h"
 #include "src/shaders/SkPerlinNoiseShaderImpl.h"
@@ -948,15 +950,21 @@ bool RuntimeEffectBlock::ShaderData::operator==(const ShaderData& rhs) const {
 
 static void gather_runtime_effect_uniforms(SkSpan<const SkRuntimeEffect::Uniform> rtsUniforms,
                                            SkSpan<const Uniform> graphiteUniforms,
+                                           bool isSpecialized,
                                            const SkData* uniformData,
                                            PipelineDataGatherer* gatherer) {
     if (!rtsUniforms.empty() && uniformData) {
         SkDEBUGCODE(UniformExpectationsValidator uev(gatherer, graphiteUniforms);)
 
-        // Collect all the other uniforms from the provided SkData.
+        // Collect all the other uniforms from the provided SkData. Specialized uniforms are
+        // compiled into the snippet instead.
         const uint8_t* uniformBase = uniformData->bytes();
+        int graphiteIndex = 0;
         for (size_t index = 0; index < rtsUniforms.size(); ++index) {
-            const Uniform& uniform = graphiteUniforms[index];
+            if (isSpecialized && rtsUniforms[index].isSpecialized()) {
+                continue;
+            }
+            const Uniform& uniform = graphiteUniforms[graphiteIndex++];
             // Get a pointer to the offset in our data for this uniform.
             const uint8_t* uniformPtr = uniformBase + rtsUniforms[index].offset;
             // Pass the uniform data to the gatherer.
@@ -970,7 +978,8 @@ void RuntimeEffectBlock::BeginBlock(const KeyContext& keyContext,
                                     PipelineDataGatherer* gatherer,
                                     const ShaderData& shaderData) {
     ShaderCodeDictionary* dict = keyContext.dict();
-    int codeSnippetID = dict->findOrCreateRuntimeEffectSnippet(shaderData.fEffect.get());
+    int codeSnippetID = dict->findOrCreateRuntimeEffectSnippet(shaderData.fEffect.get(),
+                                                               shaderData.fUniforms.get());
 
     keyContext.rtEffectDict()->set(codeSnippetID, shaderData.fEffect);
 
@@ -979,6 +988,7 @@ void RuntimeEffectBlock::BeginBlock(const KeyContext& keyContext,
 
     gather_runtime_effect_uniforms(shaderData.fEffect->uniforms(),
                                    entry->fUniforms,
+                                   entry->fSpecializedUniformData != nullptr,
                                    shaderData.fUniforms.get(),
                                    gatherer);
 
@@ -1263,6 +1273,14 @@ void AddToKey(const KeyContext& keyContext,
 
 // ==================================================================
 
+static void add_to_key(const KeyContext& keyContext,
+                       PaintParamsKeyBuilder* builder,
+                       PipelineDataGatherer* gatherer,
+                       const SkAnalyticClipShader* shader) {
+    SKGPU_LOG_W("Raster-only SkShader (SkAnalyticClipShader) encountered");
+    builder->addBlock(BuiltInCodeSnippetID::kError);
+}
+
 static void add_to_key(const KeyContext& keyContext,
                        PaintParamsKeyBuilder* builder,
                        PipelineDataGatherer* gatherer,
@@ -1352,6 +1370,15 @@ static void add_to_key(const KeyContext& keyContext,
     builder->addBlock(BuiltInCodeSnippetID::kError);
 }
 
+static void add_to_key(const KeyContext& keyContext,
+                       PaintParamsKeyBuilder* builder,
+                       PipelineDataGatherer* gatherer,
+                       const SkGainmapApplyShader* shader) {
+    SkASSERT(shader);
+    // The runtime effect is already a single snippet.
+    AddToKey(keyContext, builder, gatherer, shader->runtimeShader().get());
+}
+
 static void add_yuv_image_to_key(const KeyContext& keyContext,
                                  PaintParamsKeyBuilder* builder,
                                  PipelineDataGatherer* gatherer,
@@ -1449,8 +1476,24 @@ static void add_to_key(const KeyContext& keyContext,
                        const SkImageShader* shader) {
     SkASSERT(shader);
 
+    const SkImage* image = shader->image().get();
+    sk_sp<SkImage> flattened;
+    if (as_IB(image)->type() == SkImage_Base::Type::kGraphiteYUVA &&
+        keyContext.recorder()->priv().cacheYUVAConversions()) {
+        // Sample the planes' cached conversion to RGBA, mipmapped if the sampling calls for it,
+        // rather than converting them again for every pixel (and every tap) of this draw.
+        skgpu::Mipmapped mipmapped = shader->sampling().mipmap != SkMipmapMode::kNone &&
+                                     image->dimensions().area() > 1 ? skgpu::Mipmapped::kYes
+                                                                    : skgpu::Mipmapped::kNo;
+        flattened = static_cast<const Image_YUVA*>(image)->flattened(keyContext.recorder(),
+                                                                     mipmapped);
+        if (flattened) {
+            image = flattened.get();
+        }
+    }
+
     auto [ imageToDraw, newSampling ] = GetGraphiteBacked(keyContext.recorder(),
-                                                          shader->image().get(),
+                                                          image,
                                                           shader->sampling());
     if (!imageToDraw) {
         SKGPU_LOG_W("Couldn't convert ImageShader's image to a Graphite-backed image");
@@ -1582,7 +1625,6 @@ static void add_to_key(const KeyContext& keyContext,
 
     std::unique_ptr<SkPerlinNoiseShader::PaintingData> paintingData =
         shader->getPaintingData(totalMatrix);
-    paintingData->generateBitmaps();
 
     sk_sp<TextureProxy> perm = RecorderPriv::CreateCachedProxy(
             keyContext.recorder(), paintingData->getPermutationsBitmap());
@@ -66,6 +66,9 @@ public:
     void dump(const ShaderCodeDictionary*) const;
 #endif
 
+    // The snippet IDs of the key's nodes, in the depth-first order described above.
+    SkSpan<const int32_t> data() const { return fData; }
+
     bool operator==(const PaintParamsKey& that) const {
         return fData.size() == that.fData.size() &&
                !memcmp(fData.data(), that.fData.data(), fData.size());
@@ -124,6 +124,9 @@ const TextureProxy* ComputePathAtlas::addRect(Recorder* recorder,
         return nullptr;
     }
 
+    // Empty masks still reference the atlas texture, so they count as pending too.
+    fHasMasks = true;
+
     // An empty mask always fits, so just return the texture.
     // TODO: This may not be needed if we can handle clipped out bounds with inverse fills
     // another way. See PathAtlas::addShape().
@@ -141,6 +144,7 @@ const TextureProxy* ComputePathAtlas::addRect(Recorder* recorder,
 
 void ComputePathAtlas::reset() {
     fRectanizer.reset();
+    fHasMasks = false;
 
     this->onReset();
 }
@@ -137,6 +137,9 @@ public:
     // be in use by GPU commands that are in-flight or yet to be submitted.
     void reset();
 
+    // Returns true if any shapes have been added since the last call to `reset()`.
+    bool hasMasks() const { return fHasMasks; }
+
 protected:
     const TextureProxy* texture() const { return fTexture.get(); }
     const TextureProxy* addRect(Recorder* recorder,
@@ -156,6 +159,8 @@ private:
     // this texture is stored here, which is used by AtlasShapeRenderStep when encoding the render
     // pass.
     sk_sp<TextureProxy> fTexture;
+
+    bool fHasMasks = false;
 };
 
 }  // namespace skgpu::graphite
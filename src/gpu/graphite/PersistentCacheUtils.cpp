@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/gpu/graphite/PersistentCacheUtils.h"
+
+#include "include/core/SkString.h"
+#include "include/gpu/graphite/ContextOptions.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkWriteBuffer.h"
+#include "src/gpu/graphite/Caps.h"
+#include "src/sksl/SkSLProgramKind.h"
+#include "src/sksl/SkSLProgramSettings.h"
+
+namespace skgpu::graphite::PersistentCacheUtils {
+
+// Increment this whenever the key or the packed data changes, including when
+// SkSL::Program::Interface does, to invalidate the outdated entries in clients' caches.
+static constexpr int kCurrentVersion = 2;
+
+sk_sp<SkData> MakeShaderKey(SkFourByteTag backendTag,
+                            const std::string& sksl,
+                            SkSL::ProgramKind kind,
+                            const SkSL::ProgramSettings& settings) {
+    SkBinaryWriteBuffer writer({});
+    writer.writeInt(kCurrentVersion);
+    writer.writeUInt(backendTag);
+    writer.writeInt(static_cast<int>(kind));
+
+    // Only the settings that change the generated code.
+    writer.writeBool(settings.fFragColorIsInOut);
+    writer.writeBool(settings.fForceHighPrecision);
+    writer.writeBool(settings.fSharpenTextures);
+    writer.writeBool(settings.fForceNoRTFlip);
+    writer.writeInt(settings.fRTFlipOffset);
+    writer.writeInt(settings.fRTFlipBinding);
+    writer.writeInt(settings.fRTFlipSet);
+    writer.writeInt(settings.fDefaultUniformSet);
+    writer.writeInt(settings.fDefaultUniformBinding);
+    writer.writeBool(settings.fOptimize);
+    writer.writeBool(settings.fRemoveDeadFunctions);
+    writer.writeBool(settings.fRemoveDeadVariables);
+    writer.writeBool(settings.fEliminateCommonSubexpressions);
+    writer.writeBool(settings.fHoistLoopInvariants);
+    writer.writeInt(settings.fInlineThreshold);
+    writer.writeBool(settings.fForceNoInline);
+    writer.writeBool(settings.fAllowNarrowingConversions);
+    writer.writeBool(settings.fUsePushConstants);
+    writer.writeInt(static_cast<int>(settings.fMaxVersionAllowed));
+
+    writer.writeByteArray(sksl.data(), sksl.size());
+    return writer.snapshotAsData();
+}
+
+sk_sp<SkData> PackShader(const std::string& output, const SkSL::Program::Interface& interface) {
+    SkBinaryWriteBuffer writer({});
+    writer.writeInt(kCurrentVersion);
+    writer.writeUInt(interface.fRTFlipUniform);
+    writer.writeBool(interface.fUseLastFragColor);
+    writer.writeBool(interface.fOutputSecondaryColor);
+    writer.writeByteArray(output.data(), output.size());
+    return writer.snapshotAsData();
+}
+
+bool UnpackShader(const SkData& data, std::string* output, SkSL::Program::Interface* interface) {
+    SkReadBuffer reader(data.data(), data.size());
+    if (!reader.validate(reader.readInt() == kCurrentVersion)) {
+        return false;
+    }
+    uint32_t rtFlip = reader.readUInt();
+    if (!reader.validate(rtFlip <= 0xFF)) {
+        return false;
+    }
+    SkSL::Program::Interface unpacked;
+    unpacked.fRTFlipUniform = static_cast<uint8_t>(rtFlip);
+    unpacked.fUseLastFragColor = reader.readBool();
+    unpacked.fOutputSecondaryColor = reader.readBool();
+
+    size_t outputLen = 0;
+    const char* outputBuf = static_cast<const char*>(reader.skipByteArray(&outputLen));
+    if (!reader.isValid() || !outputBuf || outputLen == 0) {
+        return false;
+    }
+    output->assign(outputBuf, outputLen);
+    if (interface) {
+        *interface = unpacked;
+    }
+    return true;
+}
+
+static SkString key_description(SkFourByteTag backendTag, SkSL::ProgramKind kind) {
+    const char tag[] = {static_cast<char>((backendTag >> 24) & 0xFF),
+                        static_cast<char>((backendTag >> 16) & 0xFF),
+                        static_cast<char>((backendTag >>  8) & 0xFF),
+                        static_cast<char>((backendTag >>  0) & 0xFF),
+                        '\0'};
+    return SkStringPrintf("Graphite %s shader (kind %d)", tag, static_cast<int>(kind));
+}
+
+bool SkSLToBackendCached(const Caps* caps,
+                         SkFourByteTag backendTag,
+                         SkSLToBackendFn toBackend,
+                         SkSL::Compiler* compiler,
+                         const std::string& sksl,
+                         SkSL::ProgramKind kind,
+                         const SkSL::ProgramSettings& settings,
+                         std::string* output,
+                         SkSL::Program::Interface* outInterface,
+                         ShaderErrorHandler* errorHandler) {
+    ContextOptions::PersistentCache* cache = caps->persistentCache();
+    if (!cache) {
+        return toBackend(compiler, sksl, kind, settings, output, outInterface, errorHandler);
+    }
+
+    sk_sp<SkData> key = MakeShaderKey(backendTag, sksl, kind, settings);
+    if (sk_sp<SkData> cached = cache->load(*key)) {
+        if (UnpackShader(*cached, output, outInterface)) {
+            return true;
+        }
+        // Stale or corrupt entries are recompiled and overwritten.
+    }
+
+    SkSL::Program::Interface interface;
+    if (!toBackend(compiler, sksl, kind, settings, output, &interface, errorHandler)) {
+        return false;
+    }
+    cache->store(*key, *PackShader(*output, interface), key_description(backendTag, kind));
+    if (outInterface) {
+        *outInterface = interface;
+    }
+    return true;
+}
+
+}  // namespace skgpu::graphite::PersistentCacheUtils
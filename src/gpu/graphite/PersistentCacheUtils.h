@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef skgpu_graphite_PersistentCacheUtils_DEFINED
+#define skgpu_graphite_PersistentCacheUtils_DEFINED
+
+#include "include/core/SkData.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypes.h"
+#include "src/sksl/SkSLProgramKind.h"
+#include "src/sksl/ir/SkSLProgram.h"
+
+#include <string>
+
+namespace SkSL {
+class Compiler;
+struct ProgramSettings;
+}  // namespace SkSL
+
+namespace skgpu { class ShaderErrorHandler; }
+
+namespace skgpu::graphite {
+
+class Caps;
+
+// The Context's PersistentCache stores opaque blobs, as far as clients are concerned. This packs
+// the backend shader code compiled for each pipeline, and keys it in a way that's stable across
+// process launches. UniquePaintParamsIDs and pipeline UniqueKeys are handed out in the order
+// pipelines are first requested, so the keys are built from the generated SkSL instead.
+namespace PersistentCacheUtils {
+
+inline constexpr SkFourByteTag kMSLTag   = SkSetFourByteTag('M', 'S', 'L', ' ');
+inline constexpr SkFourByteTag kSPIRVTag = SkSetFourByteTag('S', 'P', 'R', 'V');
+inline constexpr SkFourByteTag kWGSLTag  = SkSetFourByteTag('W', 'G', 'S', 'L');
+
+// Matches skgpu::SkSLToSPIRV(), SkSLToMSL() and SkSLToWGSL().
+using SkSLToBackendFn = bool (*)(SkSL::Compiler*,
+                                 const std::string& sksl,
+                                 SkSL::ProgramKind,
+                                 const SkSL::ProgramSettings&,
+                                 std::string* output,
+                                 SkSL::Program::Interface*,
+                                 ShaderErrorHandler*);
+
+// Returns the key for the code that compiling sksl for the backend identified by backendTag
+// (one of the tags above) would produce.
+sk_sp<SkData> MakeShaderKey(SkFourByteTag backendTag,
+                            const std::string& sksl,
+                            SkSL::ProgramKind,
+                            const SkSL::ProgramSettings&);
+
+sk_sp<SkData> PackShader(const std::string& output, const SkSL::Program::Interface&);
+
+bool UnpackShader(const SkData&, std::string* output, SkSL::Program::Interface*);
+
+// Behaves like toBackend(), but if the Caps have a PersistentCache, first looks there for code
+// previously compiled from the same SkSL, and stores what it compiles otherwise.
+bool SkSLToBackendCached(const Caps*,
+                         SkFourByteTag backendTag,
+                         SkSLToBackendFn toBackend,
+                         SkSL::Compiler*,
+                         const std::string& sksl,
+                         SkSL::ProgramKind,
+                         const SkSL::ProgramSettings&,
+                         std::string* output,
+                         SkSL::Program::Interface*,
+                         ShaderErrorHandler*);
+
+}  // namespace PersistentCacheUtils
+
+}  // namespace skgpu::graphite
+
+#endif  // skgpu_graphite_PersistentCacheUtils_DEFINED
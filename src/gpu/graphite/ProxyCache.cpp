@@ -12,6 +12,7 @@
 #include "include/gpu/GpuTypes.h"
 #include "src/core/SkMipmap.h"
 #include "src/gpu/ResourceKey.h"
+#include "src/gpu/graphite/GlobalCache.h"
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/Texture.h"
 #include "src/gpu/graphite/TextureProxy.h"
@@ -40,6 +41,20 @@ void make_bitmap_key(skgpu::UniqueKey* key, const SkBitmap& bm, skgpu::Mipmapped
     builder[5] = SkToBool(mipmapped);
 }
 
+void make_content_key(skgpu::UniqueKey* key,
+                      SkSpan<const uint32_t> contentKey,
+                      skgpu::Mipmapped mipmapped) {
+    SkASSERT(key);
+
+    static const skgpu::UniqueKey::Domain kContentDomain = skgpu::UniqueKey::GenerateDomain();
+    skgpu::UniqueKey::Builder builder(key, kContentDomain, contentKey.size() + 1,
+                                      "ProxyCache_Content");
+    for (size_t i = 0; i < contentKey.size(); ++i) {
+        builder[i] = contentKey[i];
+    }
+    builder[contentKey.size()] = SkToBool(mipmapped);
+}
+
 sk_sp<SkIDChangeListener> make_unique_key_invalidation_listener(const skgpu::UniqueKey& key,
                                                                 uint32_t recorderID) {
     class Listener : public SkIDChangeListener {
@@ -81,41 +96,119 @@ sk_sp<TextureProxy> ProxyCache::findOrCreateCachedProxy(Recorder* recorder,
         mipmapped = skgpu::Mipmapped::kNo;
     }
 
-    skgpu::UniqueKey key;
+    skgpu::UniqueKey mipmappedKey, key;
 
     if (mipmapped == Mipmapped::kNo) {
-        make_bitmap_key(&key, bitmap, Mipmapped::kYes);
+        make_bitmap_key(&mipmappedKey, bitmap, Mipmapped::kYes);
+    }
+    make_bitmap_key(&key, bitmap, mipmapped);
+
+    if (sk_sp<TextureProxy> cached = this->findCachedOrSharedProxy(recorder, mipmappedKey, key)) {
+        return cached;
+    }
+
+    auto [ view, ct ] = MakeBitmapProxyView(recorder, bitmap, nullptr,
+                                            mipmapped, skgpu::Budgeted::kYes);
+    if (view) {
+        auto listener = make_unique_key_invalidation_listener(key, recorder->priv().uniqueID());
+        bitmap.pixelRef()->addGenIDChangeListener(std::move(listener));
+
+        this->addCreatedProxy(key, view.refProxy());
+    }
+    return view.refProxy();
+}
+
+sk_sp<TextureProxy> ProxyCache::findOrCreateCachedProxy(
+        Recorder* recorder,
+        SkSpan<const uint32_t> contentKey,
+        Mipmapped mipmapped,
+        const std::function<sk_sp<TextureProxy>()>& create) {
+    this->processInvalidKeyMsgs();
+
+    skgpu::UniqueKey mipmappedKey, key;
+
+    if (mipmapped == Mipmapped::kNo) {
+        make_content_key(&mipmappedKey, contentKey, Mipmapped::kYes);
+    }
+    make_content_key(&key, contentKey, mipmapped);
+
+    if (sk_sp<TextureProxy> cached = this->findCachedOrSharedProxy(recorder, mipmappedKey, key)) {
+        return cached;
+    }
+
+    sk_sp<TextureProxy> proxy = create();
+    if (proxy) {
+        SkASSERT(proxy->mipmapped() == mipmapped);
+        this->addCreatedProxy(key, proxy);
+    }
+    return proxy;
+}
 
-        if (sk_sp<TextureProxy>* cached = fCache.find(key)) {
-            if (Resource* resource = (*cached)->texture(); resource) {
-                resource->updateAccessTime();
+sk_sp<TextureProxy> ProxyCache::findCachedOrSharedProxy(Recorder* recorder,
+                                                        const skgpu::UniqueKey& mipmappedKey,
+                                                        const skgpu::UniqueKey& key) {
+    for (const skgpu::UniqueKey* k : {&mipmappedKey, &key}) {
+        if (k->isValid()) {
+            if (sk_sp<TextureProxy> cached = this->findCachedProxy(*k)) {
+                return cached;
             }
-            return *cached;
         }
     }
 
-    make_bitmap_key(&key, bitmap, mipmapped);
+    // Another Recorder may have made the same texture already.
+    GlobalCache* globalCache = recorder->priv().globalCache();
+    SkASSERT(!fGlobalCache || fGlobalCache == globalCache);
+    fGlobalCache = globalCache;
+    for (const skgpu::UniqueKey* sharedKey : {&mipmappedKey, &key}) {
+        if (!sharedKey->isValid()) {
+            continue;
+        }
+        if (sk_sp<TextureProxy> shared = globalCache->findUploadedProxy(*sharedKey)) {
+            fSharedCache.set(*sharedKey, shared);
+            return shared;
+        }
+    }
+    return nullptr;
+}
+
+void ProxyCache::addCreatedProxy(const skgpu::UniqueKey& key, sk_sp<TextureProxy> proxy) {
+    SkASSERT(fGlobalCache);
+    fGlobalCache->addPendingUploadedProxy(key, proxy.get());
+    fPendingSharedUploads.push_back(proxy);
+    fCache.set(key, std::move(proxy));
+}
 
+sk_sp<TextureProxy> ProxyCache::findCachedProxy(const skgpu::UniqueKey& key) {
     if (sk_sp<TextureProxy>* cached = fCache.find(key)) {
         if (Resource* resource = (*cached)->texture(); resource) {
             resource->updateAccessTime();
         }
         return *cached;
     }
+    // Another Recorder's ResourceCache tracks the access times of these, so we leave them be.
+    if (sk_sp<TextureProxy>* shared = fSharedCache.find(key)) {
+        return *shared;
+    }
+    return nullptr;
+}
 
-    auto [ view, ct ] = MakeBitmapProxyView(recorder, bitmap, nullptr,
-                                            mipmapped, skgpu::Budgeted::kYes);
-    if (view) {
-        auto listener = make_unique_key_invalidation_listener(key, recorder->priv().uniqueID());
-        bitmap.pixelRef()->addGenIDChangeListener(std::move(listener));
-
-        fCache.set(key, view.refProxy());
+void ProxyCache::removeFromGlobalCache(const skgpu::UniqueKey& key, const TextureProxy* proxy) {
+    if (fGlobalCache) {
+        fGlobalCache->removeUploadedProxy(key, proxy);
     }
-    return view.refProxy();
 }
 
 void ProxyCache::purgeAll() {
+    fCache.foreach([&](const skgpu::UniqueKey& key, const sk_sp<TextureProxy>* proxy) {
+        this->removeFromGlobalCache(key, proxy->get());
+    });
     fCache.reset();
+    fSharedCache.reset();
+    fPendingSharedUploads.clear();
+}
+
+TArray<sk_sp<TextureProxy>> ProxyCache::detachPendingSharedUploads() {
+    return std::move(fPendingSharedUploads);
 }
 
 void ProxyCache::processInvalidKeyMsgs() {
@@ -127,7 +220,8 @@ void ProxyCache::processInvalidKeyMsgs() {
             // TODO: this should stop crbug.com/1480570 for now but more investigation needs to be
             // done into how we're getting into the situation where an invalid key has been
             // purged from the cache prior to processing of the invalid key messages.
-            if (fCache.find(invalidKeyMsgs[i].key())) {
+            if (sk_sp<TextureProxy>* proxy = fCache.find(invalidKeyMsgs[i].key())) {
+                this->removeFromGlobalCache(invalidKeyMsgs[i].key(), proxy->get());
                 fCache.remove(invalidKeyMsgs[i].key());
             }
         }
@@ -146,8 +240,19 @@ void ProxyCache::freeUniquelyHeld() {
     });
 
     for (const skgpu::UniqueKey& k : toRemove) {
+        this->removeFromGlobalCache(k, fCache.find(k)->get());
         fCache.remove(k);
     }
+
+    toRemove.clear();
+    fSharedCache.foreach([&](const skgpu::UniqueKey& key, const sk_sp<TextureProxy>* proxy) {
+        if ((*proxy)->unique()) {
+            toRemove.push_back(key);
+        }
+    });
+    for (const skgpu::UniqueKey& k : toRemove) {
+        fSharedCache.remove(k);
+    }
 }
 
 void ProxyCache::purgeProxiesNotUsedSince(const skgpu::StdSteadyClock::time_point* purgeTime) {
@@ -165,8 +270,13 @@ void ProxyCache::purgeProxiesNotUsedSince(const skgpu::StdSteadyClock::time_poin
     });
 
     for (const skgpu::UniqueKey& k : toRemove) {
+        this->removeFromGlobalCache(k, fCache.find(k)->get());
         fCache.remove(k);
     }
+
+    // We can't tell when we last used the proxies shared by other Recorders, so we let them all
+    // go. Any still in the GlobalCache are found again the next time they're drawn.
+    fSharedCache.reset();
 }
 
 #if defined(GRAPHITE_TEST_UTILS)
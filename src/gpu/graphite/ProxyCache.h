@@ -9,11 +9,16 @@
 #define skgpu_graphite_ProxyCache_DEFINED
 
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSpan.h"
+#include "include/private/base/SkTArray.h"
 #include "src/core/SkMessageBus.h"
 #include "src/core/SkTHash.h"
 #include "src/gpu/GpuTypesPriv.h"
 #include "src/gpu/ResourceKey.h"
 
+#include <cstdint>
+#include <functional>
+
 class SkBitmap;
 
 namespace skgpu {
@@ -23,10 +28,15 @@ namespace skgpu {
 
 namespace skgpu::graphite {
 
+class GlobalCache;
 class Recorder;
 class TextureProxy;
 
 // This class encapsulates the _internal_ Recorder-local caching of utility proxies.
+//
+// Proxies this Recorder uploads are also offered to other Recorders through the GlobalCache, and
+// proxies other Recorders have uploaded are used in place of uploading our own. The latter are
+// kept apart, since their textures belong to another Recorder's ResourceCache.
 // TODO:
 //   Add purgeProxiesNotUsedSince method
 //   Link into Context purging system
@@ -38,8 +48,20 @@ public:
 
     sk_sp<TextureProxy> findOrCreateCachedProxy(Recorder*, const SkBitmap&, Mipmapped);
 
+    // Like the above, for a texture that's drawn rather than uploaded, such as a picture-backed
+    // image's. 'contentKey' must identify everything that goes into its contents, since nothing
+    // will invalidate it; 'create' draws the texture if no Recorder has it yet.
+    sk_sp<TextureProxy> findOrCreateCachedProxy(Recorder*,
+                                                SkSpan<const uint32_t> contentKey,
+                                                Mipmapped,
+                                                const std::function<sk_sp<TextureProxy>()>& create);
+
     void purgeAll();
 
+    // The proxies uploaded since the last call, to be published to the GlobalCache once the
+    // Recording holding their uploads has been inserted.
+    skia_private::TArray<sk_sp<TextureProxy>> detachPendingSharedUploads();
+
 #if defined(GRAPHITE_TEST_UTILS)
     int numCached() const;
     sk_sp<TextureProxy> find(const SkBitmap&, Mipmapped);
@@ -55,6 +77,16 @@ private:
     void freeUniquelyHeld();
     void purgeProxiesNotUsedSince(const skgpu::StdSteadyClock::time_point* purgeTime);
 
+    sk_sp<TextureProxy> findCachedProxy(const skgpu::UniqueKey&);
+    // Looks for either key (the first may be invalid) here, and then among the proxies other
+    // Recorders have shared.
+    sk_sp<TextureProxy> findCachedOrSharedProxy(Recorder*,
+                                                const skgpu::UniqueKey& mipmappedKey,
+                                                const skgpu::UniqueKey& key);
+    void addCreatedProxy(const skgpu::UniqueKey&, sk_sp<TextureProxy>);
+    // Must be called before fCache drops a proxy, which the GlobalCache may point to.
+    void removeFromGlobalCache(const skgpu::UniqueKey&, const TextureProxy*);
+
     typedef SkMessageBus<skgpu::UniqueKeyInvalidatedMsg_Graphite, uint32_t>::Inbox InvalidKeyInbox;
 
     InvalidKeyInbox fInvalidUniqueKeyInbox;
@@ -66,6 +98,11 @@ private:
             UniqueKeyProxyHash;
 
     UniqueKeyProxyHash fCache;
+    // Proxies uploaded by other Recorders, found through the GlobalCache.
+    UniqueKeyProxyHash fSharedCache;
+
+    skia_private::TArray<sk_sp<TextureProxy>> fPendingSharedUploads;
+    GlobalCache* fGlobalCache = nullptr;  // Set by the first findOrCreateCachedProxy()
 };
 
 } // namespace skgpu::graphite
@@ -9,33 +9,45 @@
 
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkColorType.h"
+#include "include/private/base/SkTArray.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkTaskGroup.h"
+#include "src/core/SkWriteBuffer.h"
 #include "src/gpu/graphite/AttachmentTypes.h"
 #include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ContextPriv.h"
 #include "src/gpu/graphite/ContextUtils.h"
+#include "src/gpu/graphite/GlobalCache.h"
 #include "src/gpu/graphite/GraphicsPipeline.h"
 #include "src/gpu/graphite/GraphicsPipelineDesc.h"
 #include "src/gpu/graphite/KeyContext.h"
 #include "src/gpu/graphite/Log.h"
 #include "src/gpu/graphite/PaintOptionsPriv.h"
+#include "src/gpu/graphite/PaintParamsKey.h"
 #include "src/gpu/graphite/Renderer.h"
 #include "src/gpu/graphite/RendererProvider.h"
 #include "src/gpu/graphite/ResourceProvider.h"
 #include "src/gpu/graphite/RuntimeEffectDictionary.h"
+#include "src/gpu/graphite/ShaderCodeDictionary.h"
+#include "src/gpu/graphite/SharedContext.h"
 #include "src/gpu/graphite/UniquePaintParamsID.h"
 
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
 namespace {
 
 using namespace skgpu::graphite;
 
-void compile(const RendererProvider* rendererProvider,
-             ResourceProvider* resourceProvider,
-             const KeyContext& keyContext,
-             UniquePaintParamsID uniqueID,
-             DrawTypeFlags drawTypes,
-             SkSpan<RenderPassDesc> renderPassDescs,
-             bool withPrimitiveBlender,
-             Coverage coverage) {
+void collect_pipeline_descs(const RendererProvider* rendererProvider,
+                            UniquePaintParamsID uniqueID,
+                            DrawTypeFlags drawTypes,
+                            bool withPrimitiveBlender,
+                            Coverage coverage,
+                            skia_private::TArray<GraphicsPipelineDesc>* pipelineDescs) {
     for (const Renderer* r : rendererProvider->renderers()) {
         if (!(r->drawTypes() & drawTypes)) {
             continue;
@@ -58,20 +70,172 @@ void compile(const RendererProvider* rendererProvider,
 
             UniquePaintParamsID paintID = s->performsShading() ? uniqueID
                                                                : UniquePaintParamsID::InvalidID();
-            GraphicsPipelineDesc pipelineDesc(s, paintID);
-
-            for (const RenderPassDesc& renderPassDesc : renderPassDescs) {
-                auto pipeline = resourceProvider->findOrCreateGraphicsPipeline(
-                        keyContext.rtEffectDict(),
-                        pipelineDesc,
-                        renderPassDesc);
-                if (!pipeline) {
-                    SKGPU_LOG_W("Failed to create GraphicsPipeline in precompile!");
-                    return;
-                }
-            }
+            pipelineDescs->push_back(GraphicsPipelineDesc(s, paintID));
+        }
+    }
+}
+
+bool compile(ResourceProvider* resourceProvider,
+             const RuntimeEffectDictionary* rtEffectDict,
+             const GraphicsPipelineDesc& pipelineDesc,
+             SkSpan<const RenderPassDesc> renderPassDescs) {
+    for (const RenderPassDesc& renderPassDesc : renderPassDescs) {
+        auto pipeline = resourceProvider->findOrCreateGraphicsPipeline(rtEffectDict,
+                                                                       pipelineDesc,
+                                                                       renderPassDesc);
+        if (!pipeline) {
+            SKGPU_LOG_W("Failed to create GraphicsPipeline in precompile!");
+            return false;
+        }
+    }
+    return true;
+}
+
+// Everything the pipelines of one Precompile() call need, shared by the tasks creating them on
+// the Context's executor. The RuntimeEffectDictionary is filled in while enumerating the
+// combinations, so the tasks are only started once that's finished.
+struct PrecompileJob {
+    std::unique_ptr<RuntimeEffectDictionary> fRTEffectDict;
+    skia_private::TArray<GraphicsPipelineDesc> fPipelineDescs;
+    skia_private::TArray<RenderPassDesc> fRenderPassDescs;
+};
+
+void compile_async(SkTaskGroup* tasks,
+                   SharedContext* sharedContext,
+                   std::shared_ptr<const PrecompileJob> job) {
+    // Each task creates the pipelines of one GraphicsPipelineDesc for all the RenderPassDescs.
+    // ResourceProviders aren't thread safe, so each task gets its own; the pipelines themselves
+    // land in the GlobalCache shared by every Recorder.
+    for (int i = 0; i < job->fPipelineDescs.size(); ++i) {
+        tasks->add([sharedContext, job, i] {
+            skgpu::SingleOwner singleOwner;
+            std::unique_ptr<ResourceProvider> resourceProvider =
+                    sharedContext->makeResourceProvider(&singleOwner,
+                                                        SK_InvalidGenID,
+                                                        /* resourceBudget= */ 0);
+            compile(resourceProvider.get(),
+                    job->fRTEffectDict.get(),
+                    job->fPipelineDescs[i],
+                    job->fRenderPassDescs);
+        });
+    }
+}
+
+// Creates the job's pipelines on the Context's executor if it has one, or right away if not.
+void run_job(Context* context, std::shared_ptr<PrecompileJob> job) {
+    if (SkTaskGroup* tasks = context->priv().precompileTasks()) {
+        compile_async(tasks, context->priv().sharedContext(), std::move(job));
+        return;
+    }
+
+    for (const GraphicsPipelineDesc& pipelineDesc : job->fPipelineDescs) {
+        if (!compile(context->priv().resourceProvider(),
+                     job->fRTEffectDict.get(),
+                     pipelineDesc,
+                     job->fRenderPassDescs)) {
+            return;
+        }
+    }
+}
+
+// Precompilation targets RGBA 8888, since that's the only information we have.
+RenderPassDesc make_render_pass_desc(const Caps* caps,
+                                     const TextureInfo& info,
+                                     SkEnumBitMask<DepthStencilFlags> depthStencilFlags,
+                                     bool requiresMSAA) {
+    // Note: at least on Metal, the LoadOp, StoreOp and clearColor fields don't influence the
+    // actual RenderPassDescKey.
+    return RenderPassDesc::Make(caps,
+                                info,
+                                LoadOp::kClear,
+                                StoreOp::kStore,
+                                depthStencilFlags,
+                                /* clearColor= */ { .0f, .0f, .0f, .0f },
+                                requiresMSAA,
+                                caps->getWriteSwizzle(kRGBA_8888_SkColorType, info));
+}
+
+TextureInfo precompile_target_info(const Caps* caps) {
+    // TODO: we need iterate over a broader set of TextureInfos here. Perhaps, allow the client
+    // to pass in colorType, mipmapping and protection.
+    return caps->getDefaultSampledTextureInfo(kRGBA_8888_SkColorType,
+                                              skgpu::Mipmapped::kNo,
+                                              skgpu::Protected::kNo,
+                                              skgpu::Renderable::kYes);
+}
+
+// Increment this whenever the manifest format changes.
+static constexpr int kManifestVersion = 1;
+
+// One pipeline in a manifest. RenderSteps are named, since their unique IDs depend on the order
+// RendererProviders are made in, and paints are stored as their PaintParamsKeys' snippet IDs,
+// since UniquePaintParamsIDs are handed out in the order keys are first seen.
+struct ManifestEntry {
+    std::string fRenderStep;
+    std::vector<int32_t> fPaintKey;  // Empty if the RenderStep doesn't shade
+    bool fRequiresMSAA;
+    int fDepthStencilFlags;
+
+    auto tie() const {
+        return std::tie(fRenderStep, fPaintKey, fRequiresMSAA, fDepthStencilFlags);
+    }
+    bool operator<(const ManifestEntry& that) const { return this->tie() < that.tie(); }
+    bool operator==(const ManifestEntry& that) const { return this->tie() == that.tie(); }
+};
+
+DepthStencilFlags depth_stencil_flags(const Caps* caps, const RenderPassDesc& renderPassDesc) {
+    const TextureInfo& info = renderPassDesc.fDepthStencilAttachment.fTextureInfo;
+    if (!info.isValid()) {
+        return DepthStencilFlags::kNone;
+    }
+    for (DepthStencilFlags flags : {DepthStencilFlags::kDepthStencil,
+                                    DepthStencilFlags::kDepth,
+                                    DepthStencilFlags::kStencil}) {
+        if (info == caps->getDefaultDepthStencilTextureInfo(flags,
+                                                            renderPassDesc.fSampleCount,
+                                                            info.isProtected())) {
+            return flags;
         }
     }
+    return DepthStencilFlags::kDepthStencil;
+}
+
+// Checks that the snippet IDs starting at 'index' form a node of built-in snippets, each with the
+// number of children the ShaderCodeDictionary expects, and if 'builder' isn't null, adds them to
+// it. Returns the index just past the node, or -1 if the IDs don't form one.
+int add_key_node(const ShaderCodeDictionary* dict,
+                 const std::vector<int32_t>& paintKey,
+                 int index,
+                 PaintParamsKeyBuilder* builder) {
+    if (index < 0 || index >= SkToInt(paintKey.size())) {
+        return -1;
+    }
+    const int32_t id = paintKey[index++];
+    const ShaderSnippet* snippet = id >= 0 && id < kBuiltInCodeSnippetIDCount ? dict->getEntry(id)
+                                                                               : nullptr;
+    if (!snippet) {
+        return -1;
+    }
+    if (builder) {
+        builder->beginBlock(id);
+    }
+    for (int i = 0; i < snippet->fNumChildren; ++i) {
+        index = add_key_node(dict, paintKey, index, builder);
+    }
+    if (builder) {
+        builder->endBlock();
+    }
+    return index;
+}
+
+bool add_key(const ShaderCodeDictionary* dict,
+             const std::vector<int32_t>& paintKey,
+             PaintParamsKeyBuilder* builder) {
+    int index = 0;
+    while (index >= 0 && index < SkToInt(paintKey.size())) {
+        index = add_key_node(dict, paintKey, index, builder);
+    }
+    return index >= 0;
 }
 
 } // anonymous namespace
@@ -83,62 +247,33 @@ void Precompile(Context* context, const PaintOptions& options, DrawTypeFlags dra
     ShaderCodeDictionary* dict = context->priv().shaderCodeDictionary();
     const Caps* caps = context->priv().caps();
 
-    auto rtEffectDict = std::make_unique<RuntimeEffectDictionary>();
+    auto job = std::make_shared<PrecompileJob>();
+    job->fRTEffectDict = std::make_unique<RuntimeEffectDictionary>();
 
     SkColorInfo ci(kRGBA_8888_SkColorType, kPremul_SkAlphaType, nullptr);
-    KeyContext keyContext(
-            caps, dict, rtEffectDict.get(), ci, /* dstTexture= */ nullptr, /* dstOffset= */ {0, 0});
+    KeyContext keyContext(caps,
+                          dict,
+                          job->fRTEffectDict.get(),
+                          ci,
+                          /* dstTexture= */ nullptr,
+                          /* dstOffset= */ {0, 0});
 
     // Since the precompilation path's uniforms aren't used and don't change the key,
     // the exact layout doesn't matter
     PipelineDataGatherer gatherer(Layout::kMetal);
 
-    // TODO: we need iterate over a broader set of TextureInfos here. Perhaps, allow the client
-    // to pass in colorType, mipmapping and protection.
-    TextureInfo info = caps->getDefaultSampledTextureInfo(ci.colorType(),
-                                                          Mipmapped::kNo,
-                                                          Protected::kNo,
-                                                          Renderable::kYes);
+    TextureInfo info = precompile_target_info(caps);
 
-    // Note: at least on Metal, the LoadOp, StoreOp and clearColor fields don't influence the
-    // actual RenderPassDescKey.
     // TODO: if all of the Renderers associated w/ the requested drawTypes require MSAA we
     // do not need to generate the combinations w/ the non-MSAA RenderPassDescs.
-    RenderPassDesc renderPassDescs[] = {
-        RenderPassDesc::Make(caps,
-                             info,
-                             LoadOp::kClear,
-                             StoreOp::kStore,
-                             DepthStencilFlags::kDepth,
-                             /* clearColor= */ { .0f, .0f, .0f, .0f },
-                             /* requiresMSAA= */ true,
-                             caps->getWriteSwizzle(ci.colorType(), info)),
-        RenderPassDesc::Make(caps,
-                             info,
-                             LoadOp::kClear,
-                             StoreOp::kStore,
-                             DepthStencilFlags::kDepthStencil,
-                             /* clearColor= */ { .0f, .0f, .0f, .0f },
-                             /* requiresMSAA= */ true,
-                             caps->getWriteSwizzle(ci.colorType(), info)),
-        RenderPassDesc::Make(caps,
-                             info,
-                             LoadOp::kClear,
-                             StoreOp::kStore,
-                             DepthStencilFlags::kDepth,
-                             /* clearColor= */ { .0f, .0f, .0f, .0f },
-                             /* requiresMSAA= */ false,
-                             caps->getWriteSwizzle(ci.colorType(), info)),
-        RenderPassDesc::Make(caps,
-                             info,
-                             LoadOp::kClear,
-                             StoreOp::kStore,
-                             DepthStencilFlags::kDepthStencil,
-                             /* clearColor= */ { .0f, .0f, .0f, .0f },
-                             /* requiresMSAA= */ false,
-                             caps->getWriteSwizzle(ci.colorType(), info)),
+    job->fRenderPassDescs = {
+        make_render_pass_desc(caps, info, DepthStencilFlags::kDepth,        /*requiresMSAA=*/true),
+        make_render_pass_desc(caps, info, DepthStencilFlags::kDepthStencil, /*requiresMSAA=*/true),
+        make_render_pass_desc(caps, info, DepthStencilFlags::kDepth,        /*requiresMSAA=*/false),
+        make_render_pass_desc(caps, info, DepthStencilFlags::kDepthStencil, /*requiresMSAA=*/false),
     };
 
+    const RendererProvider* rendererProvider = context->priv().rendererProvider();
     for (Coverage coverage : {Coverage::kNone, Coverage::kSingleChannel, Coverage::kLCD}) {
         options.priv().buildCombinations(
             keyContext,
@@ -146,11 +281,10 @@ void Precompile(Context* context, const PaintOptions& options, DrawTypeFlags dra
             /* addPrimitiveBlender= */ false,
             coverage,
              [&](UniquePaintParamsID uniqueID) {
-                 compile(context->priv().rendererProvider(),
-                         context->priv().resourceProvider(),
-                         keyContext, uniqueID,
+                 collect_pipeline_descs(
+                         rendererProvider, uniqueID,
                          static_cast<DrawTypeFlags>(drawTypes & ~DrawTypeFlags::kDrawVertices),
-                         renderPassDescs, /* withPrimitiveBlender= */ false, coverage);
+                         /* withPrimitiveBlender= */ false, coverage, &job->fPipelineDescs);
              });
     }
 
@@ -162,14 +296,133 @@ void Precompile(Context* context, const PaintOptions& options, DrawTypeFlags dra
                 /* addPrimitiveBlender= */ true,
                 coverage,
                 [&](UniquePaintParamsID uniqueID) {
-                    compile(context->priv().rendererProvider(),
-                            context->priv().resourceProvider(),
-                            keyContext, uniqueID,
-                            DrawTypeFlags::kDrawVertices,
-                            renderPassDescs, /* withPrimitiveBlender= */ true, coverage);
+                    collect_pipeline_descs(rendererProvider, uniqueID,
+                                           DrawTypeFlags::kDrawVertices,
+                                           /* withPrimitiveBlender= */ true, coverage,
+                                           &job->fPipelineDescs);
                 });
         }
     }
+
+    run_job(context, std::move(job));
+}
+
+sk_sp<SkData> SerializePipelineManifest(Context* context) {
+    const Caps* caps = context->priv().caps();
+    const ShaderCodeDictionary* dict = context->priv().shaderCodeDictionary();
+    const RendererProvider* rendererProvider = context->priv().rendererProvider();
+
+    std::vector<ManifestEntry> entries;
+    for (const GlobalCache::CreatedGraphicsPipeline& created :
+                context->priv().globalCache()->createdGraphicsPipelines()) {
+        const RenderStep* step = rendererProvider->lookup(created.fPipelineDesc.renderStepID());
+        if (!step) {
+            continue;
+        }
+        SkSpan<const int32_t> paintKey = dict->lookup(created.fPipelineDesc.paintParamsID()).data();
+        if (std::any_of(paintKey.begin(), paintKey.end(), [](int32_t id) {
+                return id < 0 || id >= kBuiltInCodeSnippetIDCount;
+            })) {
+            continue;  // The key uses a runtime effect, whose snippet ID won't be the same later
+        }
+        entries.push_back({step->name(),
+                           std::vector<int32_t>(paintKey.begin(), paintKey.end()),
+                           created.fRenderPassDesc.fSampleCount > 1,
+                           static_cast<int>(depth_stencil_flags(caps, created.fRenderPassDesc))});
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    SkBinaryWriteBuffer writer({});
+    writer.writeInt(kManifestVersion);
+    // A cheap check that the manifest came from a build with the same built-in snippets.
+    writer.writeInt(kBuiltInCodeSnippetIDCount);
+    writer.writeUInt(SkToU32(entries.size()));
+    for (const ManifestEntry& entry : entries) {
+        writer.writeString(entry.fRenderStep);
+        writer.writeBool(entry.fRequiresMSAA);
+        writer.writeInt(entry.fDepthStencilFlags);
+        writer.writeUInt(SkToU32(entry.fPaintKey.size()));
+        for (int32_t id : entry.fPaintKey) {
+            writer.writeInt(id);
+        }
+    }
+    return writer.snapshotAsData();
+}
+
+bool PrecompileFromManifest(Context* context, const SkData& manifest) {
+    const Caps* caps = context->priv().caps();
+    ShaderCodeDictionary* dict = context->priv().shaderCodeDictionary();
+    const RendererProvider* rendererProvider = context->priv().rendererProvider();
+
+    SkReadBuffer reader(manifest.data(), manifest.size());
+    if (!reader.validate(reader.readInt() == kManifestVersion) ||
+        !reader.validate(reader.readInt() == kBuiltInCodeSnippetIDCount)) {
+        return false;
+    }
+    const uint32_t count = reader.readUInt();
+
+    // One job for each kind of render pass, indexed by [requiresMSAA][depthStencilFlags].
+    static constexpr int kDepthStencilFlagsCount =
+            static_cast<int>(DepthStencilFlags::kDepthStencil) + 1;
+    std::shared_ptr<PrecompileJob> jobs[2][kDepthStencilFlagsCount];
+    const TextureInfo info = precompile_target_info(caps);
+
+    PaintParamsKeyBuilder builder(dict);
+    for (uint32_t i = 0; i < count && reader.isValid(); ++i) {
+        SkString renderStep;
+        reader.readString(&renderStep);
+        const bool requiresMSAA = reader.readBool();
+        const int depthStencilFlags = reader.readInt();
+        const uint32_t paintKeySize = reader.readUInt();
+        if (!reader.validate(depthStencilFlags >= 0 &&
+                             depthStencilFlags < kDepthStencilFlagsCount &&
+                             paintKeySize <= reader.available() / sizeof(int32_t))) {
+            return false;
+        }
+        std::vector<int32_t> paintKey(paintKeySize);
+        for (int32_t& id : paintKey) {
+            id = reader.readInt();
+        }
+
+        const RenderStep* step = rendererProvider->lookup(std::string_view(renderStep.c_str(),
+                                                                           renderStep.size()));
+        if (!step || step->performsShading() == paintKey.empty()) {
+            continue;
+        }
+        UniquePaintParamsID paintID = UniquePaintParamsID::InvalidID();
+        if (step->performsShading()) {
+            if (!add_key(dict, paintKey, /*builder=*/nullptr)) {
+                continue;
+            }
+            add_key(dict, paintKey, &builder);
+            paintID = dict->findOrCreate(&builder);
+            if (!paintID.isValid()) {
+                continue;
+            }
+        }
+
+        std::shared_ptr<PrecompileJob>& job = jobs[requiresMSAA][depthStencilFlags];
+        if (!job) {
+            job = std::make_shared<PrecompileJob>();
+            job->fRTEffectDict = std::make_unique<RuntimeEffectDictionary>();
+            job->fRenderPassDescs.push_back(make_render_pass_desc(
+                    caps, info, static_cast<DepthStencilFlags>(depthStencilFlags), requiresMSAA));
+        }
+        job->fPipelineDescs.push_back(GraphicsPipelineDesc(step, paintID));
+    }
+    if (!reader.isValid()) {
+        return false;
+    }
+
+    for (auto& jobsForMSAA : jobs) {
+        for (std::shared_ptr<PrecompileJob>& job : jobsForMSAA) {
+            if (job) {
+                run_job(context, std::move(job));
+            }
+        }
+    }
+    return true;
 }
 
 } // namespace skgpu::graphite
@@ -8,6 +8,8 @@
 #ifndef skgpu_graphite_PublicPrecompile_DEFINED
 #define skgpu_graphite_PublicPrecompile_DEFINED
 
+#include "include/core/SkData.h"
+#include "include/core/SkRefCnt.h"
 #include "include/gpu/graphite/GraphiteTypes.h"
 
 // TODO: this header should be moved to include/gpu/graphite once the precompilation API
@@ -23,12 +25,36 @@ class PaintOptions;
  * drawing. Graphite will always be able to perform an inline compilation if some SkPaint
  * combination was omitted from precompilation.
  *
+ * If the Context was made with a ContextOptions::fExecutor, the pipelines are created on its
+ * threads and this returns once the combinations have been enumerated. A draw that needs a
+ * pipeline before its task has finished compiles it inline.
+ *
  *   @param context        the Context to which the actual draws will be submitted
  *   @param paintOptions   captures a set of SkPaints that will be drawn
  *   @param drawTypes      communicates which primitives those paints will be drawn with
  */
 void Precompile(Context*, const PaintOptions&, DrawTypeFlags = kMostCommon);
 
+/**
+ * Describes every graphics pipeline the Context has created so far, whether for draws or through
+ * Precompile(), so that a later run can precompile the same set with PrecompileFromManifest()
+ * instead of listing PaintOptions by hand.
+ *
+ * Manifests are only understood by the build of Skia that wrote them. Pipelines for paints that
+ * use SkRuntimeEffects are left out, since those effects are only known to the Context at runtime.
+ * Render passes are recorded by their MSAA and depth/stencil requirements, and are recreated
+ * against the same RGBA 8888 target Precompile() assumes.
+ */
+sk_sp<SkData> SerializePipelineManifest(Context*);
+
+/**
+ * Creates the pipelines listed in a manifest from SerializePipelineManifest(), on the Context's
+ * executor if it has one, like Precompile(). Entries this build doesn't recognize are skipped.
+ *
+ * Returns false if the data isn't a manifest from this build.
+ */
+bool PrecompileFromManifest(Context*, const SkData& manifest);
+
 } // namespace skgpu::graphite
 
 #endif // skgpu_graphite_PublicPrecompile_DEFINED
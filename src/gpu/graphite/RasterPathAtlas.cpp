@@ -13,6 +13,7 @@
 #include "src/core/SkDrawBase.h"
 #include "src/core/SkIPoint16.h"
 #include "src/core/SkRasterClip.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/gpu/graphite/AtlasProvider.h"
 #include "src/gpu/graphite/DrawContext.h"
 #include "src/gpu/graphite/Log.h"
@@ -33,7 +34,12 @@ RasterPathAtlas::RasterPathAtlas()
     }
 }
 
+RasterPathAtlas::~RasterPathAtlas() = default;
+
 void RasterPathAtlas::recordUploads(DrawContext* dc, Recorder* recorder) {
+    // The pixels can't be copied for upload until every mask in them has been drawn.
+    this->finishPendingMasks();
+
     // Cycle through all the pages and handle their uploads
     PageList::Iter pageIter;
     pageIter.init(fPageList, PageList::Iter::kHead_IterStart);
@@ -232,35 +238,26 @@ const TextureProxy* RasterPathAtlas::onAddShape(Recorder* recorder,
         mru->fPixels.erase(0);
     }
 
-    // Rasterize path to backing pixmap
-    // TODO: render in a separate thread?
-    SkDrawBase draw;
-    draw.fBlitterChooser = SkA8Blitter_Choose;
-    draw.fDst      = mru->fPixels;
-    SkRasterClip rasterClip;
     SkIRect iAtlasBounds = SkIRect::MakeXYWH(iPos.x(), iPos.y(), maskSize.x(), maskSize.y());
-    rasterClip.setRect(iAtlasBounds);
-    draw.fRC       = &rasterClip;
-
-    SkPaint paint;
-    paint.setBlendMode(SkBlendMode::kSrc);  // "Replace" mode
-    paint.setAntiAlias(true);
-    // SkPaint's color is unpremul so this will produce alpha in every channel.
-    paint.setColor(SK_ColorWHITE);
-    strokeRec.applyToPaint(&paint);
 
     SkMatrix translatedMatrix = SkMatrix(transform);
     // The atlas transform of the shape is the linear-components (scale, rotation, skew) of
     // `localToDevice` translated by the top-left offset of `atlasBounds.
     translatedMatrix.postTranslate(iAtlasBounds.x(), iAtlasBounds.y());
 
-    draw.fCTM = &translatedMatrix;
     SkPath path = shape.asPath();
     if (path.isInverseFillType()) {
         // The shader will handle the inverse fill in this case
         path.toggleInverseFillType();
     }
-    draw.drawPathCoverage(path, paint);
+
+    // Rasterize path to backing pixmap, on the Recorder's executor if it has one.
+    PendingMask mask{mru->fPixels, std::move(path), translatedMatrix, strokeRec, iAtlasBounds};
+    if (SkExecutor* executor = recorder->priv().executor()) {
+        this->addPendingMask(executor, std::move(mask));
+    } else {
+        RasterizeMask(mask);
+    }
 
     // Add atlasBounds to dirtyRect for later upload, including the 1px padding applied by the
     // rectanizer. If we didn't include this then our uploads would not include writes to the
@@ -276,7 +273,57 @@ const TextureProxy* RasterPathAtlas::onAddShape(Recorder* recorder,
     return texProxy;
 }
 
+void RasterPathAtlas::RasterizeMask(const PendingMask& mask) {
+    SkDrawBase draw;
+    draw.fBlitterChooser = SkA8Blitter_Choose;
+    draw.fDst      = mask.fPixels;
+    SkRasterClip rasterClip;
+    rasterClip.setRect(mask.fAtlasBounds);
+    draw.fRC       = &rasterClip;
+
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);  // "Replace" mode
+    paint.setAntiAlias(true);
+    // SkPaint's color is unpremul so this will produce alpha in every channel.
+    paint.setColor(SK_ColorWHITE);
+    mask.fStrokeRec.applyToPaint(&paint);
+
+    draw.fCTM = &mask.fMatrix;
+    draw.drawPathCoverage(mask.fPath, paint);
+}
+
+void RasterPathAtlas::addPendingMask(SkExecutor* executor, PendingMask&& mask) {
+    fPendingMasks.push_back(std::move(mask));
+    if (fPendingMasks.size() < kMasksPerTask) {
+        return;
+    }
+
+    if (!fMaskTasks) {
+        fMaskTasks = std::make_unique<SkTaskGroup>(*executor);
+    }
+    fMaskTasks->add([masks = std::move(fPendingMasks)]() {
+        for (const PendingMask& pendingMask : masks) {
+            RasterizeMask(pendingMask);
+        }
+    });
+    fPendingMasks.clear();
+}
+
+void RasterPathAtlas::finishPendingMasks() {
+    // Draw the last partial batch here while the executor works through the others.
+    for (const PendingMask& mask : fPendingMasks) {
+        RasterizeMask(mask);
+    }
+    fPendingMasks.clear();
+    if (fMaskTasks) {
+        fMaskTasks->wait();
+    }
+}
+
 void RasterPathAtlas::reset(Page* lru) {
+    // Masks that are still being drawn may be in this Page.
+    this->finishPendingMasks();
+
     lru->fRectanizer.reset();
 
     // clear backing data for next pass
@@ -8,12 +8,22 @@
 #ifndef skgpu_graphite_RasterPathAtlas_DEFINED
 #define skgpu_graphite_RasterPathAtlas_DEFINED
 
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkStrokeRec.h"
 #include "src/base/SkTInternalLList.h"
 #include "src/core/SkTHash.h"
 #include "src/gpu/AtlasTypes.h"
 #include "src/gpu/ResourceKey.h"
 #include "src/gpu/graphite/PathAtlas.h"
 
+#include <memory>
+#include <vector>
+
+class SkExecutor;
+class SkTaskGroup;
+
 namespace skgpu::graphite {
 
 /**
@@ -24,12 +34,15 @@ namespace skgpu::graphite {
  *
  * After a successful call to `recordUploads()`, the client is free to call `reset()` and start
  * adding new shapes for a future atlas render.
+ *
+ * If the Recorder has an executor, the masks are rasterized on its threads in batches and
+ * `recordUploads()` waits for them to finish before it copies the pixels.
  * TODO: We should cache Shapes for future frames to avoid the cost of raster pipeline rendering.
  */
 class RasterPathAtlas : public PathAtlas {
 public:
     RasterPathAtlas();
-    ~RasterPathAtlas() override {}
+    ~RasterPathAtlas() override;
     void recordUploads(DrawContext*, Recorder*);
 
 protected:
@@ -74,6 +87,25 @@ private:
         SK_DECLARE_INTERNAL_LLIST_INTERFACE(Page);
     };
 
+    // A mask that has been allocated a rect in a Page but has yet to be rasterized into it. Each
+    // mask only writes within its own rect, so masks in the same Page can be drawn concurrently.
+    struct PendingMask {
+        SkPixmap fPixels;
+        SkPath fPath;
+        SkMatrix fMatrix;
+        SkStrokeRec fStrokeRec;
+        SkIRect fAtlasBounds;
+    };
+    static void RasterizeMask(const PendingMask&);
+
+    // Masks are handed to the executor this many at a time, to amortize the cost of a task over
+    // the many small paths that typically fall back to the raster atlas.
+    static constexpr int kMasksPerTask = 16;
+
+    void addPendingMask(SkExecutor*, PendingMask&&);
+    // Rasterizes any masks that haven't been handed to the executor yet and waits for the rest.
+    void finishPendingMasks();
+
     void makeMRU(Page*, Recorder*);
     // Free up atlas allocations, if necessary. After this call the atlas can be considered
     // available for new shape insertions. However this method does not have any bearing on the
@@ -90,6 +122,11 @@ private:
     PageList fPageList;
     // Allocated array of pages (backing data for list)
     Page fPageArray[kMaxPages];
+
+    std::vector<PendingMask> fPendingMasks;
+    // Declared after the Pages so that it is destroyed, and waits on any tasks that are still
+    // writing to their pixels, first.
+    std::unique_ptr<SkTaskGroup> fMaskTasks;
 };
 
 }  // namespace skgpu::graphite
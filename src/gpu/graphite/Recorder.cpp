@@ -99,7 +99,9 @@ Recorder::Recorder(sk_sp<SharedContext> sharedContext, const RecorderOptions& op
         , fAtlasProvider(std::make_unique<AtlasProvider>(this))
         , fTokenTracker(std::make_unique<TokenTracker>())
         , fStrikeCache(std::make_unique<sktext::gpu::StrikeCache>())
-        , fTextBlobCache(std::make_unique<sktext::gpu::TextBlobRedrawCoordinator>(fUniqueID)) {
+        , fTextBlobCache(std::make_unique<sktext::gpu::TextBlobRedrawCoordinator>(fUniqueID))
+        , fExecutor(options.fExecutor)
+        , fCacheYUVAConversions(options.fCacheYUVAConversions) {
     fClientImageProvider = options.fImageProvider;
     if (!fClientImageProvider) {
         fClientImageProvider = DefaultImageProvider::Make();
@@ -141,6 +143,9 @@ BackendApi Recorder::backend() const { return fSharedContext->backend(); }
 std::unique_ptr<Recording> Recorder::snap() {
     TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     ASSERT_SINGLE_OWNER
+    if (sk_sp<Task> atlasTask = fAtlasProvider->snapComputePathAtlasTask(this)) {
+        fGraph->add(std::move(atlasTask));
+    }
     for (auto& device : fTrackedDevices) {
         device->flushPendingWorkToRecorder();
     }
@@ -174,6 +179,8 @@ std::unique_ptr<Recording> Recorder::snap() {
         fUniformDataCache = std::make_unique<UniformDataCache>();
         fGraph->reset();
         fRuntimeEffectDict->reset();
+        // The uploads went with the graph, so there's nothing to share.
+        this->priv().proxyCache()->detachPendingSharedUploads();
         return nullptr;
     }
 
@@ -190,6 +197,7 @@ std::unique_ptr<Recording> Recorder::snap() {
                                                        std::move(volatileLazyProxies),
                                                        std::move(targetProxyData),
                                                        std::move(fFinishedProcs)));
+    recording->fSharedProxyUploads = this->priv().proxyCache()->detachPendingSharedUploads();
 
     fDrawBufferManager->transferToRecording(recording.get());
     fUploadBufferManager->transferToRecording(recording.get());
@@ -391,6 +399,21 @@ void Recorder::dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const {
     // used bytes here (see Ganesh implementation).
 }
 
+ResourceCacheStats Recorder::resourceCacheStats() const {
+    ASSERT_SINGLE_OWNER
+    return fResourceProvider->getResourceCacheStats();
+}
+
+void Recorder::resetResourceCacheStats() {
+    ASSERT_SINGLE_OWNER
+    fResourceProvider->resetResourceCacheStats();
+}
+
+void Recorder::setResourceCategoryBudget(ResourceCategory category, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    fResourceProvider->setResourceCategoryBudget(category, maxBytes);
+}
+
 void RecorderPriv::add(sk_sp<Task> task) {
     ASSERT_SINGLE_OWNER_PRIV
     fRecorder->fGraph->add(std::move(task));
@@ -398,6 +421,11 @@ void RecorderPriv::add(sk_sp<Task> task) {
 
 void RecorderPriv::flushTrackedDevices() {
     ASSERT_SINGLE_OWNER_PRIV
+    // Render the compute path atlas masks of every Device's pending draws with one DispatchGroup,
+    // ahead of the draws that sample them.
+    if (sk_sp<Task> atlasTask = this->atlasProvider()->snapComputePathAtlasTask(fRecorder)) {
+        this->add(std::move(atlasTask));
+    }
     for (Device* device : fRecorder->fTrackedDevices) {
         device->flushPendingWorkToRecorder();
     }
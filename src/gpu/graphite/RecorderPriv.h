@@ -45,6 +45,8 @@ public:
         return fRecorder->fSharedContext->shaderCodeDictionary();
     }
 
+    GlobalCache* globalCache() { return fRecorder->fSharedContext->globalCache(); }
+
     const RendererProvider* rendererProvider() const {
         return fRecorder->fSharedContext->rendererProvider();
     }
@@ -57,6 +59,8 @@ public:
     TextureDataCache* textureDataCache() { return fRecorder->fTextureDataCache.get(); }
     DrawBufferManager* drawBufferManager() { return fRecorder->fDrawBufferManager.get(); }
     UploadBufferManager* uploadBufferManager() { return fRecorder->fUploadBufferManager.get(); }
+    SkExecutor* executor() const { return fRecorder->fExecutor; }
+    bool cacheYUVAConversions() const { return fRecorder->fCacheYUVAConversions; }
 
     AtlasProvider* atlasProvider() { return fRecorder->fAtlasProvider.get(); }
     TokenTracker* tokenTracker() { return fRecorder->fTokenTracker.get(); }
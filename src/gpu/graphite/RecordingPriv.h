@@ -8,6 +8,7 @@
 #ifndef skgpu_graphite_RecordingPriv_DEFINED
 #define skgpu_graphite_RecordingPriv_DEFINED
 
+#include "include/core/SkSpan.h"
 #include "include/gpu/graphite/Recording.h"
 
 namespace skgpu::graphite {
@@ -35,6 +36,10 @@ public:
     void addResourceRef(sk_sp<Resource> resource);
     void addTask(sk_sp<Task> task);
 
+    SkSpan<const sk_sp<TextureProxy>> sharedProxyUploads() const {
+        return fRecording->fSharedProxyUploads;
+    }
+
     uint32_t recorderID() const { return fRecording->fRecorderID; }
     uint32_t uniqueID() const { return fRecording->fUniqueID; }
 
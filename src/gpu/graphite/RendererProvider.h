@@ -12,6 +12,7 @@
 #include "include/core/SkVertices.h"
 #include "src/gpu/graphite/Renderer.h"
 
+#include <string_view>
 #include <vector>
 
 namespace skgpu::graphite {
@@ -81,6 +82,8 @@ public:
     }
 
     const RenderStep* lookup(uint32_t uniqueID) const;
+    // RenderStep names are stable across runs, unlike their unique IDs.
+    const RenderStep* lookup(std::string_view name) const;
 
 #ifdef SK_ENABLE_VELLO_SHADERS
     // Compute shader-based path renderer and compositor.
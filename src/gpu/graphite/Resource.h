@@ -155,6 +155,11 @@ public:
         fKey = key;
     }
 
+    // The ResourceCache accounts for the resource's memory under this category. This should only
+    // ever be set by the ResourceProvider, before the Resource is inserted into the cache.
+    ResourceCategory category() const { return fCategory; }
+    void setCategory(ResourceCategory category) { fCategory = category; }
+
     // Dumps memory usage information for this Resource to traceMemoryDump.
     void dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const;
 
@@ -356,6 +361,8 @@ private:
     // limits.
     skgpu::Budgeted fBudgeted;
 
+    ResourceCategory fCategory = ResourceCategory::kOther;
+
     // This is only used by ProxyCache::purgeProxiesNotUsedSince which is called from
     // ResourceCache::purgeResourcesNotUsedSince. When kYes, this signals that the Resource
     // should've been purged based on its timestamp at some point regardless of what its
@@ -8,6 +8,8 @@
 #include "src/gpu/graphite/ResourceCache.h"
 
 #include "include/private/base/SingleOwner.h"
+#include "include/core/SkString.h"
+#include "include/core/SkTraceMemoryDump.h"
 #include "src/base/SkRandom.h"
 #include "src/core/SkTMultiMap.h"
 #include "src/core/SkTraceEvent.h"
@@ -32,6 +34,9 @@ sk_sp<ResourceCache> ResourceCache::Make(SingleOwner* singleOwner,
 ResourceCache::ResourceCache(SingleOwner* singleOwner, uint32_t recorderID, size_t maxBytes)
         : fMaxBytes(maxBytes)
         , fSingleOwner(singleOwner) {
+    for (size_t& categoryMaxBytes : fCategoryMaxBytes) {
+        categoryMaxBytes = SIZE_MAX;
+    }
     if (recorderID != SK_InvalidGenID) {
         fProxyCache = std::make_unique<ProxyCache>(recorderID);
     }
@@ -109,7 +114,8 @@ void ResourceCache::insertResource(Resource* resource) {
     }
 
     if (resource->budgeted() == skgpu::Budgeted::kYes) {
-        fBudgetedBytes += resource->gpuMemorySize();
+        this->addToBudget(resource);
+        fStats.fAllocatedBytes += resource->gpuMemorySize();
     }
 
     this->purgeAsNeeded();
@@ -133,7 +139,7 @@ Resource* ResourceCache::findAndRefResource(const GraphiteResourceKey& key,
             fResourceMap.remove(key, resource);
             if (budgeted == skgpu::Budgeted::kNo) {
                 resource->makeUnbudgeted();
-                fBudgetedBytes -= resource->gpuMemorySize();
+                this->removeFromBudget(resource);
             }
             SkDEBUGCODE(resource->fNonShareableInCache = false;)
         } else {
@@ -144,6 +150,12 @@ Resource* ResourceCache::findAndRefResource(const GraphiteResourceKey& key,
         this->validate();
     }
 
+    if (key.shareable() == Shareable::kYes) {
+        ++(resource ? fStats.fShareableHits : fStats.fShareableMisses);
+    } else {
+        ++(resource ? fStats.fScratchHits : fStats.fScratchMisses);
+    }
+
     // processReturnedResources may have added resources back into our budget if they were being
     // using in an SkImage or SkSurface previously. However, instead of calling purgeAsNeeded in
     // processReturnedResources, we delay calling it until now so we don't end up purging a resource
@@ -289,7 +301,7 @@ void ResourceCache::returnResourceToCache(Resource* resource, LastRemovedRef rem
             fResourceMap.insert(resource->key(), resource);
             if (resource->budgeted() == skgpu::Budgeted::kNo) {
                 resource->makeBudgeted();
-                fBudgetedBytes += resource->gpuMemorySize();
+                this->addToBudget(resource);
             }
         }
     }
@@ -374,10 +386,30 @@ void ResourceCache::purgeResource(Resource* resource) {
         SkASSERT(!this->isInCache(resource));
     }
 
-    fBudgetedBytes -= resource->gpuMemorySize();
+    this->removeFromBudget(resource);
+    fStats.fPurgedBytes += resource->gpuMemorySize();
     resource->unrefCache();
 }
 
+void ResourceCache::addToBudget(const Resource* resource) {
+    fBudgetedBytes += resource->gpuMemorySize();
+    fCategoryBudgetedBytes[static_cast<int>(resource->category())] += resource->gpuMemorySize();
+}
+
+void ResourceCache::removeFromBudget(const Resource* resource) {
+    fBudgetedBytes -= resource->gpuMemorySize();
+    fCategoryBudgetedBytes[static_cast<int>(resource->category())] -= resource->gpuMemorySize();
+}
+
+bool ResourceCache::categoryOverbudget() const {
+    for (int i = 0; i < kResourceCategoryCount; ++i) {
+        if (fCategoryBudgetedBytes[i] > fCategoryMaxBytes[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void ResourceCache::purgeAsNeeded() {
     ASSERT_SINGLE_OWNER
 
@@ -405,9 +437,61 @@ void ResourceCache::purgeAsNeeded() {
         this->purgeResource(resource);
     }
 
+    this->purgeCategoriesAsNeeded();
+
     this->validate();
 }
 
+void ResourceCache::purgeCategoriesAsNeeded() {
+    if (!this->categoryOverbudget()) {
+        return;
+    }
+
+    // Unlike the overall budget, purging only some categories means skipping over resources in the
+    // queue, so sort it and collect what to purge in a separate pass like purgeResources() does.
+    fPurgeableQueue.sort();
+
+    size_t pendingBytes[kResourceCategoryCount] = {};
+    SkTDArray<Resource*> resourcesToPurge;
+    for (int i = 0; i < fPurgeableQueue.count(); i++) {
+        Resource* resource = fPurgeableQueue.at(i);
+        if (resource->timestamp() == kMaxTimestamp) {
+            // The rest of the queue is all zero sized resources.
+            break;
+        }
+        const int category = static_cast<int>(resource->category());
+        if (fCategoryBudgetedBytes[category] - pendingBytes[category] >
+            fCategoryMaxBytes[category]) {
+            pendingBytes[category] += resource->gpuMemorySize();
+            *resourcesToPurge.append() = resource;
+        }
+    }
+
+    for (int i = 0; i < resourcesToPurge.size(); i++) {
+        this->purgeResource(resourcesToPurge[i]);
+    }
+}
+
+void ResourceCache::setCategoryBudget(ResourceCategory category, size_t maxBytes) {
+    ASSERT_SINGLE_OWNER
+    fCategoryMaxBytes[static_cast<int>(category)] = maxBytes;
+    this->purgeAsNeeded();
+}
+
+ResourceCacheStats ResourceCache::getStats() const {
+    ASSERT_SINGLE_OWNER
+    ResourceCacheStats stats = fStats;
+    for (int i = 0; i < kResourceCategoryCount; ++i) {
+        stats.fBudgetedBytes[i] = fCategoryBudgetedBytes[i];
+    }
+    return stats;
+}
+
+void ResourceCache::resetStats() {
+    ASSERT_SINGLE_OWNER
+    fStats = {};
+}
+
 void ResourceCache::purgeResourcesNotUsedSince(StdSteadyClock::time_point purgeTime) {
     ASSERT_SINGLE_OWNER
     this->purgeResources(&purgeTime);
@@ -543,6 +627,31 @@ void ResourceCache::dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) con
     for (int i = 0; i < fPurgeableQueue.count(); ++i) {
         fPurgeableQueue.at(i)->dumpMemoryStatistics(traceMemoryDump);
     }
+
+    static constexpr const char* kCategoryNames[kResourceCategoryCount] = {
+            "RenderTarget", "Texture", "UploadBuffer", "Buffer", "Other"};
+    for (int i = 0; i < kResourceCategoryCount; ++i) {
+        SkString dumpName = SkStringPrintf("skia/gpu_resources/category_%s", kCategoryNames[i]);
+        traceMemoryDump->dumpNumericValue(
+                dumpName.c_str(), "size", "bytes", fCategoryBudgetedBytes[i]);
+        if (fCategoryMaxBytes[i] != SIZE_MAX) {
+            traceMemoryDump->dumpNumericValue(
+                    dumpName.c_str(), "budget", "bytes", fCategoryMaxBytes[i]);
+        }
+    }
+
+    const char* kCacheDumpName = "skia/gpu_resources/cache_stats";
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "scratch_hits", "objects",
+                                      fStats.fScratchHits);
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "scratch_misses", "objects",
+                                      fStats.fScratchMisses);
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "shareable_hits", "objects",
+                                      fStats.fShareableHits);
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "shareable_misses", "objects",
+                                      fStats.fShareableMisses);
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "allocated", "bytes",
+                                      fStats.fAllocatedBytes);
+    traceMemoryDump->dumpNumericValue(kCacheDumpName, "purged", "bytes", fStats.fPurgedBytes);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -576,6 +685,7 @@ void ResourceCache::validate() const {
         int fShareable;
         int fScratch;
         size_t fBudgetedBytes;
+        size_t fCategoryBudgetedBytes[kResourceCategoryCount];
         const ResourceMap* fResourceMap;
 
         Stats(const ResourceCache* cache) {
@@ -616,6 +726,8 @@ void ResourceCache::validate() const {
 
             if (resource->budgeted() == skgpu::Budgeted::kYes) {
                 fBudgetedBytes += resource->gpuMemorySize();
+                fCategoryBudgetedBytes[static_cast<int>(resource->category())] +=
+                        resource->gpuMemorySize();
             }
 
             if (resource->gpuMemorySize() == 0) {
@@ -673,6 +785,9 @@ void ResourceCache::validate() const {
 
     SkASSERT((stats.fScratch + stats.fShareable) == fResourceMap.count());
     SkASSERT(stats.fBudgetedBytes == fBudgetedBytes);
+    for (int i = 0; i < kResourceCategoryCount; ++i) {
+        SkASSERT(stats.fCategoryBudgetedBytes[i] == fCategoryBudgetedBytes[i]);
+    }
 }
 
 bool ResourceCache::isInCache(const Resource* resource) const {
@@ -82,6 +82,18 @@ public:
 
     size_t currentBudgetedBytes() const { return fBudgetedBytes; }
 
+    // Limits the budgeted bytes of one category of resources, on top of the overall budget. When a
+    // category goes over its limit, its least recently used purgeable resources are purged even if
+    // the cache as a whole is under budget. The default of SIZE_MAX means no separate limit.
+    void setCategoryBudget(ResourceCategory, size_t maxBytes);
+    size_t getCategoryBudget(ResourceCategory category) const {
+        return fCategoryMaxBytes[static_cast<int>(category)];
+    }
+
+    ResourceCacheStats getStats() const;
+    // Resets the lookup and allocation counters of the stats. The budgeted bytes are unaffected.
+    void resetStats();
+
     void dumpMemoryStatistics(SkTraceMemoryDump* traceMemoryDump) const;
 
 #if defined(GRAPHITE_TEST_UTILS)
@@ -124,8 +136,13 @@ private:
 
     bool inPurgeableQueue(Resource*) const;
 
+    void addToBudget(const Resource*);
+    void removeFromBudget(const Resource*);
+
     bool overbudget() const { return fBudgetedBytes > fMaxBytes; }
+    bool categoryOverbudget() const;
     void purgeAsNeeded();
+    void purgeCategoriesAsNeeded();
     void purgeResource(Resource*);
     // Passing in a nullptr for purgeTime will trigger us to try and free all unlocked resources.
     void purgeResources(const StdSteadyClock::time_point* purgeTime);
@@ -171,6 +188,11 @@ private:
     // Our budget
     size_t fMaxBytes;
     size_t fBudgetedBytes = 0;
+    size_t fCategoryBudgetedBytes[kResourceCategoryCount] = {};
+    size_t fCategoryMaxBytes[kResourceCategoryCount];
+
+    // Only the lookup and allocation counters are kept up to date, getStats() fills in the rest.
+    ResourceCacheStats fStats;
 
     SingleOwner* fSingleOwner = nullptr;
 
@@ -10,6 +10,7 @@
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkTileMode.h"
 #include "include/gpu/graphite/BackendTexture.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/graphite/Buffer.h"
 #include "src/gpu/graphite/Caps.h"
@@ -56,9 +57,11 @@ sk_sp<GraphicsPipeline> ResourceProvider::findOrCreateGraphicsPipeline(
         TRACE_EVENT0_ALWAYS("skia.shaders", "createGraphicsPipeline");
         pipeline = this->createGraphicsPipeline(runtimeDict, pipelineDesc, renderPassDesc);
         if (pipeline) {
+            SkCounters::Add(SkCounters::Counter::kPipelinesCompiled);
             // TODO: Should we store a null pipeline if we failed to create one so that subsequent
             // usage immediately sees that the pipeline cannot be created, vs. retrying every time?
             pipeline = globalCache->addGraphicsPipeline(pipelineKey, std::move(pipeline));
+            globalCache->recordCreatedGraphicsPipeline(pipelineKey, pipelineDesc, renderPassDesc);
         }
     }
     return pipeline;
@@ -144,6 +147,8 @@ sk_sp<Texture> ResourceProvider::findOrCreateTextureWithKey(SkISize dimensions,
     }
 
     tex->setKey(key);
+    tex->setCategory(fSharedContext->caps()->isRenderable(info) ? ResourceCategory::kRenderTarget
+                                                                : ResourceCategory::kTexture);
     fResourceCache->insertResource(tex.get());
 
     return tex;
@@ -252,6 +257,9 @@ sk_sp<Buffer> ResourceProvider::findOrCreateBuffer(size_t size,
     }
 
     buffer->setKey(key);
+    buffer->setCategory(type == BufferType::kXferCpuToGpu || type == BufferType::kXferGpuToCpu
+                                ? ResourceCategory::kUploadBuffer
+                                : ResourceCategory::kBuffer);
     fResourceCache->insertResource(buffer.get());
     return buffer;
 }
@@ -87,6 +87,12 @@ public:
         fResourceCache->dumpMemoryStatistics(traceMemoryDump);
     }
 
+    ResourceCacheStats getResourceCacheStats() const { return fResourceCache->getStats(); }
+    void resetResourceCacheStats() { fResourceCache->resetStats(); }
+    void setResourceCategoryBudget(ResourceCategory category, size_t maxBytes) {
+        fResourceCache->setCategoryBudget(category, maxBytes);
+    }
+
     void freeGpuResources();
     void purgeResourcesNotUsedSince(StdSteadyClock::time_point purgeTime);
 
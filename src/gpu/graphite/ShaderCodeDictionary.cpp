@@ -11,6 +11,7 @@
 #include "include/core/SkTileMode.h"
 #include "include/effects/SkRuntimeEffect.h"
 #include "include/gpu/graphite/Context.h"
+#include "src/base/SkMathPriv.h"
 #include "src/core/SkColorSpacePriv.h"
 #include "src/core/SkColorSpaceXformSteps.h"
 #include "src/core/SkRuntimeEffectPriv.h"
@@ -437,26 +438,99 @@ std::string ShaderInfo::toSkSL(const Caps* caps,
 //--------------------------------------------------------------------------------------------------
 // ShaderCodeDictionary
 
+ShaderCodeDictionary::PaintKeyTable::PaintKeyTable(int capacity)
+        : fCapacity(capacity)
+        , fSlots(new std::atomic<const PaintKeyEntry*>[capacity]) {
+    SkASSERT(SkIsPow2(capacity));
+    for (int i = 0; i < capacity; ++i) {
+        fSlots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+const ShaderCodeDictionary::PaintKeyEntry* ShaderCodeDictionary::PaintKeyTable::find(
+        const PaintParamsKey& key, uint32_t hash) const {
+    // The table is never more than 3/4 full, so there's always a null slot to stop at.
+    const int mask = fCapacity - 1;
+    for (int i = hash & mask;; i = (i + 1) & mask) {
+        const PaintKeyEntry* entry = fSlots[i].load(std::memory_order_acquire);
+        if (!entry) {
+            return nullptr;
+        }
+        if (entry->fHash == hash && entry->fKey == key) {
+            return entry;
+        }
+    }
+}
+
+void ShaderCodeDictionary::PaintKeyTable::insert(const PaintKeyEntry* entry) {
+    SkASSERT(4 * (fCount + 1) <= 3 * fCapacity);
+    const int mask = fCapacity - 1;
+    int i = entry->fHash & mask;
+    while (fSlots[i].load(std::memory_order_relaxed)) {
+        i = (i + 1) & mask;
+    }
+    // Release, so a reader that sees the entry sees everything written to it.
+    fSlots[i].store(entry, std::memory_order_release);
+    fCount++;
+}
+
+const ShaderCodeDictionary::PaintKeyEntry** ShaderCodeDictionary::idSlot(uint32_t id) const {
+    // Segment s starts at ID kFirstIDSegmentSize * (2^s - 1).
+    const uint32_t v = id / kFirstIDSegmentSize + 1;
+    const int segment = 31 - SkCLZ(v);
+    SkASSERT(segment < kIDSegmentCount);
+    return fIDSegments[segment] + (id - kFirstIDSegmentSize * ((1u << segment) - 1));
+}
+
 UniquePaintParamsID ShaderCodeDictionary::findOrCreate(PaintParamsKeyBuilder* builder) {
     AutoLockBuilderAsKey keyView{builder};
     if (!keyView->isValid()) {
         return UniquePaintParamsID::InvalidID();
     }
 
+    // Almost every key has been seen before, and is found without taking the lock.
+    const uint32_t hash = PaintParamsKey::Hash()(*keyView);
+    if (const PaintKeyEntry* entry =
+                fPaintKeyTable.load(std::memory_order_acquire)->find(*keyView, hash)) {
+        return entry->fID;
+    }
+
     SkAutoSpinlock lock{fSpinLock};
 
-    UniquePaintParamsID* existingEntry = fPaintKeyToID.find(*keyView);
-    if (existingEntry) {
-        SkASSERT(fIDToPaintKey[(*existingEntry).asUInt()] == *keyView);
-        return *existingEntry;
+    // Another thread may have added the key since we looked, perhaps to a new table.
+    const PaintKeyTable* table = fPaintKeyTables.back().get();
+    if (const PaintKeyEntry* entry = table->find(*keyView, hash)) {
+        return entry->fID;
     }
 
     // Detach from the builder and copy into the arena
-    PaintParamsKey key = keyView->clone(&fArena);
-    UniquePaintParamsID newID{SkTo<uint32_t>(fIDToPaintKey.size())};
+    UniquePaintParamsID newID{fPaintKeyCount};
+    const PaintKeyEntry* entry =
+            fArena.make<PaintKeyEntry>(PaintKeyEntry{keyView->clone(&fArena), hash, newID});
+
+    // The entry goes in the ID array before the table, so whoever finds it can look it up by ID.
+    const uint32_t v = fPaintKeyCount / kFirstIDSegmentSize + 1;
+    if (SkIsPow2(v) && fPaintKeyCount % kFirstIDSegmentSize == 0) {
+        const int segment = 31 - SkCLZ(v);
+        SkASSERT_RELEASE(segment < kIDSegmentCount);
+        fIDSegments[segment] =
+                fArena.makeArrayDefault<const PaintKeyEntry*>(kFirstIDSegmentSize << segment);
+    }
+    *this->idSlot(fPaintKeyCount) = entry;
+    fPaintKeyCount++;
+
+    if (4 * (table->fCount + 1) > 3 * table->fCapacity) {
+        auto bigger = std::make_unique<PaintKeyTable>(2 * table->fCapacity);
+        for (int i = 0; i < table->fCapacity; ++i) {
+            if (const PaintKeyEntry* e = table->fSlots[i].load(std::memory_order_relaxed)) {
+                bigger->insert(e);
+            }
+        }
+        fPaintKeyTables.push_back(std::move(bigger));
+    }
+    fPaintKeyTables.back()->insert(entry);
+    fPaintKeyTable.store(fPaintKeyTables.back().get(), std::memory_order_release);
 
-    fPaintKeyToID.set(key, newID);
-    fIDToPaintKey.push_back(key);
     return newID;
 }
 
@@ -465,9 +539,9 @@ PaintParamsKey ShaderCodeDictionary::lookup(UniquePaintParamsID codeID) const {
         return PaintParamsKey::Invalid();
     }
 
-    SkAutoSpinlock lock{fSpinLock};
-    SkASSERT(codeID.asUInt() < SkTo<uint32_t>(fIDToPaintKey.size()));
-    return fIDToPaintKey[codeID.asUInt()];
+    const PaintKeyEntry* entry = *this->idSlot(codeID.asUInt());
+    SkASSERT(entry && entry->fID == codeID);
+    return entry->fKey;
 }
 
 SkSpan<const Uniform> ShaderCodeDictionary::getUniforms(BuiltInCodeSnippetID id) const {
@@ -1129,16 +1203,77 @@ std::string GenerateBlendShaderPreamble(const ShaderInfo& shaderInfo,
 //--------------------------------------------------------------------------------------------------
 static constexpr char kRuntimeShaderName[] = "RuntimeEffect";
 
+static SkSLType uniform_type_to_sksl_type(const SkRuntimeEffect::Uniform& u) {
+    using Type = SkRuntimeEffect::Uniform::Type;
+    if (u.flags & SkRuntimeEffect::Uniform::kHalfPrecision_Flag) {
+        switch (u.type) {
+            case Type::kFloat:    return SkSLType::kHalf;
+            case Type::kFloat2:   return SkSLType::kHalf2;
+            case Type::kFloat3:   return SkSLType::kHalf3;
+            case Type::kFloat4:   return SkSLType::kHalf4;
+            case Type::kFloat2x2: return SkSLType::kHalf2x2;
+            case Type::kFloat3x3: return SkSLType::kHalf3x3;
+            case Type::kFloat4x4: return SkSLType::kHalf4x4;
+            case Type::kInt:      return SkSLType::kShort;
+            case Type::kInt2:     return SkSLType::kShort2;
+            case Type::kInt3:     return SkSLType::kShort3;
+            case Type::kInt4:     return SkSLType::kShort4;
+        }
+    } else {
+        switch (u.type) {
+            case Type::kFloat:    return SkSLType::kFloat;
+            case Type::kFloat2:   return SkSLType::kFloat2;
+            case Type::kFloat3:   return SkSLType::kFloat3;
+            case Type::kFloat4:   return SkSLType::kFloat4;
+            case Type::kFloat2x2: return SkSLType::kFloat2x2;
+            case Type::kFloat3x3: return SkSLType::kFloat3x3;
+            case Type::kFloat4x4: return SkSLType::kFloat4x4;
+            case Type::kInt:      return SkSLType::kInt;
+            case Type::kInt2:     return SkSLType::kInt2;
+            case Type::kInt3:     return SkSLType::kInt3;
+            case Type::kInt4:     return SkSLType::kInt4;
+        }
+    }
+    SkUNREACHABLE;
+}
+
+// Returns a constructor for the uniform's value, like `float2(1.5,2)`.
+static std::string specialized_uniform_value(const SkRuntimeEffect::Uniform& u,
+                                             const uint8_t* uniformData) {
+    SkSLType type = uniform_type_to_sksl_type(u);
+    const float* floatData = reinterpret_cast<const float*>(uniformData + u.offset);
+    const int* intData = reinterpret_cast<const int*>(uniformData + u.offset);
+    bool isFloat = SkSLTypeIsFloatType(type);
+
+    std::string value = SkSLTypeString(type);
+    value.append("(");
+    size_t slots = u.sizeInBytes() / sizeof(float);
+    for (size_t i = 0; i < slots; ++i) {
+        value.append(isFloat ? skstd::to_string(floatData[i]) : std::to_string(intData[i]));
+        value.append(",");
+    }
+    value.back() = ')';
+    return value;
+}
+
 class GraphitePipelineCallbacks : public SkSL::PipelineStage::Callbacks {
 public:
     GraphitePipelineCallbacks(const ShaderInfo& shaderInfo,
                               const ShaderNode* node,
+                              const SkRuntimeEffect* effect,
                               std::string* preamble)
             : fShaderInfo(shaderInfo)
             , fNode(node)
+            , fEffect(effect)
             , fPreamble(preamble) {}
 
     std::string declareUniform(const SkSL::VarDeclaration* decl) override {
+        if (const uint8_t* specializedData = fNode->entry()->fSpecializedUniformData) {
+            const SkRuntimeEffect::Uniform* uniform = fEffect->findUniform(decl->var()->name());
+            if (uniform && uniform->isSpecialized()) {
+                return specialized_uniform_value(*uniform, specializedData);
+            }
+        }
         std::string result = get_mangled_name(std::string(decl->var()->name()), fNode->keyIndex());
         if (fShaderInfo.ssboIndex()) {
             result = EmitStorageBufferAccess("fs", fShaderInfo.ssboIndex(), result.c_str());
@@ -1203,6 +1338,7 @@ public:
 private:
     const ShaderInfo& fShaderInfo;
     const ShaderNode* fNode;
+    const SkRuntimeEffect* fEffect;
     std::string* fPreamble;
 };
 
@@ -1216,7 +1352,7 @@ std::string GenerateRuntimeShaderPreamble(const ShaderInfo& shaderInfo,
     const SkSL::Program& program = SkRuntimeEffectPriv::Program(*effect);
 
     std::string preamble;
-    GraphitePipelineCallbacks callbacks{shaderInfo, node, &preamble};
+    GraphitePipelineCallbacks callbacks{shaderInfo, node, effect, &preamble};
     SkSL::PipelineStage::ConvertProgram(program, "coords", "inColor", "destColor", &callbacks);
     return preamble;
 }
@@ -1385,40 +1521,6 @@ int ShaderCodeDictionary::addUserDefinedSnippet(const char* name) {
                                        kNoChildren);
 }
 
-static SkSLType uniform_type_to_sksl_type(const SkRuntimeEffect::Uniform& u) {
-    using Type = SkRuntimeEffect::Uniform::Type;
-    if (u.flags & SkRuntimeEffect::Uniform::kHalfPrecision_Flag) {
-        switch (u.type) {
-            case Type::kFloat:    return SkSLType::kHalf;
-            case Type::kFloat2:   return SkSLType::kHalf2;
-            case Type::kFloat3:   return SkSLType::kHalf3;
-            case Type::kFloat4:   return SkSLType::kHalf4;
-            case Type::kFloat2x2: return SkSLType::kHalf2x2;
-            case Type::kFloat3x3: return SkSLType::kHalf3x3;
-            case Type::kFloat4x4: return SkSLType::kHalf4x4;
-            case Type::kInt:      return SkSLType::kShort;
-            case Type::kInt2:     return SkSLType::kShort2;
-            case Type::kInt3:     return SkSLType::kShort3;
-            case Type::kInt4:     return SkSLType::kShort4;
-        }
-    } else {
-        switch (u.type) {
-            case Type::kFloat:    return SkSLType::kFloat;
-            case Type::kFloat2:   return SkSLType::kFloat2;
-            case Type::kFloat3:   return SkSLType::kFloat3;
-            case Type::kFloat4:   return SkSLType::kFloat4;
-            case Type::kFloat2x2: return SkSLType::kFloat2x2;
-            case Type::kFloat3x3: return SkSLType::kFloat3x3;
-            case Type::kFloat4x4: return SkSLType::kFloat4x4;
-            case Type::kInt:      return SkSLType::kInt;
-            case Type::kInt2:     return SkSLType::kInt2;
-            case Type::kInt3:     return SkSLType::kInt3;
-            case Type::kInt4:     return SkSLType::kInt4;
-        }
-    }
-    SkUNREACHABLE;
-}
-
 const char* ShaderCodeDictionary::addTextToArena(std::string_view text) {
     char* textInArena = fArena.makeArrayDefault<char>(text.size() + 1);
     memcpy(textInArena, text.data(), text.size());
@@ -1426,15 +1528,21 @@ const char* ShaderCodeDictionary::addTextToArena(std::string_view text) {
     return textInArena;
 }
 
-SkSpan<const Uniform> ShaderCodeDictionary::convertUniforms(const SkRuntimeEffect* effect) {
+SkSpan<const Uniform> ShaderCodeDictionary::convertUniforms(const SkRuntimeEffect* effect,
+                                                            bool skipSpecialized) {
     using rteUniform = SkRuntimeEffect::Uniform;
-    SkSpan<const rteUniform> uniforms = effect->uniforms();
+    skia_private::STArray<8, const rteUniform*> uniforms;
+    for (const rteUniform& u : effect->uniforms()) {
+        if (!skipSpecialized || !u.isSpecialized()) {
+            uniforms.push_back(&u);
+        }
+    }
 
     // Convert the SkRuntimeEffect::Uniform array into its Uniform equivalent.
     int numUniforms = uniforms.size();
     Uniform* uniformArray = fArena.makeInitializedArray<Uniform>(numUniforms, [&](int index) {
         const rteUniform* u;
-        u = &uniforms[index];
+        u = uniforms[index];
 
         // The existing uniform names live in the passed-in SkRuntimeEffect and may eventually
         // disappear. Copy them into fArena. (It's safe to do this within makeInitializedArray; the
@@ -1450,7 +1558,8 @@ SkSpan<const Uniform> ShaderCodeDictionary::convertUniforms(const SkRuntimeEffec
     return SkSpan<const Uniform>(uniformArray, numUniforms);
 }
 
-int ShaderCodeDictionary::findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect* effect) {
+int ShaderCodeDictionary::findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect* effect,
+                                                           const SkData* uniforms) {
     // Use the combination of {SkSL program hash, uniform size} as our key.
     // In the unfortunate event of a hash collision, at least we'll have the right amount of
     // uniform data available.
@@ -1458,13 +1567,44 @@ int ShaderCodeDictionary::findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect
     key.fHash = SkRuntimeEffectPriv::Hash(*effect);
     key.fUniformSize = effect->uniformSize();
 
+    // Specialized snippets are also keyed on the values of the uniforms compiled into them.
+    std::string specializedKey;
+    if (uniforms && uniforms->size() == effect->uniformSize()) {
+        for (const SkRuntimeEffect::Uniform& u : effect->uniforms()) {
+            if (u.isSpecialized()) {
+                if (specializedKey.empty()) {
+                    specializedKey.append(reinterpret_cast<const char*>(&key), sizeof(key));
+                }
+                specializedKey.append(uniforms->bytes() + u.offset,
+                                      uniforms->bytes() + u.offset + u.sizeInBytes());
+            }
+        }
+    }
+
     SkAutoSpinlock lock{fSpinLock};
 
+    if (!specializedKey.empty()) {
+        int32_t* existingCodeSnippetID = fSpecializedRuntimeEffectMap.find(specializedKey);
+        if (existingCodeSnippetID) {
+            return *existingCodeSnippetID;
+        }
+        int newCodeSnippetID = this->addRuntimeEffectSnippet(effect, uniforms);
+        fSpecializedRuntimeEffectMap.set(std::move(specializedKey), newCodeSnippetID);
+        return newCodeSnippetID;
+    }
+
     int32_t* existingCodeSnippetID = fRuntimeEffectMap.find(key);
     if (existingCodeSnippetID) {
         return *existingCodeSnippetID;
     }
 
+    int newCodeSnippetID = this->addRuntimeEffectSnippet(effect, /*specializedUniforms=*/nullptr);
+    fRuntimeEffectMap.set(key, newCodeSnippetID);
+    return newCodeSnippetID;
+}
+
+int ShaderCodeDictionary::addRuntimeEffectSnippet(const SkRuntimeEffect* effect,
+                                                  const SkData* specializedUniforms) {
     SkEnumBitMask<SnippetRequirementFlags> snippetFlags = SnippetRequirementFlags::kNone;
     if (effect->allowShader()) {
         snippetFlags |= SnippetRequirementFlags::kLocalCoords;
@@ -1472,21 +1612,36 @@ int ShaderCodeDictionary::findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect
     if (effect->allowBlender()) {
         snippetFlags |= SnippetRequirementFlags::kBlenderDstColor;
     }
-    int newCodeSnippetID = this->addUserDefinedSnippet("RuntimeEffect",
-                                                       this->convertUniforms(effect),
-                                                       snippetFlags,
-                                                       /*texturesAndSamplers=*/{},
-                                                       kRuntimeShaderName,
-                                                       GenerateRuntimeShaderExpression,
-                                                       GenerateRuntimeShaderPreamble,
-                                                       (int)effect->children().size());
-    fRuntimeEffectMap.set(key, newCodeSnippetID);
+    int newCodeSnippetID = this->addUserDefinedSnippet(
+            "RuntimeEffect",
+            this->convertUniforms(effect, /*skipSpecialized=*/specializedUniforms != nullptr),
+            snippetFlags,
+            /*texturesAndSamplers=*/{},
+            kRuntimeShaderName,
+            GenerateRuntimeShaderExpression,
+            GenerateRuntimeShaderPreamble,
+            (int)effect->children().size());
+    if (specializedUniforms) {
+        uint8_t* data = fArena.makeArrayDefault<uint8_t>(specializedUniforms->size());
+        memcpy(data, specializedUniforms->data(), specializedUniforms->size());
+        fUserDefinedCodeSnippets.back()->fSpecializedUniformData = data;
+    }
     return newCodeSnippetID;
 }
 
 ShaderCodeDictionary::ShaderCodeDictionary() {
-    // The 0th index is reserved as invalid
-    fIDToPaintKey.push_back(PaintParamsKey::Invalid());
+    {
+        SkAutoSpinlock lock{fSpinLock};
+
+        fPaintKeyTables.push_back(std::make_unique<PaintKeyTable>(256));
+        fPaintKeyTable.store(fPaintKeyTables.back().get(), std::memory_order_relaxed);
+
+        // The 0th index is reserved as invalid
+        fIDSegments[0] = fArena.makeArrayDefault<const PaintKeyEntry*>(kFirstIDSegmentSize);
+        *this->idSlot(0) = fArena.make<PaintKeyEntry>(
+                PaintKeyEntry{PaintParamsKey::Invalid(), 0, UniquePaintParamsID::InvalidID()});
+        fPaintKeyCount = 1;
+    }
 
     fBuiltInCodeSnippets[(int) BuiltInCodeSnippetID::kError] = {
             "Error",
@@ -26,12 +26,14 @@
 #include "src/gpu/graphite/UniquePaintParamsID.h"
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
 
+class SkData;
 class SkRuntimeEffect;
 
 namespace skgpu {
@@ -119,6 +121,9 @@ struct ShaderSnippet {
     GenerateExpressionForSnippetFn fExpressionGenerator = nullptr;
     GeneratePreambleForSnippetFn fPreambleGenerator = nullptr;
     int fNumChildren = 0;
+    // For runtime effects with layout(specialize) uniforms, the effect's uniform data that the
+    // snippet was specialized to. The specialized uniforms are left out of fUniforms.
+    const uint8_t* fSpecializedUniformData = nullptr;
 };
 
 // ShaderNodes organize snippets into an effect tree, and provide random access to the dynamically
@@ -242,7 +247,10 @@ public:
         return this->getEntry(SkTo<int>(codeSnippetID));
     }
 
-    int findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect* effect);
+    // If the effect has layout(specialize) uniforms and `uniforms` is provided, the snippet has
+    // their values compiled in, and a separate snippet is created for each distinct set of values.
+    int findOrCreateRuntimeEffectSnippet(const SkRuntimeEffect* effect,
+                                         const SkData* uniforms = nullptr);
 
     // TODO: Remove or make testing-only
     int addUserDefinedSnippet(const char* name);
@@ -263,7 +271,11 @@ private:
 
     const char* addTextToArena(std::string_view text);
 
-    SkSpan<const Uniform> convertUniforms(const SkRuntimeEffect* effect);
+    // Leaves out the layout(specialize) uniforms if `skipSpecialized` is set.
+    SkSpan<const Uniform> convertUniforms(const SkRuntimeEffect* effect, bool skipSpecialized);
+
+    int addRuntimeEffectSnippet(const SkRuntimeEffect* effect, const SkData* specializedUniforms)
+            SK_REQUIRES(fSpinLock);
 
     std::array<ShaderSnippet, kBuiltInCodeSnippetIDCount> fBuiltInCodeSnippets;
 
@@ -271,15 +283,49 @@ private:
     // entries as pointers.
     skia_private::TArray<std::unique_ptr<ShaderSnippet>> fUserDefinedCodeSnippets;
 
-    // TODO: can we do something better given this should have write-seldom/read-often behavior?
+    // Guards adding PaintParamsKeys and everything to do with runtime effects. Looking up a
+    // PaintParamsKey that's already been added, from either direction, doesn't take the lock.
     mutable SkSpinlock fSpinLock;
 
-    using PaintIDMap = skia_private::THashMap<PaintParamsKey,
-                                              UniquePaintParamsID,
-                                              PaintParamsKey::Hash>;
+    // PaintParamsKeys are looked up from every Recorder's thread far more often than they're
+    // added, and they're never removed. So each key gets an entry in fArena that never moves,
+    // which is published in two append-only structures: a hash table from keys to entries, and a
+    // segmented array from IDs to entries.
+    struct PaintKeyEntry {
+        PaintParamsKey      fKey;
+        uint32_t            fHash;
+        UniquePaintParamsID fID;
+    };
+
+    // An open-addressed hash table of entries, with linear probing. A slot only ever goes from
+    // null to an entry, so a reader that reaches a null slot knows the key wasn't in the table.
+    // When the table gets 3/4 full, it's replaced by one twice the size, but kept around (in
+    // fPaintKeyTables) since readers may still be probing it. Old tables add up to less than the
+    // current one.
+    struct PaintKeyTable {
+        explicit PaintKeyTable(int capacity);
+
+        const PaintKeyEntry* find(const PaintParamsKey&, uint32_t hash) const;
+        // Must be called with fSpinLock held.
+        void insert(const PaintKeyEntry*);
+
+        const int fCapacity;  // A power of two
+        int fCount = 0;       // Only read or written with fSpinLock held
+        std::unique_ptr<std::atomic<const PaintKeyEntry*>[]> fSlots;
+    };
 
-    PaintIDMap fPaintKeyToID SK_GUARDED_BY(fSpinLock);
-    skia_private::TArray<PaintParamsKey> fIDToPaintKey SK_GUARDED_BY(fSpinLock);
+    std::atomic<const PaintKeyTable*> fPaintKeyTable;
+    skia_private::TArray<std::unique_ptr<PaintKeyTable>> fPaintKeyTables SK_GUARDED_BY(fSpinLock);
+
+    // Entries by ID. Segment i holds kFirstIDSegmentSize << i entries, and is never reallocated,
+    // so readers can index it without the lock. A reader can only have an ID once its entry is
+    // written, so the entries themselves don't need to be atomic.
+    static constexpr uint32_t kFirstIDSegmentSize = 256;
+    static constexpr int kIDSegmentCount = 24;
+    std::array<const PaintKeyEntry**, kIDSegmentCount> fIDSegments = {};
+    uint32_t fPaintKeyCount SK_GUARDED_BY(fSpinLock) = 0;
+
+    const PaintKeyEntry** idSlot(uint32_t id) const;
 
     SK_BEGIN_REQUIRE_DENSE
     struct RuntimeEffectKey {
@@ -301,8 +347,13 @@ private:
     using RuntimeEffectMap = skia_private::THashMap<RuntimeEffectKey, int32_t>;
     RuntimeEffectMap fRuntimeEffectMap SK_GUARDED_BY(fSpinLock);
 
+    // The same, for snippets specialized to the values of an effect's layout(specialize) uniforms.
+    // These are keyed by the RuntimeEffectKey followed by the values of those uniforms.
+    using SpecializedRuntimeEffectMap = skia_private::THashMap<std::string, int32_t>;
+    SpecializedRuntimeEffectMap fSpecializedRuntimeEffectMap SK_GUARDED_BY(fSpinLock);
+
     // This arena holds:
-    //   - the backing data for PaintParamsKeys in `fPaintKeyToID` and `fIDToPaintKey`
+    //   - the PaintKeyEntries, and the backing data for their PaintParamsKeys
     //   - Uniform data created by `findOrCreateRuntimeEffectSnippet`
     // and in all cases is guarded by `fSpinLock`
     SkArenaAlloc fArena{256};
@@ -28,6 +28,7 @@
 #include "include/gpu/graphite/Recorder.h"
 #include "include/gpu/graphite/Recording.h"
 #include "include/gpu/graphite/Surface.h"
+#include "include/private/base/SkTArray.h"
 #include "src/gpu/BlurUtils.h"
 #include "src/gpu/SkBackingFit.h"
 #include "src/gpu/graphite/Buffer.h"
@@ -297,6 +298,67 @@ sk_sp<SkSpecialImage> blur_impl(skgpu::graphite::Recorder* recorder,
     }
 }
 
+sk_sp<SkSpecialImage> dual_filter_blur(skgpu::graphite::Recorder* recorder,
+                                       SkSize sigma,
+                                       const skgpu::DualFilterBlurParams& params,
+                                       sk_sp<SkSpecialImage> input,
+                                       const SkIRect& srcRect,
+                                       const SkIRect& dstRect,
+                                       sk_sp<SkColorSpace> outCS,
+                                       const SkSurfaceProps& outProps) {
+    SkASSERT(params.fPasses > 0);
+    // Only the source pixels within the approximate support of the blur around 'dstRect' can
+    // affect the output. All levels are defined relative to the top-left of this working area.
+    const int radius = skgpu::BlurSigmaRadius(std::max(sigma.width(), sigma.height()));
+    SkIRect workingRect = dstRect.makeOutset(radius, radius);
+    if (!workingRect.intersect(srcRect.makeOutset(radius, radius))) {
+        return nullptr;
+    }
+
+    const SkColorType colorType = input->colorType();
+    const SkV2 offset = params.fOffset;
+    sk_sp<SkShader> level =
+            input->makeSubset(srcRect)->asShader(
+                    SkTileMode::kDecal,
+                    SkFilterMode::kLinear,
+                    SkMatrix::Translate(srcRect.left() - workingRect.left(),
+                                        srcRect.top() - workingRect.top()));
+
+    skia_private::STArray<skgpu::kMaxDualFilterPasses, SkISize> levelSizes;
+    SkISize levelSize = workingRect.size();
+    for (int i = 0; i < params.fPasses; ++i) {
+        levelSizes.push_back(levelSize);
+        levelSize = {(levelSize.width() + 1) / 2, (levelSize.height() + 1) / 2};
+
+        SkRuntimeShaderBuilder builder{sk_ref_sp(skgpu::GetDualFilterDownEffect())};
+        builder.uniform("offset") = offset;
+        builder.child("child") = std::move(level);
+        auto down = eval_blur(recorder, builder.makeShader(), SkIRect::MakeSize(levelSize),
+                              colorType, outCS, outProps);
+        if (!down) {
+            return nullptr;
+        }
+        level = down->asShader(SkTileMode::kDecal, SkFilterMode::kLinear, SkMatrix::I());
+    }
+
+    for (int i = params.fPasses - 1; i >= 0; --i) {
+        // The last upsample only needs to produce 'dstRect'.
+        const SkIRect upRect = i > 0 ? SkIRect::MakeSize(levelSizes[i])
+                                     : dstRect.makeOffset(-workingRect.left(), -workingRect.top());
+
+        SkRuntimeShaderBuilder builder{sk_ref_sp(skgpu::GetDualFilterUpEffect())};
+        builder.uniform("offset") = offset;
+        builder.child("child") = std::move(level);
+        auto up = eval_blur(recorder, builder.makeShader(), upRect, colorType, outCS, outProps);
+        if (!up || i == 0) {
+            return up;
+        }
+        level = up->asShader(SkTileMode::kDecal, SkFilterMode::kLinear, SkMatrix::I());
+    }
+
+    SkUNREACHABLE;
+}
+
 } // anonymous namespace
 
 namespace skgpu::graphite {
@@ -784,6 +846,14 @@ public:
     // SkBlurEngine
     const SkBlurEngine::Algorithm* findAlgorithm(SkSize sigma,
                                                  SkColorType colorType) const override {
+        // Surfaces that opt into approximate blurs trade Gaussian fidelity for a sigma-independent
+        // cost on large blurs.
+        if (this->surfaceProps().isApproximateBlurs()) {
+            skgpu::DualFilterBlurParams params;
+            if (skgpu::ComputeDualFilterBlurParams(sigma, &params)) {
+                return &fDualFilter;
+            }
+        }
         // The runtime effect blurs handle all tilemodes and color types
         return this;
     }
@@ -811,7 +881,40 @@ public:
     }
 
 private:
+    class DualFilterAlgorithm final : public SkBlurEngine::Algorithm {
+    public:
+        explicit DualFilterAlgorithm(const GraphiteBackend* backend) : fBackend(backend) {}
+
+        // The pass count grows with sigma, so no external rescaling is required.
+        float maxSigma() const override { return SK_ScalarInfinity; }
+
+        bool supportsOnlyDecalTiling() const override { return true; }
+
+        sk_sp<SkSpecialImage> blur(SkSize sigma,
+                                   sk_sp<SkSpecialImage> src,
+                                   const SkIRect& srcRect,
+                                   SkTileMode tileMode,
+                                   const SkIRect& dstRect) const override {
+            SkASSERT(tileMode == SkTileMode::kDecal);
+            skgpu::DualFilterBlurParams params;
+            if (!skgpu::ComputeDualFilterBlurParams(sigma, &params)) {
+                return fBackend->blur(sigma, std::move(src), srcRect, tileMode, dstRect);
+            }
+
+            TRACE_EVENT_INSTANT2("skia.gpu", "DualFilterBlur", TRACE_EVENT_SCOPE_THREAD,
+                                 "sigmaX", sigma.width(), "sigmaY", sigma.height());
+
+            SkColorSpace* cs = src->getColorSpace();
+            return dual_filter_blur(fBackend->fRecorder, sigma, params, std::move(src), srcRect, dstRect,
+                                    sk_ref_sp(cs), fBackend->surfaceProps());
+        }
+
+    private:
+        const GraphiteBackend* fBackend;
+    };
+
     skgpu::graphite::Recorder* fRecorder;
+    DualFilterAlgorithm fDualFilter{this};
 };
 
 } // anonymous namespace
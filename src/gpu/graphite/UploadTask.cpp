@@ -10,7 +10,9 @@
 #include "include/core/SkColorSpace.h"
 #include "include/gpu/graphite/Recorder.h"
 #include "include/private/base/SkAlign.h"
+#include "src/core/SkCountersPriv.h"
 #include "src/core/SkMipmap.h"
+#include "src/core/SkTHash.h"
 #include "src/core/SkTraceEvent.h"
 #include "src/gpu/graphite/Buffer.h"
 #include "src/gpu/graphite/Caps.h"
@@ -22,6 +24,8 @@
 #include "src/gpu/graphite/TextureProxy.h"
 #include "src/gpu/graphite/UploadBufferManager.h"
 
+#include <type_traits>
+
 using namespace skia_private;
 
 namespace skgpu::graphite {
@@ -89,6 +93,7 @@ UploadInstance UploadInstance::Make(Recorder* recorder,
                                     const std::vector<MipLevel>& levels,
                                     const SkIRect& dstRect,
                                     std::unique_ptr<ConditionalUploadContext> condContext) {
+    TRACE_EVENT0("skia.gpu", TRACE_FUNC);
     const Caps* caps = recorder->priv().caps();
     SkASSERT(caps->isTexturable(textureProxy->textureInfo()));
     SkASSERT(caps->areColorTypeAndTextureInfoCompatible(dstColorInfo.colorType(),
@@ -139,6 +144,7 @@ UploadInstance UploadInstance::Make(Recorder* recorder,
     if (!bufferInfo.fBuffer) {
         return {};
     }
+    SkCounters::Add(SkCounters::Counter::kBytesUploaded, combinedBufferSize);
     size_t baseOffset = bufferInfo.fOffset;
 
     int32_t currentWidth = dstRect.width();
@@ -292,8 +298,66 @@ bool UploadTask::prepareResources(ResourceProvider* resourceProvider,
 bool UploadTask::addCommands(Context* context,
                              CommandBuffer* commandBuffer,
                              ReplayTargetData replayData) {
-    for (unsigned int i = 0; i < fInstances.size(); ++i) {
-        fInstances[i].addCommand(context, commandBuffer, replayData);
+    // Uploads are sub-allocated from a few shared buffers, so many instances end up copying from
+    // the same buffer into the same texture (e.g. thousands of small atlas or image updates). Each
+    // such group is recorded as one copy with a region per instance instead of one copy each.
+    // Copies into different textures don't depend on each other, and the copies into any one
+    // texture keep their relative order, so grouping by destination is safe.
+    struct BatchKey {
+        const Buffer* fBuffer;
+        const Texture* fTexture;
+
+        bool operator==(const BatchKey& that) const {
+            return fBuffer == that.fBuffer && fTexture == that.fTexture;
+        }
+    };
+    static_assert(std::has_unique_object_representations<BatchKey>::value);
+    struct Batch {
+        const Buffer* fBuffer;
+        sk_sp<Texture> fTexture;
+        TArray<BufferTextureCopyData> fCopyData;
+        TArray<ConditionalUploadContext*> fConditionalContexts;
+    };
+    THashMap<BatchKey, int> batchIndices;
+    TArray<Batch> batches;
+
+    for (const UploadInstance& instance : fInstances) {
+        SkASSERT(instance.fTextureProxy && instance.fTextureProxy->isInstantiated());
+        const Texture* texture = instance.fTextureProxy->texture();
+        if (texture == replayData.fTarget) {
+            // Copies into the replay target are translated and cropped one at a time.
+            instance.addCommand(context, commandBuffer, replayData);
+            continue;
+        }
+        if (instance.fConditionalContext &&
+            !instance.fConditionalContext->needsUpload(context)) {
+            continue;
+        }
+
+        BatchKey key{instance.fBuffer, texture};
+        int* batchIndex = batchIndices.find(key);
+        if (!batchIndex) {
+            batchIndex = batchIndices.set(key, batches.size());
+            batches.push_back({instance.fBuffer, instance.fTextureProxy->refTexture(), {}, {}});
+        }
+        Batch& batch = batches[*batchIndex];
+        batch.fCopyData.push_back_n(SkToInt(instance.fCopyData.size()),
+                                    instance.fCopyData.data());
+        if (instance.fConditionalContext) {
+            batch.fConditionalContexts.push_back(instance.fConditionalContext.get());
+        }
+    }
+
+    for (Batch& batch : batches) {
+        // The CommandBuffer doesn't take ownership of the upload buffer here; it's owned by
+        // UploadBufferManager, which will transfer ownership in transferToCommandBuffer.
+        commandBuffer->copyBufferToTexture(batch.fBuffer,
+                                           std::move(batch.fTexture),
+                                           batch.fCopyData.data(),
+                                           batch.fCopyData.size());
+        for (ConditionalUploadContext* conditionalContext : batch.fConditionalContexts) {
+            conditionalContext->uploadSubmitted();
+        }
     }
 
     return true;
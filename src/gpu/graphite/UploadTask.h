@@ -89,6 +89,8 @@ public:
     void addCommand(Context*, CommandBuffer*, Task::ReplayTargetData) const;
 
 private:
+    friend class UploadTask;  // to batch copies that share a buffer and texture
+
     UploadInstance();
     UploadInstance(const Buffer*,
                    size_t bytesPerPixel,
@@ -11,6 +11,7 @@
 #include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ComputePipelineDesc.h"
 #include "src/gpu/graphite/ContextUtils.h"
+#include "src/gpu/graphite/PersistentCacheUtils.h"
 #include "src/gpu/graphite/dawn/DawnAsyncWait.h"
 #include "src/gpu/graphite/dawn/DawnErrorChecker.h"
 #include "src/gpu/graphite/dawn/DawnGraphiteUtilsPriv.h"
@@ -54,13 +55,16 @@ static ShaderInfo compile_shader_module(const DawnSharedContext* sharedContext,
 
         SkSL::Compiler compiler(caps->shaderCaps());
         std::string sksl = BuildComputeSkSL(caps, step);
-        if (SkSLToWGSL(&compiler,
-                       sksl,
-                       SkSL::ProgramKind::kCompute,
-                       settings,
-                       &wgsl,
-                       &interface,
-                       errorHandler)) {
+        if (PersistentCacheUtils::SkSLToBackendCached(caps,
+                                                      PersistentCacheUtils::kWGSLTag,
+                                                      SkSLToWGSL,
+                                                      &compiler,
+                                                      sksl,
+                                                      SkSL::ProgramKind::kCompute,
+                                                      settings,
+                                                      &wgsl,
+                                                      &interface,
+                                                      errorHandler)) {
             if (!DawnCompileWGSLShaderModule(sharedContext, wgsl, &info.fModule, errorHandler)) {
                 return {};
             }
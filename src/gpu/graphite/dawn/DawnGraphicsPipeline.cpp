@@ -14,6 +14,7 @@
 #include "src/gpu/graphite/ContextUtils.h"
 #include "src/gpu/graphite/GraphicsPipelineDesc.h"
 #include "src/gpu/graphite/Log.h"
+#include "src/gpu/graphite/PersistentCacheUtils.h"
 #include "src/gpu/graphite/RendererProvider.h"
 #include "src/gpu/graphite/UniformManager.h"
 #include "src/gpu/graphite/dawn/DawnCaps.h"
@@ -258,6 +259,9 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
     SkSL::ProgramSettings settings;
 
     settings.fForceNoRTFlip = true;
+    // Generated shaders repeat a lot of work across the snippets they're built from.
+    settings.fEliminateCommonSubexpressions = true;
+    settings.fHoistLoopInvariants = true;
 
     ShaderErrorHandler* errorHandler = caps.shaderErrorHandler();
 
@@ -283,13 +287,16 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
 
     bool hasFragmentSkSL = !fsSkSL.empty();
     if (hasFragmentSkSL) {
-        if (!SkSLToWGSL(compiler,
-                        fsSkSL,
-                        SkSL::ProgramKind::kGraphiteFragment,
-                        settings,
-                        &fsCode,
-                        &fsInterface,
-                        errorHandler)) {
+        if (!PersistentCacheUtils::SkSLToBackendCached(&caps,
+                                                       PersistentCacheUtils::kWGSLTag,
+                                                       SkSLToWGSL,
+                                                       compiler,
+                                                       fsSkSL,
+                                                       SkSL::ProgramKind::kGraphiteFragment,
+                                                       settings,
+                                                       &fsCode,
+                                                       &fsInterface,
+                                                       errorHandler)) {
             return {};
         }
         if (!DawnCompileWGSLShaderModule(sharedContext, fsCode, &fsModule, errorHandler)) {
@@ -302,13 +309,16 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
                                               useStorageBuffers,
                                               localCoordsNeeded);
     const std::string& vsSkSL = vsSkSLInfo.fSkSL;
-    if (!SkSLToWGSL(compiler,
-                    vsSkSL,
-                    SkSL::ProgramKind::kGraphiteVertex,
-                    settings,
-                    &vsCode,
-                    &vsInterface,
-                    errorHandler)) {
+    if (!PersistentCacheUtils::SkSLToBackendCached(&caps,
+                                                   PersistentCacheUtils::kWGSLTag,
+                                                   SkSLToWGSL,
+                                                   compiler,
+                                                   vsSkSL,
+                                                   SkSL::ProgramKind::kGraphiteVertex,
+                                                   settings,
+                                                   &vsCode,
+                                                   &vsInterface,
+                                                   errorHandler)) {
         return {};
     }
     if (!DawnCompileWGSLShaderModule(sharedContext, vsCode, &vsModule, errorHandler)) {
@@ -521,16 +531,19 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
     descriptor.multisample.mask = 0xFFFFFFFF;
     descriptor.multisample.alphaToCoverageEnabled = false;
 
-    auto asyncCreation = std::make_unique<AsyncPipelineCreation>(sharedContext);
+    auto asyncCreation = sk_make_sp<AsyncPipelineCreation>(sharedContext);
 
     if (caps.useAsyncPipelineCreation()) {
+        // The callback holds its own ref, so if the pipeline is released while creation is still
+        // pending, whoever drops the last ref doesn't have to wait for the device.
         device.CreateRenderPipelineAsync(
                 &descriptor,
                 [](WGPUCreatePipelineAsyncStatus status,
                    WGPURenderPipeline pipeline,
                    char const* message,
                    void* userdata) {
-                    AsyncPipelineCreation* arg = static_cast<AsyncPipelineCreation*>(userdata);
+                    sk_sp<AsyncPipelineCreation> arg(
+                            static_cast<AsyncPipelineCreation*>(userdata));
 
                     if (status != WGPUCreatePipelineAsyncStatus_Success) {
                         SKGPU_LOG_E("Failed to create render pipeline (%d): %s", status, message);
@@ -539,7 +552,7 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
                         arg->set(wgpu::RenderPipeline::Acquire(pipeline));
                     }
                 },
-                asyncCreation.get());
+                SkRef(asyncCreation.get()));
     } else {
         asyncCreation->set(device.CreateRenderPipeline(&descriptor));
     }
@@ -569,7 +582,7 @@ sk_sp<DawnGraphicsPipeline> DawnGraphicsPipeline::Make(const DawnSharedContext*
 
 DawnGraphicsPipeline::DawnGraphicsPipeline(const skgpu::graphite::SharedContext* sharedContext,
                                            PipelineInfo* pipelineInfo,
-                                           std::unique_ptr<AsyncPipelineCreation> asyncCreationInfo,
+                                           sk_sp<AsyncPipelineCreation> asyncCreationInfo,
                                            BindGroupLayouts groupLayouts,
                                            PrimitiveType primitiveType,
                                            uint32_t refValue,
@@ -590,6 +603,8 @@ void DawnGraphicsPipeline::freeGpuData() {
 }
 
 const wgpu::RenderPipeline& DawnGraphicsPipeline::dawnRenderPipeline() const {
+    // This is only called while encoding a command buffer, when the Recording is inserted, so a
+    // pipeline that isn't ready yet never stalls the Recorder.
     if (auto pipeline = fAsyncPipelineCreation->getIfReady()) {
         return *pipeline;
     }
@@ -72,11 +72,17 @@ public:
     const BindGroupLayouts& dawnGroupLayouts() const { return fGroupLayouts; }
 
 private:
-    using AsyncPipelineCreation = DawnAsyncResult<wgpu::RenderPipeline>;
+    // Shared with Dawn's creation callback while creation is pending, so that releasing a
+    // pipeline before it's ready never has to wait for it.
+    class AsyncPipelineCreation : public SkRefCnt,
+                                  public DawnAsyncResult<wgpu::RenderPipeline> {
+    public:
+        using DawnAsyncResult::DawnAsyncResult;
+    };
 
     DawnGraphicsPipeline(const skgpu::graphite::SharedContext* sharedContext,
                          PipelineInfo* pipelineInfo,
-                         std::unique_ptr<AsyncPipelineCreation> pipelineCreationInfo,
+                         sk_sp<AsyncPipelineCreation> pipelineCreationInfo,
                          BindGroupLayouts groupLayouts,
                          PrimitiveType primitiveType,
                          uint32_t refValue,
@@ -86,7 +92,7 @@ private:
 
     void freeGpuData() override;
 
-    std::unique_ptr<AsyncPipelineCreation> fAsyncPipelineCreation;
+    sk_sp<AsyncPipelineCreation> fAsyncPipelineCreation;
     BindGroupLayouts fGroupLayouts;
     const PrimitiveType fPrimitiveType;
     const uint32_t fStencilReferenceValue;
@@ -9,6 +9,7 @@
 #define skgpu_graphite_geom_BoundsManager_DEFINED
 
 #include "include/core/SkSize.h"
+#include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTemplates.h"
 
 #include "src/base/SkTBlockList.h"
@@ -235,6 +236,165 @@ private:
     skia_private::AutoTMalloc<CompressedPaintersOrder> fNodes;
 };
 
+// A BoundsManager that tracks highest CompressedPaintersOrder over a two-level grid. The coarse
+// level covers the device with tiles of kTileDim x kTileDim cells, and a tile only allocates its
+// fine cells once a draw covers part of it. Draws that cover a whole tile just update the tile, so
+// large draws touch a few hundred values instead of every fine cell under them, while small draws
+// (e.g. glyphs of text-heavy content) get the accuracy of a fine grid where they land.
+//
+// Results are conservative at the fine cell resolution, and match a GridBoundsManager with the
+// same cell size.
+class TwoLevelGridBoundsManager : public BoundsManager {
+public:
+    static constexpr int kTileDim = 16;
+
+    // 'cellSize' is the size in pixels of the fine cells.
+    static std::unique_ptr<TwoLevelGridBoundsManager> Make(const SkISize& deviceSize,
+                                                           int cellSize) {
+        SkASSERT(deviceSize.width() > 0 && deviceSize.height() > 0);
+        SkASSERT(cellSize >= 1);
+
+        const int tileSize = kTileDim * cellSize;
+        SkISize tileGridSize = {(deviceSize.width()  + tileSize - 1) / tileSize,
+                                (deviceSize.height() + tileSize - 1) / tileSize};
+        return std::unique_ptr<TwoLevelGridBoundsManager>(
+                new TwoLevelGridBoundsManager(cellSize, tileGridSize));
+    }
+
+    ~TwoLevelGridBoundsManager() override {}
+
+    CompressedPaintersOrder getMostRecentDraw(const Rect& bounds) const override {
+        SkASSERT(!bounds.isEmptyNegativeOrNaN());
+
+        const skvx::int4 cells = this->getCellCoords(bounds);
+        const skvx::int4 tiles = cells >> kTileShift;
+
+        CompressedPaintersOrder max = CompressedPaintersOrder::First();
+        for (int ty = tiles[1]; ty <= tiles[3]; ++ty) {
+            for (int tx = tiles[0]; tx <= tiles[2]; ++tx) {
+                const Tile& tile = fTiles[ty * fTileGridWidth + tx];
+                if (tile.fMax <= max) {
+                    continue; // Nothing in this tile can raise the result.
+                }
+                const skvx::int4 local = LocalCoords(cells, tx, ty);
+                if (tile.fFineCells < 0 || CoversTile(local)) {
+                    // Either every draw recorded here covered all of the tile, or every draw
+                    // recorded here is under the query.
+                    max = tile.fMax;
+                    continue;
+                }
+                const CompressedPaintersOrder* row =
+                        fFineCells.data() + tile.fFineCells + local[1] * kTileDim;
+                CompressedPaintersOrder tileMax = tile.fCover;
+                for (int y = local[1]; y <= local[3]; ++y, row += kTileDim) {
+                    for (int x = local[0]; x <= local[2]; ++x) {
+                        if (row[x] > tileMax) {
+                            tileMax = row[x];
+                        }
+                    }
+                }
+                if (tileMax > max) {
+                    max = tileMax;
+                }
+            }
+        }
+        return max;
+    }
+
+    void recordDraw(const Rect& bounds, CompressedPaintersOrder order) override {
+        SkASSERT(!bounds.isEmptyNegativeOrNaN());
+
+        const skvx::int4 cells = this->getCellCoords(bounds);
+        const skvx::int4 tiles = cells >> kTileShift;
+
+        for (int ty = tiles[1]; ty <= tiles[3]; ++ty) {
+            for (int tx = tiles[0]; tx <= tiles[2]; ++tx) {
+                Tile& tile = fTiles[ty * fTileGridWidth + tx];
+                if (order > tile.fMax) {
+                    tile.fMax = order;
+                }
+                const skvx::int4 local = LocalCoords(cells, tx, ty);
+                if (CoversTile(local)) {
+                    if (order > tile.fCover) {
+                        tile.fCover = order;
+                    }
+                    continue;
+                }
+                if (tile.fFineCells < 0) {
+                    // The tile's fCover still applies to the new cells, since queries take the
+                    // max of it with whatever they find in them.
+                    tile.fFineCells = fFineCells.size();
+                    fFineCells.push_back_n(kTileDim * kTileDim, CompressedPaintersOrder::First());
+                }
+
+                CompressedPaintersOrder* row =
+                        fFineCells.data() + tile.fFineCells + local[1] * kTileDim;
+                for (int y = local[1]; y <= local[3]; ++y, row += kTileDim) {
+                    for (int x = local[0]; x <= local[2]; ++x) {
+                        if (order > row[x]) {
+                            row[x] = order;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void reset() override {
+        for (Tile& tile : fTiles) {
+            tile = {};
+        }
+        // Keeps the allocation, since the next frame likely refines a similar number of tiles.
+        fFineCells.clear();
+    }
+
+    // The number of tiles with fine cells, for testing.
+    int refinedTileCount() const { return fFineCells.size() / (kTileDim * kTileDim); }
+
+private:
+    static constexpr int kTileShift = 4;
+    static_assert(1 << kTileShift == kTileDim);
+
+    struct Tile {
+        CompressedPaintersOrder fMax = CompressedPaintersOrder::First();   // over any part
+        CompressedPaintersOrder fCover = CompressedPaintersOrder::First(); // over all of it
+        int fFineCells = -1; // Offset of the tile's kTileDim^2 cells in fFineCells, if refined.
+    };
+
+    TwoLevelGridBoundsManager(int cellSize, const SkISize& tileGridSize)
+            : fScale(1.f / cellSize)
+            , fTileGridWidth(tileGridSize.width())
+            , fMaxCellCoords(tileGridSize.width()  * kTileDim - 1,
+                             tileGridSize.height() * kTileDim - 1)
+            , fTiles(tileGridSize.width() * tileGridSize.height()) {
+        fTiles.push_back_n(tileGridSize.width() * tileGridSize.height());
+    }
+
+    skvx::int4 getCellCoords(const Rect& bounds) const {
+        return pin(skvx::cast<int32_t>(bounds.ltrb() * fScale),
+                   skvx::int4(0),
+                   fMaxCellCoords.xyxy());
+    }
+
+    // Returns the inclusive cell coordinates of 'cells' relative to tile (tx, ty), pinned to it.
+    static skvx::int4 LocalCoords(const skvx::int4& cells, int tx, int ty) {
+        return pin(cells - skvx::int2(tx, ty).xyxy() * kTileDim,
+                   skvx::int4(0),
+                   skvx::int4(kTileDim - 1));
+    }
+
+    static bool CoversTile(const skvx::int4& local) {
+        return all(local == skvx::int4(0, 0, kTileDim - 1, kTileDim - 1));
+    }
+
+    const float      fScale;
+    const int        fTileGridWidth;
+    const skvx::int2 fMaxCellCoords;
+
+    skia_private::TArray<Tile> fTiles;
+    skia_private::TArray<CompressedPaintersOrder> fFineCells;
+};
+
 // A BoundsManager that first relies on BruteForceBoundsManager for N draw calls, and then switches
 // to the GridBoundsManager if it exceeds its limit. For low N, the brute force approach is
 // surprisingly efficient, has the highest accuracy, and very low memory overhead. Once the draw
@@ -306,6 +306,21 @@ sk_sp<MtlGraphicsPipeline> MtlGraphicsPipeline::Make(const MtlSharedContext* sha
     }
 
     NSError* error;
+#if SKGPU_GRAPHITE_METAL_SDK_VERSION >= 230
+    if (@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)) {
+        id<MTLBinaryArchive> archive = sharedContext->binaryArchive();
+        if (archive) {
+            // Metal uses the archived binary if it has one, and adding the descriptor makes sure
+            // the archive has one the next time the client loads it.
+            (*psoDescriptor).binaryArchives = @[archive];
+            if (![archive addRenderPipelineFunctionsWithDescriptor:psoDescriptor.get()
+                                                             error:&error]) {
+                SKGPU_LOG_W("Failed to add pipeline to binary archive: %s",
+                            error.debugDescription.UTF8String);
+            }
+        }
+    }
+#endif
     sk_cfp<id<MTLRenderPipelineState>> pso(
             [sharedContext->device() newRenderPipelineStateWithDescriptor:psoDescriptor.get()
                                                                     error:&error]);
@@ -19,6 +19,7 @@
 #include "src/gpu/graphite/ContextUtils.h"
 #include "src/gpu/graphite/GlobalCache.h"
 #include "src/gpu/graphite/GraphicsPipelineDesc.h"
+#include "src/gpu/graphite/PersistentCacheUtils.h"
 #include "src/gpu/graphite/Renderer.h"
 #include "src/gpu/graphite/RendererProvider.h"
 #include "src/gpu/graphite/compute/ComputeStep.h"
@@ -113,6 +114,9 @@ sk_sp<GraphicsPipeline> MtlResourceProvider::createGraphicsPipeline(
     SkSL::ProgramSettings settings;
 
     settings.fForceNoRTFlip = true;
+    // Generated shaders repeat a lot of work across the snippets they're built from.
+    settings.fEliminateCommonSubexpressions = true;
+    settings.fHoistLoopInvariants = true;
 
     SkSL::Compiler skslCompiler(fSharedContext->caps()->shaderCaps());
     ShaderErrorHandler* errorHandler = fSharedContext->caps()->shaderErrorHandler();
@@ -131,13 +135,16 @@ sk_sp<GraphicsPipeline> MtlResourceProvider::createGraphicsPipeline(
     std::string& fsSkSL = fsSkSLInfo.fSkSL;
     const BlendInfo& blendInfo = fsSkSLInfo.fBlendInfo;
     const bool localCoordsNeeded = fsSkSLInfo.fRequiresLocalCoords;
-    if (!SkSLToMSL(&skslCompiler,
-                   fsSkSL,
-                   SkSL::ProgramKind::kGraphiteFragment,
-                   settings,
-                   &fsMSL,
-                   &fsInterface,
-                   errorHandler)) {
+    if (!PersistentCacheUtils::SkSLToBackendCached(fSharedContext->caps(),
+                                                   PersistentCacheUtils::kMSLTag,
+                                                   SkSLToMSL,
+                                                   &skslCompiler,
+                                                   fsSkSL,
+                                                   SkSL::ProgramKind::kGraphiteFragment,
+                                                   settings,
+                                                   &fsMSL,
+                                                   &fsInterface,
+                                                   errorHandler)) {
         return nullptr;
     }
 
@@ -146,13 +153,16 @@ sk_sp<GraphicsPipeline> MtlResourceProvider::createGraphicsPipeline(
                                               useStorageBuffers,
                                               localCoordsNeeded);
     const std::string& vsSkSL = vsSkSLInfo.fSkSL;
-    if (!SkSLToMSL(&skslCompiler,
-                   vsSkSL,
-                   SkSL::ProgramKind::kGraphiteVertex,
-                   settings,
-                   &vsMSL,
-                   &vsInterface,
-                   errorHandler)) {
+    if (!PersistentCacheUtils::SkSLToBackendCached(fSharedContext->caps(),
+                                                   PersistentCacheUtils::kMSLTag,
+                                                   SkSLToMSL,
+                                                   &skslCompiler,
+                                                   vsSkSL,
+                                                   SkSL::ProgramKind::kGraphiteVertex,
+                                                   settings,
+                                                   &vsMSL,
+                                                   &vsInterface,
+                                                   errorHandler)) {
         return nullptr;
     }
 
@@ -207,13 +217,16 @@ sk_sp<ComputePipeline> MtlResourceProvider::createComputePipeline(
 
         SkSL::Compiler skslCompiler(fSharedContext->caps()->shaderCaps());
         std::string sksl = BuildComputeSkSL(fSharedContext->caps(), pipelineDesc.computeStep());
-        if (!SkSLToMSL(&skslCompiler,
-                       sksl,
-                       SkSL::ProgramKind::kCompute,
-                       settings,
-                       &msl,
-                       &interface,
-                       errorHandler)) {
+        if (!PersistentCacheUtils::SkSLToBackendCached(fSharedContext->caps(),
+                                                       PersistentCacheUtils::kMSLTag,
+                                                       SkSLToMSL,
+                                                       &skslCompiler,
+                                                       sksl,
+                                                       SkSL::ProgramKind::kCompute,
+                                                       settings,
+                                                       &msl,
+                                                       &interface,
+                                                       errorHandler)) {
             return nullptr;
         }
         library = MtlCompileShaderLibrary(this->mtlSharedContext(), msl, errorHandler);
@@ -33,6 +33,13 @@ public:
 
     id<MTLDevice> device() const { return fDevice.get(); }
 
+#if SKGPU_GRAPHITE_METAL_SDK_VERSION >= 230
+    id<MTLBinaryArchive> binaryArchive() const
+            SK_API_AVAILABLE(macos(11.0), ios(14.0), tvos(14.0)) {
+        return (__bridge id<MTLBinaryArchive>)fBinaryArchive.get();
+    }
+#endif
+
     const MtlCaps& mtlCaps() const { return static_cast<const MtlCaps&>(*this->caps()); }
 
     std::unique_ptr<ResourceProvider> makeResourceProvider(SingleOwner*,
@@ -42,12 +49,14 @@ public:
 private:
 
     MtlSharedContext(sk_cfp<id<MTLDevice>>,
+                     sk_cfp<CFTypeRef> binaryArchive,
                      sk_sp<skgpu::MtlMemoryAllocator> memoryAllocator,
                      std::unique_ptr<const MtlCaps>);
 
     sk_sp<skgpu::MtlMemoryAllocator> fMemoryAllocator;
 
     sk_cfp<id<MTLDevice>> fDevice;
+    sk_cfp<CFTypeRef> fBinaryArchive;
 };
 
 } // namespace skgpu::graphite
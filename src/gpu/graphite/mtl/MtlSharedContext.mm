@@ -46,16 +46,19 @@ sk_sp<skgpu::graphite::SharedContext> MtlSharedContext::Make(const MtlBackendCon
     }
 
     return sk_sp<skgpu::graphite::SharedContext>(new MtlSharedContext(std::move(device),
+                                                                      context.fBinaryArchive,
                                                                       std::move(memoryAllocator),
                                                                       std::move(caps)));
 }
 
 MtlSharedContext::MtlSharedContext(sk_cfp<id<MTLDevice>> device,
+                                   sk_cfp<CFTypeRef> binaryArchive,
                                    sk_sp<skgpu::MtlMemoryAllocator> memoryAllocator,
                                    std::unique_ptr<const MtlCaps> caps)
         : skgpu::graphite::SharedContext(std::move(caps), BackendApi::kMetal)
         , fMemoryAllocator(std::move(memoryAllocator))
-        , fDevice(std::move(device)) {}
+        , fDevice(std::move(device))
+        , fBinaryArchive(std::move(binaryArchive)) {}
 
 MtlSharedContext::~MtlSharedContext() {
     // need to clear out resources before the allocator (if any) is removed
@@ -53,6 +53,11 @@ bool TextAtlasManager::hasGlyph(MaskFormat format, Glyph* glyph) {
     return this->getAtlas(format)->hasID(glyph->fAtlasLocator.plotLocator());
 }
 
+bool TextAtlasManager::forwardGlyph(MaskFormat format, Glyph* glyph) {
+    SkASSERT(glyph);
+    return this->getAtlas(format)->forwardLocator(&glyph->fAtlasLocator);
+}
+
 template <typename INT_TYPE>
 static void expand_bits(INT_TYPE* dst,
                         const uint8_t* src,
@@ -336,7 +341,8 @@ std::tuple<bool, int> GlyphVector::regenerateAtlasForGraphite(int begin,
             Glyph* gpuGlyph = variant.glyph;
             SkASSERT(gpuGlyph != nullptr);
 
-            if (!atlasManager->hasGlyph(maskFormat, gpuGlyph)) {
+            if (!atlasManager->hasGlyph(maskFormat, gpuGlyph) &&
+                !atlasManager->forwardGlyph(maskFormat, gpuGlyph)) {
                 const SkGlyph& skGlyph = *metricsAndImages.glyph(gpuGlyph->fPackedID);
                 auto code = atlasManager->addGlyphToAtlas(skGlyph, gpuGlyph, srcPadding);
                 if (code != DrawAtlas::ErrorCode::kSucceeded) {
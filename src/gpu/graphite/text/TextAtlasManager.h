@@ -49,6 +49,9 @@ public:
 
     bool hasGlyph(MaskFormat, sktext::gpu::Glyph*);
 
+    // If the atlas moved the glyph's mask when compacting, point the glyph at where it is now.
+    bool forwardGlyph(MaskFormat, sktext::gpu::Glyph*);
+
     DrawAtlas::ErrorCode addGlyphToAtlas(const SkGlyph&,
                                          sktext::gpu::Glyph*,
                                          int srcPadding);
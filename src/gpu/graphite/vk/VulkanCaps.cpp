@@ -305,8 +305,12 @@ TextureInfo VulkanCaps::getDefaultDepthStencilTextureInfo(SkEnumBitMask<DepthSte
     info.fFlags = (isProtected == Protected::kYes) ? VK_IMAGE_CREATE_PROTECTED_BIT : 0;
     info.fFormat = format;
     info.fImageTiling = VK_IMAGE_TILING_OPTIMAL;
-    // TODO: Passing in a discardable flag to this method, and if true, add the TRANSIENT bit.
     info.fImageUsageFlags = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    // Depth and stencil are always cleared at the start of a render pass and discarded at the end
+    // (see DrawContext), so on tilers they never need to be backed by real memory.
+    if (fSupportsMemorylessAttachments) {
+        info.fImageUsageFlags |= VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    }
     info.fSharingMode = VK_SHARING_MODE_EXCLUSIVE;
     info.fAspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
 
@@ -749,8 +749,20 @@ void VulkanCommandBuffer::bindUniformBuffers() {
             fUniformBuffersToBind[VulkanGraphicsPipeline::kPaintUniformBufferIndex].fBuffer) {
         descriptors.push_back(VulkanGraphicsPipeline::kPaintUniformDescriptor);
     }
+
+    // A set that was written with the same buffers and offsets can be bound again as is.
+    STArray<2 * VulkanGraphicsPipeline::kNumUniformBuffers, uint32_t> boundBuffers;
+    for (int i = 0; i < descriptors.size(); i++) {
+        const BindBufferInfo& info = fUniformBuffersToBind[descriptors.at(i).bindingIndex];
+        boundBuffers.push_back(info.fBuffer ? info.fBuffer->uniqueID().asUInt()
+                                            : SK_InvalidUniqueID);
+        boundBuffers.push_back(SkToU32(info.fOffset));
+    }
+    bool needsUpdate;
     sk_sp<VulkanDescriptorSet> set = fResourceProvider->findOrCreateDescriptorSet(
-            SkSpan<DescriptorData>{&descriptors.front(), descriptors.size()});
+            SkSpan<DescriptorData>{&descriptors.front(), descriptors.size()},
+            SkSpan<const uint32_t>{boundBuffers.data(), boundBuffers.size()},
+            &needsUpdate);
 
     if (!set) {
         SKGPU_LOG_E("Unable to find or create descriptor set");
@@ -759,7 +771,7 @@ void VulkanCommandBuffer::bindUniformBuffers() {
     static uint64_t maxUniformBufferRange = static_cast<const VulkanSharedContext*>(
             fSharedContext)->vulkanCaps().maxUniformBufferRange();
 
-    for (int i = 0; i < descriptors.size(); i++) {
+    for (int i = 0; needsUpdate && i < descriptors.size(); i++) {
         int descriptorBindingIndex = descriptors.at(i).bindingIndex;
         SkASSERT(static_cast<unsigned long>(descriptorBindingIndex)
                     < fUniformBuffersToBind.size());
@@ -900,8 +912,29 @@ void VulkanCommandBuffer::recordTextureAndSamplerDescSet(
                                /*bindingIdx=*/i,
                                PipelineStageFlags::kFragmentShader});
     }
+
+    // A set that was written with the same textures and samplers can be bound again as is.
+    TArray<uint32_t> boundTexSamplers(2 * command.fNumTexSamplers);
+    for (int i = 0; i < command.fNumTexSamplers; ++i) {
+        const Texture* texture = drawPass.getTexture(command.fTextureIndices[i]);
+        const Sampler* sampler = drawPass.getSampler(command.fSamplerIndices[i]);
+        if (!texture || !sampler) {
+            // TODO(b/294198324): Investigate the root cause for null texture or samplers on
+            // Ubuntu QuadP400 GPU
+            SKGPU_LOG_E("Texture and sampler must not be null");
+            fNumTextureSamplers = 0;
+            fTextureSamplerDescSetToBind = VK_NULL_HANDLE;
+            fBindTextureSamplers = false;
+            return;
+        }
+        boundTexSamplers.push_back(texture->uniqueID().asUInt());
+        boundTexSamplers.push_back(sampler->uniqueID().asUInt());
+    }
+    bool needsUpdate;
     sk_sp<VulkanDescriptorSet> set = fResourceProvider->findOrCreateDescriptorSet(
-            SkSpan<DescriptorData>{&descriptors.front(), descriptors.size()});
+            SkSpan<DescriptorData>{&descriptors.front(), descriptors.size()},
+            SkSpan<const uint32_t>{boundTexSamplers.data(), boundTexSamplers.size()},
+            &needsUpdate);
 
     if (!set) {
         SKGPU_LOG_E("Unable to find or create descriptor set");
@@ -910,6 +943,23 @@ void VulkanCommandBuffer::recordTextureAndSamplerDescSet(
         fBindTextureSamplers = false;
         return;
     }
+    if (needsUpdate) {
+        this->writeTextureAndSamplerDescSet(drawPass, command, *set->descriptorSet());
+    }
+
+    // Store the updated descriptor set to be actually bound later on. This avoids binding and
+    // potentially having to re-bind in cases where earlier descriptor sets change while going
+    // through drawpass commands.
+    fTextureSamplerDescSetToBind = *set->descriptorSet();
+    fBindTextureSamplers = true;
+    fNumTextureSamplers = command.fNumTexSamplers;
+    this->trackResource(std::move(set));
+}
+
+void VulkanCommandBuffer::writeTextureAndSamplerDescSet(
+        const DrawPass& drawPass,
+        const DrawPassCommands::BindTexturesAndSamplers& command,
+        VkDescriptorSet set) {
     // Populate the descriptor set with texture/sampler descriptors
     TArray<VkWriteDescriptorSet> writeDescriptorSets(command.fNumTexSamplers);
     TArray<VkDescriptorImageInfo> descriptorImageInfos(command.fNumTexSamplers);
@@ -918,15 +968,7 @@ void VulkanCommandBuffer::recordTextureAndSamplerDescSet(
                 drawPass.getTexture(command.fTextureIndices[i])));
         auto sampler = static_cast<const VulkanSampler*>(
                 drawPass.getSampler(command.fSamplerIndices[i]));
-        if (!texture || !sampler) {
-            // TODO(b/294198324): Investigate the root cause for null texture or samplers on
-            // Ubuntu QuadP400 GPU
-            SKGPU_LOG_E("Texture and sampler must not be null");
-            fNumTextureSamplers = 0;
-            fTextureSamplerDescSetToBind = VK_NULL_HANDLE;
-            fBindTextureSamplers = false;
-            return;
-        }
+        SkASSERT(texture && sampler);
 
         VkDescriptorImageInfo& textureInfo = descriptorImageInfos.push_back();
         memset(&textureInfo, 0, sizeof(VkDescriptorImageInfo));
@@ -939,7 +981,7 @@ void VulkanCommandBuffer::recordTextureAndSamplerDescSet(
         memset(&writeInfo, 0, sizeof(VkWriteDescriptorSet));
         writeInfo.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
         writeInfo.pNext = nullptr;
-        writeInfo.dstSet = *set->descriptorSet();
+        writeInfo.dstSet = set;
         writeInfo.dstBinding = i;
         writeInfo.dstArrayElement = 0;
         writeInfo.descriptorCount = 1;
@@ -955,14 +997,6 @@ void VulkanCommandBuffer::recordTextureAndSamplerDescSet(
                                     &writeDescriptorSets[0],
                                     /*descriptorCopyCount=*/0,
                                     /*pDescriptorCopies=*/nullptr));
-
-    // Store the updated descriptor set to be actually bound later on. This avoids binding and
-    // potentially having to re-bind in cases where earlier descriptor sets change while going
-    // through drawpass commands.
-    fTextureSamplerDescSetToBind = *set->descriptorSet();
-    fBindTextureSamplers = true;
-    fNumTextureSamplers = command.fNumTexSamplers;
-    this->trackResource(std::move(set));
 }
 
 void VulkanCommandBuffer::bindTextureSamplers() {
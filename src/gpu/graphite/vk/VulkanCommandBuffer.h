@@ -84,6 +84,9 @@ private:
     void recordBufferBindingInfo(const BindBufferInfo& info, UniformSlot);
     void recordTextureAndSamplerDescSet(
             const DrawPass&, const DrawPassCommands::BindTexturesAndSamplers&);
+    void writeTextureAndSamplerDescSet(const DrawPass&,
+                                       const DrawPassCommands::BindTexturesAndSamplers&,
+                                       VkDescriptorSet);
 
     void bindTextureSamplers();
     void bindUniformBuffers();
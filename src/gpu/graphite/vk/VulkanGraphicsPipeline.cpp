@@ -17,6 +17,7 @@
 #include "src/gpu/graphite/ContextUtils.h"
 #include "src/gpu/graphite/GraphicsPipelineDesc.h"
 #include "src/gpu/graphite/Log.h"
+#include "src/gpu/graphite/PersistentCacheUtils.h"
 #include "src/gpu/graphite/RendererProvider.h"
 #include "src/gpu/graphite/RuntimeEffectDictionary.h"
 #include "src/gpu/graphite/vk/VulkanCaps.h"
@@ -554,6 +555,8 @@ sk_sp<VulkanGraphicsPipeline> VulkanGraphicsPipeline::Make(
     SkSL::Program::Interface vsInterface, fsInterface;
     SkSL::ProgramSettings settings;
     settings.fForceNoRTFlip = true; // TODO: Confirm
+    settings.fEliminateCommonSubexpressions = true;
+    settings.fHoistLoopInvariants = true;
     ShaderErrorHandler* errorHandler = sharedContext->caps()->shaderErrorHandler();
 
     const RenderStep* step = sharedContext->rendererProvider()->lookup(pipelineDesc.renderStepID());
@@ -580,13 +583,16 @@ sk_sp<VulkanGraphicsPipeline> VulkanGraphicsPipeline::Make(
     VkShaderModule fsModule = VK_NULL_HANDLE, vsModule = VK_NULL_HANDLE;
 
     if (hasFragmentSkSL) {
-        if (!SkSLToSPIRV(compiler,
-                         fsSkSL,
-                         SkSL::ProgramKind::kGraphiteFragment,
-                         settings,
-                         &fsSPIRV,
-                         &fsInterface,
-                         errorHandler)) {
+        if (!PersistentCacheUtils::SkSLToBackendCached(sharedContext->caps(),
+                                                       PersistentCacheUtils::kSPIRVTag,
+                                                       SkSLToSPIRV,
+                                                       compiler,
+                                                       fsSkSL,
+                                                       SkSL::ProgramKind::kGraphiteFragment,
+                                                       settings,
+                                                       &fsSPIRV,
+                                                       &fsInterface,
+                                                       errorHandler)) {
             return nullptr;
         }
 
@@ -601,13 +607,16 @@ sk_sp<VulkanGraphicsPipeline> VulkanGraphicsPipeline::Make(
                                               useStorageBuffers,
                                               localCoordsNeeded);
     const std::string& vsSkSL = vsSkSLInfo.fSkSL;
-    if (!SkSLToSPIRV(compiler,
-                     vsSkSL,
-                     SkSL::ProgramKind::kGraphiteVertex,
-                     settings,
-                     &vsSPIRV,
-                     &vsInterface,
-                     errorHandler)) {
+    if (!PersistentCacheUtils::SkSLToBackendCached(sharedContext->caps(),
+                                                   PersistentCacheUtils::kSPIRVTag,
+                                                   SkSLToSPIRV,
+                                                   compiler,
+                                                   vsSkSL,
+                                                   SkSL::ProgramKind::kGraphiteVertex,
+                                                   settings,
+                                                   &vsSPIRV,
+                                                   &vsInterface,
+                                                   errorHandler)) {
         return nullptr;
     }
 
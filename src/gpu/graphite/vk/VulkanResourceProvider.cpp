@@ -13,6 +13,7 @@
 #include "include/gpu/graphite/vk/VulkanGraphiteTypes.h"
 #include "include/gpu/vk/VulkanMutableTextureState.h"
 #include "src/gpu/graphite/Buffer.h"
+#include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ComputePipeline.h"
 #include "src/gpu/graphite/GraphicsPipeline.h"
 #include "src/gpu/graphite/Sampler.h"
@@ -47,14 +48,7 @@ VulkanResourceProvider::VulkanResourceProvider(SharedContext* sharedContext,
         , fIntrinsicUniformBuffer(std::move(intrinsicConstantUniformBuffer)) {
 }
 
-VulkanResourceProvider::~VulkanResourceProvider() {
-    if (fPipelineCache != VK_NULL_HANDLE) {
-        VULKAN_CALL(this->vulkanSharedContext()->interface(),
-                    DestroyPipelineCache(this->vulkanSharedContext()->device(),
-                                         fPipelineCache,
-                                         nullptr));
-    }
-}
+VulkanResourceProvider::~VulkanResourceProvider() {}
 
 const VulkanSharedContext* VulkanResourceProvider::vulkanSharedContext() const {
     return static_cast<const VulkanSharedContext*>(fSharedContext);
@@ -88,7 +82,7 @@ sk_sp<GraphicsPipeline> VulkanResourceProvider::createGraphicsPipeline(
                                         pipelineDesc,
                                         renderPassDesc,
                                         compatibleRenderPass,
-                                        this->pipelineCache());
+                                        this->vulkanSharedContext()->pipelineCache());
 }
 
 sk_sp<ComputePipeline> VulkanResourceProvider::createComputePipeline(const ComputePipelineDesc&) {
@@ -246,6 +240,37 @@ sk_sp<VulkanDescriptorSet> VulkanResourceProvider::findOrCreateDescriptorSet(
     return firstDescSet;
 }
 
+sk_sp<VulkanDescriptorSet> VulkanResourceProvider::findOrCreateDescriptorSet(
+        SkSpan<DescriptorData> requestedDescriptors,
+        SkSpan<const uint32_t> boundResources,
+        bool* needsUpdate) {
+    *needsUpdate = true;
+    if (requestedDescriptors.empty()) {
+        return nullptr;
+    }
+
+    DescriptorSetKey key;
+    key.fData.reserve(SkToInt(1 + requestedDescriptors.size() + boundResources.size()));
+    key.fData.push_back(static_cast<uint32_t>(requestedDescriptors.size()));
+    for (const DescriptorData& desc : requestedDescriptors) {
+        key.fData.push_back(static_cast<uint8_t>(desc.type) << 24 |
+                            desc.bindingIndex << 16 |
+                            static_cast<uint16_t>(desc.count));
+    }
+    key.fData.push_back_n(SkToInt(boundResources.size()), boundResources.data());
+
+    if (sk_sp<VulkanDescriptorSet>* recycled = fRecycledDescriptorSets.find(key)) {
+        *needsUpdate = false;
+        return *recycled;
+    }
+
+    sk_sp<VulkanDescriptorSet> descSet = this->findOrCreateDescriptorSet(requestedDescriptors);
+    if (descSet) {
+        fRecycledDescriptorSets.insert(key, descSet);
+    }
+    return descSet;
+}
+
 sk_sp<VulkanRenderPass> VulkanResourceProvider::findOrCreateRenderPass(
         const RenderPassDesc& renderPassDesc, bool compatibleOnly) {
     auto renderPassKey = VulkanRenderPass::MakeRenderPassKey(renderPassDesc, compatibleOnly);
@@ -266,29 +291,6 @@ sk_sp<VulkanRenderPass> VulkanResourceProvider::findOrCreateRenderPass(
     return renderPass;
 }
 
-VkPipelineCache VulkanResourceProvider::pipelineCache() {
-    if (fPipelineCache == VK_NULL_HANDLE) {
-        VkPipelineCacheCreateInfo createInfo;
-        memset(&createInfo, 0, sizeof(VkPipelineCacheCreateInfo));
-        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
-        createInfo.pNext = nullptr;
-        createInfo.flags = 0;
-        createInfo.initialDataSize = 0;
-        createInfo.pInitialData = nullptr;
-        VkResult result;
-        VULKAN_CALL_RESULT(this->vulkanSharedContext()->interface(),
-                           result,
-                           CreatePipelineCache(this->vulkanSharedContext()->device(),
-                                               &createInfo,
-                                               nullptr,
-                                               &fPipelineCache));
-        if (VK_SUCCESS != result) {
-            fPipelineCache = VK_NULL_HANDLE;
-        }
-    }
-    return fPipelineCache;
-}
-
 sk_sp<VulkanFramebuffer> VulkanResourceProvider::createFramebuffer(
         const VulkanSharedContext* context,
         const skia_private::TArray<VkImageView>& attachmentViews,
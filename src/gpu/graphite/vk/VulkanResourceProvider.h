@@ -11,6 +11,9 @@
 #include "src/gpu/graphite/ResourceProvider.h"
 
 #include "include/gpu/vk/VulkanTypes.h"
+#include "include/private/base/SkTArray.h"
+#include "src/core/SkChecksum.h"
+#include "src/core/SkLRUCache.h"
 #include "src/gpu/graphite/DescriptorData.h"
 
 #ifdef  SK_BUILD_FOR_ANDROID
@@ -79,15 +82,36 @@ private:
     void onDeleteBackendTexture(const BackendTexture&) override;
 
     sk_sp<VulkanDescriptorSet> findOrCreateDescriptorSet(SkSpan<DescriptorData>);
+    // Like the above, but first looks for a set that was already written with the same layout and
+    // bound resources, which boundResources must identify (e.g. by Resource unique IDs and
+    // offsets). Such a set is returned with needsUpdate set to false and can be bound without
+    // calling vkUpdateDescriptorSets again. Otherwise the caller must write the returned set.
+    sk_sp<VulkanDescriptorSet> findOrCreateDescriptorSet(SkSpan<DescriptorData>,
+                                                         SkSpan<const uint32_t> boundResources,
+                                                         bool* needsUpdate);
     // Find or create a compatible (needed when creating a framebuffer and graphics pipeline) or
     // full (needed when beginning a render pass from the command buffer) RenderPass.
     sk_sp<VulkanRenderPass> findOrCreateRenderPass(const RenderPassDesc&,
                                                    bool compatibleOnly);
 
-    VkPipelineCache pipelineCache();
-
     friend class VulkanCommandBuffer;
-    VkPipelineCache fPipelineCache = VK_NULL_HANDLE;
+
+    struct DescriptorSetKey {
+        bool operator==(const DescriptorSetKey& that) const { return fData == that.fData; }
+
+        skia_private::TArray<uint32_t> fData;
+    };
+    struct DescriptorSetKeyHash {
+        uint32_t operator()(const DescriptorSetKey& key) const {
+            return SkChecksum::Hash32(key.fData.data(), key.fData.size_bytes());
+        }
+    };
+    // Written descriptor sets, most recently used first. Holding a ref keeps a set from returning
+    // to the ResourceCache as scratch (and being overwritten) until it's evicted from here. Sets
+    // pointing at destroyed resources are never matched again since unique IDs aren't reused.
+    static constexpr int kMaxRecycledDescriptorSets = 256;
+    SkLRUCache<DescriptorSetKey, sk_sp<VulkanDescriptorSet>, DescriptorSetKeyHash>
+            fRecycledDescriptorSets{kMaxRecycledDescriptorSets};
 
     // Each render pass will need buffer space to record rtAdjust information. To minimize costly
     // allocation calls and searching of the resource cache, we find & store a uniform buffer upon
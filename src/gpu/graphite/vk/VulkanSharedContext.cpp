@@ -7,18 +7,29 @@
 
 #include "src/gpu/graphite/vk/VulkanSharedContext.h"
 
+#include "include/core/SkData.h"
+#include "include/core/SkString.h"
 #include "include/gpu/graphite/ContextOptions.h"
 #include "include/gpu/vk/VulkanBackendContext.h"
 #include "src/gpu/graphite/Log.h"
 #include "src/gpu/graphite/ResourceTypes.h"
 #include "src/gpu/graphite/vk/VulkanBuffer.h"
 #include "src/gpu/graphite/vk/VulkanCaps.h"
+#include "src/gpu/graphite/vk/VulkanGraphiteUtilsPriv.h"
 #include "src/gpu/graphite/vk/VulkanResourceProvider.h"
 #include "src/gpu/vk/VulkanAMDMemoryAllocator.h"
 #include "src/gpu/vk/VulkanInterface.h"
 
 namespace skgpu::graphite {
 
+// The VkPipelineCache data is stored in the Context's PersistentCache under this key, next to the
+// shader code stored by PersistentCacheUtils. The data itself starts with a header identifying
+// the device and driver, so the driver rejects data saved by a different one.
+static sk_sp<SkData> pipeline_cache_key() {
+    static constexpr char kKey[] = "Graphite VkPipelineCache";
+    return SkData::MakeWithoutCopy(kKey, sizeof(kKey) - 1);
+}
+
 sk_sp<SharedContext> VulkanSharedContext::Make(const VulkanBackendContext& context,
                                                const ContextOptions& options) {
     if (context.fInstance == VK_NULL_HANDLE ||
@@ -140,6 +151,71 @@ VulkanSharedContext::VulkanSharedContext(const VulkanBackendContext& backendCont
 VulkanSharedContext::~VulkanSharedContext() {
     // need to clear out resources before the allocator is removed
     this->globalCache()->deleteResources();
+
+    SkAutoMutexExclusive lock(fPipelineCacheMutex);
+    if (fPipelineCache != VK_NULL_HANDLE) {
+        this->storePipelineCacheData();
+        VULKAN_CALL(this->interface(), DestroyPipelineCache(fDevice, fPipelineCache, nullptr));
+    }
+}
+
+VkPipelineCache VulkanSharedContext::pipelineCache() const {
+    SkAutoMutexExclusive lock(fPipelineCacheMutex);
+    if (fPipelineCache == VK_NULL_HANDLE) {
+        VkPipelineCacheCreateInfo createInfo;
+        memset(&createInfo, 0, sizeof(VkPipelineCacheCreateInfo));
+        createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+        createInfo.pNext = nullptr;
+        createInfo.flags = 0;
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+
+        sk_sp<SkData> initialData;
+        if (ContextOptions::PersistentCache* cache = this->caps()->persistentCache()) {
+            initialData = cache->load(*pipeline_cache_key());
+            if (initialData) {
+                createInfo.initialDataSize = initialData->size();
+                createInfo.pInitialData = initialData->data();
+            }
+        }
+
+        VkResult result;
+        VULKAN_CALL_RESULT(this->interface(),
+                           result,
+                           CreatePipelineCache(fDevice, &createInfo, nullptr, &fPipelineCache));
+        if (VK_SUCCESS != result) {
+            fPipelineCache = VK_NULL_HANDLE;
+        }
+    }
+    return fPipelineCache;
+}
+
+void VulkanSharedContext::storePipelineCacheData() const {
+    ContextOptions::PersistentCache* cache = this->caps()->persistentCache();
+    if (!cache || fPipelineCache == VK_NULL_HANDLE) {
+        return;
+    }
+
+    size_t dataSize = 0;
+    VkResult result;
+    VULKAN_CALL_RESULT(this->interface(),
+                       result,
+                       GetPipelineCacheData(fDevice, fPipelineCache, &dataSize, nullptr));
+    if (result != VK_SUCCESS || dataSize == 0) {
+        return;
+    }
+
+    std::unique_ptr<uint8_t[]> data(new uint8_t[dataSize]);
+    VULKAN_CALL_RESULT(this->interface(),
+                       result,
+                       GetPipelineCacheData(fDevice, fPipelineCache, &dataSize, data.get()));
+    if (result != VK_SUCCESS) {
+        return;
+    }
+
+    cache->store(*pipeline_cache_key(),
+                 *SkData::MakeWithoutCopy(data.get(), dataSize),
+                 SkString("Graphite VkPipelineCache"));
 }
 
 std::unique_ptr<ResourceProvider> VulkanSharedContext::makeResourceProvider(
@@ -11,6 +11,8 @@
 #include "src/gpu/graphite/SharedContext.h"
 
 #include "include/gpu/vk/VulkanTypes.h"
+#include "include/private/base/SkMutex.h"
+#include "include/private/base/SkThreadAnnotations.h"
 #include "src/gpu/graphite/vk/VulkanCaps.h"
 
 namespace skgpu {
@@ -44,6 +46,11 @@ public:
 
     bool checkVkResult(VkResult result) const;
 
+    // All ResourceProviders create their pipelines with this cache, so the data saved to the
+    // Context's PersistentCache covers what every Recorder compiled. It's created on first use,
+    // seeded from the PersistentCache, and may be VK_NULL_HANDLE if creation fails.
+    VkPipelineCache pipelineCache() const;
+
 private:
     VulkanSharedContext(const VulkanBackendContext&,
                         sk_sp<const skgpu::VulkanInterface> interface,
@@ -53,8 +60,14 @@ private:
     sk_sp<const skgpu::VulkanInterface> fInterface;
     sk_sp<skgpu::VulkanMemoryAllocator> fMemoryAllocator;
 
+    // Saves the pipeline cache's contents to the Context's PersistentCache, if it has one.
+    void storePipelineCacheData() const SK_REQUIRES(fPipelineCacheMutex);
+
     VkDevice fDevice;
     uint32_t fQueueIndex;
+
+    mutable SkMutex fPipelineCacheMutex;
+    mutable VkPipelineCache fPipelineCache SK_GUARDED_BY(fPipelineCacheMutex) = VK_NULL_HANDLE;
 };
 
 } // namespace skgpu::graphite
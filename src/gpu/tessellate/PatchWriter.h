@@ -378,19 +378,9 @@ public:
 
     // Write a cubic curve with its four control points.
     AI void writeCubic(float2 p0, float2 p1, float2 p2, float2 p3) {
-        float n4 = wangs_formula::cubic_p4(kPrecision, p0, p1, p2, p3, fApproxTransform);
-        if constexpr (kDiscardFlatCurves) {
-            if (n4 <= 1.f) {
-                // This cubic only needs one segment (e.g. a line) but we're not filling space with
-                // fans or stroking, so nothing actually needs to be drawn.
-                return;
-            }
-        }
-        if (int numPatches = this->accountForCurve(n4)) {
-            this->chopAndWriteCubics(p0, p1, p2, p3, numPatches);
-        } else {
-            this->writeCubicPatch(p0, p1, p2, p3);
-        }
+        this->writeCubicWithSegments(
+                p0, p1, p2, p3,
+                wangs_formula::cubic_p4(kPrecision, p0, p1, p2, p3, fApproxTransform));
     }
     AI void writeCubic(const SkPoint pts[4]) {
         float4 p0p1 = float4::Load(pts);
@@ -398,6 +388,25 @@ public:
         this->writeCubic(p0p1.lo, p0p1.hi, p2p3.lo, p2p3.hi);
     }
 
+    // Writes 'count' cubics whose control points are stored contiguously in 'pts', 4 per cubic.
+    // This is equivalent to calling writeCubic() on each, but evaluates Wang's formula for
+    // kCubicBatchSize cubics at a time.
+    static constexpr int kCubicBatchSize = 4;
+    void writeCubics(const SkPoint pts[], int count) {
+        for (; count >= kCubicBatchSize; count -= kCubicBatchSize, pts += 4 * kCubicBatchSize) {
+            float n4[kCubicBatchSize];
+            wangs_formula::cubic_p4<kCubicBatchSize>(kPrecision, pts, fApproxTransform).store(n4);
+            for (int i = 0; i < kCubicBatchSize; ++i) {
+                float4 p0p1 = float4::Load(pts + 4*i);
+                float4 p2p3 = float4::Load(pts + 4*i + 2);
+                this->writeCubicWithSegments(p0p1.lo, p0p1.hi, p2p3.lo, p2p3.hi, n4[i]);
+            }
+        }
+        for (; count > 0; --count, pts += 4) {
+            this->writeCubic(pts);
+        }
+    }
+
     // Write a conic curve with three control points and 'w', with the last coord of the last
     // control point signaling a conic by being set to infinity.
     AI void writeConic(float2 p0, float2 p1, float2 p2, float w) {
@@ -495,6 +504,22 @@ public:
     }
 
 private:
+    // Writes a cubic whose Wang's formula, raised to the 4th power, has already been evaluated.
+    AI void writeCubicWithSegments(float2 p0, float2 p1, float2 p2, float2 p3, float n4) {
+        if constexpr (kDiscardFlatCurves) {
+            if (n4 <= 1.f) {
+                // This cubic only needs one segment (e.g. a line) but we're not filling space with
+                // fans or stroking, so nothing actually needs to be drawn.
+                return;
+            }
+        }
+        if (int numPatches = this->accountForCurve(n4)) {
+            this->chopAndWriteCubics(p0, p1, p2, p3, numPatches);
+        } else {
+            this->writeCubicPatch(p0, p1, p2, p3);
+        }
+    }
+
     AI void emitPatchAttribs(VertexWriter vertexWriter,
                              const JoinAttrib& join,
                              float explicitCurveType) {
@@ -122,6 +122,14 @@ public:
         return join(fC0 * vectors.x() + fC1 * vectors.y(),
                     fC0 * vectors.z() + fC1 * vectors.w());
     }
+    // Transforms N vectors stored as separate x and y lanes.
+    template <int N>
+    AI void operator()(skvx::Vec<N,float>* x, skvx::Vec<N,float>* y) const {
+        skvx::Vec<N,float> tx = fC0[0] * *x + fC1[0] * *y;
+        skvx::Vec<N,float> ty = fC0[1] * *x + fC1[1] * *y;
+        *x = tx;
+        *y = ty;
+    }
 private:
     // First and second columns of 2x2 matrix
     skvx::float2 fC0;
@@ -186,6 +194,59 @@ AI float cubic_p4(float precision,
                     vectorXform);
 }
 
+// Loads N curves of 4 control points each, stored contiguously in 'pts', into one lane per curve.
+// N must be a power of two, at least 4: each group of 4 curves is transposed with two 4x4 float
+// transposes and a few shuffles, which is much cheaper than gathering the lanes one at a time.
+template <int N>
+AI void load_transposed_curves(const SkPoint pts[], skvx::Vec<N,float> x[4],
+                               skvx::Vec<N,float> y[4]) {
+    static_assert(N >= 4 && (N & (N - 1)) == 0);
+    if constexpr (N == 4) {
+        // Each 4x4 transpose takes the two halves of two curves, {x0,y0,x1,y1} and {x2,y2,x3,y3},
+        // and gives {x0,x2,x0',x2'}, {y0,y2,y0',y2'}, {x1,x3,x1',x3'}, {y1,y3,y1',y3'}.
+        skvx::float4 a01, b01, c01, d01, a23, b23, c23, d23;
+        skvx::strided_load4(&pts[0].fX, a01, b01, c01, d01);
+        skvx::strided_load4(&pts[8].fX, a23, b23, c23, d23);
+        skvx::float8 a = join(a01, a23), b = join(b01, b23);
+        skvx::float8 c = join(c01, c23), d = join(d01, d23);
+        x[0] = skvx::shuffle<0,2,4,6>(a);
+        x[1] = skvx::shuffle<0,2,4,6>(c);
+        x[2] = skvx::shuffle<1,3,5,7>(a);
+        x[3] = skvx::shuffle<1,3,5,7>(c);
+        y[0] = skvx::shuffle<0,2,4,6>(b);
+        y[1] = skvx::shuffle<0,2,4,6>(d);
+        y[2] = skvx::shuffle<1,3,5,7>(b);
+        y[3] = skvx::shuffle<1,3,5,7>(d);
+    } else {
+        skvx::Vec<N/2,float> xlo[4], ylo[4], xhi[4], yhi[4];
+        load_transposed_curves<N/2>(pts, xlo, ylo);
+        load_transposed_curves<N/2>(pts + 4*(N/2), xhi, yhi);
+        for (int i = 0; i < 4; ++i) {
+            x[i] = join(xlo[i], xhi[i]);
+            y[i] = join(ylo[i], yhi[i]);
+        }
+    }
+}
+
+// Evaluates cubic_p4() for N cubics at once, with one lane per cubic. The cubics' control points
+// are stored contiguously in 'pts', 4 per cubic. Paths with many curves spend much of their time
+// in Wang's formula, and working on transposed points avoids the horizontal math that the single
+// curve version does for each curve.
+template <int N>
+AI skvx::Vec<N,float> cubic_p4(float precision,
+                               const SkPoint pts[],
+                               const VectorXform& vectorXform = VectorXform()) {
+    skvx::Vec<N,float> x[4], y[4];
+    load_transposed_curves<N>(pts, x, y);
+    skvx::Vec<N,float> vx0 = -2*x[1] + x[0] + x[2];
+    skvx::Vec<N,float> vy0 = -2*y[1] + y[0] + y[2];
+    skvx::Vec<N,float> vx1 = -2*x[2] + x[1] + x[3];
+    skvx::Vec<N,float> vy1 = -2*y[2] + y[1] + y[3];
+    vectorXform(&vx0, &vy0);
+    vectorXform(&vx1, &vy1);
+    return max(vx0*vx0 + vy0*vy0, vx1*vx1 + vy1*vy1) * length_term_p2<3>(precision);
+}
+
 // Returns Wang's formula specialized for a cubic curve.
 AI float cubic(float precision,
                const SkPoint pts[],
@@ -278,6 +339,40 @@ AI float conic_p2(float precision,
                     vectorXform);
 }
 
+// Evaluates conic_p2() for N conics at once, with one lane per conic. The conics' 3 control points
+// are stored in 'pts' 4 points apart, as they are laid out in patches (the 4th is ignored), and
+// their weights contiguously in 'w'.
+template <int N>
+AI skvx::Vec<N,float> conic_p2(float precision,
+                               const SkPoint pts[],
+                               const float w[],
+                               const VectorXform& vectorXform = VectorXform()) {
+    using floatN = skvx::Vec<N,float>;
+    floatN x[4], y[4];
+    load_transposed_curves<N>(pts, x, y);
+    floatN wN = floatN::Load(w);
+    for (int j = 0; j < 3; ++j) {
+        vectorXform(&x[j], &y[j]);
+    }
+
+    // See the single conic version above for the derivation.
+    const floatN cx = 0.5f * (min(min(x[0], x[1]), x[2]) + max(max(x[0], x[1]), x[2]));
+    const floatN cy = 0.5f * (min(min(y[0], y[1]), y[2]) + max(max(y[0], y[1]), y[2]));
+    for (int j = 0; j < 3; ++j) {
+        x[j] -= cx;
+        y[j] -= cy;
+    }
+    const floatN max_len = sqrt(max(x[0]*x[0] + y[0]*y[0],
+                                    max(x[1]*x[1] + y[1]*y[1], x[2]*x[2] + y[2]*y[2])));
+    const floatN dpx = -2*wN*x[1] + x[0] + x[2];
+    const floatN dpy = -2*wN*y[1] + y[0] + y[2];
+    const floatN dw = abs(-2 * wN + 2);
+    const floatN rp_minus_1 = max(floatN(0.f), max_len * precision - 1);
+    const floatN numer = sqrt(dpx*dpx + dpy*dpy) * precision + rp_minus_1 * dw;
+    const floatN denom = 4 * min(wN, floatN(1.f));
+    return numer / denom;
+}
+
 // Returns the value of Wang's formula specialized for a conic curve.
 AI float conic(float tolerance,
                const SkPoint pts[],
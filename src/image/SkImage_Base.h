@@ -116,6 +116,10 @@ public:
     virtual bool getROPixels(GrDirectContext*, SkBitmap*,
                              CachingHint = kAllow_CachingHint) const = 0;
 
+    // True if raster draws of this image should draw nothing for now, because its pixels are
+    // still being decoded in the background (see SkImages::PredecodeAsync()).
+    virtual bool skipRasterDraws() const { return false; }
+
     virtual sk_sp<SkImage> onMakeSubset(GrDirectContext*, const SkIRect&) const = 0;
 
     virtual sk_sp<SkData> onRefEncoded() const { return nullptr; }
@@ -10,6 +10,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageGenerator.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkSize.h"
@@ -120,13 +121,20 @@ bool SkImage_Lazy::getROPixels(GrDirectContext* ctx, SkBitmap* bitmap,
 
     if (SkImage::kAllow_CachingHint == chint) {
         SkPixmap pmap;
-        SkBitmapCache::RecPtr cacheRec = SkBitmapCache::Alloc(desc, this->imageInfo(), &pmap);
-        if (!cacheRec) {
-            return false;
-        }
+        SkBitmapCache::RecPtr cacheRec;
         bool success = false;
         {   // make sure ScopedGenerator goes out of scope before we try readPixelsProxy
-            success = ScopedGenerator(fSharedGenerator)->getPixels(pmap);
+            ScopedGenerator generator(fSharedGenerator);
+            // Another thread (e.g. a predecode()) may have cached the pixels while we waited.
+            if (SkBitmapCache::Find(desc, bitmap)) {
+                check_output_bitmap();
+                return true;
+            }
+            cacheRec = SkBitmapCache::Alloc(desc, this->imageInfo(), &pmap);
+            if (!cacheRec) {
+                return false;
+            }
+            success = generator->getPixels(pmap);
         }
         if (!success && !this->readPixelsProxy(ctx, pmap)) {
             return false;
@@ -272,10 +280,69 @@ sk_sp<SkCachedData> SkImage_Lazy::getPlanes(
     return data;
 }
 
+bool SkImage_Lazy::getPlanesInto(const SkYUVAPixmapInfo::SupportedDataTypes& supportedDataTypes,
+                                 const MakePlanesProc& makePlanes) const {
+    ScopedGenerator generator(fSharedGenerator);
+
+    SkYUVAPixmapInfo yuvaPixmapInfo;
+    if (!generator->queryYUVAInfo(supportedDataTypes, &yuvaPixmapInfo) ||
+        yuvaPixmapInfo.yuvaInfo().dimensions() != this->dimensions()) {
+        return false;
+    }
+    SkYUVAPixmaps pixmaps = makePlanes(yuvaPixmapInfo);
+    if (!pixmaps.isValid()) {
+        return false;
+    }
+    SkASSERT(pixmaps.yuvaInfo() == yuvaPixmapInfo.yuvaInfo());
+    return generator->getYUVAPlanes(pixmaps);
+}
+
 void SkImage_Lazy::addUniqueIDListener(sk_sp<SkIDChangeListener> listener) const {
     fUniqueIDListeners.add(std::move(listener));
 }
 
+void SkImage_Lazy::predecode(SkExecutor* executor,
+                             bool skipRasterDraws,
+                             std::function<void(bool)> done) const {
+    SkBitmap bitmap;
+    if (SkBitmapCache::Find(SkBitmapCacheDesc::Make(this), &bitmap)) {
+        if (done) {
+            done(true);
+        }
+        return;
+    }
+
+    {
+        SkAutoMutexExclusive lock(fPredecodeMutex);
+        if (done) {
+            fPredecodeDone.push_back(std::move(done));
+        }
+        if (skipRasterDraws) {
+            fSkipRasterDraws.store(true, std::memory_order_relaxed);
+        }
+        if (fPredecoding) {
+            return;
+        }
+        fPredecoding = true;
+    }
+
+    executor->add([self = sk_ref_sp(this)] {
+        SkBitmap bitmap;
+        bool success = self->getROPixels(nullptr, &bitmap, kAllow_CachingHint);
+
+        std::vector<std::function<void(bool)>> done;
+        {
+            SkAutoMutexExclusive lock(self->fPredecodeMutex);
+            self->fPredecoding = false;
+            self->fSkipRasterDraws.store(false, std::memory_order_relaxed);
+            done.swap(self->fPredecodeDone);
+        }
+        for (auto& fn : done) {
+            fn(success);
+        }
+    });
+}
+
 // TODO(kjlubick) move SharedGenerate to SkImage_Lazy.h and this to SkImage_LazyFactories
 namespace SkImages {
 
@@ -286,4 +353,20 @@ sk_sp<SkImage> DeferredFromGenerator(std::unique_ptr<SkImageGenerator> generator
     return validator ? sk_make_sp<SkImage_Lazy>(&validator) : nullptr;
 }
 
+void PredecodeAsync(sk_sp<SkImage> image,
+                    SkExecutor* executor,
+                    PredecodeDraws draws,
+                    std::function<void(bool)> done) {
+    SkASSERT(executor);
+    if (!image || !image->isLazyGenerated()) {
+        // Nothing to decode.
+        if (done) {
+            done(image != nullptr);
+        }
+        return;
+    }
+    static_cast<const SkImage_Lazy*>(image.get())->predecode(
+            executor, draws == PredecodeDraws::kSkip, std::move(done));
+}
+
 }  // namespace SkImages
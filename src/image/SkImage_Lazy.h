@@ -19,9 +19,12 @@
 #include "include/private/base/SkMutex.h"
 #include "src/image/SkImage_Base.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <vector>
 
 class GrDirectContext;
 class GrRecordingContext;
@@ -29,6 +32,7 @@ class SharedGenerator;
 class SkBitmap;
 class SkCachedData;
 class SkData;
+class SkExecutor;
 class SkPixmap;
 enum SkColorType : int;
 struct SkIRect;
@@ -70,6 +74,9 @@ public:
                                 RequiredProperties) const override;
 
     bool getROPixels(GrDirectContext*, SkBitmap*, CachingHint) const override;
+    bool skipRasterDraws() const override {
+        return fSkipRasterDraws.load(std::memory_order_relaxed);
+    }
     SkImage_Base::Type type() const override { return SkImage_Base::Type::kLazy; }
     sk_sp<SkImage> onMakeColorTypeAndColorSpace(SkColorType, sk_sp<SkColorSpace>,
                                                 GrDirectContext*) const override;
@@ -78,7 +85,16 @@ public:
     void addUniqueIDListener(sk_sp<SkIDChangeListener>) const;
     sk_sp<SkCachedData> getPlanes(const SkYUVAPixmapInfo::SupportedDataTypes& supportedDataTypes,
                                   SkYUVAPixmaps* pixmaps) const;
+    // Like getPlanes(), but decodes into memory owned by the caller rather than by the
+    // SkYUVPlanesCache, and doesn't look in or add to that cache. makePlanes is passed the planes
+    // the generator will decode and returns where to put them, or invalid SkYUVAPixmaps to give up.
+    using MakePlanesProc = std::function<SkYUVAPixmaps(const SkYUVAPixmapInfo&)>;
+    bool getPlanesInto(const SkYUVAPixmapInfo::SupportedDataTypes& supportedDataTypes,
+                       const MakePlanesProc& makePlanes) const;
 
+    // Decodes into the SkBitmapCache on executor, joining any decode already in flight.
+    // See SkImages::PredecodeAsync().
+    void predecode(SkExecutor*, bool skipRasterDraws, std::function<void(bool)> done) const;
 
     // Be careful with this. You need to acquire the mutex, as the generator might be shared
     // among several images.
@@ -102,6 +118,12 @@ private:
     // When the SkImage_Lazy goes away, we will iterate over all the listeners to inform them
     // of the unique ID's demise. This is used to remove cached textures from GrContext.
     mutable SkIDChangeListener::List fUniqueIDListeners;
+
+    // State of the predecode() in flight, if any.
+    mutable SkMutex fPredecodeMutex;
+    mutable bool fPredecoding SK_GUARDED_BY(fPredecodeMutex) = false;
+    mutable std::vector<std::function<void(bool)>> fPredecodeDone SK_GUARDED_BY(fPredecodeMutex);
+    mutable std::atomic<bool> fSkipRasterDraws{false};
 };
 
 // Ref-counted tuple(SkImageGenerator, SkMutex) which allows sharing one generator among N images
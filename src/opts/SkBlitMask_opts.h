@@ -8,10 +8,18 @@
 #ifndef SkBlitMask_opts_DEFINED
 #define SkBlitMask_opts_DEFINED
 
+#include "include/core/SkColor.h"
+#include "include/core/SkColorPriv.h"
+#include "include/private/SkColorData.h"
 #include "include/private/base/SkFeatures.h"
+#include "src/base/SkVx.h"
 #include "src/core/Sk4px.h"
 
-#if defined(SK_ARM_HAS_NEON)
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+    #include <immintrin.h>
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSE2
+    #include <emmintrin.h>
+#elif defined(SK_ARM_HAS_NEON)
     #include <arm_neon.h>
 #endif
 
@@ -233,6 +241,718 @@ namespace SK_OPTS_NS {
     }
 }
 
+static inline int upscale_31_to_32(int value) {
+    SkASSERT((unsigned)value <= 31);
+    return value + (value >> 4);
+}
+
+static inline int blend_32(int src, int dst, int scale) {
+    SkASSERT((unsigned)src <= 0xFF);
+    SkASSERT((unsigned)dst <= 0xFF);
+    SkASSERT((unsigned)scale <= 32);
+    return dst + ((src - dst) * scale >> 5);
+}
+
+static inline SkPMColor blend_lcd16(int srcA, int srcR, int srcG, int srcB,
+                                     SkPMColor dst, uint16_t mask) {
+    if (mask == 0) {
+        return dst;
+    }
+
+    /*  We want all of these in 5bits, hence the shifts in case one of them
+     *  (green) is 6bits.
+     */
+    int maskR = SkGetPackedR16(mask) >> (SK_R16_BITS - 5);
+    int maskG = SkGetPackedG16(mask) >> (SK_G16_BITS - 5);
+    int maskB = SkGetPackedB16(mask) >> (SK_B16_BITS - 5);
+
+    // Now upscale them to 0..32, so we can use blend32
+    maskR = upscale_31_to_32(maskR);
+    maskG = upscale_31_to_32(maskG);
+    maskB = upscale_31_to_32(maskB);
+
+    // srcA has been upscaled to 256 before passed into this function
+    maskR = maskR * srcA >> 8;
+    maskG = maskG * srcA >> 8;
+    maskB = maskB * srcA >> 8;
+
+    int dstR = SkGetPackedR32(dst);
+    int dstG = SkGetPackedG32(dst);
+    int dstB = SkGetPackedB32(dst);
+
+    // LCD blitting is only supported if the dst is known/required
+    // to be opaque
+    return SkPackARGB32(0xFF,
+                        blend_32(srcR, dstR, maskR),
+                        blend_32(srcG, dstG, maskG),
+                        blend_32(srcB, dstB, maskB));
+}
+
+static inline SkPMColor blend_lcd16_opaque(int srcR, int srcG, int srcB,
+                                           SkPMColor dst, uint16_t mask,
+                                           SkPMColor opaqueDst) {
+    if (mask == 0) {
+        return dst;
+    }
+
+    if (0xFFFF == mask) {
+        return opaqueDst;
+    }
+
+    /*  We want all of these in 5bits, hence the shifts in case one of them
+     *  (green) is 6bits.
+     */
+    int maskR = SkGetPackedR16(mask) >> (SK_R16_BITS - 5);
+    int maskG = SkGetPackedG16(mask) >> (SK_G16_BITS - 5);
+    int maskB = SkGetPackedB16(mask) >> (SK_B16_BITS - 5);
+
+    // Now upscale them to 0..32, so we can use blend32
+    maskR = upscale_31_to_32(maskR);
+    maskG = upscale_31_to_32(maskG);
+    maskB = upscale_31_to_32(maskB);
+
+    int dstR = SkGetPackedR32(dst);
+    int dstG = SkGetPackedG32(dst);
+    int dstB = SkGetPackedB32(dst);
+
+    // LCD blitting is only supported if the dst is known/required
+    // to be opaque
+    return SkPackARGB32(0xFF,
+                        blend_32(srcR, dstR, maskR),
+                        blend_32(srcG, dstG, maskG),
+                        blend_32(srcB, dstB, maskB));
+}
+
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSE2
+    // The following (left) shifts cause the top 5 bits of the mask components to
+    // line up with the corresponding components in an SkPMColor.
+    // Note that the mask's RGB16 order may differ from the SkPMColor order.
+    #define SK_R16x5_R32x5_SHIFT (SK_R32_SHIFT - SK_R16_SHIFT - SK_R16_BITS + 5)
+    #define SK_G16x5_G32x5_SHIFT (SK_G32_SHIFT - SK_G16_SHIFT - SK_G16_BITS + 5)
+    #define SK_B16x5_B32x5_SHIFT (SK_B32_SHIFT - SK_B16_SHIFT - SK_B16_BITS + 5)
+
+    #if SK_R16x5_R32x5_SHIFT == 0
+        #define SkPackedR16x5ToUnmaskedR32x5_SSE2(x) (x)
+    #elif SK_R16x5_R32x5_SHIFT > 0
+        #define SkPackedR16x5ToUnmaskedR32x5_SSE2(x) (_mm_slli_epi32(x, SK_R16x5_R32x5_SHIFT))
+    #else
+        #define SkPackedR16x5ToUnmaskedR32x5_SSE2(x) (_mm_srli_epi32(x, -SK_R16x5_R32x5_SHIFT))
+    #endif
+
+    #if SK_G16x5_G32x5_SHIFT == 0
+        #define SkPackedG16x5ToUnmaskedG32x5_SSE2(x) (x)
+    #elif SK_G16x5_G32x5_SHIFT > 0
+        #define SkPackedG16x5ToUnmaskedG32x5_SSE2(x) (_mm_slli_epi32(x, SK_G16x5_G32x5_SHIFT))
+    #else
+        #define SkPackedG16x5ToUnmaskedG32x5_SSE2(x) (_mm_srli_epi32(x, -SK_G16x5_G32x5_SHIFT))
+    #endif
+
+    #if SK_B16x5_B32x5_SHIFT == 0
+        #define SkPackedB16x5ToUnmaskedB32x5_SSE2(x) (x)
+    #elif SK_B16x5_B32x5_SHIFT > 0
+        #define SkPackedB16x5ToUnmaskedB32x5_SSE2(x) (_mm_slli_epi32(x, SK_B16x5_B32x5_SHIFT))
+    #else
+        #define SkPackedB16x5ToUnmaskedB32x5_SSE2(x) (_mm_srli_epi32(x, -SK_B16x5_B32x5_SHIFT))
+    #endif
+
+    static __m128i blend_lcd16_sse2(__m128i &src, __m128i &dst, __m128i &mask, __m128i &srcA) {
+        // In the following comments, the components of src, dst and mask are
+        // abbreviated as (s)rc, (d)st, and (m)ask. Color components are marked
+        // by an R, G, B, or A suffix. Components of one of the four pixels that
+        // are processed in parallel are marked with 0, 1, 2, and 3. "d1B", for
+        // example is the blue channel of the second destination pixel. Memory
+        // layout is shown for an ARGB byte order in a color value.
+
+        // src and srcA store 8-bit values interleaved with zeros.
+        // src  = (0xFF, 0, sR, 0, sG, 0, sB, 0, 0xFF, 0, sR, 0, sG, 0, sB, 0)
+        // srcA = (srcA, 0, srcA, 0, srcA, 0, srcA, 0,
+        //         srcA, 0, srcA, 0, srcA, 0, srcA, 0)
+        // mask stores 16-bit values (compressed three channels) interleaved with zeros.
+        // Lo and Hi denote the low and high bytes of a 16-bit value, respectively.
+        // mask = (m0RGBLo, m0RGBHi, 0, 0, m1RGBLo, m1RGBHi, 0, 0,
+        //         m2RGBLo, m2RGBHi, 0, 0, m3RGBLo, m3RGBHi, 0, 0)
+
+        // Get the R,G,B of each 16bit mask pixel, we want all of them in 5 bits.
+        // r = (0, m0R, 0, 0, 0, m1R, 0, 0, 0, m2R, 0, 0, 0, m3R, 0, 0)
+        __m128i r = _mm_and_si128(SkPackedR16x5ToUnmaskedR32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_R32_SHIFT));
+
+        // g = (0, 0, m0G, 0, 0, 0, m1G, 0, 0, 0, m2G, 0, 0, 0, m3G, 0)
+        __m128i g = _mm_and_si128(SkPackedG16x5ToUnmaskedG32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_G32_SHIFT));
+
+        // b = (0, 0, 0, m0B, 0, 0, 0, m1B, 0, 0, 0, m2B, 0, 0, 0, m3B)
+        __m128i b = _mm_and_si128(SkPackedB16x5ToUnmaskedB32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_B32_SHIFT));
+
+        // Pack the 4 16bit mask pixels into 4 32bit pixels, (p0, p1, p2, p3)
+        // Each component (m0R, m0G, etc.) is then a 5-bit value aligned to an
+        // 8-bit position
+        // mask = (0, m0R, m0G, m0B, 0, m1R, m1G, m1B,
+        //         0, m2R, m2G, m2B, 0, m3R, m3G, m3B)
+        mask = _mm_or_si128(_mm_or_si128(r, g), b);
+
+        // Interleave R,G,B into the lower byte of word.
+        // i.e. split the sixteen 8-bit values from mask into two sets of eight
+        // 16-bit values, padded by zero.
+        __m128i maskLo, maskHi;
+        // maskLo = (0, 0, m0R, 0, m0G, 0, m0B, 0, 0, 0, m1R, 0, m1G, 0, m1B, 0)
+        maskLo = _mm_unpacklo_epi8(mask, _mm_setzero_si128());
+        // maskHi = (0, 0, m2R, 0, m2G, 0, m2B, 0, 0, 0, m3R, 0, m3G, 0, m3B, 0)
+        maskHi = _mm_unpackhi_epi8(mask, _mm_setzero_si128());
+
+        // Upscale from 0..31 to 0..32
+        // (allows to replace division by left-shift further down)
+        // Left-shift each component by 4 and add the result back to that component,
+        // mapping numbers in the range 0..15 to 0..15, and 16..31 to 17..32
+        maskLo = _mm_add_epi16(maskLo, _mm_srli_epi16(maskLo, 4));
+        maskHi = _mm_add_epi16(maskHi, _mm_srli_epi16(maskHi, 4));
+
+        // Multiply each component of maskLo and maskHi by srcA
+        maskLo = _mm_mullo_epi16(maskLo, srcA);
+        maskHi = _mm_mullo_epi16(maskHi, srcA);
+
+        // Left shift mask components by 8 (divide by 256)
+        maskLo = _mm_srli_epi16(maskLo, 8);
+        maskHi = _mm_srli_epi16(maskHi, 8);
+
+        // Interleave R,G,B into the lower byte of the word
+        // dstLo = (0, 0, d0R, 0, d0G, 0, d0B, 0, 0, 0, d1R, 0, d1G, 0, d1B, 0)
+        __m128i dstLo = _mm_unpacklo_epi8(dst, _mm_setzero_si128());
+        // dstLo = (0, 0, d2R, 0, d2G, 0, d2B, 0, 0, 0, d3R, 0, d3G, 0, d3B, 0)
+        __m128i dstHi = _mm_unpackhi_epi8(dst, _mm_setzero_si128());
+
+        // mask = (src - dst) * mask
+        maskLo = _mm_mullo_epi16(maskLo, _mm_sub_epi16(src, dstLo));
+        maskHi = _mm_mullo_epi16(maskHi, _mm_sub_epi16(src, dstHi));
+
+        // mask = (src - dst) * mask >> 5
+        maskLo = _mm_srai_epi16(maskLo, 5);
+        maskHi = _mm_srai_epi16(maskHi, 5);
+
+        // Add two pixels into result.
+        // result = dst + ((src - dst) * mask >> 5)
+        __m128i resultLo = _mm_add_epi16(dstLo, maskLo);
+        __m128i resultHi = _mm_add_epi16(dstHi, maskHi);
+
+        // Pack into 4 32bit dst pixels.
+        // resultLo and resultHi contain eight 16-bit components (two pixels) each.
+        // Merge into one SSE regsiter with sixteen 8-bit values (four pixels),
+        // clamping to 255 if necessary.
+        return _mm_packus_epi16(resultLo, resultHi);
+    }
+
+    static __m128i blend_lcd16_opaque_sse2(__m128i &src, __m128i &dst, __m128i &mask) {
+        // In the following comments, the components of src, dst and mask are
+        // abbreviated as (s)rc, (d)st, and (m)ask. Color components are marked
+        // by an R, G, B, or A suffix. Components of one of the four pixels that
+        // are processed in parallel are marked with 0, 1, 2, and 3. "d1B", for
+        // example is the blue channel of the second destination pixel. Memory
+        // layout is shown for an ARGB byte order in a color value.
+
+        // src and srcA store 8-bit values interleaved with zeros.
+        // src  = (0xFF, 0, sR, 0, sG, 0, sB, 0, 0xFF, 0, sR, 0, sG, 0, sB, 0)
+        // mask stores 16-bit values (shown as high and low bytes) interleaved with
+        // zeros
+        // mask = (m0RGBLo, m0RGBHi, 0, 0, m1RGBLo, m1RGBHi, 0, 0,
+        //         m2RGBLo, m2RGBHi, 0, 0, m3RGBLo, m3RGBHi, 0, 0)
+
+        // Get the R,G,B of each 16bit mask pixel, we want all of them in 5 bits.
+        // r = (0, m0R, 0, 0, 0, m1R, 0, 0, 0, m2R, 0, 0, 0, m3R, 0, 0)
+        __m128i r = _mm_and_si128(SkPackedR16x5ToUnmaskedR32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_R32_SHIFT));
+
+        // g = (0, 0, m0G, 0, 0, 0, m1G, 0, 0, 0, m2G, 0, 0, 0, m3G, 0)
+        __m128i g = _mm_and_si128(SkPackedG16x5ToUnmaskedG32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_G32_SHIFT));
+
+        // b = (0, 0, 0, m0B, 0, 0, 0, m1B, 0, 0, 0, m2B, 0, 0, 0, m3B)
+        __m128i b = _mm_and_si128(SkPackedB16x5ToUnmaskedB32x5_SSE2(mask),
+                                  _mm_set1_epi32(0x1F << SK_B32_SHIFT));
+
+        // Pack the 4 16bit mask pixels into 4 32bit pixels, (p0, p1, p2, p3)
+        // Each component (m0R, m0G, etc.) is then a 5-bit value aligned to an
+        // 8-bit position
+        // mask = (0, m0R, m0G, m0B, 0, m1R, m1G, m1B,
+        //         0, m2R, m2G, m2B, 0, m3R, m3G, m3B)
+        mask = _mm_or_si128(_mm_or_si128(r, g), b);
+
+        // Interleave R,G,B into the lower byte of word.
+        // i.e. split the sixteen 8-bit values from mask into two sets of eight
+        // 16-bit values, padded by zero.
+        __m128i maskLo, maskHi;
+        // maskLo = (0, 0, m0R, 0, m0G, 0, m0B, 0, 0, 0, m1R, 0, m1G, 0, m1B, 0)
+        maskLo = _mm_unpacklo_epi8(mask, _mm_setzero_si128());
+        // maskHi = (0, 0, m2R, 0, m2G, 0, m2B, 0, 0, 0, m3R, 0, m3G, 0, m3B, 0)
+        maskHi = _mm_unpackhi_epi8(mask, _mm_setzero_si128());
+
+        // Upscale from 0..31 to 0..32
+        // (allows to replace division by left-shift further down)
+        // Left-shift each component by 4 and add the result back to that component,
+        // mapping numbers in the range 0..15 to 0..15, and 16..31 to 17..32
+        maskLo = _mm_add_epi16(maskLo, _mm_srli_epi16(maskLo, 4));
+        maskHi = _mm_add_epi16(maskHi, _mm_srli_epi16(maskHi, 4));
+
+        // Interleave R,G,B into the lower byte of the word
+        // dstLo = (0, 0, d0R, 0, d0G, 0, d0B, 0, 0, 0, d1R, 0, d1G, 0, d1B, 0)
+        __m128i dstLo = _mm_unpacklo_epi8(dst, _mm_setzero_si128());
+        // dstLo = (0, 0, d2R, 0, d2G, 0, d2B, 0, 0, 0, d3R, 0, d3G, 0, d3B, 0)
+        __m128i dstHi = _mm_unpackhi_epi8(dst, _mm_setzero_si128());
+
+        // mask = (src - dst) * mask
+        maskLo = _mm_mullo_epi16(maskLo, _mm_sub_epi16(src, dstLo));
+        maskHi = _mm_mullo_epi16(maskHi, _mm_sub_epi16(src, dstHi));
+
+        // mask = (src - dst) * mask >> 5
+        maskLo = _mm_srai_epi16(maskLo, 5);
+        maskHi = _mm_srai_epi16(maskHi, 5);
+
+        // Add two pixels into result.
+        // result = dst + ((src - dst) * mask >> 5)
+        __m128i resultLo = _mm_add_epi16(dstLo, maskLo);
+        __m128i resultHi = _mm_add_epi16(dstHi, maskHi);
+
+        // Pack into 4 32bit dst pixels and force opaque.
+        // resultLo and resultHi contain eight 16-bit components (two pixels) each.
+        // Merge into one SSE regsiter with sixteen 8-bit values (four pixels),
+        // clamping to 255 if necessary. Set alpha components to 0xFF.
+        return _mm_or_si128(_mm_packus_epi16(resultLo, resultHi),
+                            _mm_set1_epi32(SK_A32_MASK << SK_A32_SHIFT));
+    }
+#endif
+
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+    template <int kShift>
+    static inline __m256i shift_lcd16_avx2(__m256i x) {
+        if constexpr (kShift > 0) {
+            return _mm256_slli_epi32(x, kShift);
+        } else if constexpr (kShift < 0) {
+            return _mm256_srli_epi32(x, -kShift);
+        }
+        return x;
+    }
+
+    // blend_lcd16_sse2() and blend_lcd16_opaque_sse2(), eight pixels at a time. The unpacks and
+    // the final pack all work within 128-bit lanes, so the pixels come back out in order.
+    // srcA is ignored when kOpaque is true.
+    template <bool kOpaque>
+    static inline __m256i blend_lcd16_avx2(__m256i src, __m256i dst, __m256i mask, __m256i srcA) {
+        // Line each 5-bit mask component up with its channel in an SkPMColor.
+        mask = _mm256_or_si256(
+                _mm256_or_si256(
+                    _mm256_and_si256(shift_lcd16_avx2<SK_R16x5_R32x5_SHIFT>(mask),
+                                     _mm256_set1_epi32(0x1F << SK_R32_SHIFT)),
+                    _mm256_and_si256(shift_lcd16_avx2<SK_G16x5_G32x5_SHIFT>(mask),
+                                     _mm256_set1_epi32(0x1F << SK_G32_SHIFT))),
+                _mm256_and_si256(shift_lcd16_avx2<SK_B16x5_B32x5_SHIFT>(mask),
+                                 _mm256_set1_epi32(0x1F << SK_B32_SHIFT)));
+
+        __m256i maskLo = _mm256_unpacklo_epi8(mask, _mm256_setzero_si256()),
+                maskHi = _mm256_unpackhi_epi8(mask, _mm256_setzero_si256());
+
+        // Upscale from 0..31 to 0..32.
+        maskLo = _mm256_add_epi16(maskLo, _mm256_srli_epi16(maskLo, 4));
+        maskHi = _mm256_add_epi16(maskHi, _mm256_srli_epi16(maskHi, 4));
+
+        if (!kOpaque) {
+            maskLo = _mm256_srli_epi16(_mm256_mullo_epi16(maskLo, srcA), 8);
+            maskHi = _mm256_srli_epi16(_mm256_mullo_epi16(maskHi, srcA), 8);
+        }
+
+        const __m256i dstLo = _mm256_unpacklo_epi8(dst, _mm256_setzero_si256()),
+                      dstHi = _mm256_unpackhi_epi8(dst, _mm256_setzero_si256());
+
+        // result = dst + ((src - dst) * mask >> 5)
+        maskLo = _mm256_srai_epi16(_mm256_mullo_epi16(maskLo, _mm256_sub_epi16(src, dstLo)), 5);
+        maskHi = _mm256_srai_epi16(_mm256_mullo_epi16(maskHi, _mm256_sub_epi16(src, dstHi)), 5);
+
+        return _mm256_or_si256(_mm256_packus_epi16(_mm256_add_epi16(dstLo, maskLo),
+                                                   _mm256_add_epi16(dstHi, maskHi)),
+                               _mm256_set1_epi32(SK_A32_MASK << SK_A32_SHIFT));
+    }
+
+    template <bool kOpaque>
+    static void blit_row_lcd16_avx2(SkPMColor dst[], const uint16_t mask[],
+                                    SkColor color, int width, SkPMColor opaqueDst) {
+        const int srcA = SkAlpha255To256(SkColorGetA(color)),
+                  srcR = SkColorGetR(color),
+                  srcG = SkColorGetG(color),
+                  srcB = SkColorGetB(color);
+
+        // As in the SSE2 code, set alpha to 0xFF and interleave the source with zeros.
+        const __m256i src_avx  = _mm256_unpacklo_epi8(
+                                         _mm256_set1_epi32(SkPackARGB32(0xFF, srcR, srcG, srcB)),
+                                         _mm256_setzero_si256()),
+                      srcA_avx = _mm256_set1_epi16(srcA);
+
+        for (; width >= 8; dst += 8, mask += 8, width -= 8) {
+            const __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(mask));
+            if (_mm_testz_si128(m, m)) {
+                continue;
+            }
+            if (kOpaque && _mm_movemask_epi8(_mm_cmpeq_epi16(m, _mm_set1_epi16(-1))) == 0xFFFF) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm256_set1_epi32(opaqueDst));
+                continue;
+            }
+            __m256i* d = reinterpret_cast<__m256i*>(dst);
+            _mm256_storeu_si256(d, blend_lcd16_avx2<kOpaque>(src_avx, _mm256_loadu_si256(d),
+                                                             _mm256_cvtepu16_epi32(m), srcA_avx));
+        }
+
+        // Glyphs are narrow, so it's worth finishing up four pixels at a time too. The low lanes
+        // of src_avx and srcA_avx are just what the SSE2 code expects.
+        if (width >= 4) {
+            __m128i mask_sse = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask));
+            if (!_mm_testz_si128(mask_sse, mask_sse)) {
+                __m128i src_sse  = _mm256_castsi256_si128(src_avx),
+                        srcA_sse = _mm256_castsi256_si128(srcA_avx),
+                        dst_sse  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst));
+                mask_sse = _mm_cvtepu16_epi32(mask_sse);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                                 kOpaque ? blend_lcd16_opaque_sse2(src_sse, dst_sse, mask_sse)
+                                         : blend_lcd16_sse2(src_sse, dst_sse, mask_sse, srcA_sse));
+            }
+            dst   += 4;
+            mask  += 4;
+            width -= 4;
+        }
+
+        for (int i = 0; i < width; i++) {
+            dst[i] = kOpaque ? blend_lcd16_opaque(srcR, srcG, srcB, dst[i], mask[i], opaqueDst)
+                             : blend_lcd16(srcA, srcR, srcG, srcB, dst[i], mask[i]);
+        }
+    }
+
+    static void blit_row_lcd16(SkPMColor dst[], const uint16_t mask[],
+                               SkColor color, int width, SkPMColor opaqueDst) {
+        blit_row_lcd16_avx2<false>(dst, mask, color, width, opaqueDst);
+    }
+
+    static void blit_row_lcd16_opaque(SkPMColor dst[], const uint16_t mask[],
+                                      SkColor color, int width, SkPMColor opaqueDst) {
+        blit_row_lcd16_avx2<true>(dst, mask, color, width, opaqueDst);
+    }
+
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSE2
+    static void blit_row_lcd16(SkPMColor dst[], const uint16_t mask[],
+                               SkColor src, int width, SkPMColor) {
+        if (width <= 0) {
+            return;
+        }
+
+        int srcA = SkColorGetA(src);
+        int srcR = SkColorGetR(src);
+        int srcG = SkColorGetG(src);
+        int srcB = SkColorGetB(src);
+
+        srcA = SkAlpha255To256(srcA);
+
+        if (width >= 4) {
+            SkASSERT(((size_t)dst & 0x03) == 0);
+            while (((size_t)dst & 0x0F) != 0) {
+                *dst = blend_lcd16(srcA, srcR, srcG, srcB, *dst, *mask);
+                mask++;
+                dst++;
+                width--;
+            }
+
+            __m128i *d = reinterpret_cast<__m128i*>(dst);
+            // Set alpha to 0xFF and replicate source four times in SSE register.
+            __m128i src_sse = _mm_set1_epi32(SkPackARGB32(0xFF, srcR, srcG, srcB));
+            // Interleave with zeros to get two sets of four 16-bit values.
+            src_sse = _mm_unpacklo_epi8(src_sse, _mm_setzero_si128());
+            // Set srcA_sse to contain eight copies of srcA, padded with zero.
+            // src_sse=(0xFF, 0, sR, 0, sG, 0, sB, 0, 0xFF, 0, sR, 0, sG, 0, sB, 0)
+            __m128i srcA_sse = _mm_set1_epi16(srcA);
+            while (width >= 4) {
+                // Load four destination pixels into dst_sse.
+                __m128i dst_sse = _mm_load_si128(d);
+                // Load four 16-bit masks into lower half of mask_sse.
+                __m128i mask_sse = _mm_loadl_epi64(
+                                       reinterpret_cast<const __m128i*>(mask));
+
+                // Check whether masks are equal to 0 and get the highest bit
+                // of each byte of result, if masks are all zero, we will get
+                // pack_cmp to 0xFFFF
+                int pack_cmp = _mm_movemask_epi8(_mm_cmpeq_epi16(mask_sse,
+                                                 _mm_setzero_si128()));
+
+                // if mask pixels are not all zero, we will blend the dst pixels
+                if (pack_cmp != 0xFFFF) {
+                    // Unpack 4 16bit mask pixels to
+                    // mask_sse = (m0RGBLo, m0RGBHi, 0, 0, m1RGBLo, m1RGBHi, 0, 0,
+                    //             m2RGBLo, m2RGBHi, 0, 0, m3RGBLo, m3RGBHi, 0, 0)
+                    mask_sse = _mm_unpacklo_epi16(mask_sse,
+                                                  _mm_setzero_si128());
+
+                    // Process 4 32bit dst pixels
+                    __m128i result = blend_lcd16_sse2(src_sse, dst_sse, mask_sse, srcA_sse);
+                    _mm_store_si128(d, result);
+                }
+
+                d++;
+                mask += 4;
+                width -= 4;
+            }
+
+            dst = reinterpret_cast<SkPMColor*>(d);
+        }
+
+        while (width > 0) {
+            *dst = blend_lcd16(srcA, srcR, srcG, srcB, *dst, *mask);
+            mask++;
+            dst++;
+            width--;
+        }
+    }
+
+    static void blit_row_lcd16_opaque(SkPMColor dst[], const uint16_t mask[],
+                                      SkColor src, int width, SkPMColor opaqueDst) {
+        if (width <= 0) {
+            return;
+        }
+
+        int srcR = SkColorGetR(src);
+        int srcG = SkColorGetG(src);
+        int srcB = SkColorGetB(src);
+
+        if (width >= 4) {
+            SkASSERT(((size_t)dst & 0x03) == 0);
+            while (((size_t)dst & 0x0F) != 0) {
+                *dst = blend_lcd16_opaque(srcR, srcG, srcB, *dst, *mask, opaqueDst);
+                mask++;
+                dst++;
+                width--;
+            }
+
+            __m128i *d = reinterpret_cast<__m128i*>(dst);
+            // Set alpha to 0xFF and replicate source four times in SSE register.
+            __m128i src_sse = _mm_set1_epi32(SkPackARGB32(0xFF, srcR, srcG, srcB));
+            // Set srcA_sse to contain eight copies of srcA, padded with zero.
+            // src_sse=(0xFF, 0, sR, 0, sG, 0, sB, 0, 0xFF, 0, sR, 0, sG, 0, sB, 0)
+            src_sse = _mm_unpacklo_epi8(src_sse, _mm_setzero_si128());
+            while (width >= 4) {
+                // Load four destination pixels into dst_sse.
+                __m128i dst_sse = _mm_load_si128(d);
+                // Load four 16-bit masks into lower half of mask_sse.
+                __m128i mask_sse = _mm_loadl_epi64(
+                                       reinterpret_cast<const __m128i*>(mask));
+
+                // Check whether masks are equal to 0 and get the highest bit
+                // of each byte of result, if masks are all zero, we will get
+                // pack_cmp to 0xFFFF
+                int pack_cmp = _mm_movemask_epi8(_mm_cmpeq_epi16(mask_sse,
+                                                 _mm_setzero_si128()));
+
+                // if mask pixels are not all zero, we will blend the dst pixels
+                if (pack_cmp != 0xFFFF) {
+                    // Unpack 4 16bit mask pixels to
+                    // mask_sse = (m0RGBLo, m0RGBHi, 0, 0, m1RGBLo, m1RGBHi, 0, 0,
+                    //             m2RGBLo, m2RGBHi, 0, 0, m3RGBLo, m3RGBHi, 0, 0)
+                    mask_sse = _mm_unpacklo_epi16(mask_sse,
+                                                  _mm_setzero_si128());
+
+                    // Process 4 32bit dst pixels
+                    __m128i result = blend_lcd16_opaque_sse2(src_sse, dst_sse, mask_sse);
+                    _mm_store_si128(d, result);
+                }
+
+                d++;
+                mask += 4;
+                width -= 4;
+            }
+
+            dst = reinterpret_cast<SkPMColor*>(d);
+        }
+
+        while (width > 0) {
+            *dst = blend_lcd16_opaque(srcR, srcG, srcB, *dst, *mask, opaqueDst);
+            mask++;
+            dst++;
+            width--;
+        }
+    }
+
+#elif defined(SK_ARM_HAS_NEON)
+    static inline uint8x8_t blend_32_neon(uint8x8_t src, uint8x8_t dst, uint16x8_t scale) {
+        int16x8_t src_wide, dst_wide;
+
+        src_wide = vreinterpretq_s16_u16(vmovl_u8(src));
+        dst_wide = vreinterpretq_s16_u16(vmovl_u8(dst));
+
+        src_wide = (src_wide - dst_wide) * vreinterpretq_s16_u16(scale);
+
+        dst_wide += vshrq_n_s16(src_wide, 5);
+
+        return vmovn_u16(vreinterpretq_u16_s16(dst_wide));
+    }
+
+    static void blit_row_lcd16_opaque(SkPMColor dst[], const uint16_t src[],
+                                      SkColor color, int width,
+                                      SkPMColor opaqueDst) {
+        int colR = SkColorGetR(color);
+        int colG = SkColorGetG(color);
+        int colB = SkColorGetB(color);
+
+        uint8x8_t vcolR = vdup_n_u8(colR);
+        uint8x8_t vcolG = vdup_n_u8(colG);
+        uint8x8_t vcolB = vdup_n_u8(colB);
+        uint8x8_t vopqDstA = vdup_n_u8(SkGetPackedA32(opaqueDst));
+        uint8x8_t vopqDstR = vdup_n_u8(SkGetPackedR32(opaqueDst));
+        uint8x8_t vopqDstG = vdup_n_u8(SkGetPackedG32(opaqueDst));
+        uint8x8_t vopqDstB = vdup_n_u8(SkGetPackedB32(opaqueDst));
+
+        while (width >= 8) {
+            uint8x8x4_t vdst;
+            uint16x8_t vmask;
+            uint16x8_t vmaskR, vmaskG, vmaskB;
+            uint8x8_t vsel_trans, vsel_opq;
+
+            vdst = vld4_u8((uint8_t*)dst);
+            vmask = vld1q_u16(src);
+
+            // Prepare compare masks
+            vsel_trans = vmovn_u16(vceqq_u16(vmask, vdupq_n_u16(0)));
+            vsel_opq = vmovn_u16(vceqq_u16(vmask, vdupq_n_u16(0xFFFF)));
+
+            // Get all the color masks on 5 bits
+            vmaskR = vshrq_n_u16(vmask, SK_R16_SHIFT);
+            vmaskG = vshrq_n_u16(vshlq_n_u16(vmask, SK_R16_BITS),
+                                 SK_B16_BITS + SK_R16_BITS + 1);
+            vmaskB = vmask & vdupq_n_u16(SK_B16_MASK);
+
+            // Upscale to 0..32
+            vmaskR = vmaskR + vshrq_n_u16(vmaskR, 4);
+            vmaskG = vmaskG + vshrq_n_u16(vmaskG, 4);
+            vmaskB = vmaskB + vshrq_n_u16(vmaskB, 4);
+
+            vdst.val[NEON_A] = vbsl_u8(vsel_trans, vdst.val[NEON_A], vdup_n_u8(0xFF));
+            vdst.val[NEON_A] = vbsl_u8(vsel_opq, vopqDstA, vdst.val[NEON_A]);
+
+            vdst.val[NEON_R] = blend_32_neon(vcolR, vdst.val[NEON_R], vmaskR);
+            vdst.val[NEON_G] = blend_32_neon(vcolG, vdst.val[NEON_G], vmaskG);
+            vdst.val[NEON_B] = blend_32_neon(vcolB, vdst.val[NEON_B], vmaskB);
+
+            vdst.val[NEON_R] = vbsl_u8(vsel_opq, vopqDstR, vdst.val[NEON_R]);
+            vdst.val[NEON_G] = vbsl_u8(vsel_opq, vopqDstG, vdst.val[NEON_G]);
+            vdst.val[NEON_B] = vbsl_u8(vsel_opq, vopqDstB, vdst.val[NEON_B]);
+
+            vst4_u8((uint8_t*)dst, vdst);
+
+            dst += 8;
+            src += 8;
+            width -= 8;
+        }
+
+        // Leftovers
+        for (int i = 0; i < width; i++) {
+            dst[i] = blend_lcd16_opaque(colR, colG, colB, dst[i], src[i], opaqueDst);
+        }
+    }
+
+    static void blit_row_lcd16(SkPMColor dst[], const uint16_t src[],
+                               SkColor color, int width, SkPMColor) {
+        int colA = SkColorGetA(color);
+        int colR = SkColorGetR(color);
+        int colG = SkColorGetG(color);
+        int colB = SkColorGetB(color);
+
+        colA = SkAlpha255To256(colA);
+
+        uint16x8_t vcolA = vdupq_n_u16(colA);
+        uint8x8_t vcolR = vdup_n_u8(colR);
+        uint8x8_t vcolG = vdup_n_u8(colG);
+        uint8x8_t vcolB = vdup_n_u8(colB);
+
+        while (width >= 8) {
+            uint8x8x4_t vdst;
+            uint16x8_t vmask;
+            uint16x8_t vmaskR, vmaskG, vmaskB;
+
+            vdst = vld4_u8((uint8_t*)dst);
+            vmask = vld1q_u16(src);
+
+            // Get all the color masks on 5 bits
+            vmaskR = vshrq_n_u16(vmask, SK_R16_SHIFT);
+            vmaskG = vshrq_n_u16(vshlq_n_u16(vmask, SK_R16_BITS),
+                                 SK_B16_BITS + SK_R16_BITS + 1);
+            vmaskB = vmask & vdupq_n_u16(SK_B16_MASK);
+
+            // Upscale to 0..32
+            vmaskR = vmaskR + vshrq_n_u16(vmaskR, 4);
+            vmaskG = vmaskG + vshrq_n_u16(vmaskG, 4);
+            vmaskB = vmaskB + vshrq_n_u16(vmaskB, 4);
+
+            vmaskR = vshrq_n_u16(vmaskR * vcolA, 8);
+            vmaskG = vshrq_n_u16(vmaskG * vcolA, 8);
+            vmaskB = vshrq_n_u16(vmaskB * vcolA, 8);
+
+            vdst.val[NEON_A] = vdup_n_u8(0xFF);
+            vdst.val[NEON_R] = blend_32_neon(vcolR, vdst.val[NEON_R], vmaskR);
+            vdst.val[NEON_G] = blend_32_neon(vcolG, vdst.val[NEON_G], vmaskG);
+            vdst.val[NEON_B] = blend_32_neon(vcolB, vdst.val[NEON_B], vmaskB);
+
+            vst4_u8((uint8_t*)dst, vdst);
+
+            dst += 8;
+            src += 8;
+            width -= 8;
+        }
+
+        for (int i = 0; i < width; i++) {
+            dst[i] = blend_lcd16(colA, colR, colG, colB, dst[i], src[i]);
+        }
+    }
+
+#else
+    static inline void blit_row_lcd16(SkPMColor dst[], const uint16_t mask[],
+                                      SkColor src, int width, SkPMColor) {
+        int srcA = SkColorGetA(src);
+        int srcR = SkColorGetR(src);
+        int srcG = SkColorGetG(src);
+        int srcB = SkColorGetB(src);
+
+        srcA = SkAlpha255To256(srcA);
+
+        for (int i = 0; i < width; i++) {
+            dst[i] = blend_lcd16(srcA, srcR, srcG, srcB, dst[i], mask[i]);
+        }
+    }
+
+    static inline void blit_row_lcd16_opaque(SkPMColor dst[], const uint16_t mask[],
+                                             SkColor src, int width,
+                                             SkPMColor opaqueDst) {
+        int srcR = SkColorGetR(src);
+        int srcG = SkColorGetG(src);
+        int srcB = SkColorGetB(src);
+
+        for (int i = 0; i < width; i++) {
+            dst[i] = blend_lcd16_opaque(srcR, srcG, srcB, dst[i], mask[i], opaqueDst);
+        }
+    }
+
+#endif
+
+// LCD16 masks carry a separate coverage for each of R, G, and B, and are only drawn over opaque
+// destinations.
+/*not static*/ inline void blit_mask_d32_lcd16(SkPMColor* dst, size_t dstRB,
+                                               const uint16_t* mask, size_t maskRB,
+                                               SkColor color, int w, int h) {
+    auto blit_row = blit_row_lcd16;
+    SkPMColor opaqueDst = 0;  // ignored unless opaque
+
+    if (0xff == SkColorGetA(color)) {
+        blit_row  = blit_row_lcd16_opaque;
+        opaqueDst = SkPreMultiplyColor(color);
+    }
+
+    while (h --> 0) {
+        blit_row(dst, mask, color, w, opaqueDst);
+        dst  = (SkPMColor*)     ((      char*)dst  + dstRB);
+        mask = (const uint16_t*)((const char*)mask + maskRB);
+    }
+}
+
 }  // namespace SK_OPTS_NS
 
 #endif//SkBlitMask_opts_DEFINED
@@ -59,6 +59,8 @@ using NoCtx = const void*;
     #define JUMPER_IS_SCALAR
 #elif defined(SK_ARM_HAS_NEON)
     #define JUMPER_IS_NEON
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SKX
+    #define JUMPER_IS_SKX
 #elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
     #define JUMPER_IS_HSW
 #elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX
@@ -461,6 +463,165 @@ namespace SK_OPTS_NS {
         _mm256_storeu_ps(ptr+24, _67);
     }
 
+#elif defined(JUMPER_IS_SKX)
+    // These are __m512 and __m512i, but friendlier and strongly-typed.
+    template <typename T> using V = T __attribute__((ext_vector_type(16)));
+    using F   = V<float   >;
+    using I32 = V< int32_t>;
+    using U64 = V<uint64_t>;
+    using U32 = V<uint32_t>;
+    using U16 = V<uint16_t>;
+    using U8  = V<uint8_t >;
+
+    SI F   mad(F f, F m, F a) { return _mm512_fmadd_ps(f, m, a); }
+
+    SI F   min(F a, F b)     { return _mm512_min_ps(a,b); }
+    SI I32 min(I32 a, I32 b) { return (I32)_mm512_min_epi32((__m512i)a, (__m512i)b); }
+    SI U32 min(U32 a, U32 b) { return (U32)_mm512_min_epu32((__m512i)a, (__m512i)b); }
+    SI F   max(F a, F b)     { return _mm512_max_ps(a,b); }
+    SI I32 max(I32 a, I32 b) { return (I32)_mm512_max_epi32((__m512i)a, (__m512i)b); }
+    SI U32 max(U32 a, U32 b) { return (U32)_mm512_max_epu32((__m512i)a, (__m512i)b); }
+
+    SI F   abs_  (F v)       { return _mm512_and_ps(v, 0-v); }
+    SI I32 abs_  (I32 v)     { return (I32)_mm512_abs_epi32((__m512i)v); }
+    SI F   floor_(F v)       { return _mm512_floor_ps(v);    }
+    SI F   ceil_(F v)        { return _mm512_ceil_ps(v);     }
+    SI F   rcp_approx(F v)   { return _mm512_rcp14_ps  (v);  }  // use rcp_fast instead
+    SI F   rsqrt_approx(F v) { return _mm512_rsqrt14_ps(v);  }
+    SI F   sqrt_ (F v)       { return _mm512_sqrt_ps (v);    }
+    SI F   rcp_precise (F v) {
+        F e = rcp_approx(v);
+        return _mm512_fnmadd_ps(v, e, _mm512_set1_ps(2.0f)) * e;
+    }
+
+    SI U32 round(F v)          { return (U32)_mm512_cvtps_epi32(v); }
+    SI U32 round(F v, F scale) { return (U32)_mm512_cvtps_epi32(v*scale); }
+    SI U16 pack(U32 v) {
+        // _mm256_packus_epi32() interleaves 128-bit lanes: 0-3 8-11 | 4-7 12-15. Put them back.
+        __m256i _048C_159D = _mm256_packus_epi32(_mm512_castsi512_si256((__m512i)v),
+                                                 _mm512_extracti64x4_epi64((__m512i)v, 1));
+        return (U16)_mm256_permute4x64_epi64(_048C_159D, 0xd8);
+    }
+    SI U8 pack(U16 v) {
+        // As above, _mm256_packus_epi16() leaves the low 8 and high 8 bytes in 64-bit blocks 0 and 2.
+        __m256i packed = _mm256_packus_epi16((__m256i)v, (__m256i)v);
+        return (U8)_mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0x08));
+    }
+
+    SI F if_then_else(I32 c, F t, F e) {
+        return _mm512_mask_blend_ps(_mm512_movepi32_mask((__m512i)c), e, t);
+    }
+    // NOTE: This version of 'all' only works with mask values (true == all bits set)
+    SI bool any(I32 c) { return _mm512_movepi32_mask((__m512i)c) != 0;      }
+    SI bool all(I32 c) { return _mm512_movepi32_mask((__m512i)c) == 0xffff; }
+
+    template <typename T>
+    SI V<T> gather(const T* p, U32 ix) {
+        return { p[ix[ 0]], p[ix[ 1]], p[ix[ 2]], p[ix[ 3]],
+                 p[ix[ 4]], p[ix[ 5]], p[ix[ 6]], p[ix[ 7]],
+                 p[ix[ 8]], p[ix[ 9]], p[ix[10]], p[ix[11]],
+                 p[ix[12]], p[ix[13]], p[ix[14]], p[ix[15]], };
+    }
+    SI F   gather(const float*    p, U32 ix) { return _mm512_i32gather_ps((__m512i)ix, p, 4); }
+    SI U32 gather(const uint32_t* p, U32 ix) {
+        return (U32)_mm512_i32gather_epi32((__m512i)ix, p, 4);
+    }
+    SI U64 gather(const uint64_t* p, U32 ix) {
+        __m512i parts[] = {
+            _mm512_i32gather_epi64(_mm512_castsi512_si256((__m512i)ix), p, 8),
+            _mm512_i32gather_epi64(_mm512_extracti64x4_epi64((__m512i)ix, 1), p, 8),
+        };
+        return sk_bit_cast<U64>(parts);
+    }
+    template <typename V, typename S>
+    SI void scatter_masked(V src, S* dst, U32 ix, I32 mask) {
+        V before = gather(dst, ix);
+        V after = if_then_else(mask, src, before);
+        for (int i = 0; i < 16; i++) {
+            dst[ix[i]] = after[i];
+        }
+    }
+
+    SI void load2(const uint16_t* ptr, U16* r, U16* g) {
+        // Each 32-bit lane holds one pixel, r in its low half and g in its high half.
+        __m512i rg = _mm512_loadu_si512(ptr);
+        *r = (U16)_mm512_cvtepi32_epi16(rg);
+        *g = (U16)_mm512_cvtepi32_epi16(_mm512_srli_epi32(rg, 16));
+    }
+    SI void store2(uint16_t* ptr, U16 r, U16 g) {
+        __m512i rg = _mm512_or_si512(_mm512_cvtepu16_epi32((__m256i)r),
+                                     _mm512_slli_epi32(_mm512_cvtepu16_epi32((__m256i)g), 16));
+        _mm512_storeu_si512(ptr, rg);
+    }
+
+    SI void load4(const uint16_t* ptr, U16* r, U16* g, U16* b, U16* a) {
+        // Each 64-bit lane holds one pixel; narrowing each lane after a shift picks one channel.
+        __m512i _01234567 = _mm512_loadu_si512(ptr +  0),
+                _89abcdef = _mm512_loadu_si512(ptr + 32);
+
+        auto join = [](__m128i lo, __m128i hi) {
+            return (U16)_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        };
+        *r = join(_mm512_cvtepi64_epi16(                  _01234567     ),
+                  _mm512_cvtepi64_epi16(                  _89abcdef     ));
+        *g = join(_mm512_cvtepi64_epi16(_mm512_srli_epi64(_01234567, 16)),
+                  _mm512_cvtepi64_epi16(_mm512_srli_epi64(_89abcdef, 16)));
+        *b = join(_mm512_cvtepi64_epi16(_mm512_srli_epi64(_01234567, 32)),
+                  _mm512_cvtepi64_epi16(_mm512_srli_epi64(_89abcdef, 32)));
+        *a = join(_mm512_cvtepi64_epi16(_mm512_srli_epi64(_01234567, 48)),
+                  _mm512_cvtepi64_epi16(_mm512_srli_epi64(_89abcdef, 48)));
+    }
+    SI void store4(uint16_t* ptr, U16 r, U16 g, U16 b, U16 a) {
+        // Widen each channel's 16-bit lanes to 64 bits, then shift them into place.
+        auto widen = [](U16 v, int hi) {
+            return _mm512_cvtepu16_epi64(hi ? _mm256_extracti128_si256((__m256i)v, 1)
+                                            : _mm256_castsi256_si128  ((__m256i)v));
+        };
+        auto interlace = [&](int hi) {
+            return _mm512_or_si512(
+                    _mm512_or_si512(                  widen(r, hi)     ,
+                                    _mm512_slli_epi64(widen(g, hi), 16)),
+                    _mm512_or_si512(_mm512_slli_epi64(widen(b, hi), 32),
+                                    _mm512_slli_epi64(widen(a, hi), 48)));
+        };
+        _mm512_storeu_si512(ptr +  0, interlace(0));
+        _mm512_storeu_si512(ptr + 32, interlace(1));
+    }
+
+    SI void load4(const float* ptr, F* r, F* g, F* b, F* a) {
+        __m512 _0123 = _mm512_loadu_ps(ptr +  0),
+               _4567 = _mm512_loadu_ps(ptr + 16),
+               _89ab = _mm512_loadu_ps(ptr + 32),
+               _cdef = _mm512_loadu_ps(ptr + 48);
+
+        // Pull 8 pixels' worth of each channel out of each pair of registers...
+        const __m512i rg = _mm512_setr_epi32(0,4,8,12,16,20,24,28, 1,5,9,13,17,21,25,29),
+                      ba = _mm512_setr_epi32(2,6,10,14,18,22,26,30, 3,7,11,15,19,23,27,31);
+        __m512 rg01234567 = _mm512_permutex2var_ps(_0123, rg, _4567),  // r0-7 | g0-7
+               ba01234567 = _mm512_permutex2var_ps(_0123, ba, _4567),  // b0-7 | a0-7
+               rg89abcdef = _mm512_permutex2var_ps(_89ab, rg, _cdef),  // r8-f | g8-f
+               ba89abcdef = _mm512_permutex2var_ps(_89ab, ba, _cdef);  // b8-f | a8-f
+
+        // ... then join the two halves of each channel.
+        *r = _mm512_shuffle_f32x4(rg01234567, rg89abcdef, 0x44);
+        *g = _mm512_shuffle_f32x4(rg01234567, rg89abcdef, 0xee);
+        *b = _mm512_shuffle_f32x4(ba01234567, ba89abcdef, 0x44);
+        *a = _mm512_shuffle_f32x4(ba01234567, ba89abcdef, 0xee);
+    }
+    SI void store4(float* ptr, F r, F g, F b, F a) {
+        __m512 rg01234567 = _mm512_shuffle_f32x4(r, g, 0x44),  // r0-7 | g0-7
+               rg89abcdef = _mm512_shuffle_f32x4(r, g, 0xee),  // r8-f | g8-f
+               ba01234567 = _mm512_shuffle_f32x4(b, a, 0x44),  // b0-7 | a0-7
+               ba89abcdef = _mm512_shuffle_f32x4(b, a, 0xee);  // b8-f | a8-f
+
+        const __m512i lo = _mm512_setr_epi32(0,8,16,24, 1,9,17,25, 2,10,18,26, 3,11,19,27),
+                      hi = _mm512_setr_epi32(4,12,20,28, 5,13,21,29, 6,14,22,30, 7,15,23,31);
+        _mm512_storeu_ps(ptr +  0, _mm512_permutex2var_ps(rg01234567, lo, ba01234567));
+        _mm512_storeu_ps(ptr + 16, _mm512_permutex2var_ps(rg01234567, hi, ba01234567));
+        _mm512_storeu_ps(ptr + 32, _mm512_permutex2var_ps(rg89abcdef, lo, ba89abcdef));
+        _mm512_storeu_ps(ptr + 48, _mm512_permutex2var_ps(rg89abcdef, hi, ba89abcdef));
+    }
+
 #elif defined(JUMPER_IS_SSE2) || defined(JUMPER_IS_SSE41) || defined(JUMPER_IS_AVX)
 template <typename T> using V = T __attribute__((ext_vector_type(4)));
     using F   = V<float   >;
@@ -694,6 +855,9 @@ SI F from_half(U16 h) {
 #elif defined(JUMPER_IS_HSW)
     return _mm256_cvtph_ps(h);
 
+#elif defined(JUMPER_IS_SKX)
+    return _mm512_cvtph_ps(h);
+
 #else
     // Remember, a half is 1-5-10 (sign-exponent-mantissa) with 15 exponent bias.
     U32 sem = expand(h),
@@ -714,6 +878,9 @@ SI U16 to_half(F f) {
 #elif defined(JUMPER_IS_HSW)
     return _mm256_cvtps_ph(f, _MM_FROUND_CUR_DIRECTION);
 
+#elif defined(JUMPER_IS_SKX)
+    return _mm512_cvtps_ph(f, _MM_FROUND_CUR_DIRECTION);
+
 #else
     // Remember, a float is 1-8-23 (sign-exponent-mantissa) with 127 exponent bias.
     U32 sem = sk_bit_cast<U32>(f),
@@ -2157,6 +2324,13 @@ STAGE(load_8888_dst, const SkRasterPipeline_MemoryCtx* ctx) {
     auto ptr = ptr_at_xy<const uint32_t>(ctx, dx,dy);
     from_8888(load<U32>(ptr), &dr,&dg,&db,&da);
 }
+STAGE(load_8888_premul, const SkRasterPipeline_MemoryCtx* ctx) {
+    auto ptr = ptr_at_xy<const uint32_t>(ctx, dx,dy);
+    from_8888(load<U32>(ptr), &r,&g,&b,&a);
+    r = r * a;
+    g = g * a;
+    b = b * a;
+}
 STAGE(gather_8888, const SkRasterPipeline_GatherCtx* ctx) {
     const uint32_t* ptr;
     U32 ix = ix_and_ptr(&ptr, ctx, r,g);
@@ -2626,7 +2800,20 @@ STAGE(matrix_perspective, const float* m) {
 SI void gradient_lookup(const SkRasterPipeline_GradientCtx* c, U32 idx, F t,
                         F* r, F* g, F* b, F* a) {
     F fr, br, fg, bg, fb, bb, fa, ba;
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_SKX)
+    if (c->stopCount <= 16) {
+        // A masked load never reads past the last stop.
+        const __mmask16 stops = (__mmask16)((1u << c->stopCount) - 1);
+        fr = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[0]));
+        br = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[0]));
+        fg = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[1]));
+        bg = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[1]));
+        fb = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[2]));
+        bb = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[2]));
+        fa = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[3]));
+        ba = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[3]));
+    } else
+#elif defined(JUMPER_IS_HSW)
     if (c->stopCount <=8) {
         fr = _mm256_permutevar8x32_ps(_mm256_loadu_ps(c->fs[0]), idx);
         br = _mm256_permutevar8x32_ps(_mm256_loadu_ps(c->bs[0]), idx);
@@ -2673,6 +2860,19 @@ STAGE(gradient, const SkRasterPipeline_GradientCtx* c) {
     gradient_lookup(c, idx, t, &r, &g, &b, &a);
 }
 
+STAGE(indexed_gradient, const SkRasterPipeline_IndexedGradientCtx* c) {
+    auto t = r;
+    // Start from the first stop in t's cell, then step over the few others in it. This finds the
+    // same stop as the full search in gradient, so there's no need to clamp t beforehand.
+    F cell = if_then_else(t > 0, t, F(0));
+    cell = if_then_else(cell < 1, cell, F(1));
+    U32 idx = gather(c->firstStop, trunc_(cell * (float)c->cellCount));
+    for (uint32_t i = 0; i < c->maxSteps; i++) {
+        idx += if_then_else(t >= gather(c->gradient.ts, idx + 1), U32(1), U32(0));
+    }
+    gradient_lookup(&c->gradient, idx, t, &r, &g, &b, &a);
+}
+
 STAGE(evenly_spaced_2_stop_gradient, const SkRasterPipeline_EvenlySpaced2StopGradientCtx* c) {
     auto t = r;
     r = mad(t, c->f[0], c->b[0]);
@@ -3838,6 +4038,50 @@ DECLARE_IMM_BINARY_FLOAT(cmpne) DECLARE_IMM_BINARY_INT(cmpne)
 #undef DECLARE_IMM_BINARY_FLOAT
 #undef DECLARE_IMM_BINARY_INT
 #undef DECLARE_IMM_BINARY_UINT
+
+// Arithmetic ops also have versions that read the right-side straight from value slots, or that
+// broadcast it from uniforms or immutable values, instead of from a copy pushed onto the stack.
+template <typename V, void (*ApplyFn)(V*, V*)>
+SI void apply_binary_from_slots(SkRasterPipeline_MemoryBinaryOpCtx* ctx) {
+    V* dst = (V*)ctx->dst;
+    V* src = (V*)ctx->src;
+    for (int index = 0; index < ctx->numSlots; ++index) {
+        ApplyFn(dst++, src++);
+    }
+}
+
+template <typename V, typename S, void (*ApplyFn)(V*, V*)>
+SI void apply_binary_from_scalars(SkRasterPipeline_MemoryBinaryOpCtx* ctx) {
+    V* dst = (V*)ctx->dst;
+    const S* src = (const S*)ctx->src;
+    for (int index = 0; index < ctx->numSlots; ++index) {
+        V value = *src++;  // broadcast the scalar into a vector
+        ApplyFn(dst++, &value);
+    }
+}
+
+#define DECLARE_MEMORY_BINARY_FLOAT(name)                                              \
+    STAGE_TAIL(name##_n_floats_from_slots, SkRasterPipeline_MemoryBinaryOpCtx* ctx) {   \
+        apply_binary_from_slots<F, &name##_fn>(ctx);                                   \
+    }                                                                                  \
+    STAGE_TAIL(name##_n_floats_from_scalars, SkRasterPipeline_MemoryBinaryOpCtx* ctx) { \
+        apply_binary_from_scalars<F, float, &name##_fn>(ctx);                          \
+    }
+#define DECLARE_MEMORY_BINARY_INT(name)                                              \
+    STAGE_TAIL(name##_n_ints_from_slots, SkRasterPipeline_MemoryBinaryOpCtx* ctx) {   \
+        apply_binary_from_slots<I32, &name##_fn>(ctx);                               \
+    }                                                                                \
+    STAGE_TAIL(name##_n_ints_from_scalars, SkRasterPipeline_MemoryBinaryOpCtx* ctx) { \
+        apply_binary_from_scalars<I32, int32_t, &name##_fn>(ctx);                    \
+    }
+
+DECLARE_MEMORY_BINARY_FLOAT(add)    DECLARE_MEMORY_BINARY_INT(add)
+DECLARE_MEMORY_BINARY_FLOAT(sub)    DECLARE_MEMORY_BINARY_INT(sub)
+DECLARE_MEMORY_BINARY_FLOAT(mul)    DECLARE_MEMORY_BINARY_INT(mul)
+DECLARE_MEMORY_BINARY_FLOAT(div)    DECLARE_MEMORY_BINARY_INT(div)
+
+#undef DECLARE_MEMORY_BINARY_FLOAT
+#undef DECLARE_MEMORY_BINARY_INT
 #undef DECLARE_BINARY_FLOAT
 #undef DECLARE_BINARY_INT
 #undef DECLARE_BINARY_UINT
@@ -4034,19 +4278,142 @@ STAGE(gauss_a_to_rgba, NoCtx) {
     b = a;
 }
 
-// A specialized fused image shader for clamp-x, clamp-y, non-sRGB sampling.
-STAGE(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
-    // (cx,cy) are the center of our sample.
-    F cx = r,
-      cy = g;
+// Wraps the lattice coordinate v into [0,256). v is a whole number, and the float math stays
+// exact even where v is too big or too negative for an int.
+SI U32 perlin_lattice_index(F v) {
+    return trunc_(v - 256.0f * floor_(v * (1/256.0f)));
+}
+
+STAGE(perlin_noise, const SkRasterPipeline_PerlinNoiseCtx* ctx) {
+    // The noise is evaluated at each pixel's x + offsetX, rounded to a whole number. The pixel
+    // centers in r,g are at (x + 0.5, y + 0.5).
+    F noiseX = floor_((r - 0.5f) + ctx->offsetX + 0.5f) * ctx->baseFrequencyX,
+      noiseY = floor_((g - 0.5f) + ctx->offsetY + 0.5f) * ctx->baseFrequencyY;
+
+    // All four channels sample the same lattice cells, just with their own gradients.
+    F sum[4] = {F(0), F(0), F(0), F(0)};
+    float scale = 1;
+    for (int octave = 0; octave < ctx->numOctaves; octave++) {
+        const F posX = noiseX + 4096.0f,
+                posY = noiseY + 4096.0f;
+        F x0 = floor_(posX), x1 = x0 + 1.0f,
+          y0 = floor_(posY), y1 = y0 + 1.0f;
+        const F fx = posX - x0,
+                fy = posY - y0;
+
+        if (ctx->stitching) {
+            // Wrap around the edges of the tile, so the tiles line up.
+            const int* stitch = ctx->stitching + 4 * octave;
+            x0 = if_then_else(x0 >= (float)stitch[1], x0 - (float)stitch[0], x0);
+            x1 = if_then_else(x1 >= (float)stitch[1], x1 - (float)stitch[0], x1);
+            y0 = if_then_else(y0 >= (float)stitch[3], y0 - (float)stitch[2], y0);
+            y1 = if_then_else(y1 >= (float)stitch[3], y1 - (float)stitch[2], y1);
+        }
+        const U32 i = expand(gather(ctx->latticeSelector, perlin_lattice_index(x0))),
+                  j = expand(gather(ctx->latticeSelector, perlin_lattice_index(x1))),
+                  iy0 = perlin_lattice_index(y0),
+                  iy1 = perlin_lattice_index(y1);
+        // Each gradient is an (x,y) pair.
+        const U32 b00 = ((i + iy0) & 255) * 2,
+                  b10 = ((j + iy0) & 255) * 2,
+                  b01 = ((i + iy1) & 255) * 2,
+                  b11 = ((j + iy1) & 255) * 2;
+
+        const F sx = fx * fx * (3.0f - 2.0f * fx),
+                sy = fy * fy * (3.0f - 2.0f * fy);
+        const I32 pathological = (sx < 0.0f) | (sy < 0.0f) | (sx > 1.0f) | (sy > 1.0f);
+
+        for (int channel = 0; channel < 4; channel++) {
+            const float* gradient = ctx->gradient + channel * 2 * 256;
+            auto dot = [&](U32 b, F dx, F dy) {
+                return gather(gradient, b) * dx + gather(gradient, b + 1) * dy;
+            };
+            F u = dot(b00, fx, fy),
+              v = dot(b10, fx - 1.0f, fy);
+            const F top = u + (v - u) * sx;
+            v = dot(b11, fx - 1.0f, fy - 1.0f);
+            u = dot(b01, fx, fy - 1.0f);
+            const F bottom = u + (v - u) * sx;
+            const F noise = if_then_else(pathological, F(0), top + (bottom - top) * sy);
+
+            sum[channel] += (ctx->fractalNoise ? noise : abs_(noise)) * (1 / scale);
+        }
+
+        noiseX *= 2.0f;
+        noiseY *= 2.0f;
+        scale *= 2;
+    }
+
+    for (F& channel : sum) {
+        if (ctx->fractalNoise) {
+            channel = (channel + 1.0f) * 0.5f;
+        }
+        channel = clamp_01_(channel);
+    }
+    a = sum[3];
+    r = sum[0] * a;
+    g = sum[1] * a;
+    b = sum[2] * a;
+}
+
+// Coverage of the pixels centered at (r,g) by an axis-aligned round rect. The sides contribute
+// the exact fraction of the pixel inside them, and the corners the approximate distance to their
+// ellipse, f(p) / |grad f(p)|, as the GPU backends' analytic rrect effects do.
+STAGE(rrect_coverage, const SkRasterPipeline_RRectCoverageCtx* c) {
+    F x = r,
+      y = g;
+    F covX = min(x + 0.5f, c->right) - max(x - 0.5f, c->left),
+      covY = min(y + 0.5f, c->bottom) - max(y - 0.5f, c->top);
+    F cov = min(max(covX, 0.0f), 1.0f) * min(max(covY, 0.0f), 1.0f);
+
+    // When the radii are lopsided, a pixel can lie in the quadrants of more than one corner, and
+    // then it must be inside all of their ellipses.
+    for (int i = 0; i < 4; i++) {
+        if (c->invRX2[i] == 0) {
+            continue;  // a square corner
+        }
+        // The distances from the corner's center, outwards. Inwards of it, the sides are straight.
+        F dx = max((i & 1) ? x - c->centerX[i] : c->centerX[i] - x, 0.0f),
+          dy = max((i & 2) ? y - c->centerY[i] : c->centerY[i] - y, 0.0f);
+        F gx = dx * c->invRX2[i],
+          gy = dy * c->invRY2[i];
+        F f = mad(dx, gx, mad(dy, gy, -1.0f)),
+          dist = f / (2.0f * sqrt_(mad(gx, gx, gy * gy)));
+        F cornerCov = min(max(0.5f - dist, 0.0f), 1.0f);
+        cov = if_then_else((dx > 0.0f) & (dy > 0.0f), min(cov, cornerCov), cov);
+    }
+
+    r = g = b = a = cov;
+}
+
+// The gainmap math of SkGainmapShader: H = (S + epsilonBase) * exp(W * log(gain)) - epsilonOther,
+// where log(gain) mixes between the logs of the min and max ratios by the gainmap's value.
+STAGE(gainmap_apply, const SkRasterPipeline_GainmapCtx* c) {
+    F G[3];
+    for (int i = 0; i < 3; i++) {
+        const int channel = c->channel < 0 ? i : c->channel;
+        G[i] = sk_unaligned_load<F>(c->gainmap + channel*N);
+        if (!c->noGamma) {
+            G[i] = approx_powf(G[i], c->gamma[i]);
+        }
+        G[i] = approx_exp(mad(G[i], c->logGainScale[i], c->logGainBias[i]));
+    }
+    r = mad(r + c->epsilonBase[0], G[0], -c->epsilonOther[0]);
+    g = mad(g + c->epsilonBase[1], G[1], -c->epsilonOther[1]);
+    b = mad(b + c->epsilonBase[2], G[2], -c->epsilonOther[2]);
+}
 
+// Bilinear sampling of an 8888 image at (cx,cy), shared by bilerp_clamp_8888 and
+// bilerp_tiled_8888. Samples that fall off a repeating edge wrap around to the opposite edge.
+SI void bilerp_8888(const SkRasterPipeline_GatherCtx* ctx, F cx, F cy, bool repeatX, bool repeatY,
+                    F* r, F* g, F* b, F* a) {
     // All sample points are at the same fractional offset (fx,fy).
     // They're the 4 corners of a logical 1x1 pixel surrounding (x,y) at (0.5,0.5) offsets.
     F fx = fract(cx + 0.5f),
       fy = fract(cy + 0.5f);
 
     // We'll accumulate the color of all four samples into {r,g,b,a} directly.
-    r = g = b = a = 0;
+    *r = *g = *b = *a = 0;
 
     for (float py = -0.5f; py <= +0.5f; py += 1.0f)
     for (float px = -0.5f; px <= +0.5f; px += 1.0f) {
@@ -4054,6 +4421,15 @@ STAGE(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
         F x = cx + px,
           y = cy + py;
 
+        if (repeatX) {
+            x = if_then_else(x < 0, x + ctx->width, x);
+            x = if_then_else(x >= ctx->width, x - ctx->width, x);
+        }
+        if (repeatY) {
+            y = if_then_else(y < 0, y + ctx->height, y);
+            y = if_then_else(y >= ctx->height, y - ctx->height, y);
+        }
+
         // ix_and_ptr() will clamp to the image's bounds for us.
         const uint32_t* ptr;
         U32 ix = ix_and_ptr(&ptr, ctx, x,y);
@@ -4069,13 +4445,23 @@ STAGE(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
           sy = (py > 0) ? fy : 1.0f - fy,
           area = sx * sy;
 
-        r += sr * area;
-        g += sg * area;
-        b += sb * area;
-        a += sa * area;
+        *r += sr * area;
+        *g += sg * area;
+        *b += sb * area;
+        *a += sa * area;
     }
 }
 
+// A specialized fused image shader for clamp-x, clamp-y, non-sRGB sampling.
+STAGE(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
+    bilerp_8888(ctx, r, g, /*repeatX=*/false, /*repeatY=*/false, &r, &g, &b, &a);
+}
+
+// The same, for coordinates already tiled by repeat_x/y or mirror_x/y.
+STAGE(bilerp_tiled_8888, const SkRasterPipeline_BilerpTileCtx* ctx) {
+    bilerp_8888(ctx->gather, r, g, ctx->repeatX, ctx->repeatY, &r, &g, &b, &a);
+}
+
 // A specialized fused image shader for clamp-x, clamp-y, non-sRGB sampling.
 STAGE(bicubic_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
     // (cx,cy) are the center of our sample.
@@ -4161,7 +4547,7 @@ namespace lowp {
 
 #else  // We are compiling vector code with Clang... let's make some lowp stages!
 
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_HSW) || defined(JUMPER_IS_SKX)
     using U8  = uint8_t  __attribute__((ext_vector_type(16)));
     using U16 = uint16_t __attribute__((ext_vector_type(16)));
     using I16 =  int16_t __attribute__((ext_vector_type(16)));
@@ -4447,7 +4833,9 @@ SI U32 trunc_(F x) { return (U32)cast<I32>(x); }
 
 // Use approximate instructions and one Newton-Raphson step to calculate 1/x.
 SI F rcp_precise(F x) {
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_SKX)
+    return SK_OPTS_NS::rcp_precise(x);
+#elif defined(JUMPER_IS_HSW)
     __m256 lo,hi;
     split(x, &lo,&hi);
     return join<F>(SK_OPTS_NS::rcp_precise(lo), SK_OPTS_NS::rcp_precise(hi));
@@ -4464,7 +4852,9 @@ SI F rcp_precise(F x) {
 #endif
 }
 SI F sqrt_(F x) {
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_SKX)
+    return _mm512_sqrt_ps(x);
+#elif defined(JUMPER_IS_HSW)
     __m256 lo,hi;
     split(x, &lo,&hi);
     return join<F>(_mm256_sqrt_ps(lo), _mm256_sqrt_ps(hi));
@@ -4499,6 +4889,8 @@ SI F floor_(F x) {
     float32x4_t lo,hi;
     split(x, &lo,&hi);
     return join<F>(vrndmq_f32(lo), vrndmq_f32(hi));
+#elif defined(JUMPER_IS_SKX)
+    return _mm512_floor_ps(x);
 #elif defined(JUMPER_IS_HSW)
     __m256 lo,hi;
     split(x, &lo,&hi);
@@ -4519,7 +4911,7 @@ SI F floor_(F x) {
 // The result is a number on [-1, 1).
 // Note: on neon this is a saturating multiply while the others are not.
 SI I16 scaled_mult(I16 a, I16 b) {
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_HSW) || defined(JUMPER_IS_SKX)
     return _mm256_mulhrs_epi16(a, b);
 #elif defined(JUMPER_IS_SSE41) || defined(JUMPER_IS_AVX)
     return _mm_mulhrs_epi16(a, b);
@@ -4609,6 +5001,22 @@ STAGE_PP(set_rgb, const float rgb[3]) {
     b = from_float(rgb[2]);
 }
 
+// The matrix is the same as highp's, with its translation in [0,1].
+SI U16 matrix_4x5_row(F r, F g, F b, F a, const float* m) {
+    F v = mad(r,m[0], mad(g,m[1], mad(b,m[2], mad(a,m[3], m[4] * 255.0f))));
+    return cast<U16>(min(max(0, v), 255) + 0.5f);
+}
+STAGE_PP(matrix_4x5, const float* m) {
+    F R = cast<F>(r),
+      G = cast<F>(g),
+      B = cast<F>(b),
+      A = cast<F>(a);
+    r = matrix_4x5_row(R,G,B,A, m +  0);
+    g = matrix_4x5_row(R,G,B,A, m +  5);
+    b = matrix_4x5_row(R,G,B,A, m + 10);
+    a = matrix_4x5_row(R,G,B,A, m + 15);
+}
+
 // No need to clamp against 0 here (values are unsigned)
 STAGE_PP(clamp_01, NoCtx) {
     r = min(r, 255);
@@ -4793,7 +5201,25 @@ SI void store(T* ptr, V v) {
     memcpy(ptr, &v, sizeof(v));
 }
 
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_SKX)
+    template <typename V, typename T>
+    SI V gather(const T* ptr, U32 ix) {
+        return V{ ptr[ix[ 0]], ptr[ix[ 1]], ptr[ix[ 2]], ptr[ix[ 3]],
+                  ptr[ix[ 4]], ptr[ix[ 5]], ptr[ix[ 6]], ptr[ix[ 7]],
+                  ptr[ix[ 8]], ptr[ix[ 9]], ptr[ix[10]], ptr[ix[11]],
+                  ptr[ix[12]], ptr[ix[13]], ptr[ix[14]], ptr[ix[15]], };
+    }
+
+    template<>
+    F gather(const float* ptr, U32 ix) {
+        return _mm512_i32gather_ps(ix, ptr, 4);
+    }
+
+    template<>
+    U32 gather(const uint32_t* ptr, U32 ix) {
+        return _mm512_i32gather_epi32(ix, ptr, 4);
+    }
+#elif defined(JUMPER_IS_HSW)
     template <typename V, typename T>
     SI V gather(const T* ptr, U32 ix) {
         return V{ ptr[ix[ 0]], ptr[ix[ 1]], ptr[ix[ 2]], ptr[ix[ 3]],
@@ -4892,6 +5318,12 @@ STAGE_PP(load_8888, const SkRasterPipeline_MemoryCtx* ctx) {
 STAGE_PP(load_8888_dst, const SkRasterPipeline_MemoryCtx* ctx) {
     load_8888_(ptr_at_xy<const uint32_t>(ctx, dx,dy), &dr,&dg,&db,&da);
 }
+STAGE_PP(load_8888_premul, const SkRasterPipeline_MemoryCtx* ctx) {
+    load_8888_(ptr_at_xy<const uint32_t>(ctx, dx,dy), &r,&g,&b,&a);
+    r = div255_accurate(r * a);
+    g = div255_accurate(g * a);
+    b = div255_accurate(b * a);
+}
 STAGE_PP(store_8888, const SkRasterPipeline_MemoryCtx* ctx) {
     store_8888_(ptr_at_xy<uint32_t>(ctx, dx,dy), r,g,b,a);
 }
@@ -5234,6 +5666,31 @@ STAGE_GG(mirror_x_1, NoCtx) {
     x = clamp_01_(abs_( (x-1.0f) - two(floor_((x-1.0f)*0.5f)) - 1.0f ));
 }
 
+// Tile x or y to [0,limit), as the highp stages of the same name do, for bilerp_tiled_8888.
+SI F exclusive_repeat(F v, const SkRasterPipeline_TileCtx* ctx) {
+    return v - floor_(v*ctx->invScale)*ctx->scale;
+}
+SI F exclusive_mirror(F v, const SkRasterPipeline_TileCtx* ctx) {
+    auto limit = ctx->scale;
+    auto invLimit = ctx->invScale;
+
+    // This is "repeat" over the range 0..2*limit
+    auto u = v - floor_(v*invLimit*0.5f)*2*limit;
+    // s will be 0 when moving forward (e.g. [0, limit)) and 1 when moving backward (e.g.
+    // [limit, 2*limit)).
+    auto s = floor_(u*invLimit);
+    // This is the mirror result.
+    auto m = u - 2*s*(u - limit);
+    // Apply a bias to m if moving backwards so that we snap consistently at exact integer coords in
+    // the logical infinite image.
+    auto biasInUlps = trunc_(s);
+    return sk_bit_cast<F>(sk_bit_cast<U32>(m) + ctx->mirrorBiasDir*biasInUlps);
+}
+STAGE_GG(repeat_x, const SkRasterPipeline_TileCtx* ctx) { x = exclusive_repeat(x, ctx); }
+STAGE_GG(repeat_y, const SkRasterPipeline_TileCtx* ctx) { y = exclusive_repeat(y, ctx); }
+STAGE_GG(mirror_x, const SkRasterPipeline_TileCtx* ctx) { x = exclusive_mirror(x, ctx); }
+STAGE_GG(mirror_y, const SkRasterPipeline_TileCtx* ctx) { y = exclusive_mirror(y, ctx); }
+
 SI I16 cond_to_mask_16(I32 cond) { return cast<I16>(cond); }
 
 STAGE_GG(decal_x, SkRasterPipeline_DecalTileCtx* ctx) {
@@ -5274,7 +5731,19 @@ SI void gradient_lookup(const SkRasterPipeline_GradientCtx* c, U32 idx, F t,
                         U16* r, U16* g, U16* b, U16* a) {
 
     F fr, fg, fb, fa, br, bg, bb, ba;
-#if defined(JUMPER_IS_HSW)
+#if defined(JUMPER_IS_SKX)
+    if (c->stopCount <= 16) {
+        const __mmask16 stops = (__mmask16)((1u << c->stopCount) - 1);
+        fr = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[0]));
+        br = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[0]));
+        fg = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[1]));
+        bg = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[1]));
+        fb = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[2]));
+        bb = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[2]));
+        fa = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->fs[3]));
+        ba = _mm512_permutexvar_ps(idx, _mm512_maskz_loadu_ps(stops, c->bs[3]));
+    } else
+#elif defined(JUMPER_IS_HSW)
     if (c->stopCount <=8) {
         __m256i lo, hi;
         split(idx, &lo, &hi);
@@ -5332,6 +5801,17 @@ STAGE_GP(evenly_spaced_gradient, const SkRasterPipeline_GradientCtx* c) {
     gradient_lookup(c, idx, t, &r, &g, &b, &a);
 }
 
+STAGE_GP(indexed_gradient, const SkRasterPipeline_IndexedGradientCtx* c) {
+    auto t = x;
+    F cell = if_then_else(t > 0, t, F(0));
+    cell = if_then_else(cell < 1, cell, F(1));
+    U32 idx = gather<U32>(c->firstStop, trunc_(cell * (float)c->cellCount));
+    for (uint32_t i = 0; i < c->maxSteps; i++) {
+        idx += if_then_else(t >= gather<F>(c->gradient.ts, idx + 1), U32(1), U32(0));
+    }
+    gradient_lookup(&c->gradient, idx, t, &r, &g, &b, &a);
+}
+
 STAGE_GP(evenly_spaced_2_stop_gradient, const SkRasterPipeline_EvenlySpaced2StopGradientCtx* c) {
     auto t = x;
     round_F_to_U16(mad(t, c->f[0], c->b[0]),
@@ -5341,7 +5821,10 @@ STAGE_GP(evenly_spaced_2_stop_gradient, const SkRasterPipeline_EvenlySpaced2Stop
                    &r,&g,&b,&a);
 }
 
-STAGE_GP(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
+// Shared by bilerp_clamp_8888 and bilerp_tiled_8888. Neighbors that fall off a repeating edge
+// wrap around to the opposite edge; ix_and_ptr() clamps all the others.
+SI void bilerp_8888(const SkRasterPipeline_GatherCtx* ctx, F x, F y, bool repeatX, bool repeatY,
+                    U16* r, U16* g, U16* b, U16* a) {
     // Quantize sample point and transform into lerp coordinates converting them to 16.16 fixed
     // point number.
     I32 qx = cast<I32>(floor_(65536.0f * x + 0.5f)) - 32768,
@@ -5395,12 +5878,27 @@ STAGE_GP(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
         return v2 >> 1;
     };
 
+    // The coordinates of the right and bottom neighbors. The tiling stages leave x and y on
+    // [0, width) and [0, height), so sx and sy are at least -1, and sx1 and sy1 at most the limit.
+    I32 sx1 = sx + 1,
+        sy1 = sy + 1;
+    if (repeatX) {
+        const int w = (int)ctx->width;
+        sx  = sx  + ((sx  <  0) & w);
+        sx1 = sx1 - ((sx1 >= w) & w);
+    }
+    if (repeatY) {
+        const int h = (int)ctx->height;
+        sy  = sy  + ((sy  <  0) & h);
+        sy1 = sy1 - ((sy1 >= h) & h);
+    }
+
     const uint32_t* ptr;
     U32 ix = ix_and_ptr(&ptr, ctx, sx, sy);
     U16 leftR, leftG, leftB, leftA;
     from_8888(gather<U32>(ptr, ix), &leftR,&leftG,&leftB,&leftA);
 
-    ix = ix_and_ptr(&ptr, ctx, sx+1, sy);
+    ix = ix_and_ptr(&ptr, ctx, sx1, sy);
     U16 rightR, rightG, rightB, rightA;
     from_8888(gather<U32>(ptr, ix), &rightR,&rightG,&rightB,&rightA);
 
@@ -5409,10 +5907,10 @@ STAGE_GP(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
         topB = lerpX(leftB, rightB),
         topA = lerpX(leftA, rightA);
 
-    ix = ix_and_ptr(&ptr, ctx, sx, sy+1);
+    ix = ix_and_ptr(&ptr, ctx, sx, sy1);
     from_8888(gather<U32>(ptr, ix), &leftR,&leftG,&leftB,&leftA);
 
-    ix = ix_and_ptr(&ptr, ctx, sx+1, sy+1);
+    ix = ix_and_ptr(&ptr, ctx, sx1, sy1);
     from_8888(gather<U32>(ptr, ix), &rightR,&rightG,&rightB,&rightA);
 
     U16 bottomR = lerpX(leftR, rightR),
@@ -5431,10 +5929,18 @@ STAGE_GP(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
         return blend >> 8;
     };
 
-    r = lerpY(topR, bottomR);
-    g = lerpY(topG, bottomG);
-    b = lerpY(topB, bottomB);
-    a = lerpY(topA, bottomA);
+    *r = lerpY(topR, bottomR);
+    *g = lerpY(topG, bottomG);
+    *b = lerpY(topB, bottomB);
+    *a = lerpY(topA, bottomA);
+}
+
+STAGE_GP(bilerp_clamp_8888, const SkRasterPipeline_GatherCtx* ctx) {
+    bilerp_8888(ctx, x, y, /*repeatX=*/false, /*repeatY=*/false, &r, &g, &b, &a);
+}
+
+STAGE_GP(bilerp_tiled_8888, const SkRasterPipeline_BilerpTileCtx* ctx) {
+    bilerp_8888(ctx->gather, x, y, ctx->repeatX, ctx->repeatY, &r, &g, &b, &a);
 }
 
 STAGE_GG(xy_to_unit_angle, NoCtx) {
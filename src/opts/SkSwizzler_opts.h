@@ -350,6 +350,16 @@ static __m256i scale(__m256i x, __m256i y) {
     return _mm256_mulhi_epu16(_mm256_add_epi16(_mm256_mullo_epi16(x, y), _128), _257);
 }
 
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SKX
+static __m512i scale(__m512i x, __m512i y) {
+    const __m512i _128 = _mm512_set1_epi16(128);
+    const __m512i _257 = _mm512_set1_epi16(257);
+
+    // (x+127)/255 == ((x+128)*257)>>16 for 0 <= x <= 255*255.
+    return _mm512_mulhi_epu16(_mm512_add_epi16(_mm512_mullo_epi16(x, y), _128), _257);
+}
+#endif
+
 static void premul_should_swapRB(bool kSwapRB, uint32_t* dst, const uint32_t* src, int count) {
 
     auto premul8 = [=](__m256i* lo, __m256i* hi) {
@@ -387,6 +397,54 @@ static void premul_should_swapRB(bool kSwapRB, uint32_t* dst, const uint32_t* sr
         *hi = _mm256_unpackhi_epi16(rg, ba);                // RGBARGBA RGBARGBA RGBARGBA RGBARGBA
     };
 
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SKX
+    // premul8() only ever works within 128-bit lanes, so widening each register to 512 bits
+    // premultiplies 32 pixels at a time with exactly the same results.
+    auto premul16 = [=](__m512i* lo, __m512i* hi) {
+        const __m512i zeros = _mm512_setzero_si512();
+        __m128i planar;
+        if (kSwapRB) {
+            planar = _mm_setr_epi8(2,6,10,14, 1,5,9,13, 0,4,8,12, 3,7,11,15);
+        } else {
+            planar = _mm_setr_epi8(0,4,8,12, 1,5,9,13, 2,6,10,14, 3,7,11,15);
+        }
+        const __m512i planar_x4 = _mm512_broadcast_i32x4(planar);
+
+        *lo = _mm512_shuffle_epi8(*lo, planar_x4);
+        *hi = _mm512_shuffle_epi8(*hi, planar_x4);
+        __m512i rg = _mm512_unpacklo_epi32(*lo, *hi),
+                ba = _mm512_unpackhi_epi32(*lo, *hi);
+
+        __m512i r = _mm512_unpacklo_epi8(rg, zeros),
+                g = _mm512_unpackhi_epi8(rg, zeros),
+                b = _mm512_unpacklo_epi8(ba, zeros),
+                a = _mm512_unpackhi_epi8(ba, zeros);
+
+        r = scale(r, a);
+        g = scale(g, a);
+        b = scale(b, a);
+
+        rg = _mm512_or_si512(r, _mm512_slli_epi16(g, 8));
+        ba = _mm512_or_si512(b, _mm512_slli_epi16(a, 8));
+        *lo = _mm512_unpacklo_epi16(rg, ba);
+        *hi = _mm512_unpackhi_epi16(rg, ba);
+    };
+
+    while (count >= 32) {
+        __m512i lo = _mm512_loadu_si512((const __m512i*) (src +  0)),
+                hi = _mm512_loadu_si512((const __m512i*) (src + 16));
+
+        premul16(&lo, &hi);
+
+        _mm512_storeu_si512((__m512i*) (dst +  0), lo);
+        _mm512_storeu_si512((__m512i*) (dst + 16), hi);
+
+        src += 32;
+        dst += 32;
+        count -= 32;
+    }
+#endif
+
     while (count >= 16) {
         __m256i lo = _mm256_loadu_si256((const __m256i*) (src + 0)),
                 hi = _mm256_loadu_si256((const __m256i*) (src + 8));
@@ -428,6 +486,21 @@ static void premul_should_swapRB(bool kSwapRB, uint32_t* dst, const uint32_t* sr
 }
 
 /*not static*/ inline void RGBA_to_BGRA(uint32_t* dst, const uint32_t* src, int count) {
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SKX
+    const __m512i swapRB_x4 = _mm512_broadcast_i32x4(
+            _mm_setr_epi8(2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15));
+
+    while (count >= 16) {
+        __m512i rgba = _mm512_loadu_si512((const __m512i*) src);
+        __m512i bgra = _mm512_shuffle_epi8(rgba, swapRB_x4);
+        _mm512_storeu_si512((__m512i*) dst, bgra);
+
+        src += 16;
+        dst += 16;
+        count -= 16;
+    }
+#endif
+
     const __m256i swapRB = _mm256_setr_epi8(2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15,
                                             2,1,0,3, 6,5,4,7, 10,9,8,11, 14,13,12,15);
 
@@ -1103,6 +1176,238 @@ static void RGB_to_BGR1_portable(uint32_t dst[], const uint8_t* src, int count)
     }
 #endif
 
+// 16-bit PNG components are big-endian, so reducing them to 8 bits keeps their first byte.
+static void RGBA16_to_RGBA_portable(uint32_t dst[], const uint8_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint32_t)src[6] << 24
+               | (uint32_t)src[4] << 16
+               | (uint32_t)src[2] <<  8
+               | (uint32_t)src[0] <<  0;
+        src += 8;
+    }
+}
+static void RGBA16_to_BGRA_portable(uint32_t dst[], const uint8_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint32_t)src[6] << 24
+               | (uint32_t)src[0] << 16
+               | (uint32_t)src[2] <<  8
+               | (uint32_t)src[4] <<  0;
+        src += 8;
+    }
+}
+static void RGB16_to_RGB1_portable(uint32_t dst[], const uint8_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint32_t)0xFF   << 24
+               | (uint32_t)src[4] << 16
+               | (uint32_t)src[2] <<  8
+               | (uint32_t)src[0] <<  0;
+        src += 6;
+    }
+}
+static void RGB16_to_BGR1_portable(uint32_t dst[], const uint8_t* src, int count) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = (uint32_t)0xFF   << 24
+               | (uint32_t)src[0] << 16
+               | (uint32_t)src[2] <<  8
+               | (uint32_t)src[4] <<  0;
+        src += 6;
+    }
+}
+#if defined(SK_ARM_HAS_NEON)
+    static void strip16_should_swaprb(bool kSwapRB,
+                                      uint32_t dst[], const uint8_t* src, int count) {
+        while (count >= 8) {
+            // Load 8 pixels, deinterleaved. The first byte of each big-endian component is the
+            // low byte of the little-endian lane, which narrowing keeps.
+            uint16x8x4_t rgba16 = vld4q_u16((const uint16_t*) src);
+
+            uint8x8x4_t rgba;
+            rgba.val[0] = vmovn_u16(rgba16.val[kSwapRB ? 2 : 0]);
+            rgba.val[1] = vmovn_u16(rgba16.val[1]);
+            rgba.val[2] = vmovn_u16(rgba16.val[kSwapRB ? 0 : 2]);
+            rgba.val[3] = vmovn_u16(rgba16.val[3]);
+
+            // Store 8 pixels.
+            vst4_u8((uint8_t*) dst, rgba);
+            src += 8*8;
+            dst += 8;
+            count -= 8;
+        }
+
+        auto proc = kSwapRB ? RGBA16_to_BGRA_portable : RGBA16_to_RGBA_portable;
+        proc(dst, src, count);
+    }
+
+    static void strip16_insert_alpha_should_swaprb(bool kSwapRB,
+                                                   uint32_t dst[], const uint8_t* src, int count) {
+        while (count >= 8) {
+            uint16x8x3_t rgb16 = vld3q_u16((const uint16_t*) src);
+
+            uint8x8x4_t rgba;
+            rgba.val[0] = vmovn_u16(rgb16.val[kSwapRB ? 2 : 0]);
+            rgba.val[1] = vmovn_u16(rgb16.val[1]);
+            rgba.val[2] = vmovn_u16(rgb16.val[kSwapRB ? 0 : 2]);
+            rgba.val[3] = vdup_n_u8(0xFF);
+
+            vst4_u8((uint8_t*) dst, rgba);
+            src += 8*6;
+            dst += 8;
+            count -= 8;
+        }
+
+        auto proc = kSwapRB ? RGB16_to_BGR1_portable : RGB16_to_RGB1_portable;
+        proc(dst, src, count);
+    }
+
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_should_swaprb(false, dst, src, count);
+    }
+    /*not static*/ inline void RGBA16_to_BGRA(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_should_swaprb(true, dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_RGB1(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_insert_alpha_should_swaprb(false, dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_BGR1(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_insert_alpha_should_swaprb(true, dst, src, count);
+    }
+#elif SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_SSSE3
+    static void strip16_should_swaprb(bool kSwapRB,
+                                      uint32_t dst[], const uint8_t* src, int count) {
+        const uint8_t Z = 0x80; // Shuffling in this index writes a zero.
+        // Gathers the first byte of each component of the two pixels in a 16-byte vector into
+        // the low (lo) or high (hi) half of the result.
+        __m128i lo, hi;
+        if (kSwapRB) {
+            lo = _mm_setr_epi8(4,2,0,6, 12,10,8,14, Z,Z,Z,Z, Z,Z,Z,Z);
+            hi = _mm_setr_epi8(Z,Z,Z,Z, Z,Z,Z,Z, 4,2,0,6, 12,10,8,14);
+        } else {
+            lo = _mm_setr_epi8(0,2,4,6, 8,10,12,14, Z,Z,Z,Z, Z,Z,Z,Z);
+            hi = _mm_setr_epi8(Z,Z,Z,Z, Z,Z,Z,Z, 0,2,4,6, 8,10,12,14);
+        }
+
+    #if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+        const __m256i lo8 = _mm256_broadcastsi128_si256(lo),
+                      hi8 = _mm256_broadcastsi128_si256(hi);
+        while (count >= 8) {
+            __m256i px0123 = _mm256_loadu_si256((const __m256i*) (src +  0)),
+                    px4567 = _mm256_loadu_si256((const __m256i*) (src + 32));
+
+            // The 64-bit lanes now hold pixels 01, 45, 23, 67. Put them back in order.
+            __m256i rgba = _mm256_or_si256(_mm256_shuffle_epi8(px0123, lo8),
+                                           _mm256_shuffle_epi8(px4567, hi8));
+            rgba = _mm256_permute4x64_epi64(rgba, _MM_SHUFFLE(3,1,2,0));
+
+            _mm256_storeu_si256((__m256i*) dst, rgba);
+            src += 8*8;
+            dst += 8;
+            count -= 8;
+        }
+    #endif
+
+        while (count >= 4) {
+            __m128i px01 = _mm_loadu_si128((const __m128i*) (src +  0)),
+                    px23 = _mm_loadu_si128((const __m128i*) (src + 16));
+
+            __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(px01, lo), _mm_shuffle_epi8(px23, hi));
+
+            _mm_storeu_si128((__m128i*) dst, rgba);
+            src += 4*8;
+            dst += 4;
+            count -= 4;
+        }
+
+        auto proc = kSwapRB ? RGBA16_to_BGRA_portable : RGBA16_to_RGBA_portable;
+        proc(dst, src, count);
+    }
+
+    static void strip16_insert_alpha_should_swaprb(bool kSwapRB,
+                                                   uint32_t dst[], const uint8_t* src, int count) {
+        const __m128i alphaMask = _mm_set1_epi32(0xFF000000);
+        const uint8_t Z = 0x80;
+        __m128i lo, hi;
+        if (kSwapRB) {
+            lo = _mm_setr_epi8(4,2,0,Z, 10,8,6,Z, Z,Z,Z,Z, Z,Z,Z,Z);
+            hi = _mm_setr_epi8(Z,Z,Z,Z, Z,Z,Z,Z, 4,2,0,Z, 10,8,6,Z);
+        } else {
+            lo = _mm_setr_epi8(0,2,4,Z, 6,8,10,Z, Z,Z,Z,Z, Z,Z,Z,Z);
+            hi = _mm_setr_epi8(Z,Z,Z,Z, Z,Z,Z,Z, 0,2,4,Z, 6,8,10,Z);
+        }
+
+        while (count >= 6) {
+            // Each load holds two pixels and part of a third, which is discarded. Requiring six
+            // pixels keeps the second load, which ends 28 bytes in, inside the row.
+            __m128i px01 = _mm_loadu_si128((const __m128i*) (src +  0)),
+                    px23 = _mm_loadu_si128((const __m128i*) (src + 12));
+
+            __m128i rgba = _mm_or_si128(_mm_shuffle_epi8(px01, lo), _mm_shuffle_epi8(px23, hi));
+            rgba = _mm_or_si128(rgba, alphaMask);
+
+            _mm_storeu_si128((__m128i*) dst, rgba);
+            src += 4*6;
+            dst += 4;
+            count -= 4;
+        }
+
+        auto proc = kSwapRB ? RGB16_to_BGR1_portable : RGB16_to_RGB1_portable;
+        proc(dst, src, count);
+    }
+
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_should_swaprb(false, dst, src, count);
+    }
+    /*not static*/ inline void RGBA16_to_BGRA(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_should_swaprb(true, dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_RGB1(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_insert_alpha_should_swaprb(false, dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_BGR1(uint32_t dst[], const uint8_t* src, int count) {
+        strip16_insert_alpha_should_swaprb(true, dst, src, count);
+    }
+#else
+    /*not static*/ inline void RGBA16_to_RGBA(uint32_t dst[], const uint8_t* src, int count) {
+        RGBA16_to_RGBA_portable(dst, src, count);
+    }
+    /*not static*/ inline void RGBA16_to_BGRA(uint32_t dst[], const uint8_t* src, int count) {
+        RGBA16_to_BGRA_portable(dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_RGB1(uint32_t dst[], const uint8_t* src, int count) {
+        RGB16_to_RGB1_portable(dst, src, count);
+    }
+    /*not static*/ inline void RGB16_to_BGR1(uint32_t dst[], const uint8_t* src, int count) {
+        RGB16_to_BGR1_portable(dst, src, count);
+    }
+#endif
+
+// Palette lookups only have a vector form where there's a gather instruction, i.e. AVX2.
+static void index_to_8888_portable(uint32_t dst[], const uint8_t* src, int count,
+                                   const uint32_t table[256]) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = table[src[i]];
+    }
+}
+#if SK_CPU_SSE_LEVEL >= SK_CPU_SSE_LEVEL_AVX2
+    /*not static*/ inline void index_to_8888(uint32_t dst[], const uint8_t* src, int count,
+                                             const uint32_t table[256]) {
+        while (count >= 8) {
+            __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) src));
+            __m256i colors = _mm256_i32gather_epi32((const int*) table, indices, 4);
+
+            _mm256_storeu_si256((__m256i*) dst, colors);
+            src += 8;
+            dst += 8;
+            count -= 8;
+        }
+        index_to_8888_portable(dst, src, count, table);
+    }
+#else
+    /*not static*/ inline void index_to_8888(uint32_t dst[], const uint8_t* src, int count,
+                                             const uint32_t table[256]) {
+        index_to_8888_portable(dst, src, count, table);
+    }
+#endif
+
 }  // namespace SK_OPTS_NS
 
 #endif // SkSwizzler_opts_DEFINED
@@ -9,19 +9,24 @@
 
 #include "include/codec/SkCodec.h"
 #include "include/codec/SkEncodedImageFormat.h"
+#include "include/codec/SkEncodedOrigin.h"
 #include "include/codec/SkJpegDecoder.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
 #include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkStream.h"
 #include "include/encode/SkICC.h"
 #include "include/encode/SkJpegEncoder.h"
 #include "include/private/SkColorData.h"
 #include "include/private/base/SkTo.h"
+#include "modules/skcms/skcms.h"
 #include "src/core/SkImageInfoPriv.h"
 #include "src/pdf/SkDeflate.h"
 #include "src/pdf/SkPDFDocumentPriv.h"
+#include "src/pdf/SkPDFResourceDict.h"
+#include "src/pdf/SkPDFSharedCache.h"
 #include "src/pdf/SkPDFTypes.h"
 #include "src/pdf/SkPDFUnion.h"
 #include "src/pdf/SkPDFUtils.h"
@@ -76,8 +81,6 @@ SkColor get_neighbor_avg_color(const SkPixmap& bm, int xOrig, int yOrig) {
                  : SK_ColorTRANSPARENT;
 }
 
-enum class SkPDFStreamFormat { DCT, Flate, Uncompressed };
-
 template <typename T>
 void emit_image_stream(SkPDFDocument* doc,
                        SkPDFIndirectReference ref,
@@ -86,7 +89,8 @@ void emit_image_stream(SkPDFDocument* doc,
                        SkPDFUnion&& colorSpace,
                        SkPDFIndirectReference sMask,
                        int length,
-                       SkPDFStreamFormat format) {
+                       SkPDFStreamFormat format,
+                       bool invertCMYK = false) {
     SkPDFDict pdfDict("XObject");
     pdfDict.insertName("Subtype", "Image");
     pdfDict.insertInt("Width", size.width());
@@ -96,6 +100,14 @@ void emit_image_stream(SkPDFDocument* doc,
         pdfDict.insertRef("SMask", sMask);
     }
     pdfDict.insertInt("BitsPerComponent", 8);
+    if (invertCMYK) {
+        auto decode = SkPDFMakeArray();
+        for (int i = 0; i < 4; ++i) {
+            decode->appendInt(1);
+            decode->appendInt(0);
+        }
+        pdfDict.insertObject("Decode", std::move(decode));
+    }
     #ifdef SK_PDF_BASE85_BINARY
     auto filters = SkPDFMakeArray();
     filters->appendName("ASCII85Decode");
@@ -119,15 +131,24 @@ void emit_image_stream(SkPDFDocument* doc,
     doc->emitStream(pdfDict, std::move(writeStream), ref);
 }
 
-void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndirectReference ref) {
-    SkPDF::Metadata::CompressionLevel compressionLevel = doc->metadata().fCompressionLevel;
-    SkPDFStreamFormat format = compressionLevel == SkPDF::Metadata::CompressionLevel::None
-                             ? SkPDFStreamFormat::Uncompressed
-                             : SkPDFStreamFormat::Flate;
+// Finishes a stream written through deflateWStream, if there is one, into buffer.
+sk_sp<SkData> finish_stream(SkDynamicMemoryWStream* buffer,
+                            std::optional<SkDeflateWStream>* deflateWStream) {
+    if (*deflateWStream) {
+        (*deflateWStream)->finalize();
+    }
+    #ifdef SK_PDF_BASE85_BINARY
+    SkPDFUtils::Base85Encode(buffer->detachAsStream(), buffer);
+    #endif
+    return buffer->detachAsData();
+}
+
+sk_sp<SkData> deflate_alpha(const SkPixmap& pm,
+                            SkPDF::Metadata::CompressionLevel compressionLevel) {
     SkDynamicMemoryWStream buffer;
     SkWStream* stream = &buffer;
     std::optional<SkDeflateWStream> deflateWStream;
-    if (format == SkPDFStreamFormat::Flate) {
+    if (compressionLevel != SkPDF::Metadata::CompressionLevel::None) {
         deflateWStream.emplace(&buffer, SkToInt(compressionLevel));
         stream = &*deflateWStream;
     }
@@ -153,17 +174,7 @@ void do_deflated_alpha(const SkPixmap& pm, SkPDFDocument* doc, SkPDFIndirectRefe
         }
         stream->write(byteBuffer, dst - byteBuffer);
     }
-    if (deflateWStream) {
-        deflateWStream->finalize();
-    }
-
-    #ifdef SK_PDF_BASE85_BINARY
-    SkPDFUtils::Base85Encode(buffer.detachAsStream(), &buffer);
-    #endif
-    int length = SkToInt(buffer.bytesWritten());
-    emit_image_stream(doc, ref, [&buffer](SkWStream* stream) { buffer.writeToAndReset(stream); },
-                      pm.info().dimensions(), SkPDFUnion::Name("DeviceGray"),
-                      SkPDFIndirectReference(), length, format);
+    return finish_stream(&buffer, &deflateWStream);
 }
 
 SkPDFUnion write_icc_profile(SkPDFDocument* doc, sk_sp<SkData>&& icc, int channels) {
@@ -189,41 +200,34 @@ SkPDFUnion write_icc_profile(SkPDFDocument* doc, sk_sp<SkData>&& icc, int channe
     return SkPDFUnion::Object(std::move(iccPDF));
 }
 
-void do_deflated_image(const SkPixmap& pm,
-                       SkPDFDocument* doc,
-                       bool isOpaque,
-                       SkPDFIndirectReference ref) {
-    SkPDFIndirectReference sMask;
-    if (!isOpaque) {
-        sMask = doc->reserveRef();
-    }
-    SkPDF::Metadata::CompressionLevel compressionLevel = doc->metadata().fCompressionLevel;
-    SkPDFStreamFormat format = compressionLevel == SkPDF::Metadata::CompressionLevel::None
-                             ? SkPDFStreamFormat::Uncompressed
-                             : SkPDFStreamFormat::Flate;
+SkPDFEncodedImage deflate_image(const SkPixmap& pm,
+                                bool isOpaque,
+                                SkPDF::Metadata::CompressionLevel compressionLevel) {
+    SkPDFEncodedImage image;
+    image.fDimensions = pm.info().dimensions();
+    image.fFormat = compressionLevel == SkPDF::Metadata::CompressionLevel::None
+                  ? SkPDFStreamFormat::Uncompressed
+                  : SkPDFStreamFormat::Flate;
     SkDynamicMemoryWStream buffer;
     SkWStream* stream = &buffer;
     std::optional<SkDeflateWStream> deflateWStream;
-    if (format == SkPDFStreamFormat::Flate) {
+    if (image.fFormat == SkPDFStreamFormat::Flate) {
         deflateWStream.emplace(&buffer, SkToInt(compressionLevel));
         stream = &*deflateWStream;
     }
-    SkPDFUnion colorSpace = SkPDFUnion::Name("DeviceGray");
-    int channels;
     switch (pm.colorType()) {
         case kAlpha_8_SkColorType:
-            channels = 1;
+            image.fChannels = 1;
             fill_stream(stream, '\x00', pm.width() * pm.height());
             break;
         case kGray_8_SkColorType:
-            channels = 1;
-            SkASSERT(sMask.fValue = -1);
+            image.fChannels = 1;
+            SkASSERT(isOpaque);
             SkASSERT(pm.rowBytes() == (size_t)pm.width());
             stream->write(pm.addr8(), pm.width() * pm.height());
             break;
         default:
-            colorSpace = SkPDFUnion::Name("DeviceRGB");
-            channels = 3;
+            image.fChannels = 3;
             SkASSERT(pm.alphaType() == kUnpremul_SkAlphaType);
             SkASSERT(pm.colorType() == kBGRA_8888_SkColorType);
             SkASSERT(pm.rowBytes() == (size_t)pm.width() * 4);
@@ -249,36 +253,28 @@ void do_deflated_image(const SkPixmap& pm,
             }
             stream->write(byteBuffer, dst - byteBuffer);
     }
-    if (deflateWStream) {
-        deflateWStream->finalize();
-    }
+    image.fData = finish_stream(&buffer, &deflateWStream);
 
     if (pm.colorSpace()) {
         skcms_ICCProfile iccProfile;
         pm.colorSpace()->toProfile(&iccProfile);
-        sk_sp<SkData> iccData = SkWriteICCProfile(&iccProfile, "");
-        colorSpace = write_icc_profile(doc, std::move(iccData), channels);
+        image.fICCProfile = SkWriteICCProfile(&iccProfile, "");
     }
-
-    #ifdef SK_PDF_BASE85_BINARY
-    SkPDFUtils::Base85Encode(buffer.detachAsStream(), &buffer);
-    #endif
-    int length = SkToInt(buffer.bytesWritten());
-    emit_image_stream(doc, ref, [&buffer](SkWStream* stream) { buffer.writeToAndReset(stream); },
-                      pm.info().dimensions(), std::move(colorSpace), sMask, length, format);
     if (!isOpaque) {
-        do_deflated_alpha(pm, doc, sMask);
+        image.fAlphaData = deflate_alpha(pm, compressionLevel);
     }
+    return image;
 }
 
-bool do_jpeg(sk_sp<SkData> data, SkColorSpace* imageColorSpace, SkPDFDocument* doc, SkISize size,
-             SkPDFIndirectReference ref) {
+std::optional<SkPDFEncodedImage> encode_jpeg(sk_sp<SkData> data,
+                                             SkColorSpace* imageColorSpace,
+                                             SkISize size) {
     static constexpr const SkCodecs::Decoder decoders[] = {
         SkJpegDecoder::Decoder(),
     };
     std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data, decoders);
     if (!codec) {
-        return false;
+        return std::nullopt;
     }
 
     SkISize jpegSize = codec->dimensions();
@@ -287,11 +283,17 @@ bool do_jpeg(sk_sp<SkData> data, SkColorSpace* imageColorSpace, SkPDFDocument* d
     SkEncodedOrigin exifOrientation = codec->getOrigin();
 
     bool yuv = jpegColorType == SkEncodedInfo::kYUV_Color;
-    bool goodColorType = yuv || jpegColorType == SkEncodedInfo::kGray_Color;
-    if (jpegSize != size  // Safety check.
-            || !goodColorType
-            || kTopLeft_SkEncodedOrigin != exifOrientation) {
-        return false;
+    // Like SkJpegCodec, we take CMYK to be Adobe's inverted CMYK. DCTDecode turns YCCK into it.
+    bool cmyk = jpegColorType == SkEncodedInfo::kInvertedCMYK_Color ||
+                jpegColorType == SkEncodedInfo::kYCCK_Color;
+    bool goodColorType = yuv || cmyk || jpegColorType == SkEncodedInfo::kGray_Color;
+    // The image's dimensions have the EXIF orientation applied, and the JPEG's don't.
+    SkISize orientedSize = SkEncodedOriginSwapsWidthHeight(exifOrientation)
+                                   ? SkISize{jpegSize.height(), jpegSize.width()}
+                                   : jpegSize;
+    if (orientedSize != size  // Safety check.
+            || !goodColorType) {
+        return std::nullopt;
     }
     #ifdef SK_PDF_BASE85_BINARY
     SkDynamicMemoryWStream buffer;
@@ -299,25 +301,28 @@ bool do_jpeg(sk_sp<SkData> data, SkColorSpace* imageColorSpace, SkPDFDocument* d
     data = buffer.detachAsData();
     #endif
 
-    int channels = yuv ? 3 : 1;
-    SkPDFUnion colorSpace = yuv ? SkPDFUnion::Name("DeviceRGB") : SkPDFUnion::Name("DeviceGray");
-    if (sk_sp<SkData> encodedIccProfileData = encodedInfo.profileData()) {
-        colorSpace = write_icc_profile(doc, std::move(encodedIccProfileData), channels);
+    SkPDFEncodedImage image;
+    image.fDimensions = jpegSize;
+    image.fFormat = SkPDFStreamFormat::DCT;
+    image.fChannels = cmyk ? 4 : yuv ? 3 : 1;
+    image.fData = std::move(data);
+    image.fOrigin = exifOrientation;
+    if (cmyk) {
+        // Only a CMYK profile can describe CMYK data, and otherwise we use DeviceCMYK.
+        const skcms_ICCProfile* profile = encodedInfo.profile();
+        if (profile && profile->data_color_space == skcms_Signature_CMYK) {
+            image.fICCProfile = encodedInfo.profileData();
+        }
+    } else if (sk_sp<SkData> encodedIccProfileData = encodedInfo.profileData()) {
+        image.fICCProfile = std::move(encodedIccProfileData);
     } else if (const skcms_ICCProfile* codecIccProfile = codec->getICCProfile()) {
-        sk_sp<SkData> codecIccData = SkWriteICCProfile(codecIccProfile, "");
-        colorSpace = write_icc_profile(doc, std::move(codecIccData), channels);
+        image.fICCProfile = SkWriteICCProfile(codecIccProfile, "");
     } else if (imageColorSpace) {
         skcms_ICCProfile imageIccProfile;
         imageColorSpace->toProfile(&imageIccProfile);
-        sk_sp<SkData> imageIccData = SkWriteICCProfile(&imageIccProfile, "");
-        colorSpace = write_icc_profile(doc, std::move(imageIccData), channels);
+        image.fICCProfile = SkWriteICCProfile(&imageIccProfile, "");
     }
-
-    emit_image_stream(doc, ref,
-                      [&data](SkWStream* dst) { dst->write(data->data(), data->size()); },
-                      jpegSize, std::move(colorSpace),
-                      SkPDFIndirectReference(), SkToInt(data->size()), SkPDFStreamFormat::DCT);
-    return true;
+    return image;
 }
 
 SkBitmap to_pixels(const SkImage* image) {
@@ -345,18 +350,16 @@ SkBitmap to_pixels(const SkImage* image) {
     return bm;
 }
 
-void serialize_image(const SkImage* img,
-                     int encodingQuality,
-                     SkPDFDocument* doc,
-                     SkPDFIndirectReference ref) {
+SkPDFEncodedImage encode_image(const SkImage* img,
+                               int encodingQuality,
+                               SkPDF::Metadata::CompressionLevel compressionLevel) {
     SkASSERT(img);
-    SkASSERT(doc);
     SkASSERT(encodingQuality >= 0);
     SkISize dimensions = img->dimensions();
 
     if (sk_sp<SkData> data = img->refEncodedData()) {
-        if (do_jpeg(std::move(data), img->colorSpace(), doc, dimensions, ref)) {
-            return;
+        if (auto image = encode_jpeg(std::move(data), img->colorSpace(), dimensions)) {
+            return *image;
         }
     }
     SkBitmap bm = to_pixels(img);
@@ -367,16 +370,118 @@ void serialize_image(const SkImage* img,
         jOpts.fQuality = encodingQuality;
         SkDynamicMemoryWStream stream;
         if (SkJpegEncoder::Encode(&stream, pm, jOpts)) {
-            if (do_jpeg(stream.detachAsData(), pm.colorSpace(), doc, dimensions, ref)) {
-                return;
+            if (auto image = encode_jpeg(stream.detachAsData(), pm.colorSpace(), dimensions)) {
+                return *image;
             }
         }
     }
-    do_deflated_image(pm, doc, isOpaque, ref);
+    return deflate_image(pm, isOpaque, compressionLevel);
+}
+
+// Draws the image XObject at imageRef, stored in the given orientation, into the unit square with
+// that orientation undone, as a Form XObject at ref. It draws just like an image XObject would.
+void emit_oriented_image(SkPDFDocument* doc,
+                         SkPDFIndirectReference ref,
+                         SkPDFIndirectReference imageRef,
+                         SkEncodedOrigin origin) {
+    // Image space puts the first row at the top of the unit square.
+    const SkMatrix flip = SkMatrix::MakeAll(1, 0, 0, 0, -1, 1, 0, 0, 1);
+    SkMatrix matrix = SkMatrix::Concat(flip, SkEncodedOriginToMatrix(origin, 1, 1));
+    matrix.preConcat(flip);
+
+    SkDynamicMemoryWStream content;
+    SkPDFUtils::AppendTransform(matrix, &content);
+    SkPDFWriteResourceName(&content, SkPDFResourceType::kXObject, imageRef.fValue);
+    content.writeText(" Do\n");
+    sk_sp<SkData> data = content.detachAsData();
+
+    SkPDFDict pdfDict("XObject");
+    pdfDict.insertName("Subtype", "Form");
+    pdfDict.insertObject("BBox", SkPDFMakeArray(0, 0, 1, 1));
+    pdfDict.insertObject("Resources", SkPDFMakeResourceDict({}, {}, {imageRef}, {}));
+    pdfDict.insertInt("Length", SkToInt(data->size()));
+    doc->emitStream(pdfDict, [&data](SkWStream* dst) { dst->write(data->data(), data->size()); },
+                    ref);
+}
+
+void emit_image(const SkPDFEncodedImage& image, SkPDFDocument* doc, SkPDFIndirectReference ref) {
+    SkPDFIndirectReference sMask;
+    if (image.fAlphaData) {
+        sMask = doc->reserveRef();
+    }
+    SkPDFIndirectReference imageRef = ref;
+    if (image.fOrigin != kTopLeft_SkEncodedOrigin) {
+        imageRef = doc->reserveRef();
+        emit_oriented_image(doc, ref, imageRef, image.fOrigin);
+    }
+    SkPDFUnion colorSpace = image.fChannels == 4 ? SkPDFUnion::Name("DeviceCMYK")
+                          : image.fChannels == 3 ? SkPDFUnion::Name("DeviceRGB")
+                                                 : SkPDFUnion::Name("DeviceGray");
+    if (image.fICCProfile) {
+        colorSpace = write_icc_profile(doc, sk_sp<SkData>(image.fICCProfile), image.fChannels);
+    }
+    const SkData* data = image.fData.get();
+    emit_image_stream(doc, imageRef,
+                      [data](SkWStream* dst) { dst->write(data->data(), data->size()); },
+                      image.fDimensions, std::move(colorSpace), sMask, SkToInt(data->size()),
+                      image.fFormat, /*invertCMYK=*/image.fChannels == 4);
+    if (const SkData* alpha = image.fAlphaData.get()) {
+        emit_image_stream(doc, sMask,
+                          [alpha](SkWStream* dst) { dst->write(alpha->data(), alpha->size()); },
+                          image.fDimensions, SkPDFUnion::Name("DeviceGray"),
+                          SkPDFIndirectReference(), SkToInt(alpha->size()), image.fFormat);
+    }
+}
+
+void serialize_image(const SkImage* img,
+                     int encodingQuality,
+                     SkPDFDocument* doc,
+                     SkPDFIndirectReference ref) {
+    SkASSERT(img);
+    SkASSERT(doc);
+    const SkPDF::Metadata::CompressionLevel compressionLevel = doc->metadata().fCompressionLevel;
+    SkPDFSharedCache* cache = SkPDFSharedCache::Get(doc);
+    if (cache) {
+        if (auto image = cache->findImage(img->uniqueID(), encodingQuality,
+                                          SkToInt(compressionLevel))) {
+            emit_image(*image, doc, ref);
+            return;
+        }
+    }
+    SkPDFEncodedImage image = encode_image(img, encodingQuality, compressionLevel);
+    if (cache) {
+        cache->addImage(img->uniqueID(), encodingQuality, SkToInt(compressionLevel), image);
+    }
+    emit_image(image, doc, ref);
 }
 
 } // namespace
 
+std::optional<SkMD5::Digest> SkPDFImageDigest(const SkImage* img) {
+    SkASSERT(img);
+    SkMD5 md5;
+    auto write = [&md5](auto value) { md5.write(&value, sizeof(value)); };
+    write(img->width());
+    write(img->height());
+    write(img->colorType());
+    write(img->alphaType());
+    write(img->colorSpace() ? img->colorSpace()->hash() : 0);
+    if (sk_sp<SkData> data = img->refEncodedData()) {
+        write('E');
+        md5.write(data->data(), data->size());
+        return md5.finish();
+    }
+    SkPixmap pm;
+    if (!img->peekPixels(&pm)) {
+        return std::nullopt;
+    }
+    write('P');
+    for (int y = 0; y < pm.height(); ++y) {
+        md5.write(pm.addr(0, y), pm.info().minRowBytes());
+    }
+    return md5.finish();
+}
+
 SkPDFIndirectReference SkPDFSerializeImage(const SkImage* img,
                                            SkPDFDocument* doc,
                                            int encodingQuality) {
@@ -9,6 +9,9 @@
 
 #include "include/core/SkData.h"
 #include "src/core/SkChecksum.h"
+#include "src/core/SkMD5.h"
+
+#include <optional>
 
 class SkCodec;
 class SkImage;
@@ -24,6 +27,13 @@ SkPDFIndirectReference SkPDFSerializeImage(const SkImage* img,
                                            SkPDFDocument* doc,
                                            int encodingQuality = 101);
 
+/**
+ * A digest of what SkPDFSerializeImage() encodes from an image: its encoded data if it has any,
+ * otherwise its pixels. Images with the same digest can share one Image XObject.
+ * Empty if the image's pixels can't be read without drawing it.
+ */
+std::optional<SkMD5::Digest> SkPDFImageDigest(const SkImage* img);
+
 class SkPDFBitmap {
 public:
     static const SkEncodedInfo& GetEncodedInfo(SkCodec&);
@@ -53,6 +53,7 @@
 #include "src/text/GlyphRun.h"
 #include "src/utils/SkClipStackUtils.h"
 
+#include <optional>
 #include <vector>
 
 using namespace skia_private;
@@ -1704,8 +1705,19 @@ void SkPDFDevice::internalDrawImageRect(SkKeyedImage imageSubset,
     SkPDFIndirectReference pdfimage = pdfimagePtr ? *pdfimagePtr : SkPDFIndirectReference();
     if (!pdfimagePtr) {
         SkASSERT(imageSubset);
-        pdfimage = SkPDFSerializeImage(imageSubset.image().get(), fDocument,
-                                       fDocument->metadata().fEncodingQuality);
+        // Images with different IDs, like the same picture decoded twice, or the same filter
+        // applied to the same image twice, often still have the same contents.
+        std::optional<SkMD5::Digest> digest = SkPDFImageDigest(imageSubset.image().get());
+        if (SkPDFIndirectReference* same =
+                    digest ? fDocument->fPDFImageDigestMap.find(*digest) : nullptr) {
+            pdfimage = *same;
+        } else {
+            pdfimage = SkPDFSerializeImage(imageSubset.image().get(), fDocument,
+                                           fDocument->metadata().fEncodingQuality);
+            if (digest) {
+                fDocument->fPDFImageDigestMap.set(*digest, pdfimage);
+            }
+        }
         SkASSERT((key != SkBitmapKey{{0, 0, 0, 0}, 0}));
         fDocument->fPDFBitmapMap.set(key, pdfimage);
     }
@@ -137,7 +137,7 @@ public:
     SkExecutor* executor() const { return fExecutor; }
     void incrementJobCount();
     void signalJobComplete();
-    size_t currentPageIndex() { return fPages.size(); }
+    size_t currentPageIndex() { return fEndedPageCount; }
     size_t pageCount() { return fPageRefs.size(); }
 
     const SkMatrix& currentPageTransform() const;
@@ -150,6 +150,7 @@ public:
                            SkPDFIndirectReference,
                            SkPDFGradientShader::KeyHash> fGradientPatternMap;
     skia_private::THashMap<SkBitmapKey, SkPDFIndirectReference> fPDFBitmapMap;
+    skia_private::THashMap<SkMD5::Digest, SkPDFIndirectReference, SkGoodHash> fPDFImageDigestMap;
     skia_private::THashMap<SkPDFIccProfileKey,
                            SkPDFIndirectReference,
                            SkPDFIccProfileKey::Hash> fICCProfileMap;
@@ -175,6 +176,9 @@ private:
     SkCanvas fCanvas;
     std::vector<std::unique_ptr<SkPDFDict>> fPages;
     std::vector<SkPDFIndirectReference> fPageRefs;
+    // With fStreamPages, the page tree parents reserved for each run of emitted pages.
+    std::vector<SkPDFIndirectReference> fPageTreeParentRefs;
+    size_t fEndedPageCount = 0;
 
     sk_sp<SkPDFDevice> fPageDevice;
     std::atomic<int> fNextObjectNumber = {1};
@@ -41,6 +41,7 @@
 #include "src/pdf/SkPDFFormXObject.h"
 #include "src/pdf/SkPDFMakeCIDGlyphWidthsArray.h"
 #include "src/pdf/SkPDFMakeToUnicodeCmap.h"
+#include "src/pdf/SkPDFSharedCache.h"
 #include "src/pdf/SkPDFSubsetFont.h"
 #include "src/pdf/SkPDFType1Font.h"
 #include "src/pdf/SkPDFUtils.h"
@@ -49,6 +50,7 @@
 #include <initializer_list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 void SkPDFFont::GetType1GlyphNames(const SkTypeface& face, SkString* dst) {
     face.getPostScriptGlyphNames(dst);
@@ -296,6 +298,35 @@ static sk_sp<SkData> stream_to_data(std::unique_ptr<SkStreamAsset> stream) {
     return SkData::MakeFromStream(stream.get(), size);
 }
 
+// Subsets the font to the glyphs used, or finds that subset in the document's shared cache.
+static sk_sp<SkData> subset_font(const SkTypeface& typeface,
+                                 std::unique_ptr<SkStreamAsset> fontAsset,
+                                 int ttcIndex,
+                                 const SkPDFGlyphUse& glyphUsage,
+                                 const char* fontName,
+                                 SkPDFDocument* doc) {
+    const SkPDF::Metadata::Subsetter subsetter = doc->metadata().fSubsetter;
+    SkPDFSharedCache* cache = SkPDFSharedCache::Get(doc);
+    if (!cache) {
+        return SkPDFSubsetFont(stream_to_data(std::move(fontAsset)), glyphUsage, subsetter,
+                               fontName, ttcIndex);
+    }
+    std::vector<SkGlyphID> glyphIDs;
+    glyphUsage.getSetValues([&glyphIDs](unsigned gid) { glyphIDs.push_back(SkToU16(gid)); });
+    sk_sp<SkData> glyphs = SkData::MakeWithCopy(glyphIDs.data(),
+                                                glyphIDs.size() * sizeof(SkGlyphID));
+    if (sk_sp<SkData> subset =
+                cache->findFontSubset(typeface.uniqueID(), ttcIndex, subsetter, *glyphs)) {
+        return subset;
+    }
+    sk_sp<SkData> subset = SkPDFSubsetFont(stream_to_data(std::move(fontAsset)), glyphUsage,
+                                           subsetter, fontName, ttcIndex);
+    if (subset) {
+        cache->addFontSubset(typeface.uniqueID(), ttcIndex, subsetter, std::move(glyphs), subset);
+    }
+    return subset;
+}
+
 static void emit_subset_type0(const SkPDFFont& font, SkPDFDocument* doc) {
     const SkAdvancedTypefaceMetrics* metricsPtr =
         SkPDFFont::GetMetrics(font.typeface(), doc);
@@ -324,18 +355,21 @@ static void emit_subset_type0(const SkPDFFont& font, SkPDFDocument* doc) {
                 if (!SkToBool(metrics.fFlags &
                               SkAdvancedTypefaceMetrics::kNotSubsettable_FontFlag)) {
                     SkASSERT(font.firstGlyphID() == 1);
-                    sk_sp<SkData> subsetFontData = SkPDFSubsetFont(
-                            stream_to_data(std::move(fontAsset)), font.glyphUsage(),
-                            doc->metadata().fSubsetter,
-                            metrics.fFontName.c_str(), ttcIndex);
+                    sk_sp<SkData> subsetFontData = font.preparedSubset();
+                    if (!subsetFontData) {
+                        subsetFontData = subset_font(*face, std::move(fontAsset), ttcIndex,
+                                                     font.glyphUsage(),
+                                                     metrics.fFontName.c_str(), doc);
+                    }
                     if (subsetFontData) {
                         std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
                         tmp->insertInt("Length1", SkToInt(subsetFontData->size()));
                         descriptor->insertRef(
                                 "FontFile2",
-                                SkPDFStreamOut(std::move(tmp),
-                                               SkMemoryStream::Make(std::move(subsetFontData)),
-                                               doc, SkPDFSteamCompressionEnabled::Yes));
+                                SkPDFFontStreamOut(
+                                        std::move(tmp),
+                                        SkMemoryStream::Make(std::move(subsetFontData)),
+                                        doc));
                         break;
                     }
                     // If subsetting fails, fall back to original font data.
@@ -346,17 +380,15 @@ static void emit_subset_type0(const SkPDFFont& font, SkPDFDocument* doc) {
                 }
                 std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
                 tmp->insertInt("Length1", fontSize);
-                descriptor->insertRef("FontFile2",
-                                      SkPDFStreamOut(std::move(tmp), std::move(fontAsset),
-                                                     doc, SkPDFSteamCompressionEnabled::Yes));
+                descriptor->insertRef(
+                        "FontFile2", SkPDFFontStreamOut(std::move(tmp), std::move(fontAsset), doc));
                 break;
             }
             case SkAdvancedTypefaceMetrics::kType1CID_Font: {
                 std::unique_ptr<SkPDFDict> tmp = SkPDFMakeDict();
                 tmp->insertName("Subtype", "CIDFontType0C");
-                descriptor->insertRef("FontFile3",
-                                      SkPDFStreamOut(std::move(tmp), std::move(fontAsset),
-                                                     doc, SkPDFSteamCompressionEnabled::Yes));
+                descriptor->insertRef(
+                        "FontFile3", SkPDFFontStreamOut(std::move(tmp), std::move(fontAsset), doc));
                 break;
             }
             default:
@@ -704,6 +736,25 @@ static void emit_subset_type3(const SkPDFFont& pdfFont, SkPDFDocument* doc) {
     doc->emit(font, pdfFont.indirectReference());
 }
 
+void SkPDFFont::prepareSubset(SkPDFDocument* doc) {
+    if (fFontType != SkAdvancedTypefaceMetrics::kTrueType_Font) {
+        return;
+    }
+    // All fonts' metrics were cached when they were made, so this only reads the document.
+    const SkAdvancedTypefaceMetrics* metrics = SkPDFFont::GetMetrics(this->typeface(), doc);
+    if (!metrics || !can_embed(*metrics) ||
+        SkToBool(metrics->fFlags & SkAdvancedTypefaceMetrics::kNotSubsettable_FontFlag)) {
+        return;
+    }
+    int ttcIndex;
+    std::unique_ptr<SkStreamAsset> fontAsset = this->typeface()->openStream(&ttcIndex);
+    if (!fontAsset || fontAsset->getLength() == 0) {
+        return;
+    }
+    fPreparedSubset = subset_font(*this->typeface(), std::move(fontAsset), ttcIndex, fGlyphUsage,
+                                  metrics->fFontName.c_str(), doc);
+}
+
 void SkPDFFont::emitSubset(SkPDFDocument* doc) const {
     switch (fFontType) {
         case SkAdvancedTypefaceMetrics::kType1CID_Font:
@@ -7,6 +7,7 @@
 #ifndef SkPDFFont_DEFINED
 #define SkPDFFont_DEFINED
 
+#include "include/core/SkData.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypeface.h"
 #include "include/core/SkTypes.h"
@@ -108,6 +109,14 @@ public:
 
     void emitSubset(SkPDFDocument*) const;
 
+    /**
+     *  Subsetting the font program is most of the cost of emitSubset() for
+     *  TrueType fonts, and only reads the typeface and glyph usage. This does
+     *  it ahead of time, and may be called concurrently for different fonts
+     *  once all pages are done, so emitSubset() can still emit objects in order.
+     */
+    void prepareSubset(SkPDFDocument*);
+
     /**
      *  Return false iff the typeface has its NotEmbeddable flag set.
      *  typeface is not nullptr
@@ -117,6 +126,7 @@ public:
     SkGlyphID firstGlyphID() const { return fGlyphUsage.firstNonZero(); }
     SkGlyphID lastGlyphID() const { return fGlyphUsage.lastGlyph(); }
     const SkPDFGlyphUse& glyphUsage() const { return fGlyphUsage; }
+    const sk_sp<SkData>& preparedSubset() const { return fPreparedSubset; }
     sk_sp<SkTypeface> refTypeface() const { return fTypeface; }
 
 private:
@@ -124,6 +134,7 @@ private:
     SkPDFGlyphUse fGlyphUsage;
     SkPDFIndirectReference fIndirectReference;
     SkAdvancedTypefaceMetrics::FontType fFontType;
+    sk_sp<SkData> fPreparedSubset;
 
     SkPDFFont(sk_sp<SkTypeface>,
               SkGlyphID firstGlyphID,
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/pdf/SkPDFSharedCache.h"
+
+#include "src/core/SkChecksum.h"
+#include "src/pdf/SkPDFDocumentPriv.h"
+
+#include <utility>
+
+namespace {
+enum Kind : uint32_t { kImage, kFontSubset };
+
+size_t size_of(const sk_sp<SkData>& data) { return data ? data->size() : 0; }
+}  // namespace
+
+struct SkPDFSharedCache::Entry {
+    Key fKey;
+    SkPDFEncodedImage fImage;  // For images.
+    sk_sp<SkData> fGlyphs;     // For font subsets; compared, since the key only has their hash.
+    sk_sp<SkData> fSubset;     // For font subsets.
+
+    size_t bytes() const {
+        return sizeof(Entry) + size_of(fImage.fICCProfile) + size_of(fImage.fData) +
+               size_of(fImage.fAlphaData) + size_of(fGlyphs) + size_of(fSubset);
+    }
+
+    SK_DECLARE_INTERNAL_LLIST_INTERFACE(Entry);
+};
+
+sk_sp<SkPDF::SharedCache> SkPDF::SharedCache::Make(size_t byteLimit) {
+    return sk_make_sp<SkPDFSharedCache>(byteLimit);
+}
+
+SkPDFSharedCache::SkPDFSharedCache(size_t byteLimit) : fByteLimit(byteLimit) {}
+
+SkPDFSharedCache::~SkPDFSharedCache() {
+    while (Entry* entry = fLRU.head()) {
+        fLRU.remove(entry);
+        delete entry;
+    }
+}
+
+SkPDFSharedCache* SkPDFSharedCache::Get(const SkPDFDocument* doc) {
+    return static_cast<SkPDFSharedCache*>(doc->metadata().fSharedCache.get());
+}
+
+SkPDFSharedCache::Entry* SkPDFSharedCache::find(const Key& key) {
+    Entry** entry = fMap.find(key);
+    if (!entry) {
+        return nullptr;
+    }
+    fLRU.remove(*entry);
+    fLRU.addToHead(*entry);
+    return *entry;
+}
+
+void SkPDFSharedCache::add(Entry* entry) {
+    // Another document may have added the same thing while we were encoding it.
+    if (Entry** existing = fMap.find(entry->fKey)) {
+        fBytes -= (*existing)->bytes();
+        fLRU.remove(*existing);
+        delete *existing;
+    }
+    fMap.set(entry->fKey, entry);
+    fLRU.addToHead(entry);
+    fBytes += entry->bytes();
+    while (fBytes > fByteLimit) {
+        Entry* lru = fLRU.tail();
+        fBytes -= lru->bytes();
+        fMap.remove(lru->fKey);
+        fLRU.remove(lru);
+        delete lru;
+    }
+}
+
+std::optional<SkPDFEncodedImage> SkPDFSharedCache::findImage(uint32_t imageID,
+                                                             int encodingQuality,
+                                                             int compressionLevel) {
+    SkAutoMutexExclusive lock(fMutex);
+    if (Entry* entry = this->find({kImage, imageID, encodingQuality, compressionLevel, 0})) {
+        return entry->fImage;
+    }
+    return std::nullopt;
+}
+
+void SkPDFSharedCache::addImage(uint32_t imageID,
+                                int encodingQuality,
+                                int compressionLevel,
+                                const SkPDFEncodedImage& image) {
+    auto entry = new Entry{{kImage, imageID, encodingQuality, compressionLevel, 0}, image,
+                           nullptr, nullptr};
+    SkAutoMutexExclusive lock(fMutex);
+    this->add(entry);
+}
+
+sk_sp<SkData> SkPDFSharedCache::findFontSubset(uint32_t typefaceID,
+                                               int ttcIndex,
+                                               int subsetter,
+                                               const SkData& glyphs) {
+    const uint32_t hash = SkChecksum::Hash32(glyphs.data(), glyphs.size());
+    SkAutoMutexExclusive lock(fMutex);
+    Entry* entry = this->find({kFontSubset, typefaceID, ttcIndex, subsetter, hash});
+    if (entry && entry->fGlyphs->equals(&glyphs)) {
+        return entry->fSubset;
+    }
+    return nullptr;
+}
+
+void SkPDFSharedCache::addFontSubset(uint32_t typefaceID,
+                                     int ttcIndex,
+                                     int subsetter,
+                                     sk_sp<SkData> glyphs,
+                                     sk_sp<SkData> subset) {
+    const uint32_t hash = SkChecksum::Hash32(glyphs->data(), glyphs->size());
+    auto entry = new Entry{{kFontSubset, typefaceID, ttcIndex, subsetter, hash}, {},
+                           std::move(glyphs), std::move(subset)};
+    SkAutoMutexExclusive lock(fMutex);
+    this->add(entry);
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkPDFSharedCache_DEFINED
+#define SkPDFSharedCache_DEFINED
+
+#include "include/codec/SkEncodedOrigin.h"
+#include "include/core/SkData.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkSize.h"
+#include "include/docs/SkPDFDocument.h"
+#include "include/private/base/SkMutex.h"
+#include "src/base/SkTInternalLList.h"
+#include "src/core/SkTHash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+class SkPDFDocument;
+
+enum class SkPDFStreamFormat { DCT, Flate, Uncompressed };
+
+// An image's streams, encoded and ready to be emitted into any document.
+struct SkPDFEncodedImage {
+    SkISize           fDimensions;
+    SkPDFStreamFormat fFormat;
+    int               fChannels;    // 1 for gray, 3 for RGB, 4 for (Adobe's inverted) CMYK.
+    sk_sp<SkData>     fICCProfile;  // If null, the color space is DeviceGray or DeviceRGB.
+    sk_sp<SkData>     fData;
+    sk_sp<SkData>     fAlphaData;   // The soft mask, in fFormat; null if the image is opaque.
+    SkEncodedOrigin   fOrigin = kTopLeft_SkEncodedOrigin;  // EXIF orientation, for DCT.
+};
+
+class SkPDFSharedCache final : public SkPDF::SharedCache {
+public:
+    explicit SkPDFSharedCache(size_t byteLimit);
+    ~SkPDFSharedCache() override;
+
+    // The cache in doc's metadata, if any.
+    static SkPDFSharedCache* Get(const SkPDFDocument* doc);
+
+    // Images are keyed by uniqueID and by the settings they were encoded with.
+    std::optional<SkPDFEncodedImage> findImage(uint32_t imageID,
+                                               int encodingQuality,
+                                               int compressionLevel);
+    void addImage(uint32_t imageID,
+                  int encodingQuality,
+                  int compressionLevel,
+                  const SkPDFEncodedImage&);
+
+    // Font subsets are keyed by typeface, by the glyphs kept (an array of SkGlyphIDs), and by the
+    // subsetter that made them.
+    sk_sp<SkData> findFontSubset(uint32_t typefaceID,
+                                 int ttcIndex,
+                                 int subsetter,
+                                 const SkData& glyphs);
+    void addFontSubset(uint32_t typefaceID,
+                       int ttcIndex,
+                       int subsetter,
+                       sk_sp<SkData> glyphs,
+                       sk_sp<SkData> subset);
+
+private:
+    struct Key {
+        uint32_t fKind;
+        uint32_t fID;
+        int32_t  fA;
+        int32_t  fB;
+        uint32_t fHash;  // Of the glyphs, for font subsets.
+
+        bool operator==(const Key& that) const {
+            return fKind == that.fKind && fID == that.fID && fA == that.fA && fB == that.fB &&
+                   fHash == that.fHash;
+        }
+    };
+    struct Entry;
+
+    Entry* find(const Key&);
+    void add(Entry*);
+
+    SkMutex fMutex;
+    skia_private::THashMap<Key, Entry*, SkGoodHash> fMap SK_GUARDED_BY(fMutex);
+    SkTInternalLList<Entry> fLRU SK_GUARDED_BY(fMutex);
+    size_t fBytes SK_GUARDED_BY(fMutex) = 0;
+    const size_t fByteLimit;
+};
+
+#endif  // SkPDFSharedCache_DEFINED
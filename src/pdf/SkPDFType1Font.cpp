@@ -249,8 +249,9 @@ static SkPDFIndirectReference make_type1_font_descriptor(SkPDFDocument* doc,
                 dict->insertInt("Length3", trailer);
                 auto fontStream = SkMemoryStream::Make(std::move(fontData));
                 descriptor.insertRef("FontFile",
-                                     SkPDFStreamOut(std::move(dict), std::move(fontStream),
-                                                    doc, SkPDFSteamCompressionEnabled::Yes));
+                                     SkPDFFontStreamOut(std::move(dict),
+                                                        std::move(fontStream),
+                                                        doc));
             }
         }
     }
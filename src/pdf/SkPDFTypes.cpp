@@ -535,9 +535,11 @@ void SkPDFDict::insertUnion(const char key[], SkPDFUnion&& value) {
 
 
 
+using CompressionLevel = SkPDF::Metadata::CompressionLevel;
+
 static void serialize_stream(SkPDFDict* origDict,
                              SkStreamAsset* stream,
-                             SkPDFSteamCompressionEnabled compress,
+                             CompressionLevel level,
                              SkPDFDocument* doc,
                              SkPDFIndirectReference ref) {
     // Code assumes that the stream starts at the beginning.
@@ -547,12 +549,17 @@ static void serialize_stream(SkPDFDict* origDict,
     SkPDFDict tmpDict;
     SkPDFDict& dict = origDict ? *origDict : tmpDict;
     static const size_t kMinimumSavings = strlen("/Filter_/FlateDecode_");
-    if (doc->metadata().fCompressionLevel != SkPDF::Metadata::CompressionLevel::None &&
-        compress == SkPDFSteamCompressionEnabled::Yes &&
-        stream->getLength() > kMinimumSavings)
-    {
+    #ifdef SK_PDF_BASE85_BINARY
+    // Binary streams have to be encoded, however short.
+    static const size_t kMinimumLengthToCompress = kMinimumSavings + 1;
+    #else
+    // Deflate rarely saves kMinimumSavings on streams this short (small ToUnicode maps, Type3
+    // glyphs, ...), and documents can hold many of them, so don't spend the time trying.
+    static const size_t kMinimumLengthToCompress = 64;
+    #endif
+    if (level != CompressionLevel::None && stream->getLength() >= kMinimumLengthToCompress) {
         SkDynamicMemoryWStream compressedData;
-        SkDeflateWStream deflateWStream(&compressedData,SkToInt(doc->metadata().fCompressionLevel));
+        SkDeflateWStream deflateWStream(&compressedData, SkToInt(level));
         SkStreamCopy(&deflateWStream, stream);
         deflateWStream.finalize();
         #ifdef SK_PDF_BASE85_BINARY
@@ -582,10 +589,10 @@ static void serialize_stream(SkPDFDict* origDict,
                     ref);
 }
 
-SkPDFIndirectReference SkPDFStreamOut(std::unique_ptr<SkPDFDict> dict,
-                                      std::unique_ptr<SkStreamAsset> content,
-                                      SkPDFDocument* doc,
-                                      SkPDFSteamCompressionEnabled compress) {
+static SkPDFIndirectReference stream_out(std::unique_ptr<SkPDFDict> dict,
+                                         std::unique_ptr<SkStreamAsset> content,
+                                         SkPDFDocument* doc,
+                                         CompressionLevel level) {
     SkPDFIndirectReference ref = doc->reserveRef();
     if (SkExecutor* executor = doc->executor()) {
         SkPDFDict* dictPtr = dict.release();
@@ -593,14 +600,35 @@ SkPDFIndirectReference SkPDFStreamOut(std::unique_ptr<SkPDFDict> dict,
         // Pass ownership of both pointers into a std::function, which should
         // only be executed once.
         doc->incrementJobCount();
-        executor->add([dictPtr, contentPtr, compress, doc, ref]() {
-            serialize_stream(dictPtr, contentPtr, compress, doc, ref);
+        executor->add([dictPtr, contentPtr, level, doc, ref]() {
+            serialize_stream(dictPtr, contentPtr, level, doc, ref);
             delete dictPtr;
             delete contentPtr;
             doc->signalJobComplete();
         });
         return ref;
     }
-    serialize_stream(dict.get(), content.get(), compress, doc, ref);
+    serialize_stream(dict.get(), content.get(), level, doc, ref);
     return ref;
 }
+
+SkPDFIndirectReference SkPDFStreamOut(std::unique_ptr<SkPDFDict> dict,
+                                      std::unique_ptr<SkStreamAsset> content,
+                                      SkPDFDocument* doc,
+                                      SkPDFSteamCompressionEnabled compress) {
+    CompressionLevel level = compress == SkPDFSteamCompressionEnabled::Yes
+                           ? doc->metadata().fCompressionLevel
+                           : CompressionLevel::None;
+    return stream_out(std::move(dict), std::move(content), doc, level);
+}
+
+SkPDFIndirectReference SkPDFFontStreamOut(std::unique_ptr<SkPDFDict> dict,
+                                          std::unique_ptr<SkStreamAsset> content,
+                                          SkPDFDocument* doc) {
+    CompressionLevel level = doc->metadata().fCompressionLevel;
+    if (level != CompressionLevel::None &&
+        doc->metadata().fFontCompressionLevel != CompressionLevel::Default) {
+        level = doc->metadata().fFontCompressionLevel;
+    }
+    return stream_out(std::move(dict), std::move(content), doc, level);
+}
@@ -216,4 +216,10 @@ SkPDFIndirectReference SkPDFStreamOut(
     std::unique_ptr<SkStreamAsset> stream,
     SkPDFDocument* doc,
     SkPDFSteamCompressionEnabled compress = SkPDFSteamCompressionEnabled::Default);
+
+// Like SkPDFStreamOut(), for font programs, which are always compressed, at
+// SkPDF::Metadata::fFontCompressionLevel.
+SkPDFIndirectReference SkPDFFontStreamOut(std::unique_ptr<SkPDFDict> dict,
+                                          std::unique_ptr<SkStreamAsset> stream,
+                                          SkPDFDocument* doc);
 #endif
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkTypes.h"
+#include "include/private/chromium/SkDiscardableMemory.h"
+#include "src/lazy/SkDiscardableMemoryPool.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(MADV_FREE)
+
+namespace {
+
+/**
+ *  Discardable memory backed by its own anonymous pages. unlock() hands the pages to the kernel
+ *  with madvise(MADV_FREE), which lets it reclaim them lazily under memory pressure, and lock()
+ *  takes them back without copying if it hasn't.
+ *
+ *  A reclaimed page reads back as zeros, and writing to a page keeps the kernel from reclaiming
+ *  it. So unlock() stashes the first word of each page and replaces it with a nonzero cookie,
+ *  and lock() swaps each cookie back for its word with a compare-and-swap, which fails exactly
+ *  when that page has been reclaimed.
+ */
+class MadviseDiscardableMemory final : public SkDiscardableMemory {
+public:
+    static std::unique_ptr<MadviseDiscardableMemory> Make(size_t bytes);
+
+    ~MadviseDiscardableMemory() override { munmap(fPages, fPageCount * fPageSize); }
+
+    bool lock() override;
+    void* data() override;
+    void unlock() override;
+
+private:
+    static constexpr uint64_t kCookie = 0x5ce1d15ca4dab1e5;
+
+    MadviseDiscardableMemory(void* pages, size_t pageSize, size_t pageCount,
+                             std::unique_ptr<uint64_t[]> savedWords)
+            : fPages(pages)
+            , fPageSize(pageSize)
+            , fPageCount(pageCount)
+            , fSavedWords(std::move(savedWords)) {}
+
+    uint64_t* firstWord(size_t page) const {
+        return reinterpret_cast<uint64_t*>(static_cast<char*>(fPages) + page * fPageSize);
+    }
+
+    void* const                       fPages;
+    const size_t                      fPageSize;
+    const size_t                      fPageCount;
+    const std::unique_ptr<uint64_t[]> fSavedWords;
+    bool                              fLocked = true;
+};
+
+std::unique_ptr<MadviseDiscardableMemory> MadviseDiscardableMemory::Make(size_t bytes) {
+    const size_t pageSize = sysconf(_SC_PAGESIZE);
+    const size_t pageCount = std::max<size_t>(1, (bytes + pageSize - 1) / pageSize);
+    std::unique_ptr<uint64_t[]> savedWords(new (std::nothrow) uint64_t[pageCount]);
+    if (!savedWords) {
+        return nullptr;
+    }
+    void* pages = mmap(nullptr, pageCount * pageSize, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (pages == MAP_FAILED) {
+        return nullptr;
+    }
+    return std::unique_ptr<MadviseDiscardableMemory>(
+            new MadviseDiscardableMemory(pages, pageSize, pageCount, std::move(savedWords)));
+}
+
+bool MadviseDiscardableMemory::lock() {
+    SkASSERT(!fLocked);  // contract for SkDiscardableMemory
+    for (size_t i = 0; i < fPageCount; ++i) {
+        // Writing the word back also takes the page back from the kernel. If the page was
+        // reclaimed first, we read a fresh zero page instead of the cookie, and fail.
+        uint64_t expected = kCookie;
+        if (!__atomic_compare_exchange_n(this->firstWord(i), &expected, fSavedWords[i],
+                                         /*weak=*/false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+            return false;
+        }
+    }
+    fLocked = true;
+    return true;
+}
+
+void* MadviseDiscardableMemory::data() {
+    SkASSERT(fLocked);  // contract for SkDiscardableMemory
+    return fPages;
+}
+
+void MadviseDiscardableMemory::unlock() {
+    SkASSERT(fLocked);  // contract for SkDiscardableMemory
+    for (size_t i = 0; i < fPageCount; ++i) {
+        fSavedWords[i] = *this->firstWord(i);
+        *this->firstWord(i) = kCookie;
+    }
+    // Any write after this would take the page back, so the cookies have to be in place first.
+    madvise(fPages, fPageCount * fPageSize, MADV_FREE);
+    fLocked = false;
+}
+
+// MADV_FREE needs Linux 4.5. Older kernels reject it, so there we fall back to the pool.
+bool madv_free_supported() {
+    static const bool supported = [] {
+        const size_t pageSize = sysconf(_SC_PAGESIZE);
+        void* page = mmap(nullptr, pageSize, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (page == MAP_FAILED) {
+            return false;
+        }
+        bool ok = madvise(page, pageSize, MADV_FREE) == 0;
+        munmap(page, pageSize);
+        return ok;
+    }();
+    return supported;
+}
+
+}  // namespace
+
+SkDiscardableMemory* SkDiscardableMemory::Create(size_t bytes) {
+    if (madv_free_supported()) {
+        return MadviseDiscardableMemory::Make(bytes).release();
+    }
+    return SkGetGlobalDiscardableMemoryPool()->create(bytes);
+}
+
+#else
+
+SkDiscardableMemory* SkDiscardableMemory::Create(size_t bytes) {
+    return SkGetGlobalDiscardableMemoryPool()->create(bytes);
+}
+
+#endif  // defined(MADV_FREE)
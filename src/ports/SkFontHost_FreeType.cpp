@@ -187,6 +187,9 @@ private:
     // RHEL 8             2.9.1
 };
 
+// Guards the shared FT_Library: creating and destroying it, and opening and closing faces with it.
+// Once open, each face is guarded by its FaceRec's own mutex, so different faces can be used on
+// different threads at the same time.
 static SkMutex& f_t_mutex() {
     static SkMutex& mutex = *(new SkMutex);
     return mutex;
@@ -203,6 +206,12 @@ public:
     std::unique_ptr<SkStreamAsset> fSkStream;
     FT_UShort fFTPaletteEntryCount = 0;
     std::unique_ptr<SkColor[]> fSkPalette;
+    // Color glyphs are costly to record, and emoji are often drawn at many sizes.
+    SkScalerContext_FreeType_Base::ColorGlyphPictures fColorGlyphPictures{128};
+
+    // An FT_Face (with its sizes, glyph slot and stream) may only be used by one thread at a time.
+    // Lock this before touching fFace, but not to open or close it.
+    SkMutex fMutex;
 
     static std::unique_ptr<FaceRec> Make(const SkTypeface_FreeType* typeface);
     ~FaceRec();
@@ -417,13 +426,16 @@ SkTypeface_FreeType::FaceRec::Make(const SkTypeface_FreeType* typeface) {
 
 class AutoFTAccess {
 public:
-    AutoFTAccess(const SkTypeface_FreeType* tf) : fFaceRec(nullptr) {
-        f_t_mutex().acquire();
-        fFaceRec = tf->getFaceRec();
+    AutoFTAccess(const SkTypeface_FreeType* tf) : fFaceRec(tf->getFaceRec()) {
+        if (fFaceRec) {
+            fFaceRec->fMutex.acquire();
+        }
     }
 
     ~AutoFTAccess() {
-        f_t_mutex().release();
+        if (fFaceRec) {
+            fFaceRec->fMutex.release();
+        }
     }
 
     FT_Face face() { return fFaceRec ? fFaceRec->fFace.get() : nullptr; }
@@ -473,13 +485,13 @@ private:
     bool      fLCDIsVert;
 
     FT_Error setupSize();
-    // Caller must lock f_t_mutex() before calling this function.
+    // Caller must lock fFaceRec->fMutex before calling this function.
     static bool getBoundsOfCurrentOutlineGlyph(FT_GlyphSlot glyph, SkRect* bounds);
-    // Caller must lock f_t_mutex() before calling this function.
+    // Caller must lock fFaceRec->fMutex before calling this function.
     bool getCBoxForLetter(char letter, FT_BBox* bbox);
     static void updateGlyphBoundsIfSubpixel(const SkGlyph&, SkRect* bounds, bool subpixel);
     void updateGlyphBoundsIfLCD(GlyphMetrics* mx);
-    // Caller must lock f_t_mutex() before calling this function.
+    // Caller must lock fFaceRec->fMutex before calling this function.
     // update FreeType2 glyph slot with glyph emboldened
     void emboldenIfNeeded(FT_Face face, FT_GlyphSlot glyph, SkGlyphID gid);
     bool shouldSubpixelBitmap(const SkGlyph&, const SkMatrix&);
@@ -877,7 +889,6 @@ SkScalerContext_FreeType::SkScalerContext_FreeType(sk_sp<SkTypeface_FreeType> ty
     , fFTSize(nullptr)
     , fStrikeIndex(-1)
 {
-    SkAutoMutexExclusive  ac(f_t_mutex());
     fFaceRec = static_cast<SkTypeface_FreeType*>(this->getTypeface())->getFaceRec();
 
     // load the font file
@@ -885,6 +896,7 @@ SkScalerContext_FreeType::SkScalerContext_FreeType(sk_sp<SkTypeface_FreeType> ty
         LOG_INFO("Could not create FT_Face.\n");
         return;
     }
+    SkAutoMutexExclusive  ac(fFaceRec->fMutex);
 
     fLCDIsVert = SkToBool(fRec.fFlags & SkScalerContext::kLCD_Vertical_Flag);
 
@@ -1054,9 +1066,8 @@ SkScalerContext_FreeType::SkScalerContext_FreeType(sk_sp<SkTypeface_FreeType> ty
 }
 
 SkScalerContext_FreeType::~SkScalerContext_FreeType() {
-    SkAutoMutexExclusive  ac(f_t_mutex());
-
     if (fFTSize != nullptr) {
+        SkAutoMutexExclusive  ac(fFaceRec->fMutex);
         FT_Done_Size(fFTSize);
     }
 
@@ -1067,7 +1078,7 @@ SkScalerContext_FreeType::~SkScalerContext_FreeType() {
     this face with other context (at different sizes).
 */
 FT_Error SkScalerContext_FreeType::setupSize() {
-    f_t_mutex().assertHeld();
+    fFaceRec->fMutex.assertHeld();
     FT_Error err = FT_Activate_Size(fFTSize);
     if (err != 0) {
         return err;
@@ -1147,7 +1158,7 @@ bool SkScalerContext_FreeType::shouldSubpixelBitmap(const SkGlyph& glyph, const
 
 SkScalerContext::GlyphMetrics SkScalerContext_FreeType::generateMetrics(const SkGlyph& glyph,
                                                                         SkArenaAlloc* alloc) {
-    SkAutoMutexExclusive  ac(f_t_mutex());
+    SkAutoMutexExclusive  ac(fFaceRec->fMutex);
 
     GlyphMetrics mx(glyph.maskFormat());
 
@@ -1282,7 +1293,8 @@ SkScalerContext::GlyphMetrics SkScalerContext_FreeType::generateMetrics(const Sk
             sk_sp<SkBBoxHierarchy> bboxh = SkRTreeFactory()();
             SkSpan<SkColor> palette(fFaceRec->fSkPalette.get(), fFaceRec->fFTPaletteEntryCount);
             SkCanvas* recordingCanvas = recorder.beginRecording(infiniteRect, bboxh);
-            if (!this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette, recordingCanvas)) {
+            if (!this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette,
+                                    &fFaceRec->fColorGlyphPictures, recordingCanvas)) {
                 return mx;
             }
             sk_sp<SkPicture> pic = recorder.finishRecordingAsPicture();
@@ -1324,7 +1336,7 @@ SkScalerContext::GlyphMetrics SkScalerContext_FreeType::generateMetrics(const Sk
 }
 
 void SkScalerContext_FreeType::generateImage(const SkGlyph& glyph, void* imageBuffer) {
-    SkAutoMutexExclusive  ac(f_t_mutex());
+    SkAutoMutexExclusive  ac(fFaceRec->fMutex);
 
     if (this->setupSize()) {
         sk_bzero(imageBuffer, glyph.imageSize());
@@ -1359,14 +1371,16 @@ void SkScalerContext_FreeType::generateImage(const SkGlyph& glyph, void* imageBu
 #endif
         } else if (glyph.extraBits() == ScalerContextBits::COLRv1) {
 #ifdef TT_SUPPORT_COLRV1
-            this->drawCOLRv1Glyph(fFace, glyph, fLoadGlyphFlags, palette, &canvas);
+            this->drawCOLRv1Glyph(fFace, glyph, fLoadGlyphFlags, palette,
+                                  &fFaceRec->fColorGlyphPictures, &canvas);
 #endif
         } else if (glyph.extraBits() == ScalerContextBits::SVG) {
 #if defined(FT_CONFIG_OPTION_SVG)
             if (FT_Load_Glyph(fFace, glyph.getGlyphID(), fLoadGlyphFlags)) {
                 return;
             }
-            this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette, &canvas);
+            this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette,
+                               &fFaceRec->fColorGlyphPictures, &canvas);
 #endif
         }
         return;
@@ -1393,11 +1407,11 @@ void SkScalerContext_FreeType::generateImage(const SkGlyph& glyph, void* imageBu
 sk_sp<SkDrawable> SkScalerContext_FreeType::generateDrawable(const SkGlyph& glyph) {
     // Because FreeType's FT_Face is stateful (not thread safe) and the current design of this
     // SkTypeface and SkScalerContext does not work around this, it is necessary lock at least the
-    // FT_Face when using it (this implementation currently locks the whole FT_Library).
+    // FT_Face when using it (this implementation locks the typeface's FaceRec).
     // It should be possible to draw the drawable straight out of the FT_Face. However, this would
     // mean locking each time any such drawable is drawn. To avoid locking, this implementation
     // creates drawables backed as pictures so that they can be played back later without locking.
-    SkAutoMutexExclusive  ac(f_t_mutex());
+    SkAutoMutexExclusive  ac(fFaceRec->fMutex);
 
     if (this->setupSize()) {
         return nullptr;
@@ -1421,7 +1435,8 @@ sk_sp<SkDrawable> SkScalerContext_FreeType::generateDrawable(const SkGlyph& glyp
 #endif
         } else if (glyph.extraBits() == ScalerContextBits::COLRv1) {
 #ifdef TT_SUPPORT_COLRV1
-            if (!this->drawCOLRv1Glyph(fFace, glyph, fLoadGlyphFlags, palette, recordingCanvas)) {
+            if (!this->drawCOLRv1Glyph(fFace, glyph, fLoadGlyphFlags, palette,
+                                       &fFaceRec->fColorGlyphPictures, recordingCanvas)) {
                 return nullptr;
             }
 #else
@@ -1432,7 +1447,8 @@ sk_sp<SkDrawable> SkScalerContext_FreeType::generateDrawable(const SkGlyph& glyp
             if (FT_Load_Glyph(fFace, glyph.getGlyphID(), fLoadGlyphFlags)) {
                 return nullptr;
             }
-            if (!this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette, recordingCanvas)) {
+            if (!this->drawSVGGlyph(fFace, glyph, fLoadGlyphFlags, palette,
+                                    &fFaceRec->fColorGlyphPictures, recordingCanvas)) {
                 return nullptr;
             }
 #else
@@ -1448,7 +1464,7 @@ sk_sp<SkDrawable> SkScalerContext_FreeType::generateDrawable(const SkGlyph& glyp
 bool SkScalerContext_FreeType::generatePath(const SkGlyph& glyph, SkPath* path) {
     SkASSERT(path);
 
-    SkAutoMutexExclusive  ac(f_t_mutex());
+    SkAutoMutexExclusive  ac(fFaceRec->fMutex);
 
     SkGlyphID glyphID = glyph.getGlyphID();
     // FT_IS_SCALABLE is documented to mean the face contains outline glyphs.
@@ -1490,7 +1506,7 @@ void SkScalerContext_FreeType::generateFontMetrics(SkFontMetrics* metrics) {
         return;
     }
 
-    SkAutoMutexExclusive ac(f_t_mutex());
+    SkAutoMutexExclusive ac(fFaceRec->fMutex);
 
     if (this->setupSize()) {
         sk_bzero(metrics, sizeof(*metrics));
@@ -1906,8 +1922,10 @@ sk_sp<SkData> SkTypeface_FreeType::onCopyTableData(SkFontTableTag tag) const {
 }
 
 SkTypeface_FreeType::FaceRec* SkTypeface_FreeType::getFaceRec() const {
-    f_t_mutex().assertHeld();
-    fFTFaceOnce([this]{ fFaceRec = SkTypeface_FreeType::FaceRec::Make(this); });
+    fFTFaceOnce([this]{
+        SkAutoMutexExclusive ac(f_t_mutex());
+        fFaceRec = SkTypeface_FreeType::FaceRec::Make(this);
+    });
     return fFaceRec.get();
 }
 
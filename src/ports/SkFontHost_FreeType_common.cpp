@@ -8,6 +8,7 @@
 
 #include "src/ports/SkFontHost_FreeType_common.h"
 
+#include "include/core/SkBBHFactory.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
@@ -16,6 +17,7 @@
 #include "include/core/SkImage.h"
 #include "include/core/SkOpenTypeSVGDecoder.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkPictureRecorder.h"
 #include "include/effects/SkGradientShader.h"
 #include "include/pathops/SkPathOps.h"
 #include "include/private/SkColorData.h"
@@ -1551,6 +1553,31 @@ bool colrv1_start_glyph_bounds(SkMatrix *ctm,
 }
 #endif // TT_SUPPORT_COLRV1
 
+#if defined(TT_SUPPORT_COLRV1) || defined(FT_CONFIG_OPTION_SVG)
+uint64_t color_glyph_key(SkGlyphID glyphID, SkColor foregroundColor) {
+    return (uint64_t)foregroundColor << 32 | glyphID;
+}
+
+// Draws the glyph's picture from the cache, recording it with draw() first if it isn't there.
+template <typename Fn>
+bool draw_cached_color_glyph(SkScalerContext_FreeType_Base::ColorGlyphPictures* cache,
+                             uint64_t key, SkCanvas* canvas, Fn&& draw) {
+    if (sk_sp<SkPicture>* cached = cache->find(key)) {
+        canvas->drawPicture(*cached);
+        return true;
+    }
+    // Record with a bounding box hierarchy, which trims the cull rect to what was drawn.
+    SkPictureRecorder recorder;
+    SkRect infiniteRect = SkRect::MakeLTRB(-SK_ScalarInfinity, -SK_ScalarInfinity,
+                                            SK_ScalarInfinity,  SK_ScalarInfinity);
+    if (!draw(recorder.beginRecording(infiniteRect, SkRTreeFactory()()))) {
+        return false;
+    }
+    canvas->drawPicture(*cache->insert(key, recorder.finishRecordingAsPicture()));
+    return true;
+}
+#endif
+
 }  // namespace
 
 
@@ -1559,12 +1586,39 @@ bool SkScalerContext_FreeType_Base::drawCOLRv1Glyph(FT_Face face,
                                                     const SkGlyph& glyph,
                                                     uint32_t loadGlyphFlags,
                                                     SkSpan<SkColor> palette,
+                                                    ColorGlyphPictures* cache,
                                                     SkCanvas* canvas) {
     if (this->isSubpixel()) {
         canvas->translate(SkFixedToScalar(glyph.getSubXFixed()),
                           SkFixedToScalar(glyph.getSubYFixed()));
     }
 
+    if (cache) {
+        // Drawing with the root transform just concatenates it and then draws the glyph in font
+        // units, so do that, with the font unit drawing from the cache.
+        FT_OpaquePaint opaquePaint{nullptr, 1};
+        if (!FT_Get_Color_Glyph_Paint(face, glyph.getGlyphID(),
+                                      FT_COLOR_INCLUDE_ROOT_TRANSFORM, &opaquePaint)) {
+            return false;
+        }
+        if (opaquePaint.insert_root_transform) {
+            FT_COLR_Paint rootTransform;
+            if (!FT_Get_Paint(face, opaquePaint, &rootTransform) ||
+                rootTransform.format != FT_COLR_PAINTFORMAT_TRANSFORM) {
+                return false;
+            }
+            colrv1_transform(face, rootTransform, canvas);
+        }
+        return draw_cached_color_glyph(
+                cache, color_glyph_key(glyph.getGlyphID(), fRec.fForegroundColor), canvas,
+                [&](SkCanvas* recordingCanvas) {
+                    VisitedSet activePaints;
+                    return colrv1_start_glyph(recordingCanvas, palette, fRec.fForegroundColor,
+                                              face, glyph.getGlyphID(),
+                                              FT_COLOR_NO_ROOT_TRANSFORM, &activePaints);
+                });
+    }
+
     VisitedSet activePaints;
     bool haveLayers =  colrv1_start_glyph(canvas, palette,
                                           fRec.fForegroundColor,
@@ -1617,6 +1671,7 @@ bool SkScalerContext_FreeType_Base::drawSVGGlyph(FT_Face face,
                                                  const SkGlyph& glyph,
                                                  uint32_t loadGlyphFlags,
                                                  SkSpan<SkColor> palette,
+                                                 ColorGlyphPictures* cache,
                                                  SkCanvas* canvas) {
     SkASSERT(face->glyph->format == FT_GLYPH_FORMAT_SVG);
 
@@ -1640,12 +1695,21 @@ bool SkScalerContext_FreeType_Base::drawSVGGlyph(FT_Face face,
     if (!svgFactory) {
         return false;
     }
-    auto svgDecoder = svgFactory(ftSvg->svg_document, ftSvg->svg_document_length);
-    if (!svgDecoder) {
-        return false;
+    auto render = [&](SkCanvas* target) {
+        auto svgDecoder = svgFactory(ftSvg->svg_document, ftSvg->svg_document_length);
+        if (!svgDecoder) {
+            return false;
+        }
+        return svgDecoder->render(*target, ftSvg->units_per_EM, glyph.getGlyphID(),
+                                  fRec.fForegroundColor, palette);
+    };
+    if (cache) {
+        // The decoder renders in font units, so everything but m can be cached.
+        return draw_cached_color_glyph(
+                cache, color_glyph_key(glyph.getGlyphID(), fRec.fForegroundColor), canvas,
+                render);
     }
-    return svgDecoder->render(*canvas, ftSvg->units_per_EM, glyph.getGlyphID(),
-                              fRec.fForegroundColor, palette);
+    return render(canvas);
 }
 #endif  // FT_CONFIG_OPTION_SVG
 
@@ -9,6 +9,8 @@
 #ifndef SKFONTHOST_FREETYPE_COMMON_H_
 #define SKFONTHOST_FREETYPE_COMMON_H_
 
+#include "include/core/SkPicture.h"
+#include "include/core/SkRefCnt.h"
 #include "include/core/SkSpan.h"
 #include "include/core/SkTypeface.h"
 #include "include/core/SkTypes.h"
@@ -16,6 +18,7 @@
 #include "include/private/base/SkTArray.h"
 #include "src/base/SkSharedMutex.h"
 #include "src/core/SkGlyph.h"
+#include "src/core/SkLRUCache.h"
 #include "src/core/SkScalerContext.h"
 #include "src/utils/SkCharToGlyphCache.h"
 
@@ -42,6 +45,13 @@ const char* SkTraceFtrGetError(int);
 
 
 class SkScalerContext_FreeType_Base : public SkScalerContext {
+public:
+    /** COLRv1 and OT-SVG glyphs recorded in font units, keyed by glyph ID and foreground color.
+     *  One face shares these across all its sizes, transforms and subpixel positions, which
+     *  replay them instead of interpreting the font's tables again. Guard with the face's lock.
+     */
+    using ColorGlyphPictures = SkLRUCache<uint64_t, sk_sp<SkPicture>>;
+
 protected:
     // See http://freetype.sourceforge.net/freetype2/docs/reference/ft2-bitmap_handling.html#FT_Bitmap_Embolden
     // This value was chosen by eyeballing the result in Firefox and trying to match it.
@@ -54,10 +64,11 @@ protected:
 
     bool drawCOLRv0Glyph(FT_Face, const SkGlyph&, uint32_t loadGlyphFlags,
                          SkSpan<SkColor> palette, SkCanvas*);
+    // The ColorGlyphPictures may be null, to draw without caching.
     bool drawCOLRv1Glyph(FT_Face, const SkGlyph&, uint32_t loadGlyphFlags,
-                         SkSpan<SkColor> palette, SkCanvas*);
+                         SkSpan<SkColor> palette, ColorGlyphPictures*, SkCanvas*);
     bool drawSVGGlyph(FT_Face, const SkGlyph&, uint32_t loadGlyphFlags,
-                      SkSpan<SkColor> palette, SkCanvas*);
+                      SkSpan<SkColor> palette, ColorGlyphPictures*, SkCanvas*);
     void generateGlyphImage(FT_Face, const SkGlyph&, void*, const SkMatrix& bitmapTransform);
     bool generateGlyphPath(FT_Face, SkPath*);
     bool generateFacePath(FT_Face, SkGlyphID, uint32_t loadGlyphFlags, SkPath*);
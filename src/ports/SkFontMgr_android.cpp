@@ -368,39 +368,11 @@ protected:
                                                   const char* bcp47[],
                                                   int bcp47Count,
                                                   SkUnichar character) const override {
-        // The variant 'elegant' is 'not squashed', 'compact' is 'stays in ascent/descent'.
-        // The variant 'default' means 'compact and elegant'.
-        // As a result, it is not possible to know the variant context from the font alone.
-        // TODO: add 'is_elegant' and 'is_compact' bits to 'style' request.
-
-        SkString familyNameString(familyName);
-        for (const SkString& currentFamilyName : { familyNameString, SkString() }) {
-            // The first time match anything elegant, second time anything not elegant.
-            for (int elegant = 2; elegant --> 0;) {
-                for (int bcp47Index = bcp47Count; bcp47Index --> 0;) {
-                    SkLanguage lang(bcp47[bcp47Index]);
-                    while (!lang.getTag().isEmpty()) {
-                        sk_sp<SkTypeface_AndroidSystem> matchingTypeface =
-                            find_family_style_character(currentFamilyName, fFallbackNameToFamilyMap,
-                                                        style, SkToBool(elegant),
-                                                        lang.getTag(), character);
-                        if (matchingTypeface) {
-                            return matchingTypeface;
-                        }
-
-                        lang = lang.getParent();
-                    }
-                }
-                sk_sp<SkTypeface_AndroidSystem> matchingTypeface =
-                    find_family_style_character(currentFamilyName, fFallbackNameToFamilyMap,
-                                                style, SkToBool(elegant),
-                                                SkString(), character);
-                if (matchingTypeface) {
-                    return matchingTypeface;
-                }
-            }
-        }
-        return nullptr;
+        // Text layout asks for the same fallbacks over and over, and each match searches through
+        // the fallback families for every language and its parents.
+        return fFallbackCache.findOrMatch(familyName, style, bcp47, bcp47Count, character, [&]() {
+            return this->matchFallback(familyName, style, bcp47, bcp47Count, character);
+        });
     }
 
     sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData> data, int ttcIndex) const override {
@@ -446,6 +418,49 @@ private:
     TArray<NameToFamily, true> fNameToFamilyMap;
     TArray<NameToFamily, true> fFallbackNameToFamilyMap;
 
+    mutable SkFallbackTypefaceCache fFallbackCache;
+
+    // Finds a fallback typeface without looking in fFallbackCache.
+    sk_sp<SkTypeface> matchFallback(const char familyName[],
+                                    const SkFontStyle& style,
+                                    const char* bcp47[],
+                                    int bcp47Count,
+                                    SkUnichar character) const {
+        // The variant 'elegant' is 'not squashed', 'compact' is 'stays in ascent/descent'.
+        // The variant 'default' means 'compact and elegant'.
+        // As a result, it is not possible to know the variant context from the font alone.
+        // TODO: add 'is_elegant' and 'is_compact' bits to 'style' request.
+
+        SkString familyNameString(familyName);
+        for (const SkString& currentFamilyName : { familyNameString, SkString() }) {
+            // The first time match anything elegant, second time anything not elegant.
+            for (int elegant = 2; elegant --> 0;) {
+                for (int bcp47Index = bcp47Count; bcp47Index --> 0;) {
+                    SkLanguage lang(bcp47[bcp47Index]);
+                    while (!lang.getTag().isEmpty()) {
+                        sk_sp<SkTypeface_AndroidSystem> matchingTypeface =
+                            find_family_style_character(currentFamilyName, fFallbackNameToFamilyMap,
+                                                        style, SkToBool(elegant),
+                                                        lang.getTag(), character);
+                        if (matchingTypeface) {
+                            return matchingTypeface;
+                        }
+
+                        lang = lang.getParent();
+                    }
+                }
+                sk_sp<SkTypeface_AndroidSystem> matchingTypeface =
+                    find_family_style_character(currentFamilyName, fFallbackNameToFamilyMap,
+                                                style, SkToBool(elegant),
+                                                SkString(), character);
+                if (matchingTypeface) {
+                    return matchingTypeface;
+                }
+            }
+        }
+        return nullptr;
+    }
+
     void addFamily(FontFamily& family, const bool isolated, int familyIndex) {
         TArray<NameToFamily, true>* nameToFamily = &fNameToFamilyMap;
         if (family.fIsFallbackFont) {
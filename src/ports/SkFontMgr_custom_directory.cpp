@@ -5,23 +5,156 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkData.h"
+#include "include/core/SkFontStyle.h"
 #include "include/core/SkStream.h"
 #include "include/ports/SkFontMgr_directory.h"
+#include "include/private/base/SkTo.h"
 #include "src/core/SkOSFile.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkTHash.h"
+#include "src/core/SkWriteBuffer.h"
 #include "src/ports/SkFontMgr_custom.h"
 #include "src/utils/SkOSPath.h"
 
+#include <utility>
+#include <vector>
+
+namespace {
+
+// What scanning a font file found, so that the file doesn't have to be opened again as long as
+// its size and modification time stay the same.
+struct IndexedFace {
+    int         fIndex;
+    SkString    fFamilyName;
+    SkFontStyle fStyle;
+    bool        fIsFixedPitch;
+};
+
+struct IndexedFile {
+    uint64_t                 fSize = 0;
+    int64_t                  fModifiedTime = 0;
+    std::vector<IndexedFace> fFaces;
+};
+
+using FontIndex = skia_private::THashMap<SkString, IndexedFile>;
+
+static constexpr uint32_t kIndexMagic = SkSetFourByteTag('s', 'k', 'f', 'i');
+static constexpr uint32_t kIndexVersion = 1;
+
+// 64-bit values are written as two 32-bit halves, low half first.
+void write_64(SkWriteBuffer& buffer, uint64_t value) {
+    buffer.writeUInt(static_cast<uint32_t>(value));
+    buffer.writeUInt(static_cast<uint32_t>(value >> 32));
+}
+
+uint64_t read_64(SkReadBuffer& buffer) {
+    const uint64_t low = buffer.readUInt();
+    return low | (static_cast<uint64_t>(buffer.readUInt()) << 32);
+}
+
+// Returns an empty index if the file is missing or isn't a valid index.
+FontIndex read_index(const char path[]) {
+    FontIndex index;
+    sk_sp<SkData> data = SkData::MakeFromFileName(path);
+    if (!data) {
+        return index;
+    }
+
+    SkReadBuffer buffer(data->data(), data->size());
+    if (!buffer.validate(buffer.readUInt() == kIndexMagic) ||
+        !buffer.validate(buffer.readUInt() == kIndexVersion)) {
+        return index;
+    }
+    const int fileCount = buffer.readInt();
+    if (!buffer.validate(fileCount >= 0)) {
+        return index;
+    }
+    for (int i = 0; i < fileCount && buffer.isValid(); ++i) {
+        SkString filename;
+        buffer.readString(&filename);
+        IndexedFile file;
+        file.fSize = read_64(buffer);
+        file.fModifiedTime = static_cast<int64_t>(read_64(buffer));
+        const int faceCount = buffer.readInt();
+        if (!buffer.validate(faceCount >= 0)) {
+            break;
+        }
+        for (int j = 0; j < faceCount && buffer.isValid(); ++j) {
+            IndexedFace face;
+            face.fIndex = buffer.readInt();
+            buffer.readString(&face.fFamilyName);
+            const int weight = buffer.readInt();
+            const int width = buffer.readInt();
+            const uint32_t slant = buffer.readUInt();
+            buffer.validate(slant <= SkFontStyle::kOblique_Slant);
+            face.fStyle = SkFontStyle(weight, width, static_cast<SkFontStyle::Slant>(slant));
+            face.fIsFixedPitch = buffer.readBool();
+            file.fFaces.push_back(std::move(face));
+        }
+        index.set(std::move(filename), std::move(file));
+    }
+
+    if (!buffer.isValid()) {
+        index.reset();
+    }
+    return index;
+}
+
+void write_index(const char path[], const FontIndex& index) {
+    SkBinaryWriteBuffer buffer({});
+    buffer.writeUInt(kIndexMagic);
+    buffer.writeUInt(kIndexVersion);
+    buffer.writeInt(index.count());
+    index.foreach([&](const SkString& filename, const IndexedFile& file) {
+        buffer.writeString(filename.c_str());
+        write_64(buffer, file.fSize);
+        write_64(buffer, static_cast<uint64_t>(file.fModifiedTime));
+        buffer.writeInt(SkToInt(file.fFaces.size()));
+        for (const IndexedFace& face : file.fFaces) {
+            buffer.writeInt(face.fIndex);
+            buffer.writeString(face.fFamilyName.c_str());
+            buffer.writeInt(face.fStyle.weight());
+            buffer.writeInt(face.fStyle.width());
+            buffer.writeUInt(face.fStyle.slant());
+            buffer.writeBool(face.fIsFixedPitch);
+        }
+    });
+
+    // A reader that sees a partly written index finds it invalid, and scans the fonts instead.
+    SkFILEWStream stream(path);
+    if (stream.isValid()) {
+        sk_sp<SkData> data = buffer.snapshotAsData();
+        stream.write(data->data(), data->size());
+    }
+}
+
+}  // namespace
+
 class DirectorySystemFontLoader : public SkFontMgr_Custom::SystemFontLoader {
 public:
-    DirectorySystemFontLoader(const char* dir) : fBaseDirectory(dir) { }
+    DirectorySystemFontLoader(const char* dir, const char* indexPath)
+        : fBaseDirectory(dir), fIndexPath(indexPath ? indexPath : "") { }
 
     void loadSystemFonts(const SkTypeface_FreeType::Scanner& scanner,
                          SkFontMgr_Custom::Families* families) const override
     {
-        load_directory_fonts(scanner, fBaseDirectory, ".ttf", families);
-        load_directory_fonts(scanner, fBaseDirectory, ".ttc", families);
-        load_directory_fonts(scanner, fBaseDirectory, ".otf", families);
-        load_directory_fonts(scanner, fBaseDirectory, ".pfb", families);
+        const bool useIndex = !fIndexPath.isEmpty();
+        FontIndex oldIndex;
+        if (useIndex) {
+            oldIndex = read_index(fIndexPath.c_str());
+        }
+        IndexUpdate update{oldIndex, {}, 0, false};
+
+        load_directory_fonts(scanner, fBaseDirectory, ".ttf", families, &update);
+        load_directory_fonts(scanner, fBaseDirectory, ".ttc", families, &update);
+        load_directory_fonts(scanner, fBaseDirectory, ".otf", families, &update);
+        load_directory_fonts(scanner, fBaseDirectory, ".pfb", families, &update);
+
+        // Files that were removed also leave the old index out of date.
+        if (useIndex && (update.fScanned || update.fReused != oldIndex.count())) {
+            write_index(fIndexPath.c_str(), update.fNewIndex);
+        }
 
         if (families->empty()) {
             SkFontStyleSet_Custom* family = new SkFontStyleSet_Custom(SkString());
@@ -31,6 +164,13 @@ public:
     }
 
 private:
+    struct IndexUpdate {
+        const FontIndex& fOldIndex;
+        FontIndex        fNewIndex;
+        int              fReused;
+        bool             fScanned;
+    };
+
     static SkFontStyleSet_Custom* find_family(SkFontMgr_Custom::Families& families,
                                               const char familyName[])
     {
@@ -42,47 +182,74 @@ private:
         return nullptr;
     }
 
+    static std::vector<IndexedFace> scan_file(const SkTypeface_FreeType::Scanner& scanner,
+                                              const SkString& filename)
+    {
+        std::vector<IndexedFace> faces;
+        std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(filename.c_str());
+        if (!stream) {
+            // SkDebugf("---- failed to open <%s>\n", filename.c_str());
+            return faces;
+        }
+
+        int numFaces;
+        if (!scanner.recognizedFont(stream.get(), &numFaces)) {
+            // SkDebugf("---- failed to open <%s> as a font\n", filename.c_str());
+            return faces;
+        }
+
+        for (int faceIndex = 0; faceIndex < numFaces; ++faceIndex) {
+            bool isFixedPitch;
+            SkString realname;
+            SkFontStyle style = SkFontStyle(); // avoid uninitialized warning
+            if (!scanner.scanFont(stream.get(), faceIndex,
+                                  &realname, &style, &isFixedPitch, nullptr))
+            {
+                // SkDebugf("---- failed to open <%s> <%d> as a font\n",
+                //          filename.c_str(), faceIndex);
+                continue;
+            }
+            faces.push_back({faceIndex, std::move(realname), style, isFixedPitch});
+        }
+        return faces;
+    }
+
     static void load_directory_fonts(const SkTypeface_FreeType::Scanner& scanner,
                                      const SkString& directory, const char* suffix,
-                                     SkFontMgr_Custom::Families* families)
+                                     SkFontMgr_Custom::Families* families,
+                                     IndexUpdate* update)
     {
         SkOSFile::Iter iter(directory.c_str(), suffix);
         SkString name;
 
         while (iter.next(&name, false)) {
             SkString filename(SkOSPath::Join(directory.c_str(), name.c_str()));
-            std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(filename.c_str());
-            if (!stream) {
-                // SkDebugf("---- failed to open <%s>\n", filename.c_str());
-                continue;
-            }
 
-            int numFaces;
-            if (!scanner.recognizedFont(stream.get(), &numFaces)) {
-                // SkDebugf("---- failed to open <%s> as a font\n", filename.c_str());
-                continue;
+            // A file that can't be stat'ed is scanned as before, but left out of the index.
+            IndexedFile file;
+            const bool found = sk_stat(filename.c_str(), &file.fSize, &file.fModifiedTime);
+            const IndexedFile* indexed = update->fOldIndex.find(filename);
+            if (found && indexed && indexed->fSize == file.fSize &&
+                indexed->fModifiedTime == file.fModifiedTime) {
+                file.fFaces = indexed->fFaces;
+                update->fReused++;
+            } else {
+                file.fFaces = scan_file(scanner, filename);
+                update->fScanned = true;
             }
 
-            for (int faceIndex = 0; faceIndex < numFaces; ++faceIndex) {
-                bool isFixedPitch;
-                SkString realname;
-                SkFontStyle style = SkFontStyle(); // avoid uninitialized warning
-                if (!scanner.scanFont(stream.get(), faceIndex,
-                                      &realname, &style, &isFixedPitch, nullptr))
-                {
-                    // SkDebugf("---- failed to open <%s> <%d> as a font\n",
-                    //          filename.c_str(), faceIndex);
-                    continue;
-                }
-
-                SkFontStyleSet_Custom* addTo = find_family(*families, realname.c_str());
+            for (const IndexedFace& face : file.fFaces) {
+                SkFontStyleSet_Custom* addTo = find_family(*families, face.fFamilyName.c_str());
                 if (nullptr == addTo) {
-                    addTo = new SkFontStyleSet_Custom(realname);
+                    addTo = new SkFontStyleSet_Custom(face.fFamilyName);
                     families->push_back().reset(addTo);
                 }
-                addTo->appendTypeface(sk_make_sp<SkTypeface_File>(style, isFixedPitch, true,
-                                                                  realname, filename.c_str(),
-                                                                  faceIndex));
+                addTo->appendTypeface(sk_make_sp<SkTypeface_File>(face.fStyle, face.fIsFixedPitch,
+                                                                  true, face.fFamilyName,
+                                                                  filename.c_str(), face.fIndex));
+            }
+            if (found) {
+                update->fNewIndex.set(std::move(filename), std::move(file));
             }
         }
 
@@ -92,13 +259,18 @@ private:
                 continue;
             }
             SkString dirname(SkOSPath::Join(directory.c_str(), name.c_str()));
-            load_directory_fonts(scanner, dirname, suffix, families);
+            load_directory_fonts(scanner, dirname, suffix, families, update);
         }
     }
 
     SkString fBaseDirectory;
+    SkString fIndexPath;
 };
 
 SK_API sk_sp<SkFontMgr> SkFontMgr_New_Custom_Directory(const char* dir) {
-    return sk_make_sp<SkFontMgr_Custom>(DirectorySystemFontLoader(dir));
+    return SkFontMgr_New_Custom_Directory(dir, nullptr);
+}
+
+SK_API sk_sp<SkFontMgr> SkFontMgr_New_Custom_Directory(const char* dir, const char* indexPath) {
+    return sk_make_sp<SkFontMgr_Custom>(DirectorySystemFontLoader(dir, indexPath));
 }
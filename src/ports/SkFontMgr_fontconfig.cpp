@@ -657,6 +657,7 @@ class SkFontMgr_fontconfig : public SkFontMgr {
 
     mutable SkMutex fTFCacheMutex;
     mutable SkTypefaceCache fTFCache;
+    mutable SkFallbackTypefaceCache fFallbackCache;
     /** Creates a typeface using a typeface cache.
      *  @param pattern a complete pattern from FcFontRenderPrepare.
      */
@@ -667,9 +668,12 @@ class SkFontMgr_fontconfig : public SkFontMgr {
         // Cannot hold FCLocker when calling fTFCache.add; an evicted typeface may need to lock.
         // Must hold fTFCacheMutex when interacting with fTFCache.
         SkAutoMutexExclusive ama(fTFCacheMutex);
+        // Only the cached typefaces whose patterns hash the same are compared with FcPatternEqual.
+        uint32_t hash;
         sk_sp<SkTypeface> face = [&]() {
             FCLocker lock;
-            sk_sp<SkTypeface> face = fTFCache.findByProcAndRef(FindByFcPattern, pattern);
+            hash = FcPatternHash(pattern);
+            sk_sp<SkTypeface> face = fTFCache.findByHashProcAndRef(hash, FindByFcPattern, pattern);
             if (face) {
                 pattern.reset();
             }
@@ -679,12 +683,56 @@ class SkFontMgr_fontconfig : public SkFontMgr {
             face = SkTypeface_fontconfig::Make(std::move(pattern), fSysroot);
             if (face) {
                 // Cannot hold FCLocker in fTFCache.add; evicted typefaces may need to lock.
-                fTFCache.add(face);
+                fTFCache.add(face, hash);
             }
         }
         return face;
     }
 
+    /** Finds a fallback typeface without looking in fFallbackCache. */
+    sk_sp<SkTypeface> matchFallback(const char familyName[],
+                                    const SkFontStyle& style,
+                                    const char* bcp47[],
+                                    int bcp47Count,
+                                    SkUnichar character) const {
+        SkAutoFcPattern font([&](){
+            FCLocker lock;
+
+            SkAutoFcPattern pattern;
+            if (familyName) {
+                FcValue familyNameValue;
+                familyNameValue.type = FcTypeString;
+                familyNameValue.u.s = reinterpret_cast<const FcChar8*>(familyName);
+                FcPatternAddWeak(pattern, FC_FAMILY, familyNameValue, FcFalse);
+            }
+            fcpattern_from_skfontstyle(style, pattern);
+
+            SkAutoFcCharSet charSet;
+            FcCharSetAddChar(charSet, character);
+            FcPatternAddCharSet(pattern, FC_CHARSET, charSet);
+
+            if (bcp47Count > 0) {
+                SkASSERT(bcp47);
+                SkAutoFcLangSet langSet;
+                for (int i = bcp47Count; i --> 0;) {
+                    FcLangSetAdd(langSet, (const FcChar8*)bcp47[i]);
+                }
+                FcPatternAddLangSet(pattern, FC_LANG, langSet);
+            }
+
+            FcConfigSubstitute(fFC, pattern, FcMatchPattern);
+            FcDefaultSubstitute(pattern);
+
+            FcResult result;
+            SkAutoFcPattern font(FcFontMatch(fFC, pattern, &result));
+            if (!font || !FontAccessible(font) || !FontContainsCharacter(font, character)) {
+                font.reset();
+            }
+            return font;
+        }());
+        return createTypefaceFromFcPattern(std::move(font));
+    }
+
 public:
     /** Takes control of the reference to 'config'. */
     explicit SkFontMgr_fontconfig(FcConfig* config)
@@ -895,42 +943,11 @@ protected:
                                                   int bcp47Count,
                                                   SkUnichar character) const override
     {
-        SkAutoFcPattern font([&](){
-            FCLocker lock;
-
-            SkAutoFcPattern pattern;
-            if (familyName) {
-                FcValue familyNameValue;
-                familyNameValue.type = FcTypeString;
-                familyNameValue.u.s = reinterpret_cast<const FcChar8*>(familyName);
-                FcPatternAddWeak(pattern, FC_FAMILY, familyNameValue, FcFalse);
-            }
-            fcpattern_from_skfontstyle(style, pattern);
-
-            SkAutoFcCharSet charSet;
-            FcCharSetAddChar(charSet, character);
-            FcPatternAddCharSet(pattern, FC_CHARSET, charSet);
-
-            if (bcp47Count > 0) {
-                SkASSERT(bcp47);
-                SkAutoFcLangSet langSet;
-                for (int i = bcp47Count; i --> 0;) {
-                    FcLangSetAdd(langSet, (const FcChar8*)bcp47[i]);
-                }
-                FcPatternAddLangSet(pattern, FC_LANG, langSet);
-            }
-
-            FcConfigSubstitute(fFC, pattern, FcMatchPattern);
-            FcDefaultSubstitute(pattern);
-
-            FcResult result;
-            SkAutoFcPattern font(FcFontMatch(fFC, pattern, &result));
-            if (!font || !FontAccessible(font) || !FontContainsCharacter(font, character)) {
-                font.reset();
-            }
-            return font;
-        }());
-        return createTypefaceFromFcPattern(std::move(font));
+        // Text layout asks for the same fallbacks over and over, and each match is a search
+        // through every font fontconfig knows about.
+        return fFallbackCache.findOrMatch(familyName, style, bcp47, bcp47Count, character, [&]() {
+            return this->matchFallback(familyName, style, bcp47, bcp47Count, character);
+        });
     }
 
     sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset> stream,
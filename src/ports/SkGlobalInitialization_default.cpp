@@ -60,6 +60,7 @@
         SkRegisterColorShaderFlattenable();
         SkRegisterCoordClampShaderFlattenable();
         SkRegisterEmptyShaderFlattenable();
+        SkRegisterGainmapApplyShaderFlattenable();
         SK_REGISTER_FLATTENABLE(SkLocalMatrixShader);
         SK_REGISTER_FLATTENABLE(SkPictureShader);
         SkRegisterConicalGradientShaderFlattenable();
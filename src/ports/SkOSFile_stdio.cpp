@@ -156,6 +156,16 @@ bool sk_isdir(const char *path) {
     return SkToBool(status.st_mode & S_IFDIR);
 }
 
+bool sk_stat(const char* path, uint64_t* size, int64_t* modifiedTime) {
+    struct stat status = {};
+    if (0 != stat(path, &status)) {
+        return false;
+    }
+    *size = static_cast<uint64_t>(status.st_size);
+    *modifiedTime = static_cast<int64_t>(status.st_mtime);
+    return true;
+}
+
 bool sk_mkdir(const char* path) {
     if (sk_isdir(path)) {
         return true;
@@ -232,7 +232,14 @@ public:
             , fBridgeFontRef(
                       static_cast<SkTypeface_Fontations*>(this->getTypeface())->getBridgeFontRef())
             , fBridgeNormalizedCoords(static_cast<SkTypeface_Fontations*>(this->getTypeface())
-                                              ->getBridgeNormalizedCoords()) {
+                                              ->getBridgeNormalizedCoords())
+            // The size, variation and matrix are fixed for this context, so everything derived
+            // from them is worked out once here rather than for each glyph.
+            , fMatricesValid(fRec.computeMatrices(
+                      SkScalerContextRec::PreMatrixScale::kVertical, &fScale, &fRemainingMatrix))
+            , fBridgeScalerContext(fontations_ffi::make_scaler_context())
+            , fBridgeGlyphMetrics(fontations_ffi::make_glyph_metrics(
+                      fBridgeFontRef, fScale.y(), fBridgeNormalizedCoords)) {
         fRec.getSingleMatrix(&fMatrix);
         this->forceGenerateImageFromPath();
     }
@@ -241,17 +248,14 @@ protected:
     GlyphMetrics generateMetrics(const SkGlyph& glyph, SkArenaAlloc*) override {
         GlyphMetrics mx(fRec.fMaskFormat);
 
-        SkVector scale;
-        SkMatrix remainingMatrix;
-        if (!fRec.computeMatrices(
-                    SkScalerContextRec::PreMatrixScale::kVertical, &scale, &remainingMatrix)) {
+        if (!fMatricesValid) {
             return mx;
         }
         float x_advance = 0.0f;
-        x_advance = fontations_ffi::advance_width_or_zero(
-                fBridgeFontRef, scale.y(), fBridgeNormalizedCoords, glyph.getGlyphID());
+        x_advance = fontations_ffi::advance_width_or_zero(*fBridgeGlyphMetrics,
+                                                          glyph.getGlyphID());
         // TODO(drott): y-advance?
-        mx.advance = remainingMatrix.mapXY(x_advance, SkFloatToScalar(0.f));
+        mx.advance = fRemainingMatrix.mapXY(x_advance, SkFloatToScalar(0.f));
         mx.computeFromPath = true;
         return mx;
     }
@@ -261,18 +265,16 @@ protected:
     }
 
     bool generatePath(const SkGlyph& glyph, SkPath* path) override {
-        SkVector scale;
-        SkMatrix remainingMatrix;
-        if (!fRec.computeMatrices(
-                    SkScalerContextRec::PreMatrixScale::kVertical, &scale, &remainingMatrix)) {
+        if (!fMatricesValid) {
             return false;
         }
         sk_fontations::PathGeometrySink pathWrapper;
         fontations_ffi::BridgeScalerMetrics scalerMetrics;
 
         if (!fontations_ffi::get_path(fBridgeFontRef,
+                                      *fBridgeScalerContext,
                                       glyph.getGlyphID(),
-                                      scale.y(),
+                                      fScale.y(),
                                       fBridgeNormalizedCoords,
                                       pathWrapper,
                                       scalerMetrics)) {
@@ -284,7 +286,7 @@ protected:
             Simplify(*path, path);
             AsWinding(*path, path);
         }
-        *path = path->makeTransform(remainingMatrix);
+        *path = path->makeTransform(fRemainingMatrix);
         return true;
     }
 
@@ -311,6 +313,11 @@ private:
     sk_sp<SkData> fFontData = nullptr;
     const fontations_ffi::BridgeFontRef& fBridgeFontRef;
     const fontations_ffi::BridgeNormalizedCoords& fBridgeNormalizedCoords;
+    SkVector fScale;
+    SkMatrix fRemainingMatrix;
+    const bool fMatricesValid;
+    rust::Box<fontations_ffi::BridgeScalerContext> fBridgeScalerContext;
+    rust::Box<fontations_ffi::BridgeGlyphMetrics> fBridgeGlyphMetrics;
 };
 
 std::unique_ptr<SkStreamAsset> SkTypeface_Fontations::onOpenStream(int* ttcIndex) const {
@@ -61,8 +61,13 @@ impl<'a> Pen for PathWrapperPen<'a> {
     }
 }
 
+fn make_scaler_context() -> Box<BridgeScalerContext> {
+    Box::new(BridgeScalerContext(Context::new()))
+}
+
 fn get_path(
     font_ref: &BridgeFontRef,
+    scaler_context: &mut BridgeScalerContext,
     glyph_id: u16,
     size: f32,
     coords: &BridgeNormalizedCoords,
@@ -71,8 +76,8 @@ fn get_path(
 ) -> bool {
     font_ref
         .with_font(|f| {
-            let mut cx = Context::new();
-            let mut scaler = cx
+            let mut scaler = scaler_context
+                .0
                 .new_scaler()
                 .size(Size::new(size))
                 .normalized_coords(coords.normalized_coords.into_iter())
@@ -91,17 +96,25 @@ fn get_path(
         .is_some()
 }
 
-fn advance_width_or_zero(
-    font_ref: &BridgeFontRef,
+fn make_glyph_metrics<'a>(
+    font_ref: &'a BridgeFontRef<'a>,
     size: f32,
-    coords: &BridgeNormalizedCoords,
-    glyph_id: u16,
-) -> f32 {
-    font_ref
-        .with_font(|f| {
-            GlyphMetrics::new(f, Size::new(size), coords.normalized_coords.coords())
-                .advance_width(GlyphId::new(glyph_id))
-        })
+    coords: &'a BridgeNormalizedCoords,
+) -> Box<BridgeGlyphMetrics<'a>> {
+    Box::new(BridgeGlyphMetrics(font_ref.with_font(|f| {
+        Some(GlyphMetrics::new(
+            f,
+            Size::new(size),
+            coords.normalized_coords.coords(),
+        ))
+    })))
+}
+
+fn advance_width_or_zero(glyph_metrics: &BridgeGlyphMetrics, glyph_id: u16) -> f32 {
+    glyph_metrics
+        .0
+        .as_ref()
+        .and_then(|m| m.advance_width(GlyphId::new(glyph_id)))
         .unwrap_or_default()
 }
 
@@ -425,6 +438,14 @@ struct BridgeLocalizedStrings<'a> {
     localized_strings: LocalizedStrings<'a>,
 }
 
+/// Scratch buffers and caches for loading outlines, reused across all the
+/// glyphs of one SkScalerContext rather than allocated for each glyph.
+struct BridgeScalerContext(Context);
+
+/// Horizontal metrics (hmtx and HVAR) resolved once for one size and
+/// variation position, the ones of an SkScalerContext.
+struct BridgeGlyphMetrics<'a>(Option<GlyphMetrics<'a>>);
+
 #[cxx::bridge(namespace = "fontations_ffi")]
 mod ffi {
 
@@ -488,20 +509,26 @@ mod ffi {
         fn font_ref_is_valid(bridge_font_ref: &BridgeFontRef) -> bool;
 
         fn lookup_glyph_or_zero(font_ref: &BridgeFontRef, codepoint: u32) -> u16;
+
+        type BridgeScalerContext;
+        fn make_scaler_context() -> Box<BridgeScalerContext>;
         fn get_path(
             font_ref: &BridgeFontRef,
+            scaler_context: &mut BridgeScalerContext,
             glyph_id: u16,
             size: f32,
             coords: &BridgeNormalizedCoords,
             path_wrapper: Pin<&mut PathWrapper>,
             scaler_metrics: &mut BridgeScalerMetrics,
         ) -> bool;
-        fn advance_width_or_zero(
-            font_ref: &BridgeFontRef,
+
+        type BridgeGlyphMetrics<'a>;
+        unsafe fn make_glyph_metrics<'a>(
+            font_ref: &'a BridgeFontRef<'a>,
             size: f32,
-            coords: &BridgeNormalizedCoords,
-            glyph_id: u16,
-        ) -> f32;
+            coords: &'a BridgeNormalizedCoords,
+        ) -> Box<BridgeGlyphMetrics<'a>>;
+        fn advance_width_or_zero(glyph_metrics: &BridgeGlyphMetrics, glyph_id: u16) -> f32;
         fn units_per_em_or_zero(font_ref: &BridgeFontRef) -> u16;
         fn get_skia_metrics(
             font_ref: &BridgeFontRef,
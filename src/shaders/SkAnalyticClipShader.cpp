@@ -0,0 +1,76 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/shaders/SkAnalyticClipShader.h"
+
+#include "include/core/SkPoint.h"
+#include "include/core/SkRect.h"
+#include "src/core/SkEffectPriv.h"
+#include "src/core/SkRasterPipeline.h"
+#include "src/core/SkRasterPipelineOpList.h"
+
+#include <algorithm>
+
+// The distance estimate is poor where an ellipse bends sharply within a pixel, so corners whose
+// tightest radius of curvature, min(rx, ry)^2 / max(rx, ry), is smaller than this are left to
+// SkAAClip.
+static constexpr float kMinCurvatureRadius = 0.5f;
+
+// Past this we'd lose too much precision in the float math.
+static constexpr float kMaxCoord = 32767;
+
+bool SkAnalyticClipShader::IsSupported(const SkRRect& rrect) {
+    const SkRect& r = rrect.rect();
+    if (rrect.isEmpty() || !r.isFinite() ||
+        r.fLeft < -kMaxCoord || r.fTop < -kMaxCoord || r.fRight > kMaxCoord ||
+        r.fBottom > kMaxCoord) {
+        return false;
+    }
+    for (int i = 0; i < 4; ++i) {
+        const SkVector radii = rrect.radii((SkRRect::Corner)i);
+        const float minR = std::min(radii.fX, radii.fY),
+                    maxR = std::max(radii.fX, radii.fY);
+        if (maxR > 0 && minR * minR < kMinCurvatureRadius * maxR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SkAnalyticClipShader::SkAnalyticClipShader(const SkRRect& rrect) : fRRect(rrect) {
+    SkASSERT(IsSupported(rrect));
+    const SkRect& r = rrect.rect();
+    fCtx.left   = r.fLeft;
+    fCtx.top    = r.fTop;
+    fCtx.right  = r.fRight;
+    fCtx.bottom = r.fBottom;
+
+    // In the pipeline's corner order: upper-left, upper-right, lower-left, lower-right.
+    static constexpr SkRRect::Corner kCorners[4] = {
+        SkRRect::kUpperLeft_Corner, SkRRect::kUpperRight_Corner,
+        SkRRect::kLowerLeft_Corner, SkRRect::kLowerRight_Corner,
+    };
+    for (int i = 0; i < 4; ++i) {
+        const SkVector radii = rrect.radii(kCorners[i]);
+        const bool right  = i & 1,
+                   bottom = i & 2;
+        fCtx.centerX[i] = right  ? r.fRight  - radii.fX : r.fLeft + radii.fX;
+        fCtx.centerY[i] = bottom ? r.fBottom - radii.fY : r.fTop  + radii.fY;
+        const bool round = radii.fX > 0 && radii.fY > 0;
+        fCtx.invRX2[i] = round ? 1 / (radii.fX * radii.fX) : 0;
+        fCtx.invRY2[i] = round ? 1 / (radii.fY * radii.fY) : 0;
+    }
+}
+
+bool SkAnalyticClipShader::appendStages(const SkStageRec& rec,
+                                        const SkShaders::MatrixRec& mRec) const {
+    if (!mRec.apply(rec)) {
+        return false;
+    }
+    rec.fPipeline->append(SkRasterPipelineOp::rrect_coverage, &fCtx);
+    return true;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+#ifndef SkAnalyticClipShader_DEFINED
+#define SkAnalyticClipShader_DEFINED
+
+#include "include/core/SkRRect.h"
+#include "src/core/SkRasterPipelineOpContexts.h"
+#include "src/shaders/SkShaderBase.h"
+
+struct SkStageRec;
+
+/**
+ *  The coverage of a device-space round rect (or rect), as alpha. SkRasterClip uses this to apply
+ *  antialiased rect and rrect clips per pixel in the raster pipeline, rather than rasterizing them
+ *  into an SkAAClip.
+ */
+class SkAnalyticClipShader : public SkShaderBase {
+public:
+    // Only rrects for which IsSupported() returns true can be used.
+    explicit SkAnalyticClipShader(const SkRRect& rrect);
+
+    static bool IsSupported(const SkRRect& rrect);
+
+    ShaderType type() const override { return ShaderType::kAnalyticClip; }
+
+    const SkRRect& rrect() const { return fRRect; }
+
+protected:
+    bool appendStages(const SkStageRec& rec, const SkShaders::MatrixRec&) const override;
+
+private:
+    // For serialization.  This will never be called.
+    Factory getFactory() const override { return nullptr; }
+    const char* getTypeName() const override { return nullptr; }
+
+    const SkRRect fRRect;
+    SkRasterPipeline_RRectCoverageCtx fCtx;
+};
+
+#endif
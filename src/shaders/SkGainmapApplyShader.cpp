@@ -0,0 +1,187 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/shaders/SkGainmapApplyShader.h"
+
+#include "include/core/SkFlattenable.h"
+#include "include/core/SkString.h"
+#include "include/effects/SkRuntimeEffect.h"
+#include "include/private/base/SkAssert.h"
+#include "src/base/SkArenaAlloc.h"
+#include "src/core/SkEffectPriv.h"
+#include "src/core/SkRasterPipeline.h"
+#include "src/core/SkRasterPipelineOpList.h"
+#include "src/core/SkReadBuffer.h"
+#include "src/core/SkWriteBuffer.h"
+
+#include <utility>
+
+static constexpr char gGainmapSKSL[] =
+        "uniform shader base;"
+        "uniform shader gainmap;"
+        "uniform half4 logRatioMin;"
+        "uniform half4 logRatioMax;"
+        "uniform half4 gainmapGamma;"
+        "uniform half4 epsilonBase;"
+        "uniform half4 epsilonOther;"
+        "uniform half W;"
+        "uniform int gainmapIsAlpha;"
+        "uniform int gainmapIsRed;"
+        "uniform int singleChannel;"
+        "uniform int noGamma;"
+        ""
+        "half4 main(float2 coord) {"
+            "half4 S = base.eval(coord);"
+            "half4 G = gainmap.eval(coord);"
+            "if (gainmapIsAlpha == 1) {"
+                "G = half4(G.a, G.a, G.a, 1.0);"
+            "}"
+            "if (gainmapIsRed == 1) {"
+                "G = half4(G.r, G.r, G.r, 1.0);"
+            "}"
+            "if (singleChannel == 1) {"
+                "half L;"
+                "if (noGamma == 1) {"
+                    "L = mix(logRatioMin.r, logRatioMax.r, G.r);"
+                "} else {"
+                    "L = mix(logRatioMin.r, logRatioMax.r, pow(G.r, gainmapGamma.r));"
+                "}"
+                "half3 H = (S.rgb + epsilonBase.rgb) * exp(L * W) - epsilonOther.rgb;"
+                "return half4(H.r, H.g, H.b, S.a);"
+            "} else {"
+                "half3 L;"
+                "if (noGamma == 1) {"
+                    "L = mix(logRatioMin.rgb, logRatioMax.rgb, G.rgb);"
+                "} else {"
+                    "L = mix(logRatioMin.rgb, logRatioMax.rgb, pow(G.rgb, gainmapGamma.rgb));"
+                "}"
+                "half3 H = (S.rgb + epsilonBase.rgb) * exp(L * W) - epsilonOther.rgb;"
+                "return half4(H.r, H.g, H.b, S.a);"
+            "}"
+        "}";
+
+static sk_sp<SkRuntimeEffect> gainmap_apply_effect() {
+    static const SkRuntimeEffect* effect =
+            SkRuntimeEffect::MakeForShader(SkString(gGainmapSKSL), {}).effect.release();
+    SkASSERT(effect);
+    return sk_ref_sp(effect);
+}
+
+static bool all_channels_equal(const SkColor4f& c) {
+    return c.fR == c.fG && c.fR == c.fB;
+}
+
+static bool no_gamma(const SkColor4f& gamma) {
+    return gamma.fR == 1.f && gamma.fG == 1.f && gamma.fB == 1.f;
+}
+
+static sk_sp<SkShader> make_runtime_shader(sk_sp<SkShader> base,
+                                           sk_sp<SkShader> gainmap,
+                                           const SkGainmapApplyShader::Params& params) {
+    SkRuntimeShaderBuilder builder(gainmap_apply_effect());
+    builder.child("base") = std::move(base);
+    builder.child("gainmap") = std::move(gainmap);
+    builder.uniform("logRatioMin") = params.fLogRatioMin;
+    builder.uniform("logRatioMax") = params.fLogRatioMax;
+    builder.uniform("gainmapGamma") = params.fGamma;
+    builder.uniform("epsilonBase") = params.fEpsilonBase;
+    builder.uniform("epsilonOther") = params.fEpsilonOther;
+    builder.uniform("noGamma") = (int)no_gamma(params.fGamma);
+    builder.uniform("singleChannel") = (int)(params.fChannel >= 0 &&
+                                             all_channels_equal(params.fGamma) &&
+                                             all_channels_equal(params.fLogRatioMin) &&
+                                             all_channels_equal(params.fLogRatioMax));
+    builder.uniform("gainmapIsAlpha") = (int)(params.fChannel == 3);
+    builder.uniform("gainmapIsRed") = (int)(params.fChannel == 0);
+    builder.uniform("W") = params.fW;
+    return builder.makeShader();
+}
+
+SkGainmapApplyShader::SkGainmapApplyShader(sk_sp<SkShader> base,
+                                           sk_sp<SkShader> gainmap,
+                                           const Params& params)
+        : fBase(std::move(base))
+        , fGainmap(std::move(gainmap))
+        , fParams(params)
+        , fRuntimeShader(make_runtime_shader(fBase, fGainmap, params)) {
+    SkASSERT(fRuntimeShader);
+    SkASSERT(params.fChannel >= -1 && params.fChannel <= 3);
+
+    fCtx.gainmap = nullptr;
+    for (int i = 0; i < 3; ++i) {
+        fCtx.logGainScale[i] = params.fW * (params.fLogRatioMax[i] - params.fLogRatioMin[i]);
+        fCtx.logGainBias[i]  = params.fW * params.fLogRatioMin[i];
+        fCtx.gamma[i]        = params.fGamma[i];
+        fCtx.epsilonBase[i]  = params.fEpsilonBase[i];
+        fCtx.epsilonOther[i] = params.fEpsilonOther[i];
+    }
+    fCtx.channel = params.fChannel;
+    fCtx.noGamma = no_gamma(params.fGamma);
+}
+
+sk_sp<SkFlattenable> SkGainmapApplyShader::CreateProc(SkReadBuffer& buffer) {
+    sk_sp<SkShader> base(buffer.readShader());
+    sk_sp<SkShader> gainmap(buffer.readShader());
+    Params params;
+    buffer.readColor4f(&params.fLogRatioMin);
+    buffer.readColor4f(&params.fLogRatioMax);
+    buffer.readColor4f(&params.fGamma);
+    buffer.readColor4f(&params.fEpsilonBase);
+    buffer.readColor4f(&params.fEpsilonOther);
+    params.fW = buffer.readScalar();
+    params.fChannel = buffer.readInt();
+    if (!buffer.validate(base && gainmap && params.fChannel >= -1 && params.fChannel <= 3)) {
+        return nullptr;
+    }
+    return sk_make_sp<SkGainmapApplyShader>(std::move(base), std::move(gainmap), params);
+}
+
+void SkGainmapApplyShader::flatten(SkWriteBuffer& buffer) const {
+    buffer.writeFlattenable(fBase.get());
+    buffer.writeFlattenable(fGainmap.get());
+    buffer.writeColor4f(fParams.fLogRatioMin);
+    buffer.writeColor4f(fParams.fLogRatioMax);
+    buffer.writeColor4f(fParams.fGamma);
+    buffer.writeColor4f(fParams.fEpsilonBase);
+    buffer.writeColor4f(fParams.fEpsilonOther);
+    buffer.writeScalar(fParams.fW);
+    buffer.writeInt(fParams.fChannel);
+}
+
+bool SkGainmapApplyShader::appendStages(const SkStageRec& rec,
+                                        const SkShaders::MatrixRec& mRec) const {
+    struct Storage {
+        float fCoords[2 * SkRasterPipeline_kMaxStride];
+        float fGainmap[4 * SkRasterPipeline_kMaxStride];
+    };
+    auto storage = rec.fAlloc->make<Storage>();
+
+    // As in SkBlendShader, both children start from the same coordinates.
+    if (mRec.rasterPipelineCoordsAreSeeded()) {
+        rec.fPipeline->append(SkRasterPipelineOp::store_src_rg, storage->fCoords);
+    }
+    if (!as_SB(fGainmap)->appendStages(rec, mRec)) {
+        return false;
+    }
+    rec.fPipeline->append(SkRasterPipelineOp::store_src, storage->fGainmap);
+
+    if (mRec.rasterPipelineCoordsAreSeeded()) {
+        rec.fPipeline->append(SkRasterPipelineOp::load_src_rg, storage->fCoords);
+    }
+    if (!as_SB(fBase)->appendStages(rec, mRec)) {
+        return false;
+    }
+
+    auto ctx = rec.fAlloc->make<SkRasterPipeline_GainmapCtx>(fCtx);
+    ctx->gainmap = storage->fGainmap;
+    rec.fPipeline->append(SkRasterPipelineOp::gainmap_apply, ctx);
+    return true;
+}
+
+void SkRegisterGainmapApplyShaderFlattenable() {
+    SK_REGISTER_FLATTENABLE(SkGainmapApplyShader);
+}
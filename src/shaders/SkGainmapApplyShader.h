@@ -0,0 +1,65 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SkGainmapApplyShader_DEFINED
+#define SkGainmapApplyShader_DEFINED
+
+#include "include/core/SkColor.h"
+#include "include/core/SkFlattenable.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkShader.h"
+#include "src/core/SkRasterPipelineOpContexts.h"
+#include "src/shaders/SkShaderBase.h"
+
+class SkReadBuffer;
+class SkWriteBuffer;
+struct SkStageRec;
+
+/**
+ *  Applies a gainmap to a base image, as SkGainmapShader::Make() sets them up: both children are
+ *  already sampled in dst space, and the base is in the color space the gainmap math is done in.
+ *
+ *  The raster backend does the math in one gainmap_apply stage. The GPU backends use the
+ *  equivalent runtime effect.
+ */
+class SkGainmapApplyShader final : public SkShaderBase {
+public:
+    struct Params {
+        SkColor4f fLogRatioMin;
+        SkColor4f fLogRatioMax;
+        SkColor4f fGamma;
+        SkColor4f fEpsilonBase;
+        SkColor4f fEpsilonOther;
+        float fW;
+        int fChannel;  // -1 to use the gainmap's r,g,b, or else the one channel to use for all
+    };
+
+    SkGainmapApplyShader(sk_sp<SkShader> base, sk_sp<SkShader> gainmap, const Params&);
+
+    ShaderType type() const override { return ShaderType::kGainmapApply; }
+
+    const Params& params() const { return fParams; }
+
+    // The runtime effect shader that computes the same thing as this shader.
+    sk_sp<SkShader> runtimeShader() const { return fRuntimeShader; }
+
+protected:
+    void flatten(SkWriteBuffer&) const override;
+    bool appendStages(const SkStageRec&, const SkShaders::MatrixRec&) const override;
+
+private:
+    friend void ::SkRegisterGainmapApplyShaderFlattenable();
+    SK_FLATTENABLE_HOOKS(SkGainmapApplyShader)
+
+    sk_sp<SkShader> fBase;
+    sk_sp<SkShader> fGainmap;
+    Params fParams;
+    sk_sp<SkShader> fRuntimeShader;
+    SkRasterPipeline_GainmapCtx fCtx;
+};
+
+#endif
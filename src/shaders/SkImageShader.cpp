@@ -713,6 +713,34 @@ bool SkImageShader::appendStages(const SkStageRec& rec, const SkShaders::MatrixR
         }
         return append_misc();
     }
+    if (true
+        && (ct == kRGBA_8888_SkColorType || ct == kBGRA_8888_SkColorType)
+        && !sampling.useCubic && sampling.filter == SkFilterMode::kLinear
+        && sampling.mipmap != SkMipmapMode::kLinear
+        && fTileModeX != SkTileMode::kDecal && fTileModeY != SkTileMode::kDecal) {
+        // Tile the sample point into the image first. Its neighbors are then either clamped or,
+        // for repeat, wrapped around by the bilerp stage. Both of these have lowp versions.
+        switch (fTileModeX) {
+            case SkTileMode::kMirror: p->append(SkRasterPipelineOp::mirror_x, upper.limitX); break;
+            case SkTileMode::kRepeat: p->append(SkRasterPipelineOp::repeat_x, upper.limitX); break;
+            default:                                                                         break;
+        }
+        switch (fTileModeY) {
+            case SkTileMode::kMirror: p->append(SkRasterPipelineOp::mirror_y, upper.limitY); break;
+            case SkTileMode::kRepeat: p->append(SkRasterPipelineOp::repeat_y, upper.limitY); break;
+            default:                                                                         break;
+        }
+
+        auto ctx = alloc->make<SkRasterPipeline_BilerpTileCtx>();
+        ctx->gather  = upper.gather;
+        ctx->repeatX = fTileModeX == SkTileMode::kRepeat;
+        ctx->repeatY = fTileModeY == SkTileMode::kRepeat;
+        p->append(SkRasterPipelineOp::bilerp_tiled_8888, ctx);
+        if (ct == kBGRA_8888_SkColorType) {
+            p->append(SkRasterPipelineOp::swap_rb);
+        }
+        return append_misc();
+    }
     if (true
         && (ct == kRGBA_8888_SkColorType || ct == kBGRA_8888_SkColorType)
         && sampling.useCubic
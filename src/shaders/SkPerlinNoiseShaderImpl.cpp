@@ -11,31 +11,18 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkShader.h"
 #include "include/effects/SkPerlinNoiseShader.h"
-#include "include/private/base/SkCPUTypes.h"
-#include "include/private/base/SkTPin.h"
+#include "include/private/base/SkMutex.h"
 #include "src/base/SkArenaAlloc.h"
+#include "src/core/SkColorSpacePriv.h"
+#include "src/core/SkColorSpaceXformSteps.h"
+#include "src/core/SkEffectPriv.h"
+#include "src/core/SkLRUCache.h"
+#include "src/core/SkRasterPipeline.h"
+#include "src/core/SkRasterPipelineOpContexts.h"
+#include "src/core/SkRasterPipelineOpList.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
 
-namespace {
-
-// noiseValue is the color component's value (or color)
-// limitValue is the maximum perlin noise array index value allowed
-// newValue is the current noise dimension (either width or height)
-inline int checkNoise(int noiseValue, int limitValue, int newValue) {
-    // If the noise value would bring us out of bounds of the current noise array while we are
-    // stiching noise tiles together, wrap the noise around the current dimension of the noise to
-    // stay within the array bounds in a continuous fashion (so that tiling lines are not visible)
-    if (noiseValue >= limitValue) {
-        noiseValue -= newValue;
-    }
-    return noiseValue;
-}
-
-inline SkScalar smoothCurve(SkScalar t) { return t * t * (3 - 2 * t); }
-
-}  // end namespace
-
 SkPerlinNoiseShader::SkPerlinNoiseShader(SkPerlinNoiseShader::Type type,
                                          SkScalar baseFrequencyX,
                                          SkScalar baseFrequencyY,
@@ -55,7 +42,7 @@ SkPerlinNoiseShader::SkPerlinNoiseShader(SkPerlinNoiseShader::Type type,
     SkASSERT(fBaseFrequencyY >= 0);
 
     // If kBlockSize changes then it must be changed in the SkSL noise_function
-    // implementation and the graphite backend
+    // implementation, the graphite backend, and the perlin_noise raster pipeline stage
     static_assert(SkPerlinNoiseShader::kBlockSize == 256);
 }
 
@@ -93,155 +80,135 @@ void SkPerlinNoiseShader::flatten(SkWriteBuffer& buffer) const {
     buffer.writeInt(fTileSize.fHeight);
 }
 
-SkScalar SkPerlinNoiseShader::PerlinNoiseShaderContext::noise2D(int channel,
-                                                                const StitchData& stitchData,
-                                                                const SkPoint& noiseVector) const {
-    struct Noise {
-        int noisePositionIntegerValue;
-        int nextNoisePositionIntegerValue;
-        SkScalar noisePositionFractionValue;
-        Noise(SkScalar component) {
-            SkScalar position = component + kPerlinNoise;
-            noisePositionIntegerValue = SkScalarFloorToInt(position);
-            noisePositionFractionValue = position - SkIntToScalar(noisePositionIntegerValue);
-            nextNoisePositionIntegerValue = noisePositionIntegerValue + 1;
+SkPerlinNoiseShader::PermutationTables::PermutationTables(int seed) : fSeed(seed) {
+    for (int channel = 0; channel < 4; ++channel) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            fLatticeSelector[i] = i;
+            fNoise[channel][i][0] = (random() % (2 * kBlockSize));
+            fNoise[channel][i][1] = (random() % (2 * kBlockSize));
         }
-    };
-    Noise noiseX(noiseVector.x());
-    Noise noiseY(noiseVector.y());
-    SkScalar u, v;
-    const SkPerlinNoiseShader& perlinNoiseShader = static_cast<const SkPerlinNoiseShader&>(fShader);
-    // If stitching, adjust lattice points accordingly.
-    if (perlinNoiseShader.fStitchTiles) {
-        noiseX.noisePositionIntegerValue =
-                checkNoise(noiseX.noisePositionIntegerValue, stitchData.fWrapX, stitchData.fWidth);
-        noiseY.noisePositionIntegerValue =
-                checkNoise(noiseY.noisePositionIntegerValue, stitchData.fWrapY, stitchData.fHeight);
-        noiseX.nextNoisePositionIntegerValue = checkNoise(
-                noiseX.nextNoisePositionIntegerValue, stitchData.fWrapX, stitchData.fWidth);
-        noiseY.nextNoisePositionIntegerValue = checkNoise(
-                noiseY.nextNoisePositionIntegerValue, stitchData.fWrapY, stitchData.fHeight);
     }
-    noiseX.noisePositionIntegerValue &= kBlockMask;
-    noiseY.noisePositionIntegerValue &= kBlockMask;
-    noiseX.nextNoisePositionIntegerValue &= kBlockMask;
-    noiseY.nextNoisePositionIntegerValue &= kBlockMask;
-    int i = fPaintingData.fLatticeSelector[noiseX.noisePositionIntegerValue];
-    int j = fPaintingData.fLatticeSelector[noiseX.nextNoisePositionIntegerValue];
-    int b00 = (i + noiseY.noisePositionIntegerValue) & kBlockMask;
-    int b10 = (j + noiseY.noisePositionIntegerValue) & kBlockMask;
-    int b01 = (i + noiseY.nextNoisePositionIntegerValue) & kBlockMask;
-    int b11 = (j + noiseY.nextNoisePositionIntegerValue) & kBlockMask;
-    SkScalar sx = smoothCurve(noiseX.noisePositionFractionValue);
-    SkScalar sy = smoothCurve(noiseY.noisePositionFractionValue);
-
-    if (sx < 0 || sy < 0 || sx > 1 || sy > 1) {
-        return 0;  // Check for pathological inputs.
+    for (int i = kBlockSize - 1; i > 0; --i) {
+        int k = fLatticeSelector[i];
+        int j = random() % kBlockSize;
+        SkASSERT(j >= 0);
+        SkASSERT(j < kBlockSize);
+        fLatticeSelector[i] = fLatticeSelector[j];
+        fLatticeSelector[j] = k;
     }
 
-    // This is taken 1:1 from SVG spec: http://www.w3.org/TR/SVG11/filters.html#feTurbulenceElement
-    SkPoint fractionValue = SkPoint::Make(noiseX.noisePositionFractionValue,
-                                          noiseY.noisePositionFractionValue);  // Offset (0,0)
-    u = fPaintingData.fGradient[channel][b00].dot(fractionValue);
-    fractionValue.fX -= SK_Scalar1;  // Offset (-1,0)
-    v = fPaintingData.fGradient[channel][b10].dot(fractionValue);
-    SkScalar a = SkScalarInterp(u, v, sx);
-    fractionValue.fY -= SK_Scalar1;  // Offset (-1,-1)
-    v = fPaintingData.fGradient[channel][b11].dot(fractionValue);
-    fractionValue.fX = noiseX.noisePositionFractionValue;  // Offset (0,-1)
-    u = fPaintingData.fGradient[channel][b01].dot(fractionValue);
-    SkScalar b = SkScalarInterp(u, v, sx);
-    return SkScalarInterp(a, b, sy);
-}
-
-SkScalar SkPerlinNoiseShader::PerlinNoiseShaderContext::calculateTurbulenceValueForPoint(
-        int channel, StitchData& stitchData, const SkPoint& point) const {
-    const SkPerlinNoiseShader& perlinNoiseShader = static_cast<const SkPerlinNoiseShader&>(fShader);
-    if (perlinNoiseShader.fStitchTiles) {
-        stitchData = fPaintingData.fStitchDataInit;
-    }
-    SkScalar turbulenceFunctionResult = 0;
-    SkPoint noiseVector(SkPoint::Make(point.x() * fPaintingData.fBaseFrequency.fX,
-                                      point.y() * fPaintingData.fBaseFrequency.fY));
-    SkScalar ratio = SK_Scalar1;
-    for (int octave = 0; octave < perlinNoiseShader.fNumOctaves; ++octave) {
-        SkScalar noise = noise2D(channel, stitchData, noiseVector);
-        SkScalar numer =
-                (perlinNoiseShader.fType == kFractalNoise_Type) ? noise : SkScalarAbs(noise);
-        turbulenceFunctionResult += numer / ratio;
-        noiseVector.fX *= 2;
-        noiseVector.fY *= 2;
-        ratio *= 2;
-        if (perlinNoiseShader.fStitchTiles) {
-            stitchData = StitchData(SkIntToScalar(stitchData.fWidth) * 2,
-                                    SkIntToScalar(stitchData.fHeight) * 2);
+    // Perform the permutations now
+    {
+        // Copy noise data
+        uint16_t noise[4][kBlockSize][2];
+        memcpy(noise, fNoise, sizeof(noise));
+        // Do permutations on noise data
+        for (int i = 0; i < kBlockSize; ++i) {
+            for (int channel = 0; channel < 4; ++channel) {
+                for (int j = 0; j < 2; ++j) {
+                    fNoise[channel][i][j] = noise[channel][fLatticeSelector[i]][j];
+                }
+            }
         }
     }
 
-    if (perlinNoiseShader.fType == kFractalNoise_Type) {
-        // For kFractalNoise the result is: noise[-1,1] * 0.5 + 0.5
-        turbulenceFunctionResult = SkScalarHalf(turbulenceFunctionResult + 1);
+    // Half of the largest possible value for 16 bit unsigned int
+    static constexpr SkScalar kHalfMax16bits = 32767.5f;
+
+    // Compute gradients from permuted noise data
+    static constexpr SkScalar kInvBlockSizef = 1.0 / SkIntToScalar(kBlockSize);
+    for (int channel = 0; channel < 4; ++channel) {
+        for (int i = 0; i < kBlockSize; ++i) {
+            fGradient[channel][i] =
+                    SkPoint::Make((fNoise[channel][i][0] - kBlockSize) * kInvBlockSizef,
+                                  (fNoise[channel][i][1] - kBlockSize) * kInvBlockSizef);
+            fGradient[channel][i].normalize();
+            // Put the normalized gradient back into the noise data
+            fNoise[channel][i][0] =
+                    SkScalarRoundToInt((fGradient[channel][i].fX + 1) * kHalfMax16bits);
+            fNoise[channel][i][1] =
+                    SkScalarRoundToInt((fGradient[channel][i].fY + 1) * kHalfMax16bits);
+        }
     }
 
-    if (channel == 3) {  // Scale alpha by paint value
-        turbulenceFunctionResult *= SkIntToScalar(getPaintAlpha()) / 255;
-    }
+    // The bitmaps get their own copies of the tables, so they can outlive these.
+    SkImageInfo info = SkImageInfo::MakeA8(kBlockSize, 1);
+    fPermutationsBitmap.allocPixels(info);
+    memcpy(fPermutationsBitmap.getPixels(), fLatticeSelector, sizeof(fLatticeSelector));
+    fPermutationsBitmap.setImmutable();
 
-    // Clamp result
-    return SkTPin(turbulenceFunctionResult, 0.0f, SK_Scalar1);
+    info = SkImageInfo::Make(kBlockSize, 4, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    fNoiseBitmap.allocPixels(info);
+    memcpy(fNoiseBitmap.getPixels(), fNoise, sizeof(fNoise));
+    fNoiseBitmap.setImmutable();
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////
+sk_sp<const SkPerlinNoiseShader::PermutationTables> SkPerlinNoiseShader::PermutationTables::Find(
+        SkScalar seedValue) {
+    // According to the SVG spec, we must truncate (not round) the seed value.
+    int seed = SkScalarTruncToInt(seedValue);
+    // The seed value clamp to the range [1, kRandMaximum - 1].
+    if (seed <= 0) {
+        seed = -(seed % (kRandMaximum - 1)) + 1;
+    }
+    if (seed > kRandMaximum - 1) {
+        seed = kRandMaximum - 1;
+    }
 
-SkPMColor SkPerlinNoiseShader::PerlinNoiseShaderContext::shade(const SkPoint& point,
-                                                               StitchData& stitchData) const {
-    SkPoint newPoint;
-    fMatrix.mapPoints(&newPoint, &point, 1);
-    newPoint.fX = SkScalarRoundToScalar(newPoint.fX);
-    newPoint.fY = SkScalarRoundToScalar(newPoint.fY);
+    static SkMutex gMutex;
+    static SkLRUCache<int, sk_sp<const PermutationTables>> gCache(8);
 
-    U8CPU rgba[4];
-    for (int channel = 3; channel >= 0; --channel) {
-        SkScalar value;
-        value = calculateTurbulenceValueForPoint(channel, stitchData, newPoint);
-        rgba[channel] = SkScalarFloorToInt(255 * value);
+    SkAutoMutexExclusive lock(gMutex);
+    if (sk_sp<const PermutationTables>* tables = gCache.find(seed)) {
+        return *tables;
     }
-    return SkPreMultiplyARGB(rgba[3], rgba[0], rgba[1], rgba[2]);
-}
-
-#ifdef SK_ENABLE_LEGACY_SHADERCONTEXT
-SkShaderBase::Context* SkPerlinNoiseShader::onMakeContext(const ContextRec& rec,
-                                                          SkArenaAlloc* alloc) const {
-    // should we pay attention to rec's device-colorspace?
-    return alloc->make<PerlinNoiseShaderContext>(*this, rec);
-}
-#endif
-
-SkPerlinNoiseShader::PerlinNoiseShaderContext::PerlinNoiseShaderContext(
-        const SkPerlinNoiseShader& shader, const ContextRec& rec)
-        : Context(shader, rec)
-        , fMatrix(rec.fMatrixRec.totalMatrix())  // used for temp storage, adjusted below
-        , fPaintingData(shader.fTileSize,
-                        shader.fSeed,
-                        shader.fBaseFrequencyX,
-                        shader.fBaseFrequencyY,
-                        fMatrix) {
-    // This (1,1) translation is due to WebKit's 1 based coordinates for the noise
-    // (as opposed to 0 based, usually). The same adjustment is in the setData() function.
-    fMatrix.setTranslate(-fMatrix.getTranslateX() + SK_Scalar1,
-                         -fMatrix.getTranslateY() + SK_Scalar1);
+    return *gCache.insert(seed, sk_sp<const PermutationTables>(new PermutationTables(seed)));
 }
 
-void SkPerlinNoiseShader::PerlinNoiseShaderContext::shadeSpan(int x,
-                                                              int y,
-                                                              SkPMColor result[],
-                                                              int count) {
-    SkPoint point = SkPoint::Make(SkIntToScalar(x), SkIntToScalar(y));
-    StitchData stitchData;
-    for (int i = 0; i < count; ++i) {
-        result[i] = shade(point, stitchData);
-        point.fX += SK_Scalar1;
+bool SkPerlinNoiseShader::appendStages(const SkStageRec& rec,
+                                       const SkShaders::MatrixRec& mRec) const {
+    // The noise starts from device space. The total matrix's scale is taken into account through
+    // the frequencies (see PaintingData), and otherwise only its translation is used.
+    const SkMatrix totalMatrix = mRec.totalMatrix();
+    if (totalMatrix.hasPerspective() || !totalMatrix.invert(nullptr)) {
+        return false;
     }
+    const auto* paintingData = rec.fAlloc->make<PaintingData>(
+            fTileSize, fSeed, fBaseFrequencyX, fBaseFrequencyY, totalMatrix);
+
+    auto* ctx = rec.fAlloc->make<SkRasterPipeline_PerlinNoiseCtx>();
+    ctx->latticeSelector = paintingData->fTables->fLatticeSelector;
+    ctx->gradient = &paintingData->fTables->fGradient[0][0].fX;
+    ctx->stitching = nullptr;
+    if (fStitchTiles) {
+        int* stitching = rec.fAlloc->makeArray<int>(4 * fNumOctaves);
+        StitchData stitchData = paintingData->fStitchDataInit;
+        for (int octave = 0; octave < fNumOctaves; ++octave) {
+            stitching[4 * octave + 0] = stitchData.fWidth;
+            stitching[4 * octave + 1] = stitchData.fWrapX;
+            stitching[4 * octave + 2] = stitchData.fHeight;
+            stitching[4 * octave + 3] = stitchData.fWrapY;
+            stitchData = StitchData(SkIntToScalar(stitchData.fWidth) * 2,
+                                    SkIntToScalar(stitchData.fHeight) * 2);
+        }
+        ctx->stitching = stitching;
+    }
+    // This (1,1) translation is due to WebKit's 1 based coordinates for the noise
+    // (as opposed to 0 based, usually).
+    ctx->offsetX = -totalMatrix.getTranslateX() + SK_Scalar1;
+    ctx->offsetY = -totalMatrix.getTranslateY() + SK_Scalar1;
+    ctx->baseFrequencyX = paintingData->fBaseFrequency.fX;
+    ctx->baseFrequencyY = paintingData->fBaseFrequency.fY;
+    ctx->numOctaves = fNumOctaves;
+    ctx->fractalNoise = fType == kFractalNoise_Type;
+
+    rec.fPipeline->append(SkRasterPipelineOp::seed_shader);
+    rec.fPipeline->append(SkRasterPipelineOp::perlin_noise, ctx);
+    rec.fAlloc
+            ->make<SkColorSpaceXformSteps>(
+                    sk_srgb_singleton(), kPremul_SkAlphaType, rec.fDstCS, kPremul_SkAlphaType)
+            ->apply(rec.fPipeline);
+    return true;
 }
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,7 @@
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPoint.h"
+#include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkTypes.h"
@@ -59,63 +60,24 @@ public:
         int fWrapY;
     };
 
-    struct PaintingData {
-        PaintingData(const SkISize& tileSize,
-                     SkScalar seed,
-                     SkScalar baseFrequencyX,
-                     SkScalar baseFrequencyY,
-                     const SkMatrix& matrix) {
-            SkVector tileVec;
-            matrix.mapVector(
-                    SkIntToScalar(tileSize.fWidth), SkIntToScalar(tileSize.fHeight), &tileVec);
-
-            SkSize scale;
-            if (!matrix.decomposeScale(&scale, nullptr)) {
-                scale.set(SK_ScalarNearlyZero, SK_ScalarNearlyZero);
-            }
-            fBaseFrequency.set(baseFrequencyX * SkScalarInvert(scale.width()),
-                               baseFrequencyY * SkScalarInvert(scale.height()));
-            fTileSize.set(SkScalarRoundToInt(tileVec.fX), SkScalarRoundToInt(tileVec.fY));
-            this->init(seed);
-            if (!fTileSize.isEmpty()) {
-                this->stitch();
-            }
-        }
-
-        void generateBitmaps() {
-            SkImageInfo info = SkImageInfo::MakeA8(kBlockSize, 1);
-            fPermutationsBitmap.installPixels(info, fLatticeSelector, info.minRowBytes());
-            fPermutationsBitmap.setImmutable();
-
-            info = SkImageInfo::Make(kBlockSize, 4, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
-            fNoiseBitmap.installPixels(info, fNoise[0][0], info.minRowBytes());
-            fNoiseBitmap.setImmutable();
-        }
-
-        PaintingData(const PaintingData& that)
-                : fSeed(that.fSeed)
-                , fTileSize(that.fTileSize)
-                , fBaseFrequency(that.fBaseFrequency)
-                , fStitchDataInit(that.fStitchDataInit)
-                , fPermutationsBitmap(that.fPermutationsBitmap)
-                , fNoiseBitmap(that.fNoiseBitmap) {
-            memcpy(fLatticeSelector, that.fLatticeSelector, sizeof(fLatticeSelector));
-            memcpy(fNoise, that.fNoise, sizeof(fNoise));
-            memcpy(fGradient, that.fGradient, sizeof(fGradient));
-        }
+    // The lattice selector and gradients only depend on the seed, so all the shaders with the
+    // same seed share one set of them, along with the bitmaps the GPU backends upload.
+    class PermutationTables : public SkNVRefCnt<PermutationTables> {
+    public:
+        static sk_sp<const PermutationTables> Find(SkScalar seed);
 
-        int fSeed;
         uint8_t fLatticeSelector[kBlockSize];
         uint16_t fNoise[4][kBlockSize][2];
         SkPoint fGradient[4][kBlockSize];
-        SkISize fTileSize;
-        SkVector fBaseFrequency;
-        StitchData fStitchDataInit;
 
-    private:
         SkBitmap fPermutationsBitmap;
         SkBitmap fNoiseBitmap;
 
+    private:
+        friend class SkNVRefCnt<PermutationTables>;
+
+        explicit PermutationTables(int seed);
+
         inline int random() {
             // See https://www.w3.org/TR/SVG11/filters.html#feTurbulenceElement
             // m = kRandMaximum, 2**31 - 1 (2147483647)
@@ -131,74 +93,38 @@ public:
             return result;
         }
 
-        // Only called once. Could be part of the constructor.
-        void init(SkScalar seed) {
-            // According to the SVG spec, we must truncate (not round) the seed value.
-            fSeed = SkScalarTruncToInt(seed);
-            // The seed value clamp to the range [1, kRandMaximum - 1].
-            if (fSeed <= 0) {
-                fSeed = -(fSeed % (kRandMaximum - 1)) + 1;
-            }
-            if (fSeed > kRandMaximum - 1) {
-                fSeed = kRandMaximum - 1;
-            }
-            for (int channel = 0; channel < 4; ++channel) {
-                for (int i = 0; i < kBlockSize; ++i) {
-                    fLatticeSelector[i] = i;
-                    fNoise[channel][i][0] = (random() % (2 * kBlockSize));
-                    fNoise[channel][i][1] = (random() % (2 * kBlockSize));
-                }
-            }
-            for (int i = kBlockSize - 1; i > 0; --i) {
-                int k = fLatticeSelector[i];
-                int j = random() % kBlockSize;
-                SkASSERT(j >= 0);
-                SkASSERT(j < kBlockSize);
-                fLatticeSelector[i] = fLatticeSelector[j];
-                fLatticeSelector[j] = k;
-            }
+        int fSeed;
+    };
 
-            // Perform the permutations now
-            {
-                // Copy noise data
-                uint16_t noise[4][kBlockSize][2];
-                for (int i = 0; i < kBlockSize; ++i) {
-                    for (int channel = 0; channel < 4; ++channel) {
-                        for (int j = 0; j < 2; ++j) {
-                            noise[channel][i][j] = fNoise[channel][i][j];
-                        }
-                    }
-                }
-                // Do permutations on noise data
-                for (int i = 0; i < kBlockSize; ++i) {
-                    for (int channel = 0; channel < 4; ++channel) {
-                        for (int j = 0; j < 2; ++j) {
-                            fNoise[channel][i][j] = noise[channel][fLatticeSelector[i]][j];
-                        }
-                    }
-                }
-            }
+    struct PaintingData {
+        PaintingData(const SkISize& tileSize,
+                     SkScalar seed,
+                     SkScalar baseFrequencyX,
+                     SkScalar baseFrequencyY,
+                     const SkMatrix& matrix)
+                : fTables(PermutationTables::Find(seed)) {
+            SkVector tileVec;
+            matrix.mapVector(
+                    SkIntToScalar(tileSize.fWidth), SkIntToScalar(tileSize.fHeight), &tileVec);
 
-            // Half of the largest possible value for 16 bit unsigned int
-            static constexpr SkScalar kHalfMax16bits = 32767.5f;
-
-            // Compute gradients from permuted noise data
-            static constexpr SkScalar kInvBlockSizef = 1.0 / SkIntToScalar(kBlockSize);
-            for (int channel = 0; channel < 4; ++channel) {
-                for (int i = 0; i < kBlockSize; ++i) {
-                    fGradient[channel][i] =
-                            SkPoint::Make((fNoise[channel][i][0] - kBlockSize) * kInvBlockSizef,
-                                          (fNoise[channel][i][1] - kBlockSize) * kInvBlockSizef);
-                    fGradient[channel][i].normalize();
-                    // Put the normalized gradient back into the noise data
-                    fNoise[channel][i][0] =
-                            SkScalarRoundToInt((fGradient[channel][i].fX + 1) * kHalfMax16bits);
-                    fNoise[channel][i][1] =
-                            SkScalarRoundToInt((fGradient[channel][i].fY + 1) * kHalfMax16bits);
-                }
+            SkSize scale;
+            if (!matrix.decomposeScale(&scale, nullptr)) {
+                scale.set(SK_ScalarNearlyZero, SK_ScalarNearlyZero);
+            }
+            fBaseFrequency.set(baseFrequencyX * SkScalarInvert(scale.width()),
+                               baseFrequencyY * SkScalarInvert(scale.height()));
+            fTileSize.set(SkScalarRoundToInt(tileVec.fX), SkScalarRoundToInt(tileVec.fY));
+            if (!fTileSize.isEmpty()) {
+                this->stitch();
             }
         }
 
+        sk_sp<const PermutationTables> fTables;
+        SkISize fTileSize;
+        SkVector fBaseFrequency;
+        StitchData fStitchDataInit;
+
+    private:
         // Only called once. Could be part of the constructor.
         void stitch() {
             SkScalar tileWidth = SkIntToScalar(fTileSize.width());
@@ -238,14 +164,8 @@ public:
         }
 
     public:
-        const SkBitmap& getPermutationsBitmap() const {
-            SkASSERT(!fPermutationsBitmap.drawsNothing());
-            return fPermutationsBitmap;
-        }
-        const SkBitmap& getNoiseBitmap() const {
-            SkASSERT(!fNoiseBitmap.drawsNothing());
-            return fNoiseBitmap;
-        }
+        const SkBitmap& getPermutationsBitmap() const { return fTables->fPermutationsBitmap; }
+        const SkBitmap& getNoiseBitmap() const { return fTables->fNoiseBitmap; }
     };  // struct PaintingData
 
     /**
@@ -270,24 +190,7 @@ public:
 
     ShaderType type() const override { return ShaderType::kPerlinNoise; }
 
-    class PerlinNoiseShaderContext : public Context {
-    public:
-        PerlinNoiseShaderContext(const SkPerlinNoiseShader& shader, const ContextRec&);
-
-        void shadeSpan(int x, int y, SkPMColor[], int count) override;
-
-    private:
-        SkPMColor shade(const SkPoint& point, StitchData& stitchData) const;
-        SkScalar calculateTurbulenceValueForPoint(int channel,
-                                                  StitchData& stitchData,
-                                                  const SkPoint& point) const;
-        SkScalar noise2D(int channel,
-                         const StitchData& stitchData,
-                         const SkPoint& noiseVector) const;
-
-        SkMatrix fMatrix;
-        PaintingData fPaintingData;
-    };
+    bool appendStages(const SkStageRec&, const SkShaders::MatrixRec&) const override;
 
     SkPerlinNoiseShader::Type noiseType() const { return fType; }
     int numOctaves() const { return fNumOctaves; }
@@ -301,9 +204,6 @@ public:
 
 protected:
     void flatten(SkWriteBuffer&) const override;
-#ifdef SK_ENABLE_LEGACY_SHADERCONTEXT
-    Context* onMakeContext(const ContextRec&, SkArenaAlloc*) const override;
-#endif
 
 private:
     SK_FLATTENABLE_HOOKS(SkPerlinNoiseShader)
@@ -30,6 +30,7 @@
 #include "src/shaders/SkLocalMatrixShader.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <utility>
@@ -176,6 +177,21 @@ static sk_sp<SkColorSpace> ref_or_srgb(SkColorSpace* cs) {
     return cs ? sk_ref_sp(cs) : SkColorSpace::MakeSRGB();
 }
 
+// Tiles are rasterized at scales rounded up to the next quarter octave, so that the small changes
+// to the CTM of a zoom animation keep hitting the same cached tile, which is then drawn at most
+// ~19% smaller than it was rasterized.
+static constexpr SkScalar kScaleBucketsPerOctave = 4;
+
+static SkScalar bucket_scale(SkScalar scale) {
+    if (!SkScalarIsFinite(scale) || scale <= 0) {
+        return scale;
+    }
+    // Scales within a sliver of a bucket use it, rather than the next one up.
+    static constexpr SkScalar kSlop = 1.f / 64;
+    const SkScalar bucket = std::ceil(kScaleBucketsPerOctave * std::log2(scale) - kSlop);
+    return std::exp2(bucket / kScaleBucketsPerOctave);
+}
+
 SkPictureShader::CachedImageInfo SkPictureShader::CachedImageInfo::Make(
         const SkRect& bounds,
         const SkMatrix& totalM,
@@ -197,6 +213,7 @@ SkPictureShader::CachedImageInfo SkPictureShader::CachedImageInfo::Make(
                 size.fWidth = size.fHeight = SkScalarSqrt(area);
             }
         }
+        size.set(bucket_scale(size.width()), bucket_scale(size.height()));
         size.fWidth *= bounds.width();
         size.fHeight *= bounds.height();
 
@@ -271,7 +288,31 @@ sk_sp<SkShader> SkPictureShader::rasterShader(const SkMatrix& totalM,
 
     sk_sp<SkImage> image;
     if (!SkResourceCache::Find(key, ImageFromPictureRec::Visitor, &image)) {
-        image = info.makeImage(SkSurfaces::Raster(info.imageInfo, &info.props), fPicture.get());
+        // When zooming out, a tile up to an octave larger may still be cached. Mipmapping it is
+        // much cheaper than rasterizing the picture again, and just as good when minified.
+        for (int i = 1; !image && i <= kScaleBucketsPerOctave; ++i) {
+            const SkScalar up = std::exp2(i / kScaleBucketsPerOctave);
+            CachedImageInfo larger = CachedImageInfo::Make(fTile,
+                                                           SkMatrix::Scale(up, up) * totalM,
+                                                           dstColorType, dstColorSpace,
+                                                           maxTextureSize_NotUsedForCPU,
+                                                           propsIn);
+            if (!larger.success || larger.tileScale == info.tileScale) {
+                break;  // Clamped to the largest tile we'll make.
+            }
+            ImageFromPictureKey largerKey(larger.imageInfo.colorSpace(),
+                                          larger.imageInfo.colorType(),
+                                          fPicture->uniqueID(), fTile, larger.tileScale,
+                                          larger.props);
+            sk_sp<SkImage> largerImage;
+            if (SkResourceCache::Find(largerKey, ImageFromPictureRec::Visitor, &largerImage)) {
+                image = largerImage->withDefaultMipmaps();
+            }
+        }
+        if (!image) {
+            image = info.makeImage(SkSurfaces::Raster(info.imageInfo, &info.props),
+                                   fPicture.get());
+        }
         if (!image) {
             return nullptr;
         }
@@ -279,9 +320,13 @@ sk_sp<SkShader> SkPictureShader::rasterShader(const SkMatrix& totalM,
         SkResourceCache::Add(new ImageFromPictureRec(key, image));
         SkPicturePriv::AddedToCache(fPicture.get());
     }
-    // Scale the image to the original picture size.
-    auto lm = SkMatrix::Scale(1.f/info.tileScale.width(), 1.f/info.tileScale.height());
-    return image->makeShader(fTmx, fTmy, SkSamplingOptions(fFilter), &lm);
+    // Scale the image to the original picture size. It may be larger than info.imageInfo if it
+    // came from a larger tile.
+    auto lm = SkMatrix::Scale(fTile.width() / image->width(), fTile.height() / image->height());
+    const SkSamplingOptions sampling = image->hasMipmaps()
+            ? SkSamplingOptions(fFilter, SkMipmapMode::kLinear)
+            : SkSamplingOptions(fFilter);
+    return image->makeShader(fTmx, fTmy, sampling, &lm);
 }
 
 bool SkPictureShader::appendStages(const SkStageRec& rec, const SkShaders::MatrixRec& mRec) const {
@@ -160,6 +160,7 @@ private:
 }  // namespace SkShaders
 
 #define SK_ALL_SHADERS(M) \
+    M(AnalyticClip)       \
     M(Blend)              \
     M(CTM)                \
     M(Color)              \
@@ -167,6 +168,7 @@ private:
     M(ColorFilter)        \
     M(CoordClamp)         \
     M(Empty)              \
+    M(GainmapApply)       \
     M(GradientBase)       \
     M(Image)              \
     M(LocalMatrix)        \
@@ -426,6 +428,7 @@ void SkRegisterColor4ShaderFlattenable();
 void SkRegisterColorShaderFlattenable();
 void SkRegisterCoordClampShaderFlattenable();
 void SkRegisterEmptyShaderFlattenable();
+void SkRegisterGainmapApplyShaderFlattenable();
 void SkRegisterPerlinNoiseShaderFlattenable();
 void SkRegisterWorkingColorSpaceShaderFlattenable();
 
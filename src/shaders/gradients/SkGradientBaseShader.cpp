@@ -19,15 +19,18 @@
 #include "include/private/base/SkFloatBits.h"
 #include "include/private/base/SkFloatingPoint.h"
 #include "include/private/base/SkMalloc.h"
+#include "include/private/base/SkMutex.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTPin.h"
 #include "include/private/base/SkTo.h"
 #include "src/base/SkArenaAlloc.h"
 #include "src/base/SkVx.h"
+#include "src/core/SkChecksum.h"
 #include "src/core/SkColorSpacePriv.h"
 #include "src/core/SkColorSpaceXformSteps.h"
 #include "src/core/SkConvertPixels.h"
 #include "src/core/SkEffectPriv.h"
+#include "src/core/SkLRUCache.h"
 #include "src/core/SkPicturePriv.h"
 #include "src/core/SkRasterPipeline.h"
 #include "src/core/SkRasterPipelineOpContexts.h"
@@ -37,8 +40,10 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <optional>
 #include <utility>
+#include <vector>
 
 using namespace skia_private;
 
@@ -321,11 +326,163 @@ static void init_stop_pos(SkRasterPipeline_GradientCtx* ctx,
     add_stop_color(ctx, stop, Fs, Bs);
 }
 
+// Fills in ctx for stops at arbitrary positions. Its arrays need room for count + 1 stops.
+static void init_stops_at_positions(SkRasterPipeline_GradientCtx* ctx,
+                                    const SkPMColor4f* pmColors,
+                                    const SkScalar* positions,
+                                    int count) {
+    // Remove the default stops inserted by SkGradientBaseShader::SkGradientBaseShader
+    // because they are naturally handled by the search method.
+    int firstStop;
+    int lastStop;
+    if (count > 2) {
+        firstStop = pmColors[0] != pmColors[1] ? 0 : 1;
+        lastStop = pmColors[count - 2] != pmColors[count - 1] ? count - 1 : count - 2;
+    } else {
+        firstStop = 0;
+        lastStop = 1;
+    }
+
+    size_t stopCount = 0;
+    float t_l = positions[firstStop];
+    SkPMColor4f c_l = pmColors[firstStop];
+    add_const_color(ctx, stopCount++, c_l);
+    // N.B. lastStop is the index of the last stop, not one after.
+    for (int i = firstStop; i < lastStop; i++) {
+        float t_r = positions[i + 1];
+        SkPMColor4f c_r = pmColors[i + 1];
+        SkASSERT(t_l <= t_r);
+        if (t_l < t_r) {
+            float c_scale = sk_ieee_float_divide(1, t_r - t_l);
+            if (sk_float_isfinite(c_scale)) {
+                init_stop_pos(ctx, stopCount, t_l, c_scale, c_l, c_r);
+                stopCount += 1;
+            }
+        }
+        t_l = t_r;
+        c_l = c_r;
+    }
+
+    ctx->ts[stopCount] = t_l;
+    add_const_color(ctx, stopCount++, c_l);
+
+    ctx->stopCount = stopCount;
+}
+
+// Gradients with at least this many stops at arbitrary positions look up where to start searching
+// for t's stop, rather than comparing t against every stop.
+static constexpr int kMinIndexedStops = 16;
+
+// The stops of a gradient, and for each of cellCount equal parts of [0,1], the first stop that
+// falls in it. These only depend on the colors and positions, so gradients that share stops share
+// one of these too.
+class GradientStopIndex : public SkNVRefCnt<GradientStopIndex> {
+public:
+    GradientStopIndex(const SkPMColor4f* pmColors, const SkScalar* positions, int count)
+            : fColors(pmColors, pmColors + count)
+            , fPositions(positions, positions + count) {
+        // Room for the stops as in AppendGradientFillStages(), and for the +inf after them.
+        const size_t stride = std::max(count + 1, 8);
+        fStops.resize(8 * stride + count + 2);
+        SkRasterPipeline_GradientCtx* ctx = &fCtx.gradient;
+        for (int i = 0; i < 4; i++) {
+            ctx->fs[i] = fStops.data() + (2 * i + 0) * stride;
+            ctx->bs[i] = fStops.data() + (2 * i + 1) * stride;
+        }
+        ctx->ts = fStops.data() + 8 * stride;
+        init_stops_at_positions(ctx, pmColors, positions, count);
+        ctx->ts[ctx->stopCount] = SK_FloatInfinity;
+
+        // Stop 0 is the color before all the others, so it's never searched for. This must find
+        // the cells just as indexed_gradient does, to land on the same stop as a full search.
+        const uint32_t cellCount = ctx->stopCount <= 64 ? 256 : 1024;
+        auto cell_of = [cellCount](float t) {
+            t = t > 0 ? t : 0;
+            t = t < 1 ? t : 1;
+            return (uint32_t)(t * (float)cellCount);
+        };
+        // Any t in a cell is past all the stops in the cells before it, so that's where its
+        // search starts.
+        fFirstStop.assign(cellCount + 1, 0);
+        uint32_t maxSteps = 0;
+        for (size_t stop = 1, cell = 0; cell <= cellCount; cell++) {
+            fFirstStop[cell] = stop - 1;
+            uint32_t steps = 0;
+            for (; stop < ctx->stopCount && cell_of(ctx->ts[stop]) == cell; stop++) {
+                steps++;
+            }
+            maxSteps = std::max(maxSteps, steps);
+        }
+        fCtx.firstStop = fFirstStop.data();
+        fCtx.cellCount = cellCount;
+        fCtx.maxSteps = maxSteps;
+    }
+
+    bool matches(const SkPMColor4f* pmColors, const SkScalar* positions, int count) const {
+        return fColors.size() == (size_t)count &&
+               0 == memcmp(fColors.data(), pmColors, count * sizeof(SkPMColor4f)) &&
+               0 == memcmp(fPositions.data(), positions, count * sizeof(SkScalar));
+    }
+
+    // When the stops bunch up, stepping through a cell costs more than the full search.
+    bool isWorthwhile() const { return 4 * fCtx.maxSteps <= fCtx.gradient.stopCount; }
+
+    const SkRasterPipeline_IndexedGradientCtx* ctx() const { return &fCtx; }
+
+private:
+    const std::vector<SkPMColor4f> fColors;
+    const std::vector<SkScalar>    fPositions;
+
+    std::vector<float>    fStops;
+    std::vector<uint32_t> fFirstStop;
+    SkRasterPipeline_IndexedGradientCtx fCtx;
+};
+
+static bool append_indexed_gradient(SkRasterPipeline* p,
+                                    SkArenaAlloc* alloc,
+                                    const SkPMColor4f* pmColors,
+                                    const SkScalar* positions,
+                                    int count) {
+    const uint32_t hash = SkChecksum::Hash32(positions, count * sizeof(SkScalar),
+                                             SkChecksum::Hash32(pmColors,
+                                                                count * sizeof(SkPMColor4f)));
+
+    static SkMutex gMutex;
+    static SkLRUCache<uint32_t, sk_sp<GradientStopIndex>> gCache(32);
+
+    sk_sp<GradientStopIndex> index;
+    {
+        SkAutoMutexExclusive lock(gMutex);
+        if (sk_sp<GradientStopIndex>* cached = gCache.find(hash);
+            cached && (*cached)->matches(pmColors, positions, count)) {
+            index = *cached;
+        }
+    }
+    if (!index) {
+        index = sk_make_sp<GradientStopIndex>(pmColors, positions, count);
+        SkAutoMutexExclusive lock(gMutex);
+        gCache.insert_or_update(hash, index);
+    }
+    if (!index->isWorthwhile()) {
+        return false;
+    }
+
+    // The pipeline reads the index until it's done, so keep it alive as long as the alloc.
+    p->append(SkRasterPipelineOp::indexed_gradient,
+              alloc->make<sk_sp<GradientStopIndex>>(std::move(index))->get()->ctx());
+    return true;
+}
+
 void SkGradientBaseShader::AppendGradientFillStages(SkRasterPipeline* p,
                                                     SkArenaAlloc* alloc,
                                                     const SkPMColor4f* pmColors,
                                                     const SkScalar* positions,
                                                     int count) {
+    if (positions && count >= kMinIndexedStops &&
+        append_indexed_gradient(p, alloc, pmColors, positions, count)) {
+        return;
+    }
+
     // The two-stop case with stops at 0 and 1.
     if (count == 2 && positions == nullptr) {
         const SkPMColor4f c_l = pmColors[0], c_r = pmColors[1];
@@ -368,42 +525,7 @@ void SkGradientBaseShader::AppendGradientFillStages(SkRasterPipeline* p,
 
             ctx->ts = alloc->makeArray<float>(count + 1);
 
-            // Remove the default stops inserted by SkGradientBaseShader::SkGradientBaseShader
-            // because they are naturally handled by the search method.
-            int firstStop;
-            int lastStop;
-            if (count > 2) {
-                firstStop = pmColors[0] != pmColors[1] ? 0 : 1;
-                lastStop = pmColors[count - 2] != pmColors[count - 1] ? count - 1 : count - 2;
-            } else {
-                firstStop = 0;
-                lastStop = 1;
-            }
-
-            size_t stopCount = 0;
-            float t_l = positions[firstStop];
-            SkPMColor4f c_l = pmColors[firstStop];
-            add_const_color(ctx, stopCount++, c_l);
-            // N.B. lastStop is the index of the last stop, not one after.
-            for (int i = firstStop; i < lastStop; i++) {
-                float t_r = positions[i + 1];
-                SkPMColor4f c_r = pmColors[i + 1];
-                SkASSERT(t_l <= t_r);
-                if (t_l < t_r) {
-                    float c_scale = sk_ieee_float_divide(1, t_r - t_l);
-                    if (sk_float_isfinite(c_scale)) {
-                        init_stop_pos(ctx, stopCount, t_l, c_scale, c_l, c_r);
-                        stopCount += 1;
-                    }
-                }
-                t_l = t_r;
-                c_l = c_r;
-            }
-
-            ctx->ts[stopCount] = t_l;
-            add_const_color(ctx, stopCount++, c_l);
-
-            ctx->stopCount = stopCount;
+            init_stops_at_positions(ctx, pmColors, positions, count);
             p->append(SkRasterPipelineOp::gradient, ctx);
         }
     }
@@ -73,6 +73,14 @@ bool ReturnsOpaqueColor(const FunctionDefinition& function);
  */
 bool ReturnsInputAlpha(const FunctionDefinition& function, const ProgramUsage& usage);
 
+/**
+ * Determines if `function` is a color filter whose result is an affine function of the input color
+ * (i.e. `M * color + t`, where M and t may depend on uniforms but not on the color). Such filters
+ * can be replaced by a color matrix. Like ReturnsInputAlpha, this is conservative: the body may
+ * only declare locals and then return, and must not call children or user functions.
+ */
+bool IsAffineColorFilter(const FunctionDefinition& function, const ProgramUsage& usage);
+
 /**
  * Checks for recursion or overly-deep function-call chains, and rejects programs which have them.
  * Also, computes the size of the program in a completely flattened state--loops fully unrolled,
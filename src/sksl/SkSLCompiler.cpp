@@ -319,6 +319,7 @@ bool Compiler::optimize(Program& program) {
         while (Transform::EliminateDeadLocalVariables(program)) {
             // Removing dead variables may cause more variables to become unreferenced. Try again.
         }
+        Transform::EliminateCommonSubexpressions(program);
         while (Transform::EliminateDeadGlobalVariables(program)) {
             // Repeat until no changes occur.
         }
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/sksl/SkSLParallelCompiler.h"
+
+#include "include/core/SkExecutor.h"
+#include "include/private/base/SkSemaphore.h"
+#include "src/core/SkTraceEvent.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/ir/SkSLProgram.h"  // IWYU pragma: keep
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace SkSL {
+
+namespace {
+
+// Threads claim jobs from the batch until none are left. The executor may get to the tasks it was
+// given only after every job has been claimed, and even after ConvertPrograms has returned, so the
+// batch is shared with them and they touch nothing else unless they claim a job.
+struct Batch {
+    Batch(const ShaderCaps* caps, SkSpan<const CompileJob> jobs, const CompileJobFinishedFn& fn)
+            : fCaps(caps)
+            , fJobs(jobs)
+            , fFinishedFn(fn)
+            , fResults(jobs.size()) {}
+
+    void convertJobs() {
+        std::unique_ptr<Compiler> compiler;
+        for (size_t index; (index = fNext.fetch_add(1)) < fJobs.size();) {
+            if (!compiler) {
+                compiler = std::make_unique<Compiler>(fCaps);
+            }
+            const CompileJob& job = fJobs[index];
+            CompileResult& result = fResults[index];
+            result.fProgram = compiler->convertProgram(job.fKind, job.fText, job.fSettings);
+            if (!result.fProgram) {
+                result.fErrors = compiler->errorText();
+            }
+            if (fFinishedFn) {
+                fFinishedFn(index, compiler.get(), &result);
+            }
+            fJobDone.signal();
+        }
+    }
+
+    const ShaderCaps*           fCaps;
+    SkSpan<const CompileJob>    fJobs;
+    const CompileJobFinishedFn& fFinishedFn;
+    std::vector<CompileResult>  fResults;
+    std::atomic<size_t>         fNext{0};
+    SkSemaphore                 fJobDone;
+};
+
+}  // namespace
+
+std::vector<CompileResult> ConvertPrograms(SkExecutor* executor,
+                                           const ShaderCaps* caps,
+                                           SkSpan<const CompileJob> jobs,
+                                           const CompileJobFinishedFn& finished) {
+    TRACE_EVENT0("skia.shaders", "SkSL::ConvertPrograms");
+
+    auto batch = std::make_shared<Batch>(caps, jobs, finished);
+    if (executor) {
+        // The calling thread takes a share of the jobs as well.
+        for (size_t i = 1; i < jobs.size(); ++i) {
+            executor->add([batch] { batch->convertJobs(); });
+        }
+    }
+    batch->convertJobs();
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        batch->fJobDone.wait();
+    }
+    return std::move(batch->fResults);
+}
+
+}  // namespace SkSL
@@ -0,0 +1,59 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef SKSL_PARALLELCOMPILER
+#define SKSL_PARALLELCOMPILER
+
+#include "include/core/SkSpan.h"
+#include "src/sksl/SkSLProgramKind.h"
+#include "src/sksl/SkSLProgramSettings.h"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class SkExecutor;
+
+namespace SkSL {
+
+class Compiler;
+struct Program;
+struct ShaderCaps;
+
+struct CompileJob {
+    ProgramKind     fKind;
+    std::string     fText;
+    ProgramSettings fSettings;
+};
+
+struct CompileResult {
+    std::unique_ptr<Program> fProgram;  // null if the job failed to compile
+    std::string              fErrors;
+};
+
+// Called on the thread that converted a job, with the Compiler that converted it, so that work
+// on the finished program (e.g. generating backend code from it) runs in parallel too.
+using CompileJobFinishedFn = std::function<void(size_t index, Compiler*, CompileResult*)>;
+
+/**
+ * Converts a batch of SkSL programs, spreading the jobs across the executor's threads. Each
+ * thread converts its jobs with a Compiler of its own, while the built-in modules, which are
+ * immutable once loaded, are shared by all of them. The calling thread converts jobs too, and
+ * returns once all of them are done; with a null executor, it converts every job itself.
+ *
+ * The results are in the same order as the jobs.
+ */
+std::vector<CompileResult> ConvertPrograms(SkExecutor* executor,
+                                           const ShaderCaps* caps,
+                                           SkSpan<const CompileJob> jobs,
+                                           const CompileJobFinishedFn& finished = nullptr);
+
+}  // namespace SkSL
+
+#endif  // SKSL_PARALLELCOMPILER
@@ -1074,6 +1074,7 @@ SkSL::Layout Parser::layout() {
             {"blend_support_all_equations", SkSL::LayoutFlag::kBlendSupportAllEquations},
             {"push_constant",               SkSL::LayoutFlag::kPushConstant},
             {"color",                       SkSL::LayoutFlag::kColor},
+            {"specialize",                  SkSL::LayoutFlag::kSpecialize},
             {"vulkan",                      SkSL::LayoutFlag::kVulkan},
             {"metal",                       SkSL::LayoutFlag::kMetal},
             {"webgpu",                      SkSL::LayoutFlag::kWebGPU},
@@ -52,6 +52,12 @@ struct ProgramSettings {
     // (Requires fOptimize = true) When greater than zero, enables the inliner. The threshold value
     // sets an upper limit on the acceptable amount of code growth from inlining.
     int fInlineThreshold = SkSL::kDefaultInlineThreshold;
+    // (Requires fOptimize = true) Computes pure expressions that a block evaluates more than once
+    // into a temporary variable, so they are only evaluated once.
+    bool fEliminateCommonSubexpressions = false;
+    // (Requires fOptimize = true) Moves pure expressions that don't change from one iteration of a
+    // loop to the next out of the loop body.
+    bool fHoistLoopInvariants = false;
     // If true, every function in the generated program will be given the `noinline` modifier.
     bool fForceNoInline = false;
     // If true, implicit conversions to lower precision numeric types are allowed (e.g., float to
@@ -0,0 +1,283 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkSpan.h"
+#include "include/core/SkTypes.h"
+#include "src/core/SkTHash.h"
+#include "src/sksl/SkSLAnalysis.h"
+#include "src/sksl/SkSLIntrinsicList.h"
+#include "src/sksl/SkSLOperator.h"
+#include "src/sksl/analysis/SkSLProgramUsage.h"
+#include "src/sksl/ir/SkSLBinaryExpression.h"
+#include "src/sksl/ir/SkSLBlock.h"
+#include "src/sksl/ir/SkSLConstructor.h"
+#include "src/sksl/ir/SkSLExpression.h"
+#include "src/sksl/ir/SkSLFieldAccess.h"
+#include "src/sksl/ir/SkSLFunctionCall.h"
+#include "src/sksl/ir/SkSLFunctionDeclaration.h"
+#include "src/sksl/ir/SkSLFunctionDefinition.h"
+#include "src/sksl/ir/SkSLIndexExpression.h"
+#include "src/sksl/ir/SkSLModifierFlags.h"
+#include "src/sksl/ir/SkSLPrefixExpression.h"
+#include "src/sksl/ir/SkSLReturnStatement.h"
+#include "src/sksl/ir/SkSLStatement.h"
+#include "src/sksl/ir/SkSLSwizzle.h"
+#include "src/sksl/ir/SkSLTernaryExpression.h"
+#include "src/sksl/ir/SkSLType.h"
+#include "src/sksl/ir/SkSLVarDeclarations.h"
+#include "src/sksl/ir/SkSLVariable.h"
+#include "src/sksl/ir/SkSLVariableReference.h"
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+
+using namespace skia_private;
+
+namespace SkSL {
+namespace {
+
+// How an expression depends on the input color. Ordered so that combining two values with +, -
+// or a constructor gives the larger of the two.
+enum class Linearity {
+    kConstant,  // Doesn't depend on the input color; may still depend on uniforms.
+    kAffine,    // A linear function of the input color, plus a constant.
+    kOther,
+};
+
+class AffineColorFilterClassifier {
+public:
+    AffineColorFilterClassifier(const Variable* inputVar, const ProgramUsage& usage)
+            : fInputVar(inputVar), fUsage(usage) {}
+
+    // Returns true if the statements compute nothing but stable locals before returning an affine
+    // color as the very last statement.
+    bool classifyBody(const Statement& stmt, bool isLast) {
+        switch (stmt.kind()) {
+            case Statement::Kind::kBlock: {
+                const StatementArray& children = stmt.as<Block>().children();
+                for (int i = 0; i < children.size(); ++i) {
+                    if (!this->classifyBody(*children[i], isLast && i == children.size() - 1)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case Statement::Kind::kNop:
+                return true;
+
+            case Statement::Kind::kVarDeclaration: {
+                const VarDeclaration& decl = stmt.as<VarDeclaration>();
+                // The declaration is the variable's only write, so it holds its initial value
+                // everywhere it's read.
+                if (!decl.value() || fUsage.get(*decl.var()).fWrite != 1) {
+                    return false;
+                }
+                Linearity linearity = this->classify(*decl.value());
+                if (linearity == Linearity::kOther) {
+                    return false;
+                }
+                fLocals.set(decl.var(), linearity);
+                return true;
+            }
+            case Statement::Kind::kReturn: {
+                const ReturnStatement& ret = stmt.as<ReturnStatement>();
+                return isLast && ret.expression() &&
+                       this->classify(*ret.expression()) != Linearity::kOther;
+            }
+            default:
+                return false;
+        }
+    }
+
+private:
+    Linearity classifyVariable(const Variable& var) {
+        if (&var == fInputVar) {
+            return Linearity::kAffine;
+        }
+        if (const Linearity* local = fLocals.find(&var)) {
+            return *local;
+        }
+        if (var.modifierFlags().isUniform() && fUsage.get(var).fWrite == 0) {
+            return Linearity::kConstant;
+        }
+        return Linearity::kOther;
+    }
+
+    Linearity classifyCall(const FunctionCall& call) {
+        const FunctionDeclaration& function = call.function();
+        if (!function.isIntrinsic() || !function.modifierFlags().isPure()) {
+            return Linearity::kOther;
+        }
+        // The color transform intrinsics are appended through the RP callbacks, which only know
+        // about the pipeline that the effect is drawn with.
+        IntrinsicKind intrinsic = function.intrinsicKind();
+        if (intrinsic == k_toLinearSrgb_IntrinsicKind ||
+            intrinsic == k_fromLinearSrgb_IntrinsicKind) {
+            return Linearity::kOther;
+        }
+
+        const ExpressionArray& args = call.arguments();
+        Linearity argLinearity[3] = {};
+        Linearity combined = Linearity::kConstant;
+        for (int i = 0; i < args.size(); ++i) {
+            Linearity linearity = this->classify(*args[i]);
+            if (i < (int)std::size(argLinearity)) {
+                argLinearity[i] = linearity;
+            }
+            combined = std::max(combined, linearity);
+        }
+        if (combined != Linearity::kAffine) {
+            return combined;
+        }
+
+        switch (intrinsic) {
+            case k_dot_IntrinsicKind:
+                // A sum of products, which stays affine as long as one side is constant.
+                return (argLinearity[0] == Linearity::kConstant ||
+                        argLinearity[1] == Linearity::kConstant) ? Linearity::kAffine
+                                                                 : Linearity::kOther;
+            case k_mix_IntrinsicKind:
+                // Blending between two affine colors by a constant weight.
+                return (args.size() == 3 && args[2]->type().componentType().isFloat() &&
+                        argLinearity[2] == Linearity::kConstant) ? Linearity::kAffine
+                                                                 : Linearity::kOther;
+            default:
+                return Linearity::kOther;
+        }
+    }
+
+    Linearity classify(const Expression& expr) {
+        switch (expr.kind()) {
+            case Expression::Kind::kLiteral:
+                return Linearity::kConstant;
+
+            case Expression::Kind::kVariableReference:
+                return this->classifyVariable(*expr.as<VariableReference>().variable());
+
+            case Expression::Kind::kBinary: {
+                const BinaryExpression& binary = expr.as<BinaryExpression>();
+                if (binary.getOperator().isAssignment()) {
+                    return Linearity::kOther;
+                }
+                Linearity left = this->classify(*binary.left()),
+                          right = this->classify(*binary.right());
+                if (left == Linearity::kConstant && right == Linearity::kConstant) {
+                    return Linearity::kConstant;
+                }
+                if (left == Linearity::kOther || right == Linearity::kOther ||
+                    !binary.type().componentType().isFloat()) {
+                    return Linearity::kOther;
+                }
+                switch (binary.getOperator().kind()) {
+                    case Operator::Kind::PLUS:
+                    case Operator::Kind::MINUS:
+                        return Linearity::kAffine;
+                    case Operator::Kind::STAR:
+                        // This also covers matrix-vector products with a constant matrix.
+                        return (left == Linearity::kConstant || right == Linearity::kConstant)
+                                       ? Linearity::kAffine
+                                       : Linearity::kOther;
+                    case Operator::Kind::SLASH:
+                        return right == Linearity::kConstant ? Linearity::kAffine
+                                                             : Linearity::kOther;
+                    default:
+                        return Linearity::kOther;
+                }
+            }
+            case Expression::Kind::kPrefix: {
+                const PrefixExpression& prefix = expr.as<PrefixExpression>();
+                Linearity operand = this->classify(*prefix.operand());
+                switch (prefix.getOperator().kind()) {
+                    case Operator::Kind::PLUS:
+                    case Operator::Kind::MINUS:
+                        return operand;
+                    case Operator::Kind::LOGICALNOT:
+                    case Operator::Kind::BITWISENOT:
+                        return operand == Linearity::kConstant ? Linearity::kConstant
+                                                               : Linearity::kOther;
+                    default:
+                        return Linearity::kOther;
+                }
+            }
+            case Expression::Kind::kSwizzle:
+                return this->classify(*expr.as<Swizzle>().base());
+
+            case Expression::Kind::kFieldAccess:
+                return this->classify(*expr.as<FieldAccess>().base());
+
+            case Expression::Kind::kIndex: {
+                const IndexExpression& index = expr.as<IndexExpression>();
+                return this->classify(*index.index()) == Linearity::kConstant
+                               ? this->classify(*index.base())
+                               : Linearity::kOther;
+            }
+            case Expression::Kind::kTernary: {
+                // A constant test picks the same side for every pixel.
+                const TernaryExpression& ternary = expr.as<TernaryExpression>();
+                if (this->classify(*ternary.test()) != Linearity::kConstant) {
+                    return Linearity::kOther;
+                }
+                return std::max(this->classify(*ternary.ifTrue()),
+                                this->classify(*ternary.ifFalse()));
+            }
+            case Expression::Kind::kFunctionCall:
+                return this->classifyCall(expr.as<FunctionCall>());
+
+            case Expression::Kind::kConstructorArray:
+            case Expression::Kind::kConstructorArrayCast:
+            case Expression::Kind::kConstructorCompound:
+            case Expression::Kind::kConstructorCompoundCast:
+            case Expression::Kind::kConstructorDiagonalMatrix:
+            case Expression::Kind::kConstructorMatrixResize:
+            case Expression::Kind::kConstructorScalarCast:
+            case Expression::Kind::kConstructorSplat:
+            case Expression::Kind::kConstructorStruct: {
+                // Constructors only rearrange their arguments, but converting an affine value to
+                // an int or a bool isn't affine any more.
+                Linearity combined = Linearity::kConstant;
+                SkSpan<const std::unique_ptr<Expression>> args =
+                        expr.asAnyConstructor().argumentSpan();
+                for (const std::unique_ptr<Expression>& arg : args) {
+                    Linearity linearity = this->classify(*arg);
+                    if (linearity == Linearity::kAffine &&
+                        (!arg->type().componentType().isFloat() ||
+                         !expr.type().componentType().isFloat())) {
+                        return Linearity::kOther;
+                    }
+                    combined = std::max(combined, linearity);
+                }
+                return combined;
+            }
+            default:
+                return Linearity::kOther;
+        }
+    }
+
+    const Variable* fInputVar;
+    const ProgramUsage& fUsage;
+    THashMap<const Variable*, Linearity> fLocals;
+};
+
+}  // namespace
+
+bool Analysis::IsAffineColorFilter(const FunctionDefinition& function, const ProgramUsage& usage) {
+    SkSpan<Variable* const> parameters = function.declaration().parameters();
+
+    // We expect a color filter to have a single half4 input, which is never written to.
+    if (parameters.size() != 1 ||
+        parameters[0]->type().columns() != 4 ||
+        !parameters[0]->type().componentType().isFloat() ||
+        usage.get(*parameters[0]).fWrite != 0) {
+        return false;
+    }
+
+    AffineColorFilterClassifier classifier{parameters[0], usage};
+    return classifier.classifyBody(*function.body(), /*isLast=*/true);
+}
+
+}  // namespace SkSL
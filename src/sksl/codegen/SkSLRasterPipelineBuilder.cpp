@@ -1569,6 +1569,111 @@ void Program::appendAdjacentMultiSlotBinaryOp(TArray<Stage>* pipeline, SkArenaAl
     }
 }
 
+bool Program::appendBinaryOpFromMemory(TArray<Stage>* pipeline, SkArenaAlloc* alloc,
+                                       ProgramOp baseStage, std::byte* basePtr,
+                                       SkRPOffset dst, SkRPOffset src, int numSlots) const {
+    if (pipeline->empty()) {
+        return false;
+    }
+
+    ProgramOp fromSlotsStage, fromScalarsStage;
+    switch (baseStage) {
+        case ProgramOp::add_n_floats:
+            fromSlotsStage = ProgramOp::add_n_floats_from_slots;
+            fromScalarsStage = ProgramOp::add_n_floats_from_scalars;
+            break;
+        case ProgramOp::add_n_ints:
+            fromSlotsStage = ProgramOp::add_n_ints_from_slots;
+            fromScalarsStage = ProgramOp::add_n_ints_from_scalars;
+            break;
+        case ProgramOp::sub_n_floats:
+            fromSlotsStage = ProgramOp::sub_n_floats_from_slots;
+            fromScalarsStage = ProgramOp::sub_n_floats_from_scalars;
+            break;
+        case ProgramOp::sub_n_ints:
+            fromSlotsStage = ProgramOp::sub_n_ints_from_slots;
+            fromScalarsStage = ProgramOp::sub_n_ints_from_scalars;
+            break;
+        case ProgramOp::mul_n_floats:
+            fromSlotsStage = ProgramOp::mul_n_floats_from_slots;
+            fromScalarsStage = ProgramOp::mul_n_floats_from_scalars;
+            break;
+        case ProgramOp::mul_n_ints:
+            fromSlotsStage = ProgramOp::mul_n_ints_from_slots;
+            fromScalarsStage = ProgramOp::mul_n_ints_from_scalars;
+            break;
+        case ProgramOp::div_n_floats:
+            fromSlotsStage = ProgramOp::div_n_floats_from_slots;
+            fromScalarsStage = ProgramOp::div_n_floats_from_scalars;
+            break;
+        case ProgramOp::div_n_ints:
+            fromSlotsStage = ProgramOp::div_n_ints_from_slots;
+            fromScalarsStage = ProgramOp::div_n_ints_from_scalars;
+            break;
+        default:
+            return false;
+    }
+
+    // We rely on the exact ordering of SkRP ops here; the copy ops for 1-4 slots are contiguous.
+    Stage& copy = pipeline->back();
+    ProgramOp fusedStage;
+    int copySlots;
+    std::byte* copyDst;
+    const float* copySrc;
+    switch (copy.op) {
+        case ProgramOp::copy_slot_unmasked:    case ProgramOp::copy_2_slots_unmasked:
+        case ProgramOp::copy_3_slots_unmasked: case ProgramOp::copy_4_slots_unmasked: {
+            auto ctx = SkRPCtxUtils::Unpack((const SkRasterPipeline_BinaryOpCtx*)copy.ctx);
+            fusedStage = fromSlotsStage;
+            copySlots = (int)copy.op - (int)ProgramOp::copy_slot_unmasked + 1;
+            copyDst = basePtr + ctx.dst;
+            copySrc = (const float*)(basePtr + ctx.src);
+            break;
+        }
+        case ProgramOp::copy_immutable_unmasked:    case ProgramOp::copy_2_immutables_unmasked:
+        case ProgramOp::copy_3_immutables_unmasked: case ProgramOp::copy_4_immutables_unmasked: {
+            auto ctx = SkRPCtxUtils::Unpack((const SkRasterPipeline_BinaryOpCtx*)copy.ctx);
+            fusedStage = fromScalarsStage;
+            copySlots = (int)copy.op - (int)ProgramOp::copy_immutable_unmasked + 1;
+            copyDst = basePtr + ctx.dst;
+            copySrc = (const float*)(basePtr + ctx.src);
+            break;
+        }
+        case ProgramOp::copy_uniform:    case ProgramOp::copy_2_uniforms:
+        case ProgramOp::copy_3_uniforms: case ProgramOp::copy_4_uniforms: {
+            const auto* ctx = static_cast<const SkRasterPipeline_UniformCtx*>(copy.ctx);
+            fusedStage = fromScalarsStage;
+            copySlots = (int)copy.op - (int)ProgramOp::copy_uniform + 1;
+            copyDst = (std::byte*)ctx->dst;
+            copySrc = ctx->src;
+            break;
+        }
+        default:
+            return false;
+    }
+
+    // The copy must have written exactly the op's right-side. Since the op pops those stack slots,
+    // nothing reads the copy afterwards and it can be dropped.
+    if (copySlots != numSlots || copyDst != basePtr + src) {
+        return false;
+    }
+    // A clone of the stack can overlap the left-side, which the op would overwrite as it goes.
+    const std::byte* srcBegin = (const std::byte*)copySrc;
+    const std::byte* dstBegin = basePtr + dst;
+    const size_t rangeSize = SkOpts::raster_pipeline_highp_stride * numSlots * sizeof(float);
+    if (srcBegin != dstBegin &&
+        srcBegin < dstBegin + rangeSize && dstBegin < srcBegin + rangeSize) {
+        return false;
+    }
+
+    auto* ctx = alloc->make<SkRasterPipeline_MemoryBinaryOpCtx>();
+    ctx->dst = (float*)(basePtr + dst);
+    ctx->src = copySrc;
+    ctx->numSlots = numSlots;
+    copy = {fusedStage, ctx};
+    return true;
+}
+
 void Program::appendAdjacentNWayTernaryOp(TArray<Stage>* pipeline, SkArenaAlloc* alloc,
                                           ProgramOp stage, std::byte* basePtr, SkRPOffset dst,
                                           SkRPOffset src0, SkRPOffset src1, int numSlots) const {
@@ -1917,6 +2022,11 @@ void Program::makeStages(TArray<Stage>* pipeline,
             case ALL_MULTI_SLOT_BINARY_OP_CASES: {
                 float* src = tempStackPtr - (inst.fImmA * N);
                 float* dst = tempStackPtr - (inst.fImmA * 2 * N);
+                if (this->appendBinaryOpFromMemory(pipeline, alloc, (ProgramOp)inst.fOp, basePtr,
+                                                   OffsetFromBase(dst), OffsetFromBase(src),
+                                                   inst.fImmA)) {
+                    break;
+                }
                 this->appendAdjacentMultiSlotBinaryOp(pipeline, alloc, (ProgramOp)inst.fOp,
                                                       basePtr,
                                                       OffsetFromBase(dst),
@@ -3095,6 +3205,19 @@ void Program::Dumper::dump(SkWStream* out, bool writeInstructionCount) {
                 std::tie(opArg1, opArg2) = this->binaryOpCtx(stage.ctx, 4);
                 break;
 
+            case POp::add_n_floats_from_slots:   case POp::add_n_ints_from_slots:
+            case POp::sub_n_floats_from_slots:   case POp::sub_n_ints_from_slots:
+            case POp::mul_n_floats_from_slots:   case POp::mul_n_ints_from_slots:
+            case POp::div_n_floats_from_slots:   case POp::div_n_ints_from_slots:
+            case POp::add_n_floats_from_scalars: case POp::add_n_ints_from_scalars:
+            case POp::sub_n_floats_from_scalars: case POp::sub_n_ints_from_scalars:
+            case POp::mul_n_floats_from_scalars: case POp::mul_n_ints_from_scalars:
+            case POp::div_n_floats_from_scalars: case POp::div_n_ints_from_scalars: {
+                const auto* ctx = static_cast<SkRasterPipeline_MemoryBinaryOpCtx*>(stage.ctx);
+                opArg1 = this->ptrCtx(ctx->dst, ctx->numSlots);
+                opArg2 = this->ptrCtx(ctx->src, ctx->numSlots);
+                break;
+            }
             case POp::copy_from_indirect_uniform_unmasked:
             case POp::copy_from_indirect_unmasked:
             case POp::copy_to_indirect_masked: {
@@ -3579,6 +3702,8 @@ void Program::Dumper::dump(SkWStream* out, bool writeInstructionCount) {
             case POp::add_4_floats:  case POp::add_4_ints:
             case POp::add_n_floats:  case POp::add_n_ints:
             case POp::add_imm_float: case POp::add_imm_int:
+            case POp::add_n_floats_from_slots:   case POp::add_n_ints_from_slots:
+            case POp::add_n_floats_from_scalars: case POp::add_n_ints_from_scalars:
                 opText = opArg1 + " += " + opArg2;
                 break;
 
@@ -3587,6 +3712,8 @@ void Program::Dumper::dump(SkWStream* out, bool writeInstructionCount) {
             case POp::sub_3_floats: case POp::sub_3_ints:
             case POp::sub_4_floats: case POp::sub_4_ints:
             case POp::sub_n_floats: case POp::sub_n_ints:
+            case POp::sub_n_floats_from_slots:   case POp::sub_n_ints_from_slots:
+            case POp::sub_n_floats_from_scalars: case POp::sub_n_ints_from_scalars:
                 opText = opArg1 + " -= " + opArg2;
                 break;
 
@@ -3596,6 +3723,8 @@ void Program::Dumper::dump(SkWStream* out, bool writeInstructionCount) {
             case POp::mul_4_floats:  case POp::mul_4_ints:
             case POp::mul_n_floats:  case POp::mul_n_ints:
             case POp::mul_imm_float: case POp::mul_imm_int:
+            case POp::mul_n_floats_from_slots:   case POp::mul_n_ints_from_slots:
+            case POp::mul_n_floats_from_scalars: case POp::mul_n_ints_from_scalars:
                 opText = opArg1 + " *= " + opArg2;
                 break;
 
@@ -3604,6 +3733,8 @@ void Program::Dumper::dump(SkWStream* out, bool writeInstructionCount) {
             case POp::div_3_floats: case POp::div_3_ints: case POp::div_3_uints:
             case POp::div_4_floats: case POp::div_4_ints: case POp::div_4_uints:
             case POp::div_n_floats: case POp::div_n_ints: case POp::div_n_uints:
+            case POp::div_n_floats_from_slots:   case POp::div_n_ints_from_slots:
+            case POp::div_n_floats_from_scalars: case POp::div_n_ints_from_scalars:
                 opText = opArg1 + " /= " + opArg2;
                 break;
 
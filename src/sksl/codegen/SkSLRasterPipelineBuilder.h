@@ -257,6 +257,14 @@ private:
                                          ProgramOp baseStage, std::byte* basePtr,
                                          SkRPOffset dst, SkRPOffset src, int numSlots) const;
 
+    // If the last stage in the pipeline copied `src` onto the stack from value slots, uniforms or
+    // immutable values, replaces it with a version of the binary op `baseStage` that reads them
+    // from there directly. `baseStage` is the n-way op, e.g. `add_n_floats`; only add, sub, mul
+    // and div on floats and ints have such a version. Returns false if nothing was replaced.
+    bool appendBinaryOpFromMemory(skia_private::TArray<Stage>* pipeline, SkArenaAlloc* alloc,
+                                  ProgramOp baseStage, std::byte* basePtr,
+                                  SkRPOffset dst, SkRPOffset src, int numSlots) const;
+
     // Appends a multi-slot math operation having three inputs (dst, src0, src1) and one output
     // (dst) to the pipeline. The three inputs must be _immediately_ adjacent in memory. `baseStage`
     // must refer to an unbounded "apply_to_n_slots" stage, which must be immediately followed by
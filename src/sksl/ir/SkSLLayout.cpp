@@ -79,6 +79,9 @@ std::string Layout::paddedDescription() const {
     if (fFlags & LayoutFlag::kColor) {
         result += separator() + "color";
     }
+    if (fFlags & LayoutFlag::kSpecialize) {
+        result += separator() + "specialize";
+    }
     if (fLocalSizeX >= 0) {
         result += separator() + "local_size_x = " + std::to_string(fLocalSizeX);
     }
@@ -110,6 +113,7 @@ bool Layout::checkPermittedLayout(const Context& context,
         { LayoutFlag::kPushConstant,             "push_constant"},
         { LayoutFlag::kBlendSupportAllEquations, "blend_support_all_equations"},
         { LayoutFlag::kColor,                    "color"},
+        { LayoutFlag::kSpecialize,               "specialize"},
         { LayoutFlag::kLocation,                 "location"},
         { LayoutFlag::kOffset,                   "offset"},
         { LayoutFlag::kBinding,                  "binding"},
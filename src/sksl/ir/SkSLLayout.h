@@ -57,6 +57,9 @@ enum class LayoutFlag : int {
     kLocalSizeX                 = 1 << 20,
     kLocalSizeY                 = 1 << 21,
     kLocalSizeZ                 = 1 << 22,
+
+    // A runtime-effect uniform which the GPU backends compile into the program as a constant.
+    kSpecialize                 = 1 << 23,
 };
 
 }  // namespace SkSL
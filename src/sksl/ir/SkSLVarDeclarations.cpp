@@ -222,6 +222,24 @@ void VarDeclaration::ErrorCheck(const Context& context,
                                         baseType->displayName() + "'");
         }
     }
+    if (layout.fFlags & LayoutFlag::kSpecialize) {
+        if (!ProgramConfig::IsRuntimeEffect(context.fConfig->fKind)) {
+            context.fErrors->error(pos,
+                                   "'layout(specialize)' is only permitted in runtime effects");
+        }
+        if (!modifierFlags.isUniform()) {
+            context.fErrors->error(pos,
+                                   "'layout(specialize)' is only permitted on 'uniform' variables");
+        }
+        if (type->isArray()) {
+            context.fErrors->error(pos, "'layout(specialize)' is not permitted on arrays");
+        }
+        if (baseType->isEffectChild()) {
+            context.fErrors->error(pos,
+                                   "'layout(specialize)' is not permitted on variables of type '" +
+                                   baseType->displayName() + "'");
+        }
+    }
 
     ModifierFlags permitted = ModifierFlag::kConst | ModifierFlag::kHighp | ModifierFlag::kMediump |
                               ModifierFlag::kLowp;
@@ -319,8 +337,8 @@ void VarDeclaration::ErrorCheck(const Context& context,
         permittedLayoutFlags &= ~LayoutFlag::kAllBackends;
     }
     if (ProgramConfig::IsRuntimeEffect(context.fConfig->fKind)) {
-        // Disallow all layout flags except 'color' in runtime effects
-        permittedLayoutFlags &= LayoutFlag::kColor;
+        // Disallow all layout flags except 'color' and 'specialize' in runtime effects
+        permittedLayoutFlags &= LayoutFlag::kColor | LayoutFlag::kSpecialize;
     }
 
     // The `push_constant` flag isn't allowed on in-variables, out-variables, bindings or sets.
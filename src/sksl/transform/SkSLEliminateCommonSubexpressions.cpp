@@ -0,0 +1,607 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkSpan.h"
+#include "include/core/SkTypes.h"
+#include "src/core/SkTHash.h"
+#include "src/sksl/SkSLAnalysis.h"
+#include "src/sksl/SkSLMangler.h"
+#include "src/sksl/SkSLOperator.h"
+#include "src/sksl/SkSLProgramSettings.h"
+#include "src/sksl/analysis/SkSLProgramUsage.h"
+#include "src/sksl/analysis/SkSLProgramVisitor.h"
+#include "src/sksl/ir/SkSLBinaryExpression.h"
+#include "src/sksl/ir/SkSLBlock.h"
+#include "src/sksl/ir/SkSLConstructor.h"
+#include "src/sksl/ir/SkSLDoStatement.h"
+#include "src/sksl/ir/SkSLExpression.h"
+#include "src/sksl/ir/SkSLFieldAccess.h"
+#include "src/sksl/ir/SkSLForStatement.h"
+#include "src/sksl/ir/SkSLFunctionCall.h"
+#include "src/sksl/ir/SkSLFunctionDeclaration.h"
+#include "src/sksl/ir/SkSLFunctionDefinition.h"
+#include "src/sksl/ir/SkSLIRNode.h"
+#include "src/sksl/ir/SkSLIndexExpression.h"
+#include "src/sksl/ir/SkSLLiteral.h"
+#include "src/sksl/ir/SkSLModifierFlags.h"
+#include "src/sksl/ir/SkSLPrefixExpression.h"
+#include "src/sksl/ir/SkSLProgram.h"
+#include "src/sksl/ir/SkSLProgramElement.h"
+#include "src/sksl/ir/SkSLStatement.h"
+#include "src/sksl/ir/SkSLSwizzle.h"
+#include "src/sksl/ir/SkSLSymbolTable.h"
+#include "src/sksl/ir/SkSLTernaryExpression.h"
+#include "src/sksl/ir/SkSLType.h"
+#include "src/sksl/ir/SkSLVarDeclarations.h"
+#include "src/sksl/ir/SkSLVariable.h"
+#include "src/sksl/ir/SkSLVariableReference.h"
+#include "src/sksl/transform/SkSLProgramWriter.h"
+#include "src/sksl/transform/SkSLTransform.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+using namespace skia_private;
+
+namespace SkSL {
+
+namespace {
+
+// A variable is stable if it holds the same value everywhere it can be referenced, so that reading
+// it early gives the same result as reading it where the program does.
+bool is_stable_variable(const Variable& var, const ProgramUsage& usage) {
+    ProgramUsage::VariableCounts counts = usage.get(var);
+    ModifierFlags flags = var.modifierFlags();
+    switch (var.storage()) {
+        case Variable::Storage::kLocal:
+            return var.initialValue() && counts.fWrite <= 1;
+
+        case Variable::Storage::kParameter:
+            return !(flags & ModifierFlag::kOut) && counts.fWrite == 0;
+
+        case Variable::Storage::kGlobal:
+            // Buffers, workgroup and pixel-local storage can be written by other invocations.
+            return !flags.isBuffer() && !flags.isWorkgroup() && !flags.isPixelLocal() &&
+                   counts.fWrite == 0;
+
+        case Variable::Storage::kInterfaceBlock:
+            return flags.isUniform() && counts.fWrite == 0;
+    }
+    SkUNREACHABLE;
+}
+
+// Returns true if this expression can be evaluated ahead of where it appears without a change in
+// meaning: it has no side effects, reads only stable variables, and can't fault. It may still be
+// evaluated when the program wouldn't have (e.g. when it's in a branch that isn't taken), so
+// integer division and dynamic indexing are excluded.
+bool is_hoistable(const Expression& expr, const ProgramUsage& usage) {
+    switch (expr.kind()) {
+        case Expression::Kind::kLiteral:
+            return true;
+
+        case Expression::Kind::kVariableReference:
+            return is_stable_variable(*expr.as<VariableReference>().variable(), usage);
+
+        case Expression::Kind::kBinary: {
+            const BinaryExpression& binary = expr.as<BinaryExpression>();
+            Operator::Kind op = binary.getOperator().kind();
+            if (binary.getOperator().isAssignment()) {
+                return false;
+            }
+            if ((op == Operator::Kind::SLASH || op == Operator::Kind::PERCENT) &&
+                binary.type().componentType().isInteger()) {
+                return false;
+            }
+            return is_hoistable(*binary.left(), usage) && is_hoistable(*binary.right(), usage);
+        }
+        case Expression::Kind::kPrefix: {
+            const PrefixExpression& prefix = expr.as<PrefixExpression>();
+            switch (prefix.getOperator().kind()) {
+                case Operator::Kind::PLUS:
+                case Operator::Kind::MINUS:
+                case Operator::Kind::LOGICALNOT:
+                case Operator::Kind::BITWISENOT:
+                    return is_hoistable(*prefix.operand(), usage);
+                default:
+                    return false;
+            }
+        }
+        case Expression::Kind::kSwizzle:
+            return is_hoistable(*expr.as<Swizzle>().base(), usage);
+
+        case Expression::Kind::kFieldAccess:
+            return is_hoistable(*expr.as<FieldAccess>().base(), usage);
+
+        case Expression::Kind::kIndex: {
+            const IndexExpression& index = expr.as<IndexExpression>();
+            return index.index()->isIntLiteral() && is_hoistable(*index.base(), usage);
+        }
+        case Expression::Kind::kTernary: {
+            const TernaryExpression& ternary = expr.as<TernaryExpression>();
+            return is_hoistable(*ternary.test(), usage) &&
+                   is_hoistable(*ternary.ifTrue(), usage) &&
+                   is_hoistable(*ternary.ifFalse(), usage);
+        }
+        case Expression::Kind::kFunctionCall: {
+            const FunctionCall& call = expr.as<FunctionCall>();
+            const FunctionDeclaration& function = call.function();
+            if (!function.isIntrinsic() || !function.modifierFlags().isPure()) {
+                return false;
+            }
+            for (const Variable* param : function.parameters()) {
+                if (param->modifierFlags() & ModifierFlag::kOut) {
+                    return false;
+                }
+            }
+            for (const std::unique_ptr<Expression>& arg : call.arguments()) {
+                if (!is_hoistable(*arg, usage)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        case Expression::Kind::kConstructorArray:
+        case Expression::Kind::kConstructorArrayCast:
+        case Expression::Kind::kConstructorCompound:
+        case Expression::Kind::kConstructorCompoundCast:
+        case Expression::Kind::kConstructorDiagonalMatrix:
+        case Expression::Kind::kConstructorMatrixResize:
+        case Expression::Kind::kConstructorScalarCast:
+        case Expression::Kind::kConstructorSplat:
+        case Expression::Kind::kConstructorStruct:
+            for (const std::unique_ptr<Expression>& arg : expr.asAnyConstructor().argumentSpan()) {
+                if (!is_hoistable(*arg, usage)) {
+                    return false;
+                }
+            }
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+// Hashes the same parts of an expression that is_same_tree() compares. Only called on expressions
+// that passed is_hoistable() on their way, so the remaining kinds don't need to be handled.
+uint32_t hash_tree(const Expression& expr, int* nodeCount) {
+    ++*nodeCount;
+    auto mix = [](uint32_t hash, uint32_t value) { return (hash ^ value) * 0x01000193; };
+    uint32_t hash = mix(0x811C9DC5, (uint32_t)expr.kind());
+    switch (expr.kind()) {
+        case Expression::Kind::kLiteral: {
+            double value = expr.as<Literal>().value();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            return mix(mix(hash, (uint32_t)bits), (uint32_t)(bits >> 32));
+        }
+        case Expression::Kind::kVariableReference:
+            return mix(hash, (uint32_t)(uintptr_t)expr.as<VariableReference>().variable());
+
+        case Expression::Kind::kBinary: {
+            const BinaryExpression& binary = expr.as<BinaryExpression>();
+            hash = mix(hash, (uint32_t)binary.getOperator().kind());
+            hash = mix(hash, hash_tree(*binary.left(), nodeCount));
+            return mix(hash, hash_tree(*binary.right(), nodeCount));
+        }
+        case Expression::Kind::kPrefix: {
+            const PrefixExpression& prefix = expr.as<PrefixExpression>();
+            hash = mix(hash, (uint32_t)prefix.getOperator().kind());
+            return mix(hash, hash_tree(*prefix.operand(), nodeCount));
+        }
+        case Expression::Kind::kSwizzle: {
+            const Swizzle& swizzle = expr.as<Swizzle>();
+            for (int8_t component : swizzle.components()) {
+                hash = mix(hash, (uint32_t)component);
+            }
+            return mix(hash, hash_tree(*swizzle.base(), nodeCount));
+        }
+        case Expression::Kind::kFieldAccess: {
+            const FieldAccess& field = expr.as<FieldAccess>();
+            hash = mix(hash, (uint32_t)field.fieldIndex());
+            return mix(hash, hash_tree(*field.base(), nodeCount));
+        }
+        case Expression::Kind::kIndex: {
+            const IndexExpression& index = expr.as<IndexExpression>();
+            hash = mix(hash, hash_tree(*index.index(), nodeCount));
+            return mix(hash, hash_tree(*index.base(), nodeCount));
+        }
+        case Expression::Kind::kTernary: {
+            const TernaryExpression& ternary = expr.as<TernaryExpression>();
+            hash = mix(hash, hash_tree(*ternary.test(), nodeCount));
+            hash = mix(hash, hash_tree(*ternary.ifTrue(), nodeCount));
+            return mix(hash, hash_tree(*ternary.ifFalse(), nodeCount));
+        }
+        case Expression::Kind::kFunctionCall: {
+            const FunctionCall& call = expr.as<FunctionCall>();
+            hash = mix(hash, (uint32_t)(uintptr_t)&call.function());
+            for (const std::unique_ptr<Expression>& arg : call.arguments()) {
+                hash = mix(hash, hash_tree(*arg, nodeCount));
+            }
+            return hash;
+        }
+        default:
+            SkASSERT(expr.isAnyConstructor());
+            for (const std::unique_ptr<Expression>& arg : expr.asAnyConstructor().argumentSpan()) {
+                hash = mix(hash, hash_tree(*arg, nodeCount));
+            }
+            return hash;
+    }
+}
+
+// Unlike Analysis::IsSameExpressionTree, this also matches operators and function calls, which is
+// only safe because both sides are known to be hoistable.
+bool is_same_tree(const Expression& left, const Expression& right) {
+    if (left.kind() != right.kind() || !left.type().matches(right.type())) {
+        return false;
+    }
+    switch (left.kind()) {
+        case Expression::Kind::kBinary: {
+            const BinaryExpression& a = left.as<BinaryExpression>();
+            const BinaryExpression& b = right.as<BinaryExpression>();
+            return a.getOperator().kind() == b.getOperator().kind() &&
+                   is_same_tree(*a.left(), *b.left()) &&
+                   is_same_tree(*a.right(), *b.right());
+        }
+        case Expression::Kind::kPrefix: {
+            const PrefixExpression& a = left.as<PrefixExpression>();
+            const PrefixExpression& b = right.as<PrefixExpression>();
+            return a.getOperator().kind() == b.getOperator().kind() &&
+                   is_same_tree(*a.operand(), *b.operand());
+        }
+        case Expression::Kind::kSwizzle:
+            return left.as<Swizzle>().components() == right.as<Swizzle>().components() &&
+                   is_same_tree(*left.as<Swizzle>().base(), *right.as<Swizzle>().base());
+
+        case Expression::Kind::kFieldAccess:
+            return left.as<FieldAccess>().fieldIndex() == right.as<FieldAccess>().fieldIndex() &&
+                   is_same_tree(*left.as<FieldAccess>().base(), *right.as<FieldAccess>().base());
+
+        case Expression::Kind::kIndex:
+            return is_same_tree(*left.as<IndexExpression>().index(),
+                                *right.as<IndexExpression>().index()) &&
+                   is_same_tree(*left.as<IndexExpression>().base(),
+                                *right.as<IndexExpression>().base());
+
+        case Expression::Kind::kTernary: {
+            const TernaryExpression& a = left.as<TernaryExpression>();
+            const TernaryExpression& b = right.as<TernaryExpression>();
+            return is_same_tree(*a.test(), *b.test()) &&
+                   is_same_tree(*a.ifTrue(), *b.ifTrue()) &&
+                   is_same_tree(*a.ifFalse(), *b.ifFalse());
+        }
+        case Expression::Kind::kFunctionCall: {
+            const FunctionCall& a = left.as<FunctionCall>();
+            const FunctionCall& b = right.as<FunctionCall>();
+            if (&a.function() != &b.function() || a.arguments().size() != b.arguments().size()) {
+                return false;
+            }
+            for (int index = 0; index < a.arguments().size(); ++index) {
+                if (!is_same_tree(*a.arguments()[index], *b.arguments()[index])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            if (left.isAnyConstructor()) {
+                auto a = left.asAnyConstructor().argumentSpan();
+                auto b = right.asAnyConstructor().argumentSpan();
+                if (a.size() != b.size()) {
+                    return false;
+                }
+                for (size_t index = 0; index < a.size(); ++index) {
+                    if (!is_same_tree(*a[index], *b[index])) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            return Analysis::IsSameExpressionTree(left, right);
+    }
+}
+
+struct Occurrence {
+    std::unique_ptr<Expression>* fExpr;
+    int fStatementIndex;  // the child of the block that the expression is found in
+    bool fInLoop;         // true if the expression is inside the body of a loop in that child
+    uint32_t fHash;
+    int fNodeCount;
+};
+
+// Finds every expression in a statement that would be worth computing into a temporary.
+class OccurrenceFinder : public ProgramWriter {
+public:
+    OccurrenceFinder(const ProgramUsage& usage, std::vector<Occurrence>* occurrences)
+            : fUsage(usage)
+            , fOccurrences(occurrences) {}
+
+    void findIn(std::unique_ptr<Statement>& stmt, int statementIndex) {
+        fStatementIndex = statementIndex;
+        SkASSERT(fLoopDepth == 0);
+        this->visitStatementPtr(stmt);
+    }
+
+    bool visitExpressionPtr(std::unique_ptr<Expression>& expr) override {
+        const Type& type = expr->type();
+        if ((type.isScalar() || type.isVector() || type.isMatrix()) && !type.isLiteral() &&
+            !Analysis::IsTrivialExpression(*expr) && !Analysis::IsCompileTimeConstant(*expr) &&
+            is_hoistable(*expr, fUsage)) {
+            Occurrence occurrence{&expr, fStatementIndex, fLoopDepth > 0, 0, 0};
+            occurrence.fHash = hash_tree(*expr, &occurrence.fNodeCount);
+            fOccurrences->push_back(occurrence);
+        }
+        return INHERITED::visitExpressionPtr(expr);
+    }
+
+    bool visitStatementPtr(std::unique_ptr<Statement>& stmt) override {
+        // Loop headers are left alone, since their form matters for unrolling and ES2 validation.
+        if (stmt->is<ForStatement>()) {
+            return this->visitLoopBody(stmt->as<ForStatement>().statement());
+        }
+        if (stmt->is<DoStatement>()) {
+            return this->visitLoopBody(stmt->as<DoStatement>().statement());
+        }
+        return INHERITED::visitStatementPtr(stmt);
+    }
+
+private:
+    bool visitLoopBody(std::unique_ptr<Statement>& body) {
+        ++fLoopDepth;
+        bool result = this->visitStatementPtr(body);
+        --fLoopDepth;
+        return result;
+    }
+
+    const ProgramUsage& fUsage;
+    std::vector<Occurrence>* fOccurrences;
+    int fStatementIndex = 0;
+    int fLoopDepth = 0;
+
+    using INHERITED = ProgramWriter;
+};
+
+bool references_any(const Expression& expr, const THashSet<const Variable*>& vars) {
+    class Finder : public ProgramVisitor {
+    public:
+        Finder(const THashSet<const Variable*>& vars) : fVars(vars) {}
+
+        bool visitExpression(const Expression& e) override {
+            if (e.is<VariableReference>() && fVars.contains(e.as<VariableReference>().variable())) {
+                return true;
+            }
+            return INHERITED::visitExpression(e);
+        }
+
+        const THashSet<const Variable*>& fVars;
+        using INHERITED = ProgramVisitor;
+    };
+    return Finder(vars).visitExpression(expr);
+}
+
+THashSet<const Variable*> variables_declared_in(const Statement& stmt) {
+    class Finder : public ProgramVisitor {
+    public:
+        bool visitStatement(const Statement& s) override {
+            if (s.is<VarDeclaration>()) {
+                fVars.add(s.as<VarDeclaration>().var());
+            }
+            return INHERITED::visitStatement(s);
+        }
+
+        THashSet<const Variable*> fVars;
+        using INHERITED = ProgramVisitor;
+    };
+    Finder finder;
+    finder.visitStatement(stmt);
+    return std::move(finder.fVars);
+}
+
+class CommonSubexpressionEliminator : public ProgramWriter {
+public:
+    CommonSubexpressionEliminator(const Context& context,
+                                  ProgramUsage* usage,
+                                  bool eliminateCommon,
+                                  bool hoistLoopInvariants)
+            : fContext(context)
+            , fUsage(usage)
+            , fEliminateCommon(eliminateCommon)
+            , fHoistLoopInvariants(hoistLoopInvariants) {}
+
+    bool visitExpressionPtr(std::unique_ptr<Expression>&) override {
+        // Expressions are rewritten by the block that contains them.
+        return false;
+    }
+
+    bool visitStatementPtr(std::unique_ptr<Statement>& stmt) override {
+        if (stmt->is<Block>()) {
+            Block& block = stmt->as<Block>();
+            // Temporaries can only be declared into a block with its own scope.
+            if (block.isScope() && block.symbolTable()) {
+                while (this->hoistOne(block)) {
+                    fMadeChanges = true;
+                }
+            }
+        }
+        return INHERITED::visitStatementPtr(stmt);
+    }
+
+    bool fMadeChanges = false;
+
+private:
+    // Finds the largest expression worth hoisting among the block's children and computes it
+    // ahead of the first child that uses it. Returns false once there is nothing left to hoist.
+    bool hoistOne(Block& block) {
+        StatementArray& children = block.children();
+        std::vector<Occurrence> occurrences;
+        OccurrenceFinder finder(*fUsage, &occurrences);
+        for (int index = 0; index < children.size(); ++index) {
+            finder.findIn(children[index], index);
+        }
+        if (occurrences.empty()) {
+            return false;
+        }
+
+        // Group identical expressions together. The sort is stable, so each group lists its
+        // occurrences in program order.
+        std::vector<int> order(occurrences.size());
+        for (size_t index = 0; index < order.size(); ++index) {
+            order[index] = index;
+        }
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            return occurrences[a].fHash < occurrences[b].fHash;
+        });
+
+        std::vector<std::vector<int>> groups;
+        for (size_t start = 0; start < order.size();) {
+            size_t end = start + 1;
+            while (end < order.size() &&
+                   occurrences[order[end]].fHash == occurrences[order[start]].fHash) {
+                ++end;
+            }
+            // Hash collisions aside, a run of equal hashes is a single group.
+            std::vector<std::vector<int>> runGroups;
+            for (size_t i = start; i < end; ++i) {
+                const Occurrence& occurrence = occurrences[order[i]];
+                auto match = std::find_if(runGroups.begin(), runGroups.end(), [&](auto& group) {
+                    return is_same_tree(**occurrences[group.front()].fExpr, **occurrence.fExpr);
+                });
+                if (match != runGroups.end()) {
+                    match->push_back(order[i]);
+                } else {
+                    runGroups.push_back({order[i]});
+                }
+            }
+            for (std::vector<int>& group : runGroups) {
+                if (this->isWorthHoisting(occurrences, group)) {
+                    groups.push_back(std::move(group));
+                }
+            }
+            start = end;
+        }
+
+        // Larger expressions go first; their subexpressions are reconsidered on the next pass.
+        std::sort(groups.begin(), groups.end(), [&](const auto& a, const auto& b) {
+            const Occurrence& firstA = occurrences[a.front()];
+            const Occurrence& firstB = occurrences[b.front()];
+            if (firstA.fNodeCount != firstB.fNodeCount) {
+                return firstA.fNodeCount > firstB.fNodeCount;
+            }
+            return a.front() < b.front();
+        });
+        for (const std::vector<int>& group : groups) {
+            if (this->hoist(block, occurrences, group)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool isWorthHoisting(const std::vector<Occurrence>& occurrences,
+                         const std::vector<int>& group) const {
+        if (fEliminateCommon && group.size() > 1) {
+            return true;
+        }
+        if (fHoistLoopInvariants) {
+            for (int index : group) {
+                if (occurrences[index].fInLoop) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool hoist(Block& block, const std::vector<Occurrence>& occurrences,
+               const std::vector<int>& group) {
+        const Occurrence& first = occurrences[group.front()];
+        std::unique_ptr<Statement>& firstStmt = block.children()[first.fStatementIndex];
+        const Expression& expr = **first.fExpr;
+
+        // The expression can't move above the declarations of the variables it reads.
+        if (references_any(expr, variables_declared_in(*firstStmt))) {
+            return false;
+        }
+
+        // If the first occurrence initializes a variable that is never changed afterwards, the
+        // others can read that variable instead of a new temporary.
+        const Variable* var = nullptr;
+        if (firstStmt->is<VarDeclaration>() &&
+            firstStmt->as<VarDeclaration>().value().get() == &expr &&
+            is_stable_variable(*firstStmt->as<VarDeclaration>().var(), *fUsage)) {
+            if (group.size() == 1) {
+                return false;
+            }
+            var = firstStmt->as<VarDeclaration>().var();
+        }
+
+        size_t firstReplaced = 0;
+        if (var) {
+            // The declaration keeps its initializer.
+            firstReplaced = 1;
+        } else {
+            SymbolTable* symbols = block.symbolTable().get();
+            Variable::ScratchVariable temp = Variable::MakeScratchVariable(fContext,
+                                                                            fMangler,
+                                                                            "cse",
+                                                                            &expr.type(),
+                                                                            symbols,
+                                                                            expr.clone());
+            fUsage->add(temp.fVarDecl.get());
+            var = temp.fVarSymbol;
+            StatementArray& children = block.children();
+            children.push_back(std::move(temp.fVarDecl));
+            std::rotate(children.begin() + first.fStatementIndex, children.end() - 1,
+                        children.end());
+        }
+
+        for (size_t index = firstReplaced; index < group.size(); ++index) {
+            std::unique_ptr<Expression>& occurrence = *occurrences[group[index]].fExpr;
+            fUsage->remove(occurrence.get());
+            occurrence = VariableReference::Make(occurrence->fPosition, var);
+            fUsage->add(occurrence.get());
+        }
+        return true;
+    }
+
+    const Context& fContext;
+    ProgramUsage* fUsage;
+    Mangler fMangler;
+    bool fEliminateCommon;
+    bool fHoistLoopInvariants;
+
+    using INHERITED = ProgramWriter;
+};
+
+}  // namespace
+
+bool Transform::EliminateCommonSubexpressions(Program& program) {
+    const ProgramSettings& settings = program.fConfig->fSettings;
+    if (!settings.fEliminateCommonSubexpressions && !settings.fHoistLoopInvariants) {
+        return false;
+    }
+    // Compute shaders can communicate through memory between invocations, which makes it unsafe to
+    // assume that a value read twice is the same.
+    if (ProgramConfig::IsCompute(program.fConfig->fKind)) {
+        return false;
+    }
+
+    CommonSubexpressionEliminator eliminator(*program.fContext,
+                                             program.fUsage.get(),
+                                             settings.fEliminateCommonSubexpressions,
+                                             settings.fHoistLoopInvariants);
+    for (std::unique_ptr<ProgramElement>& pe : program.fOwnedElements) {
+        if (pe->is<FunctionDefinition>()) {
+            eliminator.visitStatementPtr(pe->as<FunctionDefinition>().body());
+        }
+    }
+    return eliminator.fMadeChanges;
+}
+
+}  // namespace SkSL
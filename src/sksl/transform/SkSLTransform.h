@@ -92,6 +92,15 @@ bool EliminateDeadGlobalVariables(const Context& context,
                                   bool onlyPrivateGlobals);
 bool EliminateDeadGlobalVariables(Program& program);
 
+/**
+ * Computes pure expressions that are evaluated more than once in a block into a temporary
+ * variable declared ahead of the first statement that needs them, and moves pure expressions out
+ * of the loops that don't change them, as enabled by the program's settings. Only expressions
+ * whose inputs hold the same value throughout their scope are moved. Returns true if any changes
+ * were made.
+ */
+bool EliminateCommonSubexpressions(Program& program);
+
 /** Renames private functions and function-local variables to minimize code size. */
 void RenamePrivateSymbols(Context& context, Module& module, ProgramUsage* usage, ProgramKind kind);
 
@@ -44,9 +44,11 @@
 #include "include/private/base/SkTemplates.h"
 #include "include/private/base/SkTo.h"
 #include "include/svg/SkSVGCanvas.h"
+#include "include/utils/SkParsePath.h"
 #include "src/base/SkBase64.h"
 #include "src/base/SkTLazy.h"
 #include "src/core/SkAnnotationKeys.h"
+#include "src/core/SkChecksum.h"
 #include "src/core/SkClipStack.h"
 #include "src/core/SkDevice.h"
 #include "src/core/SkFontPriv.h"
@@ -181,6 +183,50 @@ static SkString svg_transform(const SkMatrix& t) {
     return tstr;
 }
 
+// Keys for kDeduplicateResources_Flag, which are the same for all the gradients, or clips, that
+// would be written the same way.
+SkString linear_gradient_key(const SkShaderBase::GradientInfo& info, const SkMatrix& localMatrix) {
+    SkString key("linearGradient");
+    auto add = [&key](SkScalar value) { key.appendf(" %.9g", value); };
+    add(info.fPoint[0].x());
+    add(info.fPoint[0].y());
+    add(info.fPoint[1].x());
+    add(info.fPoint[1].y());
+    for (int i = 0; i < info.fColorCount; ++i) {
+        key.appendf(" %08X", info.fColors[i]);
+        add(info.fColorOffsets[i]);
+    }
+    for (int i = 0; i < 9; ++i) {
+        add(localMatrix[i]);
+    }
+    return key;
+}
+
+SkString clip_key(const SkClipStack::Element& e) {
+    SkString key = SkStringPrintf("clipPath %d", (int)e.getDeviceSpaceType());
+    auto add = [&key](SkScalar value) { key.appendf(" %.9g", value); };
+    switch (e.getDeviceSpaceType()) {
+    case SkClipStack::Element::DeviceSpaceType::kRect: {
+        const SkRect& r = e.getDeviceSpaceRect();
+        add(r.fLeft); add(r.fTop); add(r.fRight); add(r.fBottom);
+    } break;
+    case SkClipStack::Element::DeviceSpaceType::kRRect: {
+        const SkRRect& rr = e.getDeviceSpaceRRect();
+        add(rr.rect().fLeft); add(rr.rect().fTop); add(rr.rect().fRight); add(rr.rect().fBottom);
+        add(rr.getSimpleRadii().x()); add(rr.getSimpleRadii().y());
+    } break;
+    case SkClipStack::Element::DeviceSpaceType::kPath: {
+        const SkPath& p = e.getDeviceSpacePath();
+        key.appendf(" %d ", (int)p.getFillType());
+        key.append(SkParsePath::ToSVGString(p));
+    } break;
+    case SkClipStack::Element::DeviceSpaceType::kEmpty:
+    case SkClipStack::Element::DeviceSpaceType::kShader:
+        break;
+    }
+    return key;
+}
+
 struct Resources {
     Resources(const SkPaint& paint)
         : fPaintServer(svg_color(paint.getColor())) {}
@@ -234,12 +280,13 @@ void AddPath(const sktext::GlyphRun& glyphRun, const SkPoint& offset, SkPath* pa
 
 }  // namespace
 
-// For now all this does is serve unique serial IDs, but it will eventually evolve to track
-// and deduplicate resources.
+// Serves unique serial IDs, and with kDeduplicateResources_Flag, remembers the resources already
+// written, so that repeats can refer back to them.
 class SkSVGDevice::ResourceBucket : ::SkNoncopyable {
 public:
-    ResourceBucket()
-            : fGradientCount(0)
+    explicit ResourceBucket(bool deduplicate)
+            : fDeduplicate(deduplicate)
+            , fGradientCount(0)
             , fPathCount(0)
             , fImageCount(0)
             , fPatternCount(0)
@@ -263,7 +310,21 @@ public:
       return SkStringPrintf("pattern_%d", fPatternCount++);
     }
 
+    bool deduplicate() const { return fDeduplicate; }
+
+    // The ID of the gradient or clip path written for key, if there is one.
+    const SkString* findDef(const SkString& key) const { return fDefs.find(key); }
+    void addDef(const SkString& key, const SkString& id) { fDefs.set(key, id); }
+
+    // Path data is only worth defining once it's drawn a second time. Until then, its ID is empty.
+    SkString* findPath(uint64_t hash) { return fPaths.find(hash); }
+    void rememberPath(uint64_t hash) { fPaths.set(hash, SkString()); }
+
 private:
+    const bool fDeduplicate;
+    THashMap<SkString, SkString> fDefs;
+    THashMap<uint64_t, SkString> fPaths;
+
     uint32_t fGradientCount;
     uint32_t fPathCount;
     uint32_t fImageCount;
@@ -332,7 +393,6 @@ public:
     }
 
     void addRectAttributes(const SkRect&);
-    void addPathAttributes(const SkPath&, SkParsePath::PathEncoding);
     void addTextAttributes(const SkFont&);
 
 private:
@@ -418,8 +478,6 @@ Resources SkSVGDevice::AutoElement::addResources(const MxCp& mc, const SkPaint&
     Resources resources(paint);
 
     if (paint.getShader()) {
-        AutoElement defs("defs", fWriter);
-
         this->addShaderResources(paint, &resources);
     }
 
@@ -464,8 +522,23 @@ void SkSVGDevice::AutoElement::addGradientShaderResources(const SkShader* shader
     SkASSERT(grInfo.fColorCount <= grOffsets.count());
 
     SkASSERT(grColors.size() > 0);
-    resources->fPaintServer =
-            SkStringPrintf("url(#%s)", addLinearGradientDef(grInfo, shader, localMatrix).c_str());
+    SkString key;
+    if (fResourceBucket->deduplicate()) {
+        key = linear_gradient_key(grInfo, localMatrix);
+        if (const SkString* id = fResourceBucket->findDef(key)) {
+            resources->fPaintServer = SkStringPrintf("url(#%s)", id->c_str());
+            return;
+        }
+    }
+    SkString id;
+    {
+        AutoElement defs("defs", fWriter);
+        id = this->addLinearGradientDef(grInfo, shader, localMatrix);
+    }
+    if (fResourceBucket->deduplicate()) {
+        fResourceBucket->addDef(key, id);
+    }
+    resources->fPaintServer = SkStringPrintf("url(#%s)", id.c_str());
 }
 
 void SkSVGDevice::AutoElement::addColorFilterResources(const SkColorFilter& cf,
@@ -586,6 +659,7 @@ void SkSVGDevice::AutoElement::addImageShaderResources(const SkShader* shader, c
 
     SkString patternID = fResourceBucket->addPattern();
     {
+        AutoElement defs("defs", fWriter);
         AutoElement pattern("pattern", fWriter);
         pattern.addAttribute("id", patternID);
         pattern.addAttribute("patternUnits", "userSpaceOnUse");
@@ -676,11 +750,6 @@ void SkSVGDevice::AutoElement::addRectAttributes(const SkRect& rect) {
     this->addAttribute("height", rect.height());
 }
 
-void SkSVGDevice::AutoElement::addPathAttributes(const SkPath& path,
-                                                 SkParsePath::PathEncoding encoding) {
-    this->addAttribute("d", SkParsePath::ToSVGString(path, encoding));
-}
-
 void SkSVGDevice::AutoElement::addTextAttributes(const SkFont& font) {
     this->addAttribute("font-size", font.getSize());
 
@@ -739,7 +808,7 @@ SkSVGDevice::SkSVGDevice(const SkISize& size, std::unique_ptr<SkXMLWriter> write
     : SkClipStackDevice(SkImageInfo::MakeUnknown(size.fWidth, size.fHeight),
                         SkSurfaceProps(0, kUnknown_SkPixelGeometry))
     , fWriter(std::move(writer))
-    , fResourceBucket(new ResourceBucket)
+    , fResourceBucket(new ResourceBucket(flags & SkSVGCanvas::kDeduplicateResources_Flag))
     , fFlags(flags)
 {
     SkASSERT(fWriter);
@@ -762,10 +831,13 @@ SkSVGDevice::~SkSVGDevice() {
     }
 }
 
-SkParsePath::PathEncoding SkSVGDevice::pathEncoding() const {
-    return (fFlags & SkSVGCanvas::kRelativePathEncoding_Flag)
+SkString SkSVGDevice::pathData(const SkPath& path) const {
+    const auto encoding = (fFlags & SkSVGCanvas::kRelativePathEncoding_Flag)
         ? SkParsePath::PathEncoding::Relative
         : SkParsePath::PathEncoding::Absolute;
+    return (fFlags & SkSVGCanvas::kCompactPathEncoding_Flag)
+        ? SkParsePath::ToCompactSVGString(path, encoding)
+        : SkParsePath::ToSVGString(path, encoding);
 }
 
 void SkSVGDevice::syncClipStack(const SkClipStack& cs) {
@@ -788,7 +860,17 @@ void SkSVGDevice::syncClipStack(const SkClipStack& cs) {
     }
 
     auto define_clip = [this](const SkClipStack::Element* e) {
+        SkString key;
+        if (fResourceBucket->deduplicate()) {
+            key = clip_key(*e);
+            if (const SkString* id = fResourceBucket->findDef(key)) {
+                return *id;
+            }
+        }
         const auto cid = SkStringPrintf("cl_%x", e->getGenID());
+        if (fResourceBucket->deduplicate()) {
+            fResourceBucket->addDef(key, cid);
+        }
 
         AutoElement clip_path("clipPath", fWriter);
         clip_path.addAttribute("id", cid);
@@ -817,7 +899,7 @@ void SkSVGDevice::syncClipStack(const SkClipStack& cs) {
         case SkClipStack::Element::DeviceSpaceType::kPath: {
             const auto& p = e->getDeviceSpacePath();
             AutoElement path("path", fWriter);
-            path.addPathAttributes(p, this->pathEncoding());
+            path.addAttribute("d", this->pathData(p));
             if (p.getFillType() == SkPathFillType::kEvenOdd) {
                 path.addAttribute("clip-rule", "evenodd");
             }
@@ -929,8 +1011,7 @@ void SkSVGDevice::drawOval(const SkRect& oval, const SkPaint& paint) {
 }
 
 void SkSVGDevice::drawRRect(const SkRRect& rr, const SkPaint& paint) {
-    AutoElement elem("path", this, fResourceBucket.get(), MxCp(this), paint);
-    elem.addPathAttributes(SkPath::RRect(rr), this->pathEncoding());
+    this->drawPathElement(SkPath::RRect(rr), paint);
 }
 
 void SkSVGDevice::drawPath(const SkPath& path, const SkPaint& paint, bool pathIsMutable) {
@@ -961,12 +1042,41 @@ void SkSVGDevice::drawPath(const SkPath& path, const SkPaint& paint, bool pathIs
       path_paint.writable()->setPathEffect(nullptr); // path effect processed
     }
 
-    // Create path element.
-    AutoElement elem("path", this, fResourceBucket.get(), MxCp(this), *path_paint);
-    elem.addPathAttributes(*pathPtr, this->pathEncoding());
+    this->drawPathElement(*pathPtr, *path_paint);
+}
+
+void SkSVGDevice::drawPathElement(const SkPath& path, const SkPaint& paint) {
+    const SkString d = this->pathData(path);
+
+    // With kDeduplicateResources_Flag, path data drawn before is defined once, and <use>d.
+    // Hairlines are left alone, since vector-effect doesn't carry over from <use> to its path.
+    SkString id;
+    const bool hairline = paint.getStyle() != SkPaint::kFill_Style && paint.getStrokeWidth() == 0;
+    if (fResourceBucket->deduplicate() && !hairline) {
+        const uint64_t hash = SkChecksum::Hash64(d.c_str(), d.size());
+        if (SkString* pathID = fResourceBucket->findPath(hash)) {
+            if (pathID->isEmpty()) {
+                *pathID = fResourceBucket->addPath();
+                AutoElement defs("defs", fWriter);
+                AutoElement def("path", fWriter);
+                def.addAttribute("id", *pathID);
+                def.addAttribute("d", d);
+            }
+            id = *pathID;
+        } else {
+            fResourceBucket->rememberPath(hash);
+        }
+    }
+
+    AutoElement elem(id.isEmpty() ? "path" : "use", this, fResourceBucket.get(), MxCp(this), paint);
+    if (id.isEmpty()) {
+        elem.addAttribute("d", d);
+    } else {
+        elem.addAttribute("xlink:href", SkStringPrintf("#%s", id.c_str()));
+    }
 
     // TODO: inverse fill types?
-    if (pathPtr->getFillType() == SkPathFillType::kEvenOdd) {
+    if (path.getFillType() == SkPathFillType::kEvenOdd) {
         elem.addAttribute("fill-rule", "evenodd");
     }
 }
@@ -13,7 +13,6 @@
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTypeTraits.h"
-#include "include/utils/SkParsePath.h"
 #include "src/core/SkClipStackDevice.h"
 
 #include <cstddef>
@@ -35,6 +34,7 @@ class SkMesh;
 class SkPaint;
 class SkPath;
 class SkRRect;
+class SkString;
 class SkVertices;
 class SkXMLWriter;
 struct SkISize;
@@ -77,7 +77,8 @@ private:
 
     void syncClipStack(const SkClipStack&);
 
-    SkParsePath::PathEncoding pathEncoding() const;
+    SkString pathData(const SkPath&) const;
+    void drawPathElement(const SkPath&, const SkPaint&);
 
     class AutoElement;
     class ResourceBucket;
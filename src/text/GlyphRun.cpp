@@ -12,6 +12,7 @@
 #include "include/core/SkRSXform.h"
 #include "include/core/SkScalar.h"
 #include "include/private/base/SkTLogic.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkFontPriv.h"
 #include "src/core/SkGlyph.h"
 #include "src/core/SkStrikeSpec.h"
@@ -152,16 +153,16 @@ static SkRect glyphrun_source_bounds(
             return bounds;
         } else {
             // RSXForm - glyphs can be any scale or rotation.
-            SkRect bounds = SkRect::MakeEmpty();
+            SkRSXformBounds bounds;
             for (auto [pos, scaleRotate, glyph] : SkMakeZip(positions, scaledRotations, glyphs)) {
-                if (!glyph->rect().isEmpty()) {
-                    SkMatrix xform = SkMatrix().setRSXform(
-                            SkRSXform{pos.x(), pos.y(), scaleRotate.x(), scaleRotate.y()});
-                    xform.preScale(strikeToSourceScale, strikeToSourceScale);
-                    bounds.join(xform.mapRect(glyph->rect()));
-                }
+                const SkRect r = glyph->rect();
+                bounds.join(scaleRotate.x(), scaleRotate.y(), pos.x(), pos.y(),
+                            SkRect::MakeLTRB(r.left()   * strikeToSourceScale,
+                                             r.top()    * strikeToSourceScale,
+                                             r.right()  * strikeToSourceScale,
+                                             r.bottom() * strikeToSourceScale));
             }
-            return bounds;
+            return bounds.bounds();
         }
     }
 
@@ -176,13 +177,11 @@ static SkRect glyphrun_source_bounds(
         return bounds;
     } else {
         // RSXForm case glyphs can be any scale or rotation.
-        SkRect bounds;
-        bounds.setEmpty();
+        SkRSXformBounds bounds;
         for (auto [pos, scaleRotate] : SkMakeZip(positions, scaledRotations)) {
-            const SkRSXform xform{pos.x(), pos.y(), scaleRotate.x(), scaleRotate.y()};
-            bounds.join(SkMatrix().setRSXform(xform).mapRect(fontBounds));
+            bounds.join(scaleRotate.x(), scaleRotate.y(), pos.x(), pos.y(), fontBounds);
         }
-        return bounds;
+        return bounds.bounds();
     }
 }
 
@@ -257,9 +256,19 @@ const GlyphRunList& sktext::GlyphRunBuilder::blobToGlyphRunList(
             }
             case SkTextBlobRunIterator::kHorizontal_Positioning: {
                 positions = SkSpan(positionCursor, runSize);
-                for (auto x : SkSpan<const SkScalar>{it.pos(), glyphIDs.size()}) {
-                    *positionCursor++ = SkPoint::Make(x, it.offset().y());
+                const SkScalar* xs = it.pos();
+                const SkScalar y = it.offset().y();
+                size_t i = 0;
+                // Interleave four x positions at a time with the run's y.
+                for (; i + 4 <= runSize; i += 4) {
+                    const skvx::float8 xy = skvx::shuffle<0,4,1,5,2,6,3,7>(
+                            skvx::join(skvx::float4::Load(xs + i), skvx::float4(y)));
+                    xy.store(positionCursor + i);
+                }
+                for (; i < runSize; ++i) {
+                    positionCursor[i] = SkPoint::Make(xs[i], y);
                 }
+                positionCursor += runSize;
                 break;
             }
             case SkTextBlobRunIterator::kFull_Positioning: {
@@ -48,7 +48,7 @@ const SkDescriptor& SkStrikePromise::descriptor() const {
 }
 
 void SkStrikePromise::flatten(SkWriteBuffer& buffer) const {
-    this->descriptor().flatten(buffer);
+    buffer.writeDescriptor(this->descriptor());
 }
 
 // -- StrikeMutationMonitor ------------------------------------------------------------------------
@@ -76,20 +76,36 @@ uint32_t TextStrike::HashTraits::Hash(SkPackedGlyphID key) {
 namespace sktext {
 std::optional<SkStrikePromise> SkStrikePromise::MakeFromBuffer(
         SkReadBuffer& buffer, const SkStrikeClient* client, SkStrikeCache* strikeCache) {
-    std::optional<SkAutoDescriptor> descriptor = SkAutoDescriptor::MakeFromBuffer(buffer);
-    if (!buffer.validate(descriptor.has_value())) {
-        return std::nullopt;
+    const SkDescriptor* desc;
+    std::optional<SkAutoDescriptor> descriptor;
+    if (buffer.isVersionLT(SkPicturePriv::kSharedSlugDescriptors)) {
+        descriptor = SkAutoDescriptor::MakeFromBuffer(buffer);
+        if (!buffer.validate(descriptor.has_value())) {
+            return std::nullopt;
+        }
+        desc = descriptor->getDesc();
+    } else {
+        // Most slugs share a handful of strikes, so their descriptors are written only once per
+        // buffer, and read without being copied out of it.
+        desc = buffer.readDescriptor();
+        if (desc == nullptr) {
+            return std::nullopt;
+        }
     }
 
     // If there is a client, then this from a different process. Translate the SkTypefaceID from
     // the strike server (Renderer) process to strike client (GPU) process.
     if (client != nullptr) {
+        if (!descriptor.has_value()) {
+            descriptor.emplace(*desc);
+        }
         if (!client->translateTypefaceID(&descriptor.value())) {
             return std::nullopt;
         }
+        desc = descriptor->getDesc();
     }
 
-    sk_sp<SkStrike> strike = strikeCache->findStrike(*descriptor->getDesc());
+    sk_sp<SkStrike> strike = strikeCache->findStrike(*desc);
     SkASSERT(strike != nullptr);
     if (!buffer.validate(strike != nullptr)) {
         return std::nullopt;
@@ -856,6 +856,11 @@ public:
         return reuse;
     }
 
+    // The masks can be drawn transformed, as they are for Slugs, just a little softer.
+    bool canReuseWhileScaling(const SkPaint&, const SkMatrix& positionMatrix) const override {
+        return !positionMatrix.hasPerspective();
+    }
+
     const AtlasSubRun* testingOnly_atlasSubRun() const override {
         return this;
     }
@@ -1990,6 +1995,16 @@ bool SubRunContainer::canReuse(const SkPaint& paint, const SkMatrix& positionMat
     return true;
 }
 
+bool SubRunContainer::canReuseWhileScaling(const SkPaint& paint,
+                                           const SkMatrix& positionMatrix) const {
+    for (const SubRun& subRun : fSubRuns) {
+        if (!subRun.canReuseWhileScaling(paint, positionMatrix)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // Returns the empty span if there is a problem reading the positions.
 SkSpan<SkPoint> MakePointsFromBuffer(SkReadBuffer& buffer, SubRunAllocator* alloc) {
     uint32_t glyphCount = buffer.getArrayCount();
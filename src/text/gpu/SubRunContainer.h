@@ -147,6 +147,13 @@ public:
     // position.
     virtual bool canReuse(const SkPaint& paint, const SkMatrix& positionMatrix) const = 0;
 
+    // Like canReuse, but for a draw in the middle of a scale animation, where drawing at a nearby
+    // scale's glyph masks is better than making new masks for every frame.
+    virtual bool canReuseWhileScaling(const SkPaint& paint,
+                                      const SkMatrix& positionMatrix) const {
+        return this->canReuse(paint, positionMatrix);
+    }
+
     // Return the underlying atlas SubRun if it exists. Otherwise, return nullptr.
     // * Don't use this API. It is only to support testing.
     virtual const AtlasSubRun* testingOnly_atlasSubRun() const = 0;
@@ -241,6 +248,7 @@ public:
     const SkMatrix& initialPosition() const { return fInitialPositionMatrix; }
     bool isEmpty() const { return fSubRuns.isEmpty(); }
     bool canReuse(const SkPaint& paint, const SkMatrix& positionMatrix) const;
+    bool canReuseWhileScaling(const SkPaint& paint, const SkMatrix& positionMatrix) const;
 
 private:
     friend struct SubRunContainerPeer;
@@ -150,6 +150,21 @@ auto TextBlob::Key::Make(const GlyphRunList& glyphRunList,
 }
 
 bool TextBlob::Key::operator==(const TextBlob::Key& that) const {
+    if (!this->matchesIgnoringPosition(that)) { return false; }
+
+    // DirectSubRuns do not support perspective when used with a TextBlob. SDFT, Transformed,
+    // Path, and Drawable do support perspective.
+    if (fPositionMatrix.hasPerspective() && fHasSomeDirectSubRuns) { return false; }
+
+    if (fHasSomeDirectSubRuns) {
+        auto [compatible, _] = can_use_direct(fPositionMatrix, that.fPositionMatrix);
+        return compatible;
+    }
+
+    return true;
+}
+
+bool TextBlob::Key::matchesIgnoringPosition(const TextBlob::Key& that) const {
     if (fUniqueID != that.fUniqueID) { return false; }
     if (fCanonicalColor != that.fCanonicalColor) { return false; }
     if (fStyle != that.fStyle) { return false; }
@@ -170,18 +185,7 @@ bool TextBlob::Key::operator==(const TextBlob::Key& that) const {
 
     if (fScalerContextFlags != that.fScalerContextFlags) { return false; }
 
-    // DirectSubRuns do not support perspective when used with a TextBlob. SDFT, Transformed,
-    // Path, and Drawable do support perspective.
-    if (fPositionMatrix.hasPerspective() && fHasSomeDirectSubRuns) { return false; }
-
-    if (fHasSomeDirectSubRuns != that.fHasSomeDirectSubRuns) { return false; }
-
-    if (fHasSomeDirectSubRuns) {
-        auto [compatible, _] = can_use_direct(fPositionMatrix, that.fPositionMatrix);
-        return compatible;
-    }
-
-    return true;
+    return fHasSomeDirectSubRuns == that.fHasSomeDirectSubRuns;
 }
 
 // -- TextBlob -----------------------------------------------------------------------------------
@@ -223,15 +227,21 @@ bool TextBlob::canReuse(const SkPaint& paint, const SkMatrix& positionMatrix) co
         return false;
     }
 
+    return this->canReuseColor(paint) && fSubRuns->canReuse(paint, positionMatrix);
+}
+
+bool TextBlob::canReuseWhileScaling(const SkPaint& paint, const SkMatrix& positionMatrix) const {
+    return !fSubRuns->isEmpty() &&
+           this->canReuseColor(paint) &&
+           fSubRuns->canReuseWhileScaling(paint, positionMatrix);
+}
+
+bool TextBlob::canReuseColor(const SkPaint& paint) const {
     // If we have LCD text then our canonical color will be set to transparent, in this case we have
     // to regenerate the blob on any color change
     // We use the grPaint to get any color filter effects
-    if (fKey.fCanonicalColor == SK_ColorTRANSPARENT &&
-        fInitialLuminance != SkPaintPriv::ComputeLuminanceColor(paint)) {
-        return false;
-    }
-
-    return fSubRuns->canReuse(paint, positionMatrix);
+    return fKey.fCanonicalColor != SK_ColorTRANSPARENT ||
+           fInitialLuminance == SkPaintPriv::ComputeLuminanceColor(paint);
 }
 
 const TextBlob::Key& TextBlob::key() const { return fKey; }
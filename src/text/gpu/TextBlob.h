@@ -79,6 +79,8 @@ public:
         SkPaint::Join fJoin;
 
         bool operator==(const Key& other) const;
+        // Everything but fPositionMatrix matches.
+        bool matchesIgnoringPosition(const Key& other) const;
     };
 
     SK_DECLARE_INTERNAL_LLIST_INTERFACE(TextBlob);
@@ -108,6 +110,9 @@ public:
     void addKey(const Key& key);
 
     bool canReuse(const SkPaint& paint, const SkMatrix& positionMatrix) const;
+    // Whether this blob can draw a frame of a scale animation, if its direct masks were made at a
+    // nearby scale. See SubRun::canReuseWhileScaling().
+    bool canReuseWhileScaling(const SkPaint& paint, const SkMatrix& positionMatrix) const;
 
     const Key& key() const;
     size_t size() const { return SkTo<size_t>(fSize); }
@@ -120,6 +125,8 @@ public:
     const AtlasSubRun* testingOnlyFirstSubRun() const;
 
 private:
+    bool canReuseColor(const SkPaint& paint) const;
+
     // The allocator must come first because it needs to be destroyed last. Other fields of this
     // structure may have pointers into it.
     SubRunAllocator fAlloc;
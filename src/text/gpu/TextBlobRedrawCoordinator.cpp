@@ -14,6 +14,8 @@
 #include "src/core/SkStrikeCache.h"
 #include "src/text/GlyphRun.h"
 
+#include <algorithm>
+#include <initializer_list>
 #include <utility>
 
 class SkCanvas;
@@ -57,9 +59,15 @@ sk_sp<TextBlob> TextBlobRedrawCoordinator::findOrCreateBlob(const SkMatrix& view
 
     auto [canCache, key] = TextBlob::Key::Make(
             glyphRunList, paint, positionMatrix, strikeDeviceInfo);
-    sk_sp<TextBlob> blob;
+    sk_sp<TextBlob> blob, nearbyScale;
     if (canCache) {
-        blob = this->find(key);
+        blob = this->find(key, positionMatrix,
+                          key.fHasSomeDirectSubRuns ? &nearbyScale : nullptr);
+    }
+
+    if ((blob == nullptr || !blob->canReuse(paint, positionMatrix)) &&
+        nearbyScale != nullptr && nearbyScale->canReuseWhileScaling(paint, positionMatrix)) {
+        return nearbyScale;
     }
 
     if (blob == nullptr || !blob->canReuse(paint, positionMatrix)) {
@@ -97,18 +105,32 @@ sk_sp<TextBlob> TextBlobRedrawCoordinator::addOrReturnExisting(
     return blob;
 }
 
-sk_sp<TextBlob> TextBlobRedrawCoordinator::find(const TextBlob::Key& key) {
+static bool same_2x2(const SkMatrix& a, const SkMatrix& b) {
+    return a.getScaleX() == b.getScaleX() && a.getSkewX()  == b.getSkewX() &&
+           a.getSkewY()  == b.getSkewY()  && a.getScaleY() == b.getScaleY();
+}
+
+sk_sp<TextBlob> TextBlobRedrawCoordinator::find(const TextBlob::Key& key,
+                                                const SkMatrix& positionMatrix,
+                                                sk_sp<TextBlob>* nearbyScale) {
     SkAutoSpinlock lock{fSpinLock};
-    const BlobIDCacheEntry* idEntry = fBlobIDCache.find(key.fUniqueID);
+    BlobIDCacheEntry* idEntry = fBlobIDCache.find(key.fUniqueID);
     if (idEntry == nullptr) {
         return nullptr;
     }
 
+    const bool scaling = !same_2x2(idEntry->fLastPositionMatrix, positionMatrix);
+    idEntry->fLastPositionMatrix = positionMatrix;
+
     sk_sp<TextBlob> blob = idEntry->find(key);
-    TextBlob* blobPtr = blob.get();
-    if (blobPtr != nullptr && blobPtr != fBlobList.head()) {
-        fBlobList.remove(blobPtr);
-        fBlobList.addToHead(blobPtr);
+    if (blob == nullptr && scaling && nearbyScale != nullptr) {
+        *nearbyScale = idEntry->findNearbyScale(key, positionMatrix);
+    }
+    for (TextBlob* blobPtr : {blob.get(), nearbyScale ? nearbyScale->get() : nullptr}) {
+        if (blobPtr != nullptr && blobPtr != fBlobList.head()) {
+            fBlobList.remove(blobPtr);
+            fBlobList.addToHead(blobPtr);
+        }
     }
     return blob;
 }
@@ -208,6 +230,7 @@ sk_sp<TextBlob> TextBlobRedrawCoordinator::internalAdd(sk_sp<TextBlob> blob) {
     auto* idEntry = fBlobIDCache.find(id);
     if (!idEntry) {
         idEntry = fBlobIDCache.set(id, BlobIDCacheEntry(id));
+        idEntry->fLastPositionMatrix = blob->key().fPositionMatrix;
     }
 
     if (sk_sp<TextBlob> alreadyIn = idEntry->find(blob->key()); alreadyIn) {
@@ -255,6 +278,42 @@ TextBlobRedrawCoordinator::BlobIDCacheEntry::find(const TextBlob::Key& key) cons
     return index < 0 ? nullptr : fBlobs[index];
 }
 
+sk_sp<TextBlob> TextBlobRedrawCoordinator::BlobIDCacheEntry::findNearbyScale(
+        const TextBlob::Key& key, const SkMatrix& positionMatrix) const {
+    if (positionMatrix.hasPerspective()) {
+        return nullptr;
+    }
+    const float scale = positionMatrix.getMaxScale();
+
+    sk_sp<TextBlob> nearest;
+    float nearestRatio = kMaxScaleReuse;
+    for (const sk_sp<TextBlob>& blob : fBlobs) {
+        const TextBlob::Key& blobKey = blob->key();
+        if (!blobKey.fHasSomeDirectSubRuns || !blobKey.matchesIgnoringPosition(key)) {
+            continue;
+        }
+        // A zoom scales the whole 2x2 uniformly, so blobKey's 2x2 times s should match ours.
+        const SkMatrix& m = blobKey.fPositionMatrix;
+        const float blobScale = m.getMaxScale();
+        if (!(blobScale > 0 && scale > 0)) {
+            continue;
+        }
+        const float s = scale / blobScale,
+                    ratio = std::max(s, 1 / s),
+                    tolerance = scale * (1.f / 1024);
+        if (ratio > nearestRatio ||
+            !SkScalarNearlyEqual(positionMatrix.getScaleX(), s * m.getScaleX(), tolerance) ||
+            !SkScalarNearlyEqual(positionMatrix.getSkewX(),  s * m.getSkewX(),  tolerance) ||
+            !SkScalarNearlyEqual(positionMatrix.getSkewY(),  s * m.getSkewY(),  tolerance) ||
+            !SkScalarNearlyEqual(positionMatrix.getScaleY(), s * m.getScaleY(), tolerance)) {
+            continue;
+        }
+        nearest = blob;
+        nearestRatio = ratio;
+    }
+    return nearest;
+}
+
 int TextBlobRedrawCoordinator::BlobIDCacheEntry::findBlobIndex(const TextBlob::Key& key) const {
     for (int i = 0; i < fBlobs.size(); ++i) {
         if (fBlobs[i]->key() == key) {
@@ -8,6 +8,7 @@
 #ifndef sktext_gpu_TextBlobRedrawCoordinator_DEFINED
 #define sktext_gpu_TextBlobRedrawCoordinator_DEFINED
 
+#include "include/core/SkMatrix.h"
 #include "include/core/SkRefCnt.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkThreadAnnotations.h"
@@ -23,7 +24,6 @@
 
 class GrTextBlobTestingPeer;
 class SkCanvas;
-class SkMatrix;
 class SkPaint;
 struct SkStrikeDeviceInfo;
 
@@ -38,6 +38,11 @@ namespace sktext::gpu {
 // uniqueID. The second tier uses the sktext::gpu::TextBlob's key to get a general match for the
 // draw. The last tier queries each sub run using canReuse to determine if each sub run can handle
 // the drawing parameters.
+//
+// While an SkTextBlob's scale changes from draw to draw, as it does during a zoom animation, a
+// draw that has no exact match may reuse a blob whose direct masks were made at a nearby scale,
+// drawing them transformed. Once the scale settles, the next draw makes masks at the exact scale.
+// SDFT and path sub runs don't depend on the exact scale, so they are reused in any case.
 class TextBlobRedrawCoordinator {
 public:
     TextBlobRedrawCoordinator(uint32_t messageBusID);
@@ -81,9 +86,16 @@ private:
 
         sk_sp<TextBlob> find(const TextBlob::Key& key) const;
 
+        // Finds the blob with direct sub runs whose scale is nearest to positionMatrix's, within
+        // kMaxScaleReuse.
+        sk_sp<TextBlob> findNearbyScale(const TextBlob::Key& key,
+                                        const SkMatrix& positionMatrix) const;
+
         int findBlobIndex(const TextBlob::Key& key) const;
 
         uint32_t fID;
+        // The position matrix of the most recent draw, to tell when the scale is changing.
+        SkMatrix fLastPositionMatrix;
         // Current clients don't generate multiple GrAtlasTextBlobs per SkTextBlob, so an array w/
         // linear search is acceptable.  If usage changes, we should re-evaluate this structure.
         skia_private::STArray<1, sk_sp<TextBlob>> fBlobs;
@@ -99,7 +111,12 @@ private:
             const GlyphRunList& glyphRunList,
             sk_sp<TextBlob> blob) SK_EXCLUDES(fSpinLock);
 
-    sk_sp<TextBlob> find(const TextBlob::Key& key) SK_EXCLUDES(fSpinLock);
+    // Finds the blob for key, and notes positionMatrix as the latest one for key's SkTextBlob. If
+    // the scale changed since the previous draw, it also returns, in nearbyScale, the blob with
+    // direct sub runs at the nearest scale.
+    sk_sp<TextBlob> find(const TextBlob::Key& key,
+                         const SkMatrix& positionMatrix,
+                         sk_sp<TextBlob>* nearbyScale) SK_EXCLUDES(fSpinLock);
 
     void remove(TextBlob* blob) SK_EXCLUDES(fSpinLock);
 
@@ -113,6 +130,9 @@ private:
 
     static const int kDefaultBudget = 1 << 22;
 
+    // How far from their own scale direct masks may be drawn while the scale is changing.
+    static constexpr float kMaxScaleReuse = 1.25f;
+
     mutable SkSpinlock fSpinLock;
     TextBlobList fBlobList SK_GUARDED_BY(fSpinLock);
     skia_private::THashMap<uint32_t, BlobIDCacheEntry> fBlobIDCache SK_GUARDED_BY(fSpinLock);
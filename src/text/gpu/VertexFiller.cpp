@@ -14,6 +14,7 @@
 #include "include/core/SkScalar.h"
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkTLogic.h"
+#include "src/base/SkVx.h"
 #include "src/base/SkZip.h"
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
@@ -29,6 +30,7 @@
 #include <cstdint>
 #include <initializer_list>
 #include <optional>
+#include <tuple>
 
 using MaskFormat = skgpu::MaskFormat;
 
@@ -157,10 +159,56 @@ size_t VertexFiller::vertexStride(const SkMatrix &matrix) const {
     }
 }
 
-// The 99% case. Direct Mask, No clip, No RGB.
-void fillDirectNoClipping(SkZip<Mask2DVertex[4], const Glyph*, const SkPoint> quadData,
-                          GrColor color,
-                          SkPoint originOffset) {
+// The transformed 2D case works on kLanes glyphs at a time: their corners are computed in skvx
+// vectors, and only reading the glyphs and writing out their quads is done glyph by glyph.
+static constexpr int kLanes = 4;
+
+template <int N>
+struct GlyphRects {
+    static constexpr int kCount = N;
+    skvx::Vec<N, float> l, t, r, b;         // each glyph's rect, before any transform
+    skvx::Vec<N, uint16_t> al, at, ar, ab;  // each glyph's rect in the atlas
+};
+
+template <int N, typename Quad, typename VertexData>
+static GlyphRects<N> gather_rects(const SkZip<Quad, const Glyph*, const VertexData>& quadData,
+                                  size_t index) {
+    GlyphRects<N> rects;
+    for (int j = 0; j < N; ++j) {
+        auto [quad, glyph, leftTop] = quadData[index + j];
+        auto [al, at, ar, ab] = glyph->fAtlasLocator.getUVs();
+        rects.l[j] = leftTop.x();
+        rects.t[j] = leftTop.y();
+        rects.al[j] = al;
+        rects.at[j] = at;
+        rects.ar[j] = ar;
+        rects.ab[j] = ab;
+    }
+    rects.r = rects.l + skvx::cast<float>(rects.ar - rects.al);
+    rects.b = rects.t + skvx::cast<float>(rects.ab - rects.at);
+    return rects;
+}
+
+// Calls fn(index, rects) with the GlyphRects of each run of kLanes glyphs, then of each glyph left
+// over.
+template <typename Quad, typename VertexData, typename Fn>
+static void for_each_glyph_rects(const SkZip<Quad, const Glyph*, const VertexData>& quadData,
+                                 Fn&& fn) {
+    size_t i = 0;
+    for (; i + kLanes <= quadData.size(); i += kLanes) {
+        fn(i, gather_rects<kLanes>(quadData, i));
+    }
+    for (; i < quadData.size(); ++i) {
+        fn(i, gather_rects<1>(quadData, i));
+    }
+}
+
+// The 99% case. Direct Mask, No clip. There's too little math per glyph here for
+// for_each_glyph_rects() to pay for itself.
+template<typename Quad, typename VertexData>
+static void fillDirectNoClipping(SkZip<Quad, const Glyph*, const VertexData> quadData,
+                                 GrColor color,
+                                 SkPoint originOffset) {
     for (auto[quad, glyph, leftTop] : quadData) {
         auto[al, at, ar, ab] = glyph->fAtlasLocator.getUVs();
         SkScalar dl = leftTop.x() + originOffset.x(),
@@ -180,47 +228,39 @@ static auto LTBR(const Rect& r) {
     return std::make_tuple(r.left(), r.top(), r.right(), r.bottom());
 }
 
-// Handle any combination of BW or color and clip or no clip.
+// Handle BW or color with a clip.
 template<typename Quad, typename VertexData>
 static void fillDirectClipped(SkZip<Quad, const Glyph*, const VertexData> quadData,
                               GrColor color,
                               SkPoint originOffset,
-                              SkIRect* clip = nullptr) {
+                              const SkIRect& clip) {
     for (auto[quad, glyph, leftTop] : quadData) {
         auto[al, at, ar, ab] = glyph->fAtlasLocator.getUVs();
         uint16_t w = ar - al,
                  h = ab - at;
         SkScalar l = leftTop.x() + originOffset.x(),
                  t = leftTop.y() + originOffset.y();
-        if (clip == nullptr) {
-            auto[dl, dt, dr, db] = SkRect::MakeLTRB(l, t, l + w, t + h);
-            quad[0] = {{dl, dt}, color, {al, at}};  // L,T
-            quad[1] = {{dl, db}, color, {al, ab}};  // L,B
-            quad[2] = {{dr, dt}, color, {ar, at}};  // R,T
-            quad[3] = {{dr, db}, color, {ar, ab}};  // R,B
-        } else {
-            SkIRect devIRect = SkIRect::MakeLTRB(l, t, l + w, t + h);
-            SkScalar dl, dt, dr, db;
-            if (!clip->containsNoEmptyCheck(devIRect)) {
-                if (SkIRect clipped; clipped.intersect(devIRect, *clip)) {
-                    al += clipped.left()   - devIRect.left();
-                    at += clipped.top()    - devIRect.top();
-                    ar += clipped.right()  - devIRect.right();
-                    ab += clipped.bottom() - devIRect.bottom();
-                    std::tie(dl, dt, dr, db) = LTBR(clipped);
-                } else {
-                    // TODO: omit generating any vertex data for fully clipped glyphs ?
-                    std::tie(dl, dt, dr, db) = std::make_tuple(0, 0, 0, 0);
-                    std::tie(al, at, ar, ab) = std::make_tuple(0, 0, 0, 0);
-                }
+        SkIRect devIRect = SkIRect::MakeLTRB(l, t, l + w, t + h);
+        SkScalar dl, dt, dr, db;
+        if (!clip.containsNoEmptyCheck(devIRect)) {
+            if (SkIRect clipped; clipped.intersect(devIRect, clip)) {
+                al += clipped.left()   - devIRect.left();
+                at += clipped.top()    - devIRect.top();
+                ar += clipped.right()  - devIRect.right();
+                ab += clipped.bottom() - devIRect.bottom();
+                std::tie(dl, dt, dr, db) = LTBR(clipped);
             } else {
-                std::tie(dl, dt, dr, db) = LTBR(devIRect);
+                // TODO: omit generating any vertex data for fully clipped glyphs ?
+                std::tie(dl, dt, dr, db) = std::make_tuple(0, 0, 0, 0);
+                std::tie(al, at, ar, ab) = std::make_tuple(0, 0, 0, 0);
             }
-            quad[0] = {{dl, dt}, color, {al, at}};  // L,T
-            quad[1] = {{dl, db}, color, {al, ab}};  // L,B
-            quad[2] = {{dr, dt}, color, {ar, at}};  // R,T
-            quad[3] = {{dr, db}, color, {ar, ab}};  // R,B
+        } else {
+            std::tie(dl, dt, dr, db) = LTBR(devIRect);
         }
+        quad[0] = {{dl, dt}, color, {al, at}};  // L,T
+        quad[1] = {{dl, db}, color, {al, ab}};  // L,B
+        quad[2] = {{dr, dt}, color, {ar, at}};  // R,T
+        quad[3] = {{dr, db}, color, {ar, ab}};  // R,B
     }
 }
 
@@ -228,19 +268,29 @@ template<typename Quad, typename VertexData>
 static void fill2D(SkZip<Quad, const Glyph*, const VertexData> quadData,
                    GrColor color,
                    const SkMatrix& viewDifference) {
-    for (auto [quad, glyph, leftTop] : quadData) {
-        auto [l, t] = leftTop;
-        auto [r, b] = leftTop + glyph->fAtlasLocator.widthHeight();
-        SkPoint lt = viewDifference.mapXY(l, t),
-                lb = viewDifference.mapXY(l, b),
-                rt = viewDifference.mapXY(r, t),
-                rb = viewDifference.mapXY(r, b);
-        auto [al, at, ar, ab] = glyph->fAtlasLocator.getUVs();
-        quad[0] = {lt, color, {al, at}};  // L,T
-        quad[1] = {lb, color, {al, ab}};  // L,B
-        quad[2] = {rt, color, {ar, at}};  // R,T
-        quad[3] = {rb, color, {ar, ab}};  // R,B
-    }
+    SkASSERT(!viewDifference.hasPerspective());
+    const float sx = viewDifference.getScaleX(), kx = viewDifference.getSkewX(),
+                ky = viewDifference.getSkewY(),  sy = viewDifference.getScaleY(),
+                tx = viewDifference.getTranslateX(), ty = viewDifference.getTranslateY();
+    for_each_glyph_rects(quadData, [&](size_t index, const auto& rects) {
+        // Map each corner through the affine viewDifference, in the same order of operations as
+        // SkMatrix::mapXY().
+        const auto lX = rects.l * sx, lY = rects.l * ky,
+                   rX = rects.r * sx, rY = rects.r * ky,
+                   tX = rects.t * kx, tY = rects.t * sy,
+                   bX = rects.b * kx, bY = rects.b * sy;
+        const auto ltX = lX + tX + tx, ltY = lY + tY + ty,
+                   lbX = lX + bX + tx, lbY = lY + bY + ty,
+                   rtX = rX + tX + tx, rtY = rY + tY + ty,
+                   rbX = rX + bX + tx, rbY = rY + bY + ty;
+        for (int j = 0; j < rects.kCount; ++j) {
+            auto& quad = std::get<0>(quadData[index + j]);
+            quad[0] = {{ltX[j], ltY[j]}, color, {rects.al[j], rects.at[j]}};  // L,T
+            quad[1] = {{lbX[j], lbY[j]}, color, {rects.al[j], rects.ab[j]}};  // L,B
+            quad[2] = {{rtX[j], rtY[j]}, color, {rects.ar[j], rects.at[j]}};  // R,T
+            quad[3] = {{rbX[j], rbY[j]}, color, {rects.ar[j], rects.ab[j]}};  // R,B
+        }
+    });
 }
 
 template<typename Quad, typename VertexData>
@@ -294,17 +344,17 @@ void VertexFiller::fillVertexData(int offset, int count,
                 } else {
                     using Quad = ARGB2DVertex[4];
                     SkASSERT(sizeof(ARGB2DVertex) == this->vertexStride(SkMatrix::I()));
-                    fillDirectClipped(quadData((Quad*)vertexBuffer), color, originOffset);
+                    fillDirectNoClipping(quadData((Quad*)vertexBuffer), color, originOffset);
                 }
             } else {
                 if (fMaskType != MaskFormat::kARGB) {
                     using Quad = Mask2DVertex[4];
                     SkASSERT(sizeof(Mask2DVertex) == this->vertexStride(SkMatrix::I()));
-                    fillDirectClipped(quadData((Quad*)vertexBuffer), color, originOffset, &clip);
+                    fillDirectClipped(quadData((Quad*)vertexBuffer), color, originOffset, clip);
                 } else {
                     using Quad = ARGB2DVertex[4];
                     SkASSERT(sizeof(ARGB2DVertex) == this->vertexStride(SkMatrix::I()));
-                    fillDirectClipped(quadData((Quad*)vertexBuffer), color, originOffset, &clip);
+                    fillDirectClipped(quadData((Quad*)vertexBuffer), color, originOffset, clip);
                 }
             }
             return;
@@ -21,7 +21,11 @@
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkTypes.h"
+#include "include/private/base/SkTo.h"
 #include "src/codec/SkCodecImageGenerator.h"
+#include "src/core/SkNextID.h"
+#include "src/core/SkResourceCache.h"
+#include "src/core/SkTaskGroup.h"
 
 #include <algorithm>
 #include <cstddef>
@@ -29,10 +33,52 @@
 #include <utility>
 #include <vector>
 
-SkAnimCodecPlayer::SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec) : fCodec(std::move(codec)) {
+namespace {
+
+static unsigned gAnimFrameKeyNamespaceLabel;
+
+uint64_t anim_frame_shared_id(uint32_t playerID) {
+    return ((uint64_t)SkSetFourByteTag('a', 'n', 'i', 'm') << 32) | playerID;
+}
+
+struct AnimFrameKey : public SkResourceCache::Key {
+    AnimFrameKey(uint32_t playerID, int frameIndex) : fPlayerID(playerID), fFrameIndex(frameIndex) {
+        this->init(&gAnimFrameKeyNamespaceLabel, anim_frame_shared_id(playerID),
+                   sizeof(fPlayerID) + sizeof(fFrameIndex));
+    }
+
+    uint32_t fPlayerID;
+    int32_t  fFrameIndex;
+};
+
+struct AnimFrameRec : public SkResourceCache::Rec {
+    AnimFrameRec(const AnimFrameKey& key, sk_sp<SkImage> image)
+        : fKey(key), fImage(std::move(image)) {}
+
+    AnimFrameKey   fKey;
+    sk_sp<SkImage> fImage;
+
+    const Key& getKey() const override { return fKey; }
+    size_t bytesUsed() const override {
+        return sizeof(*this) + fImage->imageInfo().computeMinByteSize();
+    }
+    const char* getCategory() const override { return "anim-frame"; }
+
+    static bool Visitor(const SkResourceCache::Rec& baseRec, void* contextData) {
+        const AnimFrameRec& rec = static_cast<const AnimFrameRec&>(baseRec);
+        *static_cast<sk_sp<SkImage>*>(contextData) = rec.fImage;
+        return true;
+    }
+};
+
+}  // namespace
+
+SkAnimCodecPlayer::SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec,
+                                     SkExecutor* prefetchExecutor)
+        : fCodec(std::move(codec)), fUniqueID(SkNextID::ImageID()) {
     fImageInfo = fCodec->getInfo();
+    fOrigin = fCodec->getOrigin();
     fFrameInfos = fCodec->getFrameInfo();
-    fImages.resize(fFrameInfos.size());
 
     // change the interpretation of fDuration to a end-time for that frame
     size_t dur = 0;
@@ -45,32 +91,75 @@ SkAnimCodecPlayer::SkAnimCodecPlayer(std::unique_ptr<SkCodec> codec) : fCodec(st
     if (!fTotalDuration) {
         // Static image -- may or may not have returned a single frame info.
         fFrameInfos.clear();
-        fImages.clear();
-        fImages.push_back(SkImages::DeferredFromGenerator(
-                SkCodecImageGenerator::MakeFromCodec(std::move(fCodec))));
+        fStaticImage = SkImages::DeferredFromGenerator(
+                SkCodecImageGenerator::MakeFromCodec(std::move(fCodec)));
+    } else if (prefetchExecutor) {
+        fPrefetchTasks = std::make_unique<SkTaskGroup>(*prefetchExecutor);
     }
 }
 
-SkAnimCodecPlayer::~SkAnimCodecPlayer() {}
+SkAnimCodecPlayer::~SkAnimCodecPlayer() {
+    if (fPrefetchTasks) {
+        fPrefetchTasks->wait();
+    }
+    if (fTotalDuration) {
+        SkResourceCache::PostPurgeSharedID(anim_frame_shared_id(fUniqueID));
+    }
+}
 
 SkISize SkAnimCodecPlayer::dimensions() const {
-    if (!fCodec) {
-        auto image = fImages.front();
-        return image ? image->dimensions() : SkISize::MakeEmpty();
+    if (!fTotalDuration) {
+        return fStaticImage ? fStaticImage->dimensions() : SkISize::MakeEmpty();
     }
-    if (SkEncodedOriginSwapsWidthHeight(fCodec->getOrigin())) {
+    if (SkEncodedOriginSwapsWidthHeight(fOrigin)) {
         return { fImageInfo.height(), fImageInfo.width() };
     }
     return { fImageInfo.width(), fImageInfo.height() };
 }
 
+sk_sp<SkImage> SkAnimCodecPlayer::findFrame(int index) const {
+    if (index == fKeyframeIndex) {
+        return fKeyframe;
+    }
+    sk_sp<SkImage> image;
+    SkResourceCache::Find(AnimFrameKey(fUniqueID, index), AnimFrameRec::Visitor, &image);
+    return image;
+}
+
 sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
     SkASSERT((unsigned)index < fFrameInfos.size());
 
-    if (fImages[index]) {
-        return fImages[index];
+    if (sk_sp<SkImage> image = this->findFrame(index)) {
+        return image;
+    }
+
+    // Walk back to the closest frame this one depends on that is still decoded, or to the
+    // independent frame that starts the chain, then decode forwards from there.
+    std::vector<int> toDecode = {index};
+    sk_sp<SkImage> requiredImage;
+    for (int required = fFrameInfos[index].fRequiredFrame; required != SkCodec::kNoFrame;
+         required = fFrameInfos[required].fRequiredFrame) {
+        if ((requiredImage = this->findFrame(required))) {
+            break;
+        }
+        toDecode.push_back(required);
+    }
+
+    for (auto it = toDecode.rbegin(); it != toDecode.rend(); ++it) {
+        requiredImage = this->decodeFrame(*it, requiredImage);
+        if (!requiredImage) {
+            return nullptr;
+        }
+        if (fFrameInfos[*it].fRequiredFrame == SkCodec::kNoFrame) {
+            fKeyframe = requiredImage;
+            fKeyframeIndex = *it;
+        }
+        SkResourceCache::Add(new AnimFrameRec(AnimFrameKey(fUniqueID, *it), requiredImage));
     }
+    return requiredImage;
+}
 
+sk_sp<SkImage> SkAnimCodecPlayer::decodeFrame(int index, const sk_sp<SkImage>& requiredImage) {
     size_t rb = fImageInfo.minRowBytes();
     size_t size = fImageInfo.computeByteSize(rb);
     auto data = SkData::MakeUninitialized(size);
@@ -78,7 +167,7 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
     SkCodec::Options opts;
     opts.fFrameIndex = index;
 
-    const auto origin = fCodec->getOrigin();
+    const auto origin = fOrigin;
     const auto orientedDims = this->dimensions();
     const auto originMatrix = SkEncodedOriginToMatrix(origin, orientedDims.width(),
                                                               orientedDims.height());
@@ -91,8 +180,8 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
         imageInfo = imageInfo.makeAlphaType(kPremul_SkAlphaType);
     }
     const int requiredFrame = fFrameInfos[index].fRequiredFrame;
-    if (requiredFrame != SkCodec::kNoFrame && fImages[requiredFrame]) {
-        auto requiredImage = fImages[requiredFrame];
+    if (requiredFrame != SkCodec::kNoFrame) {
+        SkASSERT(requiredImage);
         auto canvas = SkCanvas::MakeRasterDirect(imageInfo, data->writable_data(), rb);
         if (origin != kDefault_SkEncodedOrigin) {
             // The required frame is stored after applying the origin. Undo that,
@@ -125,15 +214,29 @@ sk_sp<SkImage> SkAnimCodecPlayer::getFrameAt(int index) {
         canvas->drawImage(image, 0, 0, SkSamplingOptions(), &paint);
         image = SkImages::RasterFromData(imageInfo, std::move(data), rb);
     }
-    return fImages[index] = image;
+    return image;
 }
 
 sk_sp<SkImage> SkAnimCodecPlayer::getFrame() {
-    SkASSERT(fTotalDuration > 0 || fImages.size() == 1);
+    SkASSERT(fTotalDuration > 0 || fFrameInfos.empty());
+
+    if (!fTotalDuration) {
+        return fStaticImage;
+    }
+    if (!fCurrImage) {
+        SkAutoMutexExclusive lock(fMutex);
+        fCurrImage = this->getFrameAt(fCurrIndex);
+    }
 
-    return fTotalDuration > 0
-        ? this->getFrameAt(fCurrIndex)
-        : fImages.front();
+    int nextIndex = (fCurrIndex + 1) % SkToInt(fFrameInfos.size());
+    if (fPrefetchTasks && nextIndex != fPrefetchIndex) {
+        fPrefetchIndex = nextIndex;
+        fPrefetchTasks->add([this, nextIndex] {
+            SkAutoMutexExclusive lock(fMutex);
+            this->getFrameAt(nextIndex);
+        });
+    }
+    return fCurrImage;
 }
 
 bool SkAnimCodecPlayer::seek(uint32_t msec) {
@@ -149,7 +252,9 @@ bool SkAnimCodecPlayer::seek(uint32_t msec) {
                                   });
     int prevIndex = fCurrIndex;
     fCurrIndex = lower - fFrameInfos.begin();
-    return fCurrIndex != prevIndex;
+    if (fCurrIndex != prevIndex) {
+        fCurrImage.reset();
+        return true;
+    }
+    return false;
 }
-
-
@@ -167,7 +167,67 @@ static bool clip_line(SkPoint pts[2], const SkRect& bounds, SkScalar intervalLen
     return true;
 }
 
-// Handles only lines and rects.
+// Each contour is dashed starting from the first interval, so dropping contours that lie entirely
+// outside the bounds doesn't change how the others are dashed. This keeps the work of dashing a
+// path that is mostly off screen, e.g. a map's roads, proportional to the part that is visible.
+// If cull_contours() returns true, dstPath holds only the contours that may be visible.
+static bool cull_contours(const SkPath& srcPath, const SkRect& bounds, SkPath* dstPath) {
+    if (bounds.contains(srcPath.getBounds())) {
+        return false;
+    }
+
+    // Control points bound their curves, so these bounds are conservative. Lines that are
+    // horizontal or vertical have empty bounds, so compare edges rather than use intersects().
+    auto overlaps = [&bounds](const SkRect& r) {
+        return r.fLeft <= bounds.fRight && r.fRight >= bounds.fLeft &&
+               r.fTop <= bounds.fBottom && r.fBottom >= bounds.fTop;
+    };
+
+    bool culled = false;
+    SkPath contour;
+    auto flush = [&]() {
+        if (!contour.isEmpty()) {
+            if (overlaps(contour.getBounds())) {
+                dstPath->addPath(contour);
+            } else {
+                culled = true;
+            }
+            contour.reset();
+        }
+    };
+
+    SkPath::Iter iter(srcPath, false);
+    SkPoint pts[4];
+    for (SkPath::Verb verb; (verb = iter.next(pts)) != SkPath::kDone_Verb;) {
+        switch (verb) {
+            case SkPath::kMove_Verb:
+                flush();
+                contour.moveTo(pts[0]);
+                break;
+            case SkPath::kLine_Verb:
+                contour.lineTo(pts[1]);
+                break;
+            case SkPath::kQuad_Verb:
+                contour.quadTo(pts[1], pts[2]);
+                break;
+            case SkPath::kConic_Verb:
+                contour.conicTo(pts[1], pts[2], iter.conicWeight());
+                break;
+            case SkPath::kCubic_Verb:
+                contour.cubicTo(pts[1], pts[2], pts[3]);
+                break;
+            case SkPath::kClose_Verb:
+                contour.close();
+                break;
+            case SkPath::kDone_Verb:
+                break;
+        }
+    }
+    flush();
+    return culled;
+}
+
+// Handles lines and rects, and otherwise culls whole contours.
 // If cull_path() returns true, dstPath is the new smaller path,
 // otherwise dstPath may have been changed but you should ignore it.
 static bool cull_path(const SkPath& srcPath, const SkStrokeRec& rec,
@@ -229,7 +289,7 @@ static bool cull_path(const SkPath& srcPath, const SkStrokeRec& rec,
         return !dstPath->isEmpty();
     }
 
-    return false;
+    return cull_contours(srcPath, bounds, dstPath);
 }
 
 class SpecialLineRec {
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/utils/SkIncrementalImageUploader.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkSurface.h"
+#include "src/core/SkChecksum.h"
+
+#include <algorithm>
+#include <utility>
+
+// Small enough that a pass over a few rows doesn't upload much more than it decoded, and large
+// enough that images aren't written as hundreds of tiny updates.
+static constexpr int kBandHeight = 16;
+
+static int band_count(int height) {
+    return (height + kBandHeight - 1) / kBandHeight;
+}
+
+static uint32_t hash_band(const SkPixmap& pixels, int band) {
+    const int top = band * kBandHeight;
+    const int rows = std::min(kBandHeight, pixels.height() - top);
+    // The pixels are allocated with minRowBytes, so the rows of a band are contiguous.
+    return SkChecksum::Hash32(pixels.addr(0, top), rows * pixels.rowBytes());
+}
+
+std::unique_ptr<SkIncrementalImageUploader> SkIncrementalImageUploader::Make(
+        std::unique_ptr<SkCodec> codec, sk_sp<SkSurface> surface) {
+    if (!codec || !surface) {
+        return nullptr;
+    }
+    const SkImageInfo info = surface->imageInfo();
+    if (info.dimensions() != codec->dimensions()) {
+        return nullptr;
+    }
+    return std::unique_ptr<SkIncrementalImageUploader>(
+            new SkIncrementalImageUploader(std::move(codec), std::move(surface), info));
+}
+
+SkIncrementalImageUploader::SkIncrementalImageUploader(std::unique_ptr<SkCodec> codec,
+                                                       sk_sp<SkSurface> surface,
+                                                       const SkImageInfo& info)
+        : fCodec(std::move(codec))
+        , fSurface(std::move(surface)) {
+    fPixels.allocPixels(info);
+    fPixels.eraseColor(SK_ColorTRANSPARENT);
+    fSurface->getCanvas()->clear(SK_ColorTRANSPARENT);
+
+    const SkPixmap& pixels = fPixels.pixmap();
+    fBandHashes.resize(band_count(info.height()));
+    for (int band = 0; band < (int)fBandHashes.size(); ++band) {
+        fBandHashes[band] = hash_band(pixels, band);
+    }
+}
+
+SkIncrementalImageUploader::~SkIncrementalImageUploader() = default;
+
+SkCodec::Result SkIncrementalImageUploader::decode() {
+    if (fResult != SkCodec::kIncompleteInput) {
+        return fResult;
+    }
+
+    const SkImageInfo& info = fPixels.info();
+    SkCodec::Result result;
+    if (!fStarted) {
+        // Codecs may need more data before they can start, in which case this is retried on the
+        // next call.
+        result = fCodec->startIncrementalDecode(info, fPixels.getPixels(), fPixels.rowBytes());
+        if (result == SkCodec::kUnimplemented) {
+            fDecodeWholeImage = true;
+        } else if (result != SkCodec::kSuccess) {
+            return result;
+        }
+        fStarted = true;
+    }
+
+    if (fDecodeWholeImage) {
+        // Rows that aren't in the data yet are filled, so every band is uploaded once something
+        // is decoded. That's no worse than decoding and uploading the whole image each time.
+        result = fCodec->getPixels(info, fPixels.getPixels(), fPixels.rowBytes());
+    } else {
+        result = fCodec->incrementalDecode();
+    }
+    if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput &&
+        result != SkCodec::kErrorInInput) {
+        return result;
+    }
+
+    // Whatever was decoded before an error in the input is still worth showing.
+    this->uploadChangedBands();
+    fResult = result;
+    return result;
+}
+
+void SkIncrementalImageUploader::uploadChangedBands() {
+    const SkPixmap& pixels = fPixels.pixmap();
+    bool uploaded = false;
+    for (int band = 0; band < (int)fBandHashes.size(); ++band) {
+        const uint32_t hash = hash_band(pixels, band);
+        if (hash == fBandHashes[band]) {
+            continue;
+        }
+        fBandHashes[band] = hash;
+
+        const int top = band * kBandHeight;
+        const int bottom = std::min(top + kBandHeight, pixels.height());
+        SkPixmap rows;
+        SkAssertResult(pixels.extractSubset(&rows,
+                                            SkIRect::MakeLTRB(0, top, pixels.width(), bottom)));
+        fSurface->writePixels(rows, 0, top);
+        ++fUploadedBandCount;
+        uploaded = true;
+    }
+    if (uploaded) {
+        fImage.reset();
+    }
+}
+
+sk_sp<SkImage> SkIncrementalImageUploader::image() {
+    if (!fImage) {
+        fImage = fSurface->makeImageSnapshot();
+    }
+    return fImage;
+}
@@ -11,12 +11,15 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
+#include "include/private/base/SkAlign.h"
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkMalloc.h"
 #include "include/private/base/SkTo.h"
 #include "include/utils/SkParse.h"
 #include "src/base/SkUTF.h"
+#include "src/base/SkVx.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
@@ -277,6 +280,24 @@ static inline const char* skip_ws(const char* p) {
     return p;
 }
 
+// Skips plain string chars, up to the next string terminator (as is_eostring() would). Checks 16
+// chars at a time while it can do so without reading past p_stop, which must be a terminator.
+static inline const char* skip_string_chars(const char* p, const char* p_stop) {
+    SkASSERT(p <= p_stop && is_eostring(*p_stop));
+
+    using byte16 = skvx::Vec<16, uint8_t>;
+    while (p_stop - p >= 16) {
+        const auto c = byte16::Load(p);
+        if (any((c < 0x20) | (c == '"') | (c == '\\') | (c == ']') | (c == '}'))) {
+            break;
+        }
+        p += 16;
+    }
+
+    while (!is_eostring(*p)) ++p;
+    return p;
+}
+
 static inline float pow10(int32_t exp) {
     static constexpr float g_pow10_table[63] =
     {
@@ -704,7 +725,7 @@ private:
         do {
             // Consume string chars.
             // This is the fast path, and hopefully we only hit it once then quick-exit below.
-            for (p = p + 1; !is_eostring(*p); ++p);
+            p = skip_string_chars(p + 1, p_stop);
 
             if (*p == '"') {
                 // Valid string found.
@@ -786,6 +807,41 @@ private:
                            : nullptr;
     }
 
+    // Matches the exponent following an int32 mantissa's digits, and pushes sign * n32 * 10^exp.
+    const char* matchFastExponent(const char* p, int sign, int32_t n32, int exp) {
+        SkASSERT(*p == 'e' || *p == 'E');
+
+        int exp_sign = 1;
+        if (*++p == '-') {
+            exp_sign = -1;
+            ++p;
+        } else if (*p == '+') {
+            ++p;
+        }
+        if (!is_digit(*p)) {
+            return nullptr;
+        }
+
+        // Anything this large is out of float range either way.
+        static constexpr int32_t kMaxExp = 1000;
+        int32_t e = 0;
+        for (; is_digit(*p); ++p) {
+            e = std::min(e * 10 + (*p - '0'), kMaxExp);
+        }
+
+        // The mantissa is exact, so scaling it in double lands on (or within a rounding of) the
+        // float strtof would produce, denormals included.
+        const double value = sign * (n32 * std::pow(10.0, exp + exp_sign * e));
+        if (is_numeric(*p) || !std::isfinite(value)) {
+            // Malformed input, or out of range: leave it to strtof.
+            return nullptr;
+        }
+
+        this->pushFloat(static_cast<float>(value));
+
+        return p;
+    }
+
     const char* matchFast32OrFloat(const char* p) {
         int sign = 1;
         if (*p == '-') {
@@ -839,10 +895,18 @@ private:
                 return nullptr;
             }
 
+            if (*p == 'e' || *p == 'E') {
+                return p > decimals_start ? this->matchFastExponent(p, sign, n32, exp)
+                                          : nullptr;
+            }
+
             if (n32 > kMaxInt32) {
                 // we ran out on n32 bits
                 return this->matchFastFloatDecimalPart(p, sign, n32, exp);
             }
+        } else if (*p == 'e' || *p == 'E') {
+            return p > digits_start ? this->matchFastExponent(p, sign, n32, 0)
+                                    : nullptr;
         }
 
         return this->matchFastFloatPart(p, sign, n32);
@@ -917,15 +981,193 @@ SkString Value::toString() const {
     return SkString(static_cast<const char*>(data->data()), data->size());
 }
 
+// Baked DOM images are sequences of little-endian 64-bit words:
+//
+//   [magic/version] [root rec] [slab_0] ... [slab_n-1]
+//
+// Records use the Value layout, except pointer records which store the tagged byte offset
+// of their slab within the image.  Slabs use the MakeVector layout, with 64-bit counts and
+// long strings padded to a word boundary.  Slabs are emitted in depth-first pre-order, which
+// lets the loader validate offsets by matching them against its read cursor.
+namespace {
+
+static constexpr uint64_t kBakedSignature = 0x0000000162'6a6b73; // "skjb", version 1
+static constexpr size_t   kBakedMaxDepth  = 1024;
+
+class BakedValue final : public Value {
+public:
+    static bool Bake(const Value& v, std::vector<uint64_t>* image) {
+        image->push_back(kBakedSignature);
+        image->push_back(0);
+
+        return Emit(v, image, 1, 0);
+    }
+
+    static Value Load(const char* data, size_t size, SkArenaAlloc& alloc) {
+        const auto* words = reinterpret_cast<const uint64_t*>(data);
+        size_t cursor = 2;
+        Value root;
+        if (SkIsAlign8(reinterpret_cast<uintptr_t>(data)) && SkIsAlign8(size) &&
+            size >= 2 * sizeof(uint64_t) && words[0] == kBakedSignature &&
+            Relocate(words, size / sizeof(uint64_t), &cursor, words[1], &root, alloc, 0) &&
+            cursor == size / sizeof(uint64_t)) {
+            return root;
+        }
+
+        return NullValue();
+    }
+
+private:
+    static bool IsPointerTag(Tag t) {
+        return t == Tag::kString || t == Tag::kArray || t == Tag::kObject;
+    }
+
+    static const BakedValue& Cast(const Value& v) {
+        return *reinterpret_cast<const BakedValue*>(&v);
+    }
+
+    // Writes the record for |v| at image[rec_index], and appends its slab (if any).
+    static bool Emit(const Value& v, std::vector<uint64_t>* image, size_t rec_index,
+                     size_t depth) {
+        const auto tag = Cast(v).getTag();
+        if (!IsPointerTag(tag)) {
+            memcpy(&(*image)[rec_index], &v, sizeof(Value));
+            return true;
+        }
+        if (depth > kBakedMaxDepth) {
+            return false;
+        }
+
+        const auto slab = image->size();
+        (*image)[rec_index] = (slab * sizeof(uint64_t)) | SkToU8(tag);
+
+        switch (tag) {
+        case Tag::kString: {
+            const auto& str = v.as<StringValue>();
+            image->push_back(str.size());
+            image->resize(slab + 1 + (str.size() + sizeof(uint64_t)) / sizeof(uint64_t), 0);
+            memcpy(image->data() + slab + 1, str.begin(), str.size());
+            return true;
+        }
+        case Tag::kArray: {
+            const auto& array = v.as<ArrayValue>();
+            image->push_back(array.size());
+            image->resize(slab + 1 + array.size());
+            for (size_t i = 0; i < array.size(); ++i) {
+                if (!Emit(array[i], image, slab + 1 + i, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            const auto& object = v.as<ObjectValue>();
+            image->push_back(object.size());
+            image->resize(slab + 1 + object.size() * 2);
+            for (size_t i = 0; i < object.size(); ++i) {
+                if (!Emit(object[i].fKey  , image, slab + 1 + i * 2    , depth + 1) ||
+                    !Emit(object[i].fValue, image, slab + 1 + i * 2 + 1, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        }
+    }
+
+    // Materializes the image record |rec| into |dst|, allocating slabs from |alloc|.
+    static bool Relocate(const uint64_t* image, size_t image_size, size_t* cursor, uint64_t rec,
+                         Value* dst, SkArenaAlloc& alloc, size_t depth) {
+        memcpy(static_cast<void*>(dst), &rec, sizeof(Value));
+
+        const auto tag = Cast(*dst).getTag();
+        if (!IsPointerTag(tag)) {
+            // Short strings must be \0-terminated within the record.
+            return tag != Tag::kShortString || memchr(Cast(*dst).cast<char>(), '\0', 7);
+        }
+
+        const auto slab = (rec & ~static_cast<uint64_t>(kTagMask)) / sizeof(uint64_t);
+        if (depth > kBakedMaxDepth || slab != *cursor || slab >= image_size) {
+            return false;
+        }
+
+        const auto count     = image[slab];
+        const auto available = image_size - slab - 1;
+        switch (tag) {
+        case Tag::kString: {
+            if (count >= available * sizeof(uint64_t)) {
+                return false;
+            }
+            *cursor = slab + 1 + SkToSizeT(count + sizeof(uint64_t)) / sizeof(uint64_t);
+            new (dst) StringValue(reinterpret_cast<const char*>(image + slab + 1),
+                                  SkToSizeT(count), alloc);
+            return true;
+        }
+        case Tag::kArray: {
+            if (count > available) {
+                return false;
+            }
+            *cursor = slab + 1 + SkToSizeT(count);
+            // Copy the records in bulk, then validate and relocate them in place.
+            auto* array = new (dst) ArrayValue(reinterpret_cast<const Value*>(image + slab + 1),
+                                               SkToSizeT(count), alloc);
+            auto* values = const_cast<Value*>(array->begin());
+            for (size_t i = 0; i < count; ++i) {
+                if (!Relocate(image, image_size, cursor, image[slab + 1 + i], values + i,
+                              alloc, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default: {
+            if (count > available / 2) {
+                return false;
+            }
+            *cursor = slab + 1 + SkToSizeT(count) * 2;
+            auto* object = new (dst) ObjectValue(reinterpret_cast<const Member*>(image + slab + 1),
+                                                 SkToSizeT(count), alloc);
+            auto* members = const_cast<Member*>(object->begin());
+            for (size_t i = 0; i < count; ++i) {
+                if (!Relocate(image, image_size, cursor, image[slab + 1 + i * 2],
+                              &members[i].fKey, alloc, depth + 1) ||
+                    !members[i].fKey.is<StringValue>() ||
+                    !Relocate(image, image_size, cursor, image[slab + 1 + i * 2 + 1],
+                              &members[i].fValue, alloc, depth + 1)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        }
+    }
+};
+
+} // namespace
+
 static constexpr size_t kMinChunkSize = 4096;
 
 DOM::DOM(const char* data, size_t size)
     : fAlloc(kMinChunkSize) {
+    if (size >= sizeof(kBakedSignature) && !memcmp(data, &kBakedSignature, 4)) {
+        fRoot = BakedValue::Load(data, size, fAlloc);
+        return;
+    }
+
     DOMParser parser(fAlloc);
 
     fRoot = parser.parse(data, size);
 }
 
+sk_sp<SkData> DOM::bake() const {
+    std::vector<uint64_t> image;
+    if (!BakedValue::Bake(fRoot, &image)) {
+        return nullptr;
+    }
+
+    return SkData::MakeWithCopy(image.data(), image.size() * sizeof(uint64_t));
+}
+
 void DOM::write(SkWStream* stream) const {
     Write(fRoot, stream);
 }
@@ -16,8 +16,10 @@
 #include <cstring>
 #include <string_view>
 
+class SkData;
 class SkString;
 class SkWStream;
+template <typename T> class sk_sp;
 
 namespace skjson {
 
@@ -339,12 +341,22 @@ public:
 
 class DOM final : public SkNoncopyable {
 public:
+    // Accepts either JSON text, or a binary image produced by bake().
     DOM(const char*, size_t);
 
     const Value& root() const { return fRoot; }
 
     void write(SkWStream*) const;
 
+    /**
+     * Serializes the DOM as a compact binary image, which loads without any lexing or number
+     * parsing: records are copied in bulk, and only pointer records need fixing up.
+     * Images are not tied to the pointer size of the producing platform.
+     *
+     * @return    The image, or nullptr if the DOM is too deeply nested.
+     */
+    sk_sp<SkData> bake() const;
+
 private:
     SkArenaAlloc fAlloc;
     Value        fRoot;
@@ -16,10 +16,12 @@
 #include "include/core/SkScalar.h"
 #include "include/core/SkSerialProcs.h"
 #include "include/core/SkStream.h"
+#include "include/private/base/SkAlign.h"
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTo.h"
 #include "include/utils/SkNWayCanvas.h"
+#include "src/core/SkTaskGroup.h"
 #include "src/utils/SkMultiPictureDocument.h"
 #include "src/utils/SkMultiPictureDocumentPriv.h"
 
@@ -29,6 +31,7 @@
 #include <cstring>
 #include <functional>
 #include <utility>
+#include <vector>
 
 using namespace skia_private;
 
@@ -36,13 +39,22 @@ using namespace skia_private;
   File format:
       BEGINNING_OF_FILE:
         kMagic
-        uint32_t version_number (==2)
+        uint32_t version_number (==3)
         uint32_t page_count
         {
           float sizeX
           float sizeY
         } * page_count
-        skp file
+        uint64_t page_offset * (page_count + 1)
+        {
+          skp file
+          padding to a multiple of 4 bytes
+        } * page_count
+
+  Page offsets are relative to the first page, and the last one is where the final page ends.
+
+  Version 2 files have a single skp file after the page sizes instead, which draws each page
+  as a sub-picture followed by a kEndPage annotation.
 */
 
 namespace {
@@ -51,18 +63,25 @@ static constexpr char kMagic[] = "Skia Multi-Picture Doc\n\n";
 
 static constexpr char kEndPage[] = "SkMultiPictureEndPage";
 
-const uint32_t kVersion = 2;
+const uint32_t kSingleSkpVersion = 2;
+const uint32_t kVersion = 3;
 
-static SkSize join(const TArray<SkSize>& sizes) {
-    SkSize joined = {0, 0};
-    for (SkSize s : sizes) {
-        joined = SkSize{std::max(joined.width(), s.width()), std::max(joined.height(), s.height())};
+// Runs fn(0) ... fn(count - 1), in parallel if there's an executor.
+static void for_each_page(SkExecutor* executor, int count, std::function<void(int)> fn) {
+    if (executor) {
+        SkTaskGroup tasks(*executor);
+        tasks.batch(count, std::move(fn));
+        tasks.wait();
+    } else {
+        for (int i = 0; i < count; ++i) {
+            fn(i);
+        }
     }
-    return joined;
 }
 
 struct MultiPictureDocument final : public SkDocument {
     const SkSerialProcs fProcs;
+    SkExecutor* fExecutor;
     SkPictureRecorder fPictureRecorder;
     SkSize fCurrentPageSize;
     TArray<sk_sp<SkPicture>> fPages;
@@ -70,9 +89,11 @@ struct MultiPictureDocument final : public SkDocument {
     std::function<void(const SkPicture*)> fOnEndPage;
     MultiPictureDocument(SkWStream* s,
                          const SkSerialProcs* procs,
-                         std::function<void(const SkPicture*)> onEndPage)
+                         std::function<void(const SkPicture*)> onEndPage,
+                         SkExecutor* executor)
             : SkDocument(s)
             , fProcs(procs ? *procs : SkSerialProcs())
+            , fExecutor(executor)
             , fOnEndPage(std::move(onEndPage)) {}
 
     ~MultiPictureDocument() override { this->close(); }
@@ -98,15 +119,23 @@ struct MultiPictureDocument final : public SkDocument {
         for (SkSize s : fSizes) {
             wStream->write(&s, sizeof(s));
         }
-        SkSize bigsize = join(fSizes);
-        SkCanvas* c = fPictureRecorder.beginRecording(SkRect::MakeSize(bigsize));
-        for (const sk_sp<SkPicture>& page : fPages) {
-            c->drawPicture(page);
-            // Annotations must include some data.
-            c->drawAnnotation(SkRect::MakeEmpty(), kEndPage, SkData::MakeWithCString("X"));
+
+        // The index goes ahead of the pages, so they're all serialized first.
+        std::vector<sk_sp<SkData>> pageData(fPages.size());
+        for_each_page(fExecutor, fPages.size(), [&](int i) {
+            pageData[i] = fPages[i]->serialize(&fProcs);
+        });
+        uint64_t offset = 0;
+        wStream->write(&offset, sizeof(offset));
+        for (const sk_sp<SkData>& data : pageData) {
+            offset += SkAlign4(data->size());
+            wStream->write(&offset, sizeof(offset));
+        }
+        static constexpr uint8_t kZeros[3] = {0, 0, 0};
+        for (const sk_sp<SkData>& data : pageData) {
+            wStream->write(data->data(), data->size());
+            wStream->write(kZeros, SkAlign4(data->size()) - data->size());
         }
-        sk_sp<SkPicture> p = fPictureRecorder.finishRecordingAsPicture();
-        p->serialize(wStream, &fProcs);
         fPages.clear();
         fSizes.clear();
         return;
@@ -146,16 +175,8 @@ struct PagerCanvas : public SkNWayCanvas {
     }
 };
 
-}  // namespace
-
-namespace SkMultiPictureDocument {
-sk_sp<SkDocument> Make(SkWStream* dst,
-                       const SkSerialProcs* procs,
-                       std::function<void(const SkPicture*)> onEndPage) {
-    return sk_make_sp<MultiPictureDocument>(dst, procs, std::move(onEndPage));
-}
-
-int ReadPageCount(SkStreamSeekable* src) {
+// Reads the header, returning the version, or 0 on error, and leaving the stream just past it.
+static uint32_t read_header(SkStreamSeekable* src, int* pageCount) {
     if (!src) {
         return 0;
     }
@@ -163,48 +184,66 @@ int ReadPageCount(SkStreamSeekable* src) {
     const size_t size = sizeof(kMagic) - 1;
     char buffer[size];
     if (size != src->read(buffer, size) || 0 != memcmp(kMagic, buffer, size)) {
-        src = nullptr;
         return 0;
     }
     uint32_t versionNumber;
-    if (!src->readU32(&versionNumber) || versionNumber != kVersion) {
+    if (!src->readU32(&versionNumber) ||
+        (versionNumber != kVersion && versionNumber != kSingleSkpVersion)) {
         return 0;
     }
-    uint32_t pageCount;
-    if (!src->readU32(&pageCount) || pageCount > INT_MAX) {
+    uint32_t count;
+    if (!src->readU32(&count) || count > INT_MAX) {
         return 0;
     }
-    // leave stream position right here.
-    return SkTo<int>(pageCount);
+    *pageCount = SkTo<int>(count);
+    return versionNumber;
 }
 
-bool ReadPageSizes(SkStreamSeekable* stream,
-                   SkDocumentPage* dstArray,
-                   int dstArrayCount) {
+// Reads the header and page sizes, returning the version, or 0 on error.
+static uint32_t read_page_sizes(SkStreamSeekable* src, SkDocumentPage* dstArray,
+                                int dstArrayCount) {
     if (!dstArray || dstArrayCount < 1) {
-        return false;
+        return 0;
     }
-    int pageCount = ReadPageCount(stream);
-    if (pageCount < 1 || pageCount != dstArrayCount) {
-        return false;
+    int pageCount = 0;
+    const uint32_t version = read_header(src, &pageCount);
+    if (!version || pageCount != dstArrayCount) {
+        return 0;
     }
     for (int i = 0; i < pageCount; ++i) {
         SkSize& s = dstArray[i].fSize;
-        if (sizeof(s) != stream->read(&s, sizeof(s))) {
-            return false;
+        if (sizeof(s) != src->read(&s, sizeof(s))) {
+            return 0;
         }
     }
-    // leave stream position right here.
-    return true;
+    return version;
 }
 
-bool Read(SkStreamSeekable* src,
-          SkDocumentPage* dstArray,
-          int dstArrayCount,
-          const SkDeserialProcs* procs) {
-    if (!ReadPageSizes(src, dstArray, dstArrayCount)) {
-        return false;
+// Reads the page offsets that follow the page sizes.
+static bool read_page_offsets(SkStreamSeekable* src, int pageCount,
+                              std::vector<uint64_t>* offsets) {
+    offsets->resize(pageCount + 1);
+    for (uint64_t& offset : *offsets) {
+        if (sizeof(offset) != src->read(&offset, sizeof(offset))) {
+            return false;
+        }
     }
+    // Each page must have room for at least its header.
+    for (int i = 0; i < pageCount; ++i) {
+        if ((*offsets)[i + 1] <= (*offsets)[i] || !SkIsAlign4((*offsets)[i])) {
+            return false;
+        }
+    }
+    const uint64_t end = offsets->back();
+    return (*offsets)[0] == 0 && SkTFitsIn<size_t>(end) &&
+           (!src->hasLength() || end <= src->getLength() - src->getPosition());
+}
+
+// Reads a version 2 file, whose page sizes have just been read.
+static bool read_single_skp(SkStreamSeekable* src,
+                            SkDocumentPage* dstArray,
+                            int dstArrayCount,
+                            const SkDeserialProcs* procs) {
     SkSize joined = {0.0f, 0.0f};
     for (int i = 0; i < dstArrayCount; ++i) {
         joined = SkSize{std::max(joined.width(), dstArray[i].fSize.width()),
@@ -226,6 +265,93 @@ bool Read(SkStreamSeekable* src,
     }
     return true;
 }
+
+}  // namespace
+
+namespace SkMultiPictureDocument {
+sk_sp<SkDocument> Make(SkWStream* dst,
+                       const SkSerialProcs* procs,
+                       std::function<void(const SkPicture*)> onEndPage,
+                       SkExecutor* executor) {
+    return sk_make_sp<MultiPictureDocument>(dst, procs, std::move(onEndPage), executor);
+}
+
+int ReadPageCount(SkStreamSeekable* src) {
+    int pageCount = 0;
+    // leave stream position right after the header.
+    return read_header(src, &pageCount) ? pageCount : 0;
+}
+
+bool ReadPageSizes(SkStreamSeekable* stream,
+                   SkDocumentPage* dstArray,
+                   int dstArrayCount) {
+    // leave stream position right after the sizes.
+    return read_page_sizes(stream, dstArray, dstArrayCount) != 0;
+}
+
+bool Read(SkStreamSeekable* src,
+          SkDocumentPage* dstArray,
+          int dstArrayCount,
+          const SkDeserialProcs* procs,
+          SkExecutor* executor) {
+    const uint32_t version = read_page_sizes(src, dstArray, dstArrayCount);
+    if (version == kSingleSkpVersion) {
+        return read_single_skp(src, dstArray, dstArrayCount, procs);
+    }
+    std::vector<uint64_t> offsets;
+    if (!version || !read_page_offsets(src, dstArrayCount, &offsets)) {
+        return false;
+    }
+
+    // Read all the pages in one go, then deserialize each in place.
+    sk_sp<SkData> data = SkData::MakeFromStream(src, SkToSizeT(offsets.back()));
+    if (!data) {
+        return false;
+    }
+    for_each_page(executor, dstArrayCount, [&](int i) {
+        dstArray[i].fPicture = SkPicture::MakeFromSharedData(
+                SkData::MakeSubset(data.get(), offsets[i], offsets[i + 1] - offsets[i]), procs);
+    });
+    for (int i = 0; i < dstArrayCount; ++i) {
+        if (!dstArray[i].fPicture) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ReadPage(SkStreamSeekable* src,
+              int pageIndex,
+              SkDocumentPage* dst,
+              const SkDeserialProcs* procs) {
+    const int pageCount = ReadPageCount(src);
+    if (!dst || pageIndex < 0 || pageIndex >= pageCount) {
+        return false;
+    }
+    std::vector<SkDocumentPage> pages(pageCount);
+    const uint32_t version = read_page_sizes(src, pages.data(), pageCount);
+    if (version == kSingleSkpVersion) {
+        // There's nothing to seek with, so read everything.
+        if (!read_single_skp(src, pages.data(), pageCount, procs)) {
+            return false;
+        }
+        *dst = std::move(pages[pageIndex]);
+        return dst->fPicture != nullptr;
+    }
+    std::vector<uint64_t> offsets;
+    if (!version || !read_page_offsets(src, pageCount, &offsets) ||
+        !src->seek(src->getPosition() + SkToSizeT(offsets[pageIndex]))) {
+        return false;
+    }
+    sk_sp<SkData> data = SkData::MakeFromStream(
+            src, SkToSizeT(offsets[pageIndex + 1] - offsets[pageIndex]));
+    if (!data) {
+        return false;
+    }
+    dst->fSize = pages[pageIndex].fSize;
+    dst->fPicture = SkPicture::MakeFromSharedData(std::move(data), procs);
+    return dst->fPicture != nullptr;
+}
 }  // namespace SkMultiPictureDocument
 
 sk_sp<SkDocument> SkMakeMultiPictureDocument(SkWStream* wStream, const SkSerialProcs* procs,
@@ -393,6 +393,16 @@ void SkNWayCanvas::onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4],
     }
 }
 
+void SkNWayCanvas::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[], int count,
+                                       const int matrixIndices[], const SkMatrix preViewMatrices[],
+                                       QuadAAFlags aa, SkBlendMode mode) {
+    Iter iter(fList);
+    while (iter.next()) {
+        iter->experimental_DrawEdgeAARectSet(rects, colors, count, matrixIndices, preViewMatrices,
+                                             aa, mode);
+    }
+}
+
 void SkNWayCanvas::onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count,
                                          const SkPoint dstClips[], const SkMatrix preViewMatrices[],
                                          const SkSamplingOptions& sampling, const SkPaint* paint,
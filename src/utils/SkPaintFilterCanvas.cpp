@@ -254,6 +254,14 @@ void SkPaintFilterCanvas::onDrawEdgeAAQuad(const SkRect& rect, const SkPoint cli
     }
 }
 
+void SkPaintFilterCanvas::onDrawEdgeAARectSet(const SkRect rects[], const SkColor4f colors[],
+                                              int count, const int matrixIndices[],
+                                              const SkMatrix preViewMatrices[], QuadAAFlags aa,
+                                              SkBlendMode mode) {
+    // Filters each entry's color.
+    this->drawEdgeAARectSetAsQuads(rects, colors, count, matrixIndices, preViewMatrices, aa, mode);
+}
+
 void SkPaintFilterCanvas::onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count,
                                                 const SkPoint dstClips[],
                                                 const SkMatrix preViewMatrices[],
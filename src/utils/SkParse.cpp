@@ -10,10 +10,12 @@
 #include "include/private/base/SkTo.h"
 #include "include/utils/SkParse.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <limits>
+#include <iterator>
 #include <string>
 
 static inline bool is_between(int c, int min, int max)
@@ -213,10 +215,93 @@ const char* SkParse::FindMSec(const char str[], SkMSec* value)
     return str;
 }
 
+// Parses the plain decimals path data and attributes are made of, [+-]digits[.digits][e[+-]digits],
+// without going through strtod. It only takes those whose digits fit in a double's mantissa and
+// whose power of ten is exact in a double: then a single multiply or divide rounds the value
+// correctly, so it comes out exactly as strtod's would. Returns nullptr for anything else.
+static const char* find_simple_decimal(const char str[], float* value) {
+    static constexpr double kPow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+    };
+    static constexpr int kMaxExp10 = std::size(kPow10) - 1;
+    static constexpr int kMaxDigits = 15;  // 10^15 < 2^53
+
+    bool negative = false;
+    if (*str == '-' || *str == '+') {
+        negative = *str == '-';
+        str += 1;
+    }
+
+    uint64_t mantissa = 0;
+    int digits = 0,
+        exp10 = 0;
+    bool matched = false;
+    for (; is_digit(*str); str += 1) {
+        matched = true;
+        if (mantissa || *str != '0') {
+            if (++digits > kMaxDigits) {
+                return nullptr;
+            }
+            mantissa = 10*mantissa + *str - '0';
+        }
+    }
+    if (*str == '.') {
+        for (str += 1; is_digit(*str); str += 1) {
+            matched = true;
+            exp10 -= 1;
+            if (mantissa || *str != '0') {
+                if (++digits > kMaxDigits) {
+                    return nullptr;
+                }
+                mantissa = 10*mantissa + *str - '0';
+            }
+        }
+    }
+    if (!matched || *str == 'x' || *str == 'X') {
+        // Not a number at all, or a hex one.
+        return nullptr;
+    }
+
+    if (*str == 'e' || *str == 'E') {
+        const char* exp = str + 1;
+        bool negativeExp = false;
+        if (*exp == '-' || *exp == '+') {
+            negativeExp = *exp == '-';
+            exp += 1;
+        }
+        // Like strtod, leave the 'e' alone unless there are digits after it.
+        if (is_digit(*exp)) {
+            int n = 0;
+            for (; is_digit(*exp); exp += 1) {
+                n = std::min(10*n + *exp - '0', 1000);
+            }
+            exp10 += negativeExp ? -n : n;
+            str = exp;
+        }
+    }
+    if (exp10 < -kMaxExp10 || exp10 > kMaxExp10) {
+        return nullptr;
+    }
+
+    double v = static_cast<double>(mantissa);
+    v = exp10 < 0 ? v / kPow10[-exp10] : v * kPow10[exp10];
+    *value = static_cast<float>(negative ? -v : v);
+    return str;
+}
+
 const char* SkParse::FindScalar(const char str[], SkScalar* value) {
     SkASSERT(str);
     str = skip_ws(str);
 
+    float fast;
+    if (const char* stop = find_simple_decimal(str, &fast)) {
+        if (value) {
+            *value = fast;
+        }
+        return stop;
+    }
+
     char* stop;
     float v = (float)strtod(str, &stop);
     if (str == stop) {
@@ -16,6 +16,7 @@
 #include "src/core/SkGeometry.h"
 
 #include <cstdio>
+#include <cstring>
 
 enum class SkPathDirection;
 
@@ -233,32 +234,61 @@ bool SkParsePath::FromSVGString(const char data[], SkPath* result) {
 
 ///////////////////////////////////////////////////////////////////////////////
 
-static void write_scalar(SkWStream* stream, SkScalar value) {
+// Writes value as %g does. When compact, a zero before the decimal point is dropped, and so is the
+// separator before the value, if its sign, or a decimal point after one in the previous value,
+// already ends the previous value.
+static void write_scalar(SkWStream* stream, SkScalar value, bool needSeparator, bool compact,
+                         bool* previousHasPoint) {
     char buffer[64];
     int len = snprintf(buffer, sizeof(buffer), "%g", value);
-    char* stop = buffer + len;
-    stream->write(buffer, stop - buffer);
+    const char* str = buffer;
+    if (compact) {
+        if (str[0] == '0' && str[1] == '.') {
+            str += 1;
+            len -= 1;
+        } else if (str[0] == '-' && str[1] == '0' && str[2] == '.') {
+            buffer[1] = '-';
+            str += 1;
+            len -= 1;
+        }
+        if (str[0] == '-' || (str[0] == '.' && *previousHasPoint)) {
+            needSeparator = false;
+        }
+        // An exponent can't have a decimal point either.
+        *previousHasPoint = strchr(str, '.') || strchr(str, 'e');
+    }
+    if (needSeparator) {
+        stream->write(" ", 1);
+    }
+    stream->write(str, len);
 }
 
-SkString SkParsePath::ToSVGString(const SkPath& path, PathEncoding encoding) {
+static SkString to_svg_string(const SkPath& path, SkParsePath::PathEncoding encoding,
+                              bool compact) {
     SkDynamicMemoryWStream  stream;
 
     SkPoint current_point{0,0};
-    const auto rel_selector = encoding == PathEncoding::Relative;
+    const auto rel_selector = encoding == SkParsePath::PathEncoding::Relative;
+    // The command that a compact encoding can leave implied: the last one, or L after M.
+    char implied_cmd = '\0';
+    bool previous_has_point = false;
 
     const auto append_command = [&](char cmd, const SkPoint pts[], size_t count) {
         // Use lower case cmds for relative encoding.
         cmd += 32 * rel_selector;
-        stream.write(&cmd, 1);
+        bool need_separator = false;
+        if (compact && cmd == implied_cmd) {
+            need_separator = true;
+        } else {
+            stream.write(&cmd, 1);
+        }
+        implied_cmd = (cmd == 'M' || cmd == 'm') ? cmd - 'M' + 'L' : cmd;
 
         for (size_t i = 0; i < count; ++i) {
             const auto pt = pts[i] - current_point;
-            if (i > 0) {
-                stream.write(" ", 1);
-            }
-            write_scalar(&stream, pt.fX);
-            stream.write(" ", 1);
-            write_scalar(&stream, pt.fY);
+            write_scalar(&stream, pt.fX, need_separator, compact, &previous_has_point);
+            write_scalar(&stream, pt.fY, true, compact, &previous_has_point);
+            need_separator = true;
         }
 
         SkASSERT(count > 0);
@@ -293,6 +323,7 @@ SkString SkParsePath::ToSVGString(const SkPath& path, PathEncoding encoding) {
                 break;
             case SkPath::kClose_Verb:
                 stream.write("Z", 1);
+                implied_cmd = '\0';
                 break;
             case SkPath::kDone_Verb: {
                 SkString str;
@@ -303,3 +334,11 @@ SkString SkParsePath::ToSVGString(const SkPath& path, PathEncoding encoding) {
         }
     }
 }
+
+SkString SkParsePath::ToSVGString(const SkPath& path, PathEncoding encoding) {
+    return to_svg_string(path, encoding, /*compact=*/false);
+}
+
+SkString SkParsePath::ToCompactSVGString(const SkPath& path, PathEncoding encoding) {
+    return to_svg_string(path, encoding, /*compact=*/true);
+}
@@ -12,8 +12,10 @@
 #include "include/core/SkColor.h"
 #include "include/core/SkColorType.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkPoint.h"
 #include "include/core/SkRRect.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRegion.h"
@@ -21,13 +23,17 @@
 #include "include/core/SkTypes.h"
 #include "include/private/base/SkMalloc.h"
 #include "include/private/base/SkTemplates.h"
+#include "include/private/base/SkTo.h"
 #include "src/base/SkRandom.h"
 #include "src/core/SkAAClip.h"
+#include "src/core/SkDraw.h"
 #include "src/core/SkMask.h"
 #include "src/core/SkRasterClip.h"
 #include "tests/Test.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <initializer_list>
 #include <string>
@@ -119,7 +125,8 @@ static void copyToMask(const SkRasterClip& rc, SkMaskBuilder* mask) {
 static bool operator==(const SkRasterClip& a, const SkRasterClip& b) {
     if (a.isEmpty() && b.isEmpty()) {
         return true;
-    } else if (a.isEmpty() != b.isEmpty() || a.isBW() != b.isBW() || a.isRect() != b.isRect()) {
+    } else if (a.isEmpty() != b.isEmpty() || a.isBW() != b.isBW() || a.isRect() != b.isRect() ||
+               SkToBool(a.clipShader()) != SkToBool(b.clipShader())) {
         return false;
     }
 
@@ -446,3 +453,74 @@ DEF_TEST(AAClip, reporter) {
     test_crbug_422693(reporter);
     test_huge(reporter);
 }
+
+// Antialiased rect and rrect clips are applied per pixel by a coverage shader rather than by
+// building an SkAAClip. Compare the coverage they give against point sampling each pixel, both
+// as clipped and after translating the clip, as SkBitmapDevice's tiling does.
+DEF_TEST(RasterClip_AnalyticRRect, reporter) {
+    auto check = [reporter](const SkRRect& rr) {
+        SkRasterClip rc(SkIRect::MakeWH(64, 64));
+        rc.op(rr, SkMatrix::I(), SkClipOp::kIntersect, true);
+        REPORTER_ASSERT(reporter, rc.isBW() && rc.clipShader());
+        SkIRect bounds = rr.rect().roundOut();
+        REPORTER_ASSERT(reporter, bounds.intersect(SkIRect::MakeWH(64, 64)) &&
+                                  rc.getBounds() == bounds);
+
+        for (SkIPoint offset : {SkIPoint{0, 0}, SkIPoint{-5, 7}}) {
+            SkRasterClip translated;
+            rc.translate(offset.fX, offset.fY, &translated);
+            translated.op(SkIRect::MakeWH(64, 64), SkClipOp::kIntersect);
+
+            SkBitmap bm;
+            bm.allocPixels(SkImageInfo::MakeA8(64, 64));
+            bm.eraseColor(SK_ColorTRANSPARENT);
+            SkDraw draw;
+            draw.fDst = bm.pixmap();
+            draw.fCTM = &SkMatrix::I();
+            draw.fRC  = &translated;
+            draw.drawPaint(SkPaint());
+
+            constexpr int kSamples = 16;
+            int worst = 0;
+            for (int y = 0; y < bm.height(); ++y) {
+                for (int x = 0; x < bm.width(); ++x) {
+                    int inside = 0;
+                    for (int j = 0; j < kSamples; ++j) {
+                        for (int i = 0; i < kSamples; ++i) {
+                            const SkRect sample = SkRect::MakeXYWH(
+                                    x - offset.fX + (i + 0.5f) / kSamples,
+                                    y - offset.fY + (j + 0.5f) / kSamples, 1e-4f, 1e-4f);
+                            inside += rr.contains(sample);
+                        }
+                    }
+                    const int expected = (inside * 255 + kSamples * kSamples / 2) /
+                                         (kSamples * kSamples);
+                    worst = std::max(worst, std::abs(*bm.getAddr8(x, y) - expected));
+                }
+            }
+            REPORTER_ASSERT(reporter, worst <= 24, "worst coverage error %d", worst);
+        }
+    };
+
+    check(SkRRect::MakeRect(SkRect::MakeLTRB(3.3f, 5.5f, 40.7f, 50.6f)));
+    check(SkRRect::MakeOval(SkRect::MakeLTRB(12.4f, 12.7f, 27.1f, 27.4f)));
+    check(SkRRect::MakeRectXY(SkRect::MakeLTRB(-10.5f, 5.25f, 50.5f, 30.75f), 8, 8));
+
+    SkRRect rr;
+    const SkVector radii[4] = {{30, 30}, {0, 0}, {30, 32}, {2, 2}};
+    rr.setRectRadii(SkRect::MakeLTRB(2.6f, 3.4f, 58.2f, 61.7f), radii);
+    check(rr);
+
+    // A rrect that covers every pixel of the clip needs no coverage at all.
+    SkRasterClip rc(SkIRect::MakeLTRB(10, 10, 20, 20));
+    rc.op(SkRRect::MakeRectXY(SkRect::MakeLTRB(0, 0, 30, 30), 4, 4), SkMatrix::I(),
+          SkClipOp::kIntersect, true);
+    REPORTER_ASSERT(reporter, rc.isRect() && !rc.clipShader());
+
+    // Replacing the clip drops the coverage too.
+    rc.op(SkRRect::MakeOval(SkRect::MakeLTRB(10.5f, 10.5f, 19.5f, 19.5f)), SkMatrix::I(),
+          SkClipOp::kIntersect, true);
+    REPORTER_ASSERT(reporter, rc.clipShader());
+    rc.setRect(SkIRect::MakeWH(30, 30));
+    REPORTER_ASSERT(reporter, !rc.clipShader());
+}
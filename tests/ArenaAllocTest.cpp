@@ -162,6 +162,41 @@ DEF_TEST(ArenaAllocWithMultipleBlocks, r) {
     REPORTER_ASSERT(r, destroyed == 128);
 }
 
+DEF_TEST(ArenaAllocBlockPool, r) {
+    SkArenaAlloc::PurgeThreadBlockPool();
+
+    // Each arena needs one 4K heap block for this, which it returns to the pool when destroyed.
+    auto draw = [] {
+        SkSTArenaAlloc<256> arena;
+        char* bytes = arena.makeArrayDefault<char>(3000);
+        bytes[0] = bytes[2999] = 1;
+    };
+
+    draw();
+    SkArenaAlloc::BlockPoolStats stats = SkArenaAlloc::ThreadBlockPoolStats();
+    REPORTER_ASSERT(r, stats.fHits == 0);
+    REPORTER_ASSERT(r, stats.fMisses == 1);
+    REPORTER_ASSERT(r, stats.fCachedBytes == 4096);
+
+    for (int i = 0; i < 10; i++) {
+        draw();
+    }
+    stats = SkArenaAlloc::ThreadBlockPoolStats();
+    REPORTER_ASSERT(r, stats.fHits == 10);
+    REPORTER_ASSERT(r, stats.fMisses == 1);
+    REPORTER_ASSERT(r, stats.fCachedBytes == 4096);
+
+    // Huge blocks aren't pooled.
+    {
+        SkArenaAlloc arena(0);
+        arena.makeArrayDefault<char>(1 << 20);
+    }
+    REPORTER_ASSERT(r, SkArenaAlloc::ThreadBlockPoolStats().fCachedBytes == 4096);
+
+    SkArenaAlloc::PurgeThreadBlockPool();
+    REPORTER_ASSERT(r, SkArenaAlloc::ThreadBlockPoolStats().fCachedBytes == 0);
+}
+
 DEF_TEST(ArenaAllocDestructionOrder, r) {
     // Make sure that objects and blocks are destroyed in the correct order. If they are not,
     // then there will be a use after free error in asan.
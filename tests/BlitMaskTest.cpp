@@ -0,0 +1,80 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkColor.h"
+#include "include/core/SkColorPriv.h"
+#include "include/private/SkColorData.h"
+#include "src/base/SkRandom.h"
+#include "src/core/SkBlitMask.h"
+#include "tests/Test.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// The per-pixel LCD16 blend, written out plainly.
+static SkPMColor reference_lcd16(SkColor color, SkPMColor dst, uint16_t mask) {
+    if (mask == 0) {
+        return dst;
+    }
+    auto coverage = [&](int bits5) {
+        int c = bits5 + (bits5 >> 4);  // 0..32
+        return SkColorGetA(color) == 0xFF ? c : c * SkAlpha255To256(SkColorGetA(color)) >> 8;
+    };
+    auto blend = [](int src, int dst, int scale) { return dst + ((src - dst) * scale >> 5); };
+
+    const int r = coverage(SkGetPackedR16(mask) >> (SK_R16_BITS - 5)),
+              g = coverage(SkGetPackedG16(mask) >> (SK_G16_BITS - 5)),
+              b = coverage(SkGetPackedB16(mask) >> (SK_B16_BITS - 5));
+    return SkPackARGB32(0xFF,
+                        blend(SkColorGetR(color), SkGetPackedR32(dst), r),
+                        blend(SkColorGetG(color), SkGetPackedG32(dst), g),
+                        blend(SkColorGetB(color), SkGetPackedB32(dst), b));
+}
+
+DEF_TEST(BlitMask_LCD16, reporter) {
+    SkOpts::Init_BlitMask();
+
+    SkRandom rand;
+    constexpr int kH = 3;
+    for (SkColor color : {SK_ColorBLACK, SK_ColorWHITE, SkColorSetARGB(0xFF, 0x20, 0x80, 0xE0),
+                          SkColorSetARGB(0x80, 0xFF, 0x40, 0x00), SkColorSetARGB(0x01, 0, 0, 0)}) {
+        // Widths on either side of the vector sizes, so the leftover loops run too.
+        for (int w = 1; w <= 37; ++w) {
+            std::vector<uint16_t>  mask(w * kH);
+            std::vector<SkPMColor> dst(w * kH);
+            for (int i = 0; i < w * kH; ++i) {
+                // Favor fully covered and fully uncovered pixels, which are special-cased.
+                switch (rand.nextU() % 4) {
+                    case 0:  mask[i] = 0;      break;
+                    case 1:  mask[i] = 0xFFFF; break;
+                    default: mask[i] = (uint16_t)rand.nextU(); break;
+                }
+                dst[i] = rand.nextU() | SkPackARGB32(0xFF, 0, 0, 0);  // LCD needs opaque dsts.
+            }
+            // Cover whole runs of each kind too.
+            if (w >= 16) {
+                std::fill(mask.begin(), mask.begin() + 8, 0);
+                std::fill(mask.begin() + 8, mask.begin() + 16, 0xFFFF);
+            }
+
+            std::vector<SkPMColor> expected(w * kH);
+            for (int i = 0; i < w * kH; ++i) {
+                expected[i] = reference_lcd16(color, dst[i], mask[i]);
+            }
+
+            SkOpts::blit_mask_d32_lcd16(dst.data(), w * sizeof(SkPMColor),
+                                        mask.data(), w * sizeof(uint16_t),
+                                        color, w, kH);
+            for (int i = 0; i < w * kH; ++i) {
+                REPORTER_ASSERT(reporter, dst[i] == expected[i],
+                                "color %08x w %d pixel %d: %08x != %08x",
+                                color, w, i, dst[i], expected[i]);
+            }
+        }
+    }
+}
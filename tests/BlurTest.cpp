@@ -37,6 +37,7 @@
 #include "src/core/SkMask.h"
 #include "src/core/SkMaskFilterBase.h"
 #include "src/effects/SkEmbossMaskFilter.h"
+#include "src/gpu/BlurUtils.h"
 #include "src/gpu/ganesh/GrBlurUtils.h"
 #include "tests/CtsEnforcement.h"
 #include "tests/Test.h"
@@ -586,3 +587,67 @@ DEF_TEST(zero_blur, reporter) {
     SkIPoint offset;
     bitmap.extractAlpha(&alpha, &paint, nullptr, &offset);
 }
+
+DEF_TEST(BlurDualFilterParams, reporter) {
+    skgpu::DualFilterBlurParams params;
+
+    // Small sigmas are left to the Gaussian effects
+    REPORTER_ASSERT(reporter, !skgpu::ComputeDualFilterBlurParams({2.f, 2.f}, &params));
+    REPORTER_ASSERT(reporter, !skgpu::ComputeDualFilterBlurParams({2.f, 64.f}, &params));
+    // As are axes too different to share a pass count
+    REPORTER_ASSERT(reporter, !skgpu::ComputeDualFilterBlurParams({5.f, 300.f}, &params));
+
+    int lastPasses = 0;
+    for (float sigma : {5.f, 10.f, 20.f, 50.f, 100.f, 200.f}) {
+        REPORTER_ASSERT(reporter, skgpu::ComputeDualFilterBlurParams({sigma, sigma}, &params));
+        REPORTER_ASSERT(reporter, params.fPasses >= lastPasses);
+        REPORTER_ASSERT(reporter, params.fPasses <= skgpu::kMaxDualFilterPasses);
+        REPORTER_ASSERT(reporter, params.fOffset.x == params.fOffset.y);
+        REPORTER_ASSERT(reporter, params.fOffset.x > 0.f &&
+                                  params.fOffset.x <= skgpu::kMaxDualFilterOffset);
+        lastPasses = params.fPasses;
+    }
+}
+
+// Raster draws blurred rects straight from their blurred scanlines, without building a mask.
+// That should give exactly the mask SkBlurMask::BlurRect() builds, clipped.
+DEF_TEST(BlurRectMatchesMask, reporter) {
+    const SkRect rects[] = {
+        SkRect::MakeLTRB(20.3f, 30.7f, 180.2f, 140.9f),
+        SkRect::MakeLTRB(50, 50, 52.5f, 150),          // too thin to be opaque anywhere
+        SkRect::MakeLTRB(-40, 10, 300, 190),           // wider than the canvas
+    };
+    const SkIRect clip = SkIRect::MakeLTRB(60, 40, 200, 128);
+
+    for (SkScalar sigma : {0.6f, 2.5f, 10.3f, 30.f}) {
+        for (const SkRect& r : rects) {
+            SkBitmap bm;
+            bm.allocN32Pixels(256, 256);
+            bm.eraseColor(SK_ColorTRANSPARENT);
+            SkCanvas canvas(bm);
+            canvas.clipIRect(clip);
+            SkPaint paint;
+            paint.setMaskFilter(SkMaskFilter::MakeBlur(kNormal_SkBlurStyle, sigma));
+            canvas.drawRect(r, paint);
+
+            SkMaskBuilder mask;
+            REPORTER_ASSERT(reporter, SkBlurMask::BlurRect(
+                    sigma, &mask, r, kNormal_SkBlurStyle, nullptr,
+                    SkMaskBuilder::kComputeBoundsAndRenderImage_CreateMode));
+            SkAutoMaskFreeImage autoMask(mask.image());
+
+            for (int y = 0; y < bm.height(); ++y) {
+                for (int x = 0; x < bm.width(); ++x) {
+                    const U8CPU expected = clip.contains(x, y) && mask.fBounds.contains(x, y)
+                                                   ? *mask.getAddr8(x, y) : 0;
+                    if (SkGetPackedA32(*bm.getAddr32(x, y)) != expected) {
+                        ERRORF(reporter, "sigma %g, rect %g %g %g %g: (%d, %d) is %u, not %u",
+                               sigma, r.fLeft, r.fTop, r.fRight, r.fBottom, x, y,
+                               SkGetPackedA32(*bm.getAddr32(x, y)), expected);
+                        return;
+                    }
+                }
+            }
+        }
+    }
+}
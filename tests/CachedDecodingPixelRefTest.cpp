@@ -10,17 +10,20 @@
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkColorType.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageGenerator.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypes.h"
 #include "include/private/SkColorData.h"
+#include "include/private/base/SkSemaphore.h"
 #include "src/core/SkMemset.h"
 #include "tests/Test.h"
 #include "tools/ToolUtils.h"
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -129,3 +132,75 @@ DEF_TEST(Image_NewFromGenerator, r) {
         }
     }
 }
+
+// Decodes to TestImageGenerator::Color(), but only once it's let go.
+class GatedImageGenerator : public SkImageGenerator {
+public:
+    GatedImageGenerator(SkSemaphore* gate, std::atomic<int>* decodes)
+            : SkImageGenerator(SkImageInfo::MakeN32Premul(TestImageGenerator::Width(),
+                                                          TestImageGenerator::Height()))
+            , fGate(gate)
+            , fDecodes(decodes) {}
+
+protected:
+    bool onGetPixels(const SkImageInfo& info, void* pixels, size_t rowBytes,
+                     const Options&) override {
+        fGate->wait();
+        (*fDecodes)++;
+        for (int y = 0; y < info.height(); ++y) {
+            SkOpts::memset32((uint32_t*)((char*)pixels + y * rowBytes),
+                             TestImageGenerator::PMColor(), info.width());
+        }
+        return true;
+    }
+
+private:
+    SkSemaphore* const fGate;
+    std::atomic<int>* const fDecodes;
+};
+
+DEF_TEST(Image_PredecodeAsync, r) {
+    SkSemaphore gate;
+    std::atomic<int> decodes{0};
+    sk_sp<SkImage> image =
+            SkImages::DeferredFromGenerator(std::make_unique<GatedImageGenerator>(&gate, &decodes));
+    REPORTER_ASSERT(r, image);
+
+    auto executor = SkExecutor::MakeFIFOThreadPool(2);
+    SkSemaphore done;
+    std::atomic<int> succeeded{0};
+    auto onDone = [&](bool success) {
+        succeeded += success;
+        done.signal();
+    };
+    // The second predecode joins the first, rather than decoding again.
+    SkImages::PredecodeAsync(image, executor.get(), SkImages::PredecodeDraws::kSkip, onDone);
+    SkImages::PredecodeAsync(image, executor.get(), SkImages::PredecodeDraws::kSkip, onDone);
+
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(TestImageGenerator::Width(), TestImageGenerator::Height());
+    SkCanvas canvas(bitmap);
+    const SkColor kDefaultColor = 0xffabcdef;
+
+    // Until the decode finishes, draws skip the image rather than waiting for it.
+    canvas.clear(kDefaultColor);
+    canvas.drawImage(image, 0, 0);
+    REPORTER_ASSERT(r, bitmap.getColor(0, 0) == kDefaultColor);
+
+    gate.signal(3);
+    done.wait();
+    done.wait();
+    REPORTER_ASSERT(r, succeeded == 2);
+    REPORTER_ASSERT(r, decodes == 1);
+
+    // Now draws use the cached pixels, without decoding again.
+    canvas.drawImage(image, 0, 0);
+    REPORTER_ASSERT(r, bitmap.getColor(0, 0) == TestImageGenerator::Color());
+    REPORTER_ASSERT(r, decodes == 1);
+
+    // A predecode of an image that is already decoded is done right away.
+    SkImages::PredecodeAsync(image, executor.get(), SkImages::PredecodeDraws::kWait, onDone);
+    REPORTER_ASSERT(r, done.try_wait());
+    REPORTER_ASSERT(r, succeeded == 3);
+    REPORTER_ASSERT(r, decodes == 1);
+}
@@ -41,9 +41,11 @@
 #include "src/core/SkRecords.h"
 #include "src/utils/SkCanvasStack.h"
 #include "tests/Test.h"
+#include "tools/ToolUtils.h"
 
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <utility>
 
@@ -436,6 +438,42 @@ DEF_TEST(Canvas_SaveState, reporter) {
     REPORTER_ASSERT(reporter, 1 == canvas.getSaveCount());
 }
 
+// Nests well past the inline save records, so the stack has to grow (and later reuse its storage)
+// while layers and clips are still live underneath the top record.
+DEF_TEST(Canvas_DeepSaveState, reporter) {
+    SkBitmap bm;
+    bm.allocN32Pixels(10, 10);
+    bm.eraseColor(SK_ColorWHITE);
+    SkCanvas canvas(bm);
+
+    for (int pass = 0; pass < 2; ++pass) {
+        for (int i = 0; i < 100; ++i) {
+            if (i % 10 == 5) {
+                canvas.saveLayer(nullptr, nullptr);
+            } else {
+                canvas.save();
+            }
+            canvas.translate(1, 0);
+            if (i == 50) {
+                canvas.clipRect(SkRect::MakeLTRB(-51, 0, -48, 5));
+            }
+        }
+        REPORTER_ASSERT(reporter, 101 == canvas.getSaveCount());
+        REPORTER_ASSERT(reporter, canvas.getTotalMatrix() == SkMatrix::Translate(100, 0));
+        REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == SkIRect::MakeWH(3, 5));
+        canvas.drawColor(SK_ColorBLACK);
+
+        canvas.restoreToCount(51);
+        REPORTER_ASSERT(reporter, canvas.getTotalMatrix() == SkMatrix::Translate(50, 0));
+        REPORTER_ASSERT(reporter, canvas.getDeviceClipBounds() == SkIRect::MakeWH(10, 10));
+        canvas.restoreToCount(1);
+        REPORTER_ASSERT(reporter, canvas.getTotalMatrix().isIdentity());
+    }
+    REPORTER_ASSERT(reporter, bm.getColor(2, 4) == SK_ColorBLACK);
+    REPORTER_ASSERT(reporter, bm.getColor(3, 4) == SK_ColorWHITE);
+    REPORTER_ASSERT(reporter, bm.getColor(2, 5) == SK_ColorWHITE);
+}
+
 DEF_TEST(Canvas_ClipEmptyPath, reporter) {
     SkCanvas canvas(10, 10);
     canvas.save();
@@ -722,3 +760,59 @@ DEF_TEST(canvas_savelayer_destructor, reporter) {
     do_test(2, 0);
     check_pixels(SK_ColorRED);
 }
+
+DEF_TEST(Canvas_EdgeAARectSet, r) {
+    const SkRect rects[] = {{10, 10, 40, 30}, {35, 5, 20, 50}, {0, 0, 8, 8}, {50, 50, 90, 70},
+                            {-20, -20, -10, -10}};
+    const SkColor4f colors[] = {SkColors::kRed, {0, 1, 0, 0.5f}, SkColors::kBlue,
+                                SkColors::kYellow, SkColors::kCyan};
+    const int matrixIndices[] = {-1, 0, -1, 1, -1};
+    const SkMatrix preViewMatrices[] = {SkMatrix::Translate(10, 20), SkMatrix::RotateDeg(15)};
+    constexpr int kCount = std::size(rects);
+
+    auto draw_batch = [&](SkCanvas* canvas) {
+        canvas->translate(3, 4);
+        canvas->experimental_DrawEdgeAARectSet(rects, colors, kCount, matrixIndices,
+                                               preViewMatrices, SkCanvas::kAll_QuadAAFlags,
+                                               SkBlendMode::kSrcOver);
+    };
+
+    SkBitmap expected;
+    expected.allocN32Pixels(100, 100);
+    expected.eraseColor(SK_ColorWHITE);
+    {
+        SkCanvas canvas(expected);
+        canvas.translate(3, 4);
+        for (int i = 0; i < kCount; ++i) {
+            SkAutoCanvasRestore acr(&canvas, true);
+            if (matrixIndices[i] >= 0) {
+                canvas.concat(preViewMatrices[matrixIndices[i]]);
+            }
+            canvas.experimental_DrawEdgeAAQuad(rects[i], nullptr, SkCanvas::kAll_QuadAAFlags,
+                                               colors[i], SkBlendMode::kSrcOver);
+        }
+    }
+
+    // Drawn directly, the set matches a draw per entry.
+    SkBitmap batched;
+    batched.allocN32Pixels(100, 100);
+    batched.eraseColor(SK_ColorWHITE);
+    {
+        SkCanvas canvas(batched);
+        draw_batch(&canvas);
+    }
+    REPORTER_ASSERT(r, ToolUtils::equal_pixels(expected, batched));
+
+    // Recorded, it plays back the same way.
+    SkPictureRecorder recorder;
+    draw_batch(recorder.beginRecording(SkRect::MakeWH(100, 100)));
+    sk_sp<SkPicture> picture = recorder.finishRecordingAsPicture();
+    SkBitmap played;
+    played.allocN32Pixels(100, 100);
+    played.eraseColor(SK_ColorWHITE);
+    {
+        SkCanvas canvas(played);
+        canvas.drawPicture(picture);
+    }
+    REPORTER_ASSERT(r, ToolUtils::equal_pixels(expected, played));
+}
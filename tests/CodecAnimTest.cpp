@@ -13,6 +13,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkMatrix.h"
@@ -21,7 +22,9 @@
 #include "include/core/SkSize.h"
 #include "include/core/SkString.h"
 #include "include/core/SkTypes.h"
+#include "include/private/base/SkTo.h"
 #include "include/utils/SkAnimCodecPlayer.h"
+#include "src/core/SkResourceCache.h"
 #include "tests/CodecPriv.h"
 #include "tests/Test.h"
 #include "tools/Resources.h"
@@ -626,3 +629,53 @@ DEF_TEST(AnimCodecPlayer, r) {
                         "Mismatched size for frame at 500 ms of %s", test.fFile);
     }
 }
+
+// Frames purged from the SkResourceCache, including the ones later frames depend on, are decoded
+// again, and prefetching on an executor doesn't change what gets decoded.
+DEF_TEST(AnimCodecPlayer_PurgedFrames, r) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(1);
+    for (const char* file : {"images/required.gif", "images/alphabetAnim.gif",
+                             "images/stoplight.webp"}) {
+        sk_sp<SkData> data = GetResourceAsData(file);
+        if (!data) {
+            ERRORF(r, "Missing resource '%s'", file);
+            continue;
+        }
+
+        std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+        REPORTER_ASSERT(r, codec);
+        std::vector<SkCodec::FrameInfo> frameInfos = codec->getFrameInfo();
+        std::vector<SkBitmap> expected(frameInfos.size());
+        for (size_t i = 0; i < frameInfos.size(); ++i) {
+            expected[i].allocPixels(codec->getInfo().makeAlphaType(kPremul_SkAlphaType));
+            SkCodec::Options opts;
+            opts.fFrameIndex = SkToInt(i);
+            REPORTER_ASSERT(r, SkCodec::kSuccess == codec->getPixels(expected[i].pixmap(), &opts));
+        }
+
+        for (SkExecutor* prefetchExecutor : {(SkExecutor*)nullptr, executor.get()}) {
+            SkAnimCodecPlayer player(SkCodec::MakeFromData(data), prefetchExecutor);
+            uint32_t time = 0;
+            for (size_t i = 0; i < frameInfos.size(); ++i) {
+                player.seek(time);
+                time += frameInfos[i].fDuration;
+                if (!frameInfos[i].fDuration) {
+                    // seek() can't land on this frame.
+                    continue;
+                }
+
+                // Purging every other frame makes the player go back along the dependencies.
+                if (i % 2) {
+                    SkResourceCache::PurgeAll();
+                }
+                sk_sp<SkImage> frame = player.getFrame();
+                REPORTER_ASSERT(r, frame);
+                SkBitmap actual;
+                actual.allocPixels(expected[i].info());
+                REPORTER_ASSERT(r, frame && frame->readPixels(nullptr, actual.pixmap(), 0, 0));
+                REPORTER_ASSERT(r, ToolUtils::equal_pixels(expected[i], actual),
+                                "%s frame %zu", file, i);
+            }
+        }
+    }
+}
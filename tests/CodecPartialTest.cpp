@@ -8,14 +8,21 @@
 #include "include/codec/SkCodec.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkData.h"
+#include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
+#include "include/core/SkSurface.h"
 #include "include/core/SkTypes.h"
+#include "include/gpu/GpuTypes.h"
+#include "include/gpu/GrDirectContext.h"
+#include "include/gpu/ganesh/SkSurfaceGanesh.h"
 #include "include/private/base/SkDebug.h"
+#include "include/utils/SkIncrementalImageUploader.h"
 #include "tests/CodecPriv.h"
 #include "tests/FakeStreams.h"
+#include "tests/CtsEnforcement.h"
 #include "tests/Test.h"
 #include "tools/Resources.h"
 
@@ -156,6 +163,73 @@ DEF_TEST(Codec_partial, r) {
     test_partial(r, "images/color_wheel.gif");
 }
 
+static void test_partial_upload(skiatest::Reporter* r, GrDirectContext* dContext,
+                                const char* name) {
+    sk_sp<SkData> file = GetResourceAsData(name);
+    if (!file) {
+        SkDebugf("missing resource %s\n", name);
+        return;
+    }
+    SkBitmap truth;
+    if (!create_truth(file, &truth)) {
+        ERRORF(r, "Failed to decode %s\n", name);
+        return;
+    }
+
+    const size_t increment = file->size() / 8 + 1;
+    HaltingStream* stream = new HaltingStream(file, increment);
+    auto codec = SkCodec::MakeFromStream(std::unique_ptr<SkStream>(stream));
+    if (!codec) {
+        ERRORF(r, "Failed to create codec for %s", name);
+        return;
+    }
+    auto uploader = SkIncrementalImageUploader::Make(
+            std::move(codec),
+            SkSurfaces::RenderTarget(dContext, skgpu::Budgeted::kNo, truth.info()));
+    if (!uploader) {
+        ERRORF(r, "Failed to create uploader for %s", name);
+        return;
+    }
+
+    while (true) {
+        const SkCodec::Result result = uploader->decode();
+        if (result == SkCodec::kSuccess) {
+            break;
+        }
+        REPORTER_ASSERT(r, result == SkCodec::kIncompleteInput);
+        if (stream->isAllDataReceived()) {
+            ERRORF(r, "Failed to completely decode %s", name);
+            return;
+        }
+        stream->addNewData(increment);
+
+        // What has been uploaded so far can be drawn.
+        REPORTER_ASSERT(r, uploader->image());
+    }
+
+    // Decoding a finished image doesn't upload anything.
+    const int uploads = uploader->uploadedBandCount();
+    REPORTER_ASSERT(r, uploader->decode() == SkCodec::kSuccess);
+    REPORTER_ASSERT(r, uploader->uploadedBandCount() == uploads);
+
+    SkBitmap uploaded;
+    uploaded.allocPixels(truth.info());
+    REPORTER_ASSERT(r, uploader->image()->readPixels(dContext, uploaded.pixmap(), 0, 0));
+    compare_bitmaps(r, truth, uploaded);
+}
+
+DEF_GANESH_TEST_FOR_RENDERING_CONTEXTS(Codec_partialUpload,
+                                       r,
+                                       ctxInfo,
+                                       CtsEnforcement::kNever) {
+    GrDirectContext* dContext = ctxInfo.directContext();
+    test_partial_upload(r, dContext, "images/box.gif");
+    test_partial_upload(r, dContext, "images/color_wheel.gif");
+    test_partial_upload(r, dContext, "images/randPixels.gif");
+    // Interlaced, so the earlier rows are rewritten by each pass.
+    test_partial_upload(r, dContext, "images/test640x479.gif");
+}
+
 DEF_TEST(Codec_partialWuffs, r) {
     const char* path = "images/alphabetAnim.gif";
     auto file = GetResourceAsData(path);
@@ -8,6 +8,7 @@
 #include "include/codec/SkAndroidCodec.h"
 #include "include/codec/SkCodec.h"
 #include "include/codec/SkEncodedImageFormat.h"
+#include "include/codec/SkJpegDecoder.h"
 #include "include/codec/SkPngChunkReader.h"
 #include "include/core/SkAlphaType.h"
 #include "include/core/SkBitmap.h"
@@ -17,12 +18,14 @@
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
 #include "include/core/SkDataTable.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageGenerator.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSamplingOptions.h"
 #include "include/core/SkSize.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkString.h"
@@ -1099,6 +1102,167 @@ DEF_TEST(Codec_ColorXform, r) {
     check_color_xform(r, "images/mandrill_512.png");
 }
 
+// JPEG sample sizes that libjpeg-turbo can't scale by exactly are decoded at a scale of n/8 and
+// resized. Check that the result lines up with a full resolution decode of the same subset.
+DEF_TEST(Codec_JpegResampledSubset, r) {
+    const char* path = "images/mandrill_512_q075.jpg";
+    std::unique_ptr<SkAndroidCodec> codec =
+            SkAndroidCodec::MakeFromStream(GetResourceAsStream(path));
+    if (!codec) {
+        ERRORF(r, "Unable to create codec '%s'", path);
+        return;
+    }
+
+    const SkIRect subset = SkIRect::MakeXYWH(64, 96, 300, 240);
+    SkBitmap full;
+    full.allocPixels(
+            codec->getInfo().makeDimensions(subset.size()).makeColorType(kN32_SkColorType));
+    SkAndroidCodec::AndroidOptions opts;
+    opts.fSubset = &subset;
+    REPORTER_ASSERT(r, SkCodec::kSuccess ==
+                       codec->getAndroidPixels(full.info(), full.getPixels(), full.rowBytes(),
+                                               &opts));
+
+    for (int sampleSize : {3, 5, 6, 7, 12}) {
+        opts.fSampleSize = sampleSize;
+        SkBitmap sampled;
+        sampled.allocPixels(full.info().makeWH(subset.width() / sampleSize,
+                                               subset.height() / sampleSize));
+        SkCodec::Result result = codec->getAndroidPixels(sampled.info(), sampled.getPixels(),
+                                                         sampled.rowBytes(), &opts);
+        REPORTER_ASSERT(r, SkCodec::kSuccess == result, "sampleSize %d: %s", sampleSize,
+                        SkCodec::ResultToString(result));
+
+        SkBitmap expected;
+        expected.allocPixels(sampled.info());
+        full.pixmap().scalePixels(expected.pixmap(), SkSamplingOptions(SkFilterMode::kLinear));
+
+        // Different filters give different pixels, but a misplaced subset or scale would make the
+        // average difference much bigger than this on the mandrill.
+        int64_t totalDiff = 0;
+        for (int y = 0; y < sampled.height(); ++y) {
+            for (int x = 0; x < sampled.width(); ++x) {
+                SkColor a = sampled.getColor(x, y), b = expected.getColor(x, y);
+                totalDiff += std::abs((int)SkColorGetR(a) - (int)SkColorGetR(b)) +
+                             std::abs((int)SkColorGetG(a) - (int)SkColorGetG(b)) +
+                             std::abs((int)SkColorGetB(a) - (int)SkColorGetB(b));
+            }
+        }
+        int64_t meanDiff = totalDiff / (3 * sampled.width() * sampled.height());
+        REPORTER_ASSERT(r, meanDiff < 16, "sampleSize %d: mean difference %d", sampleSize,
+                        (int)meanDiff);
+    }
+}
+
+// Decoding the restart intervals of a JPEG in parallel must give exactly the pixels of a serial
+// decode, including around the band edges where chroma is upsampled.
+DEF_TEST(Codec_JpegDecodeInParallel, r) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    for (const char* path : {"images/icc-v2-gbr.jpg",         // 4:2:0, a restart per MCU row
+                             "images/mandrill_cmyk.jpg",      // CMYK, a restart per MCU row
+                             "images/mandrill_512_q075.jpg"}) {  // no restarts
+        sk_sp<SkData> data = GetResourceAsData(path);
+        if (!data) {
+            ERRORF(r, "Missing resource '%s'", path);
+            continue;
+        }
+        std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+        REPORTER_ASSERT(r, codec);
+        SkImageInfo info = codec->getInfo().makeColorType(kN32_SkColorType);
+
+        SkBitmap expected;
+        expected.allocPixels(info);
+        REPORTER_ASSERT(r, SkCodec::kSuccess == codec->getPixels(expected.pixmap()));
+
+        SkBitmap actual;
+        actual.allocPixels(info);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+        SkCodec::Result result =
+                SkJpegDecoder::DecodeInParallel(data, actual.pixmap(), executor.get());
+        REPORTER_ASSERT(r, SkCodec::kSuccess == result, "%s: %s", path,
+                        SkCodec::ResultToString(result));
+        REPORTER_ASSERT(r, ToolUtils::equal_pixels(expected, actual), "%s", path);
+    }
+}
+
+// A decoder that claims the same data as a later one falls back to it when it can't make a codec,
+// as long as the stream can be duplicated.
+DEF_TEST(Codec_PreferredDecoderFallback, r) {
+    sk_sp<SkData> data = GetResourceAsData("images/color_wheel.jpg");
+    if (!data) {
+        ERRORF(r, "Missing resource");
+        return;
+    }
+
+    static int gAttempts;
+    static constexpr SkCodecs::Decoder kDecoders[] = {
+        {"jpeg-hw", SkJpegDecoder::IsJpeg,
+         [](std::unique_ptr<SkStream>, SkCodec::Result* result, SkCodecs::DecodeContext) {
+             gAttempts++;
+             *result = SkCodec::kUnimplemented;
+             return std::unique_ptr<SkCodec>();
+         }},
+        SkJpegDecoder::Decoder(),
+    };
+
+    gAttempts = 0;
+    std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data, kDecoders);
+    REPORTER_ASSERT(r, gAttempts == 1);
+    REPORTER_ASSERT(r, codec && codec->getEncodedFormat() == SkEncodedImageFormat::kJPEG);
+
+    // Without a duplicate of the stream, the first decoder that claims the data gets the only one.
+    gAttempts = 0;
+    codec = SkCodec::MakeFromStream(std::make_unique<NotAssetMemStream>(data), kDecoders);
+    REPORTER_ASSERT(r, gAttempts == 1);
+    REPORTER_ASSERT(r, !codec);
+}
+
+// A batch decode gives each image as getImage() would, at the requested size, with nullptr for
+// data that isn't an image, even when the memory budget only allows one decode at a time.
+DEF_TEST(Codec_DecodeBatch, r) {
+    std::vector<SkCodecs::BatchDecodeRequest> requests;
+    for (const char* path : {"images/mandrill_512_q075.jpg",
+                             "images/color_wheel.png",
+                             "images/randPixels.bmp"}) {
+        sk_sp<SkData> data = GetResourceAsData(path);
+        if (!data) {
+            ERRORF(r, "Missing resource '%s'", path);
+            return;
+        }
+        requests.push_back({data, {0, 0}, kN32_SkColorType});
+        requests.push_back({data, {50, 40}, kN32_SkColorType});
+    }
+    requests.push_back({SkData::MakeWithCString("not an image"), {0, 0}, kN32_SkColorType});
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    for (size_t budget : {size_t(1), size_t(64 << 20)}) {
+        std::vector<sk_sp<SkImage>> images =
+                SkCodecs::DecodeBatch(requests, *executor, budget);
+        REPORTER_ASSERT(r, images.size() == requests.size());
+        REPORTER_ASSERT(r, !images.back());
+
+        for (size_t i = 0; i + 1 < requests.size(); i += 2) {
+            std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(requests[i].data);
+            SkImageInfo info = codec->getInfo().makeColorType(kN32_SkColorType);
+            if (info.alphaType() == kUnpremul_SkAlphaType) {
+                info = info.makeAlphaType(kPremul_SkAlphaType);
+            }
+            auto [expected, result] = codec->getImage(info);
+            REPORTER_ASSERT(r, expected && images[i]);
+            if (!expected || !images[i]) {
+                continue;
+            }
+            SkBitmap expectedBM, actualBM;
+            REPORTER_ASSERT(r, expected->asLegacyBitmap(&expectedBM));
+            REPORTER_ASSERT(r, images[i]->asLegacyBitmap(&actualBM));
+            REPORTER_ASSERT(r, ToolUtils::equal_pixels(expectedBM, actualBM));
+
+            REPORTER_ASSERT(r, images[i + 1] &&
+                               images[i + 1]->dimensions() == SkISize::Make(50, 40));
+        }
+    }
+}
+
 static bool color_type_match(SkColorType origColorType, SkColorType codecColorType) {
     switch (origColorType) {
         case kRGBA_8888_SkColorType:
@@ -12,6 +12,7 @@
 #include "include/core/SkColor.h"
 #include "include/core/SkColorFilter.h"
 #include "include/core/SkColorSpace.h"
+#include "include/core/SkColorTable.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPoint.h"
@@ -31,10 +32,17 @@
 #include "src/core/SkReadBuffer.h"
 #include "src/core/SkWriteBuffer.h"
 #include "src/effects/colorfilters/SkColorFilterBase.h"
+#include "src/effects/colorfilters/SkComposeColorFilter.h"
 #include "tests/CtsEnforcement.h"
 #include "tests/Test.h"
 
+#include <array>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
 #include <utility>
 
 class SkFlattenable;
@@ -200,3 +208,87 @@ DEF_TEST(ColorFilter_OpaqueShaderPaintAlpha, r) {
     canvas.drawPaint(paint);
     REPORTER_ASSERT(r, bmp.getColor(0, 0) == SK_ColorWHITE);
 }
+
+// Chains of matrix filters and of table filters fold into one filter as they're composed, and
+// still filter colors as the chain would.
+DEF_TEST(ColorFilter_FoldComposition, r) {
+    auto type = [](const sk_sp<SkColorFilter>& cf) { return as_CFB(cf)->type(); };
+
+    // Filters colors with each of filters in turn, last to first.
+    auto filter_in_turn = [](std::initializer_list<sk_sp<SkColorFilter>> filters, SkColor4f c) {
+        for (auto it = std::rbegin(filters); it != std::rend(filters); ++it) {
+            c = (*it)->filterColor4f(c, nullptr, nullptr);
+        }
+        return c;
+    };
+    auto check = [&](const sk_sp<SkColorFilter>& folded,
+                     std::initializer_list<sk_sp<SkColorFilter>> filters,
+                     float tolerance) {
+        SkRandom rand;
+        for (int i = 0; i < 100; ++i) {
+            const SkColor4f c = {rand.nextF(), rand.nextF(), rand.nextF(),
+                                 rand.nextRangeF(0.1f, 1.f)};
+            const SkColor4f want = filter_in_turn(filters, c),
+                            got  = folded->filterColor4f(c, nullptr, nullptr);
+            for (int j = 0; j < 4; ++j) {
+                REPORTER_ASSERT(r, std::abs(want[j] - got[j]) <= tolerance,
+                                "channel %d: %g vs %g", j, got[j], want[j]);
+            }
+        }
+    };
+
+    SkColorMatrix saturate, scale, rotate;
+    saturate.setSaturation(0.3f);
+    scale.setScale(0.9f, 0.8f, 0.7f, 1.f);
+    rotate.setRowMajor(std::array<float, 20>{0.2f, 0.5f, 0.3f, 0, 0,
+                                             0.1f, 0.1f, 0.8f, 0, 0,
+                                             0.6f, 0.3f, 0.1f, 0, 0,
+                                             0,    0,    0,    1, 0}.data());
+    auto m0 = SkColorFilters::Matrix(saturate),
+         m1 = SkColorFilters::Matrix(scale),
+         m2 = SkColorFilters::Matrix(rotate);
+
+    // Composed one at a time, in either grouping, three matrices fold into one.
+    auto chain = m0->makeComposed(m1)->makeComposed(m2);
+    REPORTER_ASSERT(r, type(chain) == SkColorFilterBase::Type::kMatrix);
+    check(chain, {m0, m1, m2}, 1e-5f);
+    chain = m0->makeComposed(m1->makeComposed(m2));
+    REPORTER_ASSERT(r, type(chain) == SkColorFilterBase::Type::kMatrix);
+    check(chain, {m0, m1, m2}, 1e-5f);
+
+    // An inner matrix that can leave [0,1] has its output clamped, so it doesn't fold.
+    SkColorMatrix brighten;
+    brighten.setScale(2.f, 2.f, 2.f, 1.f);
+    auto m3 = SkColorFilters::Matrix(brighten);
+    REPORTER_ASSERT(r, type(m0->makeComposed(m3)) == SkColorFilterBase::Type::kCompose);
+    check(m0->makeComposed(m3), {m0, m3}, 1e-5f);
+
+    // Neighbors still fold across filters that don't.
+    auto blend = SkColorFilters::Blend(SK_ColorRED, SkBlendMode::kModulate);
+    chain = m0->makeComposed(m1)->makeComposed(blend)->makeComposed(m2)->makeComposed(m1);
+    std::function<int(const SkColorFilterBase*)> count_filters = [&](const SkColorFilterBase* cf) {
+        if (cf->type() != SkColorFilterBase::Type::kCompose) {
+            return 1;
+        }
+        auto compose = static_cast<const SkComposeColorFilter*>(cf);
+        return count_filters(compose->outer().get()) + count_filters(compose->inner().get());
+    };
+    REPORTER_ASSERT(r, count_filters(as_CFB(chain)) == 3);
+    check(chain, {m0, m1, blend, m2, m1}, 1e-5f);
+
+    // Tables fold by looking up one table with the other.
+    uint8_t invert[256], gamma[256];
+    for (int i = 0; i < 256; ++i) {
+        invert[i] = 255 - i;
+        gamma[i] = (uint8_t)std::lround(255 * std::pow(i / 255.f, 2.2f));
+    }
+    auto t0 = SkColorFilters::TableARGB(nullptr, invert, gamma, invert),
+         t1 = SkColorFilters::TableARGB(nullptr, gamma, gamma, nullptr);
+    chain = t0->makeComposed(t1)->makeComposed(t0);
+    REPORTER_ASSERT(r, type(chain) == SkColorFilterBase::Type::kTable);
+    check(chain, {t0, t1, t0}, 1e-5f);
+
+    // Unless the outer table's alpha can come out of 0.
+    auto t2 = SkColorFilters::TableARGB(invert, nullptr, nullptr, nullptr);
+    REPORTER_ASSERT(r, type(t2->makeComposed(t0)) == SkColorFilterBase::Type::kCompose);
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2023 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkAlphaType.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkColorType.h"
+#include "include/core/SkImageInfo.h"
+#include "src/base/SkRandom.h"
+#include "src/core/SkConvertPixels.h"
+#include "tests/Test.h"
+
+#include <cstdint>
+#include <cstring>
+
+static SkBitmap random_bitmap(const SkImageInfo& info, SkRandom* rand) {
+    SkBitmap bm;
+    bm.allocPixels(info);
+    for (int y = 0; y < bm.height(); ++y) {
+        auto row = static_cast<uint32_t*>(bm.getAddr(0, y));
+        for (size_t i = 0; i < bm.rowBytes() / 4; ++i) {
+            row[i] = rand->nextU();
+        }
+    }
+    return bm;
+}
+
+// Converting between RGB_888x and 8888 only reorders bytes and sets alpha.
+DEF_TEST(ConvertPixels_888x, reporter) {
+    SkRandom rand;
+    const SkColorType kTypes[] = {kRGBA_8888_SkColorType,
+                                  kBGRA_8888_SkColorType,
+                                  kRGB_888x_SkColorType};
+    for (SkColorType srcCT : kTypes)
+    for (SkColorType dstCT : kTypes) {
+        // Same-type copies leave the unused byte of RGB_888x alone.
+        if (srcCT == dstCT ||
+            (srcCT != kRGB_888x_SkColorType && dstCT != kRGB_888x_SkColorType)) {
+            continue;
+        }
+        // Wide enough for the vector loop and its tail.
+        const SkImageInfo srcInfo = SkImageInfo::Make(19, 3, srcCT, kPremul_SkAlphaType),
+                          dstInfo = srcInfo.makeColorType(dstCT);
+        const SkBitmap src = random_bitmap(srcInfo, &rand);
+        SkBitmap dst;
+        dst.allocPixels(dstInfo);
+        REPORTER_ASSERT(reporter, SkConvertPixels(dstInfo, dst.getPixels(), dst.rowBytes(),
+                                                  srcInfo, src.getPixels(), src.rowBytes()));
+
+        const bool swapRB = srcCT == kBGRA_8888_SkColorType || dstCT == kBGRA_8888_SkColorType;
+        for (int y = 0; y < src.height(); ++y)
+        for (int x = 0; x < src.width(); ++x) {
+            const uint8_t* s = static_cast<const uint8_t*>(src.getAddr(x, y));
+            const uint8_t* d = static_cast<const uint8_t*>(dst.getAddr(x, y));
+            const uint8_t want[4] = {s[swapRB ? 2 : 0], s[1], s[swapRB ? 0 : 2], 0xFF};
+            REPORTER_ASSERT(reporter, !memcmp(d, want, 4),
+                            "%d -> %d at (%d, %d)", srcCT, dstCT, x, y);
+        }
+    }
+}
+
+// Converting a big image in bands should match converting it all at once.
+DEF_TEST(ConvertPixels_Parallel, reporter) {
+    SkRandom rand;
+    // Tall enough to split, with a last band shorter than the rest.
+    const SkImageInfo srcInfo = SkImageInfo::Make(1031, 1037, kRGBA_8888_SkColorType,
+                                                  kUnpremul_SkAlphaType);
+    const SkBitmap src = random_bitmap(srcInfo, &rand);
+    for (SkColorType dstCT : {kBGRA_8888_SkColorType, kRGB_888x_SkColorType,
+                              kRGBA_F16_SkColorType, kRGBA_1010102_SkColorType}) {
+        const SkImageInfo dstInfo = srcInfo.makeColorType(dstCT).makeAlphaType(kPremul_SkAlphaType);
+        SkBitmap expected, actual;
+        expected.allocPixels(dstInfo);
+        actual.allocPixels(dstInfo);
+        REPORTER_ASSERT(reporter, SkConvertPixels(dstInfo, expected.getPixels(),
+                                                  expected.rowBytes(), srcInfo, src.getPixels(),
+                                                  src.rowBytes()));
+        gSkParallelConvertPixels = true;
+        REPORTER_ASSERT(reporter, SkConvertPixels(dstInfo, actual.getPixels(), actual.rowBytes(),
+                                                  srcInfo, src.getPixels(), src.rowBytes()));
+        gSkParallelConvertPixels = false;
+        REPORTER_ASSERT(reporter, !memcmp(expected.getPixels(), actual.getPixels(),
+                                          expected.computeByteSize()), "dst %d", dstCT);
+    }
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkCounters.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkRect.h"
+#include "src/core/SkCountersPriv.h"
+#include "tests/Test.h"
+
+#include <thread>
+
+using SkCounters::Counter;
+
+// Other tests may be counting on other threads, so these only check lower bounds.
+
+DEF_TEST(Counters_Draws, r) {
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(16, 16);
+    SkCanvas canvas(bitmap);
+
+    const SkCounters::Snapshot before = SkCounters::Read();
+    for (int i = 0; i < 3; ++i) {
+        canvas.drawRect(SkRect::MakeWH(8, 8), SkPaint());
+    }
+    const SkCounters::Snapshot delta = SkCounters::Read() - before;
+    REPORTER_ASSERT(r, delta[Counter::kDraws] >= 3);
+}
+
+DEF_TEST(Counters_ThreadsThatExit, r) {
+    const SkCounters::Snapshot before = SkCounters::Read();
+    for (int i = 0; i < 4; ++i) {
+        std::thread([] { SkCounters::Add(Counter::kBytesUploaded, 1000); }).join();
+    }
+    SkCounters::Add(Counter::kBytesUploaded, 1000);
+    const SkCounters::Snapshot delta = SkCounters::Read() - before;
+    REPORTER_ASSERT(r, delta[Counter::kBytesUploaded] >= 5000);
+}
+
+DEF_TEST(Counters_Flush, r) {
+    const SkCounters::Snapshot before = SkCounters::Read();
+    {
+        SkCounters::AutoCountFlush countFlush;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    const SkCounters::Snapshot delta = SkCounters::Read() - before;
+    REPORTER_ASSERT(r, delta[Counter::kFlushes] >= 1);
+    REPORTER_ASSERT(r, delta[Counter::kFlushNanoseconds] >= 2'000'000);
+}
@@ -145,3 +145,32 @@ DEF_TEST(DashCrazy_crbug_875494, r) {
     skpathutils::FillPathWithPaint(path, paint, &path2, &cull);
 }
 
+
+// Contours entirely outside the cull rect are dropped before dashing, without changing how the
+// visible contours are dashed.
+DEF_TEST(DashPathEffectTest_cullContours, r) {
+    SkPath path;
+    for (int i = 0; i < 4; ++i) {
+        path.moveTo(0, 20 + 100 * i);
+        path.cubicTo(30, 0 + 100 * i, 60, 40 + 100 * i, 90, 20 + 100 * i);
+    }
+    SkPath visible;
+    visible.moveTo(0, 20);
+    visible.cubicTo(30, 0, 60, 40, 90, 20);
+
+    const SkScalar intervals[] = { 5, 3 };
+    sk_sp<SkPathEffect> dash = SkDashPathEffect::Make(intervals, std::size(intervals), 2);
+    const SkRect cull = SkRect::MakeWH(100, 50);
+    SkStrokeRec rec(SkStrokeRec::kHairline_InitStyle);
+
+    SkPath culled, expected;
+    REPORTER_ASSERT(r, dash->filterPath(&culled, path, &rec, &cull));
+    REPORTER_ASSERT(r, dash->filterPath(&expected, visible, &rec, nullptr));
+    REPORTER_ASSERT(r, culled == expected);
+
+    // With every contour culled, there's nothing to draw.
+    const SkRect offscreen = SkRect::MakeXYWH(500, 500, 10, 10);
+    SkPath none;
+    REPORTER_ASSERT(r, dash->filterPath(&none, path, &rec, &offscreen));
+    REPORTER_ASSERT(r, none.isEmpty());
+}
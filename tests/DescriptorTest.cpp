@@ -196,3 +196,64 @@ DEF_TEST(Descriptor_flatten_unflatten, r) {
         REPORTER_ASSERT(r, !ad.has_value());
     }
 }
+
+DEF_TEST(Descriptor_write_read_shared, r) {
+    const size_t size =
+            sizeof(SkDescriptor) + sizeof(SkDescriptor::Entry) + sizeof(SkScalerContextRec);
+    auto makeDesc = [&](float textSize) {
+        auto desc = SkDescriptor::Alloc(size);
+        SkScalerContextRec rec;
+        rec.fTextSize = textSize;
+        desc->addEntry(kRec_SkDescriptorTag, sizeof(rec), &rec);
+        desc->computeChecksum();
+        return desc;
+    };
+    auto a = makeDesc(12), b = makeDesc(24);
+
+    {
+        SkBinaryWriteBuffer writer({});
+        writer.writeDescriptor(*a);
+        const size_t first = writer.bytesWritten();
+        writer.writeDescriptor(*b);
+        writer.writeDescriptor(*a);
+        writer.writeDescriptor(*b);
+        // Repeats are written as a single index.
+        REPORTER_ASSERT(r, writer.bytesWritten() == 2 * first + 2 * sizeof(uint32_t));
+
+        auto data = writer.snapshotAsData();
+        SkReadBuffer reader{data->data(), data->size()};
+        const SkDescriptor* a0 = reader.readDescriptor();
+        const SkDescriptor* b0 = reader.readDescriptor();
+        const SkDescriptor* a1 = reader.readDescriptor();
+        const SkDescriptor* b1 = reader.readDescriptor();
+        REPORTER_ASSERT(r, reader.isValid());
+        REPORTER_ASSERT(r, a0 && *a0 == *a && b0 && *b0 == *b);
+        // Repeats come back as the first copy, read in place.
+        REPORTER_ASSERT(r, a1 == a0 && b1 == b0);
+        REPORTER_ASSERT(r, (const char*)a0 >= (const char*)data->data() &&
+                           (const char*)a0 < (const char*)data->data() + data->size());
+    }
+
+    {  // index to a descriptor that was never written
+        SkBinaryWriteBuffer writer({});
+        writer.writeDescriptor(*a);
+        writer.writeUInt(2);
+        auto data = writer.snapshotAsData();
+        SkReadBuffer reader{data->data(), data->size()};
+        REPORTER_ASSERT(r, reader.readDescriptor() != nullptr);
+        REPORTER_ASSERT(r, reader.readDescriptor() == nullptr);
+        REPORTER_ASSERT(r, !reader.isValid());
+    }
+
+    {  // bad checksum
+        SkBinaryWriteBuffer writer({});
+        writer.writeDescriptor(*a);
+        auto data = writer.snapshotAsData();
+        // Corrupt the end of the rec.
+        auto bytes = static_cast<uint8_t*>(const_cast<void*>(data->data()));
+        bytes[data->size() - 4] ^= 0xff;
+        SkReadBuffer reader{data->data(), data->size()};
+        REPORTER_ASSERT(r, reader.readDescriptor() == nullptr);
+        REPORTER_ASSERT(r, !reader.isValid());
+    }
+}
@@ -10,6 +10,7 @@
 #include "src/lazy/SkDiscardableMemoryPool.h"
 #include "tests/Test.h"
 
+#include <cstdint>
 #include <cstring>
 #include <memory>
 
@@ -62,3 +63,31 @@ DEF_TEST(DiscardableMemory_nonglobal, reporter) {
     test_dm(reporter, dm.get(), true);
 }
 
+
+DEF_TEST(DiscardableMemory_globalLarge, reporter) {
+    // Spans several pages, and doesn't end on a page boundary.
+    constexpr size_t kBytes = 5 * 4096 + 123;
+    std::unique_ptr<SkDiscardableMemory> dm(SkDiscardableMemory::Create(kBytes));
+    REPORTER_ASSERT(reporter, dm);
+    if (!dm) {
+        return;
+    }
+    auto bytes = static_cast<uint8_t*>(dm->data());
+    for (size_t i = 0; i < kBytes; ++i) {
+        bytes[i] = (uint8_t)(i * 7);
+    }
+    for (int round = 0; round < 3; ++round) {
+        dm->unlock();
+        // As above, lock() is allowed to fail, if the memory has been purged.
+        if (!dm->lock()) {
+            return;
+        }
+        bytes = static_cast<uint8_t*>(dm->data());
+        bool same = true;
+        for (size_t i = 0; i < kBytes; ++i) {
+            same &= bytes[i] == (uint8_t)(i * 7);
+        }
+        REPORTER_ASSERT(reporter, same);
+    }
+    dm->unlock();
+}
@@ -325,3 +325,51 @@ DEF_GANESH_TEST(GrDrawOpAtlasConfig_Basic, reporter, options, CtsEnforcement::kA
     test_atlas_config(reporter, 65536, 0, MaskFormat::kA8,
                       { 512, 512 }, { 256, 256 });
 }
+
+// When compaction moves a plot, locators into it can be forwarded to the same pixels in the plot
+// it moved to.
+DEF_TEST(AtlasPlotRelocation, reporter) {
+    skgpu::AtlasGenerationCounter counter;
+    sk_sp<skgpu::Plot> from(new skgpu::Plot(/*pageIndex=*/1, /*plotIndex=*/0, &counter,
+                                            /*offX=*/1, /*offY=*/0, kPlotSize, kPlotSize,
+                                            kAlpha_8_SkColorType, /*bpp=*/1));
+    sk_sp<skgpu::Plot> to(new skgpu::Plot(/*pageIndex=*/0, /*plotIndex=*/1, &counter,
+                                          /*offX=*/0, /*offY=*/1, kPlotSize, kPlotSize,
+                                          kAlpha_8_SkColorType, /*bpp=*/1));
+
+    uint8_t image[8 * 8];
+    memset(image, 0x80, sizeof(image));
+    skgpu::AtlasLocator locator;
+    REPORTER_ASSERT(reporter, from->addSubImage(8, 8, image, &locator));
+    locator.updatePlotLocator(from->plotLocator());
+    const SkIPoint topLeft = locator.topLeft();
+
+    to->resetRects();
+    to->copySubImagesFrom(*from);
+    skgpu::PlotRelocations relocations;
+    relocations.add(*from, *to);
+    from->resetRects();
+
+    REPORTER_ASSERT(reporter, relocations.forward(&locator));
+    REPORTER_ASSERT(reporter, locator.plotLocator() == to->plotLocator());
+    REPORTER_ASSERT(reporter, locator.topLeft() == topLeft + SkIPoint::Make(-kPlotSize, kPlotSize));
+    REPORTER_ASSERT(reporter, locator.width() == 8 && locator.height() == 8);
+
+    // The whole plot is uploaded to its new place, with the subimage where the locator says.
+    REPORTER_ASSERT(reporter, to->needsUpload());
+    auto [data, rect] = to->prepareForUpload();
+    REPORTER_ASSERT(reporter, rect == SkIRect::MakeXYWH(0, kPlotSize, kPlotSize, kPlotSize));
+    const SkIPoint inPlot = locator.topLeft() - SkIPoint::Make(0, kPlotSize);
+    const uint8_t* pixels = static_cast<const uint8_t*>(data);
+    REPORTER_ASSERT(reporter, pixels[inPlot.fY * kPlotSize + inPlot.fX] == 0x80);
+
+    // New subimages are packed around the ones that moved.
+    skgpu::AtlasLocator another;
+    REPORTER_ASSERT(reporter, to->addSubImage(8, 8, image, &another));
+    REPORTER_ASSERT(reporter, another.topLeft() != locator.topLeft());
+
+    // Once the plot moved to is evicted in turn, the relocation is forgotten.
+    to->resetRects();
+    relocations.prune([&](skgpu::PlotLocator p) { return p == to->plotLocator(); });
+    REPORTER_ASSERT(reporter, relocations.count() == 0);
+}
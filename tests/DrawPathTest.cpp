@@ -26,7 +26,9 @@
 #include "include/effects/SkDashPathEffect.h"
 #include "tests/Test.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 
 // test that we can draw an aa-rect at coordinates > 32K (bigger than fixedpoint)
 static void test_big_aa_rect(skiatest::Reporter* reporter) {
@@ -424,3 +426,46 @@ DEF_TEST(DrawPath, reporter) {
     test_big_aa_rect(reporter);
     test_halfway();
 }
+
+// Raster AA rrects, ovals and circles are filled from analytic coverage rather than as paths.
+// Compare them against coverage found by point sampling each pixel.
+DEF_TEST(DrawRRect_AnalyticCoverage, reporter) {
+    auto check = [reporter](const SkRRect& rr) {
+        SkBitmap bm;
+        bm.allocPixels(SkImageInfo::MakeA8(64, 64));
+        bm.eraseColor(SK_ColorTRANSPARENT);
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        SkCanvas(bm).drawRRect(rr, paint);
+
+        constexpr int kSamples = 16;
+        int worst = 0;
+        for (int y = 0; y < bm.height(); ++y) {
+            for (int x = 0; x < bm.width(); ++x) {
+                int inside = 0;
+                for (int j = 0; j < kSamples; ++j) {
+                    for (int i = 0; i < kSamples; ++i) {
+                        const SkRect sample = SkRect::MakeXYWH(x + (i + 0.5f) / kSamples,
+                                                               y + (j + 0.5f) / kSamples,
+                                                               1e-4f, 1e-4f);
+                        inside += rr.contains(sample);
+                    }
+                }
+                const int expected = (inside * 255 + kSamples * kSamples / 2) /
+                                     (kSamples * kSamples);
+                worst = std::max(worst, std::abs(*bm.getAddr8(x, y) - expected));
+            }
+        }
+        REPORTER_ASSERT(reporter, worst <= 24, "worst coverage error %d", worst);
+    };
+
+    check(SkRRect::MakeOval(SkRect::MakeLTRB(12.4f, 12.7f, 27.1f, 27.4f)));
+    check(SkRRect::MakeOval(SkRect::MakeLTRB(3.3f, 20.2f, 60.8f, 41.9f)));
+    check(SkRRect::MakeRectXY(SkRect::MakeLTRB(-10.5f, 5.25f, 50.5f, 30.75f), 8, 8));
+
+    // Lopsided radii, where a pixel can be in the quadrants of two corners on opposite sides.
+    SkRRect rr;
+    const SkVector radii[4] = {{30, 30}, {0, 0}, {30, 32}, {2, 2}};
+    rr.setRectRadii(SkRect::MakeLTRB(2.6f, 3.4f, 58.2f, 61.7f), radii);
+    check(rr);
+}
@@ -15,6 +15,7 @@
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
 #include "include/core/SkDataTable.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
@@ -229,6 +230,40 @@ DEF_TEST(Encode_JpegDownsample, r) {
     REPORTER_ASSERT(r, almost_equals(bm1, bm2, 60));
 }
 
+DEF_TEST(Encode_JpegExecutor, r) {
+    SkBitmap bitmap;
+    if (!ToolUtils::GetResourceAsBitmap("images/mandrill_512.png", &bitmap)) {
+        return;
+    }
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    std::unique_ptr<SkExecutor> oneThread = SkExecutor::MakeFIFOThreadPool(1);
+    for (auto downsample : {SkJpegEncoder::Downsample::k420,
+                            SkJpegEncoder::Downsample::k422,
+                            SkJpegEncoder::Downsample::k444}) {
+        SkJpegEncoder::Options options;
+        options.fQuality = 90;
+        options.fDownsample = downsample;
+        sk_sp<SkData> serial = SkJpegEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+        options.fExecutor = executor.get();
+        sk_sp<SkData> parallel = SkJpegEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+        options.fExecutor = oneThread.get();
+        sk_sp<SkData> oneThreadData =
+                SkJpegEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+        REPORTER_ASSERT(r, serial && parallel && oneThreadData);
+        if (!serial || !parallel || !oneThreadData) {
+            return;
+        }
+
+        // The strips only change the entropy coding, not the pixels, and not with the threads.
+        REPORTER_ASSERT(r, parallel->equals(oneThreadData.get()));
+        SkBitmap expected, actual;
+        SkImages::DeferredFromEncodedData(serial)->asLegacyBitmap(&expected);
+        SkImages::DeferredFromEncodedData(parallel)->asLegacyBitmap(&actual);
+        REPORTER_ASSERT(r, almost_equals(expected, actual, 0));
+    }
+}
+
 static inline void pushComment(
         std::vector<std::string>& comments, const char* keyword, const char* text) {
     comments.push_back(keyword);
@@ -343,6 +378,45 @@ DEF_TEST(Encode_PngOptions, r) {
     REPORTER_ASSERT(r, almost_equals(bm0, bm2, 0));
 }
 
+DEF_TEST(Encode_PngExecutor, r) {
+    // Big enough to be split into several groups of rows.
+    SkBitmap bitmap;
+    bitmap.allocPixels(SkImageInfo::MakeN32(700, 500, kOpaque_SkAlphaType));
+    for (int y = 0; y < bitmap.height(); ++y) {
+        for (int x = 0; x < bitmap.width(); ++x) {
+            *bitmap.getAddr32(x, y) = SkPackARGB32(0xFF, (x * 3 + y) & 0xFF, (x ^ y) & 0xFF,
+                                                   (x * y / 16) & 0xFF);
+        }
+    }
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkPngEncoder::Options options;
+    sk_sp<SkData> data[4];
+    for (int i = 0; i < 4; ++i) {
+        options.fFastFilterSelection = i & 1;
+        options.fExecutor = (i & 2) ? executor.get() : nullptr;
+        SkDynamicMemoryWStream dst;
+        REPORTER_ASSERT(r, SkPngEncoder::Encode(&dst, bitmap.pixmap(), options));
+        data[i] = dst.detachAsData();
+    }
+
+    SkBitmap expected;
+    SkImages::DeferredFromEncodedData(data[0])->asLegacyBitmap(&expected);
+    for (int i = 1; i < 4; ++i) {
+        SkBitmap actual;
+        sk_sp<SkImage> image = SkImages::DeferredFromEncodedData(data[i]);
+        REPORTER_ASSERT(r, image && image->asLegacyBitmap(&actual), "%d", i);
+        REPORTER_ASSERT(r, almost_equals(expected, actual, 0), "%d", i);
+    }
+
+    // The output doesn't depend on how many threads did the work.
+    std::unique_ptr<SkExecutor> oneThread = SkExecutor::MakeFIFOThreadPool(1);
+    options.fExecutor = oneThread.get();
+    SkDynamicMemoryWStream dst;
+    REPORTER_ASSERT(r, SkPngEncoder::Encode(&dst, bitmap.pixmap(), options));
+    REPORTER_ASSERT(r, dst.detachAsData()->equals(data[3].get()));
+}
+
 #ifndef SK_BUILD_FOR_GOOGLE3
 DEF_TEST(Encode_WebpQuality, r) {
     SkBitmap bm;
@@ -453,6 +527,45 @@ DEF_TEST(Encode_WebpOptions, r) {
     REPORTER_ASSERT(r, almost_equals(bm2, bm3, 50));
 }
 
+DEF_TEST(Encode_WebpFastOptions, r) {
+    SkBitmap bitmap;
+    if (!ToolUtils::GetResourceAsBitmap("images/google_chrome.ico", &bitmap)) {
+        return;
+    }
+
+    SkWebpEncoder::Options options;
+    options.fCompression = SkWebpEncoder::Compression::kLossless;
+    sk_sp<SkData> reference = SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+    REPORTER_ASSERT(r, reference);
+
+    // Threads don't change the output.
+    options.fUseThreads = true;
+    sk_sp<SkData> threaded = SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+    REPORTER_ASSERT(r, threaded && threaded->equals(reference.get()));
+
+    options.fMethod = 6;
+    sk_sp<SkData> smallest = SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+    REPORTER_ASSERT(r, smallest);
+
+    SkBitmap expected, actual;
+    SkImages::DeferredFromEncodedData(reference)->asLegacyBitmap(&expected);
+    SkImages::DeferredFromEncodedData(smallest)->asLegacyBitmap(&actual);
+    REPORTER_ASSERT(r, almost_equals(expected, actual, 0));
+
+    options.fCompression = SkWebpEncoder::Compression::kLossy;
+    options.fMethod = 0;
+    options.fPartitions = 3;
+    sk_sp<SkData> lossy = SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options);
+    REPORTER_ASSERT(r, lossy && SkImages::DeferredFromEncodedData(lossy));
+
+    // Out of range settings are rejected.
+    options.fPartitions = 4;
+    REPORTER_ASSERT(r, !SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options));
+    options.fPartitions = 0;
+    options.fMethod = 7;
+    REPORTER_ASSERT(r, !SkWebpEncoder::Encode(nullptr, bitmap.asImage().get(), options));
+}
+
 DEF_TEST(Encode_WebpAnimated, r) {
     const int frameCount = 3;
     const int width = 16;
@@ -0,0 +1,89 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkExecutor.h"
+#include "include/private/base/SkSemaphore.h"
+#include "src/core/SkTaskGroup.h"
+#include "tests/Test.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+// Lots of tiny tasks, some of which add more tasks, all run exactly once.
+DEF_TEST(Executor_WorkStealing, r) {
+    std::unique_ptr<SkExecutor> pool = SkExecutor::MakeWorkStealingThreadPool(4);
+
+    constexpr int kN = 1000;
+    std::vector<std::atomic<int>> runs(kN * 4);
+    SkTaskGroup outer(*pool);
+    outer.batch(kN, [&](int i) {
+        runs[i]++;
+        SkTaskGroup inner(*pool);
+        inner.batch(3, [&, i](int j) { runs[kN + 3*i + j]++; });
+    });
+    outer.wait();
+
+    for (int i = 0; i < kN * 4; i++) {
+        REPORTER_ASSERT(r, runs[i] == 1, "task %d ran %d times", i, runs[i].load());
+    }
+}
+
+// With its one thread busy, a pool runs high priority work added later before normal work.
+DEF_TEST(Executor_Priority, r) {
+    std::unique_ptr<SkExecutor> pool = SkExecutor::MakeWorkStealingThreadPool(1, false);
+
+    SkSemaphore started, blocked;
+    pool->add([&] {
+        started.signal();
+        blocked.wait();
+    });
+    started.wait();
+
+    std::vector<SkExecutor::Priority> order;
+    SkTaskGroup normal(*pool),
+                high  (*pool, SkExecutor::Priority::kHigh);
+    normal.batch(10, [&](int) { order.push_back(SkExecutor::Priority::kNormal); });
+    high  .batch(10, [&](int) { order.push_back(SkExecutor::Priority::kHigh);   });
+    blocked.signal();
+    high.wait();
+    normal.wait();
+
+    REPORTER_ASSERT(r, order.size() == 20);
+    for (size_t i = 0; i < order.size(); i++) {
+        REPORTER_ASSERT(r, order[i] == (i < 10 ? SkExecutor::Priority::kHigh
+                                               : SkExecutor::Priority::kNormal));
+    }
+}
+
+// parallelFor() covers every index once, in ranges no larger than the chunk size.
+DEF_TEST(TaskGroup_ParallelFor, r) {
+    std::unique_ptr<SkExecutor> pool = SkExecutor::MakeWorkStealingThreadPool(4);
+
+    for (int N : {0, 1, 7, 64, 1000}) {
+        for (int chunkSize : {1, 3, 64, 5000}) {
+            std::vector<std::atomic<int>> runs(N);
+            std::atomic<bool> chunksFit{true};
+            SkTaskGroup tasks(*pool);
+            tasks.parallelFor(N, chunkSize, [&](int begin, int end) {
+                if (begin >= end || end - begin > chunkSize) {
+                    chunksFit = false;
+                }
+                for (int i = begin; i < end; i++) {
+                    runs[i]++;
+                }
+            });
+            tasks.wait();
+
+            REPORTER_ASSERT(r, chunksFit);
+            for (int i = 0; i < N; i++) {
+                REPORTER_ASSERT(r, runs[i] == 1, "N=%d chunk=%d: %d ran %d times",
+                                N, chunkSize, i, runs[i].load());
+            }
+        }
+    }
+}
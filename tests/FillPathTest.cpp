@@ -5,17 +5,23 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
+#include "include/core/SkPaint.h"
 #include "include/core/SkPath.h"
+#include "include/core/SkPathBuilder.h"
 #include "include/core/SkPathTypes.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkTypes.h"
+#include "include/private/base/SkFloatingPoint.h"
 #include "src/core/SkBlitter.h"
 #include "src/core/SkScan.h"
 #include "tests/Test.h"
 
 #include <cstdint>
+#include <cstdlib>
 
 struct FakeBlitter : public SkBlitter {
     FakeBlitter()
@@ -52,3 +58,49 @@ DEF_TEST(FillPathInverse, reporter) {
 
     REPORTER_ASSERT(reporter, blitter.m_blitCount == expected_lines);
 }
+
+// Filling a huge path in parallel strips should look just like filling it in one pass. Each strip
+// clips the path's edges to its own rows, which can nudge the coverage of a few edge pixels.
+DEF_TEST(FillPathAAAStrips, reporter) {
+    // Few enough points for the size of the path that it is always filled with analytic AA.
+    SkPathBuilder builder;
+    constexpr int kPoints = 400;
+    for (int i = 0; i < kPoints; ++i) {
+        const float t = i * (6 * SK_FloatPI / kPoints),
+                    r = 300 + 200 * sk_float_sin(i * 0.37f);
+        const SkPoint p = {512 + r * sk_float_cos(t), 512 + r * sk_float_sin(t)};
+        if (i == 0) {
+            builder.moveTo(p);
+        } else {
+            builder.lineTo(p);
+        }
+    }
+    const SkPath path = builder.detach();
+
+    auto draw = [&](bool parallel) {
+        SkBitmap bitmap;
+        bitmap.allocN32Pixels(1024, 1024);
+        bitmap.eraseColor(SK_ColorWHITE);
+
+        SkPaint paint;
+        paint.setAntiAlias(true);
+        gSkParallelAnalyticAA = parallel;
+        SkCanvas(bitmap).drawPath(path, paint);
+        gSkParallelAnalyticAA = false;
+        return bitmap;
+    };
+    const SkBitmap expected = draw(false),
+                   actual   = draw(true);
+
+    int mismatches = 0;
+    for (int y = 0; y < expected.height(); ++y) {
+        for (int x = 0; x < expected.width(); ++x) {
+            int e = SkColorGetR(expected.getColor(x, y)),
+                a = SkColorGetR(actual.getColor(x, y));
+            if (std::abs(e - a) > 64) {
+                ++mismatches;
+            }
+        }
+    }
+    REPORTER_ASSERT(reporter, mismatches < 64, "%d pixels differ", mismatches);
+}
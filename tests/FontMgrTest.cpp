@@ -5,6 +5,7 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkData.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkFontArguments.h"
 #include "include/core/SkFontMgr.h"
@@ -16,19 +17,24 @@
 #include "include/core/SkString.h"
 #include "include/core/SkTypeface.h"
 #include "include/core/SkTypes.h"
+#include "include/ports/SkFontMgr_directory.h"
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkMalloc.h"
 #include "src/core/SkAdvancedTypefaceMetrics.h" // IWYU pragma: keep
 #include "src/core/SkFontPriv.h"
 #include "src/core/SkScalerContext.h"
+#include "src/utils/SkOSPath.h"
 #include "tests/Test.h"
+#include "tools/Resources.h"
 #include "tools/flags/CommandLineFlags.h"
 #include "tools/fonts/FontToolUtils.h"
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <memory>
+#include <utility>
 #include <vector>
 
 class SkDescriptor;
@@ -804,3 +810,47 @@ DEF_TEST(FontMgr_MatchCharacter, reporter) {
     fm->matchFamilyStyleCharacter("Blah", SkFontStyle::Normal(), nullptr, 0, 0x1FFFFF);
     fm->matchFamilyStyleCharacter("Blah", SkFontStyle::Normal(), nullptr, 0, -1);
 }
+
+#if defined(SK_FONTMGR_FREETYPE_DIRECTORY_AVAILABLE)
+static std::vector<SkString> family_names(const SkFontMgr& fontMgr) {
+    std::vector<SkString> names;
+    for (int i = 0; i < fontMgr.countFamilies(); ++i) {
+        SkString name;
+        fontMgr.getFamilyName(i, &name);
+        sk_sp<SkFontStyleSet> styles = fontMgr.createStyleSet(i);
+        name.appendf(" (%d)", styles ? styles->count() : 0);
+        names.push_back(std::move(name));
+    }
+    return names;
+}
+
+DEF_TEST(FontMgr_CustomDirectoryIndex, reporter) {
+    SkString tmpDir = skiatest::GetTmpDir();
+    if (tmpDir.isEmpty()) {
+        return;
+    }
+    const SkString fontDir = GetResourcePath("fonts");
+    const SkString indexPath = SkOSPath::Join(tmpDir.c_str(), "FontMgr_CustomDirectoryIndex");
+
+    const std::vector<SkString> expected =
+            family_names(*SkFontMgr_New_Custom_Directory(fontDir.c_str()));
+    REPORTER_ASSERT(reporter, !expected.empty());
+
+    // Start from something that isn't an index, which is replaced by the first font manager.
+    static constexpr char kNotAnIndex[] = "not a font index";
+    {
+        SkFILEWStream stream(indexPath.c_str());
+        stream.writeText(kNotAnIndex);
+    }
+
+    // The first font manager scans the fonts and writes the index, and the second one reads it.
+    for (int i = 0; i < 2; ++i) {
+        sk_sp<SkFontMgr> fontMgr =
+                SkFontMgr_New_Custom_Directory(fontDir.c_str(), indexPath.c_str());
+        REPORTER_ASSERT(reporter, family_names(*fontMgr) == expected, "pass %d", i);
+
+        sk_sp<SkData> index = SkData::MakeFromFileName(indexPath.c_str());
+        REPORTER_ASSERT(reporter, index && index->size() > strlen(kNotAnIndex), "pass %d", i);
+    }
+}
+#endif
@@ -5,8 +5,11 @@
  * found in the LICENSE file.
  */
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include "include/core/SkAlphaType.h"
+#include "include/core/SkBlendMode.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
@@ -22,6 +25,9 @@
 #include "include/core/SkShader.h"
 #include "include/private/SkGainmapInfo.h"
 #include "include/private/SkGainmapShader.h"
+#include "src/base/SkRandom.h"
+#include "src/core/SkImageInfoPriv.h"
+#include "src/shaders/SkGainmapApplyShader.h"
 #include "tests/Test.h"
 
 static bool approx_equal(const SkColor4f& a, const SkColor4f& b) {
@@ -315,3 +321,80 @@ DEF_TEST(GainmapShader_colorSpace, r) {
             sdrImage, gainmapImage, gainmapInfo, gainmapInfo.fDisplayRatioHdr, dstColorSpace);
     REPORTER_ASSERT(r, !approx_equal(color, kExpectedColor));
 }
+
+// The raster pipeline's fused gainmap stage should match the runtime effect the GPU backends use.
+DEF_TEST(GainmapShader_rasterStageMatchesRuntimeEffect, r) {
+    constexpr int kW = 13, kH = 3;
+    SkRandom rand;
+    SkBitmap base;
+    base.allocPixels(SkImageInfo::Make(kW, kH, kRGBA_F32_SkColorType, kPremul_SkAlphaType));
+    for (int y = 0; y < kH; ++y) {
+        for (int x = 0; x < kW; ++x) {
+            const float a = rand.nextRangeF(0.25f, 1.f);
+            SkColor4f c = {rand.nextF() * a, rand.nextF() * a, rand.nextF() * a, a};
+            memcpy(base.getAddr(x, y), &c, sizeof(c));
+        }
+    }
+
+    for (SkColorType gainmapCT : {kRGBA_8888_SkColorType, kAlpha_8_SkColorType,
+                                  kGray_8_SkColorType, kR8_unorm_SkColorType}) {
+        SkBitmap gainmap;
+        gainmap.allocPixels(SkImageInfo::Make(kW, kH, gainmapCT,
+                                              SkColorTypeIsAlwaysOpaque(gainmapCT)
+                                                      ? kOpaque_SkAlphaType
+                                                      : kUnpremul_SkAlphaType));
+        for (int y = 0; y < kH; ++y) {
+            auto row = static_cast<uint8_t*>(gainmap.getAddr(0, y));
+            for (size_t i = 0; i < gainmap.info().minRowBytes(); ++i) {
+                row[i] = (uint8_t)rand.nextU();
+            }
+        }
+
+        for (bool noGamma : {true, false}) {
+            SkGainmapApplyShader::Params params;
+            params.fLogRatioMin = {-0.5f, 0.f, 0.25f, 1.f};
+            params.fLogRatioMax = {1.f, 1.5f, 2.f, 1.f};
+            params.fGamma = noGamma ? SkColor4f{1.f, 1.f, 1.f, 1.f}
+                                    : SkColor4f{0.5f, 1.f, 2.2f, 1.f};
+            params.fEpsilonBase = {0.01f, 0.02f, 0.03f, 1.f};
+            params.fEpsilonOther = {0.03f, 0.02f, 0.01f, 1.f};
+            params.fW = 0.75f;
+            switch (SkColorTypeChannelFlags(gainmapCT)) {
+                case kAlpha_SkColorChannelFlag: params.fChannel = 3;  break;
+                case kRed_SkColorChannelFlag:
+                case kGray_SkColorChannelFlag:  params.fChannel = 0;  break;
+                default:                        params.fChannel = -1; break;
+            }
+            auto shader = sk_make_sp<SkGainmapApplyShader>(
+                    base.asImage()->makeRawShader(SkSamplingOptions()),
+                    gainmap.asImage()->makeRawShader(SkSamplingOptions()),
+                    params);
+
+            auto draw = [&](sk_sp<SkShader> s) {
+                SkBitmap dst;
+                dst.allocPixels(SkImageInfo::Make(kW, kH, kRGBA_F32_SkColorType,
+                                                  kPremul_SkAlphaType));
+                dst.eraseColor(SK_ColorTRANSPARENT);
+                SkPaint paint;
+                paint.setShader(std::move(s));
+                paint.setBlendMode(SkBlendMode::kSrc);
+                SkCanvas(dst).drawPaint(paint);
+                return dst;
+            };
+            const SkBitmap fused   = draw(shader),
+                           runtime = draw(shader->runtimeShader());
+            for (int y = 0; y < kH; ++y) {
+                for (int x = 0; x < kW; ++x) {
+                    const auto a = *static_cast<const SkColor4f*>(fused.getAddr(x, y)),
+                               b = *static_cast<const SkColor4f*>(runtime.getAddr(x, y));
+                    // exp() and pow() are approximated, so compare relatively.
+                    for (int i = 0; i < 4; ++i) {
+                        REPORTER_ASSERT(r, std::abs(a[i] - b[i]) <= 2e-3f * std::max(1.f, b[i]),
+                                        "ct %d gamma %d (%d, %d)[%d]: %g vs %g",
+                                        gainmapCT, !noGamma, x, y, i, a[i], b[i]);
+                    }
+                }
+            }
+        }
+    }
+}
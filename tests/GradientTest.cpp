@@ -31,6 +31,7 @@
 #include "include/gpu/GrDirectContext.h"
 #include "include/gpu/ganesh/SkSurfaceGanesh.h"
 #include "include/gpu/mock/GrMockTypes.h"
+#include "include/private/base/SkTPin.h"
 #include "include/private/base/SkTemplates.h"
 #include "include/private/base/SkTo.h"
 #include "include/private/gpu/ganesh/GrTypesPriv.h"
@@ -42,6 +43,7 @@
 #include "tests/CtsEnforcement.h"
 #include "tests/Test.h"
 
+#include <cmath>
 #include <cstdint>
 #include <cstring>
 #include <string>
@@ -616,3 +618,73 @@ DEF_TEST(Gradient, reporter) {
     test_sweep_fuzzer(reporter);
     test_unsorted_degenerate(reporter);
 }
+
+// Gradients with many unevenly spaced stops find their stops through an index in the raster
+// pipeline. Check that they still match the stops, in every tile mode, and that hard stops stay hard.
+DEF_TEST(Gradient_ManyStops, reporter) {
+    constexpr int kStops = 20;
+    constexpr int kW = 400;
+    SkColor colors[kStops];
+    SkScalar pos[kStops];
+    for (int i = 0; i < kStops; ++i) {
+        colors[i] = SkColorSetRGB(i * 13, 255 - i * 11, (i % 3) * 120);
+        pos[i] = (float)(i * i) / ((kStops - 1) * (kStops - 1));
+    }
+
+    auto expected = [&](float t) {
+        int i = 0;
+        while (i < kStops - 2 && pos[i + 1] <= t) {
+            i++;
+        }
+        const float w = SkTPin((t - pos[i]) / (pos[i + 1] - pos[i]), 0.f, 1.f);
+        auto lerp = [&](float l, float r) { return l + (r - l) * w; };
+        return SkColor4f{lerp(SkColorGetR(colors[i]), SkColorGetR(colors[i + 1])) / 255,
+                         lerp(SkColorGetG(colors[i]), SkColorGetG(colors[i + 1])) / 255,
+                         lerp(SkColorGetB(colors[i]), SkColorGetB(colors[i + 1])) / 255,
+                         1};
+    };
+
+    for (SkTileMode mode : {SkTileMode::kClamp, SkTileMode::kRepeat, SkTileMode::kMirror}) {
+        auto surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(kW, 1));
+        const SkPoint pts[] = {{kW / 4.f, 0}, {kW * 3 / 4.f, 0}};
+        SkPaint paint;
+        paint.setShader(SkGradientShader::MakeLinear(pts, colors, pos, kStops, mode));
+        surface->getCanvas()->drawPaint(paint);
+
+        SkPixmap pm;
+        REPORTER_ASSERT(reporter, surface->peekPixels(&pm));
+        for (int x = 0; x < kW; ++x) {
+            float t = (x + 0.5f - pts[0].fX) / (pts[1].fX - pts[0].fX);
+            switch (mode) {
+                case SkTileMode::kClamp:  t = SkTPin(t, 0.f, 1.f);                      break;
+                case SkTileMode::kRepeat: t = t - std::floor(t);                        break;
+                case SkTileMode::kMirror: t = std::abs(t - 2 * std::floor(t / 2 + 0.5f)); break;
+                default: break;
+            }
+            const SkColor4f want = expected(t),
+                            got  = SkColor4f::FromColor(pm.getColor(x, 0));
+            for (int c = 0; c < 3; ++c) {
+                REPORTER_ASSERT(reporter, std::abs(want[c] - got[c]) <= 2 / 255.f,
+                                "mode %d x %d channel %d: %g vs %g",
+                                (int)mode, x, c, want[c], got[c]);
+            }
+        }
+    }
+
+    // A hard stop in the middle of many stops.
+    pos[kStops / 2] = pos[kStops / 2 - 1];
+    auto surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(kW, 1));
+    const SkPoint pts[] = {{0, 0}, {kW, 0}};
+    SkPaint paint;
+    paint.setShader(SkGradientShader::MakeLinear(pts, colors, pos, kStops, SkTileMode::kClamp));
+    surface->getCanvas()->drawPaint(paint);
+    const float hardX = pos[kStops / 2] * kW;
+    SkPixmap pm;
+    REPORTER_ASSERT(reporter, surface->peekPixels(&pm));
+    const SkColor left  = pm.getColor((int)std::floor(hardX - 1), 0),
+                  right = pm.getColor((int)std::ceil(hardX + 1), 0);
+    REPORTER_ASSERT(reporter, std::abs((int)SkColorGetG(left) -
+                                       (int)SkColorGetG(colors[kStops / 2 - 1])) <= 2);
+    REPORTER_ASSERT(reporter, std::abs((int)SkColorGetG(right) -
+                                       (int)SkColorGetG(colors[kStops / 2])) <= 2);
+}
@@ -8,13 +8,16 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkString.h"
 #include "include/core/SkTypes.h"
+#include "src/base/SkRandom.h"
 #include "src/core/SkTHash.h"
+#include "src/core/SkTSwissTable.h"
 #include "tests/Test.h"
 
 #include <cstdint>
 #include <initializer_list>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 
 using namespace skia_private;
@@ -446,3 +449,91 @@ DEF_TEST(HashTableGrowsAndShrinks, r) {
         s.remove(2); check_count_cap(1,4);
     }
 }
+
+namespace {
+struct SwissEntry {
+    int key;
+    int value;
+};
+
+template <uint32_t kHashMask>
+struct SwissTraits {
+    static int GetKey(const SwissEntry& e) { return e.key; }
+    static uint32_t Hash(int key) { return SkChecksum::Hash32(&key, sizeof(key)) & kHashMask; }
+};
+
+// Applies the same random sets and removes to a TSwissTable and a std::unordered_map.
+template <uint32_t kHashMask>
+void test_swiss_table(skiatest::Reporter* r) {
+    TSwissTable<SwissEntry, int, SwissTraits<kHashMask>> table;
+    std::unordered_map<int, int> expected;
+
+    SkRandom rand;
+    for (int i = 0; i < 20000; i++) {
+        const int key = rand.nextULessThan(1000);
+        if (rand.nextBool() || !table.find(key)) {
+            table.set({key, i});
+            expected[key] = i;
+        } else {
+            table.remove(key);
+            expected.erase(key);
+        }
+        if (i % 1000 == 0) {
+            const TSwissTable<SwissEntry, int, SwissTraits<kHashMask>> copy = table;
+            table = std::move(copy);
+        }
+    }
+
+    REPORTER_ASSERT(r, table.count() == (int)expected.size());
+    for (int key = 0; key < 1000; key++) {
+        const SwissEntry* e = table.find(key);
+        auto it = expected.find(key);
+        REPORTER_ASSERT(r, (e != nullptr) == (it != expected.end()), "key %d", key);
+        if (e && it != expected.end()) {
+            REPORTER_ASSERT(r, e->value == it->second, "key %d", key);
+        }
+    }
+    int visited = 0;
+    std::as_const(table).foreach([&](const SwissEntry& e) {
+        REPORTER_ASSERT(r, expected.count(e.key) == 1);
+        visited++;
+    });
+    REPORTER_ASSERT(r, visited == table.count());
+}
+}  // namespace
+
+DEF_TEST(SwissTable, r) {
+    test_swiss_table<0xffffffff>(r);
+    // Only 16 distinct hashes, so long probe sequences of matching control bytes.
+    test_swiss_table<0x0000000f>(r);
+    // The same 7 bits in every control byte, but spread out over the table.
+    test_swiss_table<0xffffff80>(r);
+}
+
+DEF_TEST(SwissTableGrowsAndShrinks, r) {
+    TSwissTable<SwissEntry, int, SwissTraits<0xffffffff>> table;
+    REPORTER_ASSERT(r, table.capacity() == 0);
+
+    for (int i = 0; i < 100; i++) {
+        table.set({i, i});
+    }
+    REPORTER_ASSERT(r, table.count() == 100);
+    REPORTER_ASSERT(r, table.capacity() == 128);
+
+    // Removing and re-adding the same key reuses its slot, rather than growing the table.
+    for (int i = 0; i < 1000; i++) {
+        table.remove(50);
+        table.set({50, i});
+    }
+    REPORTER_ASSERT(r, table.capacity() == 128);
+    REPORTER_ASSERT(r, table.find(50)->value == 999);
+
+    for (int i = 0; i < 90; i++) {
+        table.remove(i);
+    }
+    REPORTER_ASSERT(r, table.count() == 10);
+    REPORTER_ASSERT(r, table.capacity() == 32);
+    for (int i = 90; i < 100; i++) {
+        REPORTER_ASSERT(r, table.find(i) && table.find(i)->value == i);
+    }
+}
@@ -7,16 +7,22 @@
 
 #include "include/core/SkColorSpace.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkTypes.h"
 #include "include/encode/SkICC.h"
 #include "modules/skcms/skcms.h"
+#include "src/base/SkRandom.h"
+#include "src/core/SkTaskGroup.h"
 #include "tests/Test.h"
 #include "tools/Resources.h"
 
 #include <cmath>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 DEF_TEST(AdobeRGB, r) {
     if (sk_sp<SkData> profile = GetResourceAsData("icc_profiles/AdobeRGB1998.icc")) {
@@ -125,3 +131,69 @@ DEF_TEST(HDR_ICC, r) {
         }
     }
 }
+
+DEF_TEST(ICC_PreparedTransform, r) {
+    sk_sp<SkData> pqData = SkWriteICCProfile(SkNamedTransferFn::kPQ, SkNamedGamut::kRec2020);
+    skcms_ICCProfile pq, p3;
+    REPORTER_ASSERT(r, skcms_Parse(pqData->data(), pqData->size(), &pq));
+    SkColorSpace::MakeRGB(SkNamedTransferFn::kSRGB, SkNamedGamut::kDisplayP3)->toProfile(&p3);
+
+    // An A2B source, a TRC source, no conversion at all, and a gray destination.
+    const struct {
+        const skcms_ICCProfile* src;
+        const skcms_ICCProfile* dst;
+        skcms_PixelFormat       dstFmt;
+        size_t                  dstBpp;
+    } kCases[] = {
+        {&pq, &p3,     skcms_PixelFormat_RGBA_8888, 4},
+        {&p3, nullptr, skcms_PixelFormat_RGBA_8888, 4},
+        {&p3, &p3,     skcms_PixelFormat_BGRA_8888, 4},
+        {&p3, nullptr, skcms_PixelFormat_G_8,       1},
+    };
+
+    constexpr int kW = 67, kH = 31;
+    SkRandom random;
+    std::vector<uint32_t> src(kW * kH);
+    for (uint32_t& px : src) {
+        px = random.nextU();
+    }
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+
+    for (const auto& c : kCases) {
+        std::vector<uint8_t> want(kW * kH * c.dstBpp), got(kW * kH * c.dstBpp);
+        REPORTER_ASSERT(r, skcms_Transform(src.data(),  skcms_PixelFormat_RGBA_8888,
+                                           skcms_AlphaFormat_Unpremul, c.src,
+                                           want.data(), c.dstFmt,
+                                           skcms_AlphaFormat_PremulAsEncoded, c.dst,
+                                           kW * kH));
+
+        skcms_PreparedTransform prepared;
+        REPORTER_ASSERT(r, skcms_PrepareTransform(skcms_PixelFormat_RGBA_8888,
+                                                  skcms_AlphaFormat_Unpremul, c.src,
+                                                  c.dstFmt, skcms_AlphaFormat_PremulAsEncoded,
+                                                  c.dst, &prepared));
+
+        // A prepared transform can be copied, and run on many threads at once, a row each here.
+        const skcms_PreparedTransform copy = prepared;
+        memset(&prepared, 0, sizeof(prepared));
+        SkTaskGroup tasks(*executor);
+        tasks.batch(kH, [&](int y) {
+            REPORTER_ASSERT(r, skcms_RunPreparedTransform(&copy, src.data() + y * kW,
+                                                          got.data() + y * kW * c.dstBpp, kW));
+        });
+        tasks.wait();
+        REPORTER_ASSERT(r, want == got);
+    }
+
+    // Destinations skcms_Transform() can't handle can't be prepared either.
+    const uint8_t table[] = {0, 255};
+    skcms_ICCProfile tableDst = p3;
+    tableDst.trc[0].table_entries = 2;
+    tableDst.trc[0].table_8       = table;
+    tableDst.trc[0].table_16      = nullptr;
+    skcms_PreparedTransform prepared;
+    REPORTER_ASSERT(r, !skcms_PrepareTransform(skcms_PixelFormat_RGBA_8888,
+                                               skcms_AlphaFormat_Unpremul, &p3,
+                                               skcms_PixelFormat_RGBA_8888,
+                                               skcms_AlphaFormat_Unpremul, &tableDst, &prepared));
+}
@@ -17,11 +17,13 @@
 
 namespace {
 static void* gGlobalAddress;
+static void* gOtherAddress;
 struct TestingKey : public SkResourceCache::Key {
     intptr_t    fValue;
 
-    TestingKey(intptr_t value, uint64_t sharedID = 0) : fValue(value) {
-        this->init(&gGlobalAddress, sharedID, sizeof(fValue));
+    TestingKey(intptr_t value, uint64_t sharedID = 0, void* nameSpace = &gGlobalAddress)
+            : fValue(value) {
+        this->init(nameSpace, sharedID, sizeof(fValue));
     }
 };
 struct TestingRec : public SkResourceCache::Rec {
@@ -154,3 +156,57 @@ DEF_TEST(ImageCache_doubleAdd, r) {
     REPORTER_ASSERT(r, cache.find(key, TestingRec::Visitor, &value));
     REPORTER_ASSERT(r, 2 == value || 3 == value);
 }
+
+DEF_TEST(ImageCache_namespaceLimit, r) {
+    SkResourceCache cache(4096);
+    const size_t recSize = TestingRec(TestingKey(0), 0).bytesUsed();
+
+    for (int i = 0; i < 4; ++i) {
+        cache.add(new TestingRec(TestingKey(i), i));
+    }
+
+    // Filling the other namespace past its limit only evicts its own oldest recs.
+    REPORTER_ASSERT(r, 0 == cache.setNamespaceByteLimit(&gOtherAddress, 3 * recSize));
+    for (int i = 0; i < 10; ++i) {
+        cache.add(new TestingRec(TestingKey(i, 0, &gOtherAddress), i));
+    }
+    REPORTER_ASSERT(r, cache.getNamespaceBytesUsed(&gOtherAddress) == 3 * recSize);
+    REPORTER_ASSERT(r, cache.getNamespaceBytesUsed(&gGlobalAddress) == 4 * recSize);
+
+    intptr_t value = -1;
+    for (int i = 0; i < 4; ++i) {
+        REPORTER_ASSERT(r, cache.find(TestingKey(i), TestingRec::Visitor, &value));
+    }
+    for (int i = 0; i < 10; ++i) {
+        bool found = cache.find(TestingKey(i, 0, &gOtherAddress), TestingRec::Visitor, &value);
+        REPORTER_ASSERT(r, found == (i >= 7));
+    }
+
+    // Lowering the limit purges immediately.
+    REPORTER_ASSERT(r, 3 * recSize == cache.setNamespaceByteLimit(&gOtherAddress, recSize));
+    REPORTER_ASSERT(r, cache.getNamespaceBytesUsed(&gOtherAddress) == recSize);
+    REPORTER_ASSERT(r, cache.getTotalBytesUsed() == 5 * recSize);
+}
+
+DEF_TEST(ImageCache_globalShards, r) {
+    // Keys spread across the global cache's shards must still be found, and shared ID purges
+    // must reach every shard.
+    static constexpr uint64_t kSharedID = 0x5ca1ab1e0000cafe;
+    static constexpr int kCount = 64;
+
+    for (int i = 0; i < kCount; ++i) {
+        TestingKey key(i, kSharedID);
+        SkResourceCache::Add(new TestingRec(key, i));
+        intptr_t value = -1;
+        REPORTER_ASSERT(r, SkResourceCache::Find(key, TestingRec::Visitor, &value));
+        REPORTER_ASSERT(r, i == value);
+    }
+
+    SkResourceCache::PostPurgeSharedID(kSharedID);
+    SkResourceCache::CheckMessages();
+    for (int i = 0; i < kCount; ++i) {
+        intptr_t value = -1;
+        REPORTER_ASSERT(r, !SkResourceCache::Find(TestingKey(i, kSharedID),
+                                                  TestingRec::Visitor, &value));
+    }
+}
@@ -30,6 +30,7 @@
 #include "include/private/gpu/ganesh/GrTypesPriv.h"
 #include "src/core/SkImageFilterCache.h"
 #include "src/core/SkImageFilterTypes.h"
+#include "src/core/SkImageFilter_Base.h"
 #include "src/core/SkSpecialImage.h"
 #include "src/gpu/ganesh/GrColorInfo.h" // IWYU pragma: keep
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
@@ -120,6 +121,36 @@ static void test_dont_find_if_diff_key(skiatest::Reporter* reporter,
     REPORTER_ASSERT(reporter, !cache->get(key4, &foundImage));
 }
 
+// A lookup whose clip is contained in a cached entry's clip reuses that entry
+static void test_find_contained_clip(skiatest::Reporter* reporter,
+                                     const sk_sp<SkSpecialImage>& image) {
+    static const size_t kCacheSize = 1000000;
+    sk_sp<SkImageFilterCache> cache(SkImageFilterCache::Create(kCacheSize));
+
+    SkImageFilterCacheKey key0(0, SkMatrix::I(), SkIRect::MakeWH(100, 100),
+                               image->uniqueID(), image->subset());
+    SkImageFilterCacheKey key1(0, SkMatrix::I(), SkIRect::MakeXYWH(1, 1, 50, 50),
+                               image->uniqueID(), image->subset());
+    SkImageFilterCacheKey key2(0, SkMatrix::I(), SkIRect::MakeXYWH(60, 60, 50, 50),
+                               image->uniqueID(), image->subset());
+    SkImageFilterCacheKey key3(1, SkMatrix::I(), SkIRect::MakeXYWH(1, 1, 50, 50),
+                               image->uniqueID(), image->subset());
+
+    SkIPoint offset = SkIPoint::Make(3, 4);
+    cache->set(key0, nullptr, skif::FilterResult(image, skif::LayerSpace<SkIPoint>(offset)));
+
+    skif::FilterResult foundImage;
+    REPORTER_ASSERT(reporter, cache->get(key1, &foundImage));
+    REPORTER_ASSERT(reporter,
+            SkIRect::MakeXYWH(offset.fX, offset.fY, image->width(), image->height()) ==
+            SkIRect(foundImage.layerBounds()));
+    REPORTER_ASSERT(reporter, !cache->get(key2, &foundImage));
+    REPORTER_ASSERT(reporter, !cache->get(key3, &foundImage));
+
+    cache->purge();
+    REPORTER_ASSERT(reporter, !cache->get(key1, &foundImage));
+}
+
 // Test purging when the max cache size is exceeded
 static void test_internal_purge(skiatest::Reporter* reporter, const sk_sp<SkSpecialImage>& image) {
     SkASSERT(image->getSize());
@@ -199,6 +230,36 @@ DEF_TEST(ImageFilterCache_RasterBacked, reporter) {
     test_dont_find_if_diff_key(reporter, fullImg, subsetImg);
     test_internal_purge(reporter, fullImg);
     test_explicit_purging(reporter, fullImg, subsetImg);
+    test_find_contained_clip(reporter, fullImg);
+}
+
+DEF_TEST(ImageFilterCache_StructuralCacheID, reporter) {
+    // Separately constructed filters with the same parameters share a cache ID
+    auto filter1 = make_filter();
+    auto filter2 = make_filter();
+    REPORTER_ASSERT(reporter, as_IFB(filter1)->uniqueID() != as_IFB(filter2)->uniqueID());
+    REPORTER_ASSERT(reporter, as_IFB(filter1)->cacheID() == as_IFB(filter2)->cacheID());
+
+    // ... even after the first one is destroyed
+    const uint32_t cacheID = as_IFB(filter1)->cacheID();
+    filter1.reset();
+    REPORTER_ASSERT(reporter, as_IFB(make_filter())->cacheID() == cacheID);
+
+    // But not when a parameter or input differs
+    auto other = SkImageFilters::ColorFilter(
+            SkColorFilters::Blend(SK_ColorRED, SkBlendMode::kSrcIn), nullptr, nullptr);
+    REPORTER_ASSERT(reporter, as_IFB(other)->cacheID() != cacheID);
+    auto chained = SkImageFilters::ColorFilter(
+            SkColorFilters::Blend(SK_ColorBLUE, SkBlendMode::kSrcIn), make_filter(), nullptr);
+    REPORTER_ASSERT(reporter, as_IFB(chained)->cacheID() != cacheID);
+
+    // Images are identified by their unique ID
+    SkBitmap bm = create_bm();
+    auto image1 = SkImageFilters::Image(bm.asImage(), SkFilterMode::kNearest);
+    auto image2 = SkImageFilters::Image(bm.asImage(), SkFilterMode::kNearest);
+    auto image3 = SkImageFilters::Image(create_bm().asImage(), SkFilterMode::kNearest);
+    REPORTER_ASSERT(reporter, as_IFB(image1)->cacheID() == as_IFB(image2)->cacheID());
+    REPORTER_ASSERT(reporter, as_IFB(image1)->cacheID() != as_IFB(image3)->cacheID());
 }
 
 
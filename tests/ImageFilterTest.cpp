@@ -44,6 +44,8 @@
 #include "include/gpu/GrTypes.h"
 #include "include/private/base/SkTArray.h"
 #include "include/private/base/SkTo.h"
+#include "src/base/SkRandom.h"
+#include "src/base/SkVx.h"
 #include "src/core/SkBitmapDevice.h"
 #include "src/core/SkDevice.h"
 #include "src/core/SkImageFilterTypes.h"
@@ -699,6 +701,60 @@ DEF_GANESH_TEST_FOR_RENDERING_CONTEXTS(MorphologyFilterRadiusWithMirrorCTM_Gpu,
     test_morphology_radius_with_mirror_ctm(reporter, ctxInfo.directContext());
 }
 
+// Raster dilates and erodes with van Herk/Gil-Werman passes, which must match taking the max or min
+// of every window directly, including the transparent black beyond the image's edges.
+DEF_TEST(MorphologyFilterMatchesWindows, reporter) {
+    static constexpr int kWidth = 45, kHeight = 37, kPad = 12;
+    SkRandom random;
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(kWidth, kHeight);
+    for (int y = 0; y < kHeight; ++y) {
+        for (int x = 0; x < kWidth; ++x) {
+            const U8CPU a = random.nextULessThan(256);
+            *bitmap.getAddr32(x, y) = SkPreMultiplyARGB(a,
+                                                        random.nextULessThan(256),
+                                                        random.nextULessThan(256),
+                                                        random.nextULessThan(256));
+        }
+    }
+    sk_sp<SkImage> image = bitmap.asImage();
+
+    const SkISize radii[] = {{1, 1}, {4, 0}, {0, 7}, {10, 3}};
+    for (bool dilate : {true, false}) {
+        for (SkISize r : radii) {
+            sk_sp<SkImageFilter> filter =
+                    dilate ? SkImageFilters::Dilate(r.width(), r.height(), nullptr)
+                           : SkImageFilters::Erode(r.width(), r.height(), nullptr);
+            SkBitmap actual;
+            actual.allocN32Pixels(kWidth + 2 * kPad, kHeight + 2 * kPad);
+            actual.eraseColor(SK_ColorTRANSPARENT);
+            SkCanvas canvas(actual);
+            SkPaint paint;
+            paint.setImageFilter(filter);
+            canvas.drawImage(image, kPad, kPad, {}, &paint);
+
+            int mismatches = 0;
+            for (int y = -kPad; y < kHeight + kPad; ++y) {
+                for (int x = -kPad; x < kWidth + kPad; ++x) {
+                    skvx::byte4 expected(dilate ? 0 : 255);
+                    for (int wy = y - r.height(); wy <= y + r.height(); ++wy) {
+                        for (int wx = x - r.width(); wx <= x + r.width(); ++wx) {
+                            const bool inside = wx >= 0 && wx < kWidth && wy >= 0 && wy < kHeight;
+                            const uint32_t color = inside ? *bitmap.getAddr32(wx, wy) : 0;
+                            const auto px = skvx::byte4::Load(&color);
+                            expected = dilate ? max(expected, px) : min(expected, px);
+                        }
+                    }
+                    mismatches += any(expected != skvx::byte4::Load(
+                                                          actual.getAddr32(x + kPad, y + kPad)));
+                }
+            }
+            REPORTER_ASSERT(reporter, mismatches == 0, "%s radii %d,%d: %d mismatches",
+                            dilate ? "dilate" : "erode", r.width(), r.height(), mismatches);
+        }
+    }
+}
+
 static void test_zero_blur_sigma(skiatest::Reporter* reporter, GrDirectContext* dContext) {
     // Check that SkBlurImageFilter with a zero sigma and a non-zero srcOffset works correctly.
     SkIRect cropRect = SkIRect::MakeXYWH(5, 0, 5, 10);
@@ -1765,6 +1821,59 @@ DEF_TEST(ImageFilterBlurLargeImage, reporter) {
     test_large_blur_input(reporter, surface->getCanvas());
 }
 
+// Raster evaluates filters over large outputs one tile at a time. Blurs and morphology read past
+// the edges of their tiles, so the tiles must match evaluating the filter in pieces small enough
+// to not be tiled, whose edges fall elsewhere.
+DEF_TEST(ImageFilterTiledEvaluation, reporter) {
+    constexpr int kWidth = 1300, kHeight = 1100;
+    sk_sp<SkSurface> src = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(kWidth, kHeight));
+    SkPaint paint;
+    const SkPoint pts[] = {{0, 0}, {kWidth, kHeight}};
+    const SkColor colors[] = {SK_ColorRED, SK_ColorTRANSPARENT, SK_ColorBLUE, SK_ColorGREEN};
+    paint.setShader(SkGradientShader::MakeLinear(pts, colors, nullptr, std::size(colors),
+                                                 SkTileMode::kMirror));
+    src->getCanvas()->drawPaint(paint);
+    paint.setShader(nullptr);
+    for (int i = 0; i < 40; ++i) {
+        paint.setColor(i % 2 ? SK_ColorWHITE : SK_ColorBLACK);
+        src->getCanvas()->drawCircle(37.f * i, 29.f * i, 5.f + i, paint);
+    }
+    sk_sp<SkImage> image = src->makeImageSnapshot();
+
+    auto draw = [&](const sk_sp<SkImageFilter>& filter, const SkIRect& clip, SkBitmap* bitmap) {
+        SkCanvas canvas(*bitmap);
+        canvas.clipIRect(clip);
+        SkPaint layerPaint;
+        layerPaint.setImageFilter(filter);
+        canvas.saveLayer(nullptr, &layerPaint);
+        canvas.drawImage(image, 0, 0);
+        canvas.restore();
+    };
+
+    sk_sp<SkImageFilter> filters[] = {
+        SkImageFilters::Blur(6, 9, SkImageFilters::Dilate(3, 2, make_grayscale(nullptr, nullptr))),
+        SkImageFilters::Erode(4, 1, SkImageFilters::Offset(-7, 5, nullptr)),
+        SkImageFilters::DisplacementMap(SkColorChannel::kR, SkColorChannel::kB, 20.f,
+                                        SkImageFilters::Blur(3, 3, nullptr), nullptr),
+    };
+    for (const sk_sp<SkImageFilter>& filter : filters) {
+        SkBitmap expected, actual;
+        expected.allocN32Pixels(kWidth, kHeight);
+        expected.eraseColor(SK_ColorTRANSPARENT);
+        actual.allocN32Pixels(kWidth, kHeight);
+        actual.eraseColor(SK_ColorTRANSPARENT);
+
+        for (int y = 0; y < kHeight; y += kHeight / 2) {
+            for (int x = 0; x < kWidth; x += kWidth / 2) {
+                draw(filter, SkIRect::MakeXYWH(x, y, kWidth / 2, kHeight / 2), &expected);
+            }
+        }
+        draw(filter, SkIRect::MakeWH(kWidth, kHeight), &actual);
+
+        REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(expected, actual));
+    }
+}
+
 static void test_make_with_filter(
         skiatest::Reporter* reporter,
         const std::function<sk_sp<SkSurface>(int width, int height)>& createSurface,
@@ -5,6 +5,7 @@
  * found in the LICENSE file.
  */
 
+#include "include/codec/SkCodec.h"
 #include "include/core/SkAlphaType.h"
 #include "include/core/SkBitmap.h"
 #include "include/core/SkBlendMode.h"
@@ -15,6 +16,7 @@
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
 #include "include/core/SkDataTable.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageGenerator.h"
 #include "include/core/SkImageInfo.h"
@@ -1497,6 +1499,58 @@ DEF_TEST(ImageScalePixels, reporter) {
     test_scale_pixels(reporter, codecImage.get(), pmRed);
 }
 
+DEF_TEST(PixmapResamplePixels, reporter) {
+    SkBitmap gradient;
+    gradient.allocN32Pixels(300, 200);
+    for (int y = 0; y < gradient.height(); ++y) {
+        for (int x = 0; x < gradient.width(); ++x) {
+            *gradient.getAddr32(x, y) = SkPackARGB32(0xFF, x * 255 / 299, y * 255 / 199, 0x40);
+        }
+    }
+    SkBitmap solid;
+    solid.allocN32Pixels(300, 200);
+    solid.eraseColor(0x80402010);
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(2);
+    for (auto filter : {SkPixmap::ResampleFilter::kMitchell, SkPixmap::ResampleFilter::kLanczos3}) {
+        for (bool linear : {false, true}) {
+            for (SkISize size : {SkISize{37, 23}, SkISize{150, 100}, SkISize{451, 301}}) {
+                // A solid color stays the same, whatever the filter and scale.
+                SkBitmap dst;
+                dst.allocPixels(SkImageInfo::Make(size, kRGBA_F16_SkColorType,
+                                                  kUnpremul_SkAlphaType));
+                REPORTER_ASSERT(reporter, solid.pixmap().resamplePixels(dst.pixmap(), filter,
+                                                                        linear));
+                for (SkIPoint p : {SkIPoint{0, 0}, {size.width() / 2, size.height() / 2},
+                                   {size.width() - 1, size.height() - 1}}) {
+                    REPORTER_ASSERT(reporter, dst.getColor(p.x(), p.y()) == 0x80402010);
+                }
+
+                // Splitting rows across an executor doesn't change the result.
+                SkBitmap inline_, threaded;
+                inline_.allocN32Pixels(size.width(), size.height());
+                threaded.allocN32Pixels(size.width(), size.height());
+                REPORTER_ASSERT(reporter, gradient.pixmap().resamplePixels(inline_.pixmap(),
+                                                                           filter, linear));
+                REPORTER_ASSERT(reporter, gradient.pixmap().resamplePixels(
+                                                  threaded.pixmap(), filter, linear,
+                                                  executor.get()));
+                REPORTER_ASSERT(reporter, !memcmp(inline_.getPixels(), threaded.getPixels(),
+                                                  inline_.computeByteSize()));
+
+                // The middle of the gradient lands in the middle of dst.
+                SkColor mid = inline_.getColor(size.width() / 2, size.height() / 2);
+                REPORTER_ASSERT(reporter, std::abs((int)SkColorGetR(mid) - 0x7F) <= 4);
+                REPORTER_ASSERT(reporter, std::abs((int)SkColorGetG(mid) - 0x7F) <= 4);
+            }
+        }
+    }
+
+    SkBitmap empty;
+    REPORTER_ASSERT(reporter, !gradient.pixmap().resamplePixels(
+                                      empty.pixmap(), SkPixmap::ResampleFilter::kMitchell));
+}
+
 DEF_GANESH_TEST_FOR_RENDERING_CONTEXTS(ImageScalePixels_Gpu,
                                        reporter,
                                        ctxInfo,
@@ -1552,6 +1606,55 @@ static sk_sp<SkImage> make_yuva_image(GrDirectContext* dContext) {
     return SkImages::TextureFromYUVAPixmaps(dContext, yuvaPixmaps);
 }
 
+// A lazy JPEG's YUVA planes may be decoded straight into a transfer buffer rather than uploaded
+// from CPU memory. Either way the image should match one made from the same planes.
+DEF_GANESH_TEST_FOR_RENDERING_CONTEXTS(ImageLazyYUVAPlanes_Gpu,
+                                       reporter,
+                                       ctxInfo,
+                                       CtsEnforcement::kNever) {
+    auto dContext = ctxInfo.directContext();
+    sk_sp<SkData> data = GetResourceAsData("images/mandrill_512_q075.jpg");
+    std::unique_ptr<SkCodec> codec = SkCodec::MakeFromData(data);
+    if (!codec) {
+        ERRORF(reporter, "Could not decode mandrill_512_q075.jpg");
+        return;
+    }
+    SkYUVAPixmapInfo yuvaPixmapInfo;
+    if (!codec->queryYUVAInfo(skgpu::ganesh::SupportedTextureFormats(*dContext), &yuvaPixmapInfo)) {
+        return;
+    }
+    SkYUVAPixmaps yuvaPixmaps = SkYUVAPixmaps::Allocate(yuvaPixmapInfo);
+    REPORTER_ASSERT(reporter, SkCodec::kSuccess == codec->getYUVAPlanes(yuvaPixmaps));
+    sk_sp<SkImage> expected = SkImages::TextureFromYUVAPixmaps(dContext, yuvaPixmaps);
+    if (!expected) {
+        return;
+    }
+
+#if GR_GPU_STATS
+    int transfers = dContext->priv().getGpu()->stats()->transfersToTexture();
+#endif
+    sk_sp<SkImage> actual =
+            SkImages::TextureFromImage(dContext, SkImages::DeferredFromEncodedData(data));
+    REPORTER_ASSERT(reporter, actual);
+#if GR_GPU_STATS
+    const GrCaps* caps = dContext->priv().caps();
+    if (caps->transferFromBufferToTextureSupport() &&
+        (caps->mapBufferFlags() & GrCaps::kCanMap_MapFlag)) {
+        REPORTER_ASSERT(reporter,
+                        dContext->priv().getGpu()->stats()->transfersToTexture() ==
+                                transfers + yuvaPixmaps.numPlanes());
+    }
+#endif
+
+    SkImageInfo info = expected->imageInfo().makeColorType(kRGBA_8888_SkColorType);
+    SkBitmap expectedBitmap, actualBitmap;
+    expectedBitmap.allocPixels(info);
+    actualBitmap.allocPixels(info);
+    REPORTER_ASSERT(reporter, expected->readPixels(dContext, expectedBitmap.pixmap(), 0, 0));
+    REPORTER_ASSERT(reporter, actual && actual->readPixels(dContext, actualBitmap.pixmap(), 0, 0));
+    REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(expectedBitmap, actualBitmap));
+}
+
 DEF_GANESH_TEST_FOR_ALL_CONTEXTS(ImageFlush, reporter, ctxInfo, CtsEnforcement::kApiLevel_T) {
     auto dContext = ctxInfo.directContext();
     auto ii = SkImageInfo::Make(10, 10, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
@@ -89,6 +89,9 @@ DEF_TEST(JSON_Parse, reporter) {
         { "[ \"1234567\" ]"              , "[\"1234567\"]" },
         { "[ \"12345678\" ]"             , "[\"12345678\"]" },
         { "[ \"123456789\" ]"            , "[\"123456789\"]" },
+        { "[ \"0123456789abcdefghij\" ]" , "[\"0123456789abcdefghij\"]" },
+        { "[ \"0123456789abcdef{}[]0123456789abcdef\" ]",
+          "[\"0123456789abcdef{}[]0123456789abcdef\"]" },
         { "[ null , true, false,0,12.8 ]", "[null,true,false,0,12.8]" },
 
         { "{}"                          , "{}" },
@@ -125,6 +128,8 @@ DEF_TEST(JSON_Parse, reporter) {
         {R"zzz(["\u1234"])zzz", "[\"\u1234\"]"},
 
         {R"zzz(["foo\"bar"])zzz"    , "[\"foo\"bar\"]"},
+        {R"zzz(["0123456789abcdefghij\"0123456789abcdefghij"])zzz",
+          "[\"0123456789abcdefghij\"0123456789abcdefghij\"]"},
         {R"zzz(["foo\\bar"])zzz"    , "[\"foo\\bar\"]"},
         {R"zzz(["foo\/bar"])zzz"    , "[\"foo/bar\"]" },
         {R"zzz(["foo\bbar"])zzz"    , "[\"foo\bbar\"]"},
@@ -459,6 +464,14 @@ DEF_TEST(JSON_ParseNumber, reporter) {
 
         { "20.001111814444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444444473",
           20.001f, 0.001f },
+
+        { "1e3"           ,          1000, 0 },
+        { "1E+3"          ,          1000, 0 },
+        { "-2.5e2"        ,          -250, 0 },
+        { "1.5e-5"        ,       1.5e-5f, 0 },
+        { "125e-3"        ,        0.125f, 0 },
+        { "7e-40"         ,        7e-40f, 0 },
+        { "12345678901e-5", 123456.78901f, 0 },
     };
 
     for (const auto& test : gTests) {
@@ -473,3 +486,24 @@ DEF_TEST(JSON_ParseNumber, reporter) {
         REPORTER_ASSERT(reporter, SkScalarNearlyEqual(**jnumber, test.value, test.tolerance));
     }
 }
+
+DEF_TEST(JSON_DOM_bake, reporter) {
+    static constexpr char json[] =
+        R"({ "k1": null, "k2": false, "k3": 42, "k4": 1.5, "k5": "short",
+             "k6": "a string long enough to be stored out of line",
+             "k7": [ 1, [ 2, [ 3, {} ] ], { "nested": [ true, "foo" ] } ], "": [] })";
+
+    const DOM dom(json, strlen(json));
+    const auto baked = dom.bake();
+    REPORTER_ASSERT(reporter, baked);
+
+    const DOM baked_dom(static_cast<const char*>(baked->data()), baked->size());
+    REPORTER_ASSERT(reporter, baked_dom.root().is<ObjectValue>());
+    REPORTER_ASSERT(reporter, baked_dom.root().toString().equals(dom.root().toString()));
+
+    // Truncated images are rejected.
+    for (size_t size = 0; size < baked->size(); size += 4) {
+        const DOM truncated_dom(static_cast<const char*>(baked->data()), size);
+        REPORTER_ASSERT(reporter, truncated_dom.root().is<NullValue>(), "size: %zu", size);
+    }
+}
@@ -10,7 +10,9 @@
 
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
+#include "include/core/SkData.h"
 #include "include/core/SkDocument.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
@@ -180,6 +182,82 @@ DEF_TEST(SkMultiPictureDocument_Serialize_and_deserialize, reporter) {
     }
 }
 
+// Test reading single pages, and writing and reading pages in parallel.
+DEF_TEST(SkMultiPictureDocument_ReadPage_and_executor, reporter) {
+    static const int NUM_FRAMES = 6;
+    static const int WIDTH = 128;
+    static const int HEIGHT = 96;
+
+    auto surface(SkSurfaces::Raster(SkImageInfo::MakeN32Premul(50, 50)));
+    surface->getCanvas()->clear(SK_ColorBLUE);
+    sk_sp<SkImage> image(surface->makeImageSnapshot());
+
+    SkPictureRecorder pr;
+    draw_basic(pr.beginRecording(100, 100), 7, image);
+    sk_sp<SkPicture> sub = pr.finishRecordingAsPicture();
+
+    // Without sharing procs, each page carries its own copy of the image, so the procs don't care
+    // which thread they're called on or in what order.
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(3);
+    SkDynamicMemoryWStream stream;
+    sk_sp<SkDocument> multipic =
+            SkMultiPictureDocument::Make(&stream, nullptr, nullptr, executor.get());
+
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(WIDTH, HEIGHT);
+    std::vector<sk_sp<SkImage>> expectedImages;
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        draw_advanced(multipic->beginPage(WIDTH, HEIGHT), i, image, sub);
+        multipic->endPage();
+        auto surf = SkSurfaces::Raster(info);
+        draw_advanced(surf->getCanvas(), i, image, sub);
+        expectedImages.push_back(surf->makeImageSnapshot());
+    }
+    multipic->close();
+    std::unique_ptr<SkStreamAsset> writtenStream = stream.detachAsStream();
+
+    auto check_page = [&](const SkDocumentPage& page, int i) {
+        REPORTER_ASSERT(reporter, page.fPicture, "Missing page %d", i);
+        if (!page.fPicture) {
+            return;
+        }
+        REPORTER_ASSERT(reporter, page.fSize == SkSize::Make(WIDTH, HEIGHT));
+        auto surf = SkSurfaces::Raster(info);
+        surf->getCanvas()->drawPicture(page.fPicture);
+        auto img = surf->makeImageSnapshot();
+        REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(img.get(), expectedImages[i].get()),
+                        "Page %d", i);
+    };
+
+    // Pages can be read in any order.
+    for (int i : {4, 0, 5, 2}) {
+        SkDocumentPage page;
+        REPORTER_ASSERT(reporter,
+                        SkMultiPictureDocument::ReadPage(writtenStream.get(), i, &page));
+        check_page(page, i);
+    }
+    SkDocumentPage page;
+    REPORTER_ASSERT(reporter,
+                    !SkMultiPictureDocument::ReadPage(writtenStream.get(), NUM_FRAMES, &page));
+    REPORTER_ASSERT(reporter, !SkMultiPictureDocument::ReadPage(writtenStream.get(), -1, &page));
+
+    int frame_count = SkMultiPictureDocument::ReadPageCount(writtenStream.get());
+    REPORTER_ASSERT(reporter, frame_count == NUM_FRAMES);
+    std::vector<SkDocumentPage> frames(frame_count);
+    REPORTER_ASSERT(reporter,
+                    SkMultiPictureDocument::Read(writtenStream.get(), frames.data(), frame_count,
+                                                 nullptr, executor.get()));
+    for (int i = 0; i < frame_count; i++) {
+        check_page(frames[i], i);
+    }
+
+    // A truncated document is rejected rather than read past its end.
+    sk_sp<SkData> truncated = SkData::MakeFromStream(writtenStream->duplicate().get(),
+                                                     writtenStream->getLength() - 8);
+    SkMemoryStream truncatedStream(truncated);
+    REPORTER_ASSERT(reporter, !SkMultiPictureDocument::Read(&truncatedStream, frames.data(),
+                                                           frame_count));
+}
+
 
 #if defined(SK_GANESH) && defined(SK_BUILD_FOR_ANDROID) && __ANDROID_API__ >= 26
 
@@ -11,6 +11,7 @@
 #include "include/core/SkDocument.h"
 #include "include/core/SkExecutor.h"
 #include "include/core/SkFont.h"
+#include "include/core/SkFontStyle.h"
 #include "include/core/SkImage.h" // IWYU pragma: keep
 #include "include/core/SkPaint.h"
 #include "include/core/SkRefCnt.h"
@@ -25,6 +26,7 @@
 #include <cstdio>
 #include <cstring>
 #include <memory>
+#include <string>
 
 static void test_empty(skiatest::Reporter* reporter) {
     SkDynamicMemoryWStream stream;
@@ -265,3 +267,109 @@ DEF_TEST(SkPDF_abort_jobs, rep) {
     doc->abort();
 }
 
+
+static int count_occurrences(const SkDynamicMemoryWStream& stream, const char* needle) {
+    std::string text(stream.bytesWritten(), '\0');
+    stream.copyTo(text.data());
+    int count = 0;
+    for (size_t i = text.find(needle); i != std::string::npos; i = text.find(needle, i + 1)) {
+        count++;
+    }
+    return count;
+}
+
+// With fStreamPages, every page object is written as soon as the page ends.
+DEF_TEST(SkPDF_stream_pages, r) {
+    REQUIRE_PDF_DOCUMENT(SkPDF_stream_pages, r);
+    SkDynamicMemoryWStream stream;
+    SkPDF::Metadata metadata;
+    metadata.fStreamPages = true;
+    auto doc = SkPDF::MakeDocument(&stream, metadata);
+
+    constexpr int kPageCount = 20;
+    for (int i = 0; i < kPageCount; ++i) {
+        doc->beginPage(612, 792)->drawColor(SkColorSetARGB(0xFF, 0x00, (uint8_t)(10 * i), 0x00));
+        doc->endPage();
+        REPORTER_ASSERT(r, count_occurrences(stream, "/Type /Page\n") == i + 1);
+    }
+    REPORTER_ASSERT(r, count_occurrences(stream, "/Type /Pages\n") == 0);
+    doc->close();
+
+    // Leaf parents of 8, 8 and 4 pages under one root.
+    REPORTER_ASSERT(r, count_occurrences(stream, "/Type /Page\n") == kPageCount);
+    REPORTER_ASSERT(r, count_occurrences(stream, "/Type /Pages\n") == 4);
+    REPORTER_ASSERT(r, count_occurrences(stream, "/Count 20\n") == 1);
+}
+
+// Fonts are subset on the executor, but still emitted the same way as without one.
+DEF_TEST(SkPDF_executor_fonts, r) {
+    REQUIRE_PDF_DOCUMENT(SkPDF_executor_fonts, r);
+    auto make_document = [](SkExecutor* executor, SkDynamicMemoryWStream* stream) {
+        SkPDF::Metadata metadata;
+        metadata.fExecutor = executor;
+        auto doc = SkPDF::MakeDocument(stream, metadata);
+        const char* names[] = {"serif", "sans-serif", "monospace"};
+        for (int i = 0; i < 6; ++i) {
+            SkFont font = ToolUtils::DefaultFont();
+            font.setTypeface(ToolUtils::CreatePortableTypeface(names[i % 3], SkFontStyle()));
+            doc->beginPage(612, 792)->drawString("Page of text", 20, 40, font, SkPaint());
+        }
+        doc->close();
+    };
+
+    SkDynamicMemoryWStream serial, threaded;
+    make_document(nullptr, &serial);
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    make_document(executor.get(), &threaded);
+
+    REPORTER_ASSERT(r, threaded.bytesWritten() > 0);
+    REPORTER_ASSERT(r, count_occurrences(serial, "/Type /Font\n") ==
+                       count_occurrences(threaded, "/Type /Font\n"));
+}
+
+// Documents sharing a cache reuse each other's images and font subsets, and come out the same.
+DEF_TEST(SkPDF_shared_cache, r) {
+    REQUIRE_PDF_DOCUMENT(SkPDF_shared_cache, r);
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(64, 64);
+    bitmap.eraseColor(0x804F9643);
+    sk_sp<SkImage> image = bitmap.asImage();
+    auto make_document = [&](sk_sp<SkPDF::SharedCache> cache, SkDynamicMemoryWStream* stream) {
+        SkPDF::Metadata metadata;
+        metadata.fSharedCache = std::move(cache);
+        auto doc = SkPDF::MakeDocument(stream, metadata);
+        SkCanvas* canvas = doc->beginPage(612, 792);
+        canvas->drawImage(image, 20, 60);
+        canvas->drawString("Shared", 20, 40, ToolUtils::DefaultPortableFont(), SkPaint());
+        doc->close();
+    };
+
+    SkDynamicMemoryWStream uncached, first, second;
+    make_document(nullptr, &uncached);
+    sk_sp<SkPDF::SharedCache> cache = SkPDF::SharedCache::Make(1 << 20);
+    make_document(cache, &first);
+    make_document(cache, &second);
+
+    REPORTER_ASSERT(r, uncached.bytesWritten() > 0);
+    REPORTER_ASSERT(r, first.bytesWritten() == uncached.bytesWritten());
+    REPORTER_ASSERT(r, second.bytesWritten() == uncached.bytesWritten());
+}
+
+// Images with different IDs but the same pixels share one XObject.
+DEF_TEST(SkPDF_image_dedup_by_content, r) {
+    REQUIRE_PDF_DOCUMENT(SkPDF_image_dedup_by_content, r);
+    SkBitmap a, b, c;
+    for (SkBitmap* bitmap : {&a, &b, &c}) {
+        bitmap->allocN32Pixels(64, 64);
+        bitmap->eraseColor(0xFF4F9643);
+    }
+    c.eraseColor(0xFFFF0000);
+    SkDynamicMemoryWStream stream;
+    auto doc = SkPDF::MakeDocument(&stream);
+    SkCanvas* canvas = doc->beginPage(612, 792);
+    canvas->drawImage(a.asImage(), 0, 0);
+    canvas->drawImage(b.asImage(), 100, 0);
+    canvas->drawImage(c.asImage(), 200, 0);
+    doc->close();
+    REPORTER_ASSERT(r, count_occurrences(stream, "/Subtype /Image") == 2);
+}
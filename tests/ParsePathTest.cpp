@@ -9,11 +9,14 @@
 #include "include/core/SkRect.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkString.h"
+#include "include/private/base/SkFloatBits.h"
+#include "include/utils/SkParse.h"
 #include "include/utils/SkParsePath.h"
 #include "tests/Test.h"
 
 #include <array>
 #include <cstddef>
+#include <cstdlib>
 
 static void test_to_from(skiatest::Reporter* reporter, const SkPath& path) {
     SkString str = SkParsePath::ToSVGString(path);
@@ -24,6 +27,7 @@ static void test_to_from(skiatest::Reporter* reporter, const SkPath& path) {
 
     SkString str2 = SkParsePath::ToSVGString(path2);
     REPORTER_ASSERT(reporter, str == str2);
+
 #if 0 // closed paths are not equal, the iter explicitly gives the closing
       // edge, even if it is not in the path.
     REPORTER_ASSERT(reporter, path == path2);
@@ -31,6 +35,19 @@ static void test_to_from(skiatest::Reporter* reporter, const SkPath& path) {
         SkDebugf("str1=%s\nstr2=%s\n", str.c_str(), str2.c_str());
     }
 #endif
+
+    // The compact encodings describe the same path in fewer bytes.
+    for (auto encoding : {SkParsePath::PathEncoding::Absolute,
+                          SkParsePath::PathEncoding::Relative}) {
+        SkString full = SkParsePath::ToSVGString(path, encoding),
+                 compact = SkParsePath::ToCompactSVGString(path, encoding);
+        REPORTER_ASSERT(reporter, compact.size() <= full.size());
+        SkPath fromFull, fromCompact;
+        REPORTER_ASSERT(reporter, SkParsePath::FromSVGString(full.c_str(), &fromFull));
+        REPORTER_ASSERT(reporter, SkParsePath::FromSVGString(compact.c_str(), &fromCompact));
+        REPORTER_ASSERT(reporter, SkParsePath::ToSVGString(fromFull) ==
+                                  SkParsePath::ToSVGString(fromCompact));
+    }
 }
 
 static struct {
@@ -127,3 +144,29 @@ DEF_TEST(ParsePathArcFlags, r) {
     // One for move, 2x per conic.
     REPORTER_ASSERT(r, path.countPoints() == 9);
 }
+
+DEF_TEST(ParsePath_numbers, r) {
+    // Whether or not a number takes the fast path, it should parse exactly as strtod would.
+    static const char* gNumbers[] = {
+        "0", "-0", "+1", "1.", ".5", "-.5", "007", "12.5000", "0.000001", "0.1", "-123.456",
+        "1e3", "1E-3", "2.5e+2", "1e22", "1e23", "1e-22", "1e-23", "0e30",
+        "123456789012345", "1234567890123456", "0.1234567890123456789",
+        "3.4028235e38", "3.4028236e38", "1.17549435e-38", "1.4e-45",
+        "1e", "1e+", "1.5.5", "1-2", "0x10", "inf",
+    };
+    for (const char* str : gNumbers) {
+        char* stop;
+        const float expected = static_cast<float>(strtod(str, &stop));
+
+        SkScalar value;
+        const char* end = SkParse::FindScalar(str, &value);
+        REPORTER_ASSERT(r, end == stop, "%s", str);
+        REPORTER_ASSERT(r, SkFloat2Bits(value) == SkFloat2Bits(expected), "%s", str);
+    }
+
+    SkPath path;
+    REPORTER_ASSERT(r, SkParsePath::FromSVGString("M1e1-.5L+2.5E-1.25", &path));
+    REPORTER_ASSERT(r, path.countPoints() == 2);
+    REPORTER_ASSERT(r, path.getPoint(0) == SkPoint::Make(10, -0.5f));
+    REPORTER_ASSERT(r, path.getPoint(1) == SkPoint::Make(0.25f, 0.25f));
+}
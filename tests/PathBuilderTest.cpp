@@ -416,3 +416,29 @@ DEF_TEST(SkPathBuilder_arcToPtPtRad_invalidInputsResultInALine, reporter) {
     test("radius is zero", {-3, 5}, {-7, 11}, 0, {-3, 5});
     test("second point equals previous point", {5, 4}, {0, 0}, 1, {5, 4});
 }
+
+DEF_TEST(SkPathBuilder_detachTrimsReserve, reporter) {
+    // Stream in far fewer points than estimated, then many more.
+    constexpr int kEstimate = 100000;
+    SkPathBuilder pb;
+    pb.incReserve(kEstimate);
+    pb.moveTo(0, 0);
+    for (int i = 1; i < 100; ++i) {
+        pb.lineTo(i, i & 1);
+    }
+    SkPath small = pb.detach();
+    REPORTER_ASSERT(reporter, small.countPoints() == 100);
+    REPORTER_ASSERT(reporter, small.approximateBytesUsed() < kEstimate * sizeof(SkPoint) / 10);
+
+    pb.incReserve(100);
+    pb.moveTo(0, 0);
+    for (int i = 1; i < kEstimate; ++i) {
+        pb.lineTo(i, i & 1);
+    }
+    SkPath large = pb.detach();
+    REPORTER_ASSERT(reporter, large.countPoints() == kEstimate);
+    REPORTER_ASSERT(reporter, large.getPoint(kEstimate - 1) == SkPoint::Make(kEstimate - 1, 1));
+    REPORTER_ASSERT(reporter, large.getBounds() == SkRect::MakeLTRB(0, 0, kEstimate - 1, 1));
+    REPORTER_ASSERT(reporter,
+                    large.approximateBytesUsed() < kEstimate * (sizeof(SkPoint) + 1) * 9 / 8 + 4096);
+}
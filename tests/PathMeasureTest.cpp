@@ -12,6 +12,7 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
 #include "include/core/SkTypes.h"
+#include "src/core/SkContourMeasureCache.h"
 #include "src/core/SkPathMeasurePriv.h"
 #include "src/core/SkPathPriv.h"
 #include "tests/Test.h"
@@ -356,3 +357,50 @@ DEF_TEST(contour_measure, reporter) {
 
     test_shrink(reporter);
 }
+
+DEF_TEST(ContourMeasureCache, reporter) {
+    SkPath path;
+    path.addCircle(0, 0, 100);
+    path.moveTo(300, 0).lineTo(400, 0);
+    path.addCircle(0, 0, 10);
+
+    auto contours = SkContourMeasureCache::FindOrMeasure(path, false);
+    REPORTER_ASSERT(reporter, contours->count() == 3);
+
+    // A copy of the path shares its generation ID, so it finds the same measurements...
+    SkPath copy = path;
+    REPORTER_ASSERT(reporter, SkContourMeasureCache::FindOrMeasure(copy, false) == contours);
+    // ... unless it's measured differently.
+    REPORTER_ASSERT(reporter, SkContourMeasureCache::FindOrMeasure(copy, true) != contours);
+
+    // The contours and where they start match measuring the path directly.
+    SkContourMeasureIter iter(path, false);
+    SkScalar start = 0;
+    for (int i = 0; i < contours->count(); ++i) {
+        sk_sp<SkContourMeasure> contour = iter.next();
+        REPORTER_ASSERT(reporter, contours->contour(i).length() == contour->length());
+        REPORTER_ASSERT(reporter, contours->contourStart(i) == start);
+        start += contour->length();
+    }
+    REPORTER_ASSERT(reporter, contours->length() == start);
+
+    // Distances find the contour they fall in.
+    const SkScalar line = contours->contourStart(1);
+    REPORTER_ASSERT(reporter, contours->findContour(0) == 0);
+    REPORTER_ASSERT(reporter, contours->findContour(line) == 1);
+    REPORTER_ASSERT(reporter, contours->findContour(line + 50) == 1);
+    REPORTER_ASSERT(reporter, contours->findContour(contours->length()) == 3);
+
+    // A range across contours picks up the end of one, and the start of the next.
+    SkPath dst;
+    REPORTER_ASSERT(reporter, contours->getSegments(line + 50, line + 150, &dst, true) == 2);
+    REPORTER_ASSERT(reporter, dst.getPoint(0) == SkPoint::Make(350, 0));
+    REPORTER_ASSERT(reporter, dst.getPoint(1) == SkPoint::Make(400, 0));
+    REPORTER_ASSERT(reporter, dst.countPoints() > 3);  // then a moveTo, and part of the circle
+
+    // Editing the path gives it a new generation ID, and so new measurements.
+    path.lineTo(500, 0);
+    auto edited = SkContourMeasureCache::FindOrMeasure(path, false);
+    REPORTER_ASSERT(reporter, edited != contours);
+    REPORTER_ASSERT(reporter, edited->length() > contours->length());
+}
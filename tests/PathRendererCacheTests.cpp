@@ -59,7 +59,8 @@ static void draw_path(GrRecordingContext* rContext,
                       skgpu::ganesh::PathRenderer* pr,
                       GrAAType aaType,
                       const GrStyle& style,
-                      float scaleX = 1.f) {
+                      float scaleX = 1.f,
+                      SkVector translate = {0, 0}) {
     GrPaint paint;
     paint.setXPFactory(GrPorterDuffXPFactory::Get(SkBlendMode::kSrc));
 
@@ -71,6 +72,7 @@ static void draw_path(GrRecordingContext* rContext,
     }
     SkMatrix matrix = SkMatrix::I();
     matrix.setScaleX(scaleX);
+    matrix.postTranslate(translate.fX, translate.fY);
     skgpu::ganesh::PathRenderer::DrawPathArgs args{rContext,
                                                    std::move(paint),
                                                    &GrUserStencilSettings::kUnused,
@@ -187,6 +189,65 @@ DEF_GANESH_TEST(TriangulatingPathRendererCacheTest,
     test_path(reporter, create_concave_path, createPR, kExpectedResources, false, GrAAType::kNone,
               std::move(style));
 }
+
+// Test that AA triangulations are shared by draws whose view matrices only differ by whole pixel
+// translations or small scale changes, and are invalidated when the path changes.
+DEF_GANESH_TEST(TriangulatingPathRendererAACacheTest,
+                reporter,
+                /* options */,
+                CtsEnforcement::kNever) {
+    sk_sp<GrDirectContext> dContext = GrDirectContext::MakeMock(nullptr);
+    dContext->setResourceCacheLimit(8000000);
+    GrResourceCache* cache = dContext->priv().getResourceCache();
+
+    auto sdc = skgpu::ganesh::SurfaceDrawContext::Make(dContext.get(),
+                                                       GrColorType::kRGBA_8888,
+                                                       nullptr,
+                                                       SkBackingFit::kApprox,
+                                                       {800, 800},
+                                                       SkSurfaceProps(),
+                                                       /*label=*/{},
+                                                       /* sampleCnt= */ 1,
+                                                       skgpu::Mipmapped::kNo,
+                                                       GrProtected::kNo,
+                                                       kTopLeft_GrSurfaceOrigin);
+    if (!sdc) {
+        return;
+    }
+
+    sk_sp<skgpu::ganesh::PathRenderer> pr(new skgpu::ganesh::TriangulatingPathRenderer());
+    SkPath path = create_concave_path();
+    GrStyle fill(SkStrokeRec::kFill_InitStyle);
+    auto draw = [&](float scaleX, SkVector translate) {
+        draw_path(dContext.get(), sdc.get(), path, pr.get(), GrAAType::kCoverage, fill, scaleX,
+                  translate);
+        dContext->flushAndSubmit();
+    };
+
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 0));
+
+    draw(1, {0, 0});
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 1));
+
+    // Whole pixel scrolls and a slight zoom reuse the triangulation.
+    draw(1, {37, 0});
+    draw(1, {5, 120});
+    draw(1.005f, {0, 0});
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 1));
+
+    // A bigger zoom or a subpixel offset needs a new one.
+    draw(2, {0, 0});
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 2));
+    draw(1, {0.125f, 0});
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 3));
+    draw(1, {10.125f, 0});
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 3));
+
+    // Changing the path invalidates all of them.
+    path.reset();
+    cache->purgeAsNeeded();
+    REPORTER_ASSERT(reporter, cache_non_scratch_resources_equals(cache, 0));
+}
 #endif
 
 // Test that deleting the original path invalidates the textures cached by the SW path renderer
@@ -36,6 +36,7 @@
 #include "include/private/base/SkFloatBits.h"
 #include "include/private/base/SkFloatingPoint.h"
 #include "include/private/base/SkMalloc.h"
+#include "include/private/base/SkTDArray.h"
 #include "include/private/base/SkTo.h"
 #include "include/utils/SkNullCanvas.h"
 #include "include/utils/SkParse.h"
@@ -5171,6 +5172,63 @@ DEF_TEST(PathRefSerialization, reporter) {
     }
 }
 
+DEF_TEST(PathCompactSerialization, reporter) {
+    SkPath conics;
+    conics.moveTo(1, 2).conicTo(1, 2, 3, 4, 0.5f).conicTo(-1e9f, 1e-9f, 3, 4, 5).close();
+    SkPath inverse = SkPath::Polygon({{0.25f, 7}, {100.5f, 7}, {50, -3000}}, true);
+    inverse.setFillType(SkPathFillType::kInverseEvenOdd);
+    SkPath mixed;
+    mixed.moveTo(-0.f, 0).quadTo(SK_ScalarMax, 1, SK_ScalarMin, 2).cubicTo(1, 2, 3, 4, 5, 6)
+         .moveTo(10, 10).lineTo(10, 11);
+    SkPath emptyEvenOdd;
+    emptyEvenOdd.setFillType(SkPathFillType::kEvenOdd);
+
+    const SkPath paths[] = {
+        SkPath(), emptyEvenOdd, conics, inverse, mixed,
+        SkPath::Oval(SkRect::MakeLTRB(1, 2, 30, 40), SkPathDirection::kCCW, 3),
+        SkPath::RRect(SkRRect::MakeRectXY(SkRect::MakeWH(50, 60), 5, 6)),
+    };
+
+    SkTDArray<uint8_t> data;
+    size_t legacyBytes = 0;
+    for (const SkPath& path : paths) {
+        SkPathPriv::WriteCompact(path, &data);
+        legacyBytes += path.writeToMemory(nullptr);
+    }
+    REPORTER_ASSERT(reporter, (size_t)data.size() < legacyBytes);
+
+    const uint8_t* src = data.begin();
+    for (const SkPath& path : paths) {
+        SkPath readBack;
+        src = SkPathPriv::ReadCompact(src, data.end(), &readBack);
+        REPORTER_ASSERT(reporter, src);
+        if (!src) {
+            return;
+        }
+        REPORTER_ASSERT(reporter, readBack == path);
+        // Bitwise, so -0 survives.
+        REPORTER_ASSERT(reporter, readBack.countPoints() == path.countPoints() &&
+                                  !memcmp(SkPathPriv::PointData(readBack),
+                                          SkPathPriv::PointData(path),
+                                          path.countPoints() * sizeof(SkPoint)));
+        REPORTER_ASSERT(reporter, readBack.isOval(nullptr) == path.isOval(nullptr));
+        REPORTER_ASSERT(reporter, readBack.isRRect(nullptr) == path.isRRect(nullptr));
+    }
+    REPORTER_ASSERT(reporter, src == data.end());
+
+    // Truncated data is rejected.
+    for (int size = 0; size < data.size(); ++size) {
+        const uint8_t* stop = data.begin() + size;
+        src = data.begin();
+        SkPath readBack;
+        while (src && src < stop) {
+            src = SkPathPriv::ReadCompact(src, stop, &readBack);
+        }
+        // We either stopped on a path boundary, or failed.
+        REPORTER_ASSERT(reporter, !src || src == stop);
+    }
+}
+
 DEF_TEST(NonFinitePathIteration, reporter) {
     SkPath path;
     path.moveTo(SK_ScalarInfinity, SK_ScalarInfinity);
@@ -5987,3 +6045,53 @@ DEF_TEST(path_walk_simple_edges_1154864, r) {
     paint.setAntiAlias(true);
     surface->getCanvas()->drawPath(path, paint);
 }
+
+DEF_TEST(path_large_polygon_analyses, r) {
+    // Enough points that convexity, direction and contains all take their vectorized paths.
+    constexpr int kCount = 257;
+    for (bool dented : {false, true}) {
+        for (SkPathDirection dir : {SkPathDirection::kCW, SkPathDirection::kCCW}) {
+            SkPathBuilder builder;
+            for (int i = 0; i < kCount; ++i) {
+                SkScalar angle = SK_ScalarPI * 2 * i / kCount;
+                if (dir == SkPathDirection::kCCW) {
+                    angle = -angle;
+                }
+                SkScalar radius = (dented && i == kCount / 2) ? 50 : 100;
+                SkPoint pt = {radius * SkScalarCos(angle), radius * SkScalarSin(angle)};
+                if (i == 0) {
+                    builder.moveTo(pt);
+                } else {
+                    builder.lineTo(pt);
+                }
+            }
+            SkPath path = builder.close().detach();
+            SkPath copy = path;
+
+            REPORTER_ASSERT(r, path.isConvex() == !dented);
+            REPORTER_ASSERT(r, SkPathPriv::ComputeFirstDirection(path) ==
+                               (SkPathFirstDirection)dir);
+
+            // The copy shares its points with 'path', and must agree with it whether or not the
+            // analyses were reused.
+            REPORTER_ASSERT(r, copy.isConvex() == !dented);
+            REPORTER_ASSERT(r, SkPathPriv::ComputeFirstDirection(copy) ==
+                               (SkPathFirstDirection)dir);
+            SkPathPriv::ForceComputeConvexity(copy);
+            REPORTER_ASSERT(r, copy.isConvex() == !dented);
+
+            // Editing the copy must discard the analyses cached with its points.
+            copy.setLastPt(0, 0);
+            SkPathPriv::ForceComputeConvexity(copy);
+            REPORTER_ASSERT(r, !copy.isConvex());
+            REPORTER_ASSERT(r, path.isConvex() == !dented);
+
+            REPORTER_ASSERT(r, path.contains(0, 0));
+            REPORTER_ASSERT(r, path.contains(90, 10));
+            REPORTER_ASSERT(r, !path.contains(101, 0));
+            REPORTER_ASSERT(r, !path.contains(-80, -80));
+            // On the edge between the first two points
+            REPORTER_ASSERT(r, path.contains(100, 0));
+        }
+    }
+}
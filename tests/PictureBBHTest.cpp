@@ -9,14 +9,20 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkColor.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPicture.h"
 #include "include/core/SkPictureRecorder.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
+#include "src/core/SkTiledPictureDraw.h"
 #include "tests/Test.h"
 
+#include <cstdlib>
+#include <memory>
+
 class PictureBBHTestBase {
 public:
     PictureBBHTestBase(int playbackWidth, int playbackHeight,
@@ -111,7 +117,8 @@ DEF_TEST(PictureNegativeSpace, r) {
             canvas->drawRect({-20,-20,-10,-10}, SkPaint{});
             canvas->restore();
         auto pic = recorder.finishRecordingAsPicture();
-        REPORTER_ASSERT(r, pic->approximateOpCount() == 5);
+        // The clipRect(cull) can't shrink the clip, so it's optimized away.
+        REPORTER_ASSERT(r, pic->approximateOpCount() == 4);
         REPORTER_ASSERT(r, pic->cullRect() == (SkRect{-20,-20,-10,-10}));
     }
 
@@ -121,7 +128,55 @@ DEF_TEST(PictureNegativeSpace, r) {
             canvas->drawRect({-20,-20,-10,-10}, SkPaint{});
             canvas->drawRect({-20,-20,-10,-10}, SkPaint{});
         auto pic = recorder.finishRecordingAsPicture();
-        REPORTER_ASSERT(r, pic->approximateOpCount() == 3);
+        REPORTER_ASSERT(r, pic->approximateOpCount() == 2);
         REPORTER_ASSERT(r, pic->cullRect() == (SkRect{-20,-20,-10,-10}));
     }
 }
+
+DEF_TEST(PictureTiledDraw, r) {
+    SkPictureRecorder recorder;
+    SkRTreeFactory factory;
+    SkCanvas* recording = recorder.beginRecording(SkRect::MakeWH(500, 400), &factory);
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    for (int i = 0; i < 50; ++i) {
+        paint.setColor(SkColorSetARGB(0xC0, i * 5, 255 - i * 5, i * 2));
+        recording->drawCircle(20 + i * 9, 30 + (i * 37) % 340, 8 + i % 13, paint);
+        recording->drawRect(SkRect::MakeXYWH(i * 10, i * 7, 45, 25), paint);
+    }
+    sk_sp<SkPicture> picture = recorder.finishRecordingAsPicture();
+
+    const SkMatrix matrix = SkMatrix::Translate(13, 7) * SkMatrix::Scale(1.25f, 1.25f);
+
+    SkBitmap expected;
+    expected.allocN32Pixels(640, 520);
+    expected.eraseColor(SK_ColorWHITE);
+    {
+        SkCanvas canvas(expected);
+        canvas.concat(matrix);
+        canvas.drawPicture(picture);
+    }
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkBitmap actual;
+    actual.allocN32Pixels(640, 520);
+    actual.eraseColor(SK_ColorWHITE);
+    REPORTER_ASSERT(r, SkTiledPictureDraw(picture.get(), matrix, actual.pixmap(), *executor,
+                                          nullptr, 96));
+
+    // Clipping antialiased edges against a tile can shift coverage slightly.
+    auto close = [](U8CPU a, U8CPU b) { return std::abs((int)a - (int)b) <= 2; };
+    int mismatches = 0;
+    for (int y = 0; y < expected.height(); ++y) {
+        for (int x = 0; x < expected.width(); ++x) {
+            SkColor e = expected.getColor(x, y),
+                    a = actual.getColor(x, y);
+            if (!close(SkColorGetR(e), SkColorGetR(a)) ||
+                !close(SkColorGetG(e), SkColorGetG(a)) ||
+                !close(SkColorGetB(e), SkColorGetB(a))) {
+                ++mismatches;
+            }
+        }
+    }
+    REPORTER_ASSERT(r, mismatches == 0, "%d pixels differ", mismatches);
+}
@@ -11,6 +11,8 @@
 #include "include/core/SkPaint.h"
 #include "include/core/SkPicture.h"
 #include "include/core/SkPictureRecorder.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkScalar.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkSurface.h"
@@ -117,3 +119,58 @@ DEF_TEST(PictureShader_caching2, reporter) {
     SkResourceCache::VisitAll(counter, &data);
     REPORTER_ASSERT(reporter, data.counter == 0);
 }
+
+// Check that small changes to the scale reuse the cached tile, and that zooming out reuses a
+// larger one.
+DEF_TEST(PictureShader_caching_scale, reporter) {
+    auto picture = []() {
+        SkPictureRecorder recorder;
+        recorder.beginRecording(100, 100)->drawColor(SK_ColorGREEN);
+        return recorder.finishRecordingAsPicture();
+    }();
+
+    struct Data {
+        uint64_t sharedID;
+        int counter;
+    } data = {
+        SkPicturePriv::MakeSharedID(picture->uniqueID()),
+        0,
+    };
+    auto counter = [](const SkResourceCache::Rec& rec, void* dataPtr) {
+        if (rec.getKey().getSharedID() == ((Data*)dataPtr)->sharedID) {
+            ((Data*)dataPtr)->counter += 1;
+        }
+    };
+
+    sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(100, 100));
+    auto draw = [&](SkScalar scale) {
+        SkPaint paint;
+        paint.setShader(picture->makeShader(SkTileMode::kRepeat, SkTileMode::kRepeat,
+                                            SkFilterMode::kLinear));
+        surface->getCanvas()->save();
+        surface->getCanvas()->scale(scale, scale);
+        surface->getCanvas()->drawPaint(paint);
+        surface->getCanvas()->restore();
+    };
+
+    // These all fall in the same quarter octave.
+    for (SkScalar scale : {1.05f, 1.1f, 1.12f, 1.15f}) {
+        draw(scale);
+    }
+    data.counter = 0;
+    SkResourceCache::VisitAll(counter, &data);
+    REPORTER_ASSERT(reporter, data.counter == 1);
+
+    // Zooming out adds an entry for the smaller scale, made from the larger tile.
+    draw(0.95f);
+    data.counter = 0;
+    SkResourceCache::VisitAll(counter, &data);
+    REPORTER_ASSERT(reporter, data.counter == 2);
+
+    SkPixmap pixels;
+    REPORTER_ASSERT(reporter, surface->peekPixels(&pixels));
+    REPORTER_ASSERT(reporter, pixels.getColor(50, 50) == SK_ColorGREEN);
+
+    picture.reset();
+    SkResourceCache::CheckMessages();
+}
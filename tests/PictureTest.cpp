@@ -11,6 +11,7 @@
 #include "include/core/SkClipOp.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkData.h"
+#include "include/core/SkDrawable.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkFontStyle.h"
 #include "include/core/SkImage.h" // IWYU pragma: keep
@@ -26,6 +27,7 @@
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkSamplingOptions.h"
 #include "include/core/SkScalar.h"
+#include "include/core/SkSerialProcs.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkTypeface.h"
 #include "include/core/SkTypes.h"
@@ -37,7 +39,12 @@
 #include "tools/fonts/FontToolUtils.h"
 
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
 class SkRRect;
@@ -793,6 +800,82 @@ DEF_TEST(Picture_empty_serial, reporter) {
     REPORTER_ASSERT(reporter, pic2);
 }
 
+namespace {
+// Serializes images as their raw N32 pixels, so the test does not depend on any codec.
+constexpr int kSharedImageSize = 16;
+
+sk_sp<SkData> serialize_pixels(SkImage* image, void*) {
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(kSharedImageSize, kSharedImageSize);
+    if (!image->readPixels(nullptr, bitmap.pixmap(), 0, 0)) {
+        return nullptr;
+    }
+    return SkData::MakeWithCopy(bitmap.getPixels(), bitmap.computeByteSize());
+}
+
+struct SharedDataContext {
+    const SkData* fSerialized;
+    int fImages = 0;
+    int fSharedImages = 0;
+};
+
+sk_sp<SkImage> deserialize_pixels(sk_sp<SkData> data, std::optional<SkAlphaType>, void* ctx) {
+    auto context = static_cast<SharedDataContext*>(ctx);
+    const uint8_t* begin = context->fSerialized->bytes();
+    const uint8_t* end = begin + context->fSerialized->size();
+    context->fImages += 1;
+    context->fSharedImages += (data->bytes() >= begin && data->bytes() + data->size() <= end);
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(kSharedImageSize, kSharedImageSize);
+    return SkImages::RasterFromData(info, std::move(data), info.minRowBytes());
+}
+}  // namespace
+
+DEF_TEST(Picture_MakeFromSharedData, r) {
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(kSharedImageSize, kSharedImageSize);
+    bitmap.eraseColor(SK_ColorBLUE);
+    bitmap.erase(SK_ColorRED, SkIRect::MakeWH(kSharedImageSize / 2, kSharedImageSize / 2));
+    sk_sp<SkImage> image = bitmap.asImage();
+
+    SkPictureRecorder recorder;
+    SkCanvas* canvas = recorder.beginRecording(64, 64);
+    canvas->drawImage(image, 4, 4);
+    canvas->drawImageRect(image, SkRect::MakeXYWH(24, 24, 32, 32), SkSamplingOptions());
+    canvas->drawPath(SkPath::Circle(40, 12, 8), SkPaint());
+    sk_sp<SkPicture> picture = recorder.finishRecordingAsPicture();
+
+    SkSerialProcs serialProcs;
+    serialProcs.fImageProc = serialize_pixels;
+    sk_sp<SkData> serialized = picture->serialize(&serialProcs);
+    REPORTER_ASSERT(r, serialized);
+
+    SharedDataContext context{serialized.get()};
+    SkDeserialProcs deserialProcs;
+    deserialProcs.fImageDataProc = deserialize_pixels;
+    deserialProcs.fImageCtx = &context;
+
+    sk_sp<SkPicture> copied = SkPicture::MakeFromData(serialized.get(), &deserialProcs);
+    REPORTER_ASSERT(r, copied);
+    REPORTER_ASSERT(r, context.fImages > 0 && context.fSharedImages == 0);
+
+    context.fImages = 0;
+    sk_sp<SkPicture> shared = SkPicture::MakeFromSharedData(serialized, &deserialProcs);
+    REPORTER_ASSERT(r, shared);
+    // The image's pixels point straight into the serialized data, which the image keeps alive.
+    REPORTER_ASSERT(r, context.fImages > 0 && context.fSharedImages == context.fImages);
+    REPORTER_ASSERT(r, !serialized->unique());
+
+    SkBitmap expected, actual;
+    expected.allocN32Pixels(64, 64);
+    actual.allocN32Pixels(64, 64);
+    expected.eraseColor(SK_ColorWHITE);
+    actual.eraseColor(SK_ColorWHITE);
+    SkCanvas(expected).drawPicture(copied);
+    SkCanvas(actual).drawPicture(shared);
+    REPORTER_ASSERT(r, !memcmp(expected.getPixels(), actual.getPixels(),
+                               expected.computeByteSize()));
+}
+
 
 DEF_TEST(Picture_drawsNothing, r) {
     // Tests that pic->cullRect().isEmpty() is a good way to test a picture
@@ -924,3 +1007,82 @@ DEF_TEST(Picture_nested_op_count, r) {
     check(make_pic(10, leaf1),  10,  10);
     check(make_pic(10, leaf10), 10, 100);
 }
+
+DEF_TEST(Picture_appendChildRecording, r) {
+    class RectDrawable final : public SkDrawable {
+    public:
+        explicit RectDrawable(SkColor color) : fColor(color) {}
+
+    private:
+        SkRect onGetBounds() override { return {0, 0, 10, 10}; }
+        void onDraw(SkCanvas* canvas) override {
+            SkPaint paint;
+            paint.setColor(fColor);
+            canvas->drawRect({0, 0, 10, 10}, paint);
+        }
+        SkColor fColor;
+    };
+    sk_sp<SkDrawable> red  = sk_make_sp<RectDrawable>(SK_ColorRED),
+                      blue = sk_make_sp<RectDrawable>(SK_ColorBLUE);
+
+    // The child leaves a save open, and replaces the matrix.
+    auto draw_child = [&](SkCanvas* c) {
+        SkPaint paint;
+        paint.setColor(SK_ColorGREEN);
+        c->save();
+        c->clipRect({0, 0, 40, 40});
+        c->setMatrix(SkMatrix::Scale(2, 2));
+        c->drawRect({5, 5, 30, 30}, paint);
+        c->drawDrawable(blue.get(), 20, 0);
+    };
+    auto draw_parent = [&](SkCanvas* c, const std::function<void(SkCanvas*)>& child) {
+        c->drawDrawable(red.get());
+        c->translate(10, 20);
+        child(c);
+        // Nothing the child did should affect this.
+        c->drawRect({0, 0, 5, 5}, SkPaint{});
+        c->drawDrawable(red.get(), 50, 50);
+    };
+
+    // Record the child on another thread, then splice it in.
+    SkPictureRecorder parent, child;
+    draw_parent(parent.beginRecording({0, 0, 100, 100}), [&](SkCanvas*) {
+        std::thread thread([&] { draw_child(child.beginRecording({0, 0, 100, 100})); });
+        thread.join();
+        parent.appendChildRecording(&child);
+    });
+    REPORTER_ASSERT(r, !child.getRecordingCanvas());
+    sk_sp<SkPicture> spliced = parent.finishRecordingAsPicture();
+
+    // That should draw the same as nesting the child as a picture.
+    SkPictureRecorder expectedRecorder;
+    draw_parent(expectedRecorder.beginRecording({0, 0, 100, 100}), [&](SkCanvas* c) {
+        SkPictureRecorder nested;
+        draw_child(nested.beginRecording({0, 0, 100, 100}));
+        c->drawPicture(nested.finishRecordingAsPicture());
+    });
+    sk_sp<SkPicture> expected = expectedRecorder.finishRecordingAsPicture();
+
+    REPORTER_ASSERT(r, spliced->approximateOpCount(false) > expected->approximateOpCount(false));
+    REPORTER_ASSERT(r, spliced->approximateOpCount(true) >= expected->approximateOpCount(true));
+
+    SkBitmap actualBitmap, expectedBitmap;
+    actualBitmap.allocN32Pixels(100, 100);
+    expectedBitmap.allocN32Pixels(100, 100);
+    actualBitmap.eraseColor(SK_ColorWHITE);
+    expectedBitmap.eraseColor(SK_ColorWHITE);
+    SkCanvas(actualBitmap).drawPicture(spliced);
+    SkCanvas(expectedBitmap).drawPicture(expected);
+    for (int y = 0; y < 100; ++y) {
+        for (int x = 0; x < 100; ++x) {
+            REPORTER_ASSERT(r, actualBitmap.getColor(x, y) == expectedBitmap.getColor(x, y),
+                            "(%d, %d): %08x != %08x", x, y,
+                            actualBitmap.getColor(x, y), expectedBitmap.getColor(x, y));
+        }
+    }
+
+    // The child can record again.
+    SkCanvas* c = child.beginRecording({0, 0, 10, 10});
+    c->drawRect({0, 0, 5, 5}, SkPaint{});
+    REPORTER_ASSERT(r, child.finishRecordingAsPicture()->approximateOpCount() == 1);
+}
@@ -54,11 +54,20 @@ static bool verify_query(SkRect query, SkRect rects[], const std::vector<int>& f
 
 static void run_queries(skiatest::Reporter* reporter, SkRandom& rand, SkRect rects[],
                         const SkRTree& tree) {
+    SkRect queries[NUM_QUERIES];
     for (size_t i = 0; i < NUM_QUERIES; ++i) {
         std::vector<int> hits;
         SkRect query = random_rect(rand);
         tree.search(query, &hits);
         REPORTER_ASSERT(reporter, verify_query(query, rects, hits));
+        queries[i] = query;
+    }
+
+    // The batch search finds the same, across more queries than go down the tree together.
+    std::vector<int> hits[NUM_QUERIES];
+    tree.search(queries, hits);
+    for (size_t i = 0; i < NUM_QUERIES; ++i) {
+        REPORTER_ASSERT(reporter, verify_query(queries[i], rects, hits[i]));
     }
 }
 
@@ -46,6 +46,7 @@
 #include "src/gpu/ganesh/GrFragmentProcessor.h"
 #include "src/gpu/ganesh/GrImageInfo.h"
 #include "src/gpu/ganesh/GrPixmap.h"
+#include "src/gpu/ganesh/GrResourceCache.h"
 #include "src/gpu/ganesh/GrSamplerState.h"
 #include "src/gpu/ganesh/GrSurfaceProxy.h"
 #include "src/gpu/ganesh/SurfaceContext.h"
@@ -824,6 +825,62 @@ DEF_GANESH_TEST_FOR_RENDERING_CONTEXTS(ImageAsyncReadPixels_Renderable_BottomLef
                             reporter, ctxInfo);
 }
 
+static void recycle_readback_buffers(GrContextOptions* options) {
+    options->fRecycleReadbackTransferBuffers = true;
+}
+
+DEF_GANESH_TEST_FOR_CONTEXTS(AsyncReadPixelsRecycledTransferBuffers,
+                             skgpu::IsRenderingContext,
+                             reporter,
+                             ctxInfo,
+                             recycle_readback_buffers,
+                             CtsEnforcement::kNever) {
+    auto direct = ctxInfo.directContext();
+    if (!direct->priv().caps()->transferFromSurfaceToBufferSupport()) {
+        return;
+    }
+    const auto ii = SkImageInfo::Make(16, 16, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    auto surf = SkSurfaces::RenderTarget(direct, skgpu::Budgeted::kYes, ii);
+    if (!surf) {
+        return;
+    }
+    surf->getCanvas()->clear(SK_ColorRED);
+
+    auto read = [&]() {
+        AsyncContext context;
+        surf->asyncRescaleAndReadPixels(ii, ii.bounds(), SkImage::RescaleGamma::kSrc,
+                                        SkImage::RescaleMode::kNearest, async_callback, &context);
+        direct->submit();
+        while (!context.fCalled) {
+            direct->checkAsyncWorkCompletion();
+        }
+        return std::move(context.fResult);
+    };
+
+    auto first = read();
+    if (!first) {
+        ERRORF(reporter, "First read failed.");
+        return;
+    }
+    // Releasing the result sends the transfer buffer back to the context, which unmaps and
+    // unrefs it on the next flush.
+    first.reset();
+    direct->flushAndSubmit();
+    int resourceCount = direct->priv().getResourceCache()->getResourceCount();
+
+    auto second = read();
+    if (!second) {
+        ERRORF(reporter, "Second read failed.");
+        return;
+    }
+    REPORTER_ASSERT(reporter,
+                    direct->priv().getResourceCache()->getResourceCount() == resourceCount,
+                    "transfer buffer was not reused");
+    const auto* pixel = static_cast<const uint8_t*>(second->data(0));
+    REPORTER_ASSERT(reporter, pixel[0] == 0xFF && pixel[1] == 0 && pixel[2] == 0 &&
+                              pixel[3] == 0xFF);
+}
+
 DEF_GANESH_TEST(AsyncReadPixelsContextShutdown, reporter, options, CtsEnforcement::kApiLevel_T) {
     const auto ii = SkImageInfo::Make(10, 10, kRGBA_8888_SkColorType, kPremul_SkAlphaType,
                                       SkColorSpace::MakeSRGB());
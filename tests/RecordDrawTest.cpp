@@ -16,10 +16,12 @@
 #include "include/core/SkPicture.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkRegion.h"
 #include "include/core/SkSurface.h"
 #include "include/effects/SkImageFilters.h"
 #include "include/private/base/SkTemplates.h"
 #include "src/core/SkRecord.h"
+#include "src/core/SkRecordDamage.h"
 #include "src/core/SkRecordDraw.h"
 #include "src/core/SkRecorder.h"
 #include "src/core/SkRecords.h"
@@ -275,3 +277,58 @@ DEF_TEST(RecordDraw_drawImage, r){
 
     SkCanvasMock canvas(10, 10);
 }
+
+static void record_frame(SkRecord* record, SkColor middle, bool extraRect, SkScalar clipRight) {
+    SkRecorder recorder(record, W, H);
+    SkPaint paint;
+    recorder.drawRect(SkRect::MakeLTRB(10, 10, 40, 40), paint);
+
+    if (extraRect) {
+        recorder.drawRect(SkRect::MakeLTRB(300, 300, 320, 330), paint);
+    }
+
+    paint.setColor(middle);
+    recorder.drawRect(SkRect::MakeLTRB(100, 100, 200, 150), paint);
+
+    recorder.save();
+    recorder.clipRect(SkRect::MakeLTRB(500, 0, clipRight, H));
+    recorder.translate(500, 500);
+    paint.setColor(SK_ColorBLUE);
+    recorder.drawRect(SkRect::MakeWH(100, 100), paint);
+    recorder.restore();
+}
+
+DEF_TEST(RecordDraw_Damage, r) {
+    const SkRect cull = SkRect::MakeWH(W, H);
+
+    SkRecord before;
+    record_frame(&before, SK_ColorRED, false, 550);
+
+    {
+        SkRecord same;
+        record_frame(&same, SK_ColorRED, false, 550);
+        REPORTER_ASSERT(r, SkRecordDamage(cull, before, same).isEmpty());
+    }
+    {
+        // Only the recolored rect is damaged.
+        SkRecord recolored;
+        record_frame(&recolored, SK_ColorGREEN, false, 550);
+        SkRegion damage = SkRecordDamage(cull, before, recolored);
+        REPORTER_ASSERT(r, damage == SkRegion(SkIRect::MakeLTRB(100, 100, 200, 150)));
+    }
+    {
+        // An inserted op doesn't damage the unchanged ops after it.
+        SkRecord inserted;
+        record_frame(&inserted, SK_ColorRED, true, 550);
+        SkRegion damage = SkRecordDamage(cull, before, inserted);
+        REPORTER_ASSERT(r, damage == SkRegion(SkIRect::MakeLTRB(300, 300, 320, 330)));
+    }
+    {
+        // A changed clip damages everything drawn under it. Op bounds don't shrink to the clip,
+        // so that's the whole rect drawn under it.
+        SkRecord clipped;
+        record_frame(&clipped, SK_ColorRED, false, 580);
+        SkRegion damage = SkRecordDamage(cull, before, clipped);
+        REPORTER_ASSERT(r, damage == SkRegion(SkIRect::MakeLTRB(500, 500, 600, 600)));
+    }
+}
@@ -7,13 +7,16 @@
 
 #include "include/core/SkBlendMode.h"
 #include "include/core/SkCanvas.h"
+#include "include/core/SkClipOp.h"
 #include "include/core/SkColor.h"
 #include "include/core/SkColorFilter.h"
 #include "include/core/SkImageFilter.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
 #include "include/core/SkPicture.h"
 #include "include/core/SkPictureRecorder.h"
+#include "include/core/SkRRect.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
@@ -28,6 +31,8 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <type_traits>
 
 static const int W = 1920, H = 1080;
 
@@ -141,6 +146,128 @@ static void assert_savelayer_draw_restore(skiatest::Reporter* r,
     }
 }
 
+DEF_TEST(RecordOpts_ShareDuplicatePaths, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    // Equal paths built separately, one that differs, and an equal but volatile one.
+    auto make_path = [](SkScalar size) {
+        return SkPath().moveTo(0, 0).lineTo(size, 0).quadTo(size, size, 0, size).close();
+    };
+    SkPath volatilePath = make_path(10);
+    volatilePath.setIsVolatile(true);
+    recorder.drawPath(make_path(10), SkPaint());
+    recorder.clipPath(make_path(10));
+    recorder.drawPath(make_path(20), SkPaint());
+    recorder.drawPath(volatilePath, SkPaint());
+
+    auto genID = [&](int i) -> uint32_t {
+        return record.visit(i, [](const auto& op) -> uint32_t {
+            using T = std::decay_t<decltype(op)>;
+            if constexpr (std::is_same_v<T, SkRecords::DrawPath> ||
+                          std::is_same_v<T, SkRecords::ClipPath>) {
+                return op.path.getGenerationID();
+            }
+            return 0;
+        });
+    };
+    REPORTER_ASSERT(r, genID(0) != genID(1));
+
+    SkRecordShareDuplicatePaths(&record);
+    REPORTER_ASSERT(r, genID(0) == genID(1));
+    REPORTER_ASSERT(r, genID(0) != genID(2));
+    REPORTER_ASSERT(r, genID(0) != genID(3));
+    REPORTER_ASSERT(r, 3 == count_instances_of_type<SkRecords::DrawPath>(record));
+}
+
+DEF_TEST(RecordOpts_CulledDraws, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    recorder.drawRect(SkRect::MakeXYWH(W + 10, 0, 100, 100), SkPaint());  // Outside.
+    recorder.drawRect(SkRect::MakeXYWH(W - 10, 0, 100, 100), SkPaint());  // Straddles the edge.
+    recorder.save();
+        recorder.translate(-W, 0);
+        recorder.drawRect(SkRect::MakeXYWH(W + 10, 0, 100, 100), SkPaint());  // Moved inside.
+    recorder.restore();
+    recorder.drawAnnotation(SkRect::MakeXYWH(W + 10, 0, 100, 100), "key", nullptr);
+
+    SkRecordNoopCulledDraws(&record, SkRect::MakeWH(W, H));
+    assert_type<SkRecords::NoOp>(r, record, 0);
+    assert_type<SkRecords::DrawRect>(r, record, 1);
+    assert_type<SkRecords::DrawRect>(r, record, 4);
+    assert_type<SkRecords::DrawAnnotation>(r, record, 6);
+}
+
+DEF_TEST(RecordOpts_RedundantClips, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    recorder.clipRect(SkRect::MakeWH(W, H));                             // 0: the whole cull
+    recorder.clipRect(SkRect::MakeLTRB(10, 10, 100, 100));              // 1: shrinks the clip
+    recorder.clipRect(SkRect::MakeLTRB(5, 5, 200, 200));                // 2: contains it
+    recorder.save();                                                    // 3
+        recorder.scale(2, 2);                                           // 4
+        recorder.clipRect(SkRect::MakeLTRB(0, 0, 60, 60));              // 5: 0..120 contains it
+        recorder.clipRRect(SkRRect::MakeRectXY(SkRect::MakeWH(55, 55), 2, 2));  // 6: contains it
+        recorder.clipRect(SkRect::MakeLTRB(5.2f, 5.2f, 60, 60));        // 7: rounds to 10
+        recorder.clipRect(SkRect::MakeLTRB(5.2f, 5.2f, 60, 60), true);  // 8: partly covers 10
+        recorder.clipRect(SkRect::MakeLTRB(0, 0, 60, 60), SkClipOp::kDifference);  // 9
+    recorder.restore();                                                 // 10
+    recorder.clipRect(SkRect::MakeLTRB(20, 20, 30, 30));                // 11: shrinks the clip
+
+    SkRecordNoopRedundantClips(&record, SkRect::MakeWH(W, H));
+    for (int i : {0, 2, 5, 6, 7}) {
+        assert_type<SkRecords::NoOp>(r, record, i);
+    }
+    for (int i : {1, 8, 9, 11}) {
+        assert_type<SkRecords::ClipRect>(r, record, i);
+    }
+}
+
+DEF_TEST(RecordOpts_OccludedDraws, r) {
+    SkRecord record;
+    SkRecorder recorder(&record, W, H);
+
+    SkPaint translucent;
+    translucent.setAlpha(0x80);
+    SkPaint aa;
+    aa.setAntiAlias(true);
+
+    recorder.drawRect(SkRect::MakeLTRB(20, 20, 80, 80), SkPaint());    // 0: covered by 6
+    recorder.drawOval(SkRect::MakeLTRB(10, 10, 90, 90), aa);           // 1: covered by 6
+    recorder.save();                                                   // 2: covered by 6
+        recorder.clipRect(SkRect::MakeLTRB(0, 0, 50, 50), true);       // 3
+        recorder.drawRect(SkRect::MakeLTRB(10, 10, 60, 60), translucent);  // 4
+    recorder.restore();                                                // 5
+    recorder.drawRect(SkRect::MakeLTRB(0.5f, 0.5f, 100, 100), aa);     // 6
+    recorder.drawRect(SkRect::MakeLTRB(50, 50, 150, 150), SkPaint());  // 7: sticks out of 8
+    recorder.drawRect(SkRect::MakeLTRB(0, 0, 120, 120), translucent);  // 8: not opaque
+    recorder.drawRect(SkRect::MakeLTRB(200, 200, 300, 300), SkPaint());  // 9: behind a clip
+    recorder.clipRect(SkRect::MakeLTRB(0, 0, 500, 500));               // 10
+    recorder.drawRect(SkRect::MakeLTRB(0, 0, 400, 400), SkPaint());    // 11: covered by 12
+    recorder.drawPaint(SkPaint());                                     // 12
+
+    SkRecordNoopOccludedDraws(&record, SkRect::MakeWH(W, H));
+    for (int i : {0, 1, 2, 3, 4, 5, 11}) {
+        assert_type<SkRecords::NoOp>(r, record, i);
+    }
+    for (int i : {6, 7, 8, 9}) {
+        assert_type<SkRecords::DrawRect>(r, record, i);
+    }
+    assert_type<SkRecords::DrawPaint>(r, record, 12);
+
+    // Nothing is dropped under an anti-aliased clip, which would let it show along the edge.
+    SkRecord softRecord;
+    SkRecorder softRecorder(&softRecord, W, H);
+    softRecorder.clipRect(SkRect::MakeLTRB(0.5f, 0.5f, 500, 500), true);
+    softRecorder.drawRect(SkRect::MakeLTRB(0, 0, 400, 400), SkPaint());
+    softRecorder.drawPaint(SkPaint());
+
+    SkRecordNoopOccludedDraws(&softRecord, SkRect::MakeWH(W, H));
+    assert_type<SkRecords::DrawRect>(r, softRecord, 1);
+}
+
 DEF_TEST(RecordOpts_NoopSaveLayerDrawRestore, r) {
     SkRecord record;
     SkRecorder recorder(&record, W, H);
@@ -23,6 +23,8 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
+#include <vector>
 
 static void Union(SkRegion* rgn, const SkIRect& rect) {
     rgn->op(rect, SkRegion::kUnion_Op);
@@ -277,6 +279,37 @@ DEF_TEST(Region, reporter) {
     test_fromchrome(reporter);
 }
 
+DEF_TEST(Region_setRects, reporter) {
+    SkRandom rand;
+    for (int count : {2, 3, 17, 64, 300}) {
+        std::vector<SkIRect> rects(count);
+        for (int i = 0; i < 50; i++) {
+            // Snap to a coarse grid so rects share edges and abut each other, and leave some empty.
+            for (SkIRect& r : rects) {
+                r.setLTRB(rand.nextRangeU(0, 16) * 4, rand.nextRangeU(0, 16) * 4,
+                          rand.nextRangeU(0, 16) * 4, rand.nextRangeU(0, 16) * 4);
+                r.sort();
+            }
+            REPORTER_ASSERT(reporter, test_rects(rects.data(), count));
+        }
+    }
+
+    // A grid of abutting cells merges into a single rect.
+    std::vector<SkIRect> cells;
+    for (int y = 0; y < 8; y++) {
+        for (int x = 0; x < 8; x++) {
+            cells.push_back(SkIRect::MakeXYWH(x * 10, y * 10, 10, 10));
+        }
+    }
+    SkRegion rgn;
+    REPORTER_ASSERT(reporter, rgn.setRects(cells.data(), (int)cells.size()));
+    REPORTER_ASSERT(reporter, rgn.isRect() && rgn.getBounds() == SkIRect::MakeWH(80, 80));
+
+    const SkIRect empties[] = {SkIRect::MakeEmpty(), SkIRect::MakeLTRB(5, 5, 5, 10)};
+    REPORTER_ASSERT(reporter, !rgn.setRects(empties, std::size(empties)));
+    REPORTER_ASSERT(reporter, rgn.isEmpty());
+}
+
 // Test that writeToMemory reports the same number of bytes whether there was a
 // buffer to write to or not.
 static void test_write(const SkRegion& region, skiatest::Reporter* r) {
@@ -1527,6 +1527,50 @@ static void test_partial_purge(skiatest::Reporter* reporter) {
     }
 }
 
+static void test_memory_pressure(skiatest::Reporter* reporter) {
+    Mock mock(300);
+    GrResourceCache* cache = mock.cache();
+    GrGpu* gpu = mock.gpu();
+
+    skgpu::UniqueKey key1, key2;
+    make_unique_key<0>(&key1, 1);
+    make_unique_key<0>(&key2, 2);
+
+    // Evict a resource and recreate it on the next flush.
+    TestResource* evicted = new TestResource(gpu, /*label=*/{});
+    evicted->resourcePriv().setUniqueKey(key1);
+    evicted->unref();
+    cache->purgeUnlockedResources(GrPurgeResourceOptions::kAllResources);
+    REPORTER_ASSERT(reporter, !cache->hasUniqueKey(key1));
+    cache->didFlush();
+
+    TestResource* recreated = new TestResource(gpu, /*label=*/{});
+    recreated->resourcePriv().setUniqueKey(key1);
+    REPORTER_ASSERT(reporter, 1 == cache->numRecreatedAfterEviction());
+
+    // Neither of these have been recreated, and both were used more recently than 'recreated'.
+    TestResource* unique = new TestResource(gpu, /*label=*/{});
+    unique->resourcePriv().setUniqueKey(key2);
+    TestResource* scratch = TestResource::CreateScratch(
+            gpu, skgpu::Budgeted::kYes, TestResource::kA_SimulatedProperty);
+    recreated->unref();
+    unique->unref();
+    scratch->unref();
+    REPORTER_ASSERT(reporter, 3 == cache->getResourceCount());
+    REPORTER_ASSERT(reporter, 300 == cache->getBudgetedResourceBytes());
+
+    // Going down to half of the budget takes two resources. The scratch resource is the cheapest
+    // to recreate, and the recreated one is spared even though it is the least recently used.
+    cache->purgeForMemoryPressure(GrMemoryPressureLevel::kModerate);
+    REPORTER_ASSERT(reporter, 1 == cache->getResourceCount());
+    REPORTER_ASSERT(reporter, cache->hasUniqueKey(key1));
+    REPORTER_ASSERT(reporter, !cache->hasUniqueKey(key2));
+
+    cache->purgeForMemoryPressure(GrMemoryPressureLevel::kCritical);
+    REPORTER_ASSERT(reporter, 0 == cache->getResourceCount());
+    REPORTER_ASSERT(reporter, 0 == TestResource::NumAlive());
+}
+
 static void test_custom_data(skiatest::Reporter* reporter) {
     skgpu::UniqueKey key1, key2;
     make_unique_key<0>(&key1, 1);
@@ -1683,6 +1727,7 @@ DEF_GANESH_TEST(ResourceCacheMisc, reporter, /* options */, CtsEnforcement::kApi
     test_timestamp_wrap(reporter);
     test_time_purge(reporter);
     test_partial_purge(reporter);
+    test_memory_pressure(reporter);
     test_custom_data(reporter);
     test_abandoned(reporter);
     test_tags(reporter);
@@ -19,6 +19,7 @@
 #include "include/core/SkTextBlob.h"
 #include "include/core/SkTileMode.h"
 #include "include/effects/SkDashPathEffect.h"
+#include "include/effects/SkGradientShader.h"
 #include "include/private/base/SkTo.h"
 #include "include/svg/SkSVGCanvas.h"
 #include "include/utils/SkParse.h"
@@ -630,6 +631,65 @@ DEF_TEST(SVGDevice_relative_path_encoding, reporter) {
     REPORTER_ASSERT(reporter, !strcmp(d, "m100 50l100 0l0 100l-100 -100Z"));
 }
 
+DEF_TEST(SVGDevice_compact_path_encoding, reporter) {
+    SkDOM dom;
+    {
+        auto svgCanvas = MakeDOMCanvas(&dom, SkSVGCanvas::kRelativePathEncoding_Flag |
+                                             SkSVGCanvas::kCompactPathEncoding_Flag);
+        SkPath path;
+        path.moveTo(100, 50);
+        path.lineTo(200, 50);
+        path.lineTo(200, 150);
+        path.lineTo(199.5f, 150.5f);
+        path.close();
+
+        svgCanvas->drawPath(path, SkPaint());
+    }
+
+    const auto* rootElement = dom.finishParsing();
+    REPORTER_ASSERT(reporter, rootElement, "root element not found");
+    const auto* pathElement = dom.getFirstChild(rootElement, "path");
+    REPORTER_ASSERT(reporter, pathElement, "path element not found");
+    const auto* d = dom.findAttr(pathElement, "d");
+    REPORTER_ASSERT(reporter, !strcmp(d, "m100 50 100 0 0 100-.5.5-99.5-100.5Z"));
+}
+
+DEF_TEST(SVGDevice_deduplicate_resources, reporter) {
+    SkDOM dom;
+    {
+        auto svgCanvas = MakeDOMCanvas(&dom, SkSVGCanvas::kDeduplicateResources_Flag);
+        SkPath path;
+        path.moveTo(10, 10);
+        path.lineTo(90, 10);
+        path.lineTo(50, 90);
+        path.close();
+        const SkPoint pts[] = {{0, 0}, {100, 0}};
+        const SkColor colors[] = {SK_ColorRED, SK_ColorBLUE};
+
+        for (int i = 0; i < 3; ++i) {
+            SkPaint paint;
+            paint.setShader(
+                    SkGradientShader::MakeLinear(pts, colors, nullptr, 2, SkTileMode::kClamp));
+            svgCanvas->drawPath(path, paint);
+        }
+    }
+
+    const auto* rootElement = dom.finishParsing();
+    REPORTER_ASSERT(reporter, rootElement, "root element not found");
+    auto count = [&](const char* name) {
+        int n = 0;
+        for (const auto* node = dom.getFirstChild(rootElement, name); node;
+             node = dom.getNextSibling(node, name)) {
+            n++;
+        }
+        return n;
+    };
+    // The first draw is written out; the second defines its path data to reuse.
+    REPORTER_ASSERT(reporter, count("path") == 1);
+    REPORTER_ASSERT(reporter, count("use") == 2);
+    REPORTER_ASSERT(reporter, count("defs") == 2);  // the gradient, then the path data
+}
+
 DEF_TEST(SVGDevice_color_shader, reporter) {
     SkDOM dom;
     {
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkData.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkSurface.h"
+#include "include/gpu/GpuTypes.h"
+#include "include/gpu/GrContextOptions.h"
+#include "include/gpu/GrDirectContext.h"
+#include "include/gpu/ganesh/SkSurfaceGanesh.h"
+#include "include/private/base/SkTArray.h"
+#include "tests/CtsEnforcement.h"
+#include "tests/Test.h"
+#include "tools/gpu/ContextType.h"
+#include "tools/gpu/GrContextFactory.h"
+#include "tools/gpu/MemoryCache.h"
+
+using namespace skia_private;
+
+DEF_GANESH_TEST(ShaderManifest, reporter, baseOptions, CtsEnforcement::kNever) {
+    sk_gpu_test::MemoryCache memoryCache;
+    GrContextOptions options = baseOptions;
+    options.fPersistentCache = &memoryCache;
+    options.fShaderCacheStrategy = GrContextOptions::ShaderCacheStrategy::kSkSL;
+
+    // Record a few programs.
+    {
+        sk_gpu_test::GrContextFactory factory(options);
+        auto dContext = factory.get(skgpu::ContextType::kGL);
+        if (!dContext) {
+            return;
+        }
+        SkImageInfo ii = SkImageInfo::MakeN32Premul(64, 64);
+        sk_sp<SkSurface> surface = SkSurfaces::RenderTarget(dContext, skgpu::Budgeted::kNo, ii);
+        if (!surface) {
+            return;
+        }
+        SkPaint paint;
+        paint.setColor(SK_ColorRED);
+        surface->getCanvas()->drawRect(SkRect::MakeLTRB(1, 1, 40, 40), paint);
+        paint.setAntiAlias(true);
+        surface->getCanvas()->drawCircle(30, 30, 20, paint);
+        paint.setStyle(SkPaint::kStroke_Style);
+        paint.setStrokeWidth(3);
+        surface->getCanvas()->drawOval(SkRect::MakeLTRB(5, 10, 60, 50), paint);
+        dContext->flushAndSubmit(surface.get(), GrSyncCpu::kYes);
+    }
+
+    TArray<sk_sp<SkData>> keys, data;
+    memoryCache.foreach([&](sk_sp<const SkData> key, sk_sp<SkData> value, SkString, int) {
+        keys.push_back(SkData::MakeWithCopy(key->data(), key->size()));
+        data.push_back(value);
+    });
+    REPORTER_ASSERT(reporter, !keys.empty());
+
+    sk_sp<SkData> manifest = GrDirectContext::MakeShaderManifest(keys.data(), data.data(),
+                                                                 keys.size());
+    REPORTER_ASSERT(reporter, manifest);
+
+    // Warm up a fresh context, a couple of entries at a time.
+    options.fPersistentCache = nullptr;
+    sk_gpu_test::GrContextFactory factory(options);
+    auto dContext = factory.get(skgpu::ContextType::kGL);
+    if (!dContext) {
+        return;
+    }
+    int next = 0, slices = 0;
+    while (int visited = dContext->precompileShaders(*manifest, next, 2)) {
+        REPORTER_ASSERT(reporter, visited <= 2);
+        next += visited;
+        ++slices;
+    }
+    REPORTER_ASSERT(reporter, next == keys.size());
+    REPORTER_ASSERT(reporter, slices == (keys.size() + 1) / 2);
+
+    REPORTER_ASSERT(reporter, dContext->precompileShaders(*manifest, keys.size(), 2) == 0);
+    REPORTER_ASSERT(reporter, dContext->precompileShaders(*manifest, 0, 0) == 0);
+
+    static constexpr char kGarbage[] = "not a shader manifest";
+    sk_sp<SkData> garbage = SkData::MakeWithoutCopy(kGarbage, sizeof(kGarbage));
+    REPORTER_ASSERT(reporter, dContext->precompileShaders(*garbage, 0, 8) == 0);
+    REPORTER_ASSERT(reporter, dContext->precompileShaders(*SkData::MakeEmpty(), 0, 8) == 0);
+}
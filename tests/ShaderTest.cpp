@@ -30,10 +30,13 @@
 #include "include/effects/SkPerlinNoiseShader.h"
 #include "include/effects/SkRuntimeEffect.h"
 #include "include/private/base/SkAssert.h"
+#include "src/shaders/SkPerlinNoiseShaderImpl.h"
 #include "tests/CtsEnforcement.h"
 #include "tests/Test.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include <vector>
 
 #if defined(SK_GANESH) || defined(SK_GRAPHITE)
@@ -209,3 +212,171 @@ DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ShaderTestNestedBlendsGraphite, reporte
     test_nested_blends(reporter, surface.get());
 }
 #endif
+
+// Linear sampling with repeat and mirror tiling should match a clamped image that has the tiles
+// laid out explicitly.
+DEF_TEST(ImageShader_TiledBilerp, reporter) {
+    constexpr int kW = 5, kH = 3, kCopies = 9;
+    auto tile = [](SkTileMode mode, int i, int n) {
+        switch (mode) {
+            case SkTileMode::kRepeat: return ((i % n) + n) % n;
+            case SkTileMode::kMirror: {
+                int m = ((i % (2*n)) + 2*n) % (2*n);
+                return m < n ? m : 2*n - 1 - m;
+            }
+            default: return std::min(std::max(i, 0), n - 1);
+        }
+    };
+
+    SkBitmap src;
+    src.allocN32Pixels(kW, kH);
+    for (int y = 0; y < kH; ++y) {
+        for (int x = 0; x < kW; ++x) {
+            uint8_t a = x == 2 ? 0x80 : 0xFF;
+            *src.getAddr32(x, y) = SkPreMultiplyARGB(a, 40*x, 80*y, 255 - 30*x - 50*y);
+        }
+    }
+    src.setImmutable();
+
+    const SkTileMode modes[] = {SkTileMode::kClamp, SkTileMode::kRepeat, SkTileMode::kMirror};
+    for (SkTileMode tmx : modes)
+    for (SkTileMode tmy : modes) {
+        SkBitmap tiled;
+        tiled.allocN32Pixels(kW * kCopies, kH * kCopies);
+        for (int y = 0; y < tiled.height(); ++y) {
+            for (int x = 0; x < tiled.width(); ++x) {
+                *tiled.getAddr32(x, y) = *src.getAddr32(tile(tmx, x - kW*(kCopies/2), kW),
+                                                        tile(tmy, y - kH*(kCopies/2), kH));
+            }
+        }
+        tiled.setImmutable();
+
+        // Rotated and scaled, but the samples stay well inside the explicit tiles. The bit of
+        // perspective keeps this off the legacy affine-only shader path.
+        SkMatrix m = SkMatrix::Translate(12, 12);
+        m.preRotate(17);
+        m.preScale(2.3f, 2.3f);
+        m.setPerspX(0.001f);
+        const SkMatrix mTiled = SkMatrix::Concat(
+                m, SkMatrix::Translate(-kW*(kCopies/2), -kH*(kCopies/2)));
+        const SkSamplingOptions linear(SkFilterMode::kLinear);
+
+        SkBitmap actual, expected;
+        actual.allocN32Pixels(24, 24);
+        expected.allocN32Pixels(24, 24);
+        SkPaint paint;
+        paint.setShader(src.asImage()->makeShader(tmx, tmy, linear, &m));
+        SkCanvas(actual).drawPaint(paint);
+        paint.setShader(tiled.asImage()->makeShader(SkTileMode::kClamp, SkTileMode::kClamp,
+                                                    linear, &mTiled));
+        SkCanvas(expected).drawPaint(paint);
+
+        for (int y = 0; y < 24; ++y) {
+            for (int x = 0; x < 24; ++x) {
+                SkPMColor c = *actual.getAddr32(x, y),
+                          e = *expected.getAddr32(x, y);
+                bool close = true;
+                for (int shift : {0, 8, 16, 24}) {
+                    close &= std::abs((int)((c >> shift) & 0xFF) - (int)((e >> shift) & 0xFF)) <= 1;
+                }
+                REPORTER_ASSERT(reporter, close, "tile modes %d,%d at (%d, %d): %08x vs %08x",
+                                (int)tmx, (int)tmy, x, y, c, e);
+            }
+        }
+    }
+}
+
+// feTurbulence for one channel at one point, written out plainly from the SVG spec.
+static float reference_turbulence(const SkPerlinNoiseShader::PaintingData& data,
+                                  int channel, int octaves, bool fractal, bool stitch,
+                                  SkPoint p) {
+    const auto& tables = *data.fTables;
+    SkPerlinNoiseShader::StitchData stitchData = data.fStitchDataInit;
+    float x = p.fX * data.fBaseFrequency.fX,
+          y = p.fY * data.fBaseFrequency.fY,
+          sum = 0,
+          ratio = 1;
+    for (int octave = 0; octave < octaves; ++octave) {
+        const float tx = x + 4096, ty = y + 4096;
+        int bx0 = (int)std::floor(tx), by0 = (int)std::floor(ty), bx1 = bx0 + 1, by1 = by0 + 1;
+        const float rx0 = tx - bx0, ry0 = ty - by0;
+        if (stitch) {
+            if (bx0 >= stitchData.fWrapX) { bx0 -= stitchData.fWidth; }
+            if (bx1 >= stitchData.fWrapX) { bx1 -= stitchData.fWidth; }
+            if (by0 >= stitchData.fWrapY) { by0 -= stitchData.fHeight; }
+            if (by1 >= stitchData.fWrapY) { by1 -= stitchData.fHeight; }
+        }
+        const int i = tables.fLatticeSelector[bx0 & 255],
+                  j = tables.fLatticeSelector[bx1 & 255];
+        auto grad = [&](int b, float dx, float dy) {
+            const SkPoint& g = tables.fGradient[channel][b & 255];
+            return g.fX * dx + g.fY * dy;
+        };
+        const float sx = rx0 * rx0 * (3 - 2 * rx0),
+                    sy = ry0 * ry0 * (3 - 2 * ry0);
+        auto lerp = [](float a, float b, float t) { return a + (b - a) * t; };
+        const float a = lerp(grad(i + by0, rx0, ry0), grad(j + by0, rx0 - 1, ry0), sx),
+                    b = lerp(grad(i + by1, rx0, ry0 - 1), grad(j + by1, rx0 - 1, ry0 - 1), sx),
+                    noise = lerp(a, b, sy);
+        sum += (fractal ? noise : std::abs(noise)) / ratio;
+
+        x *= 2;
+        y *= 2;
+        ratio *= 2;
+        stitchData = SkPerlinNoiseShader::StitchData(stitchData.fWidth * 2.f,
+                                                     stitchData.fHeight * 2.f);
+    }
+    return std::clamp(fractal ? (sum + 1) / 2 : sum, 0.f, 1.f);
+}
+
+DEF_TEST(PerlinNoiseShader_Raster, reporter) {
+    const SkISize tile = {40, 30};
+    const SkMatrix ctm = SkMatrix::Translate(3.25f, -7.5f) * SkMatrix::Scale(1.5f, 0.75f);
+    for (bool fractal : {false, true}) {
+        for (const SkISize* tileSize : {(const SkISize*)nullptr, &tile}) {
+            constexpr int kOctaves = 3;
+            constexpr float kSeed = 7;
+            sk_sp<SkShader> shader =
+                    fractal ? SkShaders::MakeFractalNoise(0.05f, 0.08f, kOctaves, kSeed, tileSize)
+                            : SkShaders::MakeTurbulence(0.05f, 0.08f, kOctaves, kSeed, tileSize);
+            SkBitmap bm;
+            bm.allocN32Pixels(61, 47);
+            SkCanvas canvas(bm);
+            canvas.setMatrix(ctm);
+            SkPaint paint;
+            paint.setShader(shader);
+            canvas.drawPaint(paint);
+
+            const auto data = static_cast<const SkPerlinNoiseShader*>(shader.get())
+                                      ->getPaintingData(ctm);
+            for (int y = 0; y < bm.height(); ++y) {
+                for (int x = 0; x < bm.width(); ++x) {
+                    // The noise is in device space, offset by (1,1), and ignores all but the
+                    // scale and translation of the matrix.
+                    const SkPoint p = {std::round(x - ctm.getTranslateX() + 1),
+                                       std::round(y - ctm.getTranslateY() + 1)};
+                    float rgba[4];
+                    for (int c = 0; c < 4; ++c) {
+                        rgba[c] = reference_turbulence(*data, c, kOctaves, fractal,
+                                                       tileSize != nullptr, p);
+                    }
+                    const SkColor4f want = {rgba[0] * rgba[3], rgba[1] * rgba[3],
+                                            rgba[2] * rgba[3], rgba[3]},
+                                    got  = SkColor4f::FromBytes_RGBA(*bm.getAddr32(x, y));
+                    bool close = true;
+                    for (int c = 0; c < 4; ++c) {
+                        close &= std::abs(want[c] - got[c]) <= 1 / 255.f;
+                    }
+                    REPORTER_ASSERT(reporter, close, "fractal %d stitch %d at (%d, %d)",
+                                    fractal, tileSize != nullptr, x, y);
+                }
+            }
+        }
+    }
+
+    // Shaders with the same (truncated) seed share their tables.
+    REPORTER_ASSERT(reporter, SkPerlinNoiseShader::PermutationTables::Find(3) ==
+                              SkPerlinNoiseShader::PermutationTables::Find(3.5f));
+    REPORTER_ASSERT(reporter, SkPerlinNoiseShader::PermutationTables::Find(3) !=
+                              SkPerlinNoiseShader::PermutationTables::Find(4));
+}
@@ -192,6 +192,69 @@ DEF_TEST(SkGlyph_SendWithImage, reporter) {
     REPORTER_ASSERT(reporter, !dstGlyph->setImageHasBeenCalled());
 }
 
+DEF_TEST(SkGlyph_SendPackedImage, reporter) {
+    SkArenaAlloc alloc{256};
+    auto roundTrip = [&](const uint8_t (&imageData)[9][8], size_t* imageBytes) {
+        SkGlyph srcGlyph{SkPackedGlyphID{(SkGlyphID)12}};
+        SkGlyphTestPeer::SetGlyph1(&srcGlyph);
+        srcGlyph.setImage(&alloc, imageData);
+
+        SkBinaryWriteBuffer writeBuffer({});
+        srcGlyph.flattenMetrics(writeBuffer);
+        const size_t metricsBytes = writeBuffer.bytesWritten();
+        srcGlyph.flattenImage(writeBuffer);
+        *imageBytes = writeBuffer.bytesWritten() - metricsBytes;
+
+        sk_sp<SkData> data = writeBuffer.snapshotAsData();
+        SkReadBuffer readBuffer{data->data(), data->size()};
+        std::optional<SkGlyph> dstGlyph = SkGlyph::MakeFromBuffer(readBuffer);
+        REPORTER_ASSERT(reporter, dstGlyph.has_value());
+        dstGlyph->addImageFromBuffer(readBuffer, &alloc);
+        REPORTER_ASSERT(reporter, readBuffer.isValid());
+        const uint8_t* dstImage = (const uint8_t*)dstGlyph->image();
+        for (int y = 0; y < dstGlyph->height(); ++y) {
+            for (int x = 0; x < dstGlyph->width(); ++x) {
+                REPORTER_ASSERT(reporter,
+                                imageData[y][x] == dstImage[y * dstGlyph->rowBytes() + x]);
+            }
+        }
+    };
+
+    // A mask that is mostly runs is sent in much less than its 72 bytes...
+    uint8_t runs[9][8] = {};
+    runs[4][3] = runs[4][4] = 0x80;
+    size_t imageBytes;
+    roundTrip(runs, &imageBytes);
+    REPORTER_ASSERT(reporter, imageBytes < 32);
+
+    // ... while one without runs is sent as is, with just a flag in front.
+    uint8_t noise[9][8];
+    for (int i = 0; i < 72; ++i) {
+        noise[i / 8][i % 8] = (uint8_t)(i * 37);
+    }
+    roundTrip(noise, &imageBytes);
+    REPORTER_ASSERT(reporter, imageBytes == 2 * sizeof(uint32_t) + 72);
+
+    // Packed data that doesn't unpack to exactly the image's size is an error.
+    for (uint8_t badRun : {255, 128}) {
+        SkGlyph srcGlyph{SkPackedGlyphID{(SkGlyphID)12}};
+        SkGlyphTestPeer::SetGlyph1(&srcGlyph);
+        SkBinaryWriteBuffer writeBuffer({});
+        srcGlyph.flattenMetrics(writeBuffer);
+        writeBuffer.writeBool(true);
+        const uint8_t packed[] = {badRun, 0};
+        writeBuffer.writeByteArray(packed, sizeof(packed));
+
+        sk_sp<SkData> data = writeBuffer.snapshotAsData();
+        SkReadBuffer readBuffer{data->data(), data->size()};
+        std::optional<SkGlyph> dstGlyph = SkGlyph::MakeFromBuffer(readBuffer);
+        REPORTER_ASSERT(reporter, dstGlyph.has_value());
+        dstGlyph->addImageFromBuffer(readBuffer, &alloc);
+        REPORTER_ASSERT(reporter, !readBuffer.isValid());
+        REPORTER_ASSERT(reporter, !dstGlyph->setImageHasBeenCalled());
+    }
+}
+
 DEF_TEST(SkGlyph_SendWithPath, reporter) {
     SkArenaAlloc alloc{256};
     SkGlyph srcGlyph{SkPackedGlyphID{(SkGlyphID)12}};
@@ -45,6 +45,49 @@ DEF_TEST(SkRasterPipeline, r) {
     REPORTER_ASSERT(r, ((result >> 48) & 0xffff) == 0x3c00);
 }
 
+DEF_TEST(SkRasterPipeline_FusedStages, r) {
+    // Draw 50% transparent, unpremultiplied red over opaque blue.
+    uint32_t src = 0x800000ff,
+             dst = 0xffff0000;
+
+    SkRasterPipeline_MemoryCtx src_ctx = { &src, 0 },
+                               dst_ctx = { &dst, 0 };
+
+    SkRasterPipeline_<256> p;
+    p.append(SkRasterPipelineOp::load_8888,     &src_ctx);
+    p.append(SkRasterPipelineOp::premul);
+    p.append(SkRasterPipelineOp::load_8888_dst, &dst_ctx);
+    p.append(SkRasterPipelineOp::srcover);
+    p.append(SkRasterPipelineOp::store_8888,    &dst_ctx);
+
+    // The five stages should have been fused into two.
+    REPORTER_ASSERT(r, p.getNumStages() == 2);
+    const SkRasterPipeline::StageList* st = p.getStageList();
+    REPORTER_ASSERT(r, st->stage == SkRasterPipelineOp::srcover_rgba_8888);
+    REPORTER_ASSERT(r, st->ctx == &dst_ctx);
+    REPORTER_ASSERT(r, st->prev->stage == SkRasterPipelineOp::load_8888_premul);
+    REPORTER_ASSERT(r, st->prev->ctx == &src_ctx);
+    p.run(0,0,1,1);
+
+    // We should see half-intensity red over half-intensity blue, within rounding.
+    auto near = [](uint32_t c, int shift, int expected) {
+        return std::abs((int)((c >> shift) & 0xff) - expected) <= 1;
+    };
+    REPORTER_ASSERT(r, near(dst,  0, 0x80));
+    REPORTER_ASSERT(r, near(dst,  8, 0x00));
+    REPORTER_ASSERT(r, near(dst, 16, 0x7f));
+    REPORTER_ASSERT(r, near(dst, 24, 0xff));
+
+    // A store to different pixels than were loaded isn't fused.
+    uint32_t result;
+    SkRasterPipeline_MemoryCtx result_ctx = { &result, 0 };
+    p.reset();
+    p.append(SkRasterPipelineOp::load_8888_dst, &dst_ctx);
+    p.append(SkRasterPipelineOp::srcover);
+    p.append(SkRasterPipelineOp::store_8888,    &result_ctx);
+    REPORTER_ASSERT(r, p.getNumStages() == 3);
+}
+
 DEF_TEST(SkRasterPipeline_PackSmallContext, r) {
     struct PackableObject {
         std::array<uint8_t, sizeof(void*)> data;
@@ -1663,6 +1706,71 @@ DEF_TEST(SkRasterPipeline_FloatArithmeticWithNSlots, r) {
     }
 }
 
+DEF_TEST(SkRasterPipeline_ArithmeticFromMemory, r) {
+    // Allocate space for 5 dest and 5 source slots, and 5 scalars.
+    alignas(64) float slots[10 * SkRasterPipeline_kMaxStride_highp];
+    const float scalars[5] = {10.0f, 20.0f, 30.0f, 40.0f, 50.0f};
+    const int N = SkOpts::raster_pipeline_highp_stride;
+
+    struct ArithmeticOp {
+        SkRasterPipelineOp stage;
+        bool fromScalars;
+        std::function<float(float, float)> verify;
+    };
+
+    auto add = [](float a, float b) { return a + b; };
+    auto sub = [](float a, float b) { return a - b; };
+    auto mul = [](float a, float b) { return a * b; };
+    auto div = [](float a, float b) { return a / b; };
+
+    const ArithmeticOp kArithmeticOps[] = {
+        {SkRasterPipelineOp::add_n_floats_from_slots,   false, add},
+        {SkRasterPipelineOp::sub_n_floats_from_slots,   false, sub},
+        {SkRasterPipelineOp::mul_n_floats_from_slots,   false, mul},
+        {SkRasterPipelineOp::div_n_floats_from_slots,   false, div},
+        {SkRasterPipelineOp::add_n_floats_from_scalars, true,  add},
+        {SkRasterPipelineOp::sub_n_floats_from_scalars, true,  sub},
+        {SkRasterPipelineOp::mul_n_floats_from_scalars, true,  mul},
+        {SkRasterPipelineOp::div_n_floats_from_scalars, true,  div},
+    };
+
+    for (const ArithmeticOp& op : kArithmeticOps) {
+        for (int numSlotsAffected = 1; numSlotsAffected <= 5; ++numSlotsAffected) {
+            // Initialize the slot values to 1,2,3...
+            std::iota(&slots[0], &slots[10 * N], 1.0f);
+
+            // Run the arithmetic op over our data, reading the right side from the last five
+            // slots, which aren't adjacent to the affected ones unless all five are affected.
+            SkArenaAlloc alloc(/*firstHeapAllocation=*/256);
+            SkRasterPipeline p(&alloc);
+            SkRasterPipeline_MemoryBinaryOpCtx ctx;
+            ctx.dst = &slots[0];
+            ctx.src = op.fromScalars ? scalars : &slots[5 * N];
+            ctx.numSlots = numSlotsAffected;
+            p.append(op.stage, &ctx);
+            p.run(0,0,1,1);
+
+            // Verify that the affected slots now equal (1,2,3...) op the right side.
+            float leftValue = 1.0f;
+            float* destPtr = &slots[0];
+            for (int checkSlot = 0; checkSlot < 10; ++checkSlot) {
+                for (int checkLane = 0; checkLane < N; ++checkLane) {
+                    if (checkSlot < numSlotsAffected) {
+                        float rightValue = op.fromScalars ? scalars[checkSlot]
+                                                          : leftValue + float(5 * N);
+                        REPORTER_ASSERT(r, *destPtr == op.verify(leftValue, rightValue));
+                    } else {
+                        REPORTER_ASSERT(r, *destPtr == leftValue);
+                    }
+
+                    ++destPtr;
+                    leftValue += 1.0f;
+                }
+            }
+        }
+    }
+}
+
 DEF_TEST(SkRasterPipeline_FloatArithmeticWithHardcodedSlots, r) {
     // Allocate space for 5 dest and 5 source slots.
     alignas(64) float slots[10 * SkRasterPipeline_kMaxStride_highp];
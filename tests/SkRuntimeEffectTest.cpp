@@ -6,6 +6,7 @@
  */
 
 #include "include/core/SkAlphaType.h"
+#include "include/core/SkBitmap.h"
 #include "include/core/SkBlendMode.h"
 #include "include/core/SkBlender.h"
 #include "include/core/SkCanvas.h"
@@ -14,7 +15,9 @@
 #include "include/core/SkColorFilter.h"
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
+#include "include/core/SkGraphics.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkM44.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkRefCnt.h"
@@ -57,6 +60,7 @@
 
 #include <array>
 #include <cstdint>
+#include <cstdlib>
 #include <functional>
 #include <initializer_list>
 #include <memory>
@@ -106,6 +110,31 @@ DEF_TEST(SkRuntimeEffectInvalid_NoInVariables, r) {
     test_invalid_effect(r, "in half3x3 m;" EMPTY_MAIN, "'in'");
 }
 
+DEF_TEST(SkRuntimeEffectInvalid_SpecializedUniforms, r) {
+    test_invalid_effect(r, "layout(specialize) float f;" EMPTY_MAIN, "'uniform'");
+    test_invalid_effect(r, "layout(specialize) uniform float f[2];" EMPTY_MAIN, "arrays");
+    test_invalid_effect(r, "layout(specialize) uniform shader s;" EMPTY_MAIN, "'shader'");
+}
+
+DEF_TEST(SkRuntimeEffect_SpecializedUniforms, r) {
+    auto [effect, errorText] = SkRuntimeEffect::MakeForShader(SkString(
+            "layout(specialize) uniform int taps;"
+            "layout(color, specialize) uniform half4 tint;"
+            "uniform float scale;"
+            "half4 main(float2 p) {"
+            "    half4 c = half4(0);"
+            "    for (int i = 0; i < 8; ++i) {"
+            "        if (i < taps) { c += tint * scale; }"
+            "    }"
+            "    return c;"
+            "}"));
+    REPORTER_ASSERT(r, effect, "%s", errorText.c_str());
+    REPORTER_ASSERT(r, effect->findUniform("taps")->isSpecialized());
+    REPORTER_ASSERT(r, effect->findUniform("tint")->isSpecialized());
+    REPORTER_ASSERT(r, effect->findUniform("tint")->isColor());
+    REPORTER_ASSERT(r, !effect->findUniform("scale")->isSpecialized());
+}
+
 DEF_TEST(SkRuntimeEffectInvalid_UndefinedFunction, r) {
     test_invalid_effect(r, "half4 missing(); half4 main(float2 p) { return missing(); }",
                            "function 'half4 missing()' is not defined");
@@ -143,6 +172,51 @@ DEF_TEST(SkRuntimeEffect_DeadCodeEliminationStackOverflow, r) {
     REPORTER_ASSERT(r, effect, "%s", errorText.c_str());
 }
 
+DEF_TEST(SkRuntimeEffect_CacheSharesCompiledEffects, r) {
+    const char* kSkSL = "half4 main(float2 xy) { return half4(half(xy.x) * 0.25, 0, 0, 1); }";
+
+    // Making an effect from the same SkSL and options again returns the one already compiled.
+    auto [effect1, err1] = SkRuntimeEffect::MakeForShader(SkString(kSkSL));
+    auto [effect2, err2] = SkRuntimeEffect::MakeForShader(SkString(kSkSL));
+    REPORTER_ASSERT(r, effect1 && effect2, "%s%s", err1.c_str(), err2.c_str());
+    REPORTER_ASSERT(r, effect1 == effect2);
+
+    // Different options compile a separate effect.
+    auto [es3Effect, es3Err] = SkRuntimeEffect::MakeForShader(SkString(kSkSL),
+                                                              SkRuntimeEffectPriv::ES3Options());
+    REPORTER_ASSERT(r, es3Effect, "%s", es3Err.c_str());
+    REPORTER_ASSERT(r, es3Effect != effect1);
+
+    // So does a different kind of effect, even when the SkSL would be accepted by both.
+    const char* kFilterSkSL = "half4 main(half4 color) { return color.bgra; }";
+    auto [filterEffect, filterErr] = SkRuntimeEffect::MakeForColorFilter(SkString(kFilterSkSL));
+    REPORTER_ASSERT(r, filterEffect && filterEffect->allowColorFilter(), "%s", filterErr.c_str());
+
+    // Failures aren't cached, and still report their errors.
+    const char* kBadSkSL = "half4 main(float2 xy) { return missing; }";
+    for (int i = 0; i < 2; ++i) {
+        auto [badEffect, badErr] = SkRuntimeEffect::MakeForShader(SkString(kBadSkSL));
+        REPORTER_ASSERT(r, !badEffect && !badErr.isEmpty());
+    }
+
+    // With the cache turned off, every call compiles a new effect.
+    int prevLimit = SkGraphics::SetRuntimeEffectCacheCountLimit(0);
+    REPORTER_ASSERT(r, SkGraphics::GetRuntimeEffectCacheCountLimit() == 0);
+    auto [uncached1, unErr1] = SkRuntimeEffect::MakeForShader(SkString(kSkSL));
+    auto [uncached2, unErr2] = SkRuntimeEffect::MakeForShader(SkString(kSkSL));
+    REPORTER_ASSERT(r, uncached1 && uncached2 && uncached1 != uncached2);
+    SkGraphics::SetRuntimeEffectCacheCountLimit(prevLimit);
+}
+
+DEF_TEST(SkRuntimeEffect_PreloadSkSLModules, r) {
+    // Preloading can be repeated, and effects compile against the modules it loaded.
+    SkGraphics::PreloadSkSLModules();
+    SkGraphics::PreloadSkSLModules();
+    auto [effect, err] = SkRuntimeEffect::MakeForColorFilter(
+            SkString("half4 main(half4 color) { return saturate(color.gbra); }"));
+    REPORTER_ASSERT(r, effect, "%s", err.c_str());
+}
+
 DEF_TEST(SkRuntimeEffectCanDisableES2Restrictions, r) {
     auto test_valid_es3 = [](skiatest::Reporter* r, const char* sksl) {
         SkRuntimeEffect::Options opt = SkRuntimeEffectPriv::ES3Options();
@@ -1424,6 +1498,67 @@ DEF_TEST(SkRuntimeColorFilterFlags, r) {
                        "}");
 }
 
+DEF_TEST(SkRuntimeColorFilterAffine, r) {
+    auto isAffine = [&](const char* sksl) {
+        auto [effect, err] = SkRuntimeEffect::MakeForColorFilter(SkString{sksl});
+        REPORTER_ASSERT(r, effect, "%s: %s", sksl, err.c_str());
+        return effect && SkRuntimeEffectPriv::IsAffineColorFilter(*effect);
+    };
+
+    REPORTER_ASSERT(r, isAffine("half4 main(half4 c) { return c.bgra; }"));
+    REPORTER_ASSERT(r, isAffine("half4 main(half4 c) { return half4(1, 0, 0, 1); }"));
+    REPORTER_ASSERT(r, isAffine("uniform half4x4 m; uniform half4 t;"
+                                "half4 main(half4 c) { return m * c + t; }"));
+    REPORTER_ASSERT(r, isAffine("half4 main(half4 c) {"
+                                "    half l = dot(c.rgb, half3(0.2126, 0.7152, 0.0722));"
+                                "    return half4(half3(l), c.a);"
+                                "}"));
+    REPORTER_ASSERT(r, isAffine("uniform half t; uniform half4 k;"
+                                "half4 main(half4 c) { return t > 0.5 ? mix(c, c.bgra, t) : k; }"));
+
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { return c * c; }"));
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { return saturate(c); }"));
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { return c / c.a; }"));
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { return c.r > 0.5 ? c : half4(0); }"));
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { c.r = 0; return c; }"));
+    REPORTER_ASSERT(r, !isAffine("half4 main(half4 c) { return toLinearSrgb(c.rgb).rgb1; }"));
+
+    // Drawn as a color matrix, the filter gives the same results as the program.
+    auto [effect, err] = SkRuntimeEffect::MakeForColorFilter(SkString(
+            "uniform half4 scale;"
+            "half4 main(half4 c) { return c.gbra * scale + half4(0, 0, 0.25, 0); }"));
+    REPORTER_ASSERT(r, effect, "%s", err.c_str());
+    const SkV4 scale = {0.5f, 1, 0.5f, 1};
+    sk_sp<SkColorFilter> filter = effect->makeColorFilter(SkData::MakeWithCopy(&scale,
+                                                                               sizeof(scale)));
+    REPORTER_ASSERT(r, filter);
+
+    const SkColor4f expected = {0.2f, 0.6f, 0.35f, 1};
+    SkColor4f filtered = filter->filterColor4f({0.2f, 0.4f, 0.6f, 1}, nullptr, nullptr);
+    for (int i = 0; i < 4; ++i) {
+        REPORTER_ASSERT(r, SkScalarNearlyEqual(filtered[i], expected[i], 1 / 1024.0f),
+                        "channel %d: %f != %f", i, filtered[i], expected[i]);
+    }
+
+    // An 8888 surface draws the matrix in lowp.
+    sk_sp<SkSurface> surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(4, 4));
+    SkPaint paint;
+    paint.setColor(SkColor4f{0.2f, 0.4f, 0.6f, 1});
+    paint.setColorFilter(filter);
+    surface->getCanvas()->drawPaint(paint);
+
+    SkBitmap bitmap;
+    bitmap.allocPixels(surface->imageInfo());
+    REPORTER_ASSERT(r, surface->readPixels(bitmap, 0, 0));
+    SkColor actual = bitmap.getColor(2, 2),
+            want = expected.toSkColor();
+    REPORTER_ASSERT(r, SkColorGetA(actual) == SkColorGetA(want));
+    REPORTER_ASSERT(r, std::abs((int)SkColorGetR(actual) - (int)SkColorGetR(want)) <= 1 &&
+                       std::abs((int)SkColorGetG(actual) - (int)SkColorGetG(want)) <= 1 &&
+                       std::abs((int)SkColorGetB(actual) - (int)SkColorGetB(want)) <= 1,
+                    "%08x != %08x", actual, want);
+}
+
 DEF_TEST(SkRuntimeShaderSampleCoords, r) {
     // This test verifies that we detect calls to sample where the coords are the same as those
     // passed to main. In those cases, it's safe to turn the "explicit" sampling into "passthrough"
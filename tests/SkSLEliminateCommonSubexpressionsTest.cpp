@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/SkSLProgramKind.h"
+#include "src/sksl/SkSLProgramSettings.h"
+#include "src/sksl/ir/SkSLProgram.h"
+#include "tests/Test.h"
+
+#include <memory>
+#include <string>
+#include <string_view>
+
+static std::string optimize(skiatest::Reporter* r, const char* src) {
+    SkSL::Compiler compiler;
+    SkSL::ProgramSettings settings;
+    settings.fEliminateCommonSubexpressions = true;
+    settings.fHoistLoopInvariants = true;
+    std::unique_ptr<SkSL::Program> program =
+            compiler.convertProgram(SkSL::ProgramKind::kRuntimeShader, src, settings);
+    REPORTER_ASSERT(r, program, "%s", compiler.errorText().c_str());
+    return program ? program->description() : std::string();
+}
+
+static int count(const std::string& text, std::string_view pattern) {
+    int found = 0;
+    for (size_t pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + 1)) {
+        ++found;
+    }
+    return found;
+}
+
+DEF_TEST(SkSLEliminateCommonSubexpressions, r) {
+    // The second use reads the variable that the first one initializes.
+    std::string reused = optimize(r,
+            "uniform float a, b;"
+            "half4 main(float2 xy) {"
+                "float red = abs(a * b);"
+                "float green = abs(a * b) + xy.x;"
+                "return half4(half(red), half(green), 0, 1);"
+            "}");
+    REPORTER_ASSERT(r, count(reused, "a * b") == 1, "%s", reused.c_str());
+
+    // Repeated uses outside of a declaration are computed into a temporary.
+    std::string temp = optimize(r,
+            "uniform float a, b;"
+            "half4 main(float2 xy) {"
+                "return half4(half(sqrt(a + b) * xy.x), half(sqrt(a + b) * xy.y), 0, 1);"
+            "}");
+    REPORTER_ASSERT(r, count(temp, "sqrt(a + b)") == 1, "%s", temp.c_str());
+
+    // Expressions that read a variable written in between are left alone.
+    std::string written = optimize(r,
+            "uniform float a;"
+            "half4 main(float2 xy) {"
+                "float x = xy.x;"
+                "float red = abs(x * a);"
+                "x += 1;"
+                "float green = abs(x * a);"
+                "return half4(half(red), half(green), 0, 1);"
+            "}");
+    REPORTER_ASSERT(r, count(written, "x * a") == 2, "%s", written.c_str());
+}
+
+DEF_TEST(SkSLHoistLoopInvariants, r) {
+    std::string hoisted = optimize(r,
+            "uniform float a, b;"
+            "half4 main(float2 xy) {"
+                "float sum = 0;"
+                "for (int i = 0; i < 4; ++i) {"
+                    "sum += sin(a * b) + float(i);"
+                "}"
+                "return half4(half(sum));"
+            "}");
+    size_t invariant = hoisted.find("sin(a * b)");
+    REPORTER_ASSERT(r, invariant != std::string::npos && invariant < hoisted.find("for ("),
+                    "%s", hoisted.c_str());
+
+    // Values that change from one iteration to the next stay in the loop.
+    std::string variant = optimize(r,
+            "uniform float a;"
+            "half4 main(float2 xy) {"
+                "float sum = 0;"
+                "for (int i = 0; i < 4; ++i) {"
+                    "sum += sin(a * sum);"
+                "}"
+                "return half4(half(sum));"
+            "}");
+    size_t inLoop = variant.find("sin(a * sum)");
+    REPORTER_ASSERT(r, inLoop != std::string::npos && inLoop > variant.find("for ("),
+                    "%s", variant.c_str());
+}
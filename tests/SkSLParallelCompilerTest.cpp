@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkExecutor.h"
+#include "include/core/SkSpan.h"
+#include "src/sksl/SkSLCompiler.h"
+#include "src/sksl/SkSLParallelCompiler.h"
+#include "src/sksl/SkSLProgramKind.h"
+#include "src/sksl/SkSLProgramSettings.h"
+#include "src/sksl/ir/SkSLProgram.h"
+#include "tests/Test.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+static std::vector<SkSL::CompileJob> make_jobs(int count, int badJob) {
+    std::vector<SkSL::CompileJob> jobs;
+    for (int i = 0; i < count; ++i) {
+        std::string value = std::to_string(i);
+        std::string text = (i == badJob)
+                ? "half4 main(float2 xy) { return missing; }"
+                : "uniform half4 u" + value + "; half4 main(float2 xy) { return u" + value + "; }";
+        jobs.push_back({SkSL::ProgramKind::kRuntimeShader, std::move(text), {}});
+    }
+    return jobs;
+}
+
+static void check_results(skiatest::Reporter* r,
+                          const std::vector<SkSL::CompileResult>& results,
+                          int count,
+                          int badJob) {
+    REPORTER_ASSERT(r, (int)results.size() == count);
+    for (int i = 0; i < count; ++i) {
+        const SkSL::CompileResult& result = results[i];
+        if (i == badJob) {
+            REPORTER_ASSERT(r, !result.fProgram && !result.fErrors.empty());
+            continue;
+        }
+        REPORTER_ASSERT(r, result.fProgram, "%s", result.fErrors.c_str());
+        // Each result belongs to the job at the same index.
+        std::string uniform = "u" + std::to_string(i) + ";";
+        REPORTER_ASSERT(r, result.fProgram &&
+                           result.fProgram->description().find(uniform) != std::string::npos);
+    }
+}
+
+DEF_TEST(SkSLParallelCompiler, r) {
+    constexpr int kJobCount = 24;
+    constexpr int kBadJob = 7;
+    std::vector<SkSL::CompileJob> jobs = make_jobs(kJobCount, kBadJob);
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    std::atomic<int> finishedCount{0};
+    std::vector<SkSL::CompileResult> results = SkSL::ConvertPrograms(
+            executor.get(), /*caps=*/nullptr, SkSpan(jobs),
+            [&](size_t, SkSL::Compiler* compiler, SkSL::CompileResult*) {
+                REPORTER_ASSERT(r, compiler);
+                finishedCount.fetch_add(1);
+            });
+    check_results(r, results, kJobCount, kBadJob);
+    REPORTER_ASSERT(r, finishedCount.load() == kJobCount);
+
+    // Without an executor, the jobs are converted on the calling thread.
+    check_results(r,
+                  SkSL::ConvertPrograms(/*executor=*/nullptr, /*caps=*/nullptr, SkSpan(jobs)),
+                  kJobCount,
+                  kBadJob);
+}
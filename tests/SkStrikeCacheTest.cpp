@@ -5,21 +5,34 @@
  * found in the LICENSE file.
  */
 
+#include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkFont.h"
+#include "include/core/SkFontMgr.h"
 #include "include/core/SkFontStyle.h"
 #include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkRefCnt.h"
+#include "include/core/SkSpan.h"
+#include "include/core/SkStream.h"
 #include "include/core/SkSurfaceProps.h"
 #include "include/core/SkTypeface.h"
+#include "include/core/SkTypes.h"
+#include "src/core/SkGlyph.h"
 #include "src/core/SkScalerContext.h"
 #include "src/core/SkStrike.h"  // IWYU pragma: keep
 #include "src/core/SkStrikeCache.h"
 #include "src/core/SkStrikeSpec.h"
+#include "src/core/SkTaskGroup.h"
 #include "tests/Test.h"
 #include "tools/ToolUtils.h"
 #include "tools/fonts/FontToolUtils.h"
 
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <vector>
+
 DEF_TEST(SkStrikeCache_CachePurge, Reporter) {
     SkStrikeCache cache;
 
@@ -58,6 +71,151 @@ DEF_TEST(SkStrikeCache_CachePurge, Reporter) {
         REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == 0);
     }
     REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == 0);
+}
+
+DEF_TEST(SkStrikeCache_Threaded, Reporter) {
+    SkStrikeCache cache;
+
+    SkFont font = ToolUtils::DefaultPortableFont();
+    font.setEdging(SkFont::Edging::kAntiAlias);
+
+    static constexpr int kStrikeCount = 32;
+    std::vector<SkStrikeSpec> specs;
+    for (int i = 0; i < kStrikeCount; ++i) {
+        font.setSize(8 + i);
+        specs.push_back(SkStrikeSpec::MakeMask(
+                font, SkPaint(), SkSurfaceProps(0, kUnknown_SkPixelGeometry),
+                SkScalerContextFlags::kNone, SkMatrix::I()));
+    }
+
+    // Every strike spec is looked up from several threads at once; each must be created once.
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkTaskGroup tasks(*executor);
+    tasks.batch(kStrikeCount * 8, [&](int i) {
+        sk_sp<SkStrike> strike = specs[i % kStrikeCount].findOrCreateStrike(&cache);
+        REPORTER_ASSERT(Reporter, strike != nullptr);
+    });
+    tasks.wait();
+
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() == kStrikeCount);
+    REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() > 0);
+
+    // Lowering the count limit purges across all shards.
+    cache.setCacheCountLimit(kStrikeCount / 4);
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() <= kStrikeCount / 4);
+
+    cache.purgeAll();
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() == 0);
+    REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == 0);
+}
+
+DEF_TEST(SkStrikeCache_Snapshot, Reporter) {
+    // Restored strikes are keyed on the typeface the font manager deserializes. Some portable
+    // typefaces are aliases that deserialize to another instance, so start from one that
+    // round-trips to itself.
+    sk_sp<SkData> typefaceData = ToolUtils::DefaultPortableTypeface()->serialize();
+    SkMemoryStream typefaceStream{typefaceData};
+    SkFont font{SkTypeface::MakeDeserialize(&typefaceStream, ToolUtils::TestFontMgr())};
+    font.setEdging(SkFont::Edging::kAntiAlias);
+    font.setSize(24);
+    SkStrikeSpec strikeSpec = SkStrikeSpec::MakeMask(
+            font, SkPaint(), SkSurfaceProps(0, kUnknown_SkPixelGeometry),
+            SkScalerContextFlags::kNone, SkMatrix::I());
+
+    SkGlyphID glyphIDs[4];
+    font.textToGlyphs("Skia", 4, SkTextEncoding::kUTF8, glyphIDs, std::size(glyphIDs));
+    const SkPackedGlyphID packedIDs[] = {SkPackedGlyphID{glyphIDs[0]},
+                                         SkPackedGlyphID{glyphIDs[1]},
+                                         SkPackedGlyphID{glyphIDs[2]},
+                                         SkPackedGlyphID{glyphIDs[3]}};
+
+    SkStrikeCache source;
+    sk_sp<SkStrike> sourceStrike = strikeSpec.findOrCreateStrike(&source);
+    const SkGlyph* sourceGlyphs[4];
+    sourceStrike->prepareImages(packedIDs, sourceGlyphs);
+
+    sk_sp<SkData> snapshot = source.writeSnapshot();
+    REPORTER_ASSERT(Reporter, snapshot != nullptr && snapshot->size() > 0);
+
+    SkStrikeCache restored;
+    REPORTER_ASSERT(Reporter,
+                    restored.readSnapshot(snapshot->data(), snapshot->size(),
+                                          ToolUtils::TestFontMgr()) == 1);
+    REPORTER_ASSERT(Reporter, restored.getCacheCountUsed() == 1);
+    REPORTER_ASSERT(Reporter, restored.getTotalMemoryUsed() > 0);
+
+    // The restored glyphs match the ones they were written from.
+    sk_sp<SkStrike> restoredStrike = restored.findStrike(strikeSpec.descriptor());
+    REPORTER_ASSERT(Reporter, restoredStrike != nullptr);
+    if (restoredStrike) {
+        const SkGlyph* restoredGlyphs[4];
+        restoredStrike->prepareImages(packedIDs, restoredGlyphs);
+        for (int i = 0; i < 4; ++i) {
+            const SkGlyph* s = sourceGlyphs[i];
+            const SkGlyph* r = restoredGlyphs[i];
+            REPORTER_ASSERT(Reporter, s->width() == r->width() && s->height() == r->height());
+            REPORTER_ASSERT(Reporter, s->advanceX() == r->advanceX());
+            if (!s->isEmpty() && s->image() && r->image()) {
+                REPORTER_ASSERT(Reporter, !memcmp(s->image(), r->image(), s->imageSize()));
+            }
+        }
+    }
+
+    // Strikes that are already cached are left alone.
+    REPORTER_ASSERT(Reporter,
+                    restored.readSnapshot(snapshot->data(), snapshot->size(),
+                                          ToolUtils::TestFontMgr()) == 0);
+
+    // Anything that is not a snapshot is rejected.
+    const uint8_t garbage[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+    REPORTER_ASSERT(Reporter, restored.readSnapshot(garbage, sizeof(garbage),
+                                                    ToolUtils::TestFontMgr()) == -1);
+    REPORTER_ASSERT(Reporter,
+                    restored.readSnapshot(snapshot->data(), snapshot->size() / 2,
+                                          ToolUtils::TestFontMgr()) == -1);
+}
+
+DEF_TEST(SkStrikeCache_Prepopulate, Reporter) {
+    SkFont font = ToolUtils::DefaultPortableFont();
+    font.setEdging(SkFont::Edging::kAntiAlias);
+    font.setSubpixel(true);
+    font.setSize(12);
+
+    static constexpr char kText[] = "The quick brown fox jumps over the lazy dog.";
+    SkGlyphID glyphs[std::size(kText)];
+    const int glyphCount = font.textToGlyphs(kText, std::size(kText) - 1, SkTextEncoding::kUTF8,
+                                             glyphs, std::size(glyphs));
+    const SkSpan<const SkGlyphID> glyphSpan(glyphs, glyphCount);
+    const SkSurfaceProps props(0, kUnknown_SkPixelGeometry);
+    const SkMatrix matrix = SkMatrix::Scale(2, 2);
+
+    // The strike alone, for comparison.
+    size_t emptyStrikeMemory;
+    {
+        SkStrikeCache cache;
+        SkStrikeSpec::MakeMask(font, SkPaint(), props, SkScalerContextFlags::kNone, matrix)
+                .findOrCreateStrike(&cache);
+        emptyStrikeMemory = cache.getTotalMemoryUsed();
+    }
+
+    SkStrikeCache cache;
+    cache.prepopulate(font, glyphSpan, matrix, props, SkScalerContextFlags::kNone);
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() == 1);
+    SkStrikeSpec maskSpec =
+            SkStrikeSpec::MakeMask(font, SkPaint(), props, SkScalerContextFlags::kNone, matrix);
+    REPORTER_ASSERT(Reporter, cache.findStrike(maskSpec.descriptor()) != nullptr);
+    REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() > emptyStrikeMemory);
 
+    // Doing it again finds the same glyphs.
+    const size_t prepopulatedMemory = cache.getTotalMemoryUsed();
+    cache.prepopulate(font, glyphSpan, matrix, props, SkScalerContextFlags::kNone);
+    REPORTER_ASSERT(Reporter, cache.getTotalMemoryUsed() == prepopulatedMemory);
 
+    // Glyphs too large for masks go in a path strike.
+    font.setSize(512);
+    cache.prepopulate(font, glyphSpan, matrix, props, SkScalerContextFlags::kNone);
+    REPORTER_ASSERT(Reporter, cache.getCacheCountUsed() == 2);
+    auto [pathSpec, _] =
+            SkStrikeSpec::MakePath(font, SkPaint(), props, SkScalerContextFlags::kNone);
+    REPORTER_ASSERT(Reporter, cache.findStrike(pathSpec.descriptor()) != nullptr);
 }
@@ -679,6 +679,63 @@ DEF_TEST(FILEStreamWithOffset, r) {
     test_all(&stream2, true);
 }
 
+// SkFILEStream serves small reads from a read-ahead buffer, and large reads straight from the file.
+// Mixing the two with seeks and skips should read just what an SkMemoryStream would.
+DEF_TEST(FILEStreamMixedReads, r) {
+    SkString tmpDir = skiatest::GetTmpDir();
+    if (tmpDir.isEmpty()) {
+        return;
+    }
+    SkString path = SkOSPath::Join(tmpDir.c_str(), "mixed_reads_test");
+
+    SkRandom rand;
+    AutoTMalloc<uint8_t> content(MAX_SIZE);
+    for (size_t i = 0; i < MAX_SIZE; ++i) {
+        content[i] = rand.nextU();
+    }
+    {
+        SkFILEWStream writer(path.c_str());
+        if (!writer.isValid()) {
+            ERRORF(r, "Failed to create tmp file %s\n", path.c_str());
+            return;
+        }
+        // Lots of tiny writes, which SkFILEWStream buffers.
+        for (size_t i = 0; i < MAX_SIZE; i += 3) {
+            writer.write(content.get() + i, std::min<size_t>(3, MAX_SIZE - i));
+        }
+    }
+
+    SkFILEStream file(path.c_str());
+    SkMemoryStream memory(content.get(), MAX_SIZE, false);
+    REPORTER_ASSERT(r, file.getLength() == MAX_SIZE);
+
+    AutoTMalloc<uint8_t> fromFile(MAX_SIZE), fromMemory(MAX_SIZE);
+    for (int i = 0; i < 1000; ++i) {
+        switch (rand.nextULessThan(4)) {
+            case 0: {
+                const size_t position = rand.nextULessThan(MAX_SIZE + 1);
+                file.seek(position);
+                memory.seek(position);
+                break;
+            }
+            case 1: {
+                const size_t skip = rand.nextULessThan(1000);
+                REPORTER_ASSERT(r, file.skip(skip) == memory.skip(skip));
+                break;
+            }
+            default: {
+                const size_t size = rand.nextBool() ? rand.nextULessThan(64)
+                                                    : rand.nextULessThan(MAX_SIZE / 4);
+                const size_t bytesRead = file.read(fromFile.get(), size);
+                REPORTER_ASSERT(r, bytesRead == memory.read(fromMemory.get(), size));
+                REPORTER_ASSERT(r, !memcmp(fromFile.get(), fromMemory.get(), bytesRead));
+                break;
+            }
+        }
+        REPORTER_ASSERT(r, file.getPosition() == memory.getPosition());
+    }
+}
+
 DEF_TEST(RBuffer, reporter) {
     int32_t value = 0;
     SkRBuffer buffer(&value, 4);
@@ -14,6 +14,8 @@
 #include "include/core/SkStrokeRec.h"
 #include "include/private/base/SkFloatBits.h"
 #include "src/core/SkPathPriv.h"
+#include "src/core/SkStroke.h"
+#include "src/core/SkStrokeCache.h"
 #include "tests/Test.h"
 
 #include <array>
@@ -192,3 +194,35 @@ DEF_TEST(Stroke, reporter) {
     test_strokerec_equality(reporter);
     test_big_stroke(reporter);
 }
+
+DEF_TEST(Stroke_Cached, reporter) {
+    SkPath path;
+    path.moveTo(0, 0);
+    for (int i = 1; i <= 40; ++i) {
+        path.lineTo(10 * i, (i & 1) ? 30 : 0);
+    }
+
+    SkStroke stroker;
+    stroker.setWidth(4);
+    stroker.setJoin(SkPaint::kRound_Join);
+
+    SkPath first, second;
+    stroker.strokePath(path, &first);
+    stroker.strokePath(path, &second);
+    REPORTER_ASSERT(reporter, first == second);
+
+    SkPath cached;
+    REPORTER_ASSERT(reporter,
+                    SkStrokeCache::Find(path.getGenerationID(), stroker, &cached) && cached == first);
+
+    // Stroking it any other way isn't a hit.
+    stroker.setCap(SkPaint::kSquare_Cap);
+    REPORTER_ASSERT(reporter, !SkStrokeCache::Find(path.getGenerationID(), stroker, &cached));
+
+    // Nor is stroking a volatile path, or one that has changed.
+    SkPath changed = path;
+    changed.lineTo(0, 100);
+    changed.setIsVolatile(true);
+    stroker.strokePath(changed, &cached);
+    REPORTER_ASSERT(reporter, !SkStrokeCache::Find(changed.getGenerationID(), stroker, &cached));
+}
@@ -151,6 +151,45 @@ DEF_TEST(SwizzleOpts, r) {
     REPORTER_ASSERT(r, dst == 0xFA04ADCA);
 }
 
+// The vectorized 16-bit and palette swizzles handle blocks of up to 8 pixels, so check all the
+// ways a row can end against a pixel at a time.
+DEF_TEST(SwizzleOpts_16BitAndIndex, r) {
+    constexpr int kMaxCount = 37;
+    uint8_t src[kMaxCount * 8];
+    for (size_t i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 37 + 11);
+    }
+    uint32_t table[256];
+    for (int i = 0; i < 256; i++) {
+        table[i] = 0x01000193u * (uint32_t)i + 0x811C9DC5u;
+    }
+
+    for (int count = 0; count <= kMaxCount; count++) {
+        uint32_t rgba[kMaxCount], bgra[kMaxCount], rgb1[kMaxCount], bgr1[kMaxCount],
+                 indexed[kMaxCount];
+        SkOpts::RGBA16_to_RGBA(rgba, src, count);
+        SkOpts::RGBA16_to_BGRA(bgra, src, count);
+        SkOpts::RGB16_to_RGB1(rgb1, src, count);
+        SkOpts::RGB16_to_BGR1(bgr1, src, count);
+        SkOpts::index_to_8888(indexed, src, count, table);
+
+        for (int i = 0; i < count; i++) {
+            // The high byte of each big-endian component comes first.
+            const uint8_t* px16 = src + 8 * i;
+            REPORTER_ASSERT(r, rgba[i] == (uint32_t)(px16[6] << 24 | px16[4] << 16 |
+                                                     px16[2] <<  8 | px16[0]));
+            REPORTER_ASSERT(r, bgra[i] == (uint32_t)(px16[6] << 24 | px16[0] << 16 |
+                                                     px16[2] <<  8 | px16[4]));
+            const uint8_t* px48 = src + 6 * i;
+            REPORTER_ASSERT(r, rgb1[i] == (uint32_t)(0xFFu  << 24 | px48[4] << 16 |
+                                                     px48[2] <<  8 | px48[0]));
+            REPORTER_ASSERT(r, bgr1[i] == (uint32_t)(0xFFu  << 24 | px48[0] << 16 |
+                                                     px48[2] <<  8 | px48[4]));
+            REPORTER_ASSERT(r, indexed[i] == table[src[i]]);
+        }
+    }
+}
+
 DEF_TEST(PublicSwizzleOpts, r) {
     uint32_t dst, src;
 
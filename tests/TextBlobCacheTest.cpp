@@ -85,6 +85,12 @@ public:
         cache->fSizeBudget = budget;
         cache->internalCheckPurge();
     }
+
+    static int BlobCount(sktext::gpu::TextBlobRedrawCoordinator* cache, uint32_t blobID) {
+        SkAutoSpinlock lock{cache->fSpinLock};
+        auto* idEntry = cache->fBlobIDCache.find(blobID);
+        return idEntry ? idEntry->fBlobs.size() : 0;
+    }
 };
 
 // This test hammers the GPU textblobcache and font atlas
@@ -267,6 +273,36 @@ static sk_sp<SkTextBlob> make_blob() {
     return builder.make();
 }
 
+// While a blob's scale keeps changing, its direct masks are reused at nearby scales, and only
+// remade at the exact scale once it settles.
+DEF_GANESH_TEST_FOR_MOCK_CONTEXT(TextBlobScaleAnimation, reporter, ctxInfo) {
+    auto dContext = ctxInfo.directContext();
+    const SkImageInfo info =
+            SkImageInfo::Make(kScreenDim, kScreenDim, kN32_SkColorType, kPremul_SkAlphaType);
+    auto surface = SkSurfaces::RenderTarget(dContext, skgpu::Budgeted::kNo, info);
+    auto cache = dContext->priv().getTextBlobCache();
+    auto blob = make_blob();
+
+    auto draw_at_scale = [&](SkScalar scale) {
+        SkCanvas* canvas = surface->getCanvas();
+        canvas->save();
+        canvas->scale(scale, scale);
+        canvas->drawTextBlob(blob, 10, 30, SkPaint());
+        canvas->restore();
+        return GrTextBlobTestingPeer::BlobCount(cache, blob->uniqueID());
+    };
+
+    REPORTER_ASSERT(reporter, draw_at_scale(1.0f) == 1);
+    REPORTER_ASSERT(reporter, draw_at_scale(1.0f) == 1);
+    // Zooming: the masks made at 1.0 are close enough.
+    REPORTER_ASSERT(reporter, draw_at_scale(1.1f) == 1);
+    REPORTER_ASSERT(reporter, draw_at_scale(1.2f) == 1);
+    // Settled at 1.2, so make exact masks.
+    REPORTER_ASSERT(reporter, draw_at_scale(1.2f) == 2);
+    // Too far from either of the existing scales.
+    REPORTER_ASSERT(reporter, draw_at_scale(2.0f) == 3);
+}
+
 // Turned off to pass on android and ios devices, which were running out of memory..
 #if 0
 static sk_sp<SkTextBlob> make_large_blob() {
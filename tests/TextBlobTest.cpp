@@ -13,8 +13,10 @@
 #include "include/core/SkFontTypes.h"
 #include "include/core/SkImage.h"
 #include "include/core/SkImageInfo.h"
+#include "include/core/SkMatrix.h"
 #include "include/core/SkPaint.h"
 #include "include/core/SkPoint.h"
+#include "include/core/SkRSXform.h"
 #include "include/core/SkRect.h"
 #include "include/core/SkRefCnt.h"
 #include "include/core/SkScalar.h"
@@ -35,6 +37,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
 #include <string>
 
 using namespace skia_private;
@@ -464,6 +467,45 @@ DEF_TEST(TextBlob_serialize, reporter) {
     }
 }
 
+// Raster devices remember the glyph masks of blobs they've drawn; drawing a blob again, with the
+// same or a different paint or position, should look just like drawing it on a fresh surface.
+DEF_TEST(TextBlob_RasterRedraw, reporter) {
+    SkTextBlobBuilder builder;
+    add_run(&builder, "Hello", 10, 30, ToolUtils::DefaultPortableTypeface());
+    add_run(&builder, "World", 10, 60, ToolUtils::DefaultPortableTypeface());
+    sk_sp<SkTextBlob> small = builder.make();
+    SkFont font = ToolUtils::DefaultFont();
+    font.setSize(300);  // Too big for masks, so drawn as paths.
+    sk_sp<SkTextBlob> big = SkTextBlob::MakeFromString("O", font);
+
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(128, 96);
+    sk_sp<SkSurface> reused = SkSurfaces::Raster(info);
+
+    auto check = [&](const SkTextBlob* blob, SkPoint origin, const SkPaint& paint) {
+        sk_sp<SkSurface> fresh = SkSurfaces::Raster(info);
+        for (SkSurface* surface : {reused.get(), fresh.get()}) {
+            surface->getCanvas()->clear(SK_ColorWHITE);
+            surface->getCanvas()->drawTextBlob(blob, origin.x(), origin.y(), paint);
+        }
+        SkPixmap a, b;
+        REPORTER_ASSERT(reporter, reused->peekPixels(&a) && fresh->peekPixels(&b));
+        REPORTER_ASSERT(reporter, ToolUtils::equal_pixels(a, b));
+    };
+
+    SkPaint paint;
+    for (const SkTextBlob* blob : {small.get(), big.get()}) {
+        check(blob, {0, 0}, paint);
+        check(blob, {0, 0}, paint);
+        check(blob, {0.25f, 0.5f}, paint);
+        paint.setColor(SK_ColorBLUE);
+        check(blob, {0.25f, 0.5f}, paint);
+        paint.setStyle(SkPaint::kStroke_Style);
+        paint.setStrokeWidth(1);
+        check(blob, {0.25f, 0.5f}, paint);
+        paint = SkPaint();
+    }
+}
+
 DEF_TEST(TextBlob_MakeAsDrawText, reporter) {
     const char text[] = "Hello";
     auto blob = SkTextBlob::MakeFromString(text, ToolUtils::DefaultFont(), SkTextEncoding::kUTF8);
@@ -539,3 +581,38 @@ DEF_TEST(TextBlob_getIntercepts, reporter) {
     // raised 'y' should not intersect
     REPORTER_ASSERT(reporter, blobHighY->getIntercepts(bounds, nullptr) == 0);
 }
+
+DEF_TEST(TextBlob_RSXformBounds, reporter) {
+    const SkRect rects[] = {
+        SkRect::MakeLTRB(-1, -10, 7, 2),
+        SkRect::MakeLTRB(0, 0, 3, 4),
+        SkRect::MakeEmpty(),
+        SkRect::MakeLTRB(-5, -5, 5, 5),
+        SkRect::MakeLTRB(2, -8, 12, 1),
+    };
+    const SkRSXform xforms[] = {
+        SkRSXform::Make(1, 0, 10, 20),
+        SkRSXform::MakeFromRadians(2, SK_ScalarPI / 3, -4, 6, 0, 0),
+        SkRSXform::Make(0.5f, 0.5f, 100, -100),
+        SkRSXform::Make(-1, 0, 0, 0),
+        SkRSXform::MakeFromRadians(0.25f, -1, 30, 30, 1, 1),
+    };
+
+    SkRSXformBounds bounds;
+    SkRect expected = SkRect::MakeEmpty();
+    REPORTER_ASSERT(reporter, bounds.bounds().isEmpty());
+    for (size_t i = 0; i < std::size(xforms); ++i) {
+        bounds.join(xforms[i], rects[i]);
+        if (!rects[i].isEmpty()) {
+            expected.join(SkMatrix().setRSXform(xforms[i]).mapRect(rects[i]));
+        }
+
+        const SkRect actual = bounds.bounds();
+        const float tol = 1e-4f * std::max(expected.width(), expected.height());
+        REPORTER_ASSERT(reporter, SkScalarNearlyEqual(actual.fLeft,   expected.fLeft,   tol) &&
+                                  SkScalarNearlyEqual(actual.fTop,    expected.fTop,    tol) &&
+                                  SkScalarNearlyEqual(actual.fRight,  expected.fRight,  tol) &&
+                                  SkScalarNearlyEqual(actual.fBottom, expected.fBottom, tol),
+                        "xform %zu", i);
+    }
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkExecutor.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPoint.h"
+#include "include/core/SkRRect.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkSurfaceProps.h"
+#include "include/private/base/SkFloatingPoint.h"
+#include "src/core/SkThreadedBitmapDevice.h"
+#include "tests/Test.h"
+
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+
+static void draw_rects(SkCanvas* canvas) {
+    SkPaint paint;
+    canvas->drawColor(SK_ColorWHITE);
+    for (int i = 0; i < 40; ++i) {
+        paint.setColor(SkColorSetARGB(0x80, i * 6, 255 - i * 6, i * 3));
+        canvas->drawRect(SkRect::MakeXYWH(i * 17, i * 11, 300, 200), paint);
+    }
+    canvas->save();
+    canvas->clipRect(SkRect::MakeLTRB(100, 100, 600, 400));
+    paint.setColor(SK_ColorBLUE);
+    canvas->drawPaint(paint);
+    canvas->restore();
+}
+
+static void draw_paths(SkCanvas* canvas) {
+    SkPaint paint;
+    paint.setAntiAlias(true);
+    canvas->drawColor(SK_ColorWHITE);
+
+    SkPath star;
+    star.moveTo(400, 20);
+    for (int i = 1; i < 5; ++i) {
+        SkScalar angle = i * 4 * SK_ScalarPI / 5;
+        star.lineTo(400 + 350 * sk_float_sin(angle), 400 - 380 * sk_float_cos(angle));
+    }
+    star.close();
+
+    paint.setColor(SK_ColorRED);
+    canvas->drawPath(star, paint);
+
+    canvas->save();
+    canvas->rotate(15, 400, 400);
+    canvas->clipRRect(SkRRect::MakeRectXY(SkRect::MakeLTRB(150, 150, 650, 650), 60, 60), true);
+    paint.setColor(0x8000FF00);
+    canvas->drawOval(SkRect::MakeLTRB(100, 250, 700, 550), paint);
+    canvas->restore();
+
+    paint.setStyle(SkPaint::kStroke_Style);
+    paint.setStrokeWidth(9);
+    paint.setColor(SK_ColorBLACK);
+    canvas->drawRRect(SkRRect::MakeRectXY(SkRect::MakeLTRB(30, 30, 770, 770), 40, 40), paint);
+
+    const SkPoint pts[] = {{10, 790}, {790, 10}, {10, 10}, {790, 790}};
+    paint.setStrokeWidth(0);
+    canvas->drawPoints(SkCanvas::kLines_PointMode, std::size(pts), pts, paint);
+}
+
+static void check_matches(skiatest::Reporter* r,
+                          const std::function<void(SkCanvas*)>& draw,
+                          int tolerance) {
+    const SkImageInfo info = SkImageInfo::MakeN32Premul(800, 800);
+
+    SkBitmap expected;
+    expected.allocPixels(info);
+    {
+        SkCanvas canvas(expected);
+        draw(&canvas);
+    }
+
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
+    SkBitmap actual;
+    actual.allocPixels(info);
+    {
+        // Use tiles that don't evenly divide the bitmap, to exercise the partial edge tiles.
+        auto device = sk_make_sp<SkThreadedBitmapDevice>(actual, SkSurfaceProps(), *executor, 96);
+        SkCanvas canvas(device);
+        draw(&canvas);
+        REPORTER_ASSERT(r, device->queuedDrawCount() > 0);
+        device->flush();
+        REPORTER_ASSERT(r, device->queuedDrawCount() == 0);
+    }
+
+    int mismatches = 0;
+    for (int y = 0; y < info.height(); ++y) {
+        for (int x = 0; x < info.width(); ++x) {
+            SkColor e = expected.getColor(x, y),
+                    a = actual.getColor(x, y);
+            if (std::abs((int)SkColorGetA(e) - (int)SkColorGetA(a)) > tolerance ||
+                std::abs((int)SkColorGetR(e) - (int)SkColorGetR(a)) > tolerance ||
+                std::abs((int)SkColorGetG(e) - (int)SkColorGetG(a)) > tolerance ||
+                std::abs((int)SkColorGetB(e) - (int)SkColorGetB(a)) > tolerance) {
+                ++mismatches;
+            }
+        }
+    }
+    REPORTER_ASSERT(r, mismatches == 0, "%d pixels differ", mismatches);
+}
+
+DEF_TEST(ThreadedBitmapDevice_Rects, r) {
+    check_matches(r, draw_rects, 0);
+}
+
+DEF_TEST(ThreadedBitmapDevice_Paths, r) {
+    // Clipping antialiased edges against a tile can shift coverage slightly.
+    check_matches(r, draw_paths, 2);
+}
+
+DEF_TEST(ThreadedBitmapDevice_FlushOnRead, r) {
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(2);
+
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(300, 300);
+    auto device = sk_make_sp<SkThreadedBitmapDevice>(bitmap, SkSurfaceProps(), *executor);
+    SkCanvas canvas(device);
+
+    canvas.clear(SK_ColorGREEN);
+    REPORTER_ASSERT(r, device->queuedDrawCount() == 1);
+
+    SkBitmap readback;
+    readback.allocN32Pixels(1, 1);
+    REPORTER_ASSERT(r, canvas.readPixels(readback, 150, 150));
+    REPORTER_ASSERT(r, device->queuedDrawCount() == 0);
+    REPORTER_ASSERT(r, readback.getColor(0, 0) == SK_ColorGREEN);
+}
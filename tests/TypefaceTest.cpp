@@ -524,6 +524,68 @@ DEF_TEST(TypefaceCache, reporter) {
     REPORTER_ASSERT(reporter, t1->unique());
 }
 
+DEF_TEST(TypefaceCache_Hash, reporter) {
+    sk_sp<SkTypeface> t0(TestEmptyTypeface::Make());
+    sk_sp<SkTypeface> t1(TestEmptyTypeface::Make());
+    SkTypefaceCache cache;
+    cache.add(t0, 7);
+    cache.add(t1, 9);
+
+    // Only the typefaces with the same hash are offered to the proc.
+    int offered = 0;
+    REPORTER_ASSERT(reporter, !cache.findByHashProcAndRef(9, count_proc, &offered));
+    REPORTER_ASSERT(reporter, offered == 1);
+    offered = 0;
+    REPORTER_ASSERT(reporter, !cache.findByHashProcAndRef(8, count_proc, &offered));
+    REPORTER_ASSERT(reporter, offered == 0);
+    REPORTER_ASSERT(reporter, count(reporter, cache) == 2);
+
+    auto is_t1 = [](SkTypeface* face, void* ctx) { return face == ctx; };
+    REPORTER_ASSERT(reporter, cache.findByHashProcAndRef(9, is_t1, t1.get()) == t1);
+    REPORTER_ASSERT(reporter, !cache.findByHashProcAndRef(7, is_t1, t1.get()));
+
+    // Purging keeps the hashes with their typefaces.
+    t0.reset();
+    cache.purgeAll();
+    REPORTER_ASSERT(reporter, count(reporter, cache) == 1);
+    REPORTER_ASSERT(reporter, cache.findByHashProcAndRef(9, is_t1, t1.get()) == t1);
+}
+
+DEF_TEST(FallbackTypefaceCache, reporter) {
+    sk_sp<SkTypeface> typeface(TestEmptyTypeface::Make());
+    SkFallbackTypefaceCache cache(2);
+    int matches = 0;
+    auto find = [&](const char* familyName, const char* language, SkUnichar character) {
+        const char* bcp47[] = {language};
+        return cache.findOrMatch(familyName, SkFontStyle(), bcp47, language ? 1 : 0, character,
+                                 [&]() {
+            ++matches;
+            return character == 'a' ? typeface : nullptr;
+        });
+    };
+
+    REPORTER_ASSERT(reporter, find("family", "en", 'a') == typeface);
+    REPORTER_ASSERT(reporter, find("family", "en", 'a') == typeface);
+    REPORTER_ASSERT(reporter, matches == 1);
+
+    // Finding nothing is remembered as well.
+    REPORTER_ASSERT(reporter, !find("family", "en", 'b'));
+    REPORTER_ASSERT(reporter, !find("family", "en", 'b'));
+    REPORTER_ASSERT(reporter, matches == 2);
+
+    // Every argument is part of the key, and the oldest results are evicted.
+    REPORTER_ASSERT(reporter, find(nullptr, "en", 'a') == typeface);
+    REPORTER_ASSERT(reporter, matches == 3);
+    REPORTER_ASSERT(reporter, find("family", nullptr, 'a') == typeface);
+    REPORTER_ASSERT(reporter, matches == 4);
+    REPORTER_ASSERT(reporter, find("family", "en", 'a') == typeface);
+    REPORTER_ASSERT(reporter, matches == 5);
+
+    cache.purgeAll();
+    REPORTER_ASSERT(reporter, find("family", "en", 'a') == typeface);
+    REPORTER_ASSERT(reporter, matches == 6);
+}
+
 static void check_serialize_behaviors(sk_sp<SkTypeface> tf, skiatest::Reporter* reporter) {
     if (!tf) {
         return;
@@ -534,6 +534,45 @@ DEF_TEST(wangs_formula_conic_vectorXforms, r) {
     }
 }
 
+static bool nearly_equal_relative(float a, float b) {
+    return std::abs(a - b) <= 1e-5f * std::max(std::abs(a), std::abs(b));
+}
+
+// Ensure the batched versions of Wang's formula match evaluating one curve at a time.
+DEF_TEST(wangs_formula_batched, r) {
+    static constexpr int N = 8;
+    SkPoint cubics[4 * N];
+    SkPoint conics[4 * N];  // Laid out like patches, with an unused 4th point.
+    float weights[N];
+
+    SkRandom rand;
+    for_random_matrices(&rand, [&](const SkMatrix& m) {
+        wangs_formula::VectorXform xform(m);
+        for (int exp = -10; exp <= 20; exp += 5) {
+            for (int i = 0; i < 4 * N; ++i) {
+                cubics[i].set(std::ldexp(1 + rand.nextF(), exp),
+                              std::ldexp(1 + rand.nextF(), exp));
+                conics[i].set(std::ldexp(1 + rand.nextF(), exp),
+                              std::ldexp(1 + rand.nextF(), exp));
+            }
+            for (int i = 0; i < N; ++i) {
+                weights[i] = std::ldexp(1 + rand.nextF(), rand.nextRangeU(0, 10) - 5);
+            }
+
+            float cubicN4[N], conicN2[N];
+            wangs_formula::cubic_p4<N>(kPrecision, cubics, xform).store(cubicN4);
+            wangs_formula::conic_p2<N>(kPrecision, conics, weights, xform).store(conicN2);
+            for (int i = 0; i < N; ++i) {
+                float expectedCubic = wangs_formula::cubic_p4(kPrecision, cubics + 4*i, xform);
+                float expectedConic =
+                        wangs_formula::conic_p2(kPrecision, conics + 4*i, weights[i], xform);
+                REPORTER_ASSERT(r, nearly_equal_relative(cubicN4[i], expectedCubic));
+                REPORTER_ASSERT(r, nearly_equal_relative(conicN2[i], expectedConic));
+            }
+        }
+    });
+}
+
 DEF_TEST(wangs_formula_nextlog2, r) {
     REPORTER_ASSERT(r, 0b0'00000000'111'1111111111'1111111111 == (1u << 23) - 1u);
     REPORTER_ASSERT(r, wangs_formula::nextlog2(-std::numeric_limits<float>::infinity()) == 0);
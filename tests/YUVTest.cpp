@@ -7,8 +7,10 @@
 
 #include "include/codec/SkCodec.h"
 #include "include/codec/SkEncodedOrigin.h"
+#include "include/core/SkBitmap.h"
 #include "include/core/SkColorType.h"
 #include "include/core/SkData.h"
+#include "include/core/SkExecutor.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkPixmap.h"
 #include "include/core/SkScalar.h"
@@ -20,9 +22,15 @@
 #include "include/effects/SkColorMatrix.h"
 #include "include/encode/SkJpegEncoder.h"
 #include "include/private/base/SkTo.h"
+#include "src/base/SkHalf.h"
+#include "src/base/SkRandom.h"
+#include "src/core/SkConvertPixels.h"
+#include "src/core/SkYUVAInfoLocation.h"
+#include "src/core/SkYUVMath.h"
 #include "tests/Test.h"
 #include "tools/Resources.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <memory>
@@ -187,6 +195,7 @@ DEF_TEST(Jpeg_YUV_Encode, r) {
             "images/cropped_mandrill.jpg",
             "images/randPixels.jpg",
     };
+    std::unique_ptr<SkExecutor> executor = SkExecutor::MakeFIFOThreadPool(4);
     for (const auto* path : paths) {
         SkYUVAPixmaps decoded;
         {
@@ -204,6 +213,19 @@ DEF_TEST(Jpeg_YUV_Encode, r) {
         }
 
         verify_same(r, decoded, roundtrip);
+
+        // Images with enough rows are encoded in strips, but decode the same.
+        SkYUVAPixmaps parallelRoundtrip;
+        {
+            SkJpegEncoder::Options options;
+            options.fExecutor = executor.get();
+            SkDynamicMemoryWStream encodeStream;
+            REPORTER_ASSERT(r, SkJpegEncoder::Encode(&encodeStream, decoded, nullptr, options));
+            auto encodedData = encodeStream.detachAsData();
+            parallelRoundtrip = decode_yuva(r, SkMemoryStream::Make(encodedData));
+        }
+
+        verify_same(r, decoded, parallelRoundtrip);
     }
 }
 
@@ -238,3 +260,114 @@ DEF_TEST(YUVMath, reporter) {
         }
     }
 }
+
+// SkConvertYUVAPixels() against the plain per-pixel math, for the common video layouts.
+DEF_TEST(YUVA_ConvertPixels, reporter) {
+    using PlaneConfig = SkYUVAInfo::PlaneConfig;
+    using Subsampling = SkYUVAInfo::Subsampling;
+    using DataType    = SkYUVAPixmapInfo::DataType;
+    struct {
+        PlaneConfig     fConfig;
+        Subsampling     fSubsampling;
+        DataType        fDataType;
+        SkYUVColorSpace fColorSpace;
+    } kCases[] = {
+        {PlaneConfig::kY_U_V,   Subsampling::k420, DataType::kUnorm8,  kRec601_SkYUVColorSpace},
+        {PlaneConfig::kY_UV,    Subsampling::k420, DataType::kUnorm8,  kRec709_SkYUVColorSpace},
+        {PlaneConfig::kY_UV,    Subsampling::k420, DataType::kUnorm16,
+         kBT2020_10bit_Limited_SkYUVColorSpace},
+        {PlaneConfig::kY_U_V_A, Subsampling::k444, DataType::kUnorm8,  kJPEG_SkYUVColorSpace},
+        {PlaneConfig::kYUVA,    Subsampling::k444, DataType::kUnorm16, kIdentity_SkYUVColorSpace},
+    };
+
+    SkRandom rand;
+    for (const auto& c : kCases) {
+        // Odd sizes, so the subsampled planes' last pixels are only half used.
+        SkYUVAInfo yuvaInfo({37, 21}, c.fConfig, c.fSubsampling, c.fColorSpace);
+        SkYUVAPixmaps pixmaps = SkYUVAPixmaps::Allocate(
+                SkYUVAPixmapInfo(yuvaInfo, c.fDataType, /*rowBytes=*/nullptr));
+        REPORTER_ASSERT(reporter, pixmaps.isValid());
+        for (int i = 0; i < pixmaps.numPlanes(); ++i) {
+            const SkPixmap& plane = pixmaps.plane(i);
+            for (int y = 0; y < plane.height(); ++y) {
+                auto* row = static_cast<uint8_t*>(plane.writable_addr(0, y));
+                for (size_t b = 0; b < plane.info().minRowBytes(); ++b) {
+                    row[b] = (uint8_t)rand.nextU();
+                }
+            }
+        }
+
+        float m[20];
+        SkColorMatrix_YUV2RGB(c.fColorSpace, m);
+        const SkYUVAInfo::YUVALocations locations = pixmaps.toYUVALocations();
+        // Read the planes as floats up front. (getColor4f() rounds some 16-bit formats to 8 bits.)
+        SkBitmap planes[SkYUVAInfo::kMaxPlanes];
+        for (int i = 0; i < pixmaps.numPlanes(); ++i) {
+            const SkPixmap& plane = pixmaps.plane(i);
+            planes[i].allocPixels(plane.info().makeColorType(kRGBA_F32_SkColorType)
+                                              .makeAlphaType(kUnpremul_SkAlphaType));
+            REPORTER_ASSERT(reporter, plane.readPixels(planes[i].pixmap()));
+        }
+        auto expected = [&](int x, int y) {
+            float yuva[4] = {0, 0, 0, 1};
+            for (int ch = 0; ch < 4; ++ch) {
+                const auto [plane, channel] = locations[ch];
+                if (plane < 0) {
+                    continue;
+                }
+                const SkPixmap& pm = planes[plane].pixmap();
+                // The plane pixel nearest the center of the image's pixel.
+                const int px = (int)((x + 0.5f) * pm.width()  / yuvaInfo.width()),
+                          py = (int)((y + 0.5f) * pm.height() / yuvaInfo.height());
+                yuva[ch] = pm.getColor4f(px, py)[static_cast<int>(channel)];
+            }
+            SkColor4f rgba;
+            for (int i = 0; i < 3; ++i) {
+                const float v = m[5*i+0]*yuva[0] + m[5*i+1]*yuva[1] + m[5*i+2]*yuva[2] + m[5*i+4];
+                rgba[i] = std::min(std::max(v, 0.f), 1.f) * yuva[3];
+            }
+            rgba.fA = yuva[3];
+            return rgba;
+        };
+
+        for (SkColorType ct : {kRGBA_8888_SkColorType, kBGRA_8888_SkColorType,
+                               kRGBA_F16_SkColorType}) {
+            SkBitmap bm;
+            bm.allocPixels(SkImageInfo::Make(yuvaInfo.dimensions(), ct, kPremul_SkAlphaType));
+            REPORTER_ASSERT(reporter, SkConvertYUVAPixels(bm.pixmap(), pixmaps));
+
+            float worst = 0;
+            for (int y = 0; y < bm.height(); ++y) {
+                for (int x = 0; x < bm.width(); ++x) {
+                    const SkColor4f want = expected(x, y);
+                    float got[4];
+                    if (ct == kRGBA_F16_SkColorType) {
+                        for (int i = 0; i < 4; ++i) {
+                            got[i] = SkHalfToFloat(static_cast<const uint16_t*>(bm.getAddr(x, y))[i]);
+                        }
+                    } else {
+                        const uint8_t* p = reinterpret_cast<const uint8_t*>(bm.getAddr32(x, y));
+                        const bool bgra = ct == kBGRA_8888_SkColorType;
+                        got[0] = p[bgra ? 2 : 0] / 255.f;
+                        got[1] = p[1] / 255.f;
+                        got[2] = p[bgra ? 0 : 2] / 255.f;
+                        got[3] = p[3] / 255.f;
+                    }
+                    for (int i = 0; i < 4; ++i) {
+                        worst = std::max(worst, std::abs(got[i] - want[i]));
+                    }
+                }
+            }
+            REPORTER_ASSERT(reporter, worst <= 0.6f / 255, "ct %d worst error %g", ct, worst);
+        }
+    }
+
+    // Rotated images aren't handled.
+    SkYUVAInfo rotated({8, 8}, PlaneConfig::kY_U_V, Subsampling::k420, kJPEG_SkYUVColorSpace,
+                       kRightTop_SkEncodedOrigin);
+    SkYUVAPixmaps pixmaps = SkYUVAPixmaps::Allocate(
+            SkYUVAPixmapInfo(rotated, DataType::kUnorm8, /*rowBytes=*/nullptr));
+    SkBitmap bm;
+    bm.allocN32Pixels(8, 8);
+    REPORTER_ASSERT(reporter, !SkConvertYUVAPixels(bm.pixmap(), pixmaps));
+}
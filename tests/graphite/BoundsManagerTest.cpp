@@ -7,6 +7,7 @@
 
 #include "tests/Test.h"
 
+#include "src/base/SkRandom.h"
 #include "src/gpu/graphite/geom/BoundsManager.h"
 
 namespace skgpu::graphite {
@@ -47,4 +48,48 @@ DEF_TEST(BoundsManager, r) {
     // TODO: Then test calls where the new value is not larger than the current max
 }
 
+DEF_TEST(BoundsManager_TwoLevelGrid, r) {
+    // The two-level grid should match a plain grid with the same cell size exactly, and so be
+    // conservative compared to the brute force manager.
+    static constexpr int kCellSize = 4;
+    static constexpr int kDeviceSize = 300;
+    static constexpr int kGridSize = 80; // 5 tiles of 16 cells per side, past kDeviceSize
+
+    std::unique_ptr<TwoLevelGridBoundsManager> twoLevel =
+            TwoLevelGridBoundsManager::Make({kDeviceSize, kDeviceSize}, kCellSize);
+    std::unique_ptr<GridBoundsManager> grid =
+            GridBoundsManager::Make({kGridSize * kCellSize, kGridSize * kCellSize}, kGridSize);
+    BruteForceBoundsManager bruteForce;
+
+    SkRandom rand;
+    for (int frame = 0; frame < 2; ++frame) {
+        for (int i = 0; i < 2000; ++i) {
+            // Mostly small draws, some of them partially offscreen, and every so often one that
+            // covers whole tiles.
+            const float maxSize = i % 50 == 0 ? kDeviceSize : 30.f;
+            Rect b = Rect::XYWH(rand.nextRangeF(-10, kDeviceSize + 10),
+                                rand.nextRangeF(-10, kDeviceSize + 10),
+                                rand.nextRangeF(0.5f, maxSize),
+                                rand.nextRangeF(0.5f, maxSize));
+
+            CompressedPaintersOrder actual = twoLevel->getMostRecentDraw(b);
+            REPORTER_ASSERT(r, actual == grid->getMostRecentDraw(b));
+            REPORTER_ASSERT(r, actual >= bruteForce.getMostRecentDraw(b));
+
+            CompressedPaintersOrder order = actual.next();
+            twoLevel->recordDraw(b, order);
+            grid->recordDraw(b, order);
+            bruteForce.recordDraw(b, order);
+        }
+        REPORTER_ASSERT(r, twoLevel->refinedTileCount() > 0);
+
+        twoLevel->reset();
+        grid->reset();
+        bruteForce.reset();
+        REPORTER_ASSERT(r, twoLevel->refinedTileCount() == 0);
+        REPORTER_ASSERT(r, twoLevel->getMostRecentDraw(Rect::WH(kDeviceSize, kDeviceSize)) ==
+                           CompressedPaintersOrder::First());
+    }
+}
+
 }  // namespace skgpu::graphite
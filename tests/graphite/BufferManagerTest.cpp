@@ -14,6 +14,7 @@
 #include "src/gpu/graphite/BufferManager.h"
 #include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ContextPriv.h"
+#include "src/gpu/graphite/PipelineData.h"
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/RecordingPriv.h"
 
@@ -70,4 +71,41 @@ DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(BufferManagerGpuOnlyBufferTest, reporte
     REPORTER_ASSERT(reporter, ssbo.fBuffer != mappedSsbo.fBuffer);
 }
 
+DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(BufferManagerPersistentUniformsTest, reporter, context,
+                                         CtsEnforcement::kNextRelease) {
+    std::unique_ptr<Recorder> recorder = context->makeRecorder();
+    DrawBufferManager* mgr = recorder->priv().drawBufferManager();
+    const Caps* caps = context->priv().caps();
+
+    const float dataA[4] = {1.f, 2.f, 3.f, 4.f};
+    const float dataB[4] = {5.f, 6.f, 7.f, 8.f};
+    UniformDataBlock blockA({reinterpret_cast<const char*>(dataA), sizeof(dataA)});
+    UniformDataBlock blockB({reinterpret_cast<const char*>(dataB), sizeof(dataB)});
+
+    BindBufferInfo a = mgr->getPersistentUniforms(blockA);
+    if (!caps->drawBufferCanBeMapped() || caps->bufferMapsAreAsync()) {
+        // Persistent uniforms require writing straight into the buffer that's bound.
+        REPORTER_ASSERT(reporter, !a);
+        return;
+    }
+    REPORTER_ASSERT(reporter, a);
+    REPORTER_ASSERT(reporter, is_offset_aligned(a.fOffset,
+                                                caps->requiredUniformBufferAlignment()));
+
+    // The same data is only written once, and different data gets its own block.
+    BindBufferInfo b = mgr->getPersistentUniforms(blockB);
+    REPORTER_ASSERT(reporter, b.fBuffer == a.fBuffer);
+    REPORTER_ASSERT(reporter, b.fOffset >= a.fOffset + mgr->alignUniformBlockSize(sizeof(dataA)));
+    REPORTER_ASSERT(reporter, mgr->getPersistentUniforms(blockA) == a);
+
+    // The data stays where it is across Recordings.
+    std::unique_ptr<Recording> recording = recorder->snap();
+    REPORTER_ASSERT(reporter, !a.fBuffer->isMapped());
+
+    const float dataACopy[4] = {1.f, 2.f, 3.f, 4.f};
+    UniformDataBlock blockACopy({reinterpret_cast<const char*>(dataACopy), sizeof(dataACopy)});
+    REPORTER_ASSERT(reporter, mgr->getPersistentUniforms(blockACopy) == a);
+    REPORTER_ASSERT(reporter, mgr->getPersistentUniforms(blockB) == b);
+}
+
 }  // namespace skgpu::graphite
@@ -7,7 +7,14 @@
 
 #include "tests/Test.h"
 
+#include "include/core/SkBitmap.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkShader.h"
+#include "include/gpu/graphite/Image.h"
+#include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ContextPriv.h"
+#include "src/gpu/graphite/DrawCommands.h"
 #include "src/gpu/graphite/DrawList.h"
 #include "src/gpu/graphite/DrawPass.h"
 #include "src/gpu/graphite/RecorderPriv.h"
@@ -61,4 +68,82 @@ DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(DrawPassTestFailedDstCopy,
     REPORTER_ASSERT(reporter, !drawPass);
 }
 
+// Tests that draws alternating between two images are sorted so that each image is only bound
+// once, even when every draw has different uniforms. When uniforms come from storage buffers, the
+// draws for each image are also recorded as a single draw call.
+DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(DrawPassTestTexturesBeforeUniforms,
+                                   reporter,
+                                   context,
+                                   CtsEnforcement::kNextRelease) {
+    const Caps* caps = context->priv().caps();
+    std::unique_ptr<Recorder> recorder = context->makeRecorder();
+
+    sk_sp<SkImage> images[2];
+    for (int i = 0; i < 2; ++i) {
+        SkBitmap bitmap;
+        bitmap.allocN32Pixels(4, 4);
+        bitmap.eraseColor(i ? SK_ColorRED : SK_ColorBLUE);
+        images[i] = SkImages::TextureFromImage(recorder.get(), bitmap.asImage(), {});
+        REPORTER_ASSERT(reporter, images[i]);
+    }
+
+    static constexpr int kNumDraws = 8;
+    std::unique_ptr<DrawList> drawList = std::make_unique<DrawList>();
+    const DrawOrder order(DrawOrder::kClearDepth.next());
+    for (int i = 0; i < kNumDraws; ++i) {
+        SkPaint paint;
+        paint.setShader(SkShaders::Blend(SkBlendMode::kModulate,
+                                         SkShaders::Color(SkColorSetARGB(255, 32 * i, 0, 0)),
+                                         images[i % 2]->makeShader({})));
+        PaintParams paintParams{paint, nullptr, nullptr, DstReadRequirement::kNone, false};
+        const SkIRect bounds = SkIRect::MakeXYWH(4 * i, 0, 4, 4);
+        drawList->recordDraw(recorder->priv().rendererProvider()->analyticRRect(),
+                             Transform::Identity(),
+                             Geometry(Shape(SkRect::Make(bounds))),
+                             Clip(Rect(SkRect::Make(bounds)), Rect(SkRect::Make(bounds)),
+                                  SkIRect::MakeWH(4 * kNumDraws, 4), nullptr),
+                             order,
+                             &paintParams,
+                             nullptr);
+    }
+
+    static constexpr SkColorType targetColorType = kN32_SkColorType;
+    const SkImageInfo targetInfo =
+            SkImageInfo::Make(4 * kNumDraws, 4, targetColorType, kPremul_SkAlphaType);
+    sk_sp<TextureProxy> target = TextureProxy::Make(
+            caps,
+            targetInfo.dimensions(),
+            caps->getDefaultSampledTextureInfo(
+                    targetColorType, Mipmapped::kNo, Protected::kNo, Renderable::kYes),
+            Budgeted::kNo);
+    std::unique_ptr<DrawPass> drawPass = DrawPass::Make(recorder.get(),
+                                                        std::move(drawList),
+                                                        target,
+                                                        targetInfo,
+                                                        {LoadOp::kClear, StoreOp::kStore},
+                                                        {0.0f, 0.0f, 0.0f, 0.0f});
+    REPORTER_ASSERT(reporter, drawPass);
+
+    int textureBinds = 0, drawCalls = 0;
+    for (const DrawPassCommands::List::Command& command : drawPass->commands()) {
+        switch (command.first) {
+            case DrawPassCommands::Type::kBindTexturesAndSamplers:
+                ++textureBinds;
+                break;
+            case DrawPassCommands::Type::kDraw:
+            case DrawPassCommands::Type::kDrawIndexed:
+            case DrawPassCommands::Type::kDrawInstanced:
+            case DrawPassCommands::Type::kDrawIndexedInstanced:
+                ++drawCalls;
+                break;
+            default:
+                break;
+        }
+    }
+    REPORTER_ASSERT(reporter, textureBinds == 2, "%d", textureBinds);
+    if (caps->storageBufferPreferred()) {
+        REPORTER_ASSERT(reporter, drawCalls == 2, "%d", drawCalls);
+    }
+}
+
 }  // namespace skgpu::graphite
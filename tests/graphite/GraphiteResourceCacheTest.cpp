@@ -754,4 +754,82 @@ DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(GraphitePurgeResourcesTest, reporter, context
     REPORTER_ASSERT(reporter, resourceCache->getResourceCount() == 0);
 }
 
+// Test that a category over its budget only purges its own resources, and that the stats track the
+// budgeted bytes per category and the scratch lookups.
+DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(GraphiteResourceCategoryBudgetTest, reporter, context,
+                                   CtsEnforcement::kNextRelease) {
+    std::unique_ptr<Recorder> recorder = context->makeRecorder();
+    ResourceProvider* resourceProvider = recorder->priv().resourceProvider();
+    ResourceCache* resourceCache = resourceProvider->resourceCache();
+    const SharedContext* sharedContext = resourceProvider->sharedContext();
+
+    resourceCache->setMaxBudget(100);
+    resourceCache->resetStats();
+
+    auto addPurgeable = [&](ResourceCategory category, size_t gpuMemorySize) {
+        auto resource = TestResource::Make(sharedContext,
+                                           Ownership::kOwned,
+                                           skgpu::Budgeted::kYes,
+                                           Shareable::kNo,
+                                           gpuMemorySize);
+        resource->setCategory(category);
+        resourceCache->insertResource(resource.get());
+        Resource* ptr = resource.get();
+        resource.reset();
+        resourceCache->forceProcessReturnedResources();
+        return ptr;
+    };
+
+    addPurgeable(ResourceCategory::kTexture, 4);
+    Resource* texture2 = addPurgeable(ResourceCategory::kTexture, 4);
+    Resource* buffer = addPurgeable(ResourceCategory::kBuffer, 4);
+
+    static constexpr int kTexture = static_cast<int>(ResourceCategory::kTexture);
+    static constexpr int kBuffer = static_cast<int>(ResourceCategory::kBuffer);
+
+    ResourceCacheStats stats = resourceCache->getStats();
+    REPORTER_ASSERT(reporter, stats.fBudgetedBytes[kTexture] == 8);
+    REPORTER_ASSERT(reporter, stats.fBudgetedBytes[kBuffer] == 4);
+    REPORTER_ASSERT(reporter, stats.fAllocatedBytes == 12);
+    REPORTER_ASSERT(reporter, stats.fPurgedBytes == 0);
+
+    // Limiting the textures should purge the least recently used texture and nothing else, even
+    // though the cache as a whole is under budget.
+    resourceCache->setCategoryBudget(ResourceCategory::kTexture, 4);
+    REPORTER_ASSERT(reporter, resourceCache->getResourceCount() == 2);
+    REPORTER_ASSERT(reporter, resourceCache->testingInPurgeableQueue(texture2));
+    REPORTER_ASSERT(reporter, resourceCache->testingInPurgeableQueue(buffer));
+    REPORTER_ASSERT(reporter, resourceCache->currentBudgetedBytes() == 8);
+
+    stats = resourceCache->getStats();
+    REPORTER_ASSERT(reporter, stats.fBudgetedBytes[kTexture] == 4);
+    REPORTER_ASSERT(reporter, stats.fBudgetedBytes[kBuffer] == 4);
+    REPORTER_ASSERT(reporter, stats.fPurgedBytes == 4);
+
+    // Both remaining resources share a scratch key, so the third lookup misses.
+    GraphiteResourceKey key;
+    TestResource::CreateKey(&key, Shareable::kNo);
+    sk_sp<Resource> found1(resourceCache->findAndRefResource(key, skgpu::Budgeted::kYes));
+    sk_sp<Resource> found2(resourceCache->findAndRefResource(key, skgpu::Budgeted::kYes));
+    sk_sp<Resource> found3(resourceCache->findAndRefResource(key, skgpu::Budgeted::kYes));
+    REPORTER_ASSERT(reporter, found1 && found2 && !found3);
+
+    stats = resourceCache->getStats();
+    REPORTER_ASSERT(reporter, stats.fScratchHits == 2);
+    REPORTER_ASSERT(reporter, stats.fScratchMisses == 1);
+    REPORTER_ASSERT(reporter, stats.fShareableHits == 0);
+
+    resourceCache->resetStats();
+    stats = resourceCache->getStats();
+    REPORTER_ASSERT(reporter, stats.fScratchHits == 0 && stats.fPurgedBytes == 0);
+    REPORTER_ASSERT(reporter, stats.fBudgetedBytes[kTexture] == 4);
+
+    found1.reset();
+    found2.reset();
+    resourceCache->forceProcessReturnedResources();
+    resourceCache->setCategoryBudget(ResourceCategory::kTexture, SIZE_MAX);
+    resourceCache->setMaxBudget(0);
+    REPORTER_ASSERT(reporter, resourceCache->getResourceCount() == 0);
+}
+
 }  // namespace skgpu::graphite
@@ -9,13 +9,20 @@
 
 #include "include/core/SkBitmap.h"
 #include "include/core/SkTileMode.h"
+#include "include/core/SkYUVAInfo.h"
+#include "include/core/SkYUVAPixmaps.h"
 #include "include/gpu/graphite/Context.h"
+#include "include/gpu/graphite/Image.h"
 #include "include/gpu/graphite/Surface.h"
+#include "src/gpu/graphite/Image_YUVA_Graphite.h"
 #include "src/gpu/graphite/Surface_Graphite.h"
+#include "src/image/SkImage_Base.h"
 #include "src/shaders/SkImageShader.h"
 #include "tools/GpuToolUtils.h"
 #include "tools/ToolUtils.h"
 
+#include <cmath>
+
 namespace skgpu::graphite {
 
 namespace {
@@ -80,6 +87,50 @@ void test_draw(skiatest::Reporter* reporter,
     }
 }
 
+// Draws a YUVA image, shrunk with mipmaps, with a Recorder that either converts it to RGBA for
+// every draw or converts it once and caches the result.
+SkBitmap draw_yuva(Context* context, bool cacheConversions) {
+    RecorderOptions options = ToolUtils::CreateTestingRecorderOptions();
+    options.fCacheYUVAConversions = cacheConversions;
+    std::unique_ptr<Recorder> recorder = context->makeRecorder(options);
+
+    SkYUVAInfo yuvaInfo({64, 64},
+                        SkYUVAInfo::PlaneConfig::kY_U_V,
+                        SkYUVAInfo::Subsampling::k420,
+                        kJPEG_Full_SkYUVColorSpace);
+    SkYUVAPixmaps pixmaps = SkYUVAPixmaps::Allocate(
+            SkYUVAPixmapInfo(yuvaInfo, SkYUVAPixmapInfo::DataType::kUnorm8, nullptr));
+    for (int y = 0; y < 64; ++y) {
+        for (int x = 0; x < 64; ++x) {
+            *pixmaps.plane(0).writable_addr8(x, y) = (x * 4) ^ (y * 4);
+        }
+    }
+    for (int y = 0; y < 32; ++y) {
+        for (int x = 0; x < 32; ++x) {
+            *pixmaps.plane(1).writable_addr8(x, y) = 64 + x * 4;
+            *pixmaps.plane(2).writable_addr8(x, y) = 64 + y * 4;
+        }
+    }
+    sk_sp<SkImage> image = SkImages::TextureFromYUVAPixmaps(recorder.get(), pixmaps);
+    if (!image) {
+        return {};
+    }
+
+    SkImageInfo dstInfo = SkImageInfo::Make(16, 16, kRGBA_8888_SkColorType, kPremul_SkAlphaType);
+    sk_sp<SkSurface> surface = SkSurfaces::RenderTarget(recorder.get(), dstInfo);
+    // The second draw should reuse what the first one converted.
+    const SkSamplingOptions sampling(SkFilterMode::kLinear, SkMipmapMode::kLinear);
+    surface->getCanvas()->drawImageRect(image, SkRect::MakeWH(16, 16), sampling);
+    surface->getCanvas()->drawImageRect(image, SkRect::MakeWH(16, 16), sampling);
+
+    SkBitmap result;
+    result.allocPixels(dstInfo);
+    if (!surface->readPixels(result.pixmap(), 0, 0)) {
+        return {};
+    }
+    return result;
+}
+
 }  // anonymous namespace
 
 DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ImageShaderTest, reporter, context,
@@ -103,4 +154,62 @@ DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ImageShaderTest, reporter, context,
                {{75, 40}, kBgColor}});
 }
 
+DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ImageShaderTest_CachedYUVAConversion, reporter, context,
+                                         CtsEnforcement::kNextRelease) {
+    SkBitmap expected = draw_yuva(context, /*cacheConversions=*/false);
+    SkBitmap actual = draw_yuva(context, /*cacheConversions=*/true);
+    if (expected.drawsNothing() || actual.drawsNothing()) {
+        return;
+    }
+    // Filtering the converted pixels rather than the planes can round a little differently.
+    for (int y = 0; y < expected.height(); ++y) {
+        for (int x = 0; x < expected.width(); ++x) {
+            SkColor4f a = expected.getColor4f(x, y);
+            SkColor4f b = actual.getColor4f(x, y);
+            REPORTER_ASSERT(reporter,
+                            std::fabs(a.fR - b.fR) <= 2/255.f &&
+                            std::fabs(a.fG - b.fG) <= 2/255.f &&
+                            std::fabs(a.fB - b.fB) <= 2/255.f &&
+                            a.fA == b.fA,
+                            "At (%d, %d), expected {%.3f, %.3f, %.3f, %.3f}, "
+                            "found {%.3f, %.3f, %.3f, %.3f}",
+                            x, y, a.fR, a.fG, a.fB, a.fA, b.fR, b.fG, b.fB, b.fA);
+        }
+    }
+}
+
+DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ImageShaderTest_FlattenedYUVAReuse, reporter, context,
+                                         CtsEnforcement::kNextRelease) {
+    std::unique_ptr<Recorder> recorder = context->makeRecorder();
+    std::unique_ptr<Recorder> other = context->makeRecorder();
+
+    SkYUVAInfo yuvaInfo({8, 8},
+                        SkYUVAInfo::PlaneConfig::kY_U_V,
+                        SkYUVAInfo::Subsampling::k420,
+                        kRec709_Limited_SkYUVColorSpace);
+    SkYUVAPixmaps pixmaps = SkYUVAPixmaps::Allocate(
+            SkYUVAPixmapInfo(yuvaInfo, SkYUVAPixmapInfo::DataType::kUnorm8, nullptr));
+    for (int i = 0; i < pixmaps.numPlanes(); ++i) {
+        pixmaps.plane(i).erase(SK_ColorGRAY);
+    }
+    sk_sp<SkImage> image = SkImages::TextureFromYUVAPixmaps(recorder.get(), pixmaps);
+    if (!image) {
+        return;
+    }
+    auto yuva = static_cast<const Image_YUVA*>(image.get());
+
+    sk_sp<SkImage> flat = yuva->flattened(recorder.get(), Mipmapped::kNo);
+    REPORTER_ASSERT(reporter, flat && !as_IB(flat)->isYUVA() && !flat->hasMipmaps());
+    REPORTER_ASSERT(reporter, yuva->flattened(recorder.get(), Mipmapped::kNo) == flat);
+
+    // Asking for mipmaps converts again, and the mipmapped result serves both kinds of draw.
+    sk_sp<SkImage> mipped = yuva->flattened(recorder.get(), Mipmapped::kYes);
+    REPORTER_ASSERT(reporter, mipped && mipped != flat && mipped->hasMipmaps());
+    REPORTER_ASSERT(reporter, yuva->flattened(recorder.get(), Mipmapped::kNo) == mipped);
+
+    // Another Recorder gets its own conversion.
+    sk_sp<SkImage> otherFlat = yuva->flattened(other.get(), Mipmapped::kNo);
+    REPORTER_ASSERT(reporter, otherFlat && otherFlat != mipped);
+}
+
 }  // namespace skgpu::graphite
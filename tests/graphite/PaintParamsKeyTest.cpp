@@ -27,6 +27,8 @@
 #include "src/core/SkBlenderBase.h"
 #include "src/core/SkColorFilterPriv.h"
 #include "src/core/SkRuntimeEffectPriv.h"
+#include "src/effects/colorfilters/SkColorFilterBase.h"
+#include "src/effects/colorfilters/SkComposeColorFilter.h"
 #include "src/gpu/graphite/ContextPriv.h"
 #include "src/gpu/graphite/ContextUtils.h"
 #include "src/gpu/graphite/FactoryFunctions.h"
@@ -585,11 +587,25 @@ std::pair<sk_sp<SkColorFilter>, sk_sp<PrecompileColorFilter>> create_srgb_to_lin
 
 std::pair<sk_sp<SkColorFilter>, sk_sp<PrecompileColorFilter>> create_compose_colorfilter(
         SkRandom* rand) {
-    auto [outerCF, outerO] = create_random_colorfilter(rand);
-    auto [innerCF, innerO] = create_random_colorfilter(rand);
+    while (true) {
+        auto [outerCF, outerO] = create_random_colorfilter(rand);
+        auto [innerCF, innerO] = create_random_colorfilter(rand);
+
+        sk_sp<SkColorFilter> cf = SkColorFilters::Compose(outerCF, innerCF);
+        // Matrices or tables that end up next to each other fold into one filter, which the
+        // precompiled combination wouldn't match, so pick again.
+        if (outerCF && innerCF) {
+            auto compose = static_cast<const SkComposeColorFilter*>(as_CFB(cf));
+            if (as_CFB(cf)->type() != SkColorFilterBase::Type::kCompose ||
+                compose->outer().get() != outerCF.get() ||
+                compose->inner().get() != innerCF.get()) {
+                continue;
+            }
+        }
 
-    return { SkColorFilters::Compose(std::move(outerCF), std::move(innerCF)),
-             PrecompileColorFilters::Compose({ std::move(outerO) }, { std::move(innerO) }) };
+        return { std::move(cf),
+                 PrecompileColorFilters::Compose({ std::move(outerO) }, { std::move(innerO) }) };
+    }
 }
 
 std::pair<sk_sp<SkColorFilter>, sk_sp<PrecompileColorFilter>> create_gaussian_colorfilter() {
@@ -1021,4 +1037,42 @@ DEF_CONDITIONAL_GRAPHITE_TEST_FOR_ALL_CONTEXTS(PaintParamsKeyTest,
 #endif
 }
 
+// Checks that replaying a manifest of the pipelines some draws created lets those draws run again
+// without compiling anything.
+DEF_CONDITIONAL_GRAPHITE_TEST_FOR_ALL_CONTEXTS(PipelineManifestTest,
+                                               reporter,
+                                               context,
+                                               testContext,
+                                               true,
+                                               CtsEnforcement::kNever) {
+    auto recorder = context->makeRecorder();
+
+    SkPaint paint;
+    const SkPoint pts[2] = {{0, 0}, {16, 16}};
+    const SkColor colors[2] = {SK_ColorRED, SK_ColorBLUE};
+    paint.setShader(SkGradientShader::MakeLinear(pts, colors, nullptr, 2, SkTileMode::kClamp));
+
+    DrawData drawData = { make_path(), nullptr, nullptr };
+
+    context->priv().globalCache()->resetGraphicsPipelines();
+    check_draw(reporter, context, testContext, recorder.get(), paint, DrawTypeFlags::kShape,
+               drawData);
+    const int drawn = context->priv().globalCache()->numGraphicsPipelines();
+    REPORTER_ASSERT(reporter, drawn > 0);
+
+    sk_sp<SkData> manifest = SerializePipelineManifest(context);
+    REPORTER_ASSERT(reporter, manifest && manifest->size() > 0);
+
+    context->priv().globalCache()->resetGraphicsPipelines();
+    REPORTER_ASSERT(reporter, PrecompileFromManifest(context, *manifest));
+    REPORTER_ASSERT(reporter, context->priv().globalCache()->numGraphicsPipelines() == drawn);
+
+    check_draw(reporter, context, testContext, recorder.get(), paint, DrawTypeFlags::kShape,
+               drawData);
+
+    // A truncated manifest is rejected.
+    sk_sp<SkData> truncated = SkData::MakeSubset(manifest.get(), 0, manifest->size() / 2);
+    REPORTER_ASSERT(reporter, !PrecompileFromManifest(context, *truncated));
+}
+
 #endif // SK_GRAPHITE
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "tests/Test.h"
+
+#include "include/core/SkData.h"
+#include "src/gpu/graphite/PersistentCacheUtils.h"
+#include "src/sksl/SkSLProgramSettings.h"
+
+namespace skgpu::graphite {
+
+DEF_TEST(GraphitePersistentCacheUtils, r) {
+    using namespace PersistentCacheUtils;
+
+    const std::string sksl = "void main() {}";
+    SkSL::ProgramSettings settings;
+
+    // Keys are deterministic, and differ whenever the compiled code could.
+    sk_sp<SkData> key =
+            MakeShaderKey(kSPIRVTag, sksl, SkSL::ProgramKind::kGraphiteVertex, settings);
+    REPORTER_ASSERT(r, key->equals(MakeShaderKey(kSPIRVTag, sksl,
+                                                 SkSL::ProgramKind::kGraphiteVertex,
+                                                 settings).get()));
+    REPORTER_ASSERT(r, !key->equals(MakeShaderKey(kWGSLTag, sksl,
+                                                  SkSL::ProgramKind::kGraphiteVertex,
+                                                  settings).get()));
+    REPORTER_ASSERT(r, !key->equals(MakeShaderKey(kSPIRVTag, sksl,
+                                                  SkSL::ProgramKind::kGraphiteFragment,
+                                                  settings).get()));
+    REPORTER_ASSERT(r, !key->equals(MakeShaderKey(kSPIRVTag, sksl + " ",
+                                                  SkSL::ProgramKind::kGraphiteVertex,
+                                                  settings).get()));
+    SkSL::ProgramSettings flipped = settings;
+    flipped.fForceNoRTFlip = !flipped.fForceNoRTFlip;
+    REPORTER_ASSERT(r, !key->equals(MakeShaderKey(kSPIRVTag, sksl,
+                                                  SkSL::ProgramKind::kGraphiteVertex,
+                                                  flipped).get()));
+
+    // Packed shaders round trip.
+    const std::string code("\x03\x02\x23\x07\0\0\x01\0", 8);
+    SkSL::Program::Interface interface;
+    interface.fRTFlipUniform = SkSL::Program::Interface::kRTFlip_FragCoord;
+    interface.fOutputSecondaryColor = true;
+    sk_sp<SkData> packed = PackShader(code, interface);
+
+    std::string unpackedCode;
+    SkSL::Program::Interface unpackedInterface;
+    REPORTER_ASSERT(r, UnpackShader(*packed, &unpackedCode, &unpackedInterface));
+    REPORTER_ASSERT(r, unpackedCode == code);
+    REPORTER_ASSERT(r, unpackedInterface.fRTFlipUniform == interface.fRTFlipUniform);
+    REPORTER_ASSERT(r, unpackedInterface.fUseLastFragColor == interface.fUseLastFragColor);
+    REPORTER_ASSERT(r, unpackedInterface.fOutputSecondaryColor == interface.fOutputSecondaryColor);
+
+    // Truncated or unrelated data is rejected rather than handed to the driver.
+    sk_sp<SkData> truncated = SkData::MakeSubset(packed.get(), 0, packed->size() - 4);
+    REPORTER_ASSERT(r, !UnpackShader(*truncated, &unpackedCode, nullptr));
+    REPORTER_ASSERT(r, !UnpackShader(*key, &unpackedCode, nullptr));
+    REPORTER_ASSERT(r, !UnpackShader(*SkData::MakeEmpty(), &unpackedCode, nullptr));
+}
+
+}  // namespace skgpu::graphite
@@ -8,11 +8,19 @@
 #include "tests/Test.h"
 
 #include "include/core/SkBitmap.h"
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPictureRecorder.h"
 #include "include/gpu/graphite/Context.h"
+#include "include/gpu/graphite/Image.h"
 #include "include/gpu/graphite/Recorder.h"
 #include "src/gpu/GpuTypesPriv.h"
 #include "src/gpu/graphite/Caps.h"
 #include "src/gpu/graphite/ContextPriv.h"
+#include "src/gpu/graphite/GlobalCache.h"
+#include "src/gpu/graphite/Image_Graphite.h"
 #include "src/gpu/graphite/ProxyCache.h"
 #include "src/gpu/graphite/RecorderPriv.h"
 #include "src/gpu/graphite/Texture.h"
@@ -451,4 +459,88 @@ DEF_CONDITIONAL_GRAPHITE_TEST_FOR_ALL_CONTEXTS(ProxyCacheTest9,
     REPORTER_ASSERT(r, resourceCache->topOfPurgeableQueue() == nullptr);
 }
 
+// This test checks that a Recorder draws with the texture another Recorder uploaded, once the
+// Recording holding that upload has been inserted, and that the texture stops being shared when
+// the Recorder that uploaded it lets go of it.
+DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(ProxyCacheTest10, r, context, CtsEnforcement::kNextRelease) {
+    GlobalCache* globalCache = context->priv().globalCache();
+    std::unique_ptr<Recorder> recorder1 = context->makeRecorder();
+    ProxyCache* proxyCache1 = recorder1->priv().proxyCache();
+    std::unique_ptr<Recorder> recorder2 = context->makeRecorder();
+    ProxyCache* proxyCache2 = recorder2->priv().proxyCache();
+
+    SkBitmap bitmap;
+    bool success = ToolUtils::GetResourceAsBitmap("images/mandrill_128.png", &bitmap);
+    REPORTER_ASSERT(r, success);
+    if (!success) {
+        return;
+    }
+
+    sk_sp<TextureProxy> proxy1 = proxyCache1->findOrCreateCachedProxy(recorder1.get(), bitmap,
+                                                                      Mipmapped::kNo);
+    REPORTER_ASSERT(r, globalCache->numUploadedProxies() == 1);
+
+    // Until recorder1's upload has been inserted, recorder2 has to upload its own copy.
+    sk_sp<TextureProxy> proxy2 = proxyCache2->findOrCreateCachedProxy(recorder2.get(), bitmap,
+                                                                      Mipmapped::kNo);
+    REPORTER_ASSERT(r, proxy2 != proxy1);
+    REPORTER_ASSERT(r, globalCache->numUploadedProxies() == 1);
+
+    std::unique_ptr<Recording> recording = recorder1->snap();
+    REPORTER_ASSERT(r, context->insertRecording({ recording.get() }));
+
+    std::unique_ptr<Recorder> recorder3 = context->makeRecorder();
+    ProxyCache* proxyCache3 = recorder3->priv().proxyCache();
+    sk_sp<TextureProxy> proxy3 = proxyCache3->findOrCreateCachedProxy(recorder3.get(), bitmap,
+                                                                      Mipmapped::kNo);
+    REPORTER_ASSERT(r, proxy3 == proxy1);
+    REPORTER_ASSERT(r, proxyCache3->numCached() == 0);  // It's recorder1's texture, not ours
+
+    bitmap.eraseColor(SK_ColorBLACK);
+    proxyCache1->forceProcessInvalidKeyMsgs();
+    REPORTER_ASSERT(r, globalCache->numUploadedProxies() == 0);
+
+    context->submit(SyncToCpu::kYes);
+}
+
+// This test checks that picture-backed images made from the same picture share one texture, in
+// one Recorder and, once it's been inserted, in others.
+DEF_GRAPHITE_TEST_FOR_RENDERING_CONTEXTS(ProxyCacheTest11, r, context,
+                                         CtsEnforcement::kNextRelease) {
+    std::unique_ptr<Recorder> recorder1 = context->makeRecorder();
+    ProxyCache* proxyCache1 = recorder1->priv().proxyCache();
+    std::unique_ptr<Recorder> recorder2 = context->makeRecorder();
+
+    SkPictureRecorder pictureRecorder;
+    pictureRecorder.beginRecording(SkRect::MakeWH(32, 32))->drawColor(SK_ColorRED);
+    sk_sp<SkPicture> picture = pictureRecorder.finishRecordingAsPicture();
+    auto makeImage = [&]() {
+        return SkImages::DeferredFromPicture(picture, {32, 32}, nullptr, nullptr,
+                                             SkImages::BitDepth::kU8, SkColorSpace::MakeSRGB());
+    };
+    auto proxyOf = [](Recorder* recorder, const sk_sp<SkImage>& image, bool mipmapped) {
+        sk_sp<SkImage> texture = SkImages::TextureFromImage(recorder, image, {mipmapped});
+        return texture ? static_cast<Image*>(texture.get())->textureProxyView().refProxy()
+                       : nullptr;
+    };
+
+    sk_sp<TextureProxy> proxy1 = proxyOf(recorder1.get(), makeImage(), false);
+    REPORTER_ASSERT(r, proxy1);
+    REPORTER_ASSERT(r, proxyCache1->numCached() == 1);
+    REPORTER_ASSERT(r, proxyOf(recorder1.get(), makeImage(), false) == proxy1);
+
+    // A mipmapped texture is drawn when one is needed, and then serves both kinds of draw.
+    sk_sp<TextureProxy> mipmapped = proxyOf(recorder1.get(), makeImage(), true);
+    REPORTER_ASSERT(r, mipmapped && mipmapped != proxy1);
+    REPORTER_ASSERT(r, mipmapped->mipmapped() == Mipmapped::kYes);
+    REPORTER_ASSERT(r, proxyOf(recorder1.get(), makeImage(), false) == mipmapped);
+
+    std::unique_ptr<Recording> recording = recorder1->snap();
+    REPORTER_ASSERT(r, context->insertRecording({ recording.get() }));
+    REPORTER_ASSERT(r, proxyOf(recorder2.get(), makeImage(), false) == mipmapped);
+    REPORTER_ASSERT(r, recorder2->priv().proxyCache()->numCached() == 0);
+
+    context->submit(SyncToCpu::kYes);
+}
+
 }  // namespace skgpu::graphite
@@ -7,6 +7,7 @@
 
 #include "tests/Test.h"
 
+#include "include/core/SkData.h"
 #include "include/effects/SkRuntimeEffect.h"
 #include "include/gpu/graphite/Context.h"
 #include "src/core/SkRuntimeEffectPriv.h"
@@ -112,6 +113,51 @@ DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(ShaderUniforms_FindOrCreateSnippetForRuntimeE
     REPORTER_ASSERT(reporter, snippet->fUniforms[2].count() == 99);
 }
 
+DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(SpecializedUniforms_FindOrCreateSnippetForRuntimeEffect,
+                                   reporter, context, CtsEnforcement::kNextRelease) {
+    ShaderCodeDictionary* dict = context->priv().shaderCodeDictionary();
+
+    std::unique_ptr<SkRuntimeEffect> testEffect(SkMakeRuntimeEffect(
+            SkRuntimeEffect::MakeForColorFilter,
+                "layout(specialize) uniform int MySpecializedUniform;"
+                "uniform half MyUniform;"
+                "half4 main(half4 color) {"
+                    "return MySpecializedUniform > 0 ? color * MyUniform : color;"
+                "}"
+            ));
+
+    struct Uniforms {
+        int   fSpecialized;
+        float fOther;
+    };
+    auto makeUniforms = [](int specialized, float other) {
+        Uniforms uniforms = {specialized, other};
+        return SkData::MakeWithCopy(&uniforms, sizeof(uniforms));
+    };
+
+    // Without uniform data, the snippet isn't specialized.
+    int genericID = dict->findOrCreateRuntimeEffectSnippet(testEffect.get());
+    const ShaderSnippet* generic = dict->getEntry(genericID);
+    REPORTER_ASSERT(reporter, generic && !generic->fSpecializedUniformData);
+    REPORTER_ASSERT(reporter, generic && generic->fUniforms.size() == 2);
+
+    // Each value of the specialized uniform gets its own snippet, which only has the other uniform.
+    int specializedID = dict->findOrCreateRuntimeEffectSnippet(testEffect.get(),
+                                                               makeUniforms(1, 0.5f).get());
+    REPORTER_ASSERT(reporter, specializedID != genericID);
+    const ShaderSnippet* specialized = dict->getEntry(specializedID);
+    REPORTER_ASSERT(reporter, specialized && specialized->fSpecializedUniformData);
+    REPORTER_ASSERT(reporter, specialized && specialized->fUniforms.size() == 1);
+    REPORTER_ASSERT(reporter, specialized &&
+                              std::string_view(specialized->fUniforms[0].name()) == "MyUniform");
+
+    // Changing the unspecialized uniform reuses the snippet; changing the specialized one doesn't.
+    REPORTER_ASSERT(reporter, specializedID == dict->findOrCreateRuntimeEffectSnippet(
+                                                       testEffect.get(), makeUniforms(1, 2).get()));
+    REPORTER_ASSERT(reporter, specializedID != dict->findOrCreateRuntimeEffectSnippet(
+                                                       testEffect.get(), makeUniforms(0, 2).get()));
+}
+
 DEF_GRAPHITE_TEST_FOR_ALL_CONTEXTS(ColorFilterUniforms_FindOrCreateSnippetForRuntimeEffect,
                                    reporter, context, CtsEnforcement::kNextRelease) {
     ShaderCodeDictionary* dict = context->priv().shaderCodeDictionary();
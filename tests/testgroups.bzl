@@ -31,6 +31,8 @@ CORE_TESTS = [
     "ColorMatrixTest.cpp",
     "ColorPrivTest.cpp",
     "ColorTest.cpp",
+    "ConvertPixelsTest.cpp",
+    "CountersTest.cpp",
     "CtsEnforcement.cpp",
     "CubicMapTest.cpp",
     "DashPathEffectTest.cpp",
@@ -40,6 +42,7 @@ CORE_TESTS = [
     "DrawBitmapRectTest.cpp",
     "DrawPathTest.cpp",
     "EmptyPathTest.cpp",
+    "ExecutorTest.cpp",
     "F16StagesTest.cpp",
     "FillPathTest.cpp",
     "FitsInTest.cpp",
@@ -142,6 +145,7 @@ CORE_TESTS = [
     "TDPQueueTest.cpp",
     "TLazyTest.cpp",
     "TemplatesTest.cpp",
+    "ThreadedBitmapDeviceTest.cpp",
     "TracingTest.cpp",
     "UtilsTest.cpp",
     "VerticesTest.cpp",
@@ -291,6 +291,17 @@ protected:
     }
 #endif
 
+    void onDrawEdgeAARectSet(const SkRect rects[],
+                             const SkColor4f colors[],
+                             int count,
+                             const int matrixIndices[],
+                             const SkMatrix preViewMatrices[],
+                             SkCanvas::QuadAAFlags aaFlags,
+                             SkBlendMode mode) override {
+        this->drawEdgeAARectSetAsQuads(
+                rects, colors, count, matrixIndices, preViewMatrices, aaFlags, mode);
+    }
+
     void onDrawAnnotation(const SkRect& rect, const char key[], SkData* value) override {
         static constexpr char kOffscreenLayerDraw[] = "OffscreenLayerDraw";
         static constexpr char kSurfaceID[] = "SurfaceID";
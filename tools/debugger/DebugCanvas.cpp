@@ -607,6 +607,16 @@ void DebugCanvas::onDrawEdgeAAQuad(const SkRect&    rect,
     this->addDrawCommand(new DrawEdgeAAQuadCommand(rect, clip, aa, color, mode));
 }
 
+void DebugCanvas::onDrawEdgeAARectSet(const SkRect      rects[],
+                                      const SkColor4f   colors[],
+                                      int               count,
+                                      const int         matrixIndices[],
+                                      const SkMatrix    preViewMatrices[],
+                                      QuadAAFlags       aa,
+                                      SkBlendMode       mode) {
+    this->drawEdgeAARectSetAsQuads(rects, colors, count, matrixIndices, preViewMatrices, aa, mode);
+}
+
 void DebugCanvas::onDrawEdgeAAImageSet2(const ImageSetEntry set[],
                                         int                 count,
                                         const SkPoint       dstClips[],
@@ -214,6 +214,13 @@ protected:
                           QuadAAFlags,
                           const SkColor4f&,
                           SkBlendMode) override;
+    void onDrawEdgeAARectSet(const SkRect[],
+                             const SkColor4f[],
+                             int count,
+                             const int[],
+                             const SkMatrix[],
+                             QuadAAFlags,
+                             SkBlendMode) override;
     void onDrawEdgeAAImageSet2(const ImageSetEntry[],
                                int count,
                                const SkPoint[],
@@ -11,10 +11,13 @@ static DEFINE_bool(forceAnalyticAA, false,
             "Force analytic anti-aliasing even if the path is complicated: "
             "whether it's concave or convex, we consider a path complicated"
             "if its number of points is comparable to its resolution.");
+static DEFINE_bool(parallelAnalyticAA, false,
+            "Scan convert very large analytic anti-aliased paths in strips on multiple threads.");
 
 void SetAnalyticAA() {
-    gSkUseAnalyticAA   = FLAGS_analyticAA;
-    gSkForceAnalyticAA = FLAGS_forceAnalyticAA;
+    gSkUseAnalyticAA      = FLAGS_analyticAA;
+    gSkForceAnalyticAA    = FLAGS_forceAnalyticAA;
+    gSkParallelAnalyticAA = FLAGS_parallelAnalyticAA;
 }
 
 }
@@ -18,6 +18,7 @@
 #include "include/gpu/ganesh/SkImageGanesh.h"
 #include "include/gpu/ganesh/SkSurfaceGanesh.h"
 #include "src/codec/SkCodecImageGenerator.h"
+#include "src/core/SkConvertPixels.h"
 #include "src/core/SkYUVAInfoLocation.h"
 #include "src/core/SkYUVMath.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
@@ -75,6 +76,9 @@ protected:
         if (kUnknown_SkColorType == fFlattened.colorType()) {
             fFlattened.allocPixels(info);
             SkASSERT(info == this->getInfo());
+            if (SkConvertYUVAPixels(fFlattened.pixmap(), fPixmaps)) {
+                return fFlattened.readPixels(info, pixels, rowBytes, 0, 0);
+            }
 
             float mtx[20];
             SkColorMatrix_YUV2RGB(fPixmaps.yuvaInfo().yuvColorSpace(), mtx);
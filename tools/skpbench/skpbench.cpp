@@ -22,6 +22,7 @@
 #include "src/core/SkTaskGroup.h"
 #include "src/gpu/ganesh/GrCaps.h"
 #include "src/gpu/ganesh/GrDirectContextPriv.h"
+#include "src/gpu/ganesh/GrGpu.h"
 #include "src/gpu/ganesh/SkGr.h"
 #include "src/gpu/ganesh/image/GrImageUtils.h"
 #include "src/utils/SkOSPath.h"
@@ -45,9 +46,11 @@
 #include <stdlib.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
 #include <cinttypes>
 #include <cmath>
+#include <thread>
 #include <vector>
 
 /**
@@ -62,6 +65,9 @@
  * Well, maybe a little fanciness, MSKP's can be loaded and played. The animation is played as many
  * times as necessary to reach the target sample duration and FPS is reported.
  *
+ * With --threads, the skp is replayed on several threads at once, each with its own context and
+ * render target, and their combined throughput is reported.
+ *
  * Currently, only GPU configs are supported.
  */
 
@@ -83,6 +89,12 @@ static DEFINE_int(verbosity, 4, "level of verbosity (0=none to 5=debug)");
 static DEFINE_bool(suppressHeader, false, "don't print a header row before the results");
 static DEFINE_double(scale, 1, "Scale the size of the canvas and the zoom level by this factor.");
 static DEFINE_bool(dumpSamples, false, "print the individual samples to stdout");
+static DEFINE_int(threads, 1,
+                  "replay the skp on this many threads at once, each with its own context, "
+                  "and report their combined throughput");
+static DEFINE_bool(breakdown, false,
+                   "print to stderr how each frame's cpu time splits into record, flush, submit, "
+                   "and waiting for the gpu");
 
 static const char header[] =
 "   accum    median       max       min   stddev  samples  sample_ms  clock  metric  config    bench";
@@ -105,6 +117,52 @@ struct Sample {
     duration   fDuration;
 };
 
+// Where the frames' cpu time went, for --breakdown.
+struct PhaseTimes {
+    using duration = std::chrono::nanoseconds;
+
+    PhaseTimes& operator+=(const PhaseTimes& that) {
+        fRecord += that.fRecord;
+        fFlush += that.fFlush;
+        fSubmit += that.fSubmit;
+        fWait += that.fWait;
+        fFrames += that.fFrames;
+        fRenderPasses += that.fRenderPasses;
+        return *this;
+    }
+
+    duration fRecord{0};  // drawing the picture into the surface's ops
+    duration fFlush{0};   // turning the ops into gpu commands
+    duration fSubmit{0};  // handing the commands to the gpu
+    duration fWait{0};    // waiting for the gpu to fall back within kMaxFrameLag
+    int      fFrames = 0;
+    int      fRenderPasses = 0;  // -1 if the context doesn't count them
+};
+
+// Splits the time between laps among the phases of a frame, if --breakdown is set.
+class PhaseTimer {
+public:
+    using clock = std::chrono::steady_clock;
+
+    explicit PhaseTimer(PhaseTimes* times) : fTimes(FLAGS_breakdown ? times : nullptr) {
+        if (fTimes) {
+            fLap = clock::now();
+        }
+    }
+
+    void lap(PhaseTimes::duration PhaseTimes::* phase) {
+        if (fTimes) {
+            clock::time_point now = clock::now();
+            fTimes->*phase += now - fLap;
+            fLap = now;
+        }
+    }
+
+private:
+    PhaseTimes* const fTimes;
+    clock::time_point fLap;
+};
+
 class GpuSync {
 public:
     GpuSync() {}
@@ -114,10 +172,13 @@ public:
 
     sk_gpu_test::FlushFinishTracker* newFlushTracker(GrDirectContext* context);
 
+    PhaseTimes* phaseTimes() { return &fPhaseTimes; }
+
 private:
     enum { kMaxFrameLag = 3 };
     sk_sp<sk_gpu_test::FlushFinishTracker> fFinishTrackers[kMaxFrameLag - 1];
     int fCurrentFlushIdx = 0;
+    PhaseTimes fPhaseTimes;
 };
 
 enum class ExitErr {
@@ -345,10 +406,20 @@ static void run_ddl_benchmark(sk_gpu_test::TestContext* testContext,
     tiles.deleteBackendTextures(nullptr, dContext);
 }
 
+// The number of render passes the context has begun, or -1 if it doesn't count them.
+static int render_pass_count(GrDirectContext* context) {
+#if GR_GPU_STATS
+    return context->priv().getGpu()->stats()->renderPasses();
+#else
+    return -1;
+#endif
+}
+
 static void run_benchmark(GrDirectContext* context,
                           sk_sp<SkSurface> surface,
                           SkpProducer* skpp,
-                          std::vector<Sample>* samples) {
+                          std::vector<Sample>* samples,
+                          PhaseTimes* phaseTimes = nullptr) {
     using clock = std::chrono::high_resolution_clock;
     const Sample::duration sampleDuration = std::chrono::milliseconds(FLAGS_sampleMs);
     const clock::duration benchDuration = std::chrono::milliseconds(FLAGS_duration);
@@ -359,6 +430,8 @@ static void run_benchmark(GrDirectContext* context,
         i += skpp->drawAndFlushAndSync(context, surface.get(), gpuSync);
     } while(i < kNumFlushesToPrimeCache);
 
+    *gpuSync.phaseTimes() = PhaseTimes();
+    const int startRenderPasses = render_pass_count(context);
     clock::time_point now = clock::now();
     const clock::time_point endTime = now + benchDuration;
 
@@ -374,12 +447,158 @@ static void run_benchmark(GrDirectContext* context,
         } while (sample.fDuration < sampleDuration);
     } while (now < endTime || 0 == samples->size() % 2);
 
+    if (phaseTimes) {
+        *phaseTimes = *gpuSync.phaseTimes();
+        for (const Sample& sample : *samples) {
+            phaseTimes->fFrames += sample.fFrames;
+        }
+        phaseTimes->fRenderPasses = startRenderPasses < 0
+                ? -1
+                : render_pass_count(context) - startRenderPasses;
+    }
+
     // Make sure the gpu has finished all its work before we exit this function and delete the
     // fence.
     context->flush(surface.get());
     context->submit(GrSyncCpu::kYes);
 }
 
+// A context on the requested config, with a render target to draw the skp into.
+struct BenchTarget {
+    std::unique_ptr<sk_gpu_test::GrContextFactory> fFactory;
+    sk_gpu_test::ContextInfo fCtxInfo;
+    sk_sp<SkSurface> fSurface;
+};
+
+static BenchTarget create_target(const SkCommandLineConfigGpu* config,
+                                 const GrContextOptions& ctxOptions,
+                                 int width,
+                                 int height,
+                                 const SkRect& cullRect) {
+    BenchTarget target;
+
+    // Create a context.
+    target.fFactory = std::make_unique<sk_gpu_test::GrContextFactory>(ctxOptions);
+    target.fCtxInfo =
+        target.fFactory->getContextInfo(config->getContextType(), config->getContextOverrides());
+    auto ctx = target.fCtxInfo.directContext();
+    if (!ctx) {
+        exitf(ExitErr::kUnavailable, "failed to create context for config %s",
+                                     config->getTag().c_str());
+    }
+    if (ctx->maxRenderTargetSize() < std::max(width, height)) {
+        exitf(ExitErr::kUnavailable, "render target size %ix%i not supported by platform (max: %i)",
+              width, height, ctx->maxRenderTargetSize());
+    }
+    GrBackendFormat format = ctx->defaultBackendFormat(config->getColorType(), GrRenderable::kYes);
+    if (!format.isValid()) {
+        exitf(ExitErr::kUnavailable, "failed to get GrBackendFormat from SkColorType: %d",
+                                     config->getColorType());
+    }
+    int supportedSampleCount = ctx->priv().caps()->getRenderTargetSampleCount(
+            config->getSamples(), format);
+    if (supportedSampleCount != config->getSamples()) {
+        exitf(ExitErr::kUnavailable, "sample count %i not supported by platform",
+                                     config->getSamples());
+    }
+    sk_gpu_test::TestContext* testCtx = target.fCtxInfo.testContext();
+    if (!testCtx) {
+        exitf(ExitErr::kSoftware, "testContext is null");
+    }
+    if (!testCtx->fenceSyncSupport()) {
+        exitf(ExitErr::kUnavailable, "GPU does not support fence sync");
+    }
+
+    // Create a render target.
+    SkImageInfo info = SkImageInfo::Make(
+            width, height, config->getColorType(), config->getAlphaType(), config->refColorSpace());
+    SkSurfaceProps props(config->getSurfaceFlags(), kRGB_H_SkPixelGeometry);
+    target.fSurface =
+            SkSurfaces::RenderTarget(ctx, skgpu::Budgeted::kNo, info, config->getSamples(), &props);
+    if (!target.fSurface) {
+        exitf(ExitErr::kUnavailable, "failed to create %ix%i render target for config %s",
+                                     width, height, config->getTag().c_str());
+    }
+
+    SkCanvas* canvas = target.fSurface->getCanvas();
+    canvas->translate(-cullRect.x(), -cullRect.y());
+    if (FLAGS_scale != 1) {
+        canvas->scale(FLAGS_scale, FLAGS_scale);
+    }
+    return target;
+}
+
+// Runs the benchmark on FLAGS_threads threads at once, each with a target of its own, and
+// combines their samples: a combined sample has the frames of all the threads' samples at the
+// same index, and lasts as long as the longest of them.
+static void run_threaded_benchmark(const SkCommandLineConfigGpu* config,
+                                   const GrContextOptions& ctxOptions,
+                                   int width,
+                                   int height,
+                                   const SkRect& cullRect,
+                                   SkpProducer* skpp,
+                                   std::vector<Sample>* samples,
+                                   PhaseTimes* phaseTimes) {
+    std::vector<std::vector<Sample>> threadSamples(FLAGS_threads);
+    std::vector<PhaseTimes> threadPhaseTimes(FLAGS_threads);
+    std::atomic<int> ready{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < FLAGS_threads; ++t) {
+        threads.emplace_back([&, t] {
+            BenchTarget target = create_target(config, ctxOptions, width, height, cullRect);
+            // Don't start timing until every thread has its context.
+            ready.fetch_add(1);
+            while (ready.load() < FLAGS_threads) {
+                std::this_thread::yield();
+            }
+            run_benchmark(target.fCtxInfo.directContext(), target.fSurface, skpp,
+                          &threadSamples[t], &threadPhaseTimes[t]);
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    size_t count = threadSamples[0].size();
+    for (const std::vector<Sample>& s : threadSamples) {
+        count = std::min(count, s.size());
+    }
+    if (0 == count % 2) {
+        --count;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        Sample combined;
+        for (const std::vector<Sample>& s : threadSamples) {
+            combined.fFrames += s[i].fFrames;
+            combined.fDuration = std::max(combined.fDuration, s[i].fDuration);
+        }
+        samples->push_back(combined);
+    }
+
+    for (const PhaseTimes& times : threadPhaseTimes) {
+        *phaseTimes += times;
+    }
+    if (std::any_of(threadPhaseTimes.begin(), threadPhaseTimes.end(),
+                    [](const PhaseTimes& times) { return times.fRenderPasses < 0; })) {
+        phaseTimes->fRenderPasses = -1;
+    }
+}
+
+static void print_breakdown(const PhaseTimes& times) {
+    auto msPerFrame = [&](PhaseTimes::duration d) {
+        return std::chrono::duration<double, std::milli>(d).count() / std::max(times.fFrames, 1);
+    };
+    fprintf(stderr, "cpu ms/frame: record %.4g  flush %.4g  submit %.4g  wait for gpu %.4g",
+            msPerFrame(times.fRecord), msPerFrame(times.fFlush), msPerFrame(times.fSubmit),
+            msPerFrame(times.fWait));
+    if (times.fRenderPasses >= 0) {
+        fprintf(stderr, "  render passes/frame %.3g",
+                (double)times.fRenderPasses / std::max(times.fFrames, 1));
+    }
+    fprintf(stderr, "\n");
+}
+
 static void run_gpu_time_benchmark(sk_gpu_test::GpuTimer* gpuTimer,
                                    GrDirectContext* context,
                                    sk_sp<SkSurface> surface,
@@ -569,49 +788,24 @@ int main(int argc, char** argv) {
               config->getTag().c_str());
     }
 
-    // Create a context.
-    GrContextOptions ctxOptions;
-    CommonFlags::SetCtxOptions(&ctxOptions);
-    sk_gpu_test::GrContextFactory factory(ctxOptions);
-    sk_gpu_test::ContextInfo ctxInfo =
-        factory.getContextInfo(config->getContextType(), config->getContextOverrides());
-    auto ctx = ctxInfo.directContext();
-    if (!ctx) {
-        exitf(ExitErr::kUnavailable, "failed to create context for config %s",
-                                     config->getTag().c_str());
-    }
-    if (ctx->maxRenderTargetSize() < std::max(width, height)) {
-        exitf(ExitErr::kUnavailable, "render target size %ix%i not supported by platform (max: %i)",
-              width, height, ctx->maxRenderTargetSize());
+    if (FLAGS_threads < 1) {
+        exitf(ExitErr::kUsage, "invalid thread count %i: must be at least 1", FLAGS_threads);
     }
-    GrBackendFormat format = ctx->defaultBackendFormat(config->getColorType(), GrRenderable::kYes);
-    if (!format.isValid()) {
-        exitf(ExitErr::kUnavailable, "failed to get GrBackendFormat from SkColorType: %d",
-                                     config->getColorType());
-    }
-    int supportedSampleCount = ctx->priv().caps()->getRenderTargetSampleCount(
-            config->getSamples(), format);
-    if (supportedSampleCount != config->getSamples()) {
-        exitf(ExitErr::kUnavailable, "sample count %i not supported by platform",
-                                     config->getSamples());
-    }
-    sk_gpu_test::TestContext* testCtx = ctxInfo.testContext();
-    if (!testCtx) {
-        exitf(ExitErr::kSoftware, "testContext is null");
+    if (FLAGS_threads > 1 && (FLAGS_ddl || FLAGS_gpuClock || !FLAGS_png.isEmpty())) {
+        exitf(ExitErr::kUsage, "--threads can't be combined with --ddl, --gpuClock, or --png");
     }
-    if (!testCtx->fenceSyncSupport()) {
-        exitf(ExitErr::kUnavailable, "GPU does not support fence sync");
+    if (FLAGS_breakdown && (FLAGS_ddl || FLAGS_gpuClock)) {
+        exitf(ExitErr::kUsage, "--breakdown can't be combined with --ddl or --gpuClock");
     }
 
-    // Create a render target.
-    SkImageInfo info = SkImageInfo::Make(
-            width, height, config->getColorType(), config->getAlphaType(), config->refColorSpace());
-    SkSurfaceProps props(config->getSurfaceFlags(), kRGB_H_SkPixelGeometry);
-    sk_sp<SkSurface> surface =
-            SkSurfaces::RenderTarget(ctx, skgpu::Budgeted::kNo, info, config->getSamples(), &props);
-    if (!surface) {
-        exitf(ExitErr::kUnavailable, "failed to create %ix%i render target for config %s",
-                                     width, height, config->getTag().c_str());
+    GrContextOptions ctxOptions;
+    CommonFlags::SetCtxOptions(&ctxOptions);
+
+    std::unique_ptr<SkpProducer> skpp;
+    if (mskp) {
+        skpp = std::move(mskp);
+    } else {
+        skpp = std::make_unique<StaticSkp>(skp);
     }
 
     // Run the benchmark.
@@ -622,19 +816,30 @@ int main(int argc, char** argv) {
     } else {
         samples.reserve(2 * FLAGS_duration);
     }
-    SkCanvas* canvas = surface->getCanvas();
-    canvas->translate(-skp->cullRect().x(), -skp->cullRect().y());
-    if (FLAGS_scale != 1) {
-        canvas->scale(FLAGS_scale, FLAGS_scale);
+    PhaseTimes phaseTimes;
+    if (FLAGS_threads > 1) {
+        run_threaded_benchmark(config, ctxOptions, width, height, skp->cullRect(), skpp.get(),
+                               &samples, &phaseTimes);
+        if (FLAGS_breakdown) {
+            print_breakdown(phaseTimes);
+        }
+        SkString threadedConfig = SkStringPrintf("%sx%i", config->getTag().c_str(), FLAGS_threads);
+        print_result(samples, threadedConfig.c_str(), srcname.c_str());
+        return(0);
     }
+
+    BenchTarget target = create_target(config, ctxOptions, width, height, skp->cullRect());
+    auto ctx = target.fCtxInfo.directContext();
+    sk_gpu_test::TestContext* testCtx = target.fCtxInfo.testContext();
+    sk_sp<SkSurface> surface = target.fSurface;
     if (!FLAGS_gpuClock) {
         if (FLAGS_ddl) {
             run_ddl_benchmark(testCtx, ctx, surface, skp.get(), &samples);
-        } else if (!mskp) {
-            auto s = std::make_unique<StaticSkp>(skp);
-            run_benchmark(ctx, surface, s.get(), &samples);
         } else {
-            run_benchmark(ctx, surface, mskp.get(), &samples);
+            run_benchmark(ctx, surface, skpp.get(), &samples, &phaseTimes);
+            if (FLAGS_breakdown) {
+                print_breakdown(phaseTimes);
+            }
         }
     } else {
         if (FLAGS_ddl) {
@@ -650,7 +855,7 @@ int main(int argc, char** argv) {
     // Save a proof (if one was requested).
     if (!FLAGS_png.isEmpty()) {
         SkBitmap bmp;
-        bmp.allocPixels(info);
+        bmp.allocPixels(surface->imageInfo());
         if (!surface->getCanvas()->readPixels(bmp, 0, 0)) {
             exitf(ExitErr::kUnavailable, "failed to read canvas pixels for png");
         }
@@ -666,20 +871,26 @@ int main(int argc, char** argv) {
 }
 
 static void flush_with_sync(GrDirectContext* context, GpuSync& gpuSync) {
+    PhaseTimer timer(gpuSync.phaseTimes());
     gpuSync.waitIfNeeded();
+    timer.lap(&PhaseTimes::fWait);
 
     GrFlushInfo flushInfo;
     flushInfo.fFinishedProc = sk_gpu_test::FlushFinishTracker::FlushFinished;
     flushInfo.fFinishedContext = gpuSync.newFlushTracker(context);
 
     context->flush(flushInfo);
+    timer.lap(&PhaseTimes::fFlush);
     context->submit();
+    timer.lap(&PhaseTimes::fSubmit);
 }
 
 static void draw_skp_and_flush_with_sync(GrDirectContext* context, SkSurface* surface,
                                          const SkPicture* skp, GpuSync& gpuSync) {
+    PhaseTimer timer(gpuSync.phaseTimes());
     auto canvas = surface->getCanvas();
     canvas->drawPicture(skp);
+    timer.lap(&PhaseTimes::fRecord);
 
     flush_with_sync(context, gpuSync);
 }
@@ -31,6 +31,15 @@ static const int kInvalidTag = 3;
 static const int kMissingInput = 4;
 static const int kIOError = 5;
 
+// Since kAlignedStreamSections, the op data and buffer sections are preceded by padding.
+static bool skip_section_padding(SkStream* stream, const SkPictInfo& info) {
+    if (info.getVersion() < SkPicturePriv::kAlignedStreamSections) {
+        return true;
+    }
+    uint8_t padding;
+    return stream->readU8(&padding) && padding < 4 && stream->move(padding);
+}
+
 int main(int argc, char** argv) {
     CommandLineFlags::SetUsage("Prints information about an skp file");
     CommandLineFlags::Parse(argc, argv);
@@ -105,6 +114,7 @@ int main(int argc, char** argv) {
             if (FLAGS_tags && !FLAGS_quiet) {
                 SkDebugf("SK_PICT_READER_TAG %d\n", chunkSize);
             }
+            if (!skip_section_padding(&stream, info)) { return kTruncatedFile; }
             break;
         case SK_PICT_FACTORY_TAG:
             if (FLAGS_tags && !FLAGS_quiet) {
@@ -141,6 +151,7 @@ int main(int argc, char** argv) {
             if (FLAGS_tags && !FLAGS_quiet) {
                 SkDebugf("SK_PICT_BUFFER_SIZE_TAG %d\n", chunkSize);
             }
+            if (!skip_section_padding(&stream, info)) { return kTruncatedFile; }
             break;
         default:
             if (!FLAGS_quiet) {
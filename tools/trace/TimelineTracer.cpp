@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#include "tools/trace/TimelineTracer.h"
+
+#include "include/core/SkString.h"
+#include "src/base/SkTime.h"
+#include "src/core/SkTraceEvent.h"
+
+#include <cstring>
+#include <utility>
+
+namespace {
+
+struct LaneEvent {
+    const char*          fName;  // Matched anywhere in the event's name
+    TimelineTracer::Lane fLane;
+};
+
+// The outermost events of each kind. Nested ones (e.g. a driver compiling one of a pipeline's
+// shaders) would only draw over their parents.
+constexpr LaneEvent kLaneEvents[] = {
+    {"GrDrawingManager::flush",             TimelineTracer::Lane::kFlush},
+    {"Recorder::snap",                      TimelineTracer::Lane::kFlush},
+    {"Context::insertRecording",            TimelineTracer::Lane::kFlush},
+    {"GrGpu::submitToGpu",                  TimelineTracer::Lane::kSubmit},
+    {"Context::submit",                     TimelineTracer::Lane::kSubmit},
+    {"GrGLProgramBuilder::finalize",        TimelineTracer::Lane::kPipelines},
+    {"GrVkPipelineStateBuilder::finalize",  TimelineTracer::Lane::kPipelines},
+    {"createGraphicsPipeline",              TimelineTracer::Lane::kPipelines},
+    {"SkScalerContext::getImage",           TimelineTracer::Lane::kGlyphs},
+    {"GrGpu::writePixels",                  TimelineTracer::Lane::kUploads},
+    {"GrGpu::transferPixelsTo",             TimelineTracer::Lane::kUploads},
+    {"UploadInstance::Make",                TimelineTracer::Lane::kUploads},
+};
+
+// Frames that are never collected, e.g. because the tool stopped drawing, keep at most this many.
+constexpr size_t kMaxSpansPerFrame = 1 << 16;
+
+// Handles hold the frame an event began in and its index in that frame's spans, plus one so that
+// no handle is 0, which is what dropped events get.
+SkEventTracer::Handle make_handle(uint32_t frame, size_t index) {
+    return (static_cast<uint64_t>(frame) << 32) | (index + 1);
+}
+
+}  // namespace
+
+const char* TimelineTracer::LaneName(Lane lane) {
+    switch (lane) {
+        case Lane::kFlush:     return "Flush";
+        case Lane::kSubmit:    return "Submit";
+        case Lane::kPipelines: return "Pipelines";
+        case Lane::kGlyphs:    return "Glyphs";
+        case Lane::kUploads:   return "Uploads";
+    }
+    SkUNREACHABLE;
+}
+
+void TimelineTracer::setEnabled(bool enabled) {
+    for (uint8_t& flag : fCategoryFlags) {
+        flag = enabled ? kEnabledForRecording_CategoryGroupEnabledFlags : 0;
+    }
+    if (!enabled) {
+        this->nextFrame();
+    }
+}
+
+std::vector<TimelineTracer::Span> TimelineTracer::nextFrame() {
+    SkAutoMutexExclusive lock(fMutex);
+    fFrame++;
+    return std::exchange(fSpans, {});
+}
+
+int TimelineTracer::laneFor(const char* name) {
+    if (int* lane = fLanesByName.find(name)) {
+        return *lane;
+    }
+    int lane = -1;
+    for (const LaneEvent& event : kLaneEvents) {
+        if (strstr(name, event.fName)) {
+            lane = static_cast<int>(event.fLane);
+            break;
+        }
+    }
+    fLanesByName.set(name, lane);
+    return lane;
+}
+
+SkEventTracer::Handle TimelineTracer::addTraceEvent(char            phase,
+                                                    const uint8_t*  categoryEnabledFlag,
+                                                    const char*     name,
+                                                    uint64_t        id,
+                                                    int             numArgs,
+                                                    const char**    argNames,
+                                                    const uint8_t*  argTypes,
+                                                    const uint64_t* argValues,
+                                                    uint8_t         flags) {
+    if (phase != TRACE_EVENT_PHASE_COMPLETE) {
+        return 0;
+    }
+    SkAutoMutexExclusive lock(fMutex);
+    int lane = this->laneFor(name);
+    if (lane < 0 || fSpans.size() >= kMaxSpansPerFrame) {
+        return 0;
+    }
+    double now = SkTime::GetMSecs();
+    fSpans.push_back({static_cast<Lane>(lane), now, now - 1});
+    return make_handle(fFrame, fSpans.size() - 1);
+}
+
+void TimelineTracer::updateTraceEventDuration(const uint8_t*        categoryEnabledFlag,
+                                              const char*           name,
+                                              SkEventTracer::Handle handle) {
+    if (!handle) {
+        return;
+    }
+    double now = SkTime::GetMSecs();
+    SkAutoMutexExclusive lock(fMutex);
+    // Events that outlive their frame are left open; it has already been handed out.
+    if ((handle >> 32) == fFrame) {
+        fSpans[(handle & 0xffffffff) - 1].fEndMs = now;
+    }
+}
+
+const uint8_t* TimelineTracer::getCategoryGroupEnabled(const char* name) {
+    // Like SkEventTracingCategories, ignore the "disabled-by-default-" prefix.
+    if (SkStrStartsWith(name, TRACE_CATEGORY_PREFIX)) {
+        name += strlen(TRACE_CATEGORY_PREFIX);
+    }
+    for (int i = 0; i < kCategoryCount; ++i) {
+        if (0 == strcmp(name, kCategories[i])) {
+            return &fCategoryFlags[i];
+        }
+    }
+    return &fDisabledFlag;
+}
+
+const char* TimelineTracer::getCategoryGroupName(const uint8_t* categoryEnabledFlag) {
+    for (int i = 0; i < kCategoryCount; ++i) {
+        if (categoryEnabledFlag == &fCategoryFlags[i]) {
+            return kCategories[i];
+        }
+    }
+    return "disabled";
+}
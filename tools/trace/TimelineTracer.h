@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 Google LLC
+ *
+ * Use of this source code is governed by a BSD-style license that can be
+ * found in the LICENSE file.
+ */
+
+#ifndef TimelineTracer_DEFINED
+#define TimelineTracer_DEFINED
+
+#include "include/private/base/SkMutex.h"
+#include "include/private/base/SkThreadAnnotations.h"
+#include "include/utils/SkEventTracer.h"
+#include "src/core/SkTHash.h"
+
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+/**
+ * A SkEventTracer that keeps the spans of the trace events that say where a frame's time went:
+ * flushes, submits, pipeline compiles, glyph rasterization and texture uploads. Tools collect them
+ * one frame at a time, with nextFrame(), to show them while they run.
+ *
+ * Events are only collected while the tracer is enabled, and every other event is dropped.
+ */
+class TimelineTracer final : public SkEventTracer {
+public:
+    enum class Lane {
+        kFlush,
+        kSubmit,
+        kPipelines,
+        kGlyphs,
+        kUploads,
+
+        kLast = kUploads,
+    };
+    static constexpr int kLaneCount = static_cast<int>(Lane::kLast) + 1;
+
+    static const char* LaneName(Lane);
+
+    struct Span {
+        Lane   fLane;
+        double fBeginMs;  // Both from SkTime::GetMSecs()
+        double fEndMs;    // Less than fBeginMs if the event hadn't ended when its frame did
+    };
+
+    void setEnabled(bool enabled);
+
+    /** Returns the spans of the events that began since the last call, and starts a new frame. */
+    std::vector<Span> nextFrame();
+
+    SkEventTracer::Handle addTraceEvent(char            phase,
+                                        const uint8_t*  categoryEnabledFlag,
+                                        const char*     name,
+                                        uint64_t        id,
+                                        int             numArgs,
+                                        const char**    argNames,
+                                        const uint8_t*  argTypes,
+                                        const uint64_t* argValues,
+                                        uint8_t         flags) override;
+
+    void updateTraceEventDuration(const uint8_t*        categoryEnabledFlag,
+                                  const char*           name,
+                                  SkEventTracer::Handle handle) override;
+
+    const uint8_t* getCategoryGroupEnabled(const char* name) override;
+    const char* getCategoryGroupName(const uint8_t* categoryEnabledFlag) override;
+
+private:
+    // Returns the lane an event goes in, or -1 if it isn't one we show.
+    int laneFor(const char* name) SK_REQUIRES(fMutex);
+
+    // The only categories the events we show are in. Call sites cache pointers to these flags, so
+    // enabling and disabling the tracer just flips them.
+    static constexpr const char* kCategories[] = {"skia", "skia.gpu", "skia.shaders"};
+    static constexpr int kCategoryCount = std::size(kCategories);
+    uint8_t fCategoryFlags[kCategoryCount] = {};
+    uint8_t fDisabledFlag = 0;
+
+    SkMutex fMutex;
+    std::vector<Span> fSpans SK_GUARDED_BY(fMutex);
+    uint32_t fFrame SK_GUARDED_BY(fMutex) = 0;
+    // Event names are string literals or __PRETTY_FUNCTION__, so each site's name has one address.
+    skia_private::THashMap<const char*, int> fLanesByName SK_GUARDED_BY(fMutex);
+};
+
+#endif
@@ -33,6 +33,7 @@ StatsLayer::StatsLayer()
     , fCumulativeMeasurementCount(0)
     , fDisplayScale(1.0f) {
     memset(fTotalTimes, 0, sizeof(fTotalTimes));
+    memset(fLaneTimes, 0, sizeof(fLaneTimes));
 }
 
 void StatsLayer::resetMeasurements() {
@@ -40,6 +41,9 @@ void StatsLayer::resetMeasurements() {
         memset(fTimers[i].fTimes, 0, sizeof(fTimers[i].fTimes));
     }
     memset(fTotalTimes, 0, sizeof(fTotalTimes));
+    memset(fLaneTimes, 0, sizeof(fLaneTimes));
+    fFrameSpans.clear();
+    fLastFrameSpans.clear();
     fCurrentMeasurement = -1;
     fLastTotalBegin = 0;
     fCumulativeMeasurementTime = 0;
@@ -53,27 +57,60 @@ StatsLayer::Timer StatsLayer::addTimer(const char* label, SkColor color, SkColor
     newData.fLabel = label;
     newData.fColor = color;
     newData.fLabelColor = labelColor ? labelColor : color;
+    newData.fBeginMs = 0;
     return newTimer;
 }
 
 void StatsLayer::beginTiming(Timer timer) {
     if (fCurrentMeasurement >= 0) {
-        fTimers[timer].fTimes[fCurrentMeasurement] -= SkTime::GetMSecs();
+        double now = SkTime::GetMSecs();
+        fTimers[timer].fTimes[fCurrentMeasurement] -= now;
+        fTimers[timer].fBeginMs = now;
     }
 }
 
 void StatsLayer::endTiming(Timer timer) {
     if (fCurrentMeasurement >= 0) {
-        fTimers[timer].fTimes[fCurrentMeasurement] += SkTime::GetMSecs();
+        double now = SkTime::GetMSecs();
+        fTimers[timer].fTimes[fCurrentMeasurement] += now;
+        fFrameSpans.push_back(
+                {timer, fTimers[timer].fBeginMs - fLastTotalBegin, now - fLastTotalBegin});
+    }
+}
+
+void StatsLayer::setTimelineEnabled(bool enabled) {
+    if (fTimeline) {
+        fTimeline->setEnabled(enabled);
     }
 }
 
 void StatsLayer::onPrePaint() {
+    std::vector<TimelineTracer::Span> tracedSpans;
+    if (fTimeline) {
+        tracedSpans = fTimeline->nextFrame();
+    }
     if (fCurrentMeasurement >= 0) {
         fTotalTimes[fCurrentMeasurement] = SkTime::GetMSecs() - fLastTotalBegin;
         fCumulativeMeasurementTime += fTotalTimes[fCurrentMeasurement];
         fCumulativeMeasurementCount++;
+
+        for (double* laneTimes : fLaneTimes) {
+            laneTimes[fCurrentMeasurement] = 0;
+        }
+        for (const TimelineTracer::Span& span : tracedSpans) {
+            // Events still running are cut off at the end of the frame.
+            double end = span.fEndMs >= span.fBeginMs ? span.fEndMs
+                                                       : fLastTotalBegin +
+                                                         fTotalTimes[fCurrentMeasurement];
+            int lane = static_cast<int>(span.fLane);
+            fFrameSpans.push_back({fTimers.size() + lane,
+                                   span.fBeginMs - fLastTotalBegin,
+                                   end - fLastTotalBegin});
+            fLaneTimes[lane][fCurrentMeasurement] += end - span.fBeginMs;
+        }
+        fLastFrameSpans = std::move(fFrameSpans);
     }
+    fFrameSpans.clear();
     fCurrentMeasurement = (fCurrentMeasurement + 1) & (kMeasurementCount - 1);
     SkASSERT(fCurrentMeasurement >= 0 && fCurrentMeasurement < kMeasurementCount);
     fLastTotalBegin = SkTime::GetMSecs();
@@ -185,5 +222,90 @@ void StatsLayer::onPaint(SkSurface* surface) {
                            rect.fLeft + 3, rect.fTop + 28 + (14 * timer), font, paint);
     }
 
+    if (this->timelineRows() > 0) {
+        SkFont timelineFont = font;
+        timelineFont.setSize(10);
+        this->drawTimeline(canvas,
+                           SkRect::MakeLTRB(rect.fRight - kTimelineWidth,
+                                            rect.fBottom + kDisplayPadding,
+                                            rect.fRight,
+                                            rect.fBottom + kDisplayPadding +
+                                                    kTimelineRowHeight * this->timelineRows()),
+                           timelineFont);
+    }
+
     canvas->restore();
 }
+
+int StatsLayer::timelineRows() const {
+    return fTimers.size() + (fTimeline ? TimelineTracer::kLaneCount : 0);
+}
+
+void StatsLayer::drawTimeline(SkCanvas* canvas, const SkRect& rect, const SkFont& font) {
+    // Two frames at 60 fps fit across, with a line where the first one ends.
+    static const float kTimelineMS = 2 * 1000.f / 60.f;
+    static const float kLabelWidth = 100;
+    const float pixelsPerMS = (rect.width() - kLabelWidth) / kTimelineMS;
+    const float left = rect.fLeft + kLabelWidth;
+
+    SkPaint paint;
+    paint.setColor(SK_ColorBLACK);
+    canvas->drawRect(rect, paint);
+    paint.setColor(SK_ColorLTGRAY);
+    canvas->drawLine(left + kTimelineMS / 2 * pixelsPerMS, rect.fTop,
+                     left + kTimelineMS / 2 * pixelsPerMS, rect.fBottom, paint);
+
+    auto rowColor = [&](int row) {
+        if (row < fTimers.size()) {
+            return fTimers[row].fColor;
+        }
+        static constexpr SkColor kLaneColors[TimelineTracer::kLaneCount] = {
+            0xffff6666,  // Flush
+            0xffffcc33,  // Submit
+            0xff33ccff,  // Pipelines
+            0xffcc66ff,  // Glyphs
+            0xff66ff99,  // Uploads
+        };
+        return kLaneColors[row - fTimers.size()];
+    };
+
+    // Label each row with what it shows, and how long that took per frame on average.
+    for (int row = 0; row < this->timelineRows(); ++row) {
+        double total = 0;
+        SkString label;
+        if (row < fTimers.size()) {
+            for (double time : fTimers[row].fTimes) {
+                total += time;
+            }
+            label = fTimers[row].fLabel;
+        } else {
+            auto lane = static_cast<TimelineTracer::Lane>(row - fTimers.size());
+            for (double time : fLaneTimes[static_cast<int>(lane)]) {
+                total += time;
+            }
+            label = TimelineTracer::LaneName(lane);
+        }
+        paint.setColor(rowColor(row));
+        canvas->drawString(SkStringPrintf("%s: %4.3f", label.c_str(), total / kMeasurementCount),
+                           rect.fLeft + 3,
+                           rect.fTop + kTimelineRowHeight * (row + 1) - 3,
+                           font,
+                           paint);
+    }
+
+    canvas->save();
+    canvas->clipRect(SkRect::MakeLTRB(left, rect.fTop, rect.fRight, rect.fBottom));
+    for (const TimelineSpan& span : fLastFrameSpans) {
+        paint.setColor(rowColor(span.fRow));
+        // Keep even the shortest spans visible.
+        float begin = left + (float)span.fBeginMs * pixelsPerMS;
+        float end = std::max(left + (float)span.fEndMs * pixelsPerMS, begin + 1);
+        float top = rect.fTop + kTimelineRowHeight * span.fRow + 2;
+        canvas->drawRect(SkRect::MakeLTRB(begin, top, end, top + kTimelineRowHeight - 4), paint);
+    }
+    canvas->restore();
+
+    paint.setColor(SK_ColorRED);
+    paint.setStyle(SkPaint::kStroke_Style);
+    canvas->drawRect(rect, paint);
+}
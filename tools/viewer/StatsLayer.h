@@ -12,8 +12,14 @@
 #include "include/core/SkString.h"
 #include "include/private/base/SkTArray.h"
 #include "tools/sk_app/Window.h"
+#include "tools/trace/TimelineTracer.h"
 
+#include <vector>
+
+class SkCanvas;
+class SkFont;
 class SkSurface;
+struct SkRect;
 
 class StatsLayer : public sk_app::Window::Layer {
 public:
@@ -31,6 +37,12 @@ public:
 
     void setDisplayScale(float scale) { fDisplayScale = scale; }
 
+    // Shows the spans of the timers and of 'tracer's events for the last frame, below the graph.
+    // The tracer is only enabled while setTimelineEnabled() says so, which should follow whether
+    // the layer is active.
+    void setTimeline(TimelineTracer* tracer) { fTimeline = tracer; }
+    void setTimelineEnabled(bool enabled);
+
 private:
     static const int kMeasurementCount = 1 << 6;  // should be power of 2 for fast mod
     struct TimerData {
@@ -38,9 +50,26 @@ private:
         SkString fLabel;
         SkColor fColor;
         SkColor fLabelColor;
+        double fBeginMs;  // When the current timing began, for the timeline
     };
     skia_private::TArray<TimerData> fTimers;
     double fTotalTimes[kMeasurementCount];
+
+    // Rows of the timeline are the timers, then the tracer's lanes.
+    struct TimelineSpan {
+        int fRow;
+        double fBeginMs;  // From the start of the frame
+        double fEndMs;
+    };
+    static constexpr int kTimelineWidth = 384;
+    static constexpr int kTimelineRowHeight = 14;
+    int timelineRows() const;
+    void drawTimeline(SkCanvas*, const SkRect&, const SkFont&);
+    TimelineTracer* fTimeline = nullptr;
+    std::vector<TimelineSpan> fFrameSpans;  // The frame being drawn
+    std::vector<TimelineSpan> fLastFrameSpans;
+    double fLaneTimes[TimelineTracer::kLaneCount][kMeasurementCount];
+
     int fCurrentMeasurement;
     double fLastTotalBegin;
     double fCumulativeMeasurementTime;
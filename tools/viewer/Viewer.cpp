@@ -34,6 +34,7 @@
 #include "include/private/base/SkDebug.h"
 #include "include/private/base/SkTPin.h"
 #include "include/private/base/SkTo.h"
+#include "include/utils/SkEventTracer.h"
 #include "include/utils/SkPaintFilterCanvas.h"
 #include "src/base/SkBase64.h"
 #include "src/base/SkTLazy.h"
@@ -65,6 +66,7 @@
 #include "tools/skui/Key.h"
 #include "tools/skui/ModifierKey.h"
 #include "tools/trace/EventTracingPriv.h"
+#include "tools/trace/TimelineTracer.h"
 #include "tools/viewer/BisectSlide.h"
 #include "tools/viewer/GMSlide.h"
 #include "tools/viewer/ImageSlide.h"
@@ -474,6 +476,12 @@ Viewer::Viewer(int argc, char** argv, void* platformData)
 #endif
 
     initializeEventTracingForTools();
+    // Unless --trace installed a tracer already, feed the stats overlay's timeline. It's leaked so
+    // it outlives the stats layer.
+    auto timeline = new TimelineTracer;
+    if (SkEventTracer::SetInstance(timeline, /*leakTracer=*/true)) {
+        fStatsLayer.setTimeline(timeline);
+    }
     static SkTaskGroup::Enabler kTaskGroupEnabler(FLAGS_threads);
 
     fBackendType = get_backend_type(FLAGS_backend[0]);
@@ -505,6 +513,7 @@ Viewer::Viewer(int argc, char** argv, void* platformData)
 
     // Configure timers
     fStatsLayer.setActive(FLAGS_stats);
+    fStatsLayer.setTimelineEnabled(FLAGS_stats);
     fAnimateTimer = fStatsLayer.addTimer("Animate", SK_ColorMAGENTA, 0xffff66ff);
     fPaintTimer = fStatsLayer.addTimer("Paint", SK_ColorGREEN);
     fFlushTimer = fStatsLayer.addTimer("Flush", SK_ColorRED, 0xffff6666);
@@ -564,6 +573,7 @@ Viewer::Viewer(int argc, char** argv, void* platformData)
     });
     fCommands.addCommand('s', "Overlays", "Toggle stats display", [this]() {
         fStatsLayer.setActive(!fStatsLayer.getActive());
+        fStatsLayer.setTimelineEnabled(fStatsLayer.getActive());
         fWindow->inval();
     });
     fCommands.addCommand('0', "Overlays", "Reset stats", [this]() {